@@ -0,0 +1,52 @@
+# GMAT Application Programmer's Interface Example
+#
+# This file configures a propagator using the GMAT API and advances an initial
+# state one day in 600 second increments with a single call, collecting the
+# time and state after each increment in an array.  See
+# Ex_R2020a_PropagationLoop.py for the same propagation one step at a time.
+
+# Load GMAT into the Python environment
+from load_gmat import *
+# Load a force model used for the propagation
+from Ex_R2020a_BasicFM import *
+
+import numpy
+
+# Build the propagation container class 
+pdprop = gmat.Construct("Propagator","PDProp")
+
+# Create and assign a numerical integrator for use in the propagation
+gator = gmat.Construct("PrinceDormand78", "Gator")
+pdprop.SetReference(gator)
+
+# Assign the force model imported from BasicFM
+pdprop.SetReference(fm)
+
+# Set some of the fields for the integration
+pdprop.SetField("InitialStepSize", 60.0)
+pdprop.SetField("Accuracy", 1.0e-12)
+pdprop.SetField("MinStep", 0.0)
+
+# Perform top level initialization
+gmat.Initialize()
+
+# Setup the spacecraft that is propagated
+pdprop.AddPropObject(earthorb)
+pdprop.PrepareInternals()
+
+# Refresh the 'gator reference
+gator = pdprop.GetPropagator()
+
+# The propagation state, viewed in place; it changes as the propagator steps
+state = numpy.asarray(gator.GetStateView())
+print("0.0 sec, state = ", state)
+
+# Propagate for 1 day (144 10-minute steps); each row of the 144 x 7 result
+# holds the elapsed time followed by the Cartesian state
+history = gator.PropagateHistory(144, 600.0)
+print(history[-1, 0], " sec, state = ", history[-1, 1:])
+
+# A preallocated array can be filled directly, here for the next day
+nextday = numpy.empty((144, gator.GetDimension() + 1))
+gator.PropagateSteps(144, 600.0, nextday, nextday.size)
+print(nextday[-1, 0], " sec, state = ", state)
@@ -54,6 +54,14 @@ double CINTERFACE_API *GetDerivativesForState(double epoch, double state[],
 double CINTERFACE_API *GetDerivatives(double dt, int order, int *pdim);
 //double CINTERFACE_API *GetDerivatives(double dt, int order);
 
+// Batched, thread safe derivative evaluation through per-handle model copies
+int CINTERFACE_API CreateDerivativeHandle(int modelID);
+int CINTERFACE_API ReleaseDerivativeHandle(int handle);
+int CINTERFACE_API GetDerivativesForStates(int handle, int stateCount,
+      double epochs[], int epochCount, double states[], int stateDim,
+      double dt, int order, int aMatrix, double derivatives[],
+      int derivativeSize);
+
 int CINTERFACE_API CountObjects();
 const char CINTERFACE_API *GetObjectName(int which);
 const char CINTERFACE_API *GetRunSummary();
@@ -25,8 +25,12 @@
 #include "MessageInterface.hpp"
 #include "Moderator.hpp"
 #include "ODEModel.hpp"
+#include "ODEModelException.hpp"
 #include "Propagate.hpp"
 #include "Factory.hpp"
+#include "GmatState.hpp"
+#include "SharedDataLock.hpp"
+#include <mutex>
 
 #include "CCommandFactory.hpp"
 
@@ -45,6 +49,60 @@ std::map<Integer,ODEModel*> odeTable;
 std::map<Integer,PropSetup*> setupTable;
 std::map<std::string,Integer> odeNameTable;
 
+/**
+ * A derivative model owned by one handle.  Each handle evaluates derivatives
+ * with its own copies of an ODE model, its coordinate systems and the objects
+ * it propagates, mapped by the handle's own state manager, so calls made
+ * through different handles can run on different threads.
+ */
+struct DerivativeHandle
+{
+   /// The handle's copy of the ODE model
+   ODEModel       *model;
+   /// The state manager mapping the object copies into the state vector
+   PropagationStateManager *psm;
+   /// Copies of the propagated objects
+   ObjectArray    objects;
+   /// The state vector used by the model copy, owned by psm
+   GmatState      *state;
+   /// The full state when the handle was made; it supplies the elements that
+   /// callers do not pass in
+   RealArray      baseState;
+   /// Indices of the STM elements in the state vector
+   IntegerArray   stmIndex;
+   /// Identity matrix values for the STM elements
+   RealArray      stmIdentity;
+   /// true if the derivative vector contains A-matrix data
+   bool           hasAMatrix;
+   /// Serializes calls made through the handle
+   std::mutex     handleMutex;
+};
+
+Integer     nextHandle = 1;
+std::map<Integer,DerivativeHandle*> handleTable;
+/// Guards the handle table and the messages set by the handle functions
+std::mutex  handleTableMutex;
+
+
+//------------------------------------------------------------------------------
+// void DeleteHandleData(DerivativeHandle *dh)
+//------------------------------------------------------------------------------
+/**
+ * Deletes a handle and the copies it owns; the model refers to the state
+ * manager, and the state manager to the objects, so they go in that order.
+ */
+//------------------------------------------------------------------------------
+static void DeleteHandleData(DerivativeHandle *dh)
+{
+   if (dh->model != NULL)
+      delete dh->model;
+   if (dh->psm != NULL)
+      delete dh->psm;
+   for (UnsignedInt i = 0; i < dh->objects.size(); ++i)
+      delete dh->objects[i];
+   delete dh;
+}
+
 #ifdef DEBUG_INTERFACE_FROM_MATLAB
    FILE *fp;
 #endif
@@ -162,6 +220,8 @@ extern "C"
       if (theModerator == NULL)
          return -1;
 
+      ReleaseDerivativeHandles();
+
       if (theModerator->Initialize("gmat_startup_file.txt") == false)
       {
          lastMsg = "The Moderator failed to initialize";
@@ -209,6 +269,9 @@ extern "C"
 
       std::string script = scriptName;
 
+      // The handle models refer to objects of the old configuration
+      ReleaseDerivativeHandles();
+
       if (theModerator->InterpretScript(scriptName))
       {
          lastMsg = "Interpreted the script " + script + " successfully.";
@@ -722,6 +785,295 @@ extern "C"
       return retval;
    }
 
+   //---------------------------------------------------------------------------
+   // int CreateDerivativeHandle(int modelID)
+   //---------------------------------------------------------------------------
+   /**
+    * Makes a handle for batched derivative evaluation
+    *
+    * The handle owns a copy of the ODE model, which uses its own coordinate
+    * systems, and copies of the propagated objects mapped by its own state
+    * manager.  Evaluations never touch the configured PropSetup or objects,
+    * and calls to GetDerivativesForStates() made through different handles
+    * can run concurrently, e.g. one handle per caller thread.  Handles are
+    * released by ReleaseDerivativeHandle(), and all of them are released when
+    * a script is loaded or GMAT is restarted.
+    *
+    * Before calling this function, the user should locate the model with
+    * FindOdeModel(modelName).
+    *
+    * @param modelID The ID of the model, as returned from FindOdeModel(), or
+    *                0 for the current model
+    *
+    * @return The handle, a positive number, or a negative number on error
+    */
+   //---------------------------------------------------------------------------
+   int CreateDerivativeHandle(int modelID)
+   {
+      std::lock_guard<std::mutex> tableLock(handleTableMutex);
+
+      ODEModel  *source = ode;
+      PropSetup *setup  = pSetup;
+      if (modelID > 0)
+      {
+         if (odeTable.find(modelID) == odeTable.end())
+         {
+            lastMsg = "The requested ODE model is not in the table of models";
+            return -1;
+         }
+         source = odeTable[modelID];
+         setup  = setupTable[modelID];
+      }
+
+      if ((source == NULL) || (setup == NULL))
+      {
+         lastMsg = "ERROR in CreateDerivativeHandle: The ODE model is not "
+                   "yet set.";
+         return -1;
+      }
+
+      PropagationStateManager *psm = setup->GetPropStateManager();
+      DerivativeHandle *dh = new DerivativeHandle;
+      dh->model = NULL;
+      dh->psm = NULL;
+      dh->state = NULL;
+      dh->hasAMatrix = false;
+
+      try
+      {
+         // Map copies of the propagated objects with the same elements
+         ObjectArray stateObjects;
+         psm->GetStateObjects(stateObjects);
+         const std::vector<ListItem*> *sourceMap = psm->GetStateMap();
+         dh->psm = new PropagationStateManager();
+         for (UnsignedInt i = 0; i < stateObjects.size(); ++i)
+         {
+            GmatBase *copy = stateObjects[i]->Clone();
+            dh->objects.push_back(copy);
+            dh->psm->SetObject(copy);
+            for (UnsignedInt j = 0; j < sourceMap->size(); ++j)
+               if ((*sourceMap)[j]->object == stateObjects[i])
+                  dh->psm->SetProperty((*sourceMap)[j]->elementName);
+         }
+         if (!dh->psm->BuildState() || !dh->psm->MapObjectsToVector())
+            throw ODEModelException("Unable to map the propagation state for "
+                  "the copy of the ODE model " + source->GetName());
+         dh->state = dh->psm->GetState();
+
+         // Same assembly as PropSetup::PrepareInternals(), on the copies
+         dh->model = (ODEModel*)(source->Clone());
+         dh->model->UseOwnCoordinateSystems(true);
+         dh->model->SetPropStateManager(dh->psm);
+         dh->model->SetState(dh->state);
+         if (!dh->model->Initialize())
+            throw ODEModelException("The copy of the ODE model " +
+                  source->GetName() + " failed to initialize");
+         if (!dh->model->BuildModelFromMap())
+            throw ODEModelException("Unable to assemble the copy of the ODE "
+                  "model " + source->GetName());
+         dh->model->UpdateInitialData();
+      }
+      catch (BaseException &ex)
+      {
+         DeleteHandleData(dh);
+         lastMsg = ex.GetFullMessage();
+         return -2;
+      }
+
+      Integer dim = dh->state->GetSize();
+      dh->baseState.assign(dh->state->GetState(), dh->state->GetState() + dim);
+
+      // Locate the STM elements; an identity STM makes their derivative the
+      // A-matrix
+      const std::vector<ListItem*> *stateMap = dh->psm->GetStateMap();
+      for (UnsignedInt i = 0; (i < stateMap->size()) && ((Integer)i < dim);
+           ++i)
+      {
+         ListItem *item = (*stateMap)[i];
+         if (item->elementName == "STM")
+         {
+            dh->stmIndex.push_back(i);
+            dh->stmIdentity.push_back(item->rowIndex == item->colIndex ?
+                  1.0 : 0.0);
+            dh->hasAMatrix = true;
+         }
+         else if (item->elementName == "AMatrix")
+            dh->hasAMatrix = true;
+      }
+
+      Integer handle = nextHandle++;
+      handleTable[handle] = dh;
+
+      lastMsg = "Derivative handle created for the ODE model " +
+                source->GetName();
+      return handle;
+   }
+
+   //---------------------------------------------------------------------------
+   // int ReleaseDerivativeHandle(int handle)
+   //---------------------------------------------------------------------------
+   /**
+    * Releases a handle made by CreateDerivativeHandle() and its model copy
+    *
+    * @param handle The handle
+    *
+    * @return 0 on success, -1 if the handle is not valid
+    */
+   //---------------------------------------------------------------------------
+   int ReleaseDerivativeHandle(int handle)
+   {
+      DerivativeHandle *dh = NULL;
+      {
+         std::lock_guard<std::mutex> tableLock(handleTableMutex);
+         std::map<Integer,DerivativeHandle*>::iterator pos =
+               handleTable.find(handle);
+         if (pos == handleTable.end())
+         {
+            lastMsg = "ERROR in ReleaseDerivativeHandle: The handle is not "
+                      "valid.";
+            return -1;
+         }
+         dh = pos->second;
+         handleTable.erase(pos);
+      }
+
+      // Wait for a call in progress on the handle
+      dh->handleMutex.lock();
+      dh->handleMutex.unlock();
+      DeleteHandleData(dh);
+
+      return 0;
+   }
+
+   //---------------------------------------------------------------------------
+   // int GetDerivativesForStates(int handle, int stateCount, double epochs[],
+   //      int epochCount, double states[], int stateDim, double dt, int order,
+   //      int aMatrix, double derivatives[], int derivativeSize)
+   //---------------------------------------------------------------------------
+   /**
+    * Calculates the derivatives of a set of states, e.g. sigma points or
+    * particles, into a caller supplied array
+    *
+    * The states are evaluated in order with the handle's copy of the ODE
+    * model.  Calls through one handle are serialized; use a handle per thread
+    * to evaluate on several threads.  Each handle has its own model, frames
+    * and objects, so evaluations run unlocked; only the caches shared by all
+    * models (the body ephemerides and the EOP data) lock themselves while a
+    * batched call is running.  The single state functions (SetState(), GetDerivatives(), ...) use the
+    * configured model itself and should not be called while batched calls
+    * are running.
+    *
+    * @param handle      A handle from CreateDerivativeHandle()
+    * @param stateCount  The number of states, M
+    * @param epochs      The A.1 modified Julian epochs of the states
+    * @param epochCount  1 if all states share epochs[0], or M for an epoch per
+    *                    state
+    * @param states      The M states, one after the other, in the frame
+    *                    described for GetDerivativesForState()
+    * @param stateDim    The size of each input state; elements past stateDim
+    *                    are taken from the propagation state at the time the
+    *                    handle was made
+    * @param dt          Time offset (in sec) off of the epochs
+    * @param order       Order of the derivative data -- 1 or 2
+    * @param aMatrix     Nonzero to return the A-matrix; the STM elements of
+    *                    each state are set to the identity matrix so that their
+    *                    derivatives are the A-matrix elements.  The model must
+    *                    propagate the STM or compute the A-matrix.
+    * @param derivatives Output: M derivative vectors of GetStateSize()
+    *                    elements, one after the other
+    * @param derivativeSize The number of doubles available in derivatives
+    *
+    * @return 0 on success, or a negative number on error; the error is
+    *         described by getLastMessage()
+    */
+   //---------------------------------------------------------------------------
+   int GetDerivativesForStates(int handle, int stateCount, double epochs[],
+         int epochCount, double states[], int stateDim, double dt, int order,
+         int aMatrix, double derivatives[], int derivativeSize)
+   {
+      DerivativeHandle *dh = NULL;
+      std::string errorMsg;
+      int retval = 0;
+
+      std::unique_lock<std::mutex> tableLock(handleTableMutex);
+      std::map<Integer,DerivativeHandle*>::iterator pos =
+            handleTable.find(handle);
+      if (pos == handleTable.end())
+      {
+         lastMsg = "ERROR in GetDerivativesForStates: The handle is not "
+                   "valid.";
+         return -1;
+      }
+      dh = pos->second;
+      // Lock the handle before releasing the table, so the handle cannot be
+      // released while it is in use
+      std::lock_guard<std::mutex> handleLock(dh->handleMutex);
+      tableLock.unlock();
+
+      Integer dim = dh->state->GetSize();
+      if ((stateCount < 0) || (stateDim < 1) || (stateDim > dim) ||
+          ((epochCount != 1) && (epochCount != stateCount)) ||
+          (epochs == NULL) || (states == NULL) || (derivatives == NULL) ||
+          (derivativeSize < stateCount * dim))
+      {
+         char msg[512];
+         sprintf(msg, "ERROR in GetDerivativesForStates: Invalid sizes; %d "
+               "states of size %d (model size %d) at %d epochs need %d output "
+               "elements, but %d were provided\n", stateCount, stateDim, dim,
+               epochCount, stateCount * dim, derivativeSize);
+         std::lock_guard<std::mutex> msgLock(handleTableMutex);
+         lastMsg = msg;
+         return -2;
+      }
+
+      if ((aMatrix != 0) && !dh->hasAMatrix)
+      {
+         std::lock_guard<std::mutex> msgLock(handleTableMutex);
+         lastMsg = "ERROR in GetDerivativesForStates: The ODE model does not "
+                   "propagate the STM or compute the A-matrix.";
+         return -3;
+      }
+
+      RealArray work(dh->baseState);
+      SharedDataLock::Enable();
+      try
+      {
+         for (Integer i = 0; i < stateCount; ++i)
+         {
+            memcpy(&work[0], states + i * stateDim, stateDim * sizeof(double));
+            if (aMatrix != 0)
+               for (UnsignedInt j = 0; j < dh->stmIndex.size(); ++j)
+                  work[dh->stmIndex[j]] = dh->stmIdentity[j];
+            Real epoch = epochs[epochCount == 1 ? 0 : i];
+
+            dh->state->SetEpoch(epoch);
+            dh->state->SetState(&work[0], dim);
+            if (!dh->model->SetEpoch(epoch))
+               throw ODEModelException("Error setting the epoch on the ODE "
+                     "model");
+            if (!dh->model->GetDerivatives(dh->state->GetState(), dt, order))
+               throw ODEModelException("The ODE model failed to calculate "
+                     "the derivatives");
+            memcpy(derivatives + i * dim, dh->model->GetDerivativeArray(),
+                  dim * sizeof(double));
+         }
+      }
+      catch (BaseException &ex)
+      {
+         errorMsg = ex.GetFullMessage();
+         retval = -4;
+      }
+      SharedDataLock::Disable();
+
+      if (retval != 0)
+      {
+         std::lock_guard<std::mutex> msgLock(handleTableMutex);
+         lastMsg = "ERROR in GetDerivativesForStates: " + errorMsg;
+      }
+
+      return retval;
+   }
+
    //---------------------------------------------------------------------------
    // int CountObjects()
    //---------------------------------------------------------------------------
@@ -1143,3 +1495,32 @@ PropSetup *GetPropagator(GmatCommand **cmd)
 
    return retval;
 }
+
+
+//------------------------------------------------------------------------------
+// void ReleaseDerivativeHandles()
+//------------------------------------------------------------------------------
+/**
+ * Releases all of the derivative handles
+ *
+ * Called when the configuration the handle models refer to goes away.
+ */
+//------------------------------------------------------------------------------
+void ReleaseDerivativeHandles()
+{
+   std::map<Integer,DerivativeHandle*> released;
+   {
+      std::lock_guard<std::mutex> tableLock(handleTableMutex);
+      released.swap(handleTable);
+   }
+
+   for (std::map<Integer,DerivativeHandle*>::iterator i = released.begin();
+        i != released.end(); ++i)
+   {
+      DerivativeHandle *dh = i->second;
+      // Wait for a call in progress on the handle
+      dh->handleMutex.lock();
+      dh->handleMutex.unlock();
+      DeleteHandleData(dh);
+   }
+}
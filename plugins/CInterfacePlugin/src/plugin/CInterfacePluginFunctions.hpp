@@ -52,6 +52,7 @@ extern "C"
    int GetODEModel(GmatCommand **cmd, const char *modelName = "");
    PropSetup *GetFirstPropagator(GmatCommand *cmd);
    PropSetup *GetPropagator(GmatCommand **current);
+   void ReleaseDerivativeHandles();
 };
 
 #endif /*CInterfacePluginFunctions_hpp*/
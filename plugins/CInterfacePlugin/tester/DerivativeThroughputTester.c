@@ -0,0 +1,290 @@
+/*
+ * DerivativeThroughputTester.c
+ *
+ * Measures the derivative throughput of the C interface: single state calls
+ * through GetDerivativesForState(), batched calls through
+ * GetDerivativesForStates(), and batched calls made on several threads, each
+ * thread using its own derivative handle.  The batched results are checked
+ * against the single state results.
+ *
+ * Usage: DerivativeThroughputTester [script [states [threads]]]
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: GMAT Development Team
+ */
+
+// For clock_gettime() and CLOCK_MONOTONIC under strict ISO C
+#define _POSIX_C_SOURCE 199309L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+#include <pthread.h>
+#include <dlfcn.h>
+
+#define MAX_THREADS 64
+
+typedef const char* (*LastMessageFun)();
+typedef int (*StartGmatFun)();
+typedef int (*LoadScriptFun)(const char*);
+typedef int (*RunScriptFun)();
+typedef int (*FindOdeModelFun)(const char*);
+typedef int (*GetStateSizeFun)();
+typedef double* (*GetStateFun)();
+typedef double* (*GetDerivativesForStateFun)(double, double[], int, double,
+      int, int*);
+typedef int (*CreateDerivativeHandleFun)(int);
+typedef int (*ReleaseDerivativeHandleFun)(int);
+typedef int (*GetDerivativesForStatesFun)(int, int, double[], int, double[],
+      int, double, int, int, double[], int);
+
+LastMessageFun             LastMessage;
+GetDerivativesForStateFun  GetDerivativesForState;
+CreateDerivativeHandleFun  CreateDerivativeHandle;
+ReleaseDerivativeHandleFun ReleaseDerivativeHandle;
+GetDerivativesForStatesFun GetDerivativesForStates;
+
+/// Data for one evaluation thread
+typedef struct
+{
+   int    handle;
+   int    stateCount;
+   int    stateDim;
+   int    passes;
+   double epoch;
+   double *states;
+   double *derivatives;
+   int    status;
+} ThreadData;
+
+
+void (*GetFunction(char* funName, void *libHandle))()
+{
+   void (*func)() = NULL;
+
+   if (libHandle != NULL)
+      func = (void(*)())dlsym(libHandle, funName);
+
+   if (func == NULL)
+      printf(" !!! Cannot locate the function \"%s\" !!!\n", funName);
+
+   return func;
+}
+
+double Now()
+{
+   struct timespec ts;
+   clock_gettime(CLOCK_MONOTONIC, &ts);
+   return ts.tv_sec + 1.0e-9 * ts.tv_nsec;
+}
+
+void *EvaluateStates(void *data)
+{
+   ThreadData *td = (ThreadData*)data;
+   int pass;
+
+   td->status = 0;
+   for (pass = 0; (pass < td->passes) && (td->status == 0); ++pass)
+      td->status = GetDerivativesForStates(td->handle, td->stateCount,
+            &td->epoch, 1, td->states, td->stateDim, 0.0, 1, 0,
+            td->derivatives, td->stateCount * td->stateDim);
+
+   return NULL;
+}
+
+
+int main(int argc, char *argv[])
+{
+   char *scriptName = "../samples/Ex_ForceModels.script";
+   int stateCount = 1000, threadCount = 4, passes = 5;
+   int i, j, dim, handle, status, failures = 0;
+   double start, elapsed, rate, singleRate, maxDiff = 0.0;
+
+   if (argc > 1)
+      scriptName = argv[1];
+   if (argc > 2)
+      stateCount = atoi(argv[2]);
+   if (argc > 3)
+      threadCount = atoi(argv[3]);
+   if ((stateCount < 1) || (threadCount < 1) || (threadCount > MAX_THREADS))
+   {
+      printf("Usage: DerivativeThroughputTester [script [states [threads]]]\n");
+      return -1;
+   }
+
+   printf("************************************************************\n"
+          "*** C Interface Derivative Throughput Test\n"
+          "************************************************************\n\n");
+
+   #ifdef __linux
+      void *libHandle = dlopen("libCInterface.so", RTLD_LAZY);
+   #else
+      void *libHandle = dlopen("libCInterface.dylib", RTLD_LAZY);
+   #endif
+   if (libHandle == NULL)
+   {
+      printf("%s\n", dlerror());
+      return -1;
+   }
+
+   LastMessage = (LastMessageFun)GetFunction("getLastMessage", libHandle);
+   StartGmatFun StartGmat = (StartGmatFun)GetFunction("StartGmat", libHandle);
+   LoadScriptFun LoadScript =
+         (LoadScriptFun)GetFunction("LoadScript", libHandle);
+   RunScriptFun RunScript = (RunScriptFun)GetFunction("RunScript", libHandle);
+   FindOdeModelFun FindOdeModel =
+         (FindOdeModelFun)GetFunction("FindOdeModel", libHandle);
+   GetStateSizeFun GetStateSize =
+         (GetStateSizeFun)GetFunction("GetStateSize", libHandle);
+   GetStateFun GetState = (GetStateFun)GetFunction("GetState", libHandle);
+   GetDerivativesForState = (GetDerivativesForStateFun)
+         GetFunction("GetDerivativesForState", libHandle);
+   CreateDerivativeHandle = (CreateDerivativeHandleFun)
+         GetFunction("CreateDerivativeHandle", libHandle);
+   ReleaseDerivativeHandle = (ReleaseDerivativeHandleFun)
+         GetFunction("ReleaseDerivativeHandle", libHandle);
+   GetDerivativesForStates = (GetDerivativesForStatesFun)
+         GetFunction("GetDerivativesForStates", libHandle);
+
+   if (!LastMessage || !StartGmat || !LoadScript || !RunScript ||
+       !FindOdeModel || !GetStateSize || !GetState || !GetDerivativesForState ||
+       !CreateDerivativeHandle || !ReleaseDerivativeHandle ||
+       !GetDerivativesForStates)
+      return -1;
+
+   if ((StartGmat() < 0) || (LoadScript(scriptName) < 0) || (RunScript() < 0)
+       || (FindOdeModel("") < 0))
+   {
+      printf("%s\nUnable to set up the ODE model from %s; exiting...\n",
+            LastMessage(), scriptName);
+      return -1;
+   }
+
+   dim = GetStateSize();
+   double *state = GetState();
+   double epoch = 21545.0;
+
+   // Spread the states about the script's state, as for a particle cloud
+   double *states = (double*)malloc(stateCount * dim * sizeof(double));
+   double *single = (double*)malloc(stateCount * dim * sizeof(double));
+   double *batched = (double*)malloc(stateCount * dim * sizeof(double));
+   srand(42);
+   for (i = 0; i < stateCount; ++i)
+      for (j = 0; j < dim; ++j)
+         states[i * dim + j] = state[j] * (1.0 + 1.0e-3 *
+               (2.0 * rand() / RAND_MAX - 1.0));
+
+   printf("Script %s: %d states of size %d\n\n", scriptName, stateCount, dim);
+
+   // Single state calls
+   start = Now();
+   for (i = 0; i < stateCount; ++i)
+   {
+      int pdim;
+      double *dv = GetDerivativesForState(epoch, states + i * dim, dim, 0.0, 1,
+            &pdim);
+      if (dv == NULL)
+      {
+         printf("%s\n", LastMessage());
+         return -1;
+      }
+      memcpy(single + i * dim, dv, dim * sizeof(double));
+   }
+   elapsed = Now() - start;
+   singleRate = stateCount / elapsed;
+   printf("GetDerivativesForState:           %12.0lf derivatives/s\n",
+         singleRate);
+
+   // Batched calls on one handle
+   handle = CreateDerivativeHandle(0);
+   if (handle < 0)
+   {
+      printf("%s\n", LastMessage());
+      return -1;
+   }
+
+   start = Now();
+   for (i = 0; i < passes; ++i)
+   {
+      status = GetDerivativesForStates(handle, stateCount, &epoch, 1, states,
+            dim, 0.0, 1, 0, batched, stateCount * dim);
+      if (status != 0)
+      {
+         printf("%s\n", LastMessage());
+         return -1;
+      }
+   }
+   elapsed = Now() - start;
+   rate = passes * stateCount / elapsed;
+   printf("GetDerivativesForStates:          %12.0lf derivatives/s "
+         "(%.2lfx)\n", rate, rate / singleRate);
+   ReleaseDerivativeHandle(handle);
+
+   for (i = 0; i < stateCount * dim; ++i)
+   {
+      double scale = fabs(single[i]) > 1.0 ? fabs(single[i]) : 1.0;
+      double diff = fabs(batched[i] - single[i]) / scale;
+      if (diff > maxDiff)
+         maxDiff = diff;
+   }
+   if (maxDiff > 1.0e-10)
+      ++failures;
+   printf("   Largest difference from the single state results: %le\n",
+         maxDiff);
+
+   // Batched calls on several threads, one handle per thread
+   ThreadData td[MAX_THREADS];
+   pthread_t threads[MAX_THREADS];
+   for (i = 0; i < threadCount; ++i)
+   {
+      td[i].handle = CreateDerivativeHandle(0);
+      if (td[i].handle < 0)
+      {
+         printf("%s\n", LastMessage());
+         return -1;
+      }
+      td[i].stateCount = stateCount;
+      td[i].stateDim = dim;
+      td[i].passes = passes;
+      td[i].epoch = epoch;
+      td[i].states = states;
+      td[i].derivatives = (double*)malloc(stateCount * dim * sizeof(double));
+   }
+
+   start = Now();
+   for (i = 0; i < threadCount; ++i)
+      pthread_create(&threads[i], NULL, EvaluateStates, &td[i]);
+   for (i = 0; i < threadCount; ++i)
+      pthread_join(threads[i], NULL);
+   elapsed = Now() - start;
+   rate = threadCount * passes * stateCount / elapsed;
+   printf("GetDerivativesForStates, %2d threads: %10.0lf derivatives/s "
+         "(%.2lfx)\n", threadCount, rate, rate / singleRate);
+
+   for (i = 0; i < threadCount; ++i)
+   {
+      if (td[i].status != 0)
+      {
+         printf("   Thread %d failed: %s\n", i, LastMessage());
+         ++failures;
+      }
+      else if (memcmp(td[i].derivatives, batched,
+            stateCount * dim * sizeof(double)) != 0)
+      {
+         printf("   Thread %d results differ from the serial batch\n", i);
+         ++failures;
+      }
+      ReleaseDerivativeHandle(td[i].handle);
+      free(td[i].derivatives);
+   }
+
+   free(states);
+   free(single);
+   free(batched);
+   dlclose(libHandle);
+
+   printf("\n%s\n", failures == 0 ? "Testing complete!" : "Testing FAILED");
+   return failures;
+}
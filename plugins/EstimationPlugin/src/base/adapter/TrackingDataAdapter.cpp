@@ -2237,7 +2237,7 @@ Real TrackingDataAdapter::ApiGetDerivativeValue(Integer row,Integer column)
 }
 
 //------------------------------------------------------------------------------
-// void SetIonosphereCache(SignalDataCache::SimpleSignalDataCache * cache)
+// void SetIonosphereCache(SignalDataCache *cache)
 //------------------------------------------------------------------------------
 /**
  * Sets a reference to the ionosphere cache that will be passed in to the measure model and that
@@ -2247,7 +2247,7 @@ Real TrackingDataAdapter::ApiGetDerivativeValue(Integer row,Integer column)
  *
  */
  //------------------------------------------------------------------------------
-void TrackingDataAdapter::SetIonosphereCache(SignalDataCache::SimpleSignalDataCache * cache)
+void TrackingDataAdapter::SetIonosphereCache(SignalDataCache *cache)
 {
    ionosphereCache = cache;
 }
@@ -199,7 +199,7 @@ public:
 
    StringArray          GetMeasurementDimension() { return dimNames;};
 
-   void                 SetIonosphereCache(SignalDataCache::SimpleSignalDataCache *cache);
+   void                 SetIonosphereCache(SignalDataCache *cache);
 
 protected:
    /// Measurement dimesion
@@ -293,7 +293,7 @@ protected:
    std::string               errMsg;
 
    ///  Ionosphere cache
-   SignalDataCache::SimpleSignalDataCache *ionosphereCache;
+   SignalDataCache *ionosphereCache;
 
    /// Parameter IDs for the TrackingDataAdapter
    enum
@@ -2004,7 +2004,7 @@ void RunEstimator::PublishState()
    Covariance *stateCovariance = esm->GetCovariance();
    Rmatrix cov = *(stateCovariance->GetCovariance());
    Rmatrix dX_dS = esm->CartToSolveForStateConversionDerivativeMatrix();
-   Rmatrix covCart = dX_dS * cov * dX_dS.Transpose();
+   Rmatrix covCart = MatrixTimesMatrixTimesTranspose(dX_dS, cov);
 
    UnsignedInt idx = 0;
    for (UnsignedInt ii = 0; ii < 6; ii++)
@@ -33,11 +33,14 @@
 #include "MessageInterface.hpp"
 #include "EstimatorException.hpp"
 #include <sstream>
+#include <map>
+#include <algorithm>
 #include "StringUtil.hpp"
 #include "DataWriter.hpp"
 #include "SchurFactorization.hpp"
 #include "CholeskyFactorization.hpp"
 #include "UtilityException.hpp"
+#include "WorkerPool.hpp"
 
 //#define DEBUG_ACCUMULATION
 //#define DEBUG_ACCUMULATION_RESULTS
@@ -64,6 +67,8 @@ BatchEstimator::PARAMETER_TEXT[] =
    "UseInnerLoopEditing",
    "ILSEMultiplicativeConstant",
    "ILSEMaximumIterations",
+   "SparseNormalEquations",
+   "ParallelAccumulation",
 };
 
 const Gmat::ParameterType
@@ -76,6 +81,8 @@ BatchEstimator::PARAMETER_TYPE[] =
    Gmat::BOOLEAN_TYPE,
    Gmat::REAL_TYPE,
    Gmat::INTEGER_TYPE,
+   Gmat::BOOLEAN_TYPE,
+   Gmat::BOOLEAN_TYPE,
 };
 
 
@@ -98,7 +105,10 @@ BatchEstimator::BatchEstimator(const std::string &name):
    constMultIL              (3.0),
    maxIterationsIL          (15),
    iterationsTakenIL        (0),
-   estimationStatusIL       (IL_UNKNOWN)
+   estimationStatusIL       (IL_UNKNOWN),
+   useSparseNormals         (false),
+   useParallelAccumulation  (false),
+   mappedRecordCount        (0)
 {
    objectTypeNames.push_back("BatchEstimator");
    parameterCount = BatchEstimatorParamCount;
@@ -136,7 +146,10 @@ BatchEstimator::BatchEstimator(const BatchEstimator& est) :
    constMultIL              (est.constMultIL),
    maxIterationsIL          (est.maxIterationsIL),
    iterationsTakenIL        (est.iterationsTakenIL),
-   estimationStatusIL       (est.estimationStatusIL)
+   estimationStatusIL       (est.estimationStatusIL),
+   useSparseNormals         (est.useSparseNormals),
+   useParallelAccumulation  (est.useParallelAccumulation),
+   mappedRecordCount        (0)
 {
 
 }
@@ -168,6 +181,9 @@ BatchEstimator& BatchEstimator::operator=(const BatchEstimator& est)
       maxIterationsIL    = est.maxIterationsIL;
       iterationsTakenIL  = est.iterationsTakenIL;
       estimationStatusIL = est.estimationStatusIL;
+      useSparseNormals   = est.useSparseNormals;
+      useParallelAccumulation = est.useParallelAccumulation;
+      mappedRecordCount = 0;
    }
 
    return *this;
@@ -516,6 +532,10 @@ bool BatchEstimator::GetBooleanParameter(const Integer id) const
       return chooseRMSP;
    if (id == ENABLE_ILSE)
       return useInnerLoop;
+   if (id == SPARSE_NORMAL_EQUATIONS)
+      return useSparseNormals;
+   if (id == PARALLEL_ACCUMULATION)
+      return useParallelAccumulation;
 
    return BatchEstimatorBase::GetBooleanParameter(id);
 }
@@ -547,6 +567,18 @@ bool BatchEstimator::SetBooleanParameter(const Integer id, const bool value)
       return true;
    }
 
+   if (id == SPARSE_NORMAL_EQUATIONS)
+   {
+      useSparseNormals = value;
+      return true;
+   }
+
+   if (id == PARALLEL_ACCUMULATION)
+   {
+      useParallelAccumulation = value;
+      return true;
+   }
+
    return BatchEstimatorBase::SetBooleanParameter(id, value);
 }
 
@@ -567,10 +599,19 @@ void BatchEstimator::CompleteInitialization()
 {
    BatchEstimatorBase::CompleteInitialization();
 
-   writeMeasurmentsAtEnd = useInnerLoop;
+   // The partials used in the measurement lines are only complete after the
+   // parallel accumulation
+   writeMeasurmentsAtEnd = useInnerLoop || useParallelAccumulation;
 
    iterationsTakenIL  = 0;
    estimationStatusIL = IL_UNKNOWN;
+
+   stmHistory.clear();
+   measStmIndex.clear();
+   mappedRecordCount = 0;
+
+   if (useSparseNormals)
+      SetNormalEquationStructure();
 }
 
 
@@ -635,6 +676,16 @@ void BatchEstimator::WriteReportFileHeaderPart6()
       ss.str(""); ss << GetIntegerParameter("FreezeIteration"); sa1.push_back("Freeze Editing on Iteration"); sa2.push_back(ss.str());
    }
 
+   if (useSparseNormals)
+   {
+      ss.str(""); ss << "Yes"; sa1.push_back("Sparse Normal Equations"); sa2.push_back(ss.str());
+   }
+
+   if (useParallelAccumulation)
+   {
+      ss.str(""); ss << "Yes"; sa1.push_back("Parallel Accumulation"); sa2.push_back(ss.str());
+   }
+
 
    // 3. Write the 3rd column
    GmatTime taiMjdEpoch, utcMjdEpoch;
@@ -673,6 +724,10 @@ void BatchEstimator::WriteReportFileHeaderPart6()
    }
    if (freezeEditing)
       sa3.push_back("");
+   if (useSparseNormals)
+      sa3.push_back("");
+   if (useParallelAccumulation)
+      sa3.push_back("");
 
    // 4. Write to text file
    Integer nameLen = 0;
@@ -739,6 +794,21 @@ void BatchEstimator::WriteReportFileSummaryPart1(Solver::SolverState sState)
       ss.str("");
       ss << "Estimation completed in " << iterationsTaken << " iterations";
       textFile0 << GmatStringUtil::GetAlignmentString(ss.str(), 160, GmatStringUtil::CENTER) << "\n";
+
+      // 1.4. Write signal data cache usage
+      SignalDataCache::Statistics signalStats, lightTimeStats;
+      GetMeasurementManager()->GetSignalDataCacheStatistics(signalStats, lightTimeStats);
+      ss.str("");
+      ss << "Signal data cache: " << signalStats.hits << " hits, " << signalStats.misses
+         << " misses, " << signalStats.evictions << " evictions";
+      textFile0 << GmatStringUtil::GetAlignmentString(ss.str(), 160, GmatStringUtil::CENTER) << "\n";
+      if (reuseLightTime)
+      {
+         ss.str("");
+         ss << "Light time solutions reused: " << lightTimeStats.hits << " of "
+            << (lightTimeStats.hits + lightTimeStats.misses) << ", " << lightTimeStats.evictions << " evictions";
+         textFile0 << GmatStringUtil::GetAlignmentString(ss.str(), 160, GmatStringUtil::CENTER) << "\n";
+      }
       textFile0 << "\n";
 
       std::vector<ObservationData> *obsList = GetMeasurementManager()->GetObservationDataList();
@@ -874,7 +944,8 @@ void BatchEstimator::Accumulate()
    MeasurementInfoType measStat;
    CalculateResiduals(measStat);
 
-   if (measStat.isCalculated)
+   // In parallel mode the partials are mapped and accumulated in Estimate()
+   if (measStat.isCalculated && !useParallelAccumulation)
    {
       #ifdef DEBUG_ACCUMULATION
          MessageInterface::ShowMessage("Accumulating the O-C differences\n");
@@ -892,7 +963,20 @@ void BatchEstimator::Accumulate()
          
          // Accummulate information matrix and residuals based on observation 
          // data which is selected for estimation calculation
-         if (measStat.editFlag == NORMAL_FLAG)
+         if ((measStat.editFlag == NORMAL_FLAG) && useSparseNormals)
+         {
+            try
+            {
+               normals.Accumulate(hMeas[k], weight, ocDiff);
+            }
+            catch (BaseException &ex)
+            {
+               throw EstimatorException(ex.GetDetails() + "; the "
+                     "measurement biases cannot be eliminated, set "
+                     "SparseNormalEquations to false");
+            }
+         }
+         else if (measStat.editFlag == NORMAL_FLAG)
          {
             for (UnsignedInt i = 0; i < stateSize; ++i)
             {
@@ -950,6 +1034,18 @@ void BatchEstimator::Accumulate()
 
    measStats.push_back(measStat);
 
+   if (useParallelAccumulation)
+   {
+      Integer stmSize = stateSize * stateSize;
+      if (measStat.hAccum.empty() || (stmSize == 0))
+         measStmIndex.push_back(-1);
+      else
+         measStmIndex.push_back((Integer)(stmHistory.size() / stmSize) - 1);
+
+      // Map the records collected so far when enough STMs are stored
+      AccumulateInParallel(false);
+   }
+
    if (!writeMeasurmentsAtEnd)
    {
       BuildMeasurementLine(measStat);
@@ -1001,6 +1097,189 @@ void BatchEstimator::Accumulate()
 
 
 
+//------------------------------------------------------------------------------
+// void AccumulateInParallel(bool isEndOfPass)
+//------------------------------------------------------------------------------
+/**
+ * Maps the partials of the records collected since the last call to the
+ * estimation epoch and accumulates them.
+ *
+ * Used when ParallelAccumulation is set.  Accumulate() then leaves H-tilde,
+ * the partials at the measurement time, in the hAccum rows of measStats, and
+ * EstimationPartials() stores the STM of each measurement epoch.  The records
+ * are mapped in chunks of PARALLEL_CHUNK_RECORDS, run on the WorkerPool.
+ * Each chunk replaces its rows by H-tilde * STM * cart2SolvMatrix and sums its
+ * part of the information matrix and residual vector; the chunk sums are then
+ * added in chunk order.  With SparseNormalEquations set, the rows are added
+ * to the block normal equations in record order after the parallel step.
+ *
+ * During the pass the records are only mapped at chunk boundaries, once the
+ * stored STMs reach STM_HISTORY_LIMIT values or the pending records fill
+ * PARALLEL_CHUNK_COUNT chunks.  The mapped STMs are then released, so the
+ * stored STMs stay bounded for any pass length.  The chunks depend only on
+ * the record numbers, so the results are the same for any number of threads.
+ *
+ * @param isEndOfPass true to map all of the remaining records
+ */
+//------------------------------------------------------------------------------
+void BatchEstimator::AccumulateInParallel(bool isEndOfPass)
+{
+   // Number of records in a chunk
+   const Integer PARALLEL_CHUNK_RECORDS = 16;
+   // Largest number of chunks mapped at once
+   const Integer PARALLEL_CHUNK_COUNT = 64;
+   // Number of stored STM values that triggers the mapping during the pass
+   const UnsignedInt STM_HISTORY_LIMIT = 1 << 24;
+
+   Integer n = stateSize;
+   Integer first = mappedRecordCount;
+   Integer recordCount = (Integer)measStats.size() - first;
+
+   if (!isEndOfPass)
+   {
+      if ((recordCount % PARALLEL_CHUNK_RECORDS) != 0)
+         return;
+      if ((recordCount < PARALLEL_CHUNK_RECORDS * PARALLEL_CHUNK_COUNT) &&
+          (stmHistory.size() < STM_HISTORY_LIMIT))
+         return;
+   }
+
+   if ((Integer)measStmIndex.size() != recordCount)
+      throw EstimatorException("The STMs stored for parallel accumulation do "
+            "not match the measurement records");
+
+   Integer chunkCount = (recordCount + PARALLEL_CHUNK_RECORDS - 1) /
+         PARALLEL_CHUNK_RECORDS;
+
+   // Flat copy of the conversion to solve-for coordinates, shared by the tasks
+   RealArray toSolveFor(n * n);
+   for (Integer i = 0; i < n; ++i)
+      for (Integer j = 0; j < n; ++j)
+         toSolveFor[i*n + j] = cart2SolvMatrix(i, j);
+
+   bool accumulateDense = !useSparseNormals;
+   std::vector<RealArray> chunkInformation(chunkCount), chunkResiduals(chunkCount);
+
+   WorkerPool::Instance()->Run(chunkCount, [&](Integer chunk)
+   {
+      Integer begin = chunk * PARALLEL_CHUNK_RECORDS;
+      Integer end = std::min(begin + PARALLEL_CHUNK_RECORDS, recordCount);
+
+      RealArray &info = chunkInformation[chunk];
+      RealArray &rhs  = chunkResiduals[chunk];
+      if (accumulateDense)
+      {
+         info.assign(n * n, 0.0);
+         rhs.assign(n, 0.0);
+      }
+
+      RealArray hRow(n);
+      for (Integer rec = begin; rec < end; ++rec)
+      {
+         if (measStmIndex[rec] < 0)
+            continue;
+
+         MeasurementInfoType &measStat = measStats[first + rec];
+         const Real *phi = &stmHistory[measStmIndex[rec] * n * n];
+         bool isUsed = (measStat.editFlag == NORMAL_FLAG);
+
+         for (UnsignedInt k = 0; k < measStat.hAccum.size(); ++k)
+         {
+            RealArray &h = measStat.hAccum[k];
+
+            // hRow is the partial derivative at the estimation epoch
+            for (Integer j = 0; j < n; ++j)
+            {
+               Real entry = 0.0;
+               for (Integer l = 0; l < n; ++l)
+                  entry += h[l] * phi[l*n + j];
+               hRow[j] = entry;
+            }
+
+            // Convert hRow into solve-for coordinates
+            for (Integer j = 0; j < n; ++j)
+            {
+               Real entry = 0.0;
+               for (Integer l = 0; l < n; ++l)
+                  entry += hRow[l] * toSolveFor[l*n + j];
+               h[j] = entry;
+            }
+
+            if (isUsed && accumulateDense)
+            {
+               Real weight = measStat.weight[k];
+               Real ocDiff = measStat.residual[k];
+               for (Integer i = 0; i < n; ++i)
+               {
+                  // Upper triangle only; the sums are mirrored below
+                  for (Integer j = i; j < n; ++j)
+                     info[i*n + j] += h[i] * h[j] * weight;
+                  rhs[i] += h[i] * weight * ocDiff;
+               }
+            }
+         }
+      }
+   });
+
+   // Fixed order reduction
+   if (accumulateDense)
+   {
+      for (Integer chunk = 0; chunk < chunkCount; ++chunk)
+      {
+         const RealArray &info = chunkInformation[chunk];
+         for (Integer i = 0; i < n; ++i)
+         {
+            for (Integer j = i; j < n; ++j)
+            {
+               information(i, j) += info[i*n + j];
+               if (j != i)
+                  information(j, i) += info[i*n + j];
+            }
+            residuals[i] += chunkResiduals[chunk][i];
+         }
+      }
+   }
+   else
+   {
+      for (Integer rec = 0; rec < recordCount; ++rec)
+      {
+         const MeasurementInfoType &measStat = measStats[first + rec];
+         if ((measStmIndex[rec] < 0) || (measStat.editFlag != NORMAL_FLAG))
+            continue;
+
+         try
+         {
+            for (UnsignedInt k = 0; k < measStat.hAccum.size(); ++k)
+               normals.Accumulate(measStat.hAccum[k], measStat.weight[k],
+                     measStat.residual[k]);
+         }
+         catch (BaseException &ex)
+         {
+            throw EstimatorException(ex.GetDetails() + "; the "
+                  "measurement biases cannot be eliminated, set "
+                  "SparseNormalEquations to false");
+         }
+      }
+   }
+
+   // The mapped STMs are released.  During the pass the last one is kept,
+   // since the next record may share its epoch.
+   measStmIndex.clear();
+   if (isEndOfPass || (n == 0) || stmHistory.empty())
+   {
+      RealArray().swap(stmHistory);
+      IntegerArray().swap(measStmIndex);
+      mappedRecordCount = 0;
+   }
+   else
+   {
+      RealArray lastStm(stmHistory.end() - n * n, stmHistory.end());
+      stmHistory.swap(lastStm);
+      mappedRecordCount = measStats.size();
+   }
+}
+
+
 //------------------------------------------------------------------------------
 // void Estimate()
 //------------------------------------------------------------------------------
@@ -1014,6 +1293,9 @@ void BatchEstimator::Estimate()
       MessageInterface::ShowMessage("BatchEstimator state is ESTIMATING\n");
    #endif
 
+   if (useParallelAccumulation)
+      AccumulateInParallel(true);
+
    // Plot all residuals
    if (showAllResiduals)
       PlotResiduals();
@@ -1081,15 +1363,39 @@ void BatchEstimator::Estimate()
       Rmatrix Pdx0_inv;
       InvertApriori(Pdx0_inv);
 
-      // adding a priori to information matrix
-      information = information + Pdx0_inv;
+      if (useSparseNormals)
+      {
+         Rvector aprioriResiduals(stateSize);
+         for (UnsignedInt i = 0; i < stateSize; ++i)
+         {
+            aprioriResiduals[i] = 0.0;
+            for (UnsignedInt j = 0; j < stateSize; ++j)
+               aprioriResiduals[i] += Pdx0_inv(i, j) * x0bar[j];
+         }
 
-      // adding a priori to residual
-      for (Integer i = 0; i < Pdx0_inv.GetNumRows(); ++i)
+         try
+         {
+            normals.AddInformation(Pdx0_inv, aprioriResiduals);
+         }
+         catch (BaseException &ex)
+         {
+            throw EstimatorException(ex.GetDetails() + "; the a priori "
+                  "covariance correlates measurement biases of different "
+                  "measurement models, set SparseNormalEquations to false");
+         }
+      }
+      else
       {
-         for (UnsignedInt j = 0; j < stateSize; ++j)
+         // adding a priori to information matrix
+         information = information + Pdx0_inv;
+
+         // adding a priori to residual
+         for (Integer i = 0; i < Pdx0_inv.GetNumRows(); ++i)
          {
-            residuals[i] += Pdx0_inv(i, j) * x0bar[j];      // At the beginning of each iteration, [Lambda] = ([Px0]^-1).delta_XTile(i)  the last term in open-close square bracket in euqation 8-57 GTDS MathSpec
+            for (UnsignedInt j = 0; j < stateSize; ++j)
+            {
+               residuals[i] += Pdx0_inv(i, j) * x0bar[j];      // At the beginning of each iteration, [Lambda] = ([Px0]^-1).delta_XTile(i)  the last term in open-close square bracket in euqation 8-57 GTDS MathSpec
+            }
          }
       }
    }
@@ -1111,7 +1417,12 @@ void BatchEstimator::Estimate()
       MessageInterface::ShowMessage("]\n");
    #endif
 
-   SolveNormalEquations(information, informationInverse);
+   // The block solution computes dx without forming the inverse; the
+   // iteration reports get the global and bias blocks of the covariance
+   if (useSparseNormals)
+      SolveNormalEquations(normals, dx, &informationInverse);
+   else
+      SolveNormalEquations(information, informationInverse);
 
    IntegerArray normalMatrixIndexesSaved = removedNormalMatrixIndexes;  // save indexes which will be overwritten by InnerLoop()
 
@@ -1139,14 +1450,17 @@ void BatchEstimator::Estimate()
    #endif
 
    // Calculate state change dx in equation 8-57 in GTDS MathSpec
-   dx.clear();
-   Real delta;
-   for (UnsignedInt i = 0; i < stateSize; ++i)
+   if (!useSparseNormals)
    {
-      delta = 0.0;
-      for (UnsignedInt j = 0; j < stateSize; ++j)
-         delta += informationInverse(i, j) * residuals(j);
-      dx.push_back(delta);
+      dx.clear();
+      Real delta;
+      for (UnsignedInt i = 0; i < stateSize; ++i)
+      {
+         delta = 0.0;
+         for (UnsignedInt j = 0; j < stateSize; ++j)
+            delta += informationInverse(i, j) * residuals(j);
+         dx.push_back(delta);
+      }
    }
 
    // Specify previous, current, and the best weighted RMS:
@@ -1166,6 +1480,14 @@ void BatchEstimator::Estimate()
    if (!freezeEditing || (freezeEditing && (iterationsTaken < freezeIteration)))
       InnerLoop();
 
+   // The next iteration accumulates new normal equations; the factors of
+   // this one are kept for the final covariance
+   if (useSparseNormals)
+   {
+      solvedNormals = normals;
+      normals.Clear();
+   }
+
    // Calculate RMSB:
    if (iterationsTaken == 0)
       bestResidualRMS = newResidualRMS;
@@ -1344,8 +1666,14 @@ void BatchEstimator::InnerLoop()
       bool convergedIL = false;
       estimationStatusIL = IL_UNKNOWN;
 
-      Rmatrix informationIL(stateSize,stateSize);
-      Rvector residualsIL(stateSize);
+      Rmatrix informationIL;
+      Rvector residualsIL;
+      BlockNormalEquations normalsIL;
+      if (!useSparseNormals)
+      {
+         informationIL.SetSize(stateSize, stateSize);
+         residualsIL.SetSize(stateSize);
+      }
       RealArray dxIL, dxILLast;
 
       // Initialize inner loop with values from outer loop
@@ -1399,12 +1727,17 @@ void BatchEstimator::InnerLoop()
          indexUsedRecords.clear();
          editedRecordsIL.clear();
 
-         for (UnsignedInt ii = 0; ii < stateSize; ii++)
+         if (useSparseNormals)
+            normalsIL = normals;
+         else
          {
-            for (UnsignedInt jj = 0; jj < stateSize; jj++)
-               informationIL(ii, jj) = 0.0;
+            for (UnsignedInt ii = 0; ii < stateSize; ii++)
+            {
+               for (UnsignedInt jj = 0; jj < stateSize; jj++)
+                  informationIL(ii, jj) = 0.0;
 
-            residualsIL[ii] = 0.0;
+               residualsIL[ii] = 0.0;
+            }
          }
 
          // Find change in residuals due to dxIL and determine if it should be edited by IL
@@ -1431,6 +1764,14 @@ void BatchEstimator::InnerLoop()
                // Update IL information
                for (UnsignedInt vIndex = 0; vIndex < measStat.hAccum.size(); vIndex++)
                {
+                  // Negative weight removes the record from the block normals
+                  if (useSparseNormals)
+                  {
+                     normalsIL.Accumulate(measStat.hAccum[vIndex],
+                           -measStat.weight[vIndex], measStat.residual[vIndex]);
+                     continue;
+                  }
+
                   for (UnsignedInt i = 0; i < stateSize; ++i)
                   {
                      for (UnsignedInt j = 0; j < stateSize; ++j)
@@ -1466,22 +1807,31 @@ void BatchEstimator::InnerLoop()
             MessageInterface::ShowMessage("   New Inner Loop RMS = %lf\n", newResidualRMSIL);
          #endif
 
-         informationIL = information - informationIL;
-         residualsIL = residuals - residualsIL;
+         if (useSparseNormals)
+         {
+            SolveNormalEquations(normalsIL, dxIL);
+            for (UnsignedInt i = 0; i < stateSize; ++i)
+               currentEstimationStateIL[i] = estimationStateS[i] + dxIL[i];
+         }
+         else
+         {
+            informationIL = information - informationIL;
+            residualsIL = residuals - residualsIL;
 
-         // Solve normal equations
-         Rmatrix cov;
-         SolveNormalEquations(informationIL, cov);
+            // Solve normal equations
+            Rmatrix cov;
+            SolveNormalEquations(informationIL, cov);
 
-         // Calculate state change dx in equation 8-57 in GTDS MathSpec
-         Real delta;
-         for (UnsignedInt i = 0; i < stateSize; ++i)
-         {
-            delta = 0.0;
-            for (UnsignedInt j = 0; j < stateSize; ++j)
-               delta += cov(i,j) * residualsIL(j);
-            dxIL[i] = delta;
-            currentEstimationStateIL[i] = estimationStateS[i] + delta;
+            // Calculate state change dx in equation 8-57 in GTDS MathSpec
+            Real delta;
+            for (UnsignedInt i = 0; i < stateSize; ++i)
+            {
+               delta = 0.0;
+               for (UnsignedInt j = 0; j < stateSize; ++j)
+                  delta += cov(i,j) * residualsIL(j);
+               dxIL[i] = delta;
+               currentEstimationStateIL[i] = estimationStateS[i] + delta;
+            }
          }
 
          #ifdef DEBUG_INNER_LOOP
@@ -1591,6 +1941,23 @@ void BatchEstimator::InnerLoop()
 }
 
 
+//------------------------------------------------------------------------------
+//  void RunComplete()
+//------------------------------------------------------------------------------
+/**
+ * This method builds the full covariance of the last iteration from its
+ * block normal equations, then writes the final reports.
+ */
+//------------------------------------------------------------------------------
+void BatchEstimator::RunComplete()
+{
+   if (useSparseNormals && (iterationsTaken > 0))
+      solvedNormals.GetCovariance(informationInverse);
+
+   BatchEstimatorBase::RunComplete();
+}
+
+
 //------------------------------------------------------------------------------
 // void SolveNormalEquations(const Rmatrix &infMatrix, Rmatrix &covMatrix)
 //------------------------------------------------------------------------------
@@ -1637,33 +2004,8 @@ void BatchEstimator::SolveNormalEquations(const Rmatrix &infMatrix, Rmatrix &cov
       throw EstimatorException("Error: Normal matrix has no rows/columns after "
          "removing all rows/columns of zeros.\n");
 
-   if (numRemoved > 0) {
-      //MessageInterface::ShowMessage("Matrix reduction was performed on the normal matrix\n");
-
-      const std::vector<ListItem*> *map = esm.GetStateMap();
-      for (int i = 0; i < removedNormalMatrixIndexes.size(); i++)
-      {
-         // *** Performed normal matrix reduction for EstSat.EarthMJ2000Eq.VZ
-         int index = removedNormalMatrixIndexes.at(i);
-         std::stringstream ss;
-         ss << "*** Performed normal matrix reduction for ";
-         if (((*map)[index]->object->IsOfType(Gmat::MEASUREMENT_MODEL)) &&
-            ((*map)[index]->elementName == "Bias"))
-         {
-            //MeasurementModel* mm = (MeasurementModel*)((*map)[index]->object);
-            TrackingDataAdapter* mm = (TrackingDataAdapter*)((*map)[index]->object);
-            StringArray sa = mm->GetStringArrayParameter("Participants");
-            ss << mm->GetStringParameter("Type") << " ";
-            for (UnsignedInt j = 0; j < sa.size(); ++j)
-               ss << sa[j] << (((j + 1) != sa.size()) ? "," : " Bias.");
-            ss << (*map)[index]->subelement;
-         }
-         else
-            ss << GetElementFullName((*map)[index], false);
-         ss << "\n";
-         MessageInterface::ShowMessage(ss.str());
-      }
-   }
+   if (numRemoved > 0)
+      ShowNormalMatrixReduction();
 
    #ifdef DEBUG_VERBOSE
       if (numRemoved > 0)
@@ -1771,6 +2113,128 @@ void BatchEstimator::SolveNormalEquations(const Rmatrix &infMatrix, Rmatrix &cov
 }
 
 
+//------------------------------------------------------------------------------
+// void SolveNormalEquations(BlockNormalEquations &blockNormals,
+//       RealArray &delta, Rmatrix *covMatrix)
+//------------------------------------------------------------------------------
+/**
+ * This method solves normal equations accumulated by blocks
+ *
+ * The measurement biases are eliminated and the system is solved through
+ * Cholesky factorizations; the inversionType is not used.
+ *
+ * @param blockNormals The normal equations
+ * @param delta        The state change
+ * @param covMatrix    The global and bias blocks of the covariance matrix,
+ *                     built if not NULL
+ */
+//------------------------------------------------------------------------------
+void BatchEstimator::SolveNormalEquations(BlockNormalEquations &blockNormals,
+      RealArray &delta, Rmatrix *covMatrix)
+{
+   try
+   {
+      blockNormals.Solve(delta);
+   }
+   catch (BaseException &ex)
+   {
+      throw EstimatorException("Error: Normal matrix is singular.  " +
+            ex.GetDetails());
+   }
+
+   removedNormalMatrixIndexes = blockNormals.GetRemovedIndexes();
+   if (removedNormalMatrixIndexes.size() == stateSize)
+      throw EstimatorException("Error: Normal matrix has no rows/columns after "
+         "removing all rows/columns of zeros.\n");
+
+   if (!removedNormalMatrixIndexes.empty())
+      ShowNormalMatrixReduction();
+
+   if (covMatrix != NULL)
+      blockNormals.GetBlockCovariance(*covMatrix);
+}
+
+
+//------------------------------------------------------------------------------
+// void SetNormalEquationStructure()
+//------------------------------------------------------------------------------
+/**
+ * This method sets up the block normal equations: the biases of each
+ * measurement model form a block of local parameters, and all other solve-for
+ * parameters are global.
+ */
+//------------------------------------------------------------------------------
+void BatchEstimator::SetNormalEquationStructure()
+{
+   const std::vector<ListItem*> *map = esm.GetStateMap();
+   std::map<GmatBase*, Integer> biasBlocks;
+   IntegerArray parameterBlocks;
+
+   for (UnsignedInt i = 0; i < map->size(); ++i)
+   {
+      Integer block = -1;
+      if (((*map)[i]->object->IsOfType(Gmat::MEASUREMENT_MODEL)) &&
+          ((*map)[i]->elementName == "Bias"))
+      {
+         std::map<GmatBase*, Integer>::iterator it =
+               biasBlocks.find((*map)[i]->object);
+         if (it == biasBlocks.end())
+         {
+            block = biasBlocks.size();
+            biasBlocks[(*map)[i]->object] = block;
+         }
+         else
+            block = it->second;
+      }
+      parameterBlocks.push_back(block);
+   }
+
+   normals.SetStructure(parameterBlocks);
+
+   #ifdef DEBUG_VERBOSE
+      MessageInterface::ShowMessage("Sparse normal equations: %d parameters, "
+            "%d bias blocks\n", normals.GetParameterCount(),
+            normals.GetBlockCount());
+   #endif
+}
+
+
+//------------------------------------------------------------------------------
+// void ShowNormalMatrixReduction()
+//------------------------------------------------------------------------------
+/**
+ * This method reports the solve-for parameters removed from the normal
+ * equations because their rows of the information matrix are zero.
+ */
+//------------------------------------------------------------------------------
+void BatchEstimator::ShowNormalMatrixReduction()
+{
+   const std::vector<ListItem*> *map = esm.GetStateMap();
+   for (int i = 0; i < removedNormalMatrixIndexes.size(); i++)
+   {
+      // *** Performed normal matrix reduction for EstSat.EarthMJ2000Eq.VZ
+      int index = removedNormalMatrixIndexes.at(i);
+      std::stringstream ss;
+      ss << "*** Performed normal matrix reduction for ";
+      if (((*map)[index]->object->IsOfType(Gmat::MEASUREMENT_MODEL)) &&
+         ((*map)[index]->elementName == "Bias"))
+      {
+         //MeasurementModel* mm = (MeasurementModel*)((*map)[index]->object);
+         TrackingDataAdapter* mm = (TrackingDataAdapter*)((*map)[index]->object);
+         StringArray sa = mm->GetStringArrayParameter("Participants");
+         ss << mm->GetStringParameter("Type") << " ";
+         for (UnsignedInt j = 0; j < sa.size(); ++j)
+            ss << sa[j] << (((j + 1) != sa.size()) ? "," : " Bias.");
+         ss << (*map)[index]->subelement;
+      }
+      else
+         ss << GetElementFullName((*map)[index], false);
+      ss << "\n";
+      MessageInterface::ShowMessage(ss.str());
+   }
+}
+
+
 //-------------------------------------------------------------------------
 // bool DataFilter()
 //-------------------------------------------------------------------------
@@ -1906,6 +2370,34 @@ void BatchEstimator::EstimationPartials(std::vector<RealArray> &hMeas)
    }
 
 
+   // In parallel mode, keep H-tilde and the STM at this epoch; the rows are
+   // mapped in AccumulateInParallel().  Measurements at the same epoch share
+   // the STM.
+   if (useParallelAccumulation)
+   {
+      Integer n = stateSize;
+      Integer stmSize = n * n;
+      bool isNewStm = (stmHistory.size() < (UnsignedInt)stmSize);
+      if (!isNewStm)
+      {
+         const Real *lastStm = &stmHistory[stmHistory.size() - stmSize];
+         for (Integer j = 0; (j < n) && !isNewStm; ++j)
+            for (Integer k = 0; (k < n) && !isNewStm; ++k)
+               if ((*stm)(j, k) != lastStm[j*n + k])
+                  isNewStm = true;
+      }
+
+      if (isNewStm)
+      {
+         for (Integer j = 0; j < n; ++j)
+            for (Integer k = 0; k < n; ++k)
+               stmHistory.push_back((*stm)(j, k));
+      }
+
+      hMeas = hTilde;
+      return;
+   }
+
    // Apply the STM
    #ifdef DEBUG_ACCUMULATION
       MessageInterface::ShowMessage("Applying the STM\n");
@@ -35,6 +35,7 @@
 
 
 #include "BatchEstimatorBase.hpp"
+#include "BlockNormalEquations.hpp"
 //#include "PropSetup.hpp"
 //#include "MeasurementManager.hpp"
 
@@ -46,6 +47,28 @@
  * Statistical Orbit Determination (2004), chapter 4, as illustrated in the
  * flowchart on pages 196-197.  The normal equations are solved through direct
  * inversion of the information matrix.
+ *
+ * With SparseNormalEquations set, measurement biases are treated as local
+ * parameters: each measurement depends only on the biases of its own
+ * measurement model, so the information matrix is accumulated by blocks in a
+ * BlockNormalEquations object and the biases are eliminated with the Schur
+ * complement before the remaining parameters are solved for.  The cost then
+ * grows linearly with the number of bias parameters.  The iteration reports
+ * get the covariance of the global parameters and of the biases of each
+ * measurement model, without the correlations between the two; the full
+ * covariance is built once, for the final report.
+ *
+ * With ParallelAccumulation set, the pass through the data only computes the
+ * partials at the measurement times and stores the STM of the reference
+ * trajectory at each measurement epoch.  Mapping the partials to the
+ * estimation epoch and accumulating the normal equations are done in fixed
+ * chunks of records on the WorkerPool, whenever enough STMs are stored and at
+ * the end of the pass; the mapped STMs are then released, so their memory is
+ * bounded.  The chunk sums are added in chunk order, so the result does not
+ * depend on the thread count.  Propagation, measurement modeling and H-tilde
+ * stay sequential, since the measurement adapters share the propagator and
+ * participant state; only measurements at the same epoch are modeled
+ * concurrently, through the ParallelMeasurementModeling setting.
  */
 class ESTIMATION_API BatchEstimator: public BatchEstimatorBase
 {
@@ -95,6 +118,8 @@ protected:
       ENABLE_ILSE,
       CONSTANT_MULTIPLIER_ILSE,
       MAX_ITERATIONS_ILSE,
+      SPARSE_NORMAL_EQUATIONS,
+      PARALLEL_ACCUMULATION,
       BatchEstimatorParamCount
    };
 
@@ -128,11 +153,35 @@ protected:
 
    InnerLoopStatus estimationStatusIL;
 
+   /// Flag to accumulate the normal equations by blocks, eliminating biases
+   bool useSparseNormals;
+   /// Normal equations accumulated by blocks
+   BlockNormalEquations normals;
+   /// Factored normal equations of the last iteration, for the final
+   /// covariance
+   BlockNormalEquations solvedNormals;
+
+   /// Flag to map and accumulate the partials in parallel, in chunks of
+   /// records
+   bool useParallelAccumulation;
+   /// STMs of the records not yet mapped, one per measurement epoch, row-major
+   RealArray stmHistory;
+   /// Index into stmHistory for each record not yet mapped, -1 if not used
+   IntegerArray measStmIndex;
+   /// Number of entries of measStats already mapped in the current pass
+   UnsignedInt mappedRecordCount;
+
    virtual void            CompleteInitialization();
    virtual void            Accumulate();
    virtual void            Estimate();
    virtual void            InnerLoop();
+   virtual void            RunComplete();
    virtual void            SolveNormalEquations(const Rmatrix &infMatrix, Rmatrix &covMatrix);
+   virtual void            SolveNormalEquations(BlockNormalEquations &blockNormals,
+                                                RealArray &delta, Rmatrix *covMatrix = NULL);
+   void                    SetNormalEquationStructure();
+   void                    ShowNormalMatrixReduction();
+   void                    AccumulateInParallel(bool isEndOfPass);
 
    virtual bool            DataFilter();
    virtual void            EstimationPartials(std::vector<RealArray> &hMeas);
@@ -45,6 +45,8 @@
 #include "StringUtil.hpp"
 #include "GroundstationInterface.hpp"
 #include "EstimatorException.hpp"
+#include "SolarSystem.hpp"
+#include "Planet.hpp"
 
 
 //#define DEBUG_STATE_MACHINE
@@ -79,6 +81,9 @@ BatchEstimatorBase::PARAMETER_TEXT[] =
    "FreezeMeasurementEditing",
    "FreezeIteration",
    "ConvergentStatus",
+   "ParallelMeasurementModeling",
+   "SignalDataCacheSize",
+   "ReuseLightTimeSolutions",
    // todo Add useApriori here
 };
 
@@ -94,6 +99,9 @@ BatchEstimatorBase::PARAMETER_TYPE[] =
    Gmat::BOOLEAN_TYPE,         // FREEZE_MEASUREMENT_EDITING
    Gmat::INTEGER_TYPE,         // FREEZE_ITERATION
    Gmat::STRING_TYPE,
+   Gmat::BOOLEAN_TYPE,         // PARALLEL_MEASUREMENT_MODELING
+   Gmat::INTEGER_TYPE,         // SIGNAL_DATA_CACHE_SIZE
+   Gmat::BOOLEAN_TYPE,         // REUSE_LIGHT_TIME_SOLUTIONS
 };
 
 
@@ -119,10 +127,13 @@ BatchEstimatorBase::BatchEstimatorBase(const std::string &type,
    advanceToEstimationEpoch   (false),
 //   converged                  (false),
    estimationStatus           (UNKNOWN),
+   inversionType              ("Internal"),
    maxConsDivergences         (3),
    freezeEditing              (false),                   // measurement editing is not freezed
    freezeIteration            (4),                       // number of iteration to be set freezed measurement editing
-   inversionType              ("Internal")
+   parallelModeling           (false),
+   signalCacheSize            (SignalDataCache::DEFAULT_CAPACITY),
+   reuseLightTime             (false)
 {
    objectTypeNames.push_back("BatchEstimatorBase");
    parameterCount = BatchEstimatorBaseParamCount;
@@ -172,6 +183,9 @@ BatchEstimatorBase::BatchEstimatorBase(const BatchEstimatorBase& est) :
    maxConsDivergences         (est.maxConsDivergences),
    freezeEditing              (est.freezeEditing),
    freezeIteration            (est.freezeIteration),
+   parallelModeling           (est.parallelModeling),
+   signalCacheSize            (est.signalCacheSize),
+   reuseLightTime             (est.reuseLightTime),
    inversionType              (est.inversionType)
 {
    // outerLoopBuffer is empty when copy constructor is running    // made changes by TUAN NGUYEN 
@@ -214,6 +228,9 @@ BatchEstimatorBase& BatchEstimatorBase::operator=(const BatchEstimatorBase& est)
       maxConsDivergences       = est.maxConsDivergences;
       freezeEditing            = est.freezeEditing;
       freezeIteration          = est.freezeIteration;
+      parallelModeling         = est.parallelModeling;
+      signalCacheSize          = est.signalCacheSize;
+      reuseLightTime           = est.reuseLightTime;
 
       // Clear the loop buffer
       for (UnsignedInt i = 0; i < outerLoopBuffer.size(); ++i)
@@ -461,6 +478,8 @@ Integer BatchEstimatorBase::GetIntegerParameter(const Integer id) const
       return maxConsDivergences;
    else if (id == FREEZE_ITERATION)
       return freezeIteration;
+   else if (id == SIGNAL_DATA_CACHE_SIZE)
+      return signalCacheSize;
 
    return Estimator::GetIntegerParameter(id);
 }
@@ -506,6 +525,18 @@ Integer BatchEstimatorBase::SetIntegerParameter(const Integer id, const Integer
       freezeIteration = value;
       return value;
    }
+   else if (id == SIGNAL_DATA_CACHE_SIZE)
+   {
+      if (value < 1)
+      {
+         std::stringstream ss;
+         ss << "Error: " << GetName() << ".SignalDataCacheSize has invalid value (" << value << "). It has to be a positive integer greater than 0.\n";
+         throw EstimatorException(ss.str());
+      }
+
+      signalCacheSize = value;
+      return value;
+   }
 
    return Estimator::SetIntegerParameter(id, value);
 }
@@ -772,6 +803,10 @@ bool BatchEstimatorBase::GetBooleanParameter(const Integer id) const
       return resetBestRMSFlag;
    else if (id == FREEZE_MEASUREMENT_EDITING)
       return freezeEditing;
+   else if (id == PARALLEL_MEASUREMENT_MODELING)
+      return parallelModeling;
+   else if (id == REUSE_LIGHT_TIME_SOLUTIONS)
+      return reuseLightTime;
 
    return Estimator::GetBooleanParameter(id);
 }
@@ -806,6 +841,16 @@ bool BatchEstimatorBase::SetBooleanParameter(const Integer id, const bool value)
       freezeEditing = value;
       return true;
    }
+   else if (id == PARALLEL_MEASUREMENT_MODELING)
+   {
+      parallelModeling = value;
+      return true;
+   }
+   else if (id == REUSE_LIGHT_TIME_SOLUTIONS)
+   {
+      reuseLightTime = value;
+      return true;
+   }
 
    return Estimator::SetBooleanParameter(id, value);
 }
@@ -1083,6 +1128,21 @@ void BatchEstimatorBase::CompleteInitialization()
       stateSize       = estimationState->GetSize();
 
       Estimator::CompleteInitialization();
+
+      // Observations at one epoch are modeled against the same participant
+      // states, so they can be modeled concurrently.  Buffered nutation
+      // depends on the order of the frame evaluations, though, so the
+      // concurrent results would differ from the serial ones.
+      bool parallel = parallelModeling;
+      if (parallel && IsNutationBuffered())
+      {
+         MessageInterface::ShowMessage("Warning: %s.ParallelMeasurementModeling "
+               "is ignored because Earth.NutationUpdateInterval is not 0; the "
+               "observations are modeled serially\n", GetName().c_str());
+         parallel = false;
+      }
+      measManager.SetParallelModeling(parallel);
+      measManager.SetSignalDataCacheOptions(signalCacheSize, reuseLightTime);
       
       // If estimation epoch not set, use the epoch from the prop state
       if ((estEpochFormat == "FromParticipants") || (estimationEpochGT <= 0.0))
@@ -2250,3 +2310,29 @@ void BatchEstimatorBase::InvertApriori(Rmatrix &Pdx0_inv) const
    }
 }
 
+
+//------------------------------------------------------------------------------
+// bool IsNutationBuffered() const
+//------------------------------------------------------------------------------
+/**
+ * Checks if the Earth frames reuse the nutation between updates
+ *
+ * With a nonzero NutationUpdateInterval the nutation used at an epoch is the
+ * one computed at the last update, so the modeled measurements depend on the
+ * order in which the frames are evaluated.
+ *
+ * @return true if the nutation is buffered, or if the Earth is not found
+ */
+//------------------------------------------------------------------------------
+bool BatchEstimatorBase::IsNutationBuffered() const
+{
+   if (solarSystem == NULL)
+      return true;
+
+   CelestialBody *earth =
+         solarSystem->GetBody(GmatSolarSystemDefaults::EARTH_NAME);
+   if ((earth == NULL) || !earth->IsOfType("Planet"))
+      return true;
+
+   return (((Planet*)earth)->GetNutationUpdateInterval() != 0.0);
+}
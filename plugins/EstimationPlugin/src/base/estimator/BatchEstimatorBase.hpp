@@ -161,6 +161,13 @@ protected:
    bool                    freezeEditing;
    Integer                 freezeIteration;
 
+   /// Flag to model the observations that share an epoch as one group
+   bool                    parallelModeling;
+   /// Number of entries in each table of the signal data caches
+   Integer                 signalCacheSize;
+   /// Flag to start light time iterations from the previous iteration
+   bool                    reuseLightTime;
+
    //// Statistics information for sigma edited records
    //IntegerArray sumSERecords;               // total all sigma edited records
    //RealArray    sumSEResidual;              // sum of all O-C of all sigma edited records
@@ -179,6 +186,9 @@ protected:
       FREEZE_MEASUREMENT_EDITING,
       FREEZE_ITERATION,
       CONVERGENT_STATUS,
+      PARALLEL_MEASUREMENT_MODELING,
+      SIGNAL_DATA_CACHE_SIZE,
+      REUSE_LIGHT_TIME_SOLUTIONS,
       BatchEstimatorBaseParamCount,
    };
 
@@ -222,6 +232,8 @@ protected:
    virtual void           AddMatlabData(const MeasurementInfoType &measStat);
    virtual void           AddMatlabData(const MeasurementInfoType &measStat,
                                         DataBucket &matData, IntegerMap &matIndex);
+
+   bool                   IsNutationBuffered() const;
 };
 
 #endif /* BatchEstimatorBase_hpp */
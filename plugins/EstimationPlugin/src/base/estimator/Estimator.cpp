@@ -4281,7 +4281,7 @@ void Estimator::AddMatlabIterationData()
       // GTDS MathSpec Eq 8-45, 8-46a, and 8-46b
       Rmatrix dX_dS = cart2SolvMatrix;                               // [dX/dS] matrix, where S is solve-for state. It could Cartesian or Keplerian
       // GTDS MathSpec Eq 8-49
-      Rmatrix finalCovariance = dX_dS * informationInverse * dX_dS.Transpose(); // finalCovariance is in Cartesian state
+      Rmatrix finalCovariance = MatrixTimesMatrixTimesTranspose(dX_dS, informationInverse); // finalCovariance is in Cartesian state
 
       // 2.3. Convert covariance matrix for Cr_Epsilon and Cd_Epsilon to covariance matrix for Cr and Cd
       CovarianceEpsilonConversion(finalCovariance);
@@ -4295,7 +4295,7 @@ void Estimator::AddMatlabIterationData()
 
       // 4. Write final covariance and correlation matrix for Keplerian coordinate system:
       // 4.1. Calculate covariance matrix w.r.t. Cr_Epsilon and Cd_Epsilon
-      Rmatrix finalKeplerCovariance = convmatrix * informationInverse * convmatrix.Transpose();          // Equation 8-49 GTDS MathSpec
+      Rmatrix finalKeplerCovariance = MatrixTimesMatrixTimesTranspose(convmatrix, informationInverse);          // Equation 8-49 GTDS MathSpec
 
       // 4.2. Convert covariance matrix for Cr_Epsilon and Cd_Epsilon to covariance matrix for Cr and Cd
       CovarianceEpsilonConversion(finalKeplerCovariance);
@@ -8435,7 +8435,7 @@ void Estimator::WriteReportFileSummaryPart3(Solver::SolverState sState)
    // covariance matrix w.r.t. Cr_Epsilon and Cd_Epsilon
    // GTDS MatSpec Eq 8-45
    Rmatrix dX_dS = cart2SolvMatrix;                                      // [dX/dS] matrix where S is solve-for state. X is Cartesian state
-   Rmatrix covar = dX_dS * informationInverse * dX_dS.Transpose();       // GTDS MatSpec Eq 8-49
+   Rmatrix covar = MatrixTimesMatrixTimesTranspose(dX_dS, informationInverse);       // GTDS MatSpec Eq 8-49
 
    // covariance matrix w.r.t. Cr and Cd
    CovarianceEpsilonConversion(covar);
@@ -8497,7 +8497,7 @@ void Estimator::WriteReportFileSummaryPart3(Solver::SolverState sState)
    // 9. Write Keplerian state
    // 9.1. Calculate Keplerian covariance matrix
    //Rmatrix keplerianCovar = convmatrix * covar * convmatrix.Transpose();                 // Equation 8-49 GTDS MathSpec
-   Rmatrix keplerianCovar = dK_dS * informationInverse * dK_dS.Transpose();                // Equation 8-49 GTDS MathSpec
+   Rmatrix keplerianCovar = MatrixTimesMatrixTimesTranspose(dK_dS, informationInverse);                // Equation 8-49 GTDS MathSpec
 
    // 9.2. Write Keplerian apriori, previous, current states
    std::vector<std::string> nameList;
@@ -8703,7 +8703,7 @@ void Estimator::WriteReportFileSummaryPart4(Solver::SolverState sState)
    // GTDS MathSpec Eq 8-45, 8-46a, and 8-46b
    Rmatrix dX_dS = cart2SolvMatrix;                               // [dX/dS] matrix, where S is solve-for state. It could Cartesian or Keplerian
    // GTDS MathSpec Eq 8-49
-   finalCovariance = dX_dS * finalCovariance * dX_dS.Transpose(); // finalCovariance is in Cartesian state
+   finalCovariance = MatrixTimesMatrixTimesTranspose(dX_dS, finalCovariance); // finalCovariance is in Cartesian state
 
    // 2.3. Convert covariance matrix for Cr_Epsilon and Cd_Epsilon to covariance matrix for Cr and Cd
    CovarianceEpsilonConversion(finalCovariance);
@@ -8729,7 +8729,7 @@ void Estimator::WriteReportFileSummaryPart4(Solver::SolverState sState)
 
    // 4. Write final covariance and correlation matrix for Keplerian coordinate system:
    // 4.1. Calculate covariance matrix w.r.t. Cr_Epsilon and Cd_Epsilon
-   Rmatrix finalKeplerCovariance = convmatrix * informationInverse * convmatrix.Transpose();          // Equation 8-49 GTDS MathSpec
+   Rmatrix finalKeplerCovariance = MatrixTimesMatrixTimesTranspose(convmatrix, informationInverse);          // Equation 8-49 GTDS MathSpec
 
    // 4.2. Convert covariance matrix for Cr_Epsilon and Cd_Epsilon to covariance matrix for Cr and Cd
    CovarianceEpsilonConversion(finalKeplerCovariance);
@@ -37,6 +37,7 @@
 
 // Supported ObTypes
 #include "GmatObType.hpp"
+#include "BinaryObType.hpp"
 #ifdef INCLUDE_TDM
    #include "TdmObType.hpp"
 #endif
@@ -61,6 +62,7 @@ ObTypeFactory::ObTypeFactory() :
    if (creatables.empty())
    {
       creatables.push_back("GMATInternal");
+      creatables.push_back("GMATBinary");
 	   //creatables.push_back("GMAT_OD");
 	   //creatables.push_back("GMAT_ODDoppler");
 	   creatables.push_back("GMAT_RampTable");
@@ -99,6 +101,7 @@ ObTypeFactory::ObTypeFactory(StringArray createList) :
    if (creatables.empty())
    {
       creatables.push_back("GMATInternal");
+      creatables.push_back("GMATBinary");
 	   //creatables.push_back("GMAT_OD");
 	   //creatables.push_back("GMAT_ODDoppler");
 	   creatables.push_back("GMAT_RampTable");
@@ -124,6 +127,7 @@ ObTypeFactory::ObTypeFactory(const ObTypeFactory& fact) :
    if (creatables.empty())
    {
       creatables.push_back("GMATInternal");
+      creatables.push_back("GMATBinary");
 	   //creatables.push_back("GMAT_OD");
 	   //creatables.push_back("GMAT_ODDoppler");
 	   creatables.push_back("GMAT_RampTable");
@@ -154,6 +158,7 @@ ObTypeFactory& ObTypeFactory::operator= (const ObTypeFactory& fact)
       if (creatables.empty())
       {
          creatables.push_back("GMATInternal");
+         creatables.push_back("GMATBinary");
 		   //creatables.push_back("GMAT_OD");
 		   //creatables.push_back("GMAT_ODDoppler");
 		   creatables.push_back("GMAT_RampTable");
@@ -203,6 +208,8 @@ ObType* ObTypeFactory::CreateObType(const std::string &ofType,
 
    if (ofType == "GMATInternal")
       retval = new GmatObType(withName);
+   else if (ofType == "GMATBinary")
+      retval = new BinaryObType(withName);
    //else if (ofType == "GMAT_OD")
    //   retval = new GmatODType(withName);
    //else if (ofType == "GMAT_ODDoppler")
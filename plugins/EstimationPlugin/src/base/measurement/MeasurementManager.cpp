@@ -45,7 +45,10 @@
 
 // Temporary to get Adapters hooked up
 #include "GmatObType.hpp"
+#include "BinaryObType.hpp"
 #include "RampTableType.hpp"
+#include "WorkerPool.hpp"
+#include "SharedDataLock.hpp"
 
 //#define DEBUG_CONSTRUCTION
 //#define DEBUG_INITIALIZATION
@@ -76,6 +79,7 @@
  */
 //------------------------------------------------------------------------------
 MeasurementManager::MeasurementManager() :
+   transientForces   (NULL),
    thePropagators    (NULL),
    satPropagatorMap  (NULL),
    anchorEpochGT     (GmatTimeConstants::MJD_OF_J2000),
@@ -86,7 +90,8 @@ MeasurementManager::MeasurementManager() :
    eventCount        (0),
    inSimulationMode  (false),
    isForward         (true),
-   transientForces   (NULL)
+   parallelModeling  (false),
+   groupPosition     (-1)
 {
 }
 
@@ -232,6 +237,10 @@ void MeasurementManager::CleanUp()
  */
 //------------------------------------------------------------------------------
 MeasurementManager::MeasurementManager(const MeasurementManager &mm) :
+   modelNames        (mm.modelNames),                    // made changes by TUAN NGUYEN
+   trackingSets      (mm.trackingSets),                  // made changes by TUAN NGUYEN
+   adapters          (mm.adapters),                      // made changes by TUAN NGUYEN
+   transientForces   (NULL),
    thePropagators    (mm.thePropagators),
    satPropagatorMap  (mm.satPropagatorMap),
    anchorEpochGT     (mm.anchorEpochGT),
@@ -242,11 +251,8 @@ MeasurementManager::MeasurementManager(const MeasurementManager &mm) :
    eventCount        (mm.eventCount),
    inSimulationMode  (mm.inSimulationMode),
    isForward         (mm.isForward),
-   modelNames        (mm.modelNames),                    // made changes by TUAN NGUYEN
-   adapters          (mm.adapters),                      // made changes by TUAN NGUYEN
-   trackingSets      (mm.trackingSets),                  // made changes by TUAN NGUYEN
-   
-   transientForces   (NULL)
+   parallelModeling  (mm.parallelModeling),
+   groupPosition     (-1)
 {
    // made changes by TUAN NGUYEN
    //modelNames = mm.modelNames;
@@ -300,6 +306,7 @@ MeasurementManager& MeasurementManager::operator=(const MeasurementManager &mm)
       eventCount       = mm.eventCount;
       inSimulationMode = mm.inSimulationMode;
       isForward        = mm.isForward;
+      parallelModeling = mm.parallelModeling;
       transientForces  = NULL;
 
       adapters         = mm.adapters;                 // made changes by TUAN NGUYEN
@@ -318,6 +325,7 @@ MeasurementManager& MeasurementManager::operator=(const MeasurementManager &mm)
       //trackingSets.clear();
 
       measurements.clear();
+      ClearMeasurementGroup();
 
       ////for (std::vector<TrackingDataAdapter*>::const_iterator i = mm.adapters.begin();
       ////      i != mm.adapters.end(); ++i)
@@ -424,7 +432,11 @@ bool MeasurementManager::Initialize()
          newStream->SetStringParameter("Filename", filenames[k]);
 
          // 3.1.2 Create and set a data stream associated with the DataFile object
-         GmatObType *got = new GmatObType();                      // ??? what happen for GMAT_OD and GMAT_ODDoppler???   // In new design, GMATInteral data file contains data records with different measurement type
+         ObType *got;
+         if (GmatStringUtil::EndsWith(filenames[k], BinaryObType::FILE_EXTENSION))
+            got = new BinaryObType();
+         else
+            got = new GmatObType();                      // ??? what happen for GMAT_OD and GMAT_ODDoppler???   // In new design, GMATInteral data file contains data records with different measurement type
          newStream->SetStream(got);
          #ifdef DEBUG_INITIALIZATION
             MessageInterface::ShowMessage("   Adding %s DataFile %s <%p>\n",
@@ -1259,6 +1271,7 @@ UnsignedInt MeasurementManager::LoadObservations()
    //totalCount["Old Syntax's Time span"]           = 0;        // made changes by TUAN NGUYEN
 
    observations.clear();
+   ClearMeasurementGroup();
 
    std::vector<UnsignedInt> numRec;                    // numRec[i] is number of records of data file specified by streamList[i] 
    std::vector<UnsignedInt> count;                     // count[i] is number of all accepted records associated with file specified by streamList[i] after applying statistic filters
@@ -1403,6 +1416,10 @@ UnsignedInt MeasurementManager::LoadObservations()
       MessageInterface::ShowMessage("     .%s : %d\n", i->first.c_str(), i->second); 
    }
 
+   // Records that a binary file skipped for the time span are records too
+   for (UnsignedInt i = 0; i < streamList.size(); ++i)
+      numRec[i] += streamList[i]->GetSkippedRecordCount();
+
    for (UnsignedInt i = 0; i < streamList.size(); ++i)
       MessageInterface::ShowMessage("Data file '%s' has %d of %d records used for estimation.\n", streamList[i]->GetStringParameter("Filename").c_str(), count[i], numRec[i]);
 
@@ -2016,6 +2033,7 @@ bool MeasurementManager::RemoveObservation(const Integer observationToRemove)
       removeIndex = obsIndex;
 
    observations.erase(observations.begin() + removeIndex);
+   ClearMeasurementGroup();
 
    if (obsIndex > removeIndex)
       --obsIndex;
@@ -2497,6 +2515,9 @@ bool MeasurementManager::CalculateMeasurements(bool forSimulation, bool withEven
          MessageInterface::ShowMessage("adapters.size() = %d:\n", adapters.size());
       #endif
 
+      if (parallelModeling)
+         return CalculateMeasurementGroup(withEvents);
+
       // Now do the tracking data adapters. Obsevation data od belongs to adapters[j] 
       // when their measurement type and signal path are the same. The measurement[j] associated
       // to adapter has valid value when they are belong to each other. Otherwise, measurement[j]
@@ -2504,40 +2525,8 @@ bool MeasurementManager::CalculateMeasurements(bool forSimulation, bool withEven
       for (UnsignedInt j = 0; j < adapters.size(); ++j)
       {
          // Code to verify observation data belonging to the measurement model jth
-         bool isbelong = false;
-         if ((adapters[j]->GetStringParameter("MeasurementType") == od->typeName))
-         {
-            std::vector<ObjectArray*> participantObjLists = adapters[j]->GetMeasurementModel()->GetParticipantObjectLists();
-            UnsignedInt num = participantObjLists[0]->size();                                       // participants in measurement model
-            if (num == od->participantIDs.size())
-            {
-               isbelong = true;
-               for (UnsignedInt i1 = 0; i1 < num; ++i1)
-               {
-                  // when observation data's signal path and measurement model's signal
-                  // path are different, they do not belong each other
-                  if (od->participantIDs[i1] != participantObjLists[0]->at(i1)->GetStringParameter("Id"))
-                  {
-                     isbelong = false;
-                     break;
-                  }
-               }
-            }
-         }
-
-         if (isbelong == false)
-         {
-            measurements[j].typeName         = adapters[j]->GetStringParameter("MeasurementType");
-            measurements[j].epochGT          = od->epochGT;
-            measurements[j].epoch            = od->epoch;
-            measurements[j].epochSystem      = od->epochSystem;
-            measurements[j].isFeasible       = false;
-            measurements[j].covariance       = NULL;
-            measurements[j].eventCount       = 0;
-            measurements[j].feasibilityValue = 0.0;
-            measurements[j].unfeasibleReason = "U";
-            measurements[j].value.clear();  
-         }
+         if (IsObservationOfAdapter(j, od) == false)
+            SetUnmatchedMeasurement(measurements[j], j, od);
          else
          {
 ///// TBD: Do we want something more generic here?
@@ -2967,6 +2956,9 @@ void  MeasurementManager::Reset()
       obsIndex = 0;
    else
       obsIndex = observations.size() - 1;
+
+   // Each pass models the observations anew
+   ClearMeasurementGroup();
 }
 
 
@@ -2986,6 +2978,7 @@ void  MeasurementManager::Reset()
 void MeasurementManager::SetDirection(bool forwards)
 {
    isForward = forwards;
+   ClearMeasurementGroup();
 }
 
 
@@ -3156,3 +3149,341 @@ void MeasurementManager::ClearIonosphereCache()
       (*it)->ClearIonosphereCache();
    }
 }
+
+
+//------------------------------------------------------------------------------
+// void SetSignalDataCacheOptions(UnsignedInt capacity, bool reuseLightTime)
+//------------------------------------------------------------------------------
+/**
+ * Configures the signal data caches of the tracking file sets
+ *
+ * The caches are emptied and their statistics reset.
+ *
+ * @param capacity       Number of entries each table of a cache holds
+ * @param reuseLightTime true to start light time iterations from the solutions
+ *                       of the previous pass
+ */
+//------------------------------------------------------------------------------
+void MeasurementManager::SetSignalDataCacheOptions(UnsignedInt capacity,
+      bool reuseLightTime)
+{
+   for (UnsignedInt i = 0; i < trackingSets.size(); ++i)
+   {
+      SignalDataCache *cache = trackingSets[i]->GetSignalDataCache();
+      cache->SetCapacity(capacity);
+      cache->SetLightTimeReuse(reuseLightTime);
+      cache->ResetStatistics();
+   }
+}
+
+
+//------------------------------------------------------------------------------
+// void GetSignalDataCacheStatistics(SignalDataCache::Statistics &signalStats,
+//       SignalDataCache::Statistics &lightTimeStats)
+//------------------------------------------------------------------------------
+/**
+ * Retrieves the lookup counts of the signal data caches, summed over the
+ * tracking file sets
+ *
+ * @param signalStats    Set to the counts of the signal data tables
+ * @param lightTimeStats Set to the counts of the light time tables
+ */
+//------------------------------------------------------------------------------
+void MeasurementManager::GetSignalDataCacheStatistics(
+      SignalDataCache::Statistics &signalStats,
+      SignalDataCache::Statistics &lightTimeStats)
+{
+   signalStats = SignalDataCache::Statistics();
+   lightTimeStats = SignalDataCache::Statistics();
+   for (UnsignedInt i = 0; i < trackingSets.size(); ++i)
+   {
+      SignalDataCache *cache = trackingSets[i]->GetSignalDataCache();
+      signalStats += cache->GetSignalStatistics();
+      lightTimeStats += cache->GetLightTimeStatistics();
+   }
+}
+
+
+//------------------------------------------------------------------------------
+// void SetParallelModeling(bool parallel)
+//------------------------------------------------------------------------------
+/**
+ * Turns concurrent modeling of the observations that share an epoch on or off
+ *
+ * When it is on, CalculateMeasurements() in estimation mode models the current
+ * observation together with the following observations at the same epoch that
+ * belong to other tracking data adapters, and serves those observations from
+ * the stored results when the estimator advances to them.  Only estimators
+ * that do not change the participants' states between the observations of an
+ * epoch (the batch estimators) may use it.
+ *
+ * @param parallel true to model the observations concurrently
+ */
+//------------------------------------------------------------------------------
+void MeasurementManager::SetParallelModeling(bool parallel)
+{
+   parallelModeling = parallel;
+   ClearMeasurementGroup();
+}
+
+
+//------------------------------------------------------------------------------
+// bool IsParallelModeling() const
+//------------------------------------------------------------------------------
+/**
+ * Checks if the observations that share an epoch are modeled concurrently
+ *
+ * @return true if they are, false if they are modeled one by one
+ */
+//------------------------------------------------------------------------------
+bool MeasurementManager::IsParallelModeling() const
+{
+   return parallelModeling;
+}
+
+
+//------------------------------------------------------------------------------
+// bool IsObservationOfAdapter(UnsignedInt adapterIndex,
+//       const ObservationData *od)
+//------------------------------------------------------------------------------
+/**
+ * Checks if an observation belongs to a tracking data adapter
+ *
+ * Observation data belongs to an adapter when their measurement type and
+ * signal path are the same.
+ *
+ * @param adapterIndex Index of the adapter
+ * @param od           The observation
+ *
+ * @return true if the observation belongs to the adapter
+ */
+//------------------------------------------------------------------------------
+bool MeasurementManager::IsObservationOfAdapter(UnsignedInt adapterIndex,
+      const ObservationData *od)
+{
+   TrackingDataAdapter *adapter = adapters[adapterIndex];
+   if (adapter->GetStringParameter("MeasurementType") != od->typeName)
+      return false;
+
+   std::vector<ObjectArray*> participantObjLists =
+         adapter->GetMeasurementModel()->GetParticipantObjectLists();
+   UnsignedInt num = participantObjLists[0]->size();  // participants in measurement model
+   if (num != od->participantIDs.size())
+      return false;
+
+   for (UnsignedInt i1 = 0; i1 < num; ++i1)
+   {
+      // when observation data's signal path and measurement model's signal
+      // path are different, they do not belong each other
+      if (od->participantIDs[i1] !=
+          participantObjLists[0]->at(i1)->GetStringParameter("Id"))
+         return false;
+   }
+
+   return true;
+}
+
+
+//------------------------------------------------------------------------------
+// void SetUnmatchedMeasurement(MeasurementData &md, UnsignedInt adapterIndex,
+//       const ObservationData *od)
+//------------------------------------------------------------------------------
+/**
+ * Fills in the infeasible measurement of an adapter the observation does not
+ * belong to
+ *
+ * @param md           The measurement to fill in
+ * @param adapterIndex Index of the adapter
+ * @param od           The observation
+ */
+//------------------------------------------------------------------------------
+void MeasurementManager::SetUnmatchedMeasurement(MeasurementData &md,
+      UnsignedInt adapterIndex, const ObservationData *od)
+{
+   md.typeName         = adapters[adapterIndex]->GetStringParameter("MeasurementType");
+   md.epochGT          = od->epochGT;
+   md.epoch            = od->epoch;
+   md.epochSystem      = od->epochSystem;
+   md.isFeasible       = false;
+   md.covariance       = NULL;
+   md.eventCount       = 0;
+   md.feasibilityValue = 0.0;
+   md.unfeasibleReason = "U";
+   md.value.clear();
+}
+
+
+//------------------------------------------------------------------------------
+// bool CalculateMeasurementGroup(bool withEvents)
+//------------------------------------------------------------------------------
+/**
+ * Estimation mode CalculateMeasurements() for concurrent modeling
+ *
+ * If the current observation was modeled with the current group, its stored
+ * measurements are served.  Otherwise a new group is built: the current
+ * observation and the observations that follow it at the same epoch, up to
+ * the first one that belongs to an adapter already in the group.  Each
+ * adapter models at most one observation of a group, so its state (used later
+ * by CalculateDerivatives()) is the state for that observation.
+ *
+ * The adapters of the group are dispatched on the WorkerPool, but each one
+ * models its observation under the SharedDataLock.  The adapters share the
+ * participants: the light time propagation moves the shared spacecraft to
+ * the transmit and receive epochs, and the signals read the shared frames
+ * and signal data caches.  The tasks are therefore serialized, and grouping
+ * does not make the modeling faster; it only fixes the order in which the
+ * observations of an epoch are modeled and served.  Running the tasks
+ * unlocked needs per-group copies of the participants and their frames.
+ * The results match serial modeling bit for bit as long as the frames hold
+ * no state that depends on the order of their evaluations; the batch
+ * estimators only turn grouped modeling on when the Earth nutation is
+ * recomputed at every epoch.
+ *
+ * @param withEvents flag to indicate calculation with or without events
+ *
+ * @return True if at least one measurement is feasible and calculated; false
+ *         otherwise
+ */
+//------------------------------------------------------------------------------
+bool MeasurementManager::CalculateMeasurementGroup(bool withEvents)
+{
+   // Serve the observation from the current group when it is part of it
+   for (Integer k = groupPosition + 1; k < (Integer)groupObservations.size();
+        ++k)
+   {
+      if (groupObservations[k] == obsIndex)
+      {
+         groupPosition = k;
+         measurements = groupMeasurements[k];
+         eventCount = groupEventCounts[k];
+         return (groupFeasible[k] != 0);
+      }
+   }
+
+   ClearMeasurementGroup();
+
+   // Collect the observations of the group and the adapters that model them
+   Integer direction = (isForward ? 1 : -1);
+   const GmatTime &epochGT = observations[obsIndex].epochGT;
+   std::vector<bool> adapterUsed(adapters.size(), false);
+   IntegerArray taskObservation, taskAdapter;
+
+   for (Integer index = obsIndex;
+        (index >= 0) && (index < (Integer)observations.size());
+        index += direction)
+   {
+      ObservationData *od = &(observations[index]);
+      if ((index != obsIndex) && (od->epochGT != epochGT))
+         break;
+
+      IntegerArray matches;
+      bool clash = false;
+      for (UnsignedInt j = 0; j < adapters.size(); ++j)
+      {
+         if (IsObservationOfAdapter(j, od))
+         {
+            matches.push_back(j);
+            if (adapterUsed[j])
+               clash = true;
+         }
+      }
+      if (clash)
+         break;
+
+      Integer position = groupObservations.size();
+      groupObservations.push_back(index);
+      groupMeasurements.push_back(measurements);
+      for (UnsignedInt j = 0; j < adapters.size(); ++j)
+         SetUnmatchedMeasurement(groupMeasurements[position][j], j, od);
+
+      for (UnsignedInt m = 0; m < matches.size(); ++m)
+      {
+         adapterUsed[matches[m]] = true;
+         taskObservation.push_back(position);
+         taskAdapter.push_back(matches[m]);
+      }
+   }
+
+   // Ramp table lookups may add to the table map, so they are made here
+   std::vector<std::vector<RampTableData>*> rampTable(taskAdapter.size());
+   for (UnsignedInt t = 0; t < taskAdapter.size(); ++t)
+      rampTable[t] = GetRampTableForAdapter(*adapters[taskAdapter[t]]);
+
+   #ifdef DEBUG_CALCULATE_MEASUREMENTS
+      MessageInterface::ShowMessage("   Modeling %d observations with %d "
+            "adapters on %d threads\n", groupObservations.size(),
+            taskAdapter.size(), WorkerPool::Instance()->GetThreadCount());
+   #endif
+
+   std::function<void(Integer)> model = [&](Integer t)
+   {
+      SharedDataLock::Guard guard;
+      Integer position = taskObservation[t];
+      ObservationData *od = &(observations[groupObservations[position]]);
+      groupMeasurements[position][taskAdapter[t]] =
+            adapters[taskAdapter[t]]->CalculateMeasurement(withEvents, od,
+                  rampTable[t], false);
+   };
+
+   if (taskAdapter.size() > 1)
+   {
+      SharedDataLock::Enable();
+      try
+      {
+         WorkerPool::Instance()->Run((Integer)taskAdapter.size(), model);
+      }
+      catch (...)
+      {
+         SharedDataLock::Disable();
+         ClearMeasurementGroup();
+         throw;
+      }
+      SharedDataLock::Disable();
+   }
+   else if (taskAdapter.size() == 1)
+      model(0);
+
+   for (UnsignedInt position = 0; position < groupObservations.size();
+        ++position)
+   {
+      Integer feasible = 0, events = 0;
+      for (UnsignedInt t = 0; t < taskAdapter.size(); ++t)
+      {
+         if (taskObservation[t] != (Integer)position)
+            continue;
+         const MeasurementData &md =
+               groupMeasurements[position][taskAdapter[t]];
+         if (md.isFeasible)
+         {
+            if (!withEvents)
+               events += md.eventCount;
+            feasible = 1;
+         }
+      }
+      groupFeasible.push_back(feasible);
+      groupEventCounts.push_back(events);
+   }
+
+   groupPosition = 0;
+   measurements = groupMeasurements[0];
+   eventCount = groupEventCounts[0];
+
+   return (groupFeasible[0] != 0);
+}
+
+
+//------------------------------------------------------------------------------
+// void ClearMeasurementGroup()
+//------------------------------------------------------------------------------
+/**
+ * Discards the measurements of the concurrently modeled group
+ */
+//------------------------------------------------------------------------------
+void MeasurementManager::ClearMeasurementGroup()
+{
+   groupObservations.clear();
+   groupMeasurements.clear();
+   groupFeasible.clear();
+   groupEventCounts.clear();
+   groupPosition = -1;
+}
@@ -146,6 +146,14 @@ public:
    ObjectArray             GetStatisticsDataFilters(TrackingFileSet* tfs = NULL);
 
    void                    ClearIonosphereCache();
+   void                    SetSignalDataCacheOptions(UnsignedInt capacity,
+                                                     bool reuseLightTime);
+   void                    GetSignalDataCacheStatistics(
+                                 SignalDataCache::Statistics &signalStats,
+                                 SignalDataCache::Statistics &lightTimeStats);
+
+   void                    SetParallelModeling(bool parallel);
+   bool                    IsParallelModeling() const;
 protected:
    /// List of the managed measurement models
    StringArray                      modelNames;
@@ -222,6 +230,20 @@ protected:
    /// Flag to indicate direction of measurements
    bool                             isForward;
 
+   /// Flag to model the observations that share an epoch as one group
+   bool                             parallelModeling;
+   /// Indices of the observations modeled together in the current group
+   IntegerArray                     groupObservations;
+   /// Position in groupObservations of the observation served last
+   Integer                          groupPosition;
+   /// Measurements computed for each observation of the group
+   std::vector<std::vector<MeasurementData> >
+                                    groupMeasurements;
+   /// Feasibility (1) or not (0) of each observation of the group
+   IntegerArray                     groupFeasible;
+   /// Event count for each observation of the group
+   IntegerArray                     groupEventCounts;
+
    Integer                          FindModelForObservation();
 
 private:
@@ -232,6 +254,13 @@ private:
 
    std::vector<RampTableData>* GetRampTableForAdapter(TrackingDataAdapter& adapter);
 
+   bool IsObservationOfAdapter(UnsignedInt adapterIndex,
+                               const ObservationData *od);
+   void SetUnmatchedMeasurement(MeasurementData &md, UnsignedInt adapterIndex,
+                                const ObservationData *od);
+   bool CalculateMeasurementGroup(bool withEvents);
+   void ClearMeasurementGroup();
+
 };
 
 #endif /*MeasurementManager_hpp*/
@@ -0,0 +1,1249 @@
+//$Id$
+//------------------------------------------------------------------------------
+//                         BinaryObType
+//------------------------------------------------------------------------------
+// GMAT: General Mission Analysis Tool
+//
+// Copyright (c) 2002 - 2020 United States Government as represented by the
+// Administrator of The National Aeronautics and Space Administration.
+// All Other Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// You may not use this file except in compliance with the License.
+// You may obtain a copy of the License at:
+// http://www.apache.org/licenses/LICENSE-2.0.
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied.   See the License for the specific language
+// governing permissions and limitations under the License.
+//
+// Author: GMAT Development Team
+// Created: 2026/10/17
+//
+/**
+ * ObType class used for the GMAT binary, columnar observation data
+ *
+ * File layout (native byte order, every section aligned to 8 bytes):
+ *
+ *    FileHeader
+ *    COLUMN_COUNT section entries {offset, size in bytes}
+ *    sections, in Column order
+ *
+ * Per record columns hold one value per record.  Each list field uses a
+ * "start" column of recordCount + 1 offsets into a pool column; strands are
+ * stored as string indices with each strand terminated by -1.  Strings are
+ * stored as indices into the string table.
+ */
+//------------------------------------------------------------------------------
+
+
+#include "BinaryObType.hpp"
+#include "MessageInterface.hpp"
+#include "GmatConstants.hpp"
+#include "FileManager.hpp"
+#include "MeasurementException.hpp"
+#include "MemoryMappedFile.hpp"
+#include "RealUtilities.hpp"
+#include <fstream>
+#include <algorithm>
+#include <cstring>
+#include <cstdint>
+#include <limits>
+
+
+//#define DEBUG_FILE_ACCESS
+//#define DEBUG_FILE_READ
+
+
+const std::string BinaryObType::FILE_EXTENSION = ".gmb";
+
+
+namespace
+{
+   /// Marker at the start of a binary observation file
+   const char FILE_MAGIC[8] = {'G', 'M', 'A', 'T', 'O', 'B', 'S', 'B'};
+   /// Value used to detect files written with a different byte order
+   const UnsignedInt BYTE_ORDER_MARK = 0x01020304;
+   /// Version of the file layout
+   const UnsignedInt FILE_VERSION = 1;
+   /// Default number of records summarized by an epoch index entry
+   const Integer DEFAULT_BLOCK_SIZE = 1024;
+   /// Tolerance used when testing index blocks against a time window, in days
+   const Real WINDOW_MARGIN = 1.0e-8;
+
+   /// Bit flags used in the EPOCH_FLAGS column
+   const Integer EPOCH_AT_END = 1;
+   const Integer EPOCH_AT_INTEGRATION_END = 2;
+
+   /// Fixed size header at the start of the file
+   struct FileHeader
+   {
+      char           magic[8];
+      UnsignedInt    byteOrder;
+      UnsignedInt    version;
+      Integer        epochSystem;
+      Integer        columnCount;
+      std::uint64_t  recordCount;
+      std::uint64_t  stringCount;
+      std::uint64_t  blockSize;
+      std::uint64_t  blockCount;
+   };
+
+   /// Location of a section of the file
+   struct SectionEntry
+   {
+      std::uint64_t  offset;
+      std::uint64_t  size;
+   };
+
+   //---------------------------------------------------------------------------
+   // void PutValue(std::vector<char> &column, const T &value)
+   //---------------------------------------------------------------------------
+   /**
+    * Appends the bytes of a value to a column
+    */
+   //---------------------------------------------------------------------------
+   template <typename T>
+   void PutValue(std::vector<char> &column, const T &value)
+   {
+      const char *bytes = reinterpret_cast<const char*>(&value);
+      column.insert(column.end(), bytes, bytes + sizeof(T));
+   }
+
+   //---------------------------------------------------------------------------
+   // std::string GetUnit(const std::string &typeName)
+   //---------------------------------------------------------------------------
+   /**
+    * Returns the unit a GMATInternal file reports for a measurement type
+    */
+   //---------------------------------------------------------------------------
+   std::string GetUnit(const std::string &typeName)
+   {
+      if ((typeName == "DSN_TCP") || (typeName == "SN_Doppler"))
+         return "Hz";
+      if (typeName == "RangeRate")
+         return "km/s";
+      if (typeName == "DSN_SeqRange")
+         return "RU";
+      if ((typeName == "Azimuth") || (typeName == "Elevation") ||
+          (typeName == "XEast") || (typeName == "YNorth") ||
+          (typeName == "XSouth") || (typeName == "YEast") ||
+          (typeName == "RightAscension") || (typeName == "Declination"))
+         return "deg";
+      return "km";
+   }
+}
+
+
+//-----------------------------------------------------------------------------
+// BinaryObType(const std::string withName)
+//-----------------------------------------------------------------------------
+/**
+ * Default constructor
+ *
+ * @param withName The name of the new object
+ */
+//-----------------------------------------------------------------------------
+BinaryObType::BinaryObType(const std::string withName) :
+   ObType            ("GMATBinary", withName),
+   fullPath          (""),
+   isWriting         (false),
+   fileEpochSystem   (-1),
+   recordCount       (0),
+   blockSize         (DEFAULT_BLOCK_SIZE),
+   nextRecord        (0),
+   skippedCount      (0),
+   mapping           (NULL),
+   hasTimeWindow     (false),
+   windowStart       (0.0),
+   windowEnd         (0.0),
+   fileWindowStart   (0.0),
+   fileWindowEnd     (0.0)
+{
+   ReleaseFile();
+   ResetColumns();
+}
+
+
+//-----------------------------------------------------------------------------
+// ~BinaryObType()
+//-----------------------------------------------------------------------------
+/**
+ * Destructor
+ */
+//-----------------------------------------------------------------------------
+BinaryObType::~BinaryObType()
+{
+   ReleaseFile();
+}
+
+
+//-----------------------------------------------------------------------------
+// BinaryObType(const BinaryObType& ot) :
+//-----------------------------------------------------------------------------
+/**
+ * Copy constructor
+ *
+ * Only the settings are copied; the copy has no open file.
+ *
+ * @param ot The BinaryObType that gets copied to this one
+ */
+//-----------------------------------------------------------------------------
+BinaryObType::BinaryObType(const BinaryObType& ot) :
+   ObType            (ot),
+   fullPath          (""),
+   isWriting         (false),
+   fileEpochSystem   (-1),
+   recordCount       (0),
+   blockSize         (ot.blockSize),
+   nextRecord        (0),
+   skippedCount      (0),
+   mapping           (NULL),
+   hasTimeWindow     (ot.hasTimeWindow),
+   windowStart       (ot.windowStart),
+   windowEnd         (ot.windowEnd),
+   fileWindowStart   (0.0),
+   fileWindowEnd     (0.0)
+{
+   ReleaseFile();
+   ResetColumns();
+}
+
+
+//-----------------------------------------------------------------------------
+// BinaryObType& operator=(const BinaryObType& ot)
+//-----------------------------------------------------------------------------
+/**
+ * Assignment operator
+ *
+ * Only the settings are copied; any file open on this object is closed.
+ *
+ * @param ot The BinaryObType that gets copied to this one
+ *
+ * @return This BinaryObType, configured to match ot
+ */
+//-----------------------------------------------------------------------------
+BinaryObType& BinaryObType::operator=(const BinaryObType& ot)
+{
+   if (this != &ot)
+   {
+      ObType::operator=(ot);
+
+      ReleaseFile();
+      ResetColumns();
+      isWriting      = false;
+      blockSize      = ot.blockSize;
+      hasTimeWindow  = ot.hasTimeWindow;
+      windowStart    = ot.windowStart;
+      windowEnd      = ot.windowEnd;
+   }
+
+   return *this;
+}
+
+
+//-----------------------------------------------------------------------------
+// GmatBase* Clone() const
+//-----------------------------------------------------------------------------
+/**
+ * Cloning method used to create a BinaryObType from a GmatBase pointer
+ *
+ * @return A new BinaryObType object matching this one
+ */
+//-----------------------------------------------------------------------------
+GmatBase* BinaryObType::Clone() const
+{
+   return new BinaryObType(*this);
+}
+
+
+//-----------------------------------------------------------------------------
+// bool Initialize()
+//-----------------------------------------------------------------------------
+/**
+ * Prepares this BinaryObType for use
+ *
+ * @return true on success, false on failure
+ */
+//-----------------------------------------------------------------------------
+bool BinaryObType::Initialize()
+{
+   ObType::Initialize();
+
+   return true;
+}
+
+
+//-----------------------------------------------------------------------------
+// bool Open(bool forRead, bool forWrite, bool append)
+//-----------------------------------------------------------------------------
+/**
+ * Opens a binary observation file
+ *
+ * The method manages the path and file extension defaults in the same way as
+ * GmatObType, using the .gmb extension.  Files opened for reading are
+ * mapped into memory; files opened for writing are written when the stream
+ * is closed.
+ *
+ * @param forRead True to open for reading, false otherwise
+ * @param forWrite True to open for writing, false otherwise
+ * @param append Not supported for binary files
+ *
+ * @return true if the the file was opened
+ */
+//-----------------------------------------------------------------------------
+bool BinaryObType::Open(bool forRead, bool forWrite, bool append)
+{
+   #ifdef DEBUG_FILE_ACCESS
+      MessageInterface::ShowMessage("BinaryObType::Open(%s, %s, %s) Executing "
+            "for %s\n", (forRead ? "true" : "false"),
+            (forWrite ? "true" : "false"), (append ? "true" : "false"),
+            streamName.c_str());
+   #endif
+
+   if (IsOpen())
+      return true;
+
+   if (append || (forRead && forWrite))
+      throw MeasurementException("GMATBinary Data File " + streamName +
+            " can only be opened for either reading or writing\n");
+
+   if (streamName == "")
+      throw MeasurementException("GMATBinary Data File could not be opened: "
+            "no file name was set\n");
+
+   fullPath = "";
+
+   // If no path designation slash character is found, add the default path
+   if ((streamName.find('/') == std::string::npos) &&
+       (streamName.find('\\') == std::string::npos))
+   {
+      FileManager *fm = FileManager::Instance();
+      fullPath = fm->GetPathname(FileManager::MEASUREMENT_PATH);
+   }
+   fullPath += streamName;
+
+   // Add the .gmb extension if there is no extension in the file
+   size_t dotLoc = fullPath.find_last_of('.');
+   size_t slashLoc = fullPath.find_last_of('/');
+   if (slashLoc == std::string::npos)
+      slashLoc = fullPath.find_last_of('\\');
+
+   if ((dotLoc == std::string::npos) ||
+       ((slashLoc != std::string::npos) && (dotLoc < slashLoc)))
+      fullPath += FILE_EXTENSION;
+
+   if (forWrite)
+   {
+      // Check that the file can be created before buffering any data
+      std::ofstream test(fullPath.c_str(), std::ios::binary | std::ios::trunc);
+      if (!test)
+         throw MeasurementException("GMATBinary Data File " + streamName +
+               " could not be opened\n");
+
+      ResetColumns();
+      fileEpochSystem = -1;
+      isWriting = true;
+   }
+   else
+      MapFile();
+
+   return true;
+}
+
+
+//-----------------------------------------------------------------------------
+// bool IsOpen()
+//-----------------------------------------------------------------------------
+/**
+ * Tests to see if the binary data file has been opened
+ *
+ * @return true if the file is open, false if not.
+ */
+//-----------------------------------------------------------------------------
+bool BinaryObType::IsOpen()
+{
+   return isWriting || (mapping != NULL);
+}
+
+
+//-----------------------------------------------------------------------------
+// bool AddMeasurement(MeasurementData *md)
+//-----------------------------------------------------------------------------
+/**
+ * Adds a new measurement to the binary data file
+ *
+ * The record holds the same data that reading the measurement back from a
+ * GMATInternal file produces.
+ *
+ * @param md The measurement data containing the observation.
+ *
+ * @return true on success, false on failure
+ */
+//-----------------------------------------------------------------------------
+bool BinaryObType::AddMeasurement(MeasurementData *md)
+{
+   if (!isWriting)
+      return false;
+
+   ObservationData od;
+   od.epochSystem = md->epochSystem;
+   if (md->epochGT.GetMjd() <= 0.0)
+   {
+      od.epoch = md->epoch;
+      od.epochGT = md->epoch;
+   }
+   else
+   {
+      od.epoch = md->epochGT.GetMjd();
+      od.epochGT = md->epochGT;
+   }
+   od.epochAtEnd = false;
+   od.epochAtIntegrationEnd = false;
+   od.typeName = md->typeName;
+   od.type = md->type;
+   od.unit = GetUnit(md->typeName);
+
+   if (md->type < 9000)
+      od.participantIDs = md->participantIDs;
+   else if (md->participantIDs.size() == 1)
+   {
+      // One participant (GPS Point Solution) is identified by its sensor
+      od.participantIDs.push_back(md->sensorIDs[0]);
+      od.sensorIDs.push_back(md->sensorIDs[0]);
+   }
+   else
+   {
+      od.participantIDs = md->participantIDs;
+      od.sensorIDs.assign(md->participantIDs.size(), "");
+   }
+
+   for (UnsignedInt k = 0; k < md->value.size(); ++k)
+   {
+      if (md->typeName == "DSN_SeqRange")
+         od.value.push_back(GmatMathUtil::Mod(md->value[k], md->rangeModulo));
+      else
+         od.value.push_back(md->value[k]);
+   }
+   od.value_orig = od.value;
+
+   if ((md->typeName == "DSN_TCP") || (md->typeName == "RangeRate"))
+   {
+      od.uplinkBand = md->uplinkBand;
+      od.dopplerCountInterval = md->dopplerCountInterval;
+   }
+   else if (md->typeName == "SN_Doppler")
+   {
+      od.tdrsNode4Freq = md->tdrsNode4Freq;
+      od.tdrsNode4Band = md->tdrsNode4Band;
+      od.tdrsServiceID = md->tdrsServiceID;
+      od.tdrsDataFlag = md->tdrsDataFlag;
+      od.tdrsSMARID = md->tdrsSMARID;
+      od.dopplerCountInterval = md->dopplerCountInterval;
+   }
+   else if (md->typeName == "DSN_SeqRange")
+   {
+      od.uplinkBand = md->uplinkBand;
+      od.uplinkFreqAtRecei = md->uplinkFreqAtRecei;
+      od.rangeModulo = md->rangeModulo;
+   }
+
+   AddObservation(od);
+
+   return true;
+}
+
+
+//-----------------------------------------------------------------------------
+// void AddObservation(const ObservationData &od)
+//-----------------------------------------------------------------------------
+/**
+ * Appends an observation record to the write buffers
+ *
+ * The epochs are stored in the time system of the first record added.
+ *
+ * @param od The observation
+ */
+//-----------------------------------------------------------------------------
+void BinaryObType::AddObservation(const ObservationData &od)
+{
+   if (!isWriting)
+      throw MeasurementException("GMATBinary Data File " + streamName +
+            " is not open for writing\n");
+
+   if (fileEpochSystem == -1)
+      fileEpochSystem = od.epochSystem;
+
+   Real epoch = od.epoch;
+   GmatTime epochGT = od.epochGT;
+   if (od.epochSystem != fileEpochSystem)
+   {
+      epoch = theTimeConverter->ConvertFromTaiMjd(fileEpochSystem,
+            theTimeConverter->ConvertToTaiMjd(od.epochSystem, epoch,
+            GmatTimeConstants::JD_NOV_17_1858),
+            GmatTimeConstants::JD_NOV_17_1858);
+      if (epochGT.GetMjd() > 0.0)
+         epochGT = theTimeConverter->ConvertFromTaiMjd(fileEpochSystem,
+               theTimeConverter->ConvertToTaiMjd(od.epochSystem, epochGT,
+               GmatTimeConstants::JD_NOV_17_1858),
+               GmatTimeConstants::JD_NOV_17_1858);
+   }
+
+   PutValue(columns[EPOCH], epoch);
+   PutValue(columns[EPOCH_DAYS], (std::int64_t)epochGT.GetDays());
+   PutValue(columns[EPOCH_SECONDS], (std::int64_t)epochGT.GetSec());
+   PutValue(columns[EPOCH_FRACTION], epochGT.GetFracSec());
+
+   Integer flags = (od.epochAtEnd ? EPOCH_AT_END : 0) |
+         (od.epochAtIntegrationEnd ? EPOCH_AT_INTEGRATION_END : 0);
+   PutValue(columns[TYPE], (Integer)od.type);
+   PutValue(columns[TYPE_NAME], InternString(od.typeName));
+   PutValue(columns[DATA_FORMAT], InternString(od.dataFormat));
+   PutValue(columns[UNIT], InternString(od.unit));
+   PutValue(columns[EPOCH_FLAGS], flags);
+
+   PutValue(columns[UPLINK_BAND], od.uplinkBand);
+   PutValue(columns[UPLINK_FREQUENCY], od.uplinkFreqAtRecei);
+   PutValue(columns[RANGE_MODULO], od.rangeModulo);
+   PutValue(columns[DOPPLER_INTERVAL], od.dopplerCountInterval);
+   PutValue(columns[TDRS_SERVICE_ID], InternString(od.tdrsServiceID));
+   PutValue(columns[TDRS_NODE4_FREQUENCY], od.tdrsNode4Freq);
+   PutValue(columns[TDRS_NODE4_BAND], od.tdrsNode4Band);
+   PutValue(columns[TDRS_SMAR_ID], od.tdrsSMARID);
+   PutValue(columns[TDRS_DATA_FLAG], od.tdrsDataFlag);
+
+   PutStringList(PARTICIPANT_START, PARTICIPANTS, od.participantIDs);
+   PutStringList(SENSOR_START, SENSORS, od.sensorIDs);
+   PutStringList(DATA_MAP_START, DATA_MAP, od.dataMap);
+   PutRealList(VALUE_START, VALUES, od.value);
+   PutRealList(VALUE_ORIG_START, VALUE_ORIGS, od.value_orig);
+
+   for (UnsignedInt i = 0; i < od.strands.size(); ++i)
+   {
+      for (UnsignedInt j = 0; j < od.strands[i].size(); ++j)
+         PutValue(columns[STRANDS], InternString(od.strands[i][j]));
+      PutValue(columns[STRANDS], (Integer)-1);
+   }
+   PutValue(columns[STRAND_START],
+         (std::uint64_t)(columns[STRANDS].size() / sizeof(Integer)));
+
+   ++recordCount;
+}
+
+
+//-----------------------------------------------------------------------------
+// ObservationData* ReadObservation()
+//-----------------------------------------------------------------------------
+/**
+ * Retrieves an observation record
+ *
+ * The record is copied from the mapped columns; no text is parsed.  When a
+ * time window is set, the blocks of the epoch index that fall outside of the
+ * window are skipped.
+ *
+ * @return The observation data from the file.  If there is no more data in
+ * the file, a NULL pointer is returned.
+ */
+//-----------------------------------------------------------------------------
+ObservationData* BinaryObType::ReadObservation()
+{
+   if (mapping == NULL)
+      return NULL;
+
+   const Real *epochs = GetColumn<Real>(EPOCH);
+   const Real *blockFirst = GetColumn<Real>(BLOCK_FIRST_EPOCH);
+   const Real *blockLast = GetColumn<Real>(BLOCK_LAST_EPOCH);
+
+   while (nextRecord < recordCount)
+   {
+      Integer index = nextRecord;
+
+      if (hasTimeWindow)
+      {
+         Integer block = index / blockSize;
+         if ((index % blockSize == 0) &&
+             ((blockLast[block] < fileWindowStart) ||
+              (blockFirst[block] > fileWindowEnd)))
+         {
+            Integer blockEnd = std::min((block + 1) * blockSize, recordCount);
+            skippedCount += blockEnd - index;
+            nextRecord = blockEnd;
+            continue;
+         }
+      }
+      ++nextRecord;
+
+      GmatEpoch epoch = epochs[index];
+      if (fileEpochSystem != currentObs.epochSystem)
+         epoch = theTimeConverter->ConvertFromTaiMjd(currentObs.epochSystem,
+               theTimeConverter->ConvertToTaiMjd(fileEpochSystem, epoch,
+               GmatTimeConstants::JD_NOV_17_1858),
+               GmatTimeConstants::JD_NOV_17_1858);
+
+      if (hasTimeWindow && ((epoch < windowStart) || (epoch > windowEnd)))
+      {
+         ++skippedCount;
+         continue;
+      }
+
+      currentObs.Clear();
+      currentObs.epoch = epoch;
+
+      GmatTime epochGT;
+      epochGT.SetDays((long)GetColumn<std::int64_t>(EPOCH_DAYS)[index]);
+      epochGT.SetSec((long)GetColumn<std::int64_t>(EPOCH_SECONDS)[index]);
+      epochGT.SetFracSec(GetColumn<Real>(EPOCH_FRACTION)[index]);
+      if ((fileEpochSystem != currentObs.epochSystem) &&
+          (epochGT.GetMjd() > 0.0))
+         epochGT = theTimeConverter->ConvertFromTaiMjd(currentObs.epochSystem,
+               theTimeConverter->ConvertToTaiMjd(fileEpochSystem, epochGT,
+               GmatTimeConstants::JD_NOV_17_1858),
+               GmatTimeConstants::JD_NOV_17_1858);
+      currentObs.epochGT = epochGT;
+
+      Integer typeIndex = GetColumn<Integer>(TYPE_NAME)[index];
+      currentObs.typeName = GetString(typeIndex);
+      if (!typeChecked[typeIndex])
+      {
+         // Verify measurement type
+         if (!currentObs.IsValidMeasurementType(currentObs.typeName))
+            throw MeasurementException("Error: GMAT cannot handle "
+                  "observation data with type '" + currentObs.typeName +
+                  "'.\n");
+         typeChecked[typeIndex] = 1;
+      }
+      currentObs.type = GetColumn<Integer>(TYPE)[index];
+      currentObs.dataFormat = GetString(GetColumn<Integer>(DATA_FORMAT)[index]);
+      currentObs.unit = GetString(GetColumn<Integer>(UNIT)[index]);
+
+      Integer flags = GetColumn<Integer>(EPOCH_FLAGS)[index];
+      currentObs.epochAtEnd = ((flags & EPOCH_AT_END) != 0);
+      currentObs.epochAtIntegrationEnd =
+            ((flags & EPOCH_AT_INTEGRATION_END) != 0);
+
+      currentObs.uplinkBand = GetColumn<Integer>(UPLINK_BAND)[index];
+      currentObs.uplinkFreqAtRecei = GetColumn<Real>(UPLINK_FREQUENCY)[index];
+      currentObs.rangeModulo = GetColumn<Real>(RANGE_MODULO)[index];
+      currentObs.dopplerCountInterval =
+            GetColumn<Real>(DOPPLER_INTERVAL)[index];
+      currentObs.tdrsServiceID =
+            GetString(GetColumn<Integer>(TDRS_SERVICE_ID)[index]);
+      currentObs.tdrsNode4Freq = GetColumn<Real>(TDRS_NODE4_FREQUENCY)[index];
+      currentObs.tdrsNode4Band = GetColumn<Integer>(TDRS_NODE4_BAND)[index];
+      currentObs.tdrsSMARID = GetColumn<Integer>(TDRS_SMAR_ID)[index];
+      currentObs.tdrsDataFlag = GetColumn<Integer>(TDRS_DATA_FLAG)[index];
+
+      GetStringList(PARTICIPANT_START, PARTICIPANTS, index,
+            currentObs.participantIDs);
+      GetStringList(SENSOR_START, SENSORS, index, currentObs.sensorIDs);
+      GetStringList(DATA_MAP_START, DATA_MAP, index, currentObs.dataMap);
+      GetRealList(VALUE_START, VALUES, index, currentObs.value);
+      GetRealList(VALUE_ORIG_START, VALUE_ORIGS, index, currentObs.value_orig);
+
+      const std::uint64_t *start = GetColumn<std::uint64_t>(STRAND_START);
+      const Integer *entries = GetColumn<Integer>(STRANDS);
+      if ((start[index] > start[index + 1]) ||
+          (start[index + 1] > columnSize[STRANDS] / sizeof(Integer)))
+         throw MeasurementException("GMATBinary Data File " + streamName +
+               " is corrupt\n");
+      StringArray strand;
+      for (std::uint64_t i = start[index]; i < start[index + 1]; ++i)
+      {
+         if (entries[i] == -1)
+         {
+            currentObs.strands.push_back(strand);
+            strand.clear();
+         }
+         else
+            strand.push_back(GetString(entries[i]));
+      }
+
+      #ifdef DEBUG_FILE_READ
+         MessageInterface::ShowMessage("BinaryObType::ReadObservation(): "
+               "record %d, %.12lf    %s    %d\n", index, currentObs.epoch,
+               currentObs.typeName.c_str(), currentObs.type);
+      #endif
+
+      return &currentObs;
+   }
+
+   return NULL;
+}
+
+
+//-----------------------------------------------------------------------------
+// bool Close()
+//-----------------------------------------------------------------------------
+/**
+ * Closes the file, writing the buffered records if it was open for writing
+ *
+ * @return true on success, false on failure
+ */
+//-----------------------------------------------------------------------------
+bool BinaryObType::Close()
+{
+   bool retval = false;
+
+   if (isWriting)
+   {
+      retval = WriteFile();
+      isWriting = false;
+      ResetColumns();
+   }
+   else if (mapping != NULL)
+   {
+      ReleaseFile();
+      retval = true;
+   }
+
+   return retval;
+}
+
+
+//-----------------------------------------------------------------------------
+// bool Finalize()
+//-----------------------------------------------------------------------------
+/**
+ * Completes operations on this BinaryObType.
+ *
+ * @return true always -- there is no BinaryObType specific finalization needed.
+ */
+//-----------------------------------------------------------------------------
+bool BinaryObType::Finalize()
+{
+   return true;
+}
+
+
+//-----------------------------------------------------------------------------
+// void SetTimeWindow(GmatEpoch start, GmatEpoch end)
+//-----------------------------------------------------------------------------
+/**
+ * Restricts the records returned by ReadObservation() to a time span
+ *
+ * @param start The start of the window, in the time system of the
+ *              observations (A1 modified Julian by default)
+ * @param end   The end of the window
+ */
+//-----------------------------------------------------------------------------
+void BinaryObType::SetTimeWindow(GmatEpoch start, GmatEpoch end)
+{
+   hasTimeWindow = true;
+   windowStart = start;
+   windowEnd = end;
+
+   if (mapping != NULL)
+      SetFileWindow();
+}
+
+
+//-----------------------------------------------------------------------------
+// void ClearTimeWindow()
+//-----------------------------------------------------------------------------
+/**
+ * Removes the time window restriction
+ */
+//-----------------------------------------------------------------------------
+void BinaryObType::ClearTimeWindow()
+{
+   hasTimeWindow = false;
+}
+
+
+//-----------------------------------------------------------------------------
+// Integer GetRecordCount() const
+//-----------------------------------------------------------------------------
+/**
+ * Returns the number of records in the open file
+ */
+//-----------------------------------------------------------------------------
+Integer BinaryObType::GetRecordCount() const
+{
+   return recordCount;
+}
+
+
+//-----------------------------------------------------------------------------
+// Integer GetSkippedCount() const
+//-----------------------------------------------------------------------------
+/**
+ * Returns the number of records passed over by the time window since the
+ * file was opened
+ */
+//-----------------------------------------------------------------------------
+Integer BinaryObType::GetSkippedCount() const
+{
+   return skippedCount;
+}
+
+
+//-----------------------------------------------------------------------------
+// Integer Convert(ObType *source, const std::string &binaryFile)
+//-----------------------------------------------------------------------------
+/**
+ * Writes all of the observations in a data stream to a binary file
+ *
+ * The records read back from the binary file match the records read from
+ * the source stream.
+ *
+ * @param source     The stream to convert, e.g. a GmatObType or a TdmObType
+ *                   with its stream name set
+ * @param binaryFile The binary file to write
+ *
+ * @return The number of records written
+ */
+//-----------------------------------------------------------------------------
+Integer BinaryObType::Convert(ObType *source, const std::string &binaryFile)
+{
+   BinaryObType target;
+   target.SetStreamName(binaryFile);
+   target.Open(false, true);
+
+   if (!source->IsOpen())
+      source->Open(true, false);
+
+   ObservationData *od;
+   while ((od = source->ReadObservation()) != NULL)
+      target.AddObservation(*od);
+
+   Integer count = target.GetRecordCount();
+   if (!target.Close())
+      throw MeasurementException("GMATBinary Data File " + binaryFile +
+            " could not be written\n");
+
+   return count;
+}
+
+
+//-----------------------------------------------------------------------------
+// void ResetColumns()
+//-----------------------------------------------------------------------------
+/**
+ * Empties the write buffers and the string table
+ */
+//-----------------------------------------------------------------------------
+void BinaryObType::ResetColumns()
+{
+   columns.assign(COLUMN_COUNT, std::vector<char>());
+   stringIndex.clear();
+   strings.clear();
+   recordCount = 0;
+
+   // The list offsets start with the offset of the first record
+   Integer starts[] = {PARTICIPANT_START, SENSOR_START, STRAND_START,
+         DATA_MAP_START, VALUE_START, VALUE_ORIG_START};
+   for (UnsignedInt i = 0; i < 6; ++i)
+      PutValue(columns[starts[i]], (std::uint64_t)0);
+}
+
+
+//-----------------------------------------------------------------------------
+// Integer InternString(const std::string &str)
+//-----------------------------------------------------------------------------
+/**
+ * Returns the index of a string in the string table, adding it if needed
+ */
+//-----------------------------------------------------------------------------
+Integer BinaryObType::InternString(const std::string &str)
+{
+   std::map<std::string, Integer>::iterator i = stringIndex.find(str);
+   if (i != stringIndex.end())
+      return i->second;
+
+   Integer index = strings.size();
+   strings.push_back(str);
+   stringIndex[str] = index;
+   return index;
+}
+
+
+//-----------------------------------------------------------------------------
+// void PutStringList(Integer startColumn, Integer poolColumn,
+//                    const StringArray &list)
+//-----------------------------------------------------------------------------
+/**
+ * Appends a list of strings to a pool column
+ */
+//-----------------------------------------------------------------------------
+void BinaryObType::PutStringList(Integer startColumn, Integer poolColumn,
+      const StringArray &list)
+{
+   for (UnsignedInt i = 0; i < list.size(); ++i)
+      PutValue(columns[poolColumn], InternString(list[i]));
+   PutValue(columns[startColumn],
+         (std::uint64_t)(columns[poolColumn].size() / sizeof(Integer)));
+}
+
+
+//-----------------------------------------------------------------------------
+// void PutRealList(Integer startColumn, Integer poolColumn,
+//                  const RealArray &list)
+//-----------------------------------------------------------------------------
+/**
+ * Appends a list of Reals to a pool column
+ */
+//-----------------------------------------------------------------------------
+void BinaryObType::PutRealList(Integer startColumn, Integer poolColumn,
+      const RealArray &list)
+{
+   if (!list.empty())
+   {
+      const char *bytes = reinterpret_cast<const char*>(&list[0]);
+      columns[poolColumn].insert(columns[poolColumn].end(), bytes,
+            bytes + list.size() * sizeof(Real));
+   }
+   PutValue(columns[startColumn],
+         (std::uint64_t)(columns[poolColumn].size() / sizeof(Real)));
+}
+
+
+//-----------------------------------------------------------------------------
+// bool WriteFile()
+//-----------------------------------------------------------------------------
+/**
+ * Builds the string table and the epoch index, and writes the file
+ *
+ * @return true if the file was written
+ */
+//-----------------------------------------------------------------------------
+bool BinaryObType::WriteFile()
+{
+   const Real *epochs = reinterpret_cast<const Real*>(
+         columns[EPOCH].empty() ? NULL : &columns[EPOCH][0]);
+   Integer blockCount = (recordCount + blockSize - 1) / blockSize;
+   for (Integer block = 0; block < blockCount; ++block)
+   {
+      Integer last = std::min((block + 1) * blockSize, recordCount);
+      Real first = epochs[block * blockSize], lastEpoch = first;
+      for (Integer i = block * blockSize + 1; i < last; ++i)
+      {
+         first = std::min(first, epochs[i]);
+         lastEpoch = std::max(lastEpoch, epochs[i]);
+      }
+      PutValue(columns[BLOCK_FIRST_EPOCH], first);
+      PutValue(columns[BLOCK_LAST_EPOCH], lastEpoch);
+   }
+
+   std::uint64_t offset = 0;
+   PutValue(columns[STRING_OFFSETS], offset);
+   for (UnsignedInt i = 0; i < strings.size(); ++i)
+   {
+      columns[STRING_CHARS].insert(columns[STRING_CHARS].end(),
+            strings[i].begin(), strings[i].end());
+      offset += strings[i].size();
+      PutValue(columns[STRING_OFFSETS], offset);
+   }
+
+   FileHeader header;
+   memset(&header, 0, sizeof(header));
+   memcpy(header.magic, FILE_MAGIC, sizeof(FILE_MAGIC));
+   header.byteOrder = BYTE_ORDER_MARK;
+   header.version = FILE_VERSION;
+   header.epochSystem = (fileEpochSystem == -1 ? TimeSystemConverter::A1MJD :
+         fileEpochSystem);
+   header.columnCount = COLUMN_COUNT;
+   header.recordCount = recordCount;
+   header.stringCount = strings.size();
+   header.blockSize = blockSize;
+   header.blockCount = blockCount;
+
+   SectionEntry sections[COLUMN_COUNT];
+   offset = sizeof(FileHeader) + sizeof(sections);
+   for (Integer i = 0; i < COLUMN_COUNT; ++i)
+   {
+      offset = (offset + 7) & ~(std::uint64_t)7;
+      sections[i].offset = offset;
+      sections[i].size = columns[i].size();
+      offset += columns[i].size();
+   }
+
+   std::ofstream out(fullPath.c_str(), std::ios::binary | std::ios::trunc);
+   if (!out)
+      return false;
+
+   const char padding[8] = {0, 0, 0, 0, 0, 0, 0, 0};
+   out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+   out.write(reinterpret_cast<const char*>(sections), sizeof(sections));
+   offset = sizeof(FileHeader) + sizeof(sections);
+   for (Integer i = 0; i < COLUMN_COUNT; ++i)
+   {
+      out.write(padding, sections[i].offset - offset);
+      if (!columns[i].empty())
+         out.write(&columns[i][0], columns[i].size());
+      offset = sections[i].offset + sections[i].size;
+   }
+   out.close();
+
+   #ifdef DEBUG_FILE_ACCESS
+      MessageInterface::ShowMessage("BinaryObType: wrote %d records, %d "
+            "strings and %d index blocks to %s\n", recordCount,
+            (Integer)strings.size(), blockCount, fullPath.c_str());
+   #endif
+
+   return !out.fail();
+}
+
+
+//-----------------------------------------------------------------------------
+// void MapFile()
+//-----------------------------------------------------------------------------
+/**
+ * Maps the file into memory, validates its layout and loads the string table
+ */
+//-----------------------------------------------------------------------------
+void BinaryObType::MapFile()
+{
+   mapping = MemoryMappedFile::Open(fullPath);
+   if (mapping == NULL)
+      throw MeasurementException("GMATBinary Data File " + streamName +
+            " could not be opened\n");
+
+   const char *data = mapping->GetData();
+   size_t size = mapping->GetSize();
+   std::string corrupt = "GMATBinary Data File " + streamName +
+         " is not a valid binary observation file\n";
+
+   FileHeader header;
+   if (size < sizeof(FileHeader) + COLUMN_COUNT * sizeof(SectionEntry))
+   {
+      ReleaseFile();
+      throw MeasurementException(corrupt);
+   }
+   memcpy(&header, data, sizeof(header));
+   if ((memcmp(header.magic, FILE_MAGIC, sizeof(FILE_MAGIC)) != 0) ||
+       (header.version != FILE_VERSION) ||
+       (header.columnCount != COLUMN_COUNT) || (header.blockSize == 0) ||
+       (header.recordCount >
+        (std::uint64_t)std::numeric_limits<Integer>::max()))
+   {
+      ReleaseFile();
+      throw MeasurementException(corrupt);
+   }
+   if (header.byteOrder != BYTE_ORDER_MARK)
+   {
+      ReleaseFile();
+      throw MeasurementException("GMATBinary Data File " + streamName +
+            " was written on a machine with a different byte order\n");
+   }
+
+   recordCount = (Integer)header.recordCount;
+   blockSize = (Integer)header.blockSize;
+   fileEpochSystem = header.epochSystem;
+   nextRecord = 0;
+   skippedCount = 0;
+
+   const SectionEntry *sections =
+         reinterpret_cast<const SectionEntry*>(data + sizeof(FileHeader));
+   for (Integer i = 0; i < COLUMN_COUNT; ++i)
+   {
+      std::uint64_t entries = sections[i].size / GetElementSize(i);
+      std::uint64_t expected = entries;
+      if ((i >= EPOCH) && (i <= TDRS_DATA_FLAG))
+         expected = header.recordCount;
+      else if ((i == PARTICIPANT_START) || (i == SENSOR_START) ||
+               (i == STRAND_START) || (i == DATA_MAP_START) ||
+               (i == VALUE_START) || (i == VALUE_ORIG_START))
+         expected = header.recordCount + 1;
+      else if (i == STRING_OFFSETS)
+         expected = header.stringCount + 1;
+      else if ((i == BLOCK_FIRST_EPOCH) || (i == BLOCK_LAST_EPOCH))
+         expected = header.blockCount;
+
+      if ((sections[i].offset % 8 != 0) || (sections[i].offset > size) ||
+          (sections[i].size > size - sections[i].offset) ||
+          (sections[i].size % GetElementSize(i) != 0) ||
+          (entries != expected))
+      {
+         ReleaseFile();
+         throw MeasurementException(corrupt);
+      }
+      columnData[i] = data + sections[i].offset;
+      columnSize[i] = sections[i].size;
+   }
+
+   if (header.blockCount !=
+       (header.recordCount + header.blockSize - 1) / header.blockSize)
+   {
+      ReleaseFile();
+      throw MeasurementException(corrupt);
+   }
+
+   // The string table is the only data converted when the file is opened
+   const std::uint64_t *offsets = GetColumn<std::uint64_t>(STRING_OFFSETS);
+   const char *chars = columnData[STRING_CHARS];
+   strings.clear();
+   strings.reserve(header.stringCount);
+   for (std::uint64_t i = 0; i < header.stringCount; ++i)
+   {
+      if ((offsets[i] > offsets[i + 1]) ||
+          (offsets[i + 1] > columnSize[STRING_CHARS]))
+      {
+         ReleaseFile();
+         throw MeasurementException(corrupt);
+      }
+      strings.push_back(std::string(chars + offsets[i],
+            offsets[i + 1] - offsets[i]));
+   }
+   typeChecked.assign(strings.size(), 0);
+
+   if (hasTimeWindow)
+      SetFileWindow();
+
+   #ifdef DEBUG_FILE_ACCESS
+      MessageInterface::ShowMessage("BinaryObType: mapped %s, %d records\n",
+            fullPath.c_str(), recordCount);
+   #endif
+}
+
+
+//-----------------------------------------------------------------------------
+// void ReleaseFile()
+//-----------------------------------------------------------------------------
+/**
+ * Releases the mapping of the file
+ */
+//-----------------------------------------------------------------------------
+void BinaryObType::ReleaseFile()
+{
+   if (mapping != NULL)
+      MemoryMappedFile::Release(mapping);
+   mapping = NULL;
+   for (Integer i = 0; i < COLUMN_COUNT; ++i)
+   {
+      columnData[i] = NULL;
+      columnSize[i] = 0;
+   }
+   strings.clear();
+   typeChecked.clear();
+   recordCount = 0;
+   nextRecord = 0;
+   skippedCount = 0;
+}
+
+
+//-----------------------------------------------------------------------------
+// void SetFileWindow()
+//-----------------------------------------------------------------------------
+/**
+ * Converts the time window to the time system of the file
+ *
+ * The converted bounds are widened slightly; they are only used to skip the
+ * blocks of the epoch index, and each record is still tested against the
+ * requested window.
+ */
+//-----------------------------------------------------------------------------
+void BinaryObType::SetFileWindow()
+{
+   fileWindowStart = windowStart;
+   fileWindowEnd = windowEnd;
+   if (fileEpochSystem != currentObs.epochSystem)
+   {
+      fileWindowStart = theTimeConverter->ConvertFromTaiMjd(fileEpochSystem,
+            theTimeConverter->ConvertToTaiMjd(currentObs.epochSystem,
+            windowStart, GmatTimeConstants::JD_NOV_17_1858),
+            GmatTimeConstants::JD_NOV_17_1858);
+      fileWindowEnd = theTimeConverter->ConvertFromTaiMjd(fileEpochSystem,
+            theTimeConverter->ConvertToTaiMjd(currentObs.epochSystem,
+            windowEnd, GmatTimeConstants::JD_NOV_17_1858),
+            GmatTimeConstants::JD_NOV_17_1858);
+   }
+   fileWindowStart -= WINDOW_MARGIN;
+   fileWindowEnd += WINDOW_MARGIN;
+}
+
+
+//-----------------------------------------------------------------------------
+// size_t GetElementSize(Integer column)
+//-----------------------------------------------------------------------------
+/**
+ * Returns the size of the entries of a section, in bytes
+ */
+//-----------------------------------------------------------------------------
+size_t BinaryObType::GetElementSize(Integer column)
+{
+   switch (column)
+   {
+      case STRING_CHARS:
+         return 1;
+      case TYPE:
+      case TYPE_NAME:
+      case DATA_FORMAT:
+      case UNIT:
+      case EPOCH_FLAGS:
+      case UPLINK_BAND:
+      case TDRS_SERVICE_ID:
+      case TDRS_NODE4_BAND:
+      case TDRS_SMAR_ID:
+      case TDRS_DATA_FLAG:
+      case PARTICIPANTS:
+      case SENSORS:
+      case STRANDS:
+      case DATA_MAP:
+         return sizeof(Integer);
+      default:
+         return 8;
+   }
+}
+
+
+//-----------------------------------------------------------------------------
+// const std::string& GetString(Integer index)
+//-----------------------------------------------------------------------------
+/**
+ * Returns an entry of the string table
+ */
+//-----------------------------------------------------------------------------
+const std::string& BinaryObType::GetString(Integer index)
+{
+   if ((index < 0) || (index >= (Integer)strings.size()))
+      throw MeasurementException("GMATBinary Data File " + streamName +
+            " is corrupt\n");
+   return strings[index];
+}
+
+
+//-----------------------------------------------------------------------------
+// void GetStringList(Integer startColumn, Integer poolColumn, Integer record,
+//                    StringArray &list)
+//-----------------------------------------------------------------------------
+/**
+ * Reads the list of strings of a record from a pool column
+ */
+//-----------------------------------------------------------------------------
+void BinaryObType::GetStringList(Integer startColumn, Integer poolColumn,
+      Integer record, StringArray &list)
+{
+   const std::uint64_t *start = GetColumn<std::uint64_t>(startColumn);
+   const Integer *pool = GetColumn<Integer>(poolColumn);
+   if ((start[record] > start[record + 1]) ||
+       (start[record + 1] > columnSize[poolColumn] / sizeof(Integer)))
+      throw MeasurementException("GMATBinary Data File " + streamName +
+            " is corrupt\n");
+
+   list.clear();
+   for (std::uint64_t i = start[record]; i < start[record + 1]; ++i)
+      list.push_back(GetString(pool[i]));
+}
+
+
+//-----------------------------------------------------------------------------
+// void GetRealList(Integer startColumn, Integer poolColumn, Integer record,
+//                  RealArray &list)
+//-----------------------------------------------------------------------------
+/**
+ * Reads the list of Reals of a record from a pool column
+ */
+//-----------------------------------------------------------------------------
+void BinaryObType::GetRealList(Integer startColumn, Integer poolColumn,
+      Integer record, RealArray &list)
+{
+   const std::uint64_t *start = GetColumn<std::uint64_t>(startColumn);
+   const Real *pool = GetColumn<Real>(poolColumn);
+   if ((start[record] > start[record + 1]) ||
+       (start[record + 1] > columnSize[poolColumn] / sizeof(Real)))
+      throw MeasurementException("GMATBinary Data File " + streamName +
+            " is corrupt\n");
+
+   list.assign(pool + start[record], pool + start[record + 1]);
+}
@@ -0,0 +1,213 @@
+//$Id$
+//------------------------------------------------------------------------------
+//                         BinaryObType
+//------------------------------------------------------------------------------
+// GMAT: General Mission Analysis Tool
+//
+// Copyright (c) 2002 - 2020 United States Government as represented by the
+// Administrator of The National Aeronautics and Space Administration.
+// All Other Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// You may not use this file except in compliance with the License.
+// You may obtain a copy of the License at:
+// http://www.apache.org/licenses/LICENSE-2.0.
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied.   See the License for the specific language
+// governing permissions and limitations under the License.
+//
+// Author: GMAT Development Team
+// Created: 2026/10/17
+//
+/**
+ * ObType class used for the GMAT binary, columnar observation data
+ */
+//------------------------------------------------------------------------------
+
+
+#ifndef BinaryObType_hpp
+#define BinaryObType_hpp
+
+#include "estimation_defs.hpp"
+#include "ObType.hpp"
+#include <map>
+
+class MemoryMappedFile;
+
+/**
+ * BinaryObType reads and writes observation data in a binary, columnar file
+ * (extension .gmb).
+ *
+ * Each field of ObservationData is stored as a column of fixed size values;
+ * variable length fields (participants, values, strands, ...) are stored as
+ * a pool of entries plus an offset column, and all strings are kept once in a
+ * string table.  Files are read through a memory mapping, so loading a file
+ * does no parsing: a record is copied from the columns into the observation
+ * when it is read.  The epochs are summarized per block of records, so that
+ * reads restricted to a time window skip the blocks outside of it.
+ *
+ * Records written through AddMeasurement() are buffered and the file is
+ * written when the stream is closed; a simulator writes a binary file when
+ * its tracking file set names a .gmb file.  Convert() builds a binary file
+ * from any other observation stream, e.g. a GMATInternal or a TDM file.  It
+ * is a programming interface; scripts have no command that calls it.
+ */
+class ESTIMATION_API BinaryObType : public ObType
+{
+public:
+   BinaryObType(const std::string withName = "");
+   virtual ~BinaryObType();
+   BinaryObType(const BinaryObType& ot);
+   BinaryObType& operator=(const BinaryObType& ot);
+
+   GmatBase*         Clone() const;
+
+   virtual bool      Initialize();
+   virtual bool      Open(bool forRead = true, bool forWrite= false,
+                          bool append = false);
+   virtual bool      IsOpen();
+   virtual bool      AddMeasurement(MeasurementData *md);
+   virtual ObservationData *
+                     ReadObservation();
+
+   /// BinaryObType does not use ReadRampTableData() function
+   virtual RampTableData *
+                     ReadRampTableData() {return NULL;};
+
+   virtual bool      Close();
+   virtual bool      Finalize();
+
+   void              AddObservation(const ObservationData &od);
+   void              SetTimeWindow(GmatEpoch start, GmatEpoch end);
+   void              ClearTimeWindow();
+   Integer           GetRecordCount() const;
+   Integer           GetSkippedCount() const;
+
+   static Integer    Convert(ObType *source, const std::string &binaryFile);
+
+   /// File extension used for binary observation files
+   static const std::string FILE_EXTENSION;
+
+private:
+   /// Identifiers for the sections of the file
+   enum Column
+   {
+      STRING_OFFSETS = 0,
+      STRING_CHARS,
+      EPOCH,
+      EPOCH_DAYS,
+      EPOCH_SECONDS,
+      EPOCH_FRACTION,
+      TYPE,
+      TYPE_NAME,
+      DATA_FORMAT,
+      UNIT,
+      EPOCH_FLAGS,
+      UPLINK_BAND,
+      UPLINK_FREQUENCY,
+      RANGE_MODULO,
+      DOPPLER_INTERVAL,
+      TDRS_SERVICE_ID,
+      TDRS_NODE4_FREQUENCY,
+      TDRS_NODE4_BAND,
+      TDRS_SMAR_ID,
+      TDRS_DATA_FLAG,
+      PARTICIPANT_START,
+      PARTICIPANTS,
+      SENSOR_START,
+      SENSORS,
+      STRAND_START,
+      STRANDS,
+      DATA_MAP_START,
+      DATA_MAP,
+      VALUE_START,
+      VALUES,
+      VALUE_ORIG_START,
+      VALUE_ORIGS,
+      BLOCK_FIRST_EPOCH,
+      BLOCK_LAST_EPOCH,
+      COLUMN_COUNT
+   };
+
+   /// Full path of the file
+   std::string       fullPath;
+   /// Flag indicating that records are being buffered for writing
+   bool              isWriting;
+   /// The time system of the epochs in the file
+   Integer           fileEpochSystem;
+   /// Number of records in the file or in the write buffers
+   Integer           recordCount;
+   /// Number of records summarized by each entry of the epoch index
+   Integer           blockSize;
+   /// Index of the next record returned by ReadObservation()
+   Integer           nextRecord;
+   /// Number of records passed over by the time window
+   Integer           skippedCount;
+
+   /// Column data being written
+   std::vector<std::vector<char> >
+                     columns;
+   /// Indices of the strings in the string table, used while writing
+   std::map<std::string, Integer>
+                     stringIndex;
+   /// The string table
+   StringArray       strings;
+   /// Flags marking measurement type names that have been validated
+   std::vector<char> typeChecked;
+
+   /// The mapped file
+   MemoryMappedFile  *mapping;
+   /// Start of each column in the mapped file
+   const char        *columnData[COLUMN_COUNT];
+   /// Size of each column in the mapped file, in bytes
+   size_t            columnSize[COLUMN_COUNT];
+
+   /// Flag indicating that reads are restricted to a time window
+   bool              hasTimeWindow;
+   /// Start of the time window, in the time system of the observations
+   GmatEpoch         windowStart;
+   /// End of the time window, in the time system of the observations
+   GmatEpoch         windowEnd;
+   /// The time window bounds in the time system of the file
+   GmatEpoch         fileWindowStart;
+   GmatEpoch         fileWindowEnd;
+
+   /// The most recently accessed observation data set
+   ObservationData   currentObs;
+
+   void              ResetColumns();
+   Integer           InternString(const std::string &str);
+   void              PutStringList(Integer startColumn, Integer poolColumn,
+                                   const StringArray &list);
+   void              PutRealList(Integer startColumn, Integer poolColumn,
+                                 const RealArray &list);
+   bool              WriteFile();
+
+   void              MapFile();
+   void              ReleaseFile();
+   void              SetFileWindow();
+   static size_t     GetElementSize(Integer column);
+   const std::string&
+                     GetString(Integer index);
+   void              GetStringList(Integer startColumn, Integer poolColumn,
+                                   Integer record, StringArray &list);
+   void              GetRealList(Integer startColumn, Integer poolColumn,
+                                 Integer record, RealArray &list);
+
+   //---------------------------------------------------------------------------
+   // const T* GetColumn(Integer column) const
+   //---------------------------------------------------------------------------
+   /**
+    * Accesses a column of the mapped file as an array of T
+    */
+   //---------------------------------------------------------------------------
+   template <typename T>
+   const T*          GetColumn(Integer column) const
+   {
+      return reinterpret_cast<const T*>(columnData[column]);
+   }
+};
+
+#endif /* BinaryObType_hpp */
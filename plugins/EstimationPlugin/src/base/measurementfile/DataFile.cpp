@@ -39,6 +39,7 @@
 //#include "StatisticRejectFilter.hpp"             //@todo: StatisticsRejectFilter is deprecated and will be removed in a future GMAT build
 #include "AcceptFilter.hpp"
 #include "RejectFilter.hpp"
+#include "BinaryObType.hpp"
 #include <sstream>
 #include "MeasurementException.hpp"
 
@@ -849,6 +850,15 @@ bool DataFile::OpenStream(bool simulate)
 		         MessageInterface::ShowMessage("DataFile<%p>::OpenStream():   open observation data file '%s' for reading throu stream <%p>\n", this, GetName().c_str(), theDatastream);
             #endif
             retval = theDatastream->Open(true, false);
+
+            // Binary files skip the records outside of the time span without
+            // reading them.  The window is widened so the time span filter
+            // still decides on the records at its edges.  Data thinning
+            // counts every record, so the window is only used without it.
+            if (retval && (obsType == "GMATBinary") && (thinningRatio == 1.0))
+               ((BinaryObType*)theDatastream)->SetTimeWindow(
+                     estimationStart - 2.0 * TIME_EPSILON,
+                     estimationEnd + 2.0 * TIME_EPSILON);
 		   }
 	   }
    }
@@ -856,6 +866,24 @@ bool DataFile::OpenStream(bool simulate)
    return retval;
 }
 
+//------------------------------------------------------------------------------
+// Integer GetSkippedRecordCount()
+//------------------------------------------------------------------------------
+/**
+ * Returns the number of records that the stream passed over without reading
+ * them, because they are outside of the time span
+ *
+ * @return The number of skipped records; 0 for streams other than GMATBinary
+ */
+//------------------------------------------------------------------------------
+Integer DataFile::GetSkippedRecordCount()
+{
+   if (theDatastream && (theDatastream->GetTypeName() == "GMATBinary"))
+      return ((BinaryObType*)theDatastream)->GetSkippedCount();
+
+   return 0;
+}
+
 //------------------------------------------------------------------------------
 // bool IsOpen()
 //------------------------------------------------------------------------------
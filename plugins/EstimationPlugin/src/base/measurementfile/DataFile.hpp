@@ -118,6 +118,7 @@ public:
    virtual bool         CloseStream();
 
    ObservationData*     FilteringData(ObservationData* dataObject, Integer& rejectedReason);
+   Integer              GetSkippedRecordCount();
 
    /// @todo: Check this
    DEFAULT_TO_NO_CLONES
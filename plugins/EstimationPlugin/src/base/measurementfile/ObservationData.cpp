@@ -54,6 +54,8 @@ ObservationData::ObservationData() :
    epochSystem       (TimeSystemConverter::A1MJD),
    epoch             (-1.0),
    epochGT           (-1.0),
+   epochAtEnd        (true),
+   epochAtIntegrationEnd   (true),
    noiseCovariance   (NULL),
 ///// TBD: Determine if there is a more generic way to add these, and if they go here
    unit              ("km"),
@@ -204,6 +206,8 @@ void ObservationData::Clear()
    uniqueID                = -1;
    epoch                   = 0.0;
    epochGT                 = 0.0;
+   epochAtEnd              = true;
+   epochAtIntegrationEnd   = true;
    participantIDs.clear();
    sensorIDs.clear();
    value.clear();
@@ -2217,7 +2217,7 @@ void MeasureModel::RestoreState(std::vector<bool>& precTimeVec, std::vector<Gmat
 }
 
 //------------------------------------------------------------------------------
-// void UseIonosphereCache(SignalDataCache::SimpleSignalDataCache* cache)
+// void UseIonosphereCache(SignalDataCache *cache)
 //------------------------------------------------------------------------------
 /**
  * Passes the ionosphere cache to the signal path
@@ -2226,7 +2226,7 @@ void MeasureModel::RestoreState(std::vector<bool>& precTimeVec, std::vector<Gmat
  *
  */
  //------------------------------------------------------------------------------
-void MeasureModel::UseIonosphereCache(SignalDataCache::SimpleSignalDataCache* cache)
+void MeasureModel::UseIonosphereCache(SignalDataCache *cache)
 {
    for (UnsignedInt i = 0; i < signalPaths.size(); ++i)
    {
@@ -177,7 +177,7 @@ public:
                                      std::vector<GmatTime>& epochGTVec, std::vector<Real>& valsVec);
 
    /// Uses ionosphere cache
-   virtual void         UseIonosphereCache(SignalDataCache::SimpleSignalDataCache* cache);
+   virtual void         UseIonosphereCache(SignalDataCache *cache);
 
 protected:
    /// The ordered list of participants in the signal path
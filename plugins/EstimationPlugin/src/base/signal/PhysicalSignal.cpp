@@ -1302,6 +1302,18 @@ bool PhysicalSignal::GenerateLightTimeData(const GmatTime atEpoch,
                "distance %.3lf km = %le\n", deltaR, deltaT);
       #endif
 
+      // When light time solutions are reused, start from the solution found
+      // for this leg and epoch on the previous pass
+      SignalDataCache::CacheKey lightTimeKey;
+      bool reuseLightTime = ((ionosphereCache != NULL) &&
+                             ionosphereCache->IsLightTimeReused());
+      if (reuseLightTime)
+      {
+         lightTimeKey = SignalDataCache::CacheKey(legId, 0.0,
+               atEpoch.GetMjd(), (epochAtReceive ? 1.0 : 0.0));
+         ionosphereCache->FindLightTime(lightTimeKey, deltaT);
+      }
+
       // Here we go; iterating for a light time solution
       Integer loopCount = 0;
 
@@ -1358,6 +1370,9 @@ bool PhysicalSignal::GenerateLightTimeData(const GmatTime atEpoch,
          #endif
          ++loopCount;
       }
+
+      if (reuseLightTime)
+         ionosphereCache->InsertLightTime(lightTimeKey, deltaT);
    }
 
    // Temporary check on data flow
@@ -2271,22 +2286,20 @@ RealArray PhysicalSignal::MediaCorrection(Real freq, Rvector3 r1B, Rvector3 r2B,
 //   if (elevationAngle > minElevationAngle*GmatMathConstants::RAD_PER_DEG)
    {
       SignalDataCache::CacheKey cacheKey(strandId, freq, epoch1, epoch2);
-      SignalDataCache::SimpleSignalDataCacheIter cachedEntry;
-      bool cacheFound = false;
+      const SignalDataCache::CacheValue *cachedEntry = NULL;
 
       if (ionosphereCache) {
-         cachedEntry = ionosphereCache->find(cacheKey);
-         cacheFound = (cachedEntry != ionosphereCache->end());
+         cachedEntry = ionosphereCache->Find(cacheKey);
       }
 
-      if (cacheFound) {
-         ionoCorrection = cachedEntry->second.ionoCorrection;
+      if (cachedEntry) {
+         ionoCorrection = cachedEntry->GetIonoCorrection();
       }
       else {
          ionoCorrection = IonosphereCorrection(freq, r1B, r2B, epoch1, epoch2);
 
          if (ionosphereCache) {
-            ionosphereCache->insert({ cacheKey, SignalDataCache::CacheValue(theData, ionoCorrection) });
+            ionosphereCache->Insert(cacheKey, SignalDataCache::CacheValue(theData, ionoCorrection));
          }
       }
 
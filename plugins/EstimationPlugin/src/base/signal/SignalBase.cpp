@@ -82,7 +82,9 @@ SignalBase::SignalBase(const std::string &typeStr, const std::string &name) :
    solarSystem          (NULL),
    navLog               (NULL),
    logLevel             (1),
-   ionosphereCache      (NULL)
+   ionosphereCache      (NULL),
+   strandId             (0),
+   legId                (0)
 {
 #ifdef DEBUG_API
    if (!apisbFileOpen)
@@ -175,7 +177,9 @@ SignalBase::SignalBase(const SignalBase& sb) :
    solarSystem          (sb.solarSystem),
    navLog               (sb.navLog),
    logLevel             (sb.logLevel),
-   ionosphereCache      (NULL)
+   ionosphereCache      (NULL),
+   strandId             (sb.strandId),
+   legId                (sb.legId)
 {
    // Clone the list
    if (sb.next)
@@ -232,6 +236,8 @@ SignalBase& SignalBase::operator=(const SignalBase& sb)
       solarSystem         = sb.solarSystem;
       navLog              = sb.navLog;
       logLevel            = sb.logLevel;
+      strandId            = sb.strandId;
+      legId               = sb.legId;
 
       //if (next)                                             // made changes by TUAN NGUYEN
       //{                                                     // made changes by TUAN NGUYEN
@@ -297,6 +303,7 @@ bool SignalBase::SetTransmitParticipantName(std::string name)
 #endif
 
    theData.transmitParticipant = name;
+   UpdateLegId();
    bool retval = false;
    if (name != "")
       retval = true;
@@ -323,6 +330,7 @@ bool SignalBase::SetReceiveParticipantName(std::string name)
 #endif
 
    theData.receiveParticipant = name;
+   UpdateLegId();
    bool retval = false;
    if (name != "")
       retval = true;
@@ -1990,7 +1998,7 @@ void SignalBase::MoveToEpoch(const GmatTime theEpoch, bool epochAtReceive,
 }
 
 //------------------------------------------------------------------------------
-// void SetIonosphereCache(SignalDataCache::SimpleSignalDataCache* cache)
+// void SetIonosphereCache(SignalDataCache *cache)
 //------------------------------------------------------------------------------
 /**
  * Sets the ionosphere cache for the signal
@@ -1998,7 +2006,7 @@ void SignalBase::MoveToEpoch(const GmatTime theEpoch, bool epochAtReceive,
  * @param cache The ionosphere cache
  */
  //------------------------------------------------------------------------------
-void SignalBase::SetIonosphereCache(SignalDataCache::SimpleSignalDataCache * cache)
+void SignalBase::SetIonosphereCache(SignalDataCache *cache)
 {
    // Set it to all signals in the path
    ionosphereCache = cache;
@@ -2020,6 +2028,27 @@ void SignalBase::SetIonosphereCache(SignalDataCache::SimpleSignalDataCache * cac
 void SignalBase::SetStrandId(unsigned long id)
 {
    strandId = id;
+   UpdateLegId();
+}
+
+
+//------------------------------------------------------------------------------
+// void UpdateLegId()
+//------------------------------------------------------------------------------
+/**
+ * Hashes the strand ID and the participants of this leg into the ID used for
+ * the light time cache keys
+ *
+ * The ID is computed when the strand or a participant name changes, so the
+ * light time iterations do not rebuild it at every epoch.
+ */
+ //------------------------------------------------------------------------------
+void SignalBase::UpdateLegId()
+{
+   StringArray leg;
+   leg.push_back(theData.transmitParticipant);
+   leg.push_back(theData.receiveParticipant);
+   legId = strandId * 31 + SignalDataCache::StrandToHash(&leg);
 }
 
 //------------------------------------------------------------------------------
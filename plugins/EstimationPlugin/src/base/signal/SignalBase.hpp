@@ -111,7 +111,7 @@ public:
                                           bool epochAtReceive,
                                           bool moveAll = true);
 
-   void                SetIonosphereCache(SignalDataCache::SimpleSignalDataCache* cache);
+   void                SetIonosphereCache(SignalDataCache *cache);
 
    void                SetStrandId(unsigned long id);
 
@@ -194,10 +194,15 @@ protected:
    UnsignedInt                logLevel;
 
    /// The light time cache 
-   SignalDataCache::SimpleSignalDataCache *ionosphereCache;
+   SignalDataCache *ionosphereCache;
 
    /// The strandID
    unsigned long strandId;
+   /// Hash of the strand and of the participants of this leg, used as the
+   /// strand of the light time cache keys
+   unsigned long legId;
+
+   void                       UpdateLegId();
 
    void                       SetPrevious(SignalBase *prev);
 
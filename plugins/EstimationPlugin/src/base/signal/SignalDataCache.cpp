@@ -21,6 +21,20 @@
 #include "SignalDataCache.hpp"
 #include "SignalData.hpp"
 
+//------------------------------------------------------------------------------
+// CacheKey::CacheKey()
+//------------------------------------------------------------------------------
+/**
+ * Default constructor
+ */
+ //------------------------------------------------------------------------------
+SignalDataCache::CacheKey::CacheKey() :
+   strand(0),
+   freq(0.0),
+   epoch1(0.0),
+   epoch2(0.0)
+{ }
+
 //------------------------------------------------------------------------------
 // CacheKey::CacheKey(unsigned long strandId, Real aFreq, Real time1, Real time2)
 //------------------------------------------------------------------------------
@@ -58,29 +72,70 @@ bool SignalDataCache::CacheKey::operator==(const CacheKey& k) const
 }
 
 
+//------------------------------------------------------------------------------
+// CacheValue::CacheValue()
+//------------------------------------------------------------------------------
+/**
+ * Default constructor
+ */
+ //------------------------------------------------------------------------------
+SignalDataCache::CacheValue::CacheValue()
+{
+   for (Integer i = 0; i < 3; ++i)
+   {
+      tLoc[i] = rLoc[i] = tVel[i] = rVel[i] = ionoCorrection[i] = 0.0;
+   }
+   for (Integer i = 0; i < 6; ++i)
+   {
+      tOStateSSB[i] = rOStateSSB[i] = 0.0;
+   }
+}
+
 //------------------------------------------------------------------------------
 // CacheValue::CacheValue(const SignalData & sd)
 //------------------------------------------------------------------------------
 /**
  * Constructor
  *
+ * The state transition matrices of the signal data are not cached; their size
+ * depends on the participants, and the cached entries are read for their
+ * ionosphere corrections.
+ *
  * @param sd The signal data co build the cache value from
  * @param ic The iono correction for the signal data
  */
  //------------------------------------------------------------------------------
 SignalDataCache::CacheValue::CacheValue(const SignalData & sd, const RealArray & ic) :
    tPrecTime(sd.tPrecTime),
-   rPrecTime(sd.rPrecTime),
-   tLoc(sd.tLoc),
-   rLoc(sd.rLoc),
-   tVel(sd.tVel),
-   rVel(sd.rVel),
-   tSTM(sd.tSTM),
-   rSTM(sd.rSTM),
-   tOStateSSB(sd.tOStateSSB),
-   rOStateSSB(sd.rOStateSSB),
-   ionoCorrection(ic)
+   rPrecTime(sd.rPrecTime)
 {
+   for (Integer i = 0; i < 3; ++i)
+   {
+      tLoc[i] = sd.tLoc[i];
+      rLoc[i] = sd.rLoc[i];
+      tVel[i] = sd.tVel[i];
+      rVel[i] = sd.rVel[i];
+      ionoCorrection[i] = (i < (Integer)ic.size() ? ic[i] : 0.0);
+   }
+   for (Integer i = 0; i < 6; ++i)
+   {
+      tOStateSSB[i] = sd.tOStateSSB[i];
+      rOStateSSB[i] = sd.rOStateSSB[i];
+   }
+}
+
+//------------------------------------------------------------------------------
+// RealArray CacheValue::GetIonoCorrection() const
+//------------------------------------------------------------------------------
+/**
+ * Retrieves the ionosphere correction in the form used by the signals
+ *
+ * @return The range (m), elevation (rad) and time (s) corrections
+ */
+ //------------------------------------------------------------------------------
+RealArray SignalDataCache::CacheValue::GetIonoCorrection() const
+{
+   return RealArray(ionoCorrection, ionoCorrection + 3);
 }
 
 // 
@@ -120,3 +175,297 @@ unsigned long SignalDataCache::StrandToHash(const StringArray* participants)
    }
    return hash;
 }
+
+
+//------------------------------------------------------------------------------
+// Statistics::Statistics()
+//------------------------------------------------------------------------------
+/**
+ * Constructor
+ */
+ //------------------------------------------------------------------------------
+SignalDataCache::Statistics::Statistics() :
+   hits(0),
+   misses(0),
+   evictions(0),
+   size(0)
+{
+}
+
+//------------------------------------------------------------------------------
+// Statistics& Statistics::operator+=(const Statistics &st)
+//------------------------------------------------------------------------------
+/**
+ * Adds the counts of another table
+ *
+ * @param st The counts to add
+ *
+ * @return This set of counts
+ */
+ //------------------------------------------------------------------------------
+SignalDataCache::Statistics& SignalDataCache::Statistics::operator+=(
+      const Statistics &st)
+{
+   hits      += st.hits;
+   misses    += st.misses;
+   evictions += st.evictions;
+   size      += st.size;
+   return *this;
+}
+
+//------------------------------------------------------------------------------
+// SignalDataCache()
+//------------------------------------------------------------------------------
+/**
+ * Constructor
+ */
+ //------------------------------------------------------------------------------
+SignalDataCache::SignalDataCache() :
+   reuseLightTime(false)
+{
+}
+
+//------------------------------------------------------------------------------
+// ~SignalDataCache()
+//------------------------------------------------------------------------------
+/**
+ * Destructor
+ */
+ //------------------------------------------------------------------------------
+SignalDataCache::~SignalDataCache()
+{
+}
+
+//------------------------------------------------------------------------------
+// SignalDataCache(const SignalDataCache &sdc)
+//------------------------------------------------------------------------------
+/**
+ * Copy constructor; copies the settings, not the cached entries
+ *
+ * @param sdc The cache providing the settings
+ */
+ //------------------------------------------------------------------------------
+SignalDataCache::SignalDataCache(const SignalDataCache &sdc) :
+   reuseLightTime(sdc.reuseLightTime)
+{
+   SetCapacity(sdc.GetCapacity());
+}
+
+//------------------------------------------------------------------------------
+// SignalDataCache& operator=(const SignalDataCache &sdc)
+//------------------------------------------------------------------------------
+/**
+ * Assignment operator; copies the settings, not the cached entries
+ *
+ * @param sdc The cache providing the settings
+ *
+ * @return This cache
+ */
+ //------------------------------------------------------------------------------
+SignalDataCache& SignalDataCache::operator=(const SignalDataCache &sdc)
+{
+   if (this != &sdc)
+   {
+      reuseLightTime = sdc.reuseLightTime;
+      SetCapacity(sdc.GetCapacity());
+      ResetStatistics();
+   }
+   return *this;
+}
+
+//------------------------------------------------------------------------------
+// void SetCapacity(UnsignedInt entries)
+//------------------------------------------------------------------------------
+/**
+ * Sets the number of entries each table holds, and empties the tables
+ *
+ * @param entries The capacity of each table
+ */
+ //------------------------------------------------------------------------------
+void SignalDataCache::SetCapacity(UnsignedInt entries)
+{
+   signalTable.SetCapacity(entries);
+   lightTimeTable.SetCapacity(entries);
+}
+
+//------------------------------------------------------------------------------
+// UnsignedInt GetCapacity() const
+//------------------------------------------------------------------------------
+/**
+ * Retrieves the number of entries each table holds
+ *
+ * @return The capacity of each table
+ */
+ //------------------------------------------------------------------------------
+UnsignedInt SignalDataCache::GetCapacity() const
+{
+   return signalTable.GetCapacity();
+}
+
+//------------------------------------------------------------------------------
+// const CacheValue* Find(const CacheKey &key)
+//------------------------------------------------------------------------------
+/**
+ * Looks up signal data
+ *
+ * @param key The key of the data
+ *
+ * @return The cached data, or NULL if there is none.  The pointer is valid
+ *         until the next insertion.
+ */
+ //------------------------------------------------------------------------------
+const SignalDataCache::CacheValue* SignalDataCache::Find(const CacheKey &key)
+{
+   return signalTable.Find(key);
+}
+
+//------------------------------------------------------------------------------
+// void Insert(const CacheKey &key, const CacheValue &value)
+//------------------------------------------------------------------------------
+/**
+ * Caches signal data, evicting the least recently used entry when full
+ *
+ * @param key   The key of the data
+ * @param value The data
+ */
+ //------------------------------------------------------------------------------
+void SignalDataCache::Insert(const CacheKey &key, const CacheValue &value)
+{
+   signalTable.Insert(key, value);
+}
+
+//------------------------------------------------------------------------------
+// void Clear()
+//------------------------------------------------------------------------------
+/**
+ * Empties the signal data table; the light times are kept
+ */
+ //------------------------------------------------------------------------------
+void SignalDataCache::Clear()
+{
+   signalTable.Clear();
+}
+
+//------------------------------------------------------------------------------
+// void SetLightTimeReuse(bool reuse)
+//------------------------------------------------------------------------------
+/**
+ * Turns the reuse of light time solutions across passes on or off
+ *
+ * @param reuse true to start light time iterations from the cached solutions
+ */
+ //------------------------------------------------------------------------------
+void SignalDataCache::SetLightTimeReuse(bool reuse)
+{
+   reuseLightTime = reuse;
+   if (!reuseLightTime)
+      lightTimeTable.Clear();
+}
+
+//------------------------------------------------------------------------------
+// bool IsLightTimeReused() const
+//------------------------------------------------------------------------------
+/**
+ * Checks if light time solutions are reused across passes
+ *
+ * @return true if they are
+ */
+ //------------------------------------------------------------------------------
+bool SignalDataCache::IsLightTimeReused() const
+{
+   return reuseLightTime;
+}
+
+//------------------------------------------------------------------------------
+// bool FindLightTime(const CacheKey &key, Real &lightTime)
+//------------------------------------------------------------------------------
+/**
+ * Looks up the light time of a leg
+ *
+ * @param key       The key of the leg and its fixed epoch
+ * @param lightTime Set to the light time (s) if it is found
+ *
+ * @return true if the light time was found
+ */
+ //------------------------------------------------------------------------------
+bool SignalDataCache::FindLightTime(const CacheKey &key, Real &lightTime)
+{
+   if (!reuseLightTime)
+      return false;
+
+   const Real *found = lightTimeTable.Find(key);
+   if (found == NULL)
+      return false;
+
+   lightTime = *found;
+   return true;
+}
+
+//------------------------------------------------------------------------------
+// void InsertLightTime(const CacheKey &key, Real lightTime)
+//------------------------------------------------------------------------------
+/**
+ * Caches the light time of a leg
+ *
+ * @param key       The key of the leg and its fixed epoch
+ * @param lightTime The light time (s)
+ */
+ //------------------------------------------------------------------------------
+void SignalDataCache::InsertLightTime(const CacheKey &key, Real lightTime)
+{
+   if (reuseLightTime)
+      lightTimeTable.Insert(key, lightTime);
+}
+
+//------------------------------------------------------------------------------
+// void ClearLightTimes()
+//------------------------------------------------------------------------------
+/**
+ * Empties the light time table
+ */
+ //------------------------------------------------------------------------------
+void SignalDataCache::ClearLightTimes()
+{
+   lightTimeTable.Clear();
+}
+
+//------------------------------------------------------------------------------
+// Statistics GetSignalStatistics() const
+//------------------------------------------------------------------------------
+/**
+ * Retrieves the lookup counts of the signal data table
+ *
+ * @return The counts since the last reset, and the current number of entries
+ */
+ //------------------------------------------------------------------------------
+SignalDataCache::Statistics SignalDataCache::GetSignalStatistics() const
+{
+   return signalTable.GetStatistics();
+}
+
+//------------------------------------------------------------------------------
+// Statistics GetLightTimeStatistics() const
+//------------------------------------------------------------------------------
+/**
+ * Retrieves the lookup counts of the light time table
+ *
+ * @return The counts since the last reset, and the current number of entries
+ */
+ //------------------------------------------------------------------------------
+SignalDataCache::Statistics SignalDataCache::GetLightTimeStatistics() const
+{
+   return lightTimeTable.GetStatistics();
+}
+
+//------------------------------------------------------------------------------
+// void ResetStatistics()
+//------------------------------------------------------------------------------
+/**
+ * Zeros the lookup counts of both tables
+ */
+ //------------------------------------------------------------------------------
+void SignalDataCache::ResetStatistics()
+{
+   signalTable.ResetStatistics();
+   lightTimeTable.ResetStatistics();
+}
@@ -22,18 +22,30 @@
 #define SignalDataCache_hpp
 
 #include "estimation_defs.hpp"
-#include "Rvector3.hpp"
-#include "Rmatrix.hpp"
-#include "Rvector6.hpp"
 #include "GmatTime.hpp"
 
 #include <unordered_map>
+#include <vector>
 
 // Forward references
 class SignalData;
 
 /**
- * The SignalDataCache class is a structure for caching SignalData 
+ * The SignalDataCache class caches signal data for the measurement models
+ *
+ * A cache holds two tables, each bounded by a capacity and evicting its least
+ * recently used entry when full:
+ *
+ *  - the signal data table, keyed on strand, frequency and the two epochs of
+ *    a leg, holds the light time solution and the ionosphere correction.  It
+ *    is cleared after each pass through the observations.
+ *  - the light time table, keyed on leg and fixed epoch, holds the converged
+ *    light time of each leg.  When light time reuse is on, a leg starts its
+ *    light time iteration from the solution of the previous pass.  It is kept
+ *    across passes.
+ *
+ * Table values have fixed size, so an entry is a single allocation.  Lookup
+ * statistics are kept for the reports.
  */
 class ESTIMATION_API SignalDataCache {
 
@@ -44,11 +56,12 @@ public:
 
    /// Cache key for signal data
    struct ESTIMATION_API CacheKey {
-      const unsigned long strand;
-      const Real          freq; 
-      const Real          epoch1;
-      const Real          epoch2;
+      unsigned long strand;
+      Real          freq; 
+      Real          epoch1;
+      Real          epoch2;
 
+      CacheKey();
       CacheKey(unsigned long strandId, Real aFreq, Real aEpoch1, Real aEpoch2);
 
       bool operator==(const CacheKey& k) const;
@@ -57,20 +70,21 @@ public:
    /// Cache value for the light time solution
    struct ESTIMATION_API CacheValue {
 
-      const GmatTime tPrecTime;
-      const GmatTime rPrecTime;
-      const Rvector3 tLoc;
-      const Rvector6 tOStateSSB;
-      const Rvector3 rLoc;
-      const Rvector6 rOStateSSB;
-      const Rvector3 tVel;
-      const Rvector3 rVel;
-      const Rmatrix tSTM;
-      const Rmatrix rSTM;
-      const RealArray ionoCorrection;
+      GmatTime tPrecTime;
+      GmatTime rPrecTime;
+      Real     tLoc[3];
+      Real     tOStateSSB[6];
+      Real     rLoc[3];
+      Real     rOStateSSB[6];
+      Real     tVel[3];
+      Real     rVel[3];
+      /// Ionosphere range (m), elevation (rad) and time (s) corrections
+      Real     ionoCorrection[3];
 
+      CacheValue();
       CacheValue(const SignalData& sd, const RealArray & ic);
 
+      RealArray GetIonoCorrection() const;
    };
 
    /// Cache hasher based on simple xor accumulator and bit shifting 
@@ -79,10 +93,179 @@ public:
       size_t operator()(const CacheKey& k) const;
    };
 
-   typedef std::unordered_map<CacheKey, CacheValue, CacheKeyHasher> SimpleSignalDataCache;
+   /// Lookup counts for a table
+   struct ESTIMATION_API Statistics
+   {
+      UnsignedInt hits;
+      UnsignedInt misses;
+      UnsignedInt evictions;
+      UnsignedInt size;
 
-   typedef std::unordered_map<SignalDataCache::CacheKey, SignalDataCache::CacheValue, SignalDataCache::CacheKeyHasher>::iterator SimpleSignalDataCacheIter;
+      Statistics();
+      Statistics& operator+=(const Statistics &st);
+   };
+
+   /// Default number of entries in each table
+   static const UnsignedInt DEFAULT_CAPACITY = 100000;
+
+   SignalDataCache();
+   ~SignalDataCache();
+   SignalDataCache(const SignalDataCache &sdc);
+   SignalDataCache& operator=(const SignalDataCache &sdc);
+
+   void              SetCapacity(UnsignedInt entries);
+   UnsignedInt       GetCapacity() const;
+
+   const CacheValue* Find(const CacheKey &key);
+   void              Insert(const CacheKey &key, const CacheValue &value);
+   void              Clear();
+
+   void              SetLightTimeReuse(bool reuse);
+   bool              IsLightTimeReused() const;
+   bool              FindLightTime(const CacheKey &key, Real &lightTime);
+   void              InsertLightTime(const CacheKey &key, Real lightTime);
+   void              ClearLightTimes();
+
+   Statistics        GetSignalStatistics() const;
+   Statistics        GetLightTimeStatistics() const;
+   void              ResetStatistics();
+
+private:
+
+   /// Fixed capacity table with least recently used eviction
+   template <class Value>
+   class Table
+   {
+   public:
+      Table() :
+         capacity (DEFAULT_CAPACITY),
+         newest   (-1),
+         oldest   (-1)
+      {
+      }
+
+      void SetCapacity(UnsignedInt entries)
+      {
+         capacity = (entries > 0 ? entries : 1);
+         Clear();
+      }
+
+      UnsignedInt GetCapacity() const
+      {
+         return capacity;
+      }
+
+      const Value* Find(const CacheKey &key)
+      {
+         typename Lookup::iterator i = lookup.find(key);
+         if (i == lookup.end())
+         {
+            ++stats.misses;
+            return NULL;
+         }
+         ++stats.hits;
+         Unlink(i->second);
+         LinkNewest(i->second);
+         return &(nodes[i->second].value);
+      }
+
+      void Insert(const CacheKey &key, const Value &value)
+      {
+         Integer slot;
+         typename Lookup::iterator i = lookup.find(key);
+         if (i != lookup.end())
+         {
+            slot = i->second;
+            Unlink(slot);
+         }
+         else if (nodes.size() < capacity)
+         {
+            slot = (Integer)nodes.size();
+            nodes.push_back(Node());
+            lookup[key] = slot;
+         }
+         else
+         {
+            // Reuse the slot of the least recently used entry
+            slot = oldest;
+            Unlink(slot);
+            lookup.erase(nodes[slot].key);
+            lookup[key] = slot;
+            ++stats.evictions;
+         }
+         nodes[slot].key   = key;
+         nodes[slot].value = value;
+         LinkNewest(slot);
+      }
+
+      void Clear()
+      {
+         nodes.clear();
+         lookup.clear();
+         newest = oldest = -1;
+      }
+
+      Statistics GetStatistics() const
+      {
+         Statistics st = stats;
+         st.size = (UnsignedInt)nodes.size();
+         return st;
+      }
+
+      void ResetStatistics()
+      {
+         stats = Statistics();
+      }
+
+   private:
+      struct Node
+      {
+         CacheKey key;
+         Value    value;
+         /// Slots of the next newer and next older entries, -1 for none
+         Integer  newer;
+         Integer  older;
+      };
+      typedef std::unordered_map<CacheKey, Integer, CacheKeyHasher> Lookup;
+
+      UnsignedInt       capacity;
+      std::vector<Node> nodes;
+      Lookup            lookup;
+      Integer           newest;
+      Integer           oldest;
+      Statistics        stats;
+
+      void Unlink(Integer slot)
+      {
+         Node &node = nodes[slot];
+         if (node.newer != -1)
+            nodes[node.newer].older = node.older;
+         else
+            newest = node.older;
+         if (node.older != -1)
+            nodes[node.older].newer = node.newer;
+         else
+            oldest = node.newer;
+      }
+
+      void LinkNewest(Integer slot)
+      {
+         nodes[slot].newer = -1;
+         nodes[slot].older = newest;
+         if (newest != -1)
+            nodes[newest].newer = slot;
+         newest = slot;
+         if (oldest == -1)
+            oldest = slot;
+      }
+   };
 
+   /// Light time solutions and ionosphere corrections for the current pass
+   Table<CacheValue>    signalTable;
+   /// Converged light times kept across passes
+   Table<Real>          lightTimeTable;
+   /// Flag to start light time iterations from the light time table
+   bool                 reuseLightTime;
 };
 
-#endif /* SignalDataCache_hpp */
\ No newline at end of file
+#endif /* SignalDataCache_hpp */
@@ -0,0 +1,306 @@
+//$Id$
+//------------------------------------------------------------------------------
+//                            TdmContentHandler
+//------------------------------------------------------------------------------
+// GMAT: General Mission Analysis Tool.
+//
+// Copyright (c) 2002 - 2020 United States Government as represented by the
+// Administrator of The National Aeronautics and Space Administration.
+// All Other Rights Reserved.
+//
+// Author: GMAT Development Team
+// Created: 2026/10/17
+//
+/**
+ * SAX content handler class used by the TdmReadWriter class.
+ */
+//------------------------------------------------------------------------------
+
+#include "TdmContentHandler.hpp"
+#include "StringUtil.hpp"
+
+//------------------------------------------------------------------------------
+// Public Methods
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+// TdmContentHandler()
+//------------------------------------------------------------------------------
+/**
+ * Constructor
+ */
+//------------------------------------------------------------------------------
+TdmContentHandler::TdmContentHandler() :
+   observationChildren  (0),
+   rootFound            (false),
+   documentEnded        (false)
+{
+   current.type = TdmEvent::METADATA;
+}
+
+
+//------------------------------------------------------------------------------
+// ~TdmContentHandler()
+//------------------------------------------------------------------------------
+/**
+ * Destructor
+ */
+//------------------------------------------------------------------------------
+TdmContentHandler::~TdmContentHandler()
+{}
+
+
+//------------------------------------------------------------------------------
+// void startDocument()
+//------------------------------------------------------------------------------
+/**
+ * Resets the handler at the start of a file.
+ */
+//------------------------------------------------------------------------------
+void TdmContentHandler::startDocument()
+{
+   events.clear();
+   elementStack.clear();
+   text.clear();
+   observationChildren = 0;
+   rootFound = false;
+   documentEnded = false;
+   error = "";
+}
+
+
+//------------------------------------------------------------------------------
+// void endDocument()
+//------------------------------------------------------------------------------
+/**
+ * Marks the end of the file.
+ */
+//------------------------------------------------------------------------------
+void TdmContentHandler::endDocument()
+{
+   documentEnded = true;
+}
+
+
+//------------------------------------------------------------------------------
+// void startElement(const XMLCh* const uri, const XMLCh* const localname,
+//       const XMLCh* const qname, const Attributes& attrs)
+//------------------------------------------------------------------------------
+/**
+ * Opens an element.
+ *
+ * The root element is checked for the TDM id and version; metadata and
+ * observation elements start a new event.
+ */
+//------------------------------------------------------------------------------
+void TdmContentHandler::startElement(const XMLCh* const uri,
+      const XMLCh* const localname, const XMLCh* const qname,
+      const Attributes& attrs)
+{
+   std::string name = Transcode(qname);
+
+   if (elementStack.empty())
+   {
+      rootFound = true;
+      if (attrs.getLength() > 0)
+      {
+         if (GetAttribute(attrs, "id") != "CCSDS_TDM_VERS")
+            error = " CCSDS_TDM_VERS id is not correct";
+         else if (GetAttribute(attrs, "version") != "1.0")
+            error = "The TDM VERSION is not correct.\n";
+      }
+   }
+   else if ((name == "metadata") || (name == "observation"))
+   {
+      current.type = (name == "metadata" ? TdmEvent::METADATA :
+            TdmEvent::OBSERVATION);
+      current.keywords.clear();
+      current.values.clear();
+      current.epoch = "";
+      observationChildren = 0;
+   }
+
+   elementStack.push_back(name);
+   text.clear();
+}
+
+
+//------------------------------------------------------------------------------
+// void endElement(const XMLCh* const uri, const XMLCh* const localname,
+//       const XMLCh* const qname)
+//------------------------------------------------------------------------------
+/**
+ * Closes an element.
+ *
+ * Children of a metadata element are added to its keyword list.  The first
+ * child of an observation is its epoch and the last child its measurement.
+ * Metadata, observation and segment elements queue an event when they end.
+ */
+//------------------------------------------------------------------------------
+void TdmContentHandler::endElement(const XMLCh* const uri,
+      const XMLCh* const localname, const XMLCh* const qname)
+{
+   if (elementStack.empty())
+      return;
+
+   std::string name = elementStack.back();
+   elementStack.pop_back();
+   std::string parent = (elementStack.empty() ? "" : elementStack.back());
+
+   if (parent == "metadata")
+   {
+      current.keywords.push_back(name);
+      current.values.push_back(GmatStringUtil::Trim(Transcode(text.c_str())));
+   }
+   else if (parent == "observation")
+   {
+      std::string value = GmatStringUtil::Trim(Transcode(text.c_str()));
+      if (observationChildren == 0)
+         current.epoch = value;
+      ++observationChildren;
+
+      current.keywords.assign(1, name);
+      current.values.assign(1, value);
+   }
+   else if ((name == "metadata") || (name == "observation"))
+      events.push_back(current);
+   else if (name == "segment")
+   {
+      TdmEvent segmentEnd;
+      segmentEnd.type = TdmEvent::SEGMENT_END;
+      events.push_back(segmentEnd);
+   }
+
+   text.clear();
+}
+
+
+//------------------------------------------------------------------------------
+// void characters(const XMLCh* const chars, const XMLSize_t length)
+//------------------------------------------------------------------------------
+/**
+ * Collects the text content of the current element.
+ */
+//------------------------------------------------------------------------------
+void TdmContentHandler::characters(const XMLCh* const chars,
+      const XMLSize_t length)
+{
+   text.append(chars, length);
+}
+
+
+//------------------------------------------------------------------------------
+// bool HasEvent() const
+//------------------------------------------------------------------------------
+/**
+ * Checks for events waiting to be read.
+ */
+//------------------------------------------------------------------------------
+bool TdmContentHandler::HasEvent() const
+{
+   return !events.empty();
+}
+
+
+//------------------------------------------------------------------------------
+// TdmEvent& FrontEvent()
+//------------------------------------------------------------------------------
+/**
+ * Accesses the oldest event waiting to be read.
+ */
+//------------------------------------------------------------------------------
+TdmEvent& TdmContentHandler::FrontEvent()
+{
+   return events.front();
+}
+
+
+//------------------------------------------------------------------------------
+// void PopEvent()
+//------------------------------------------------------------------------------
+/**
+ * Discards the oldest event.
+ */
+//------------------------------------------------------------------------------
+void TdmContentHandler::PopEvent()
+{
+   events.pop_front();
+}
+
+
+//------------------------------------------------------------------------------
+// bool IsRootFound() const
+//------------------------------------------------------------------------------
+/**
+ * Checks if the root element has been read.
+ */
+//------------------------------------------------------------------------------
+bool TdmContentHandler::IsRootFound() const
+{
+   return rootFound;
+}
+
+
+//------------------------------------------------------------------------------
+// bool IsDocumentEnded() const
+//------------------------------------------------------------------------------
+/**
+ * Checks if the end of the file has been reached.
+ */
+//------------------------------------------------------------------------------
+bool TdmContentHandler::IsDocumentEnded() const
+{
+   return documentEnded;
+}
+
+
+//------------------------------------------------------------------------------
+// const std::string& GetError() const
+//------------------------------------------------------------------------------
+/**
+ * Returns the description of a content error, or an empty string.
+ */
+//------------------------------------------------------------------------------
+const std::string& TdmContentHandler::GetError() const
+{
+   return error;
+}
+
+
+//------------------------------------------------------------------------------
+// Private Methods
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+// std::string Transcode(const XMLCh *xmlString)
+//------------------------------------------------------------------------------
+/**
+ * Converts a Xerces string to a std::string.
+ */
+//------------------------------------------------------------------------------
+std::string TdmContentHandler::Transcode(const XMLCh *xmlString)
+{
+   char *chars = XMLString::transcode(xmlString);
+   std::string str(chars == NULL ? "" : chars);
+   XMLString::release(&chars);
+   return str;
+}
+
+
+//------------------------------------------------------------------------------
+// std::string GetAttribute(const Attributes& attrs, const std::string &name)
+//------------------------------------------------------------------------------
+/**
+ * Returns the value of an attribute, or an empty string if it is not set.
+ */
+//------------------------------------------------------------------------------
+std::string TdmContentHandler::GetAttribute(const Attributes& attrs,
+      const std::string &name)
+{
+   for (XMLSize_t i = 0; i < attrs.getLength(); ++i)
+   {
+      if (Transcode(attrs.getQName(i)) == name)
+         return Transcode(attrs.getValue(i));
+   }
+   return "";
+}
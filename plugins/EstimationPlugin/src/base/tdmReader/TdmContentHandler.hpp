@@ -0,0 +1,118 @@
+//$Id$
+//------------------------------------------------------------------------------
+//                            TdmContentHandler
+//------------------------------------------------------------------------------
+// GMAT: General Mission Analysis Tool.
+//
+// Copyright (c) 2002 - 2020 United States Government as represented by the
+// Administrator of The National Aeronautics and Space Administration.
+// All Other Rights Reserved.
+//
+// Author: GMAT Development Team
+// Created: 2026/10/17
+//
+/**
+ * SAX content handler class used by the TdmReadWriter class.
+ */
+//------------------------------------------------------------------------------
+
+#ifndef TdmContentHandler_hpp
+#define TdmContentHandler_hpp
+
+#include "xercesc/sax2/DefaultHandler.hpp"
+#include "xercesc/sax2/Attributes.hpp"
+#include "xercesc/util/XMLString.hpp"
+#include <deque>
+#include <string>
+
+#include "estimation_defs.hpp"
+#include "gmatdefs.hpp"
+
+XERCES_CPP_NAMESPACE_USE
+
+/**
+ * An item of a TDM file passed from the content handler to the reader
+ */
+struct TdmEvent
+{
+   /// Kinds of items
+   enum EventType
+   {
+      METADATA,
+      OBSERVATION,
+      SEGMENT_END
+   };
+
+   /// The kind of item
+   EventType   type;
+   /// Metadata keywords, or the keyword of the observation
+   StringArray keywords;
+   /// Metadata values, or the value of the observation
+   StringArray values;
+   /// Epoch string of an observation
+   std::string epoch;
+};
+
+
+/**
+* Class that turns the SAX callbacks for a TDM file into TdmEvents
+*
+* The handler collects the keywords of each metadata block and the epoch,
+* keyword and value of each observation, and queues an event when the
+* element ends.  The reader drives the parse one token at a time, so the
+* queue holds at most a few events and the file is never held in memory.
+*/
+class  ESTIMATION_API TdmContentHandler : public DefaultHandler
+{
+public:
+   TdmContentHandler();
+   ~TdmContentHandler();
+
+   /// override DefaultHandler base class member functions
+   virtual void startDocument();
+   virtual void endDocument();
+   virtual void startElement(const XMLCh* const uri,
+                             const XMLCh* const localname,
+                             const XMLCh* const qname,
+                             const Attributes& attrs);
+   virtual void endElement(const XMLCh* const uri,
+                           const XMLCh* const localname,
+                           const XMLCh* const qname);
+   virtual void characters(const XMLCh* const chars,
+                           const XMLSize_t length);
+
+   bool HasEvent() const;
+   TdmEvent& FrontEvent();
+   void PopEvent();
+   bool IsRootFound() const;
+   bool IsDocumentEnded() const;
+   const std::string& GetError() const;
+
+private:
+   // Handlers are owned by a single reader
+   TdmContentHandler(const TdmContentHandler &tch);
+   TdmContentHandler& operator=(const TdmContentHandler &tch);
+
+   /// Events waiting to be read
+   std::deque<TdmEvent> events;
+   /// The event being collected
+   TdmEvent current;
+   /// Names of the open elements
+   StringArray elementStack;
+   /// Text content of the current element
+   std::basic_string<XMLCh> text;
+   /// Number of child elements seen in the current observation
+   Integer observationChildren;
+   /// Flag indicating that the root element was read
+   bool rootFound;
+   /// Flag indicating that the end of the document was reached
+   bool documentEnded;
+   /// Description of a content error found in the file
+   std::string error;
+
+   static std::string Transcode(const XMLCh *xmlString);
+   static std::string GetAttribute(const Attributes& attrs,
+                                   const std::string &name);
+};
+
+#endif   //TdmContentHandler_hpp
@@ -21,8 +21,10 @@
 
 #include "TdmReadWriter.hpp"
 #include "MessageInterface.hpp"
-#include "xercesc/framework/LocalFileInputSource.hpp"
+#include "xercesc/sax2/XMLReaderFactory.hpp"
+#include "xercesc/util/XMLUni.hpp"
 #include "MeasurementException.hpp"
+#include "StringUtil.hpp"
 #include "DateUtil.hpp"
 
 
@@ -40,14 +42,10 @@
 TdmReadWriter::TdmReadWriter()
 {
    theErrorHandler = new TdmErrorHandler();
-   theDOMParser = NULL;
-  
-   theBody = NULL;
-   theSegment = NULL;
-   theData = NULL;
-   theObservation = NULL;
+   theContentHandler = NULL;
+   theReader = NULL;
    xercesInitialized = false;
-   observationIndex = 0;
+   isParsing = false;
    
    // Fill in the map
    mapTransmitBand["S"] = 1.0;
@@ -63,15 +61,18 @@ TdmReadWriter::TdmReadWriter()
 //------------------------------------------------------------------------------
 /**
  * Copy Constructor
+ *
+ * The copy has its own parser, and is not reading a file.
  */
 //------------------------------------------------------------------------------
 TdmReadWriter::TdmReadWriter(const TdmReadWriter &trw)
 {
-   theErrorHandler = NULL;
-   theDOMParser = NULL;
-   mapTransmitBand.insert(trw.mapTransmitBand.begin(), trw.mapTransmitBand.end());
-
-   *this = trw;
+   theErrorHandler = new TdmErrorHandler();
+   theContentHandler = NULL;
+   theReader = NULL;
+   xercesInitialized = false;
+   isParsing = false;
+   mapTransmitBand = trw.mapTransmitBand;
 }
 
 
@@ -80,28 +81,16 @@ TdmReadWriter::TdmReadWriter(const TdmReadWriter &trw)
 //------------------------------------------------------------------------------
 /**
  * Assignment operator
+ *
+ * Any file being read by this object is closed; the parser is kept.
  */
 //------------------------------------------------------------------------------
 TdmReadWriter& TdmReadWriter::operator=(const TdmReadWriter &trw)
 {
    if (this != &trw)
    {
-      TdmErrorHandler *newErrorHandler = trw.theErrorHandler; 
-      if (theErrorHandler)                         // made changes by TUAN NGUYEN
-      {                                            // made changes by TUAN NGUYEN
-         delete theErrorHandler;
-         theErrorHandler = NULL;                   // made changes by TUAN NGUYEN
-      }                                            // made changes by TUAN NGUYEN
-
-      theErrorHandler = newErrorHandler;
-      theDOMParser = trw.theDOMParser;;
-      theBody = trw.theBody;
-      theSegment = trw.theSegment;
-      theData = trw.theData;
-      theObservation = trw.theObservation;
-      xercesInitialized = trw.xercesInitialized;
-      observationIndex = trw.observationIndex;
-      mapTransmitBand.insert(trw.mapTransmitBand.begin(), trw.mapTransmitBand.end());
+      StopParse();
+      mapTransmitBand = trw.mapTransmitBand;
    }
    
    return *this;
@@ -119,6 +108,8 @@ TdmReadWriter::~TdmReadWriter()
 {
    if(xercesInitialized)
       Finalize();
+   else if (theErrorHandler)
+      delete theErrorHandler;
 }
 
 
@@ -128,8 +119,8 @@ TdmReadWriter::~TdmReadWriter()
 /**
  * Initializes TdmReadWriter.
  *
- * This method will initialize the DOM Parser, and configure it for error handling
- * and Schema validation.
+ * This method will initialize the SAX2 reader, and configure it for error
+ * handling and Schema validation.
  *
  * @param none
  *
@@ -143,20 +134,28 @@ bool TdmReadWriter::Initialize()
       try
       {
          XMLPlatformUtils::Initialize();
-         theDOMParser = new XercesDOMParser();
 
-         theDOMParser->setErrorHandler(theErrorHandler);
-	      theDOMParser->setValidationScheme(XercesDOMParser::Val_Auto);
-	      theDOMParser->setDoNamespaces(true);
-	      theDOMParser->setDoSchema(true);
-	      theDOMParser->setValidationConstraintFatal(true);
+         if (theErrorHandler == NULL)
+            theErrorHandler = new TdmErrorHandler();
+         theContentHandler = new TdmContentHandler();
+
+         theReader = XMLReaderFactory::createXMLReader();
+         theReader->setContentHandler(theContentHandler);
+         theReader->setErrorHandler(theErrorHandler);
+         theReader->setFeature(XMLUni::fgSAX2CoreNameSpaces, true);
+         theReader->setFeature(XMLUni::fgSAX2CoreValidation, true);
+         theReader->setFeature(XMLUni::fgXercesDynamic, true);
+         theReader->setFeature(XMLUni::fgXercesSchema, true);
+         theReader->setFeature(XMLUni::fgXercesValidationErrorAsFatal, true);
 
          xercesInitialized = true;
       }
       catch(const XMLException &xe)
       {
          std::string errMsg ("Xerces failed to initialize: ");
-         errMsg.push_back(*XMLString::transcode(xe.getMessage()));
+         char *xeMsg = XMLString::transcode(xe.getMessage());
+         errMsg += xeMsg;
+         XMLString::release(&xeMsg);
          throw MeasurementException(errMsg);
       }
    }
@@ -177,143 +176,113 @@ bool TdmReadWriter::Initialize()
  *
  * @param none
  *
- * @return ObsData pointer
+ * @return ObsData pointer, or NULL when there are no more segments
  */
 //------------------------------------------------------------------------------
-//ObsData *TdmReadWriter::ProcessMetadata()
 ObservationData *TdmReadWriter::ProcessMetadata()
 {
-   if (theSegment != NULL)
+   while (NextEvent())
    {
+      if (theContentHandler->FrontEvent().type != TdmEvent::METADATA)
+      {
+         theContentHandler->PopEvent();
+         continue;
+      }
+
       // Clear observation Data if it has been filled in with data.
       theTemplate.Clear();
 
-      DOMElement *pMetaData = theSegment->getFirstElementChild();
-      DOMNodeList *pChilds = pMetaData->getChildNodes();
-					
-		for (UnsignedInt i = 0; i < pChilds->getLength(); i++)
-		{
-			DOMElement *pChild = (DOMElement *)pChilds->item(i);
-			if (pChild->getNodeType() == DOMNode::ELEMENT_NODE)
+      TdmEvent &metadata = theContentHandler->FrontEvent();
+      for (UnsignedInt i = 0; i < metadata.keywords.size(); ++i)
+      {
+         const std::string &strT = metadata.values[i];
+
+         //Fill in the observation data theTemplate for each
+         // attributes.
+         switch(HashIt(metadata.keywords[i]))
          {
-            //Fill in the observation data theTemplate for each
-            // attributes.
-            switch(HashIt(pChild->getNodeName()))
+            case TIME_SYSTEM:
             {
-               case TIME_SYSTEM:
-               {
-                  std::string strT(XMLString::transcode(pChild->getTextContent()));
-                  if ( strT == "UTC")
-                     theTemplate.epochSystem = TimeSystemConverter::UTCMJD;
-                  break;
-               }
-               case PARTICIPANT_1:
-               case PARTICIPANT_2:
-               case PARTICIPANT_3:
-               case PARTICIPANT_4:
-               case PARTICIPANT_5:
-               {
-                  theTemplate.participantIDs.push_back(XMLString::transcode(pChild->getTextContent()));
-                  break;
-               }
-               case MODE:
-                  break;
-               case PATH:
-               {
-                  StringArray IDs;
-                  char *pPath = XMLString::transcode(pChild->getTextContent());
-                  char *pTok;
-                  pTok = strtok(pPath, ",");
-                  
-                  while (pTok != NULL)
-                  {
-                     IDs.push_back(theTemplate.participantIDs.at(atoi(pTok)-1));
-                     pTok = strtok(NULL, ","); 
-                  }
-
-                  theTemplate.strands.push_back(IDs);
-                  XMLString::release(&pPath);
-                  break;
-               }
-               case PATH_1:
-                  break;
-               case PATH_2:
-                  break;
-               case TRANSMIT_BAND:
-               {
-                  std::string strT(XMLString::transcode(pChild->getTextContent()));
-
-                  std::map<std::string, Real>::iterator it;
-                  it = mapTransmitBand.find(strT);
-                  
-                  if (it != mapTransmitBand.end())
-                     theTemplate.value.push_back(it->second);
-                  else
-                     theTemplate.value.push_back(0.0);
-
-                  theTemplate.dataMap.push_back(XMLString::transcode(pChild->getNodeName()));
-
-                  break;
-               }
-               case RECEIVE_BAND:
-                  break;
-               case TIMETAG_REF:
-               {
-                  std::string strT(XMLString::transcode(pChild->getTextContent()));
-                  if (strT.compare("RECEIVE") == 0 || strT.compare("receive") == 0)
-                     theTemplate.epochAtEnd = true;
-                  else if (strT.compare("TRANSMIT") || strT.compare("transmit") == 0)
-                     theTemplate.epochAtEnd = false;
-                  
-                  break;
-               }
-//               case INTEGRATION_INTERVAL:
-//                  {
-//                     theTemplate.data.push_back(atof(XMLString::transcode(pChild->getTextContent())));
-//                     theTemplate.dataMap.push_back(XMLString::transcode(pChild->getNodeName()));
-//                  }
-//                  break;
-               case INTEGRATION_REF:
-                  {
-                     std::string strT(XMLString::transcode(pChild->getTextContent()));
-                     if (strT.compare("END") == 0 || strT.compare("end") == 0)
-                        theTemplate.epochAtIntegrationEnd = true;
-                     else if (strT.compare("START") || strT.compare("start") == 0)
-                        theTemplate.epochAtIntegrationEnd = false;
-                  }
-                  break;
-               case RANGE_MODE:
-                  break;
-               case RANGE_MODULUS:
-               case FREQ_OFFSET:
-               case INTEGRATION_INTERVAL:
-               {
-                  theTemplate.value.push_back(atof(XMLString::transcode(pChild->getTextContent())));
-                  theTemplate.dataMap.push_back(XMLString::transcode(pChild->getNodeName()));
-                  break;
-               }
-               case RANGE_UNITS:
-               {
-                  theTemplate.unit = std::string(XMLString::transcode(pChild->getTextContent()));
-                  break;
-               }
-               default:
-                  break;
+               if ( strT == "UTC")
+                  theTemplate.epochSystem = TimeSystemConverter::UTCMJD;
+               break;
             }
-			}
-      }
+            case PARTICIPANT_1:
+            case PARTICIPANT_2:
+            case PARTICIPANT_3:
+            case PARTICIPANT_4:
+            case PARTICIPANT_5:
+            {
+               theTemplate.participantIDs.push_back(strT);
+               break;
+            }
+            case MODE:
+               break;
+            case PATH:
+            {
+               StringArray IDs;
+               StringArray indices = GmatStringUtil::SeparateBy(strT, ",");
 
-      theData = theSegment->getLastElementChild();
-      DOMNodeList *pObsChilds = theData->getChildNodes();
-      int i = 0;
-      while ( ((DOMElement *)pObsChilds->item(i))->getNodeType() != DOMNode::ELEMENT_NODE)
-      {
-        i++;
+               for (UnsignedInt j = 0; j < indices.size(); ++j)
+                  IDs.push_back(theTemplate.participantIDs.at(
+                        atoi(indices[j].c_str())-1));
+
+               theTemplate.strands.push_back(IDs);
+               break;
+            }
+            case PATH_1:
+               break;
+            case PATH_2:
+               break;
+            case TRANSMIT_BAND:
+            {
+               std::map<std::string, Real>::iterator it;
+               it = mapTransmitBand.find(strT);
+               
+               if (it != mapTransmitBand.end())
+                  theTemplate.value.push_back(it->second);
+               else
+                  theTemplate.value.push_back(0.0);
+
+               theTemplate.dataMap.push_back(metadata.keywords[i]);
+
+               break;
+            }
+            case RECEIVE_BAND:
+               break;
+            case TIMETAG_REF:
+            {
+               theTemplate.epochAtEnd =
+                     (strT.compare("RECEIVE") == 0 || strT.compare("receive") == 0);
+               break;
+            }
+            case INTEGRATION_REF:
+            {
+               theTemplate.epochAtIntegrationEnd =
+                     (strT.compare("END") == 0 || strT.compare("end") == 0);
+               break;
+            }
+            case RANGE_MODE:
+               break;
+            case RANGE_MODULUS:
+            case FREQ_OFFSET:
+            case INTEGRATION_INTERVAL:
+            {
+               theTemplate.value.push_back(atof(strT.c_str()));
+               theTemplate.dataMap.push_back(metadata.keywords[i]);
+               break;
+            }
+            case RANGE_UNITS:
+            {
+               theTemplate.unit = strT;
+               break;
+            }
+            default:
+               break;
+         }
       }
-      
-      //first observation data
-      theObservation = (DOMElement *)pObsChilds->item(i);
 
+      theContentHandler->PopEvent();
       return &theTemplate;
    }
    
@@ -325,63 +294,65 @@ ObservationData *TdmReadWriter::ProcessMetadata()
 // bool LoadRecord()
 //------------------------------------------------------------------------------
 /**
- * Loads Data section of XML file.
+ * Loads the next observation record from the Data section of XML file.
  *
  * This method retrieves the observation data and fills in the relevant fields in
  * the ObservationData record that is passed to it, by pushing the observation data
  * to the data member and the associated field tags to the dataMap in the input 
- * ObservationData record.
+ * ObservationData record.  Consecutive observations with the same epoch form
+ * one record.
  *
  * @param ObsData *
  *
- * @return ObsData
+ * @return The template for the next record: the current one, or the template
+ *         of the next segment when this record ends a segment.  NULL is
+ *         returned once no data remains.
  */
 //------------------------------------------------------------------------------
-//ObsData *TdmReadWriter::LoadRecord(ObsData *newData)
 ObservationData *TdmReadWriter::LoadRecord(ObservationData *newData)
 {
+   bool hasData = false;
    std::string strPrevEpoch;
-   std::string strCurrEpoch;
-   std::string strObs;
-   std::string strNodeName;
 
-   strPrevEpoch = std::string(XMLString::transcode(theObservation->getFirstElementChild()->getTextContent()));
-  
-   for (UnsignedInt i = observationIndex; i < theData->getChildNodes()->getLength(); i++)
+   while (NextEvent())
    {
-      theObservation = (DOMElement *) theData->getChildNodes()->item(i);
-      if (theObservation->getNodeType() == DOMNode::ELEMENT_NODE)
-		{
-			strCurrEpoch = std::string(XMLString::transcode(theObservation->getFirstElementChild()->getTextContent()));
-         strObs = std::string(XMLString::transcode(theObservation->getLastElementChild()->getTextContent())); 
-         strNodeName = std::string(XMLString::transcode(theObservation->getLastElementChild()->getNodeName()));
+      TdmEvent &event = theContentHandler->FrontEvent();
+
+      if (event.type == TdmEvent::OBSERVATION)
+      {
+         const std::string &strNodeName = event.keywords[0];
 
          if (theTemplate.typeName == "")
             theTemplate.typeName = newData->typeName = strNodeName;
-         
-         if (strPrevEpoch != strCurrEpoch)
-         {
-            //set the index for next call
-            observationIndex = i;
 
+         // The observation starts the next record
+         if (hasData && (event.epoch != strPrevEpoch))
             return &theTemplate;
-         }
-         else
-         {
-            // push data into newData     
-            newData->epoch = ParseEpoch(strPrevEpoch);  
-            newData->value.push_back(atof(strObs.c_str()));
-            newData->dataMap.push_back(strNodeName);
-         }
-           
-         strPrevEpoch = strCurrEpoch;
+
+         // push data into newData
+         newData->epoch = ParseEpoch(event.epoch);
+         newData->value.push_back(atof(event.values[0].c_str()));
+         newData->dataMap.push_back(strNodeName);
+
+         strPrevEpoch = event.epoch;
+         hasData = true;
+         theContentHandler->PopEvent();
+      }
+      else
+      {
+         if (event.type == TdmEvent::SEGMENT_END)
+            theContentHandler->PopEvent();
+
+         ObservationData *nextTemplate = ProcessMetadata();
+
+         // Return the last record of the file before reporting the end
+         if ((nextTemplate == NULL) && hasData)
+            return &theTemplate;
+         return nextTemplate;
       }
    }
-   
-   theSegment = theSegment->getNextElementSibling();
-   // reset the index back to zero
-   observationIndex = 0;
-   return (ProcessMetadata());
+
+   return (hasData ? &theTemplate : NULL);
 }
 
 
@@ -389,10 +360,12 @@ ObservationData *TdmReadWriter::LoadRecord(ObservationData *newData)
 // bool Validate()
 //------------------------------------------------------------------------------
 /**
- * Validates the XML file.
+ * Starts reading the XML file.
  *
- * This method called when a new TDM file is loaded for the first data read, it uses 
- * Xerces to validate the data file against the TDM schema.
+ * This method called when a new TDM file is loaded for the first data read.  It
+ * starts the progressive parse of the file; Xerces validates the data against
+ * the TDM schema as the file is read, and validation errors are reported when
+ * the data containing them is reached.
  *
  * @param TDM XML filename
  *
@@ -401,35 +374,36 @@ ObservationData *TdmReadWriter::LoadRecord(ObservationData *newData)
 //------------------------------------------------------------------------------
 bool TdmReadWriter::Validate(const std::string &tdmFileName)
 {
-   LocalFileInputSource *xmlFile;
+   if (theReader == NULL)
+      Initialize();
+
+   StopParse();
+   theErrorHandler->resetErrors();
 
-   // Load the TDM XML file
    try
    {
-      xmlFile = new LocalFileInputSource(XMLString::transcode(tdmFileName.c_str()));
+      isParsing = theReader->parseFirst(tdmFileName.c_str(), theToken);
    }
    catch(const XMLException &xe)
    {
       std::string errMsg ("Xerces failed to load the file: ");
-      errMsg.push_back(*XMLString::transcode(xe.getMessage()));
+      char *xeMsg = XMLString::transcode(xe.getMessage());
+      errMsg += xeMsg;
+      XMLString::release(&xeMsg);
+      StopParse();
       throw MeasurementException(errMsg);
    }
-
-   // Parse the TDM XML 
-   if(theDOMParser != NULL)
+   catch (...)
    {
-      theDOMParser->parse(*xmlFile);
+      StopParse();
+      throw;
+   }
 
-      // Check to see if the Schema Validation passed
-      if (theDOMParser->getErrorCount() == 0)
-      {
-         MessageInterface::ShowMessage("XML file is validated against the Schema file successfully.\n");
-      }
-	   else
-      {
-		   std::string errMsg ("Xerces failed validation: XML file does not conform to Schema: ");
-         throw MeasurementException(errMsg);
-      }  
+   if (!isParsing || (theReader->getErrorCount() != 0))
+   {
+      StopParse();
+      throw MeasurementException("Xerces failed to load the file: " +
+            tdmFileName);
    }
 
    return true;
@@ -452,19 +426,27 @@ bool TdmReadWriter::Validate(const std::string &tdmFileName)
 //------------------------------------------------------------------------------
 bool TdmReadWriter::Finalize()
 {
-   if (theDOMParser)                       // made changes by TUAN NGUYEN
+   StopParse();
+
+   if (theReader)
    {
-      delete theDOMParser;
-      theDOMParser = NULL;
+      delete theReader;
+      theReader = NULL;
+   }
+   if (theContentHandler)
+   {
+      delete theContentHandler;
+      theContentHandler = NULL;
    }
    if (theErrorHandler)                    // made changes by TUAN NGUYEN
    {
       delete theErrorHandler;
       theErrorHandler = NULL;
    }
-   xercesInitialized = false;
 
-   XMLPlatformUtils::Terminate();
+   if (xercesInitialized)
+      XMLPlatformUtils::Terminate();
+   xercesInitialized = false;
 
    return xercesInitialized;
 }
@@ -474,11 +456,7 @@ bool TdmReadWriter::Finalize()
 // bool SetBody()
 //------------------------------------------------------------------------------
 /**
- * Reads Header section of XML file (for checking the version number),
- * set the Body element and first Segment node.
- *
- * This method reads the header in XML file, and set the Body element.
- * 
+ * Reads the root element of the XML file, checking the version number.
  *
  * @param none
  *
@@ -487,45 +465,13 @@ bool TdmReadWriter::Finalize()
 //------------------------------------------------------------------------------
 bool TdmReadWriter::SetBody()
 {
-   DOMDocument *pDoc = theDOMParser->getDocument();
-	DOMElement *pTdm = pDoc->getDocumentElement();
-
-	if (pTdm->hasAttributes())
-	{
-		DOMAttr *pAttrId = pTdm->getAttributeNode(XMLString::transcode("id"));
-		if (!XMLString::equals(XMLString::transcode("CCSDS_TDM_VERS"),pAttrId->getValue()))
-		{
-			std::string errMsg = " CCSDS_TDM_VERS id is not correct";
-         throw MeasurementException(errMsg);
-		}
-
-		DOMAttr *pAttrVer = pTdm->getAttributeNode(XMLString::transcode("version"));
-		if (!XMLString::equals(XMLString::transcode("1.0"),pAttrVer->getValue()))
-		{
-			std::string errMsg = "The TDM VERSION is not correct.\n";
-			throw MeasurementException(errMsg);
-      }
-	}
-
-   //header
-   /********** No NEED to parse these.*********** /
-	DOMElement *pHeader = pTdm->getFirstElementChild();
-	DOMElement *pComments = pHeader->getFirstElementChild();
-
-	while (pComments != NULL && XMLString::equals(XMLString::transcode("COMMENT"), pComments->getTagName()))  //comments
-	{
-		pComments = pComments->getNextElementSibling();	
-	}
-	
-	//whether or not there are comments or not, we get here.
-	DOMElement * pDate = (DOMElement *)pHeader->getElementsByTagName(XMLString::transcode("CREATION_DATE"))->item(0);
-	DOMElement * pOrig = (DOMElement *)pHeader->getElementsByTagName(XMLString::transcode("ORIGINATOR"))->item(0);
-   **********************************************/
-
-   theBody = pTdm->getLastElementChild();
-   theSegment = theBody->getFirstElementChild();
+   while (!theContentHandler->IsRootFound())
+   {
+      if (!ParseNext())
+         break;
+   }
 
-   return true;
+   return theContentHandler->IsRootFound();
 }
 
 
@@ -539,15 +485,13 @@ bool TdmReadWriter::SetBody()
  * This method hashes a string to a number.
  * 
  *
- * @param char * pointing to node name
+ * @param strN The node name
  *
  * @return an enumeration value
  */
 //------------------------------------------------------------------------------
-TdmReadWriter::MetaData TdmReadWriter::HashIt(const XMLCh *xmlNodeName)
+TdmReadWriter::MetaData TdmReadWriter::HashIt(const std::string &strN)
 {
-   std::string strN(XMLString::transcode(xmlNodeName));
-
    if (strN == "TIME_SYSTEM")
       return TIME_SYSTEM;
    if (strN == "PARTICIPANT_1")
@@ -591,6 +535,94 @@ TdmReadWriter::MetaData TdmReadWriter::HashIt(const XMLCh *xmlNodeName)
 }
 
 
+//------------------------------------------------------------------------------
+// Private Methods
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+// bool ParseNext()
+//------------------------------------------------------------------------------
+/**
+ * Parses the next token of the XML file.
+ *
+ * @return true if more of the file remains, false at the end of the file
+ */
+//------------------------------------------------------------------------------
+bool TdmReadWriter::ParseNext()
+{
+   if (!isParsing)
+      return false;
+
+   try
+   {
+      isParsing = theReader->parseNext(theToken);
+   }
+   catch (...)
+   {
+      StopParse();
+      throw;
+   }
+
+   if (theContentHandler->GetError() != "")
+   {
+      std::string errMsg = theContentHandler->GetError();
+      StopParse();
+      throw MeasurementException(errMsg);
+   }
+
+   if (theReader->getErrorCount() != 0)
+   {
+      StopParse();
+      std::string errMsg ("Xerces failed validation: XML file does not conform to Schema: ");
+      throw MeasurementException(errMsg);
+   }
+
+   if (!isParsing && theContentHandler->IsDocumentEnded())
+      MessageInterface::ShowMessage("XML file is validated against the Schema file successfully.\n");
+
+   return isParsing;
+}
+
+
+//------------------------------------------------------------------------------
+// bool NextEvent()
+//------------------------------------------------------------------------------
+/**
+ * Parses the XML file until a TDM item is available.
+ *
+ * @return true if an item is available, false at the end of the file
+ */
+//------------------------------------------------------------------------------
+bool TdmReadWriter::NextEvent()
+{
+   if (theContentHandler == NULL)
+      return false;
+
+   while (!theContentHandler->HasEvent())
+   {
+      if (!ParseNext())
+         break;
+   }
+
+   return theContentHandler->HasEvent();
+}
+
+
+//------------------------------------------------------------------------------
+// void StopParse()
+//------------------------------------------------------------------------------
+/**
+ * Stops reading the current file and releases it.
+ */
+//------------------------------------------------------------------------------
+void TdmReadWriter::StopParse()
+{
+   if (isParsing && (theReader != NULL))
+      theReader->parseReset(theToken);
+   isParsing = false;
+}
+
+
 //------------------------------------------------------------------------------
 // GmatEpoch ParseEpoch()
 //------------------------------------------------------------------------------
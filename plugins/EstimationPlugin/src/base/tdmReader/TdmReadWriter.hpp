@@ -23,9 +23,10 @@
 #define TdmReadWriter_hpp
 
 #include "TdmErrorHandler.hpp"
+#include "TdmContentHandler.hpp"
 #include "ObservationData.hpp"
-#include "xercesc/parsers/XercesDOMParser.hpp"
-#include "xercesc/dom/DOM.hpp"
+#include "xercesc/sax2/SAX2XMLReader.hpp"
+#include "xercesc/framework/XMLPScanToken.hpp"
 
 /**
 * Class that implements the XML parsing details
@@ -35,6 +36,11 @@
 * work with the TDM files.
 * TdmObType class will be using this class to access the
 * observation data records.
+*
+* The file is read with a progressive SAX parse: each request for metadata or
+* an observation record parses only as far as needed to build it, so records
+* are available as soon as they are read and memory use does not grow with
+* the size of the file.  Schema validation runs as the file is read.
 */
 class  ESTIMATION_API TdmReadWriter
 {
@@ -58,22 +64,18 @@ private:
    /// An ObservationData object used to capture metadata
    ObservationData theTemplate;
 //   ObsData theTemplate;
-   /// Error Handler that Xerces DOM parser uses to pass errors/warnings to GMAT
+   /// Error Handler that the Xerces parser uses to pass errors/warnings to GMAT
    TdmErrorHandler *theErrorHandler;
-   /// Xerces DOM Parser
-   XercesDOMParser *theDOMParser;
+   /// Content Handler that turns the SAX callbacks into TDM items
+   TdmContentHandler *theContentHandler;
+   /// Xerces SAX2 reader
+   SAX2XMLReader *theReader;
+   /// Token holding the state of the progressive parse
+   XMLPScanToken theToken;
    /// Is the Xerces initialized
    bool xercesInitialized;
-   /// XML file consists of header and body
-   DOMElement *theBody;
-   /// XML file has "Segment" node(s)
-   DOMElement *theSegment;
-   /// XML file has "Data" node
-   DOMElement *theData;
-   /// XML file has "Observation" node (s)
-   DOMElement *theObservation;
-   /// Observation node Index where we left
-   int observationIndex;
+   /// Is a file being parsed
+   bool isParsing;
    /// map Transmit Band to a real number
    std::map<std::string, Real> mapTransmitBand;
 
@@ -103,7 +105,14 @@ private:
    };
 
    /// Hash the Node name to corresponding enum value
-   MetaData HashIt(const XMLCh *xmlNodeName);
+   MetaData HashIt(const std::string &strN);
+
+   /// Parse the next item of the file
+   bool ParseNext();
+   /// Make sure an item is waiting to be read, parsing as needed
+   bool NextEvent();
+   /// Stop parsing the file
+   void StopParse();
 
    /// Convert Epoch data to date and time utility values
    GmatEpoch ParseEpoch(const std::string strEpoch);
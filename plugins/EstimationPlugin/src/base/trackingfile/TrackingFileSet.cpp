@@ -193,7 +193,7 @@ TrackingFileSet::~TrackingFileSet()
    //}
    references.clear();
 
-   ionosphereCache.clear();
+   ionosphereCache.Clear();
 }
 
 //------------------------------------------------------------------------------
@@ -3130,7 +3130,21 @@ bool TrackingFileSet::GenerateTrackingConfigs(std::vector<StringArray> strandsLi
  //------------------------------------------------------------------------------
 void TrackingFileSet::ClearIonosphereCache()
 {
-   ionosphereCache.clear();
+   ionosphereCache.Clear();
+}
+
+//------------------------------------------------------------------------------
+// SignalDataCache* GetSignalDataCache()
+//------------------------------------------------------------------------------
+/**
+ * Retrieves the signal data cache shared by the adapters of the set
+ *
+ * @return The cache
+ */
+ //------------------------------------------------------------------------------
+SignalDataCache* TrackingFileSet::GetSignalDataCache()
+{
+   return &ionosphereCache;
 }
 
 
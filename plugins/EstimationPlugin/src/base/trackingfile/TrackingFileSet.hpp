@@ -167,6 +167,7 @@ public:
    bool                 GenerateTrackingConfigs(std::vector<StringArray> strandsList, std::vector<StringArray> sensorsList, StringArray typesList);
 
    void                 ClearIonosphereCache();
+   SignalDataCache*     GetSignalDataCache();
 protected:
    /**
     * Internal class used to match strand and model descriptions together, as
@@ -280,8 +281,8 @@ protected:
 
 private:
 
-   /// Cache for ionosphere corrections
-   SignalDataCache::SimpleSignalDataCache ionosphereCache;
+   /// Cache for ionosphere corrections and light time solutions
+   SignalDataCache ionosphereCache;
 
    /// Warning messages
    StringArray mesg;
@@ -43,6 +43,8 @@
 #include "EphemManager.hpp"
 #include "StringUtil.hpp"
 #include "ContactEvent.hpp"
+#include "GeometricEventSearch.hpp"
+#include "WorkerPool.hpp"
 
 //#define DEBUG_SET
 //#define DEBUG_SETREF
@@ -1149,6 +1151,13 @@ void ContactLocator::FindEvents()
 
    // Clear old events
    TakeAction("Clear", "Events");
+
+   if (searchMethod == "Native")
+   {
+      FindNativeEvents();
+      return;
+   }
+
    // @YRL
    for (Integer j = 0; j < stations.size(); j++ )
    {
@@ -1167,29 +1176,7 @@ void ContactLocator::FindEvents()
 
       // The ground station's central body should not be an occulting body
       StringArray bodiesToUse;
-      std::string currentBody;
-      std::string centralBody = stations.at(j)->GetStringParameter(
-                                stations.at(j)->GetParameterID("CentralBody"));
-      for (unsigned int ii = 0; ii < occultingBodyNames.size(); ii++)
-      {
-         currentBody = occultingBodyNames.at(ii);
-         if (currentBody == centralBody)
-         {
-//            if (!centralBodyWarningWritten)
-//            {
-               MessageInterface::ShowMessage(
-                     "*** WARNING *** Body %s is the central body for "
-                     "GroundStation %s and so will not be considered an occulting body "
-                     "for contact location.\n", centralBody.c_str(),
-                     (stations.at(j)->GetName()).c_str());
-//               centralBodyWarningWritten = true;
-//            }
-         }
-         else
-         {
-            bodiesToUse.push_back(currentBody);
-         }
-      }
+      GetOccultingBodies(stations.at(j), bodiesToUse);
 
 
       #ifdef DEBUG_CONTACT_EVENTS
@@ -1237,6 +1224,100 @@ void ContactLocator::FindEvents()
    // @YRL, upto this line
 }
 
+//------------------------------------------------------------------------------
+// void FindNativeEvents()
+//------------------------------------------------------------------------------
+/**
+ * Finds the contacts from the spacecraft states kept in memory, without
+ * CSPICE.
+ *
+ * The geometry is sampled here; the stations are then searched in parallel
+ * and the results are stored in the station order.
+ */
+//------------------------------------------------------------------------------
+void ContactLocator::FindNativeEvents()
+{
+   GeometricEventSearch search(solarSys, findStart, findStop, stepSize,
+                               useLightTimeDelay, useStellarAberration);
+   search.SetTarget(em->GetStateRecord(), em->GetCoordinateSystem());
+
+   Integer numStations = (Integer) stations.size();
+   IntegerArray stationIndex(numStations);
+   RealArray    minElAngle(numStations);
+   std::vector<IntegerArray> occulters(numStations);
+   for (Integer j = 0; j < numStations; j++)
+   {
+      stationIndex[j] = search.AddStation((BodyFixedPoint*) stations.at(j));
+      minElAngle[j]   = stations.at(j)->GetRealParameter("MinimumElevationAngle");
+
+      StringArray bodiesToUse;
+      GetOccultingBodies(stations.at(j), bodiesToUse);
+      for (unsigned int ii = 0; ii < bodiesToUse.size(); ii++)
+         occulters[j].push_back(search.AddBody(GetCelestialBody(bodiesToUse.at(ii))));
+   }
+
+   bool transmit = (GmatStringUtil::ToUpper(lightTimeDirection) == "TRANSMIT");
+   std::vector<RealArray> starts(numStations), ends(numStations);
+   WorkerPool::Instance()->Run(numStations, [&](Integer j)
+   {
+      search.FindContacts(stationIndex[j], minElAngle[j], occulters[j],
+                          transmit, starts[j], ends[j]);
+   });
+
+   for (Integer j = 0; j < numStations; j++)
+   {
+      // We want a ContactResult for each station whether or not there are events
+      ContactResult *evList = new ContactResult();
+      evList->SetObserverName(stations.at(j)->GetName());
+      for (unsigned int kk = 0; kk < starts[j].size(); kk++)
+         evList->AddEvent(new ContactEvent(starts[j].at(kk), ends[j].at(kk)));
+      contactResults.push_back(evList);
+   }
+
+   #ifdef DEBUG_CONTACT_EVENTS
+      MessageInterface::ShowMessage("ContactLocator::FindNativeEvents leaving ... \n");
+   #endif
+}
+
+//------------------------------------------------------------------------------
+// void GetOccultingBodies(GmatBase *station, StringArray &bodiesToUse)
+//------------------------------------------------------------------------------
+/**
+ * Returns the occulting bodies that apply to a station: all of them except
+ * the station's central body.
+ *
+ * @param station     The station
+ * @param bodiesToUse Receives the body names
+ */
+//------------------------------------------------------------------------------
+void ContactLocator::GetOccultingBodies(GmatBase *station,
+                                        StringArray &bodiesToUse)
+{
+   std::string currentBody;
+   std::string centralBody = station->GetStringParameter(
+                             station->GetParameterID("CentralBody"));
+   for (unsigned int ii = 0; ii < occultingBodyNames.size(); ii++)
+   {
+      currentBody = occultingBodyNames.at(ii);
+      if (currentBody == centralBody)
+      {
+//         if (!centralBodyWarningWritten)
+//         {
+            MessageInterface::ShowMessage(
+                  "*** WARNING *** Body %s is the central body for "
+                  "GroundStation %s and so will not be considered an occulting body "
+                  "for contact location.\n", centralBody.c_str(),
+                  (station->GetName()).c_str());
+//            centralBodyWarningWritten = true;
+//         }
+      }
+      else
+      {
+         bodiesToUse.push_back(currentBody);
+      }
+   }
+}
+
 //------------------------------------------------------------------------------
 // std::string GetAbcorrString()
 //------------------------------------------------------------------------------
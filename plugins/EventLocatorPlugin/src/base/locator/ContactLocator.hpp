@@ -164,6 +164,9 @@ protected:
     static const std::string LT_DIRECTIONS[2];
 
     virtual void         FindEvents();
+    void                 FindNativeEvents();
+    void                 GetOccultingBodies(GmatBase *station,
+                                            StringArray &bodiesToUse);
     virtual std::string  GetAbcorrString();
 };
 
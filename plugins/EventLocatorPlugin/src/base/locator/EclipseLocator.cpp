@@ -41,6 +41,8 @@
 #include "EphemManager.hpp"
 #include "EclipseEvent.hpp"
 #include "StringUtil.hpp"
+#include "GeometricEventSearch.hpp"
+#include "WorkerPool.hpp"
 
 
 //#define DEBUG_TYPELIST
@@ -883,36 +885,43 @@ void EclipseLocator::FindEvents()
    #ifdef DEBUG_TIME_SPENT
    t = clock();
    #endif
-   for (Integer ii = 0; ii < occultingBodies.size(); ii++)
+   if (searchMethod == "Native")
    {
-      CelestialBody *body = (CelestialBody*) occultingBodies.at(ii);
-      Integer bodyNaifId  = body->GetIntegerParameter(body->GetParameterID("NAIFId"));
-      theFront  = GmatStringUtil::Trim(GmatStringUtil::ToString(bodyNaifId));
-      bodyName  = body->GetName();
-      theFFrame = body->GetStringParameter(body->GetParameterID("SpiceFrameId"));
-
-      for (Integer jj = 0; jj < eclipseTypes.size(); jj++)
+      FindNativeEvents(rawList);
+   }
+   else
+   {
+      for (Integer ii = 0; ii < occultingBodies.size(); ii++)
       {
-         starts.clear();
-         ends.clear();
-
-         em->GetOccultationIntervals(eclipseTypes.at(jj), theFront, theFShape, theFFrame,
-                                     theBack, theBShape, theBFrame, theAbCorr,
-                                     initialEp, finalEp, useEntireInterval, stepSize,
-                                     numEclipse, starts, ends);
-
-         #ifdef DEBUG_ECLIPSE_EVENTS
-//            MessageInterface::ShowMessage("After gfoclt_c:\n");
-//            MessageInterface::ShowMessage("  numEclipse = %d\n", numEclipse);
-         #endif
-         // Create an event from the result
-         for (Integer kk = 0; kk < numEclipse; kk++)
+         CelestialBody *body = (CelestialBody*) occultingBodies.at(ii);
+         Integer bodyNaifId  = body->GetIntegerParameter(body->GetParameterID("NAIFId"));
+         theFront  = GmatStringUtil::Trim(GmatStringUtil::ToString(bodyNaifId));
+         bodyName  = body->GetName();
+         theFFrame = body->GetStringParameter(body->GetParameterID("SpiceFrameId"));
+
+         for (Integer jj = 0; jj < eclipseTypes.size(); jj++)
          {
-            Real s1 = starts.at(kk);
-            Real e1 = ends.at(kk);
-//            EclipseEvent *newEvent = new EclipseEvent(s1, e1, eclipseTypes.at(jj), theFront);
-            EclipseEvent *newEvent = new EclipseEvent(s1, e1, eclipseTypes.at(jj), bodyName);
-            rawList->AddEvent(newEvent);
+            starts.clear();
+            ends.clear();
+
+            em->GetOccultationIntervals(eclipseTypes.at(jj), theFront, theFShape, theFFrame,
+                                        theBack, theBShape, theBFrame, theAbCorr,
+                                        initialEp, finalEp, useEntireInterval, stepSize,
+                                        numEclipse, starts, ends);
+
+            #ifdef DEBUG_ECLIPSE_EVENTS
+//               MessageInterface::ShowMessage("After gfoclt_c:\n");
+//               MessageInterface::ShowMessage("  numEclipse = %d\n", numEclipse);
+            #endif
+            // Create an event from the result
+            for (Integer kk = 0; kk < numEclipse; kk++)
+            {
+               Real s1 = starts.at(kk);
+               Real e1 = ends.at(kk);
+//               EclipseEvent *newEvent = new EclipseEvent(s1, e1, eclipseTypes.at(jj), theFront);
+               EclipseEvent *newEvent = new EclipseEvent(s1, e1, eclipseTypes.at(jj), bodyName);
+               rawList->AddEvent(newEvent);
+            }
          }
       }
    }
@@ -1030,3 +1039,45 @@ void EclipseLocator::FindEvents()
    }
 //   delete rawList;
 }
+
+//------------------------------------------------------------------------------
+// void FindNativeEvents(EclipseTotalEvent *rawList)
+//------------------------------------------------------------------------------
+/**
+ * Finds the eclipses from the spacecraft states kept in memory, without
+ * CSPICE.
+ *
+ * Each body and eclipse type is searched in parallel; the events are added to
+ * the list in the same order as the CSPICE search adds them.
+ *
+ * @param rawList The list receiving the events
+ */
+//------------------------------------------------------------------------------
+void EclipseLocator::FindNativeEvents(EclipseTotalEvent *rawList)
+{
+   GeometricEventSearch search(solarSys, findStart, findStop, stepSize,
+                               useLightTimeDelay, useStellarAberration);
+   search.SetTarget(em->GetStateRecord(), em->GetCoordinateSystem());
+
+   Integer numBodies = (Integer) occultingBodies.size();
+   Integer numTypes  = (Integer) eclipseTypes.size();
+   IntegerArray bodyIndex(numBodies);
+   for (Integer ii = 0; ii < numBodies; ii++)
+      bodyIndex[ii] = search.AddBody((CelestialBody*) occultingBodies.at(ii));
+
+   std::vector<RealArray> starts(numBodies * numTypes), ends(numBodies * numTypes);
+   WorkerPool::Instance()->Run(numBodies * numTypes, [&](Integer task)
+   {
+      Integer ii = task / numTypes, jj = task % numTypes;
+      search.FindEclipses(bodyIndex[ii], eclipseTypes.at(jj), starts[task],
+                          ends[task]);
+   });
+
+   for (Integer task = 0; task < numBodies * numTypes; task++)
+   {
+      std::string bodyName = occultingBodies.at(task / numTypes)->GetName();
+      for (unsigned int kk = 0; kk < starts[task].size(); kk++)
+         rawList->AddEvent(new EclipseEvent(starts[task].at(kk),
+               ends[task].at(kk), eclipseTypes.at(task % numTypes), bodyName));
+   }
+}
@@ -130,6 +130,7 @@ protected:
        PARAMETER_TYPE[EclipseLocatorParamCount - EventLocatorParamCount];
 
     virtual void FindEvents();
+    void         FindNativeEvents(EclipseTotalEvent *rawList);
 };
 
 #endif /* EclipseLocator_hpp */
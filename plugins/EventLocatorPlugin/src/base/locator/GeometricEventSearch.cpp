@@ -0,0 +1,1047 @@
+//$Id$
+//------------------------------------------------------------------------------
+//                           GeometricEventSearch
+//------------------------------------------------------------------------------
+// GMAT: General Mission Analysis Tool.
+//
+// Copyright (c) 2002 - 2020 United States Government as represented by the
+// Administrator of The National Aeronautics and Space Administration.
+// All Other Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// You may not use this file except in compliance with the License.
+// You may obtain a copy of the License at:
+// http://www.apache.org/licenses/LICENSE-2.0.
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied.   See the License for the specific language
+// governing permissions and limitations under the License.
+//
+// Author: GMAT Development Team
+// Created: 2026/10/17
+//
+/**
+ * Implementation of the in-memory contact and eclipse search
+ */
+//------------------------------------------------------------------------------
+
+#include "GeometricEventSearch.hpp"
+#include "Ephemeris.hpp"
+#include "CoordinateSystem.hpp"
+#include "CoordinateConverter.hpp"
+#include "CelestialBody.hpp"
+#include "BodyFixedPoint.hpp"
+#include "SolarSystem.hpp"
+#include "BrentDekkerZero.hpp"
+#include "EventException.hpp"
+#include "GmatConstants.hpp"
+#include "MessageInterface.hpp"
+#include <algorithm>
+#include <cmath>
+
+//#define DEBUG_NATIVE_SEARCH
+//#define DEBUG_NATIVE_TABLES
+
+
+//------------------------------------------------------------------------------
+// Static data
+//------------------------------------------------------------------------------
+const Real GeometricEventSearch::MAX_SAMPLE_ANGLE = 0.05;
+const Real GeometricEventSearch::MAX_SAMPLE_STEP  = 600.0;
+const Real GeometricEventSearch::TIME_TOLERANCE   = 1.0e-6;
+
+namespace
+{
+   /// Speed of light in km/s
+   const Real C_KMS = GmatPhysicalConstants::SPEED_OF_LIGHT_VACUUM / 1000.0;
+
+   Real Dot(const Real *a, const Real *b)
+   {
+      return a[0]*b[0] + a[1]*b[1] + a[2]*b[2];
+   }
+
+   Real Norm(const Real *a)
+   {
+      return sqrt(Dot(a, a));
+   }
+
+   /// Angular rate of a state about its origin, rad/s
+   Real AngularRate(const Real *state)
+   {
+      Real r2 = Dot(state, state);
+      if (r2 == 0.0)
+         return 0.0;
+      Real h[3] = { state[1]*state[5] - state[2]*state[4],
+                    state[2]*state[3] - state[0]*state[5],
+                    state[0]*state[4] - state[1]*state[3] };
+      return Norm(h) / r2;
+   }
+}
+
+
+//------------------------------------------------------------------------------
+// public methods
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+// GeometricEventSearch(SolarSystem *solarSystem, Real startEpoch,
+//       Real stopEpoch, Real stepSize, bool useLightTime,
+//       bool useStellarAberration)
+//------------------------------------------------------------------------------
+/**
+ * Constructor
+ *
+ * @param solarSystem          The solar system in use
+ * @param startEpoch           Start of the search window (A1Mjd)
+ * @param stopEpoch            End of the search window (A1Mjd)
+ * @param stepSize             Event function sampling step, in seconds
+ * @param useLightTime         Apply light time to the observed positions?
+ * @param useStellarAberration Apply stellar aberration to the station
+ *                             elevation?  Only used with light time.
+ */
+//------------------------------------------------------------------------------
+GeometricEventSearch::GeometricEventSearch(SolarSystem *solarSystem,
+      Real startEpoch, Real stopEpoch, Real stepSize, bool useLightTime,
+      bool useStellarAberration) :
+   solarSys          (solarSystem),
+   j2000Body         (NULL),
+   searchStart       (startEpoch),
+   searchStop        (stopEpoch),
+   searchSpan        ((stopEpoch - startEpoch) * GmatTimeConstants::SECS_PER_DAY),
+   stepSize          (stepSize),
+   useLightTime      (useLightTime),
+   useAberration     (useLightTime && useStellarAberration),
+   targetSet         (false),
+   sunIndex          (-1)
+{
+   if (this->stepSize <= 0.0)
+      throw EventException("The event search step size must be positive\n");
+   if (searchSpan < 0.0)
+      searchSpan = 0.0;
+}
+
+
+//------------------------------------------------------------------------------
+// ~GeometricEventSearch()
+//------------------------------------------------------------------------------
+GeometricEventSearch::~GeometricEventSearch()
+{
+}
+
+
+//------------------------------------------------------------------------------
+// void SetTarget(Ephemeris *record, CoordinateSystem *recordCs)
+//------------------------------------------------------------------------------
+/**
+ * Samples the target (the spacecraft) from its recorded states.
+ *
+ * The table spacing starts at the smaller of the step size and a minute, and
+ * is reduced if the target turns through more than MAX_SAMPLE_ANGLE between
+ * samples.  The Sun is added as a body here; the light time margins of the
+ * body tables need the target.
+ *
+ * @param record   The recorded states
+ * @param recordCs The coordinate system of the states; its axes must be
+ *                 MJ2000Eq
+ */
+//------------------------------------------------------------------------------
+void GeometricEventSearch::SetTarget(Ephemeris *record,
+                                     CoordinateSystem *recordCs)
+{
+   GmatEpoch coverStart, coverStop;
+   if ((record == NULL) || !record->GetCoverage(coverStart, coverStop))
+      throw EventException("No spacecraft states were recorded for the "
+            "native event search\n");
+   if (recordCs == NULL)
+      throw EventException("The coordinate system of the recorded "
+            "spacecraft states is not set\n");
+
+   j2000Body = recordCs->GetJ2000Body();
+   SpacePoint *origin = recordCs->GetOrigin();
+   bool offset = (origin != j2000Body);
+
+   // Stay inside the recorded span; transmit light time only needs a little
+   // room past the search window
+   Real from = (coverStart - searchStart) * GmatTimeConstants::SECS_PER_DAY;
+   Real to   = (coverStop  - searchStart) * GmatTimeConstants::SECS_PER_DAY;
+   from = std::max(from, -60.0);
+   to   = std::min(to, searchSpan + 60.0);
+   if (to <= from)
+      throw EventException("The search window is outside of the recorded "
+            "spacecraft states\n");
+
+   Real step = std::min(stepSize, 60.0);
+   for (Integer pass = 0; pass < 2; ++pass)
+   {
+      BuildTable(target, from, to, step);
+
+      Real maxRate = 0.0;
+      for (Integer i = 0; i < target.count; ++i)
+      {
+         Real epoch = searchStart + (target.start + i * target.step) /
+               GmatTimeConstants::SECS_PER_DAY;
+         epoch = std::max(coverStart, std::min(coverStop, epoch));
+
+         Rvector6 state = record->InterpolatePoint(epoch);
+         Real *sample = &target.data[6*i];
+         for (Integer j = 0; j < 6; ++j)
+            sample[j] = state[j];
+         maxRate = std::max(maxRate, AngularRate(sample));
+
+         if (offset)
+         {
+            Rvector6 originState = origin->GetMJ2000State(A1Mjd(epoch));
+            for (Integer j = 0; j < 6; ++j)
+               sample[j] += originState[j];
+         }
+      }
+
+      if (maxRate * target.step <= MAX_SAMPLE_ANGLE)
+         break;
+      step = MAX_SAMPLE_ANGLE / maxRate;
+   }
+
+   #ifdef DEBUG_NATIVE_TABLES
+      MessageInterface::ShowMessage("GeometricEventSearch: target table has "
+            "%d samples, step %.3lf s\n", target.count, target.step);
+   #endif
+
+   targetSet = true;
+   sunIndex  = AddBody(solarSys->GetBody(SolarSystem::SUN_NAME));
+}
+
+
+//------------------------------------------------------------------------------
+// Integer AddBody(CelestialBody *body)
+//------------------------------------------------------------------------------
+/**
+ * Samples a celestial body over the search window.
+ *
+ * The table is extended past the window by the light time to the target, so
+ * light time corrected positions stay inside it.
+ *
+ * @param body The body
+ *
+ * @return The index used for the body in the searches
+ */
+//------------------------------------------------------------------------------
+Integer GeometricEventSearch::AddBody(CelestialBody *body)
+{
+   if (!targetSet)
+      throw EventException("The target must be set before bodies are added "
+            "to the native event search\n");
+   if (body == NULL)
+      throw EventException("Unknown body passed to the native event search\n");
+
+   for (UnsignedInt i = 0; i < bodies.size(); ++i)
+      if (bodies[i].body == body)
+         return (Integer)i;
+
+   BodyData data;
+   data.body    = body;
+   data.radius  = body->GetEquatorialRadius();
+   Real polar   = body->GetPolarRadius();
+   data.stretch = (polar > 0.0 ? data.radius / polar : 1.0);
+   data.spinAxis[0] = data.spinAxis[1] = 0.0;
+   data.spinAxis[2] = 1.0;
+
+   // Light time margin and table spacing from a few samples
+   Real margin = 0.0, rate = 0.0, tgt[3];
+   for (Integer i = 0; i < 3; ++i)
+   {
+      Real t = 0.5 * i * searchSpan;
+      Rvector6 state = body->GetMJ2000State(A1Mjd(searchStart + t /
+            GmatTimeConstants::SECS_PER_DAY));
+      TargetAt(t, tgt);
+      Real rel[3] = { state[0] - tgt[0], state[1] - tgt[1], state[2] - tgt[2] };
+      margin = std::max(margin, Norm(rel));
+      rate   = std::max(rate, AngularRate(state.GetDataVector()));
+   }
+   margin = (useLightTime ? 1.5 * margin / C_KMS : 0.0);
+
+   Real step = MAX_SAMPLE_STEP;
+   if (rate * step > MAX_SAMPLE_ANGLE)
+      step = MAX_SAMPLE_ANGLE / rate;
+
+   BuildTable(data.table, -margin - step, searchSpan + margin + step, step);
+   for (Integer i = 0; i < data.table.count; ++i)
+   {
+      Real epoch = searchStart + (data.table.start + i * data.table.step) /
+            GmatTimeConstants::SECS_PER_DAY;
+      Rvector6 state = body->GetMJ2000State(A1Mjd(epoch));
+      for (Integer j = 0; j < 6; ++j)
+         data.table.data[6*i + j] = state[j];
+   }
+
+   // The spin axis only matters for oblate bodies; its motion over a search
+   // window is negligible for the scaling
+   if (data.stretch != 1.0)
+   {
+      CoordinateSystem *bodyFixed = CoordinateSystem::CreateLocalCoordinateSystem(
+            "NativeSearchBodyFixed", "BodyFixed", body, NULL, NULL, j2000Body,
+            solarSys);
+      CoordinateSystem *inertial = CoordinateSystem::CreateLocalCoordinateSystem(
+            "NativeSearchInertial", "MJ2000Eq", body, NULL, NULL, j2000Body,
+            solarSys);
+
+      CoordinateConverter cc;
+      Real pole[6] = { 0.0, 0.0, 1.0, 0.0, 0.0, 0.0 }, axis[6];
+      cc.Convert(A1Mjd(0.5 * (searchStart + searchStop)), pole, bodyFixed,
+            axis, inertial, false, true);
+      Real mag = Norm(axis);
+      for (Integer j = 0; j < 3; ++j)
+         data.spinAxis[j] = axis[j] / mag;
+
+      delete bodyFixed;
+      delete inertial;
+   }
+
+   #ifdef DEBUG_NATIVE_TABLES
+      MessageInterface::ShowMessage("GeometricEventSearch: %s table has %d "
+            "samples, step %.3lf s, margin %.3lf s\n", body->GetName().c_str(),
+            data.table.count, data.table.step, margin);
+   #endif
+
+   bodies.push_back(data);
+   return (Integer)bodies.size() - 1;
+}
+
+
+//------------------------------------------------------------------------------
+// Integer AddStation(BodyFixedPoint *station)
+//------------------------------------------------------------------------------
+/**
+ * Samples a station and its local vertical over the search window.
+ *
+ * The station is converted from its body-fixed frame in one array call; the
+ * local vertical is the normal to the central body's ellipsoid, as used for
+ * the station's topocentric frame.
+ *
+ * @param station The station
+ *
+ * @return The index used for the station in the searches
+ */
+//------------------------------------------------------------------------------
+Integer GeometricEventSearch::AddStation(BodyFixedPoint *station)
+{
+   std::string cbName = station->GetStringParameter("CentralBody");
+   CelestialBody *cb = solarSys->GetBody(cbName);
+   CoordinateSystem *bodyFixed = station->GetBodyFixedCoordinateSystem();
+   if ((cb == NULL) || (bodyFixed == NULL))
+      throw EventException("The station " + station->GetName() +
+            " is not initialized for the native event search\n");
+
+   StationData data;
+   data.centralBody = AddBody(cb);
+
+   Rvector3 location = station->GetBodyFixedLocation(A1Mjd(searchStart));
+   Real a = cb->GetEquatorialRadius(), b = cb->GetPolarRadius();
+   Real normal[3] = { location[0] / (a*a), location[1] / (a*a),
+                      location[2] / (b*b) };
+   Real mag = Norm(normal);
+
+   CoordinateSystem *inertial = CoordinateSystem::CreateLocalCoordinateSystem(
+         "NativeSearchStationInertial", "MJ2000Eq", cb, NULL, NULL, j2000Body,
+         solarSys);
+   CoordinateConverter cc;
+
+   // Station motion is the body's rotation
+   Real bfState[6] = { location[0], location[1], location[2], 0.0, 0.0, 0.0 };
+   Real state[6];
+   cc.Convert(A1Mjd(searchStart), bfState, bodyFixed, state, inertial);
+   Real rate = AngularRate(state);
+   Real step = MAX_SAMPLE_STEP;
+   if (rate * step > MAX_SAMPLE_ANGLE)
+      step = MAX_SAMPLE_ANGLE / rate;
+
+   BuildTable(data.table, -step, searchSpan + step, step);
+   BuildTable(data.up,    -step, searchSpan + step, step);
+
+   Integer count = data.table.count;
+   RealArray epochs(count), positions(6 * count), normals(6 * count);
+   for (Integer i = 0; i < count; ++i)
+   {
+      epochs[i] = searchStart + (data.table.start + i * data.table.step) /
+            GmatTimeConstants::SECS_PER_DAY;
+      for (Integer j = 0; j < 3; ++j)
+      {
+         positions[6*i + j]   = location[j];
+         positions[6*i + j+3] = 0.0;
+         normals[6*i + j]     = normal[j] / mag;
+         normals[6*i + j+3]   = 0.0;
+      }
+   }
+   cc.Convert(count, &epochs[0], &positions[0], bodyFixed, &data.table.data[0],
+         inertial);
+   cc.Convert(count, &epochs[0], &normals[0], bodyFixed, &data.up.data[0],
+         inertial, false, true);
+
+   delete inertial;
+
+   #ifdef DEBUG_NATIVE_TABLES
+      MessageInterface::ShowMessage("GeometricEventSearch: station %s table "
+            "has %d samples, step %.3lf s\n", station->GetName().c_str(),
+            count, data.table.step);
+   #endif
+
+   stations.push_back(data);
+   return (Integer)stations.size() - 1;
+}
+
+
+//------------------------------------------------------------------------------
+// void FindContacts(Integer station, Real minElevation,
+//       const IntegerArray &occulters, bool transmit, RealArray &starts,
+//       RealArray &ends) const
+//------------------------------------------------------------------------------
+/**
+ * Finds the intervals when the target is above the station's minimum
+ * elevation and not hidden by any of the occulting bodies.
+ *
+ * @param station      Index from AddStation()
+ * @param minElevation Minimum elevation angle, in degrees
+ * @param occulters    Body indices from AddBody()
+ * @param transmit     Light time direction: true when the station transmits
+ * @param starts       Receives the interval starts (A1Mjd)
+ * @param ends         Receives the interval ends (A1Mjd)
+ */
+//------------------------------------------------------------------------------
+void GeometricEventSearch::FindContacts(Integer station, Real minElevation,
+      const IntegerArray &occulters, bool transmit, RealArray &starts,
+      RealArray &ends) const
+{
+   EventContext context;
+   context.station      = station;
+   context.body         = -1;
+   context.type         = 0;
+   context.transmit     = transmit;
+   context.minElevation = minElevation * GmatMathConstants::RAD_PER_DEG;
+
+   RealArray visStarts, visEnds;
+   Search(&GeometricEventSearch::Elevation, context, 0.0, searchSpan,
+          visStarts, visEnds);
+
+   // Occultations only matter while the target is above the horizon
+   RealArray cutStarts, cutEnds;
+   for (UnsignedInt i = 0; i < occulters.size(); ++i)
+   {
+      context.body = occulters[i];
+      for (UnsignedInt j = 0; j < visStarts.size(); ++j)
+         Search(&GeometricEventSearch::Occultation, context, visStarts[j],
+                visEnds[j], cutStarts, cutEnds);
+   }
+   Subtract(visStarts, visEnds, cutStarts, cutEnds);
+
+   starts.clear();
+   ends.clear();
+   for (UnsignedInt i = 0; i < visStarts.size(); ++i)
+   {
+      starts.push_back(searchStart + visStarts[i] /
+            GmatTimeConstants::SECS_PER_DAY);
+      ends.push_back(searchStart + visEnds[i] /
+            GmatTimeConstants::SECS_PER_DAY);
+   }
+}
+
+
+//------------------------------------------------------------------------------
+// void FindEclipses(Integer body, const std::string &eclipseType,
+//       RealArray &starts, RealArray &ends) const
+//------------------------------------------------------------------------------
+/**
+ * Finds the intervals when the body hides the Sun from the target.
+ *
+ * @param body        Index from AddBody()
+ * @param eclipseType "Umbra" (Sun fully hidden), "Penumbra" (partly hidden)
+ *                    or "Antumbra" (body inside the solar disk)
+ * @param starts      Receives the interval starts (A1Mjd)
+ * @param ends        Receives the interval ends (A1Mjd)
+ */
+//------------------------------------------------------------------------------
+void GeometricEventSearch::FindEclipses(Integer body,
+      const std::string &eclipseType, RealArray &starts, RealArray &ends) const
+{
+   EventContext context;
+   context.station      = -1;
+   context.body         = body;
+   context.transmit     = false;
+   context.minElevation = 0.0;
+   if (eclipseType == "Umbra")
+      context.type = 0;
+   else if (eclipseType == "Penumbra")
+      context.type = 1;
+   else if (eclipseType == "Antumbra")
+      context.type = 2;
+   else
+      throw EventException("Unknown eclipse type \"" + eclipseType +
+            "\" in the native event search\n");
+
+   RealArray inStarts, inEnds;
+   Search(&GeometricEventSearch::Shadow, context, 0.0, searchSpan,
+          inStarts, inEnds);
+
+   starts.clear();
+   ends.clear();
+   for (UnsignedInt i = 0; i < inStarts.size(); ++i)
+   {
+      starts.push_back(searchStart + inStarts[i] /
+            GmatTimeConstants::SECS_PER_DAY);
+      ends.push_back(searchStart + inEnds[i] /
+            GmatTimeConstants::SECS_PER_DAY);
+   }
+}
+
+
+//------------------------------------------------------------------------------
+// protected methods
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+// void BuildTable(SampleTable &table, Real start, Real stop, Real step)
+//------------------------------------------------------------------------------
+/**
+ * Sizes a table to span [start, stop] with at most the given spacing.
+ *
+ * The spacing is adjusted so samples fall on both ends of the span.
+ */
+//------------------------------------------------------------------------------
+void GeometricEventSearch::BuildTable(SampleTable &table, Real start,
+                                      Real stop, Real step)
+{
+   Integer intervals = (Integer)ceil((stop - start) / step);
+   if (intervals < 1)
+      intervals = 1;
+
+   table.start = start;
+   table.count = intervals + 1;
+   table.step  = (stop > start ? (stop - start) / intervals : step);
+   table.data.assign(6 * table.count, 0.0);
+}
+
+
+//------------------------------------------------------------------------------
+// void Evaluate(const SampleTable &table, Real t, Real *pos, Real *vel) const
+//------------------------------------------------------------------------------
+/**
+ * Cubic Hermite interpolation of a table; times past the ends use the end
+ * intervals.
+ *
+ * @param table The table
+ * @param t     Time in seconds from the search start
+ * @param pos   Receives the position
+ * @param vel   Receives the velocity, if not NULL
+ */
+//------------------------------------------------------------------------------
+void GeometricEventSearch::Evaluate(const SampleTable &table, Real t,
+                                    Real *pos, Real *vel) const
+{
+   Real x = (t - table.start) / table.step;
+   Integer k = (Integer)floor(x);
+   if (k < 0)
+      k = 0;
+   if (k > table.count - 2)
+      k = table.count - 2;
+
+   Real s  = x - k, s2 = s * s, s3 = s2 * s, h = table.step;
+   const Real *p0 = &table.data[6*k], *p1 = p0 + 6;
+
+   Real h00 = 2.0*s3 - 3.0*s2 + 1.0, h10 = s3 - 2.0*s2 + s;
+   Real h01 = -2.0*s3 + 3.0*s2,      h11 = s3 - s2;
+   for (Integer i = 0; i < 3; ++i)
+      pos[i] = h00 * p0[i] + h10 * h * p0[i+3] + h01 * p1[i] +
+               h11 * h * p1[i+3];
+
+   if (vel != NULL)
+   {
+      Real d00 = 6.0*s2 - 6.0*s,       d10 = 3.0*s2 - 4.0*s + 1.0;
+      Real d01 = -6.0*s2 + 6.0*s,      d11 = 3.0*s2 - 2.0*s;
+      for (Integer i = 0; i < 3; ++i)
+         vel[i] = (d00 * p0[i] + d01 * p1[i]) / h + d10 * p0[i+3] +
+                  d11 * p1[i+3];
+   }
+}
+
+
+//------------------------------------------------------------------------------
+// void TargetAt(Real t, Real *pos, Real *vel) const
+//------------------------------------------------------------------------------
+void GeometricEventSearch::TargetAt(Real t, Real *pos, Real *vel) const
+{
+   Evaluate(target, t, pos, vel);
+}
+
+
+//------------------------------------------------------------------------------
+// void BodyAt(Integer body, Real t, Real *pos, Real *vel) const
+//------------------------------------------------------------------------------
+void GeometricEventSearch::BodyAt(Integer body, Real t, Real *pos,
+                                  Real *vel) const
+{
+   Evaluate(bodies[body].table, t, pos, vel);
+}
+
+
+//------------------------------------------------------------------------------
+// void StationAt(Integer station, Real t, Real *pos, Real *vel, Real *up) const
+//------------------------------------------------------------------------------
+/**
+ * Station position, velocity and unit local vertical at a time.
+ */
+//------------------------------------------------------------------------------
+void GeometricEventSearch::StationAt(Integer station, Real t, Real *pos,
+                                     Real *vel, Real *up) const
+{
+   const StationData &data = stations[station];
+   Real cbPos[3], cbVel[3];
+   BodyAt(data.centralBody, t, cbPos, cbVel);
+   Evaluate(data.table, t, pos, vel);
+   Evaluate(data.up, t, up);
+
+   Real mag = Norm(up);
+   for (Integer i = 0; i < 3; ++i)
+   {
+      pos[i] += cbPos[i];
+      vel[i] += cbVel[i];
+      up[i]  /= mag;
+   }
+}
+
+
+//------------------------------------------------------------------------------
+// Real LightTimeTarget(const Real *from, Real t, bool transmit, Real *pos) const
+//------------------------------------------------------------------------------
+/**
+ * Position of the target as seen from an observer, with converged light time.
+ *
+ * @param from     Observer position at t
+ * @param t        Observation time, seconds from the search start
+ * @param transmit true for a signal sent from the observer at t
+ * @param pos      Receives the target position
+ *
+ * @return The light time, in seconds
+ */
+//------------------------------------------------------------------------------
+Real GeometricEventSearch::LightTimeTarget(const Real *from, Real t,
+                                           bool transmit, Real *pos) const
+{
+   Real lt = 0.0;
+   TargetAt(t, pos);
+   if (!useLightTime)
+      return lt;
+
+   Real sign = (transmit ? 1.0 : -1.0);
+   for (Integer i = 0; i < 3; ++i)
+   {
+      Real rel[3] = { pos[0] - from[0], pos[1] - from[1], pos[2] - from[2] };
+      lt = Norm(rel) / C_KMS;
+      TargetAt(t + sign * lt, pos);
+   }
+   return lt;
+}
+
+
+//------------------------------------------------------------------------------
+// Real LightTimeBody(Integer body, const Real *from, Real t, bool transmit,
+//                    Real *pos) const
+//------------------------------------------------------------------------------
+/**
+ * Position of a body as seen from an observer, with converged light time.
+ *
+ * @see LightTimeTarget()
+ */
+//------------------------------------------------------------------------------
+Real GeometricEventSearch::LightTimeBody(Integer body, const Real *from,
+                                         Real t, bool transmit, Real *pos) const
+{
+   Real lt = 0.0;
+   BodyAt(body, t, pos);
+   if (!useLightTime)
+      return lt;
+
+   Real sign = (transmit ? 1.0 : -1.0);
+   for (Integer i = 0; i < 3; ++i)
+   {
+      Real rel[3] = { pos[0] - from[0], pos[1] - from[1], pos[2] - from[2] };
+      lt = Norm(rel) / C_KMS;
+      BodyAt(body, t + sign * lt, pos);
+   }
+   return lt;
+}
+
+
+//------------------------------------------------------------------------------
+// void Stretch(Integer body, const Real *center, const Real *point,
+//              Real *scaled) const
+//------------------------------------------------------------------------------
+/**
+ * Maps a point into the frame where the body is a sphere of its equatorial
+ * radius: relative to the body center, scaled along the spin axis.
+ */
+//------------------------------------------------------------------------------
+void GeometricEventSearch::Stretch(Integer body, const Real *center,
+                                   const Real *point, Real *scaled) const
+{
+   const BodyData &data = bodies[body];
+   Real rel[3] = { point[0] - center[0], point[1] - center[1],
+                   point[2] - center[2] };
+   Real along = (data.stretch - 1.0) * Dot(rel, data.spinAxis);
+   for (Integer i = 0; i < 3; ++i)
+      scaled[i] = rel[i] + along * data.spinAxis[i];
+}
+
+
+//------------------------------------------------------------------------------
+// Real Elevation(Real t, const EventContext &context) const
+//------------------------------------------------------------------------------
+/**
+ * Elevation of the target above the station's minimum elevation, in radians.
+ */
+//------------------------------------------------------------------------------
+Real GeometricEventSearch::Elevation(Real t, const EventContext &context) const
+{
+   Real rs[3], vs[3], up[3], rt[3];
+   StationAt(context.station, t, rs, vs, up);
+   LightTimeTarget(rs, t, context.transmit, rt);
+
+   Real rho[3] = { rt[0] - rs[0], rt[1] - rs[1], rt[2] - rs[2] };
+   if (useAberration)
+   {
+      // First order stellar aberration from the observer's velocity with
+      // respect to the solar system barycenter (approximated by the Sun)
+      Real sunPos[3], sunVel[3];
+      BodyAt(sunIndex, t, sunPos, sunVel);
+      Real range = Norm(rho);
+      Real sign  = (context.transmit ? -1.0 : 1.0);
+      for (Integer i = 0; i < 3; ++i)
+         rho[i] = rho[i] / range + sign * (vs[i] - sunVel[i]) / C_KMS;
+   }
+
+   Real sinEl = Dot(rho, up) / Norm(rho);
+   sinEl = std::max(-1.0, std::min(1.0, sinEl));
+   return asin(sinEl) - context.minElevation;
+}
+
+
+//------------------------------------------------------------------------------
+// Real Occultation(Real t, const EventContext &context) const
+//------------------------------------------------------------------------------
+/**
+ * Depth of the station-target line of sight inside the body, in km.
+ *
+ * Positive when the body hides the target from the station.  Measured in the
+ * body's scaled frame, where the body is a sphere.
+ */
+//------------------------------------------------------------------------------
+Real GeometricEventSearch::Occultation(Real t, const EventContext &context)
+      const
+{
+   Real rs[3], vs[3], up[3], rt[3], rb[3];
+   StationAt(context.station, t, rs, vs, up);
+   LightTimeTarget(rs, t, context.transmit, rt);
+   LightTimeBody(context.body, rs, t, context.transmit, rb);
+
+   Real from[3], to[3];
+   Stretch(context.body, rb, rs, from);
+   Stretch(context.body, rb, rt, to);
+
+   // Distance from the body center to the segment from station to target
+   Real d[3] = { to[0] - from[0], to[1] - from[1], to[2] - from[2] };
+   Real len2 = Dot(d, d);
+   Real s = (len2 > 0.0 ? -Dot(from, d) / len2 : 0.0);
+   s = std::max(0.0, std::min(1.0, s));
+   Real closest[3] = { from[0] + s*d[0], from[1] + s*d[1], from[2] + s*d[2] };
+
+   return bodies[context.body].radius - Norm(closest);
+}
+
+
+//------------------------------------------------------------------------------
+// Real Shadow(Real t, const EventContext &context) const
+//------------------------------------------------------------------------------
+/**
+ * Eclipse function of the requested type, in radians; positive in eclipse.
+ *
+ * Uses the apparent angular radii of the body (rb) and the Sun (rs) and their
+ * angular separation (theta) as seen from the target:
+ *    Umbra:    theta <= rb - rs
+ *    Antumbra: theta <= rs - rb
+ *    Penumbra: |rb - rs| < theta < rb + rs
+ */
+//------------------------------------------------------------------------------
+Real GeometricEventSearch::Shadow(Real t, const EventContext &context) const
+{
+   Real rt[3], rb[3], rsun[3];
+   TargetAt(t, rt);
+   LightTimeBody(context.body, rt, t, false, rb);
+   LightTimeBody(sunIndex, rt, t, false, rsun);
+
+   // Work in the body's scaled frame, with the target as the origin
+   Real obs[3], sun[3];
+   Stretch(context.body, rb, rt, obs);
+   Stretch(context.body, rb, rsun, sun);
+   Real toBody[3] = { -obs[0], -obs[1], -obs[2] };
+   Real toSun[3]  = { sun[0] - obs[0], sun[1] - obs[1], sun[2] - obs[2] };
+
+   Real dBody = Norm(toBody), dSun = Norm(toSun);
+   // A body behind the Sun cannot eclipse it
+   if (dBody >= dSun)
+      return -1.0;
+
+   Real bodyRadius = bodies[context.body].radius;
+   Real angBody = (dBody > bodyRadius ? asin(bodyRadius / dBody) :
+                   GmatMathConstants::PI_OVER_TWO);
+   Real angSun  = asin(std::min(1.0, bodies[sunIndex].radius / dSun));
+
+   Real cosTheta = Dot(toBody, toSun) / (dBody * dSun);
+   Real theta = acos(std::max(-1.0, std::min(1.0, cosTheta)));
+
+   switch (context.type)
+   {
+   case 0:
+      return (angBody - angSun) - theta;
+   case 2:
+      return (angSun - angBody) - theta;
+   default:
+      return std::min(angBody + angSun - theta,
+                      theta - fabs(angBody - angSun));
+   }
+}
+
+
+//------------------------------------------------------------------------------
+// void Search(EventFunction f, const EventContext &context, Real from,
+//             Real to, RealArray &starts, RealArray &ends) const
+//------------------------------------------------------------------------------
+/**
+ * Finds the intervals in [from, to] where the event function is positive.
+ *
+ * The function is sampled at the step size.  Sign changes are refined with
+ * the Brent-Dekker zero finder.  At each local extremum of the samples that
+ * does not bracket a sign change, a golden section search looks for an event
+ * shorter than the step (a brief rise above zero, or dip below it).  Each
+ * piece between the roots found is then classified at its midpoint.
+ *
+ * @param f       The event function
+ * @param context Inputs of the event function
+ * @param from    Start of the span, in seconds from the search start
+ * @param to      End of the span, in seconds from the search start
+ * @param starts  Interval starts are appended here, in seconds
+ * @param ends    Interval ends are appended here, in seconds
+ */
+//------------------------------------------------------------------------------
+void GeometricEventSearch::Search(EventFunction f, const EventContext &context,
+      Real from, Real to, RealArray &starts, RealArray &ends) const
+{
+   if (to <= from)
+      return;
+
+   Integer n = (Integer)ceil((to - from) / stepSize);
+   if (n < 1)
+      n = 1;
+   Real h = (to - from) / n;
+
+   RealArray times(n + 1), values(n + 1);
+   for (Integer i = 0; i <= n; ++i)
+   {
+      times[i]  = (i == n ? to : from + i * h);
+      values[i] = (this->*f)(times[i], context);
+   }
+
+   RealArray roots;
+   for (Integer i = 0; i < n; ++i)
+   {
+      if ((values[i] > 0.0) != (values[i+1] > 0.0))
+         roots.push_back(FindZero(f, context, times[i], times[i+1], values[i],
+                                  values[i+1]));
+   }
+
+   // Short events between samples
+   for (Integer i = 0; i <= n; ++i)
+   {
+      Integer lo = (i > 0 ? i - 1 : i), hi = (i < n ? i + 1 : i);
+      if (lo == hi)
+         continue;
+      bool positive = (values[i] > 0.0);
+      if ((positive != (values[lo] > 0.0)) || (positive != (values[hi] > 0.0)))
+         continue;
+
+      bool peak   = (values[i] >= values[lo]) && (values[i] >= values[hi]);
+      bool trough = (values[i] <= values[lo]) && (values[i] <= values[hi]);
+      if ((positive && !trough) || (!positive && !peak))
+         continue;
+
+      Real extremum;
+      Real tx = FindExtremum(f, context, times[lo], times[hi], !positive,
+                             extremum);
+      if ((extremum > 0.0) != positive)
+      {
+         #ifdef DEBUG_NATIVE_SEARCH
+            MessageInterface::ShowMessage("GeometricEventSearch: short event "
+                  "near t = %.6lf s\n", tx);
+         #endif
+         roots.push_back(FindZero(f, context, times[lo], tx, values[lo],
+                                  extremum));
+         roots.push_back(FindZero(f, context, tx, times[hi], extremum,
+                                  values[hi]));
+      }
+   }
+
+   std::sort(roots.begin(), roots.end());
+
+   // Classify the pieces between the roots, merging neighbors
+   Real pieceStart = from;
+   bool open = false;
+   Real openStart = from;
+   for (UnsignedInt i = 0; i <= roots.size(); ++i)
+   {
+      Real pieceEnd = (i < roots.size() ? std::min(to, roots[i]) : to);
+      if (pieceEnd <= pieceStart)
+         continue;
+
+      bool inside = ((this->*f)(0.5 * (pieceStart + pieceEnd), context) > 0.0);
+      if (inside && !open)
+      {
+         openStart = pieceStart;
+         open = true;
+      }
+      else if (!inside && open)
+      {
+         starts.push_back(openStart);
+         ends.push_back(pieceStart);
+         open = false;
+      }
+      pieceStart = pieceEnd;
+   }
+   if (open)
+   {
+      starts.push_back(openStart);
+      ends.push_back(to);
+   }
+}
+
+
+//------------------------------------------------------------------------------
+// Real FindZero(EventFunction f, const EventContext &context, Real a, Real b,
+//               Real fa, Real fb) const
+//------------------------------------------------------------------------------
+/**
+ * Locates a sign change of the event function with the Brent-Dekker method.
+ */
+//------------------------------------------------------------------------------
+Real GeometricEventSearch::FindZero(EventFunction f,
+      const EventContext &context, Real a, Real b, Real fa, Real fb) const
+{
+   BrentDekkerZero finder;
+   finder.SetInterval(a, b, fa, fb, TIME_TOLERANCE);
+
+   // FindStep() returns the next point to evaluate; once the bracket has
+   // converged, the answer is the last point evaluated
+   Real x = finder.FindStep(b, fb);
+   for (Integer i = 0; i < 100; ++i)
+   {
+      Real fx = (this->*f)(x, context);
+      Real next = finder.FindStep(x, fx);
+      if (!finder.CheckConvergence())
+         break;
+      x = next;
+   }
+
+   return x;
+}
+
+
+//------------------------------------------------------------------------------
+// Real FindExtremum(EventFunction f, const EventContext &context, Real a,
+//                   Real b, bool maximum, Real &value) const
+//------------------------------------------------------------------------------
+/**
+ * Golden section search for the extremum of the event function on [a, b].
+ *
+ * Stops early once the extremum crosses zero, since only its sign is used.
+ *
+ * @param value Receives the function value at the returned time
+ *
+ * @return The time of the extremum
+ */
+//------------------------------------------------------------------------------
+Real GeometricEventSearch::FindExtremum(EventFunction f,
+      const EventContext &context, Real a, Real b, bool maximum,
+      Real &value) const
+{
+   const Real ratio = 0.5 * (sqrt(5.0) - 1.0);
+   // Search for the maximum of sign * f
+   Real sign = (maximum ? 1.0 : -1.0);
+
+   Real x1 = b - ratio * (b - a), x2 = a + ratio * (b - a);
+   Real f1 = sign * (this->*f)(x1, context);
+   Real f2 = sign * (this->*f)(x2, context);
+
+   for (Integer i = 0; (i < 60) && (b - a > 1.0e-3); ++i)
+   {
+      // The samples bounding [a, b] have sign * f <= 0; stop as soon as the
+      // extremum is known to be on the other side of zero
+      if ((f1 > 0.0) || (f2 > 0.0))
+         break;
+
+      if (f1 > f2)
+      {
+         b  = x2;
+         x2 = x1;
+         f2 = f1;
+         x1 = b - ratio * (b - a);
+         f1 = sign * (this->*f)(x1, context);
+      }
+      else
+      {
+         a  = x1;
+         x1 = x2;
+         f1 = f2;
+         x2 = a + ratio * (b - a);
+         f2 = sign * (this->*f)(x2, context);
+      }
+   }
+
+   Real tx = (f1 > f2 ? x1 : x2);
+   value = sign * std::max(f1, f2);
+   return tx;
+}
+
+
+//------------------------------------------------------------------------------
+// void Subtract(RealArray &starts, RealArray &ends, const RealArray &cutStarts,
+//               const RealArray &cutEnds)
+//------------------------------------------------------------------------------
+/**
+ * Removes the cut intervals from a list of intervals.
+ */
+//------------------------------------------------------------------------------
+void GeometricEventSearch::Subtract(RealArray &starts, RealArray &ends,
+      const RealArray &cutStarts, const RealArray &cutEnds)
+{
+   for (UnsignedInt c = 0; c < cutStarts.size(); ++c)
+   {
+      RealArray keptStarts, keptEnds;
+      for (UnsignedInt i = 0; i < starts.size(); ++i)
+      {
+         if ((cutEnds[c] <= starts[i]) || (cutStarts[c] >= ends[i]))
+         {
+            keptStarts.push_back(starts[i]);
+            keptEnds.push_back(ends[i]);
+            continue;
+         }
+         if (cutStarts[c] > starts[i])
+         {
+            keptStarts.push_back(starts[i]);
+            keptEnds.push_back(cutStarts[c]);
+         }
+         if (cutEnds[c] < ends[i])
+         {
+            keptStarts.push_back(cutEnds[c]);
+            keptEnds.push_back(ends[i]);
+         }
+      }
+      starts.swap(keptStarts);
+      ends.swap(keptEnds);
+   }
+}
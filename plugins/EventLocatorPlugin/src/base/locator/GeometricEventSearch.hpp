@@ -0,0 +1,199 @@
+//$Id$
+//------------------------------------------------------------------------------
+//                           GeometricEventSearch
+//------------------------------------------------------------------------------
+// GMAT: General Mission Analysis Tool.
+//
+// Copyright (c) 2002 - 2020 United States Government as represented by the
+// Administrator of The National Aeronautics and Space Administration.
+// All Other Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// You may not use this file except in compliance with the License.
+// You may obtain a copy of the License at:
+// http://www.apache.org/licenses/LICENSE-2.0.
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied.   See the License for the specific language
+// governing permissions and limitations under the License.
+//
+// Author: GMAT Development Team
+// Created: 2026/10/17
+//
+/**
+ * Definition of the in-memory contact and eclipse search used by the event
+ * locators when SearchMethod = Native
+ */
+//------------------------------------------------------------------------------
+
+
+#ifndef GeometricEventSearch_hpp
+#define GeometricEventSearch_hpp
+
+#include "EventLocatorDefs.hpp"
+
+class Ephemeris;
+class CoordinateSystem;
+class CelestialBody;
+class BodyFixedPoint;
+class SolarSystem;
+class SpacePoint;
+
+
+/**
+ * Finds contact and eclipse intervals from states held in memory.
+ *
+ * The geometry (spacecraft, celestial bodies and stations) is sampled once,
+ * on the calling thread, into uniform tables of position and velocity that are
+ * interpolated with cubic Hermite polynomials.  The table spacing is chosen so
+ * that each object moves through at most a small angle between samples, which
+ * keeps the interpolation error well below a meter.  After setup the search
+ * methods only read the tables, so searches for different stations, bodies or
+ * eclipse types can run concurrently.
+ *
+ * Each search samples an event function at the locator step size, refines the
+ * sign changes with the Brent-Dekker zero finder, and examines the local
+ * extrema of the sampled function with a golden section search so that
+ * events shorter than the step are not skipped.
+ *
+ * The geometry follows the CSPICE calls made by the EphemManager: converged
+ * Newtonian light time, first order stellar aberration, and ellipsoidal bodies.
+ * Ellipsoids are treated by scaling space along the body's spin axis so the
+ * body becomes a sphere of its equatorial radius.  All epochs are A1 modified
+ * Julian dates.
+ */
+class LOCATOR_API GeometricEventSearch
+{
+public:
+   GeometricEventSearch(SolarSystem *solarSystem, Real startEpoch,
+                        Real stopEpoch, Real stepSize, bool useLightTime,
+                        bool useStellarAberration);
+   virtual ~GeometricEventSearch();
+
+   // Setup; must be called on one thread, target first
+   void     SetTarget(Ephemeris *record, CoordinateSystem *recordCs);
+   Integer  AddBody(CelestialBody *body);
+   Integer  AddStation(BodyFixedPoint *station);
+
+   // Searches; safe to call concurrently once the setup is done
+   void     FindContacts(Integer station, Real minElevation,
+                         const IntegerArray &occulters, bool transmit,
+                         RealArray &starts, RealArray &ends) const;
+   void     FindEclipses(Integer body, const std::string &eclipseType,
+                         RealArray &starts, RealArray &ends) const;
+
+protected:
+   /// Uniformly sampled positions and velocities (km, km/s)
+   struct SampleTable
+   {
+      /// Time of the first sample, in seconds from the search start
+      Real        start;
+      /// Sample spacing in seconds
+      Real        step;
+      /// Number of samples
+      Integer     count;
+      /// Samples, 6 Reals each
+      RealArray   data;
+   };
+
+   /// Sampled celestial body
+   struct BodyData
+   {
+      CelestialBody  *body;
+      SampleTable    table;
+      Real           radius;
+      /// Equatorial over polar radius, for scaling along the spin axis
+      Real           stretch;
+      Real           spinAxis[3];
+   };
+
+   /// Sampled station
+   struct StationData
+   {
+      /// Index of the central body in bodies
+      Integer        centralBody;
+      /// Position relative to the central body
+      SampleTable    table;
+      /// Unit normal to the central body's ellipsoid at the station
+      SampleTable    up;
+   };
+
+   /// Inputs of an event function
+   struct EventContext
+   {
+      Integer        station;
+      Integer        body;
+      /// Eclipse type: 0 = umbra, 1 = penumbra, 2 = antumbra
+      Integer        type;
+      bool           transmit;
+      /// Minimum elevation, radians
+      Real           minElevation;
+   };
+
+   /// Event function used by the searches; positive inside the event
+   typedef Real (GeometricEventSearch::*EventFunction)(Real t,
+                                          const EventContext &context) const;
+
+   SolarSystem                *solarSys;
+   /// Common origin of the sampled positions
+   SpacePoint                 *j2000Body;
+   /// Search window, A1Mjd
+   Real                       searchStart;
+   Real                       searchStop;
+   /// Search window length in seconds
+   Real                       searchSpan;
+   /// Event function sampling step, in seconds
+   Real                       stepSize;
+   bool                       useLightTime;
+   bool                       useAberration;
+
+   SampleTable                target;
+   bool                       targetSet;
+   std::vector<BodyData>      bodies;
+   std::vector<StationData>   stations;
+   /// Index of the Sun in bodies
+   Integer                    sunIndex;
+
+   /// Largest rotation between table samples, in radians
+   static const Real MAX_SAMPLE_ANGLE;
+   /// Largest table spacing, in seconds
+   static const Real MAX_SAMPLE_STEP;
+   /// Convergence tolerance of the event times, in seconds
+   static const Real TIME_TOLERANCE;
+
+   void     BuildTable(SampleTable &table, Real start, Real stop, Real step);
+   void     Evaluate(const SampleTable &table, Real t, Real *pos,
+                     Real *vel = NULL) const;
+
+   void     TargetAt(Real t, Real *pos, Real *vel = NULL) const;
+   void     BodyAt(Integer body, Real t, Real *pos, Real *vel = NULL) const;
+   void     StationAt(Integer station, Real t, Real *pos, Real *vel,
+                      Real *up) const;
+   Real     LightTimeTarget(const Real *from, Real t, bool transmit,
+                            Real *pos) const;
+   Real     LightTimeBody(Integer body, const Real *from, Real t,
+                          bool transmit, Real *pos) const;
+   void     Stretch(Integer body, const Real *center, const Real *point,
+                    Real *scaled) const;
+
+   Real     Elevation(Real t, const EventContext &context) const;
+   Real     Occultation(Real t, const EventContext &context) const;
+   Real     Shadow(Real t, const EventContext &context) const;
+
+   void     Search(EventFunction f, const EventContext &context, Real from,
+                   Real to, RealArray &starts, RealArray &ends) const;
+   Real     FindZero(EventFunction f, const EventContext &context, Real a,
+                     Real b, Real fa, Real fb) const;
+   Real     FindExtremum(EventFunction f, const EventContext &context,
+                         Real a, Real b, bool maximum, Real &value) const;
+   static void Subtract(RealArray &starts, RealArray &ends,
+                        const RealArray &cutStarts, const RealArray &cutEnds);
+
+private:
+   // Not copyable: the tables can be large
+   GeometricEventSearch(const GeometricEventSearch&);
+   GeometricEventSearch& operator=(const GeometricEventSearch&);
+};
+
+#endif // GeometricEventSearch_hpp
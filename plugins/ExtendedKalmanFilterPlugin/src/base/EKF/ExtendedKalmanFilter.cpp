@@ -34,10 +34,12 @@
 //------------------------------------------------------------------------------
 
 #include "ExtendedKalmanFilter.hpp"
+#include "FilterHistory.hpp"
 #include "EstimatorException.hpp"
 #include "MessageInterface.hpp"
 #include "StringUtil.hpp"
 #include "UtilityException.hpp"
+#include <algorithm>
 #include <cmath>
 #include <limits>
 
@@ -45,6 +47,22 @@
 //#define DEBUG_ESTIMATION
 //#define DEBUG_JOSEPH
 
+//------------------------------------------------------------------------------
+// static data
+//------------------------------------------------------------------------------
+
+const std::string
+ExtendedKalmanFilter::PARAMETER_TEXT[] =
+{
+   "MeasurementUpdateMethod",       // The factorization used for the covariance
+};
+
+const Gmat::ParameterType
+ExtendedKalmanFilter::PARAMETER_TYPE[] =
+{
+   Gmat::ENUMERATION_TYPE,
+};
+
 //------------------------------------------------------------------------------
 // ExtendedKalmanFilter(const std::string name)
 //------------------------------------------------------------------------------
@@ -58,10 +76,13 @@ ExtendedKalmanFilter::ExtendedKalmanFilter(const std::string name) :
    SeqEstimator  ("ExtendedKalmanFilter", name),
    cf(),
    qr(false),
+   updateMethod  ("SquareRoot"),
+   useUDFactors  (false),
    calculatedMeas(0),
    currentObs(0)
 {
    objectTypeNames.push_back("ExtendedKalmanFilter");
+   parameterCount = ExtendedKalmanFilterParamCount;
 
    #ifdef DEBUG_ESTIMATION
       MessageInterface::ShowMessage(" EKF default constructor: stateSize = %o, "
@@ -94,6 +115,8 @@ ExtendedKalmanFilter::ExtendedKalmanFilter(const ExtendedKalmanFilter & ekf) :
    SeqEstimator  (ekf),
    cf(),
    qr(false),
+   updateMethod  (ekf.updateMethod),
+   useUDFactors  (false),
    calculatedMeas(0),
    currentObs(0)
 {
@@ -120,6 +143,8 @@ ExtendedKalmanFilter& ExtendedKalmanFilter::operator=(const ExtendedKalmanFilter
 
       cf = ekf.cf;
       qr = ekf.qr;
+      updateMethod = ekf.updateMethod;
+      useUDFactors = false;
    }
 
    return *this;
@@ -155,6 +180,187 @@ void  ExtendedKalmanFilter::Copy(const GmatBase* orig)
 }
 
 
+//------------------------------------------------------------------------------
+// std::string GetParameterText(const Integer id) const
+//------------------------------------------------------------------------------
+/**
+ * This method returns the parameter text, given the input parameter ID.
+ *
+ * @param id Id for the requested parameter text.
+ *
+ * @return parameter text for the requested parameter.
+ */
+//------------------------------------------------------------------------------
+std::string ExtendedKalmanFilter::GetParameterText(const Integer id) const
+{
+   if (id >= SeqEstimatorParamCount && id < ExtendedKalmanFilterParamCount)
+      return PARAMETER_TEXT[id - SeqEstimatorParamCount];
+   return SeqEstimator::GetParameterText(id);
+}
+
+
+//------------------------------------------------------------------------------
+//  Integer GetParameterID(const std::string &str) const
+//------------------------------------------------------------------------------
+/**
+ * This method returns the parameter ID, given the input parameter string.
+ *
+ * @param str String for the requested parameter.
+ *
+ * @return ID for the requested parameter.
+ */
+//------------------------------------------------------------------------------
+Integer ExtendedKalmanFilter::GetParameterID(const std::string &str) const
+{
+   for (Integer i = SeqEstimatorParamCount; i < ExtendedKalmanFilterParamCount;
+        i++)
+   {
+      if (str == PARAMETER_TEXT[i - SeqEstimatorParamCount])
+         return i;
+   }
+
+   return SeqEstimator::GetParameterID(str);
+}
+
+
+//------------------------------------------------------------------------------
+//  Gmat::ParameterType GetParameterType(const Integer id) const
+//------------------------------------------------------------------------------
+/**
+ * This method returns the parameter type, given the input parameter ID.
+ *
+ * @param id ID for the requested parameter.
+ *
+ * @return parameter type of the requested parameter.
+ */
+//------------------------------------------------------------------------------
+Gmat::ParameterType ExtendedKalmanFilter::GetParameterType(const Integer id) const
+{
+   if (id >= SeqEstimatorParamCount && id < ExtendedKalmanFilterParamCount)
+      return PARAMETER_TYPE[id - SeqEstimatorParamCount];
+
+   return SeqEstimator::GetParameterType(id);
+}
+
+
+//------------------------------------------------------------------------------
+//  std::string GetStringParameter(const Integer id) const
+//------------------------------------------------------------------------------
+/**
+ * This method returns the string parameter value, given the input
+ * parameter ID.
+ *
+ * @param id ID for the requested parameter.
+ *
+ * @return  string value of the requested parameter.
+ */
+//------------------------------------------------------------------------------
+std::string ExtendedKalmanFilter::GetStringParameter(const Integer id) const
+{
+   if (id == MEASUREMENT_UPDATE_METHOD)
+      return updateMethod;
+
+   return SeqEstimator::GetStringParameter(id);
+}
+
+
+//------------------------------------------------------------------------------
+//  bool SetStringParameter(const Integer id, const std::string &value)
+//------------------------------------------------------------------------------
+/**
+ * This method sets the string parameter value, given the input
+ * parameter ID.
+ *
+ * @param id ID for the requested parameter.
+ * @param value string value for the requested parameter.
+ *
+ * @return  success flag.
+ */
+//------------------------------------------------------------------------------
+bool ExtendedKalmanFilter::SetStringParameter(const Integer id,
+      const std::string &value)
+{
+   if (id == MEASUREMENT_UPDATE_METHOD)
+   {
+      const StringArray &methods = GetPropertyEnumStrings(id);
+      if (std::find(methods.begin(), methods.end(), value) ==
+          methods.end())
+         throw EstimatorException("Error: An invalid value (" + value +
+               ") was set to " + GetName() + ".MeasurementUpdateMethod "
+               "parameter. Valid values are 'SquareRoot' and 'UD'.\n");
+
+      updateMethod = value;
+      return true;
+   }
+
+   return SeqEstimator::SetStringParameter(id, value);
+}
+
+
+//------------------------------------------------------------------------------
+// std::string GetStringParameter(const std::string &label) const
+//------------------------------------------------------------------------------
+/**
+ * Retrieves a string parameter
+ *
+ * @param label The text label for the parameter
+ *
+ * @return The string assigned to the parameter
+ */
+//------------------------------------------------------------------------------
+std::string ExtendedKalmanFilter::GetStringParameter(
+      const std::string &label) const
+{
+   return GetStringParameter(GetParameterID(label));
+}
+
+
+//------------------------------------------------------------------------------
+// bool SetStringParameter(const std::string &label, const std::string &value)
+//------------------------------------------------------------------------------
+/**
+ * Sets the value for a parameter
+ *
+ * @param label The text label for the parameter
+ * @param value The new parameter value
+ *
+ * @return true on success, false on failure
+ */
+//------------------------------------------------------------------------------
+bool ExtendedKalmanFilter::SetStringParameter(const std::string &label,
+      const std::string &value)
+{
+   return SetStringParameter(GetParameterID(label), value);
+}
+
+
+//------------------------------------------------------------------------------
+// const StringArray& GetPropertyEnumStrings(const Integer id) const
+//------------------------------------------------------------------------------
+/**
+ * Returns the list of allowable settings for the enumerated parameters
+ *
+ * @param id The ID of the parameter
+ *
+ * @return A const string array with the allowed settings.
+ */
+//------------------------------------------------------------------------------
+const StringArray& ExtendedKalmanFilter::GetPropertyEnumStrings(
+      const Integer id) const
+{
+   if (id == MEASUREMENT_UPDATE_METHOD)
+   {
+      static StringArray enumStrings;
+      enumStrings.clear();
+      enumStrings.push_back("SquareRoot");
+      enumStrings.push_back("UD");
+      return enumStrings;
+   }
+
+   return SeqEstimator::GetPropertyEnumStrings(id);
+}
+
+
 
 //------------------------------------------------------------------------------
 // protected methods
@@ -185,9 +391,39 @@ void ExtendedKalmanFilter::CompleteInitialization()
 
    I = Rmatrix::Identity(stateSize);
 
-   sqrtP_T.SetSize(stateSize, stateSize);
-   sqrtPupdate_T.SetSize(stateSize, stateSize);
-   cf.Factor(*(stateCovariance->GetCovariance()), sqrtP_T);
+   useUDFactors = (updateMethod == "UD");
+
+   if (useUDFactors)
+   {
+      // Size the U-D buffers once; the updates reuse them
+      Integer n = stateSize;
+      udU.assign(n * n, 0.0);
+      udD.assign(n, 0.0);
+      udUpdateU.assign(n * n, 0.0);
+      udUpdateD.assign(n, 0.0);
+      udW.assign(2 * n * n, 0.0);
+      udWeights.assign(2 * n, 0.0);
+      udWork.assign(n * n + 2 * n, 0.0);
+      udP.assign(n * n, 0.0);
+
+      Rmatrix *cov = stateCovariance->GetCovariance();
+      for (Integer i = 0; i < n; ++i)
+         for (Integer j = 0; j < n; ++j)
+            udP[i * n + j] = (*cov)(i, j);
+
+      if (!UDFactorization::Factor(udP.data(), n, udU.data(), udD.data()))
+         throw EstimatorException("In ExtendedKalmanFilter::Estimate(), the "
+               "initial covariance matrix is not positive definite");
+
+      if ((pBar.GetNumRows() != n) || (pBar.GetNumColumns() != n))
+         pBar.SetSize(n, n);
+   }
+   else
+   {
+      sqrtP_T.SetSize(stateSize, stateSize);
+      sqrtPupdate_T.SetSize(stateSize, stateSize);
+      cf.Factor(*(stateCovariance->GetCovariance()), sqrtP_T);
+   }
 
    currentObs =  measManager.GetObsData();
    prevUpdateEpochGT = currentEpochGT;
@@ -311,7 +547,7 @@ void ExtendedKalmanFilter::Estimate()
    updateStat.cov = informationInverse;
    updateStat.sigmaVNB = GetCovarianceVNB(informationInverse);
 
-   updateStats.push_back(updateStat);
+   updateStats->Add(updateStat);
    BuildMeasurementLine(updateStat.measStat);
    WriteDataFile();
    AddMatlabData(updateStat.measStat);
@@ -376,7 +612,7 @@ void ExtendedKalmanFilter::TimeUpdate()
    Rmatrix dX_dS = cart2SolvMatrixPrev;
    Rmatrix dS_dX = cart2SolvMatrix.Inverse();
 
-   Rmatrix Q_S = dS_dX * Q * dS_dX.Transpose();
+   Rmatrix Q_S = MatrixTimesMatrixTimesTranspose(dS_dX, Q);
    Rmatrix stm_S = dS_dX * (*stm) * dX_dS;
 
    // Update offset from reference trajectory
@@ -392,12 +628,18 @@ void ExtendedKalmanFilter::TimeUpdate()
          (*offsetState)[i] = xOffset[i];
    }
 
+   if (useUDFactors)
+   {
+      TimeUpdateUD(stm_S, Q_S);
+      return;
+   }
+
    // Form C matrix and perform QR decomposition to calculate pBar
 
    // C = [sqrt(P)^T * Phi^T;
    //      sqrt(Q)^T];
    Rmatrix C(2 * stateSize, stateSize);
-   Rmatrix C1 = sqrtP_T * stm_S.Transpose();
+   Rmatrix C1 = MatrixTimesTranspose(sqrtP_T, stm_S);
 
    Rmatrix sqrtQ_T(stateSize, stateSize);
 
@@ -499,7 +741,7 @@ void ExtendedKalmanFilter::TimeUpdate()
       }
    }
 
-   pBar = sqrtP_T.Transpose() * sqrtP_T;
+   pBar = TransposeTimesMatrix(sqrtP_T, sqrtP_T);
 
    // make it symmetric!
    Symmetrize(pBar);
@@ -592,17 +834,25 @@ void ExtendedKalmanFilter::ComputeObs(UpdateInfoType &updateStat)
       }
 
       // get scaled residuals
-      Rmatrix R = *(GetMeasurementCovariance()->GetCovariance());
+      const Rmatrix &R = *(GetMeasurementCovariance()->GetCovariance());
 
       // Keep this line for when we implement the scaled residual for the entire measurement
       // instead of for each element of the measurement:
       // measStat.scaledResid = GmatMathUtil::Sqrt(yi * (H * pBar * H.Transpose() + R).Inverse() * yi);
 
-      // The element-by-element scaled residual calculation:
+      // The element-by-element scaled residual calculation, using the
+      // diagonal of Rbar = H * pBar * H^T + R:
       for (UnsignedInt k = 0; k < measStat.residual.size(); ++k)
       {
-         Rmatrix Rbar = H * pBar * H.Transpose() + R;
-         Real sigmaVal = GmatMathUtil::Sqrt(Rbar(k, k));
+         Real rbar = R(k, k);
+         for (UnsignedInt i = 0; i < stateSize; ++i)
+         {
+            Real pH = 0.0;
+            for (UnsignedInt j = 0; j < stateSize; ++j)
+               pH += pBar(i, j) * H(k, j);
+            rbar += H(k, i) * pH;
+         }
+         Real sigmaVal = GmatMathUtil::Sqrt(rbar);
          Real scaledResid = measStat.residual[k] / sigmaVal;
          measStat.scaledResid.push_back(scaledResid);
       }
@@ -656,6 +906,12 @@ void ExtendedKalmanFilter::ComputeObs(UpdateInfoType &updateStat)
 //------------------------------------------------------------------------------
 void ExtendedKalmanFilter::ComputeGain(UpdateInfoType &updateStat)
 {
+   if (useUDFactors)
+   {
+      ComputeGainUD(updateStat);
+      return;
+   }
+
    if (updateStat.measStat.isCalculated)
    {
       #ifdef DEBUG_ESTIMATION
@@ -673,7 +929,7 @@ void ExtendedKalmanFilter::ComputeGain(UpdateInfoType &updateStat)
       Rmatrix sqrtR_T(measSize, measSize);
       cf.Factor(R, sqrtR_T);
 
-      Rmatrix A21 = sqrtP_T * H.Transpose();
+      Rmatrix A21 = MatrixTimesTranspose(sqrtP_T, H);
 
       // Populate A
       // Top block
@@ -805,23 +1061,36 @@ void ExtendedKalmanFilter::UpdateElements(UpdateInfoType &updateStat)
       // UpdateCovarianceSimple();
       // UpdateCovarianceJoseph();
 
-      Rmatrix P2 = sqrtPupdate_T.Transpose() * sqrtPupdate_T;
-      sqrtP_T = sqrtPupdate_T;
-
-      // Warn if covariance is not positive definite
-      for (UnsignedInt ii = 0U; ii < stateSize; ii++)
+      if (useUDFactors)
       {
-         if (GmatMathUtil::Abs(sqrtP_T(ii, ii)) < 1e-16)
+         udU.swap(udUpdateU);
+         udD.swap(udUpdateD);
+         CheckFactorsUD(udD);
+         ComposeCovarianceUD(*(stateCovariance->GetCovariance()));
+      }
+      else
+      {
+         Rmatrix P2 = TransposeTimesMatrix(sqrtPupdate_T, sqrtPupdate_T);
+         sqrtP_T = sqrtPupdate_T;
+
+         // Warn if covariance is not positive definite
+         for (UnsignedInt ii = 0U; ii < stateSize; ii++)
          {
-            MessageInterface::ShowMessage("WARNING The covariance is no longer positive definite! Epoch = %s\n", currentEpochGT.ToString().c_str());
-            break;
+            if (GmatMathUtil::Abs(sqrtP_T(ii, ii)) < 1e-16)
+            {
+               MessageInterface::ShowMessage("WARNING The covariance is no longer positive definite! Epoch = %s\n", currentEpochGT.ToString().c_str());
+               break;
+            }
          }
-      }
 
-      (*(stateCovariance->GetCovariance())) = P2;
+         (*(stateCovariance->GetCovariance())) = P2;
+      }
    }
+   else if (useUDFactors)
+      ComposeCovarianceUD(*(stateCovariance->GetCovariance()));
    else
-      (*(stateCovariance->GetCovariance())) = sqrtP_T.Transpose() * sqrtP_T;
+      (*(stateCovariance->GetCovariance())) =
+            TransposeTimesMatrix(sqrtP_T, sqrtP_T);
 
    Symmetrize(*stateCovariance);
    informationInverse = (*(stateCovariance->GetCovariance()));
@@ -844,7 +1113,9 @@ void ExtendedKalmanFilter::UpdateCovarianceSimple()
    #endif
 
    // P = (I - K * H) * Pbar
-   (*(stateCovariance->GetCovariance())) = (I - (kalman * H)) * pBar;
+   Rmatrix IKH = I;
+   IKH.AddProduct(kalman, H, -1.0);
+   (*(stateCovariance->GetCovariance())) = IKH * pBar;
 }
 
 
@@ -867,9 +1138,11 @@ void ExtendedKalmanFilter::UpdateCovarianceJoseph()
    Rmatrix *r = GetMeasurementCovariance()->GetCovariance();
 
    // P = (I - K * H) * Pbar * (I - K * H)^T + K * R * K^T
+   Rmatrix IKH = I;
+   IKH.AddProduct(kalman, H, -1.0);
    (*(stateCovariance->GetCovariance())) =
-         ((I - (kalman * H)) * pBar * (I - (kalman * H)).Transpose()) +
-         (kalman * (*r) * kalman.Transpose());
+         MatrixTimesMatrixTimesTranspose(IKH, pBar) +
+         MatrixTimesMatrixTimesTranspose(kalman, *r);
 
    #ifdef DEBUG_JOSEPH
       for (UnsignedInt i = 0; i < stateSize; ++i)
@@ -884,6 +1157,220 @@ void ExtendedKalmanFilter::UpdateCovarianceJoseph()
    #endif
 }
 
+//------------------------------------------------------------------------------
+// void TimeUpdateUD(const Rmatrix &stm_S, const Rmatrix &Q_S)
+//------------------------------------------------------------------------------
+/**
+ * Performs the time update of the U-D factors of the covariance
+ *
+ * The factors of Pbar = Phi U D U^T Phi^T + U_q D_q U_q^T are found with
+ * Thornton's weighted Gram-Schmidt method applied to [Phi U | U_q].
+ *
+ * @param stm_S The state transition matrix of the solve-for state
+ * @param Q_S   The process noise of the solve-for state
+ */
+//------------------------------------------------------------------------------
+void ExtendedKalmanFilter::TimeUpdateUD(const Rmatrix &stm_S,
+                                        const Rmatrix &Q_S)
+{
+   UnsignedInt n = stateSize;
+   UnsignedInt cols = 2 * n;
+   Real *qU = udWork.data();
+
+   // Factor the process noise; rows of zeros give zero weights
+   for (UnsignedInt i = 0; i < n; ++i)
+      for (UnsignedInt j = 0; j < n; ++j)
+         udP[i * n + j] = Q_S(i, j);
+
+   if (!UDFactorization::Factor(udP.data(), n, qU, &udWeights[n]))
+   {
+      for (UnsignedInt ii = 0U; ii < n; ii++)
+      {
+         if ((udWeights[n + ii] == 0.0) && (Q_S(ii, ii) != 0.0))
+            throw EstimatorException("The process noise matrix is not "
+                  "positive definite!");
+      }
+   }
+
+   // W = [Phi U | U_q], weights [D, D_q]
+   for (UnsignedInt i = 0; i < n; ++i)
+   {
+      Real *wi = &udW[i * cols];
+      for (UnsignedInt k = 0; k < n; ++k)
+      {
+         Real sum = stm_S(i, k);
+         for (UnsignedInt l = 0; l < k; ++l)
+            sum += stm_S(i, l) * udU[l * n + k];
+         wi[k] = sum;
+         wi[n + k] = qU[i * n + k];
+      }
+      udWeights[i] = udD[i];
+   }
+
+   UDFactorization::TimeUpdate(udW.data(), udWeights.data(), n, cols,
+         udU.data(), udD.data(), udWork.data());
+
+   CheckFactorsUD(udD);
+
+   ComposeCovarianceUD(pBar);
+
+   // make it symmetric!
+   Symmetrize(pBar);
+}
+
+
+//------------------------------------------------------------------------------
+// void ComputeGainUD(UpdateInfoType &updateStat)
+//------------------------------------------------------------------------------
+/**
+ * Computes the Kalman gain and the measurement updated U-D factors
+ *
+ * The measurement components are decorrelated with the U-D factors of the
+ * noise covariance, R = U_r D_r U_r^T, and are then processed one at a time
+ * with Bierman's scalar update.  The gains of the scalar updates are combined
+ * into the gain for the full measurement so that the state update matches the
+ * other update methods.  The updated factors are held in udUpdateU and
+ * udUpdateD until UpdateElements() accepts the measurement.
+ *
+ * @param updateStat The update record receiving the gain
+ */
+//------------------------------------------------------------------------------
+void ExtendedKalmanFilter::ComputeGainUD(UpdateInfoType &updateStat)
+{
+   if (!updateStat.measStat.isCalculated)
+      return;
+
+   #ifdef DEBUG_ESTIMATION
+      MessageInterface::ShowMessage("Computing Kalman Gain with U-D "
+            "factors\n");
+   #endif
+
+   const Rmatrix &R = *(GetMeasurementCovariance()->GetCovariance());
+   UnsignedInt m = R.GetNumRows();
+   UnsignedInt n = stateSize;
+
+   // udR holds R, then U_r, then D_r; the sizes only grow
+   if (udR.size() < 2 * m * m + m)
+      udR.resize(2 * m * m + m);
+   if (udH.size() < m * n)
+      udH.resize(m * n);
+   if (udGain.size() < m * n)
+      udGain.resize(m * n);
+
+   Real *rU = &udR[m * m];
+   Real *rD = &udR[2 * m * m];
+   for (UnsignedInt i = 0; i < m; ++i)
+      for (UnsignedInt j = 0; j < m; ++j)
+         udR[i * m + j] = R(i, j);
+
+   if (!UDFactorization::Factor(udR.data(), m, rU, rD))
+      throw EstimatorException("The measurement noise covariance is not "
+            "positive definite!");
+
+   // Decorrelated partials, U_r^-1 H
+   for (Integer j = m - 1; j >= 0; --j)
+   {
+      Real *hj = &udH[j * n];
+      for (UnsignedInt i = 0; i < n; ++i)
+         hj[i] = H(j, i);
+      for (UnsignedInt k = j + 1; k < m; ++k)
+      {
+         Real ujk = rU[j * m + k];
+         if (ujk != 0.0)
+            for (UnsignedInt i = 0; i < n; ++i)
+               hj[i] -= ujk * udH[k * n + i];
+      }
+   }
+
+   udUpdateU = udU;
+   udUpdateD = udD;
+
+   // Sequential scalar updates.  Column j of udGain holds the sensitivity of
+   // the state update to the j-th decorrelated residual.
+   for (UnsignedInt j = 0; j < m; ++j)
+   {
+      Real *hj = &udH[j * n];
+      Real *kj = &udGain[j * n];
+      UDFactorization::MeasurementUpdate(udUpdateU.data(), udUpdateD.data(),
+            n, hj, rD[j], kj, udWork.data());
+
+      for (UnsignedInt l = 0; l < j; ++l)
+      {
+         Real *kl = &udGain[l * n];
+         Real hk = 0.0;
+         for (UnsignedInt i = 0; i < n; ++i)
+            hk += hj[i] * kl[i];
+         for (UnsignedInt i = 0; i < n; ++i)
+            kl[i] -= kj[i] * hk;
+      }
+   }
+
+   // Gain for the original residuals, K = M U_r^-1
+   for (UnsignedInt c = 0; c < m; ++c)
+   {
+      Real *kc = &udGain[c * n];
+      for (UnsignedInt l = 0; l < c; ++l)
+      {
+         Real ulc = rU[l * m + c];
+         if (ulc != 0.0)
+            for (UnsignedInt i = 0; i < n; ++i)
+               kc[i] -= ulc * udGain[l * n + i];
+      }
+      for (UnsignedInt i = 0; i < n; ++i)
+         kalman(i, c) = kc[i];
+   }
+
+   updateStat.measStat.kalmanGain.SetSize(kalman.GetNumRows(), kalman.GetNumColumns());
+   updateStat.measStat.kalmanGain = kalman;
+}
+
+
+//------------------------------------------------------------------------------
+// void ComposeCovarianceUD(Rmatrix &cov)
+//------------------------------------------------------------------------------
+/**
+ * Builds the covariance U D U^T from the current U-D factors
+ *
+ * @param cov The matrix receiving the covariance
+ */
+//------------------------------------------------------------------------------
+void ExtendedKalmanFilter::ComposeCovarianceUD(Rmatrix &cov)
+{
+   UnsignedInt n = stateSize;
+   UDFactorization::Compose(udU.data(), udD.data(), n, udP.data());
+
+   for (UnsignedInt i = 0; i < n; ++i)
+      for (UnsignedInt j = 0; j < n; ++j)
+         cov(i, j) = udP[i * n + j];
+}
+
+
+//------------------------------------------------------------------------------
+// bool CheckFactorsUD(const RealArray &d)
+//------------------------------------------------------------------------------
+/**
+ * Warns if the diagonal factor shows the covariance is no longer positive
+ * definite
+ *
+ * @param d The diagonal factor
+ *
+ * @return true if the covariance is positive definite, false if not
+ */
+//------------------------------------------------------------------------------
+bool ExtendedKalmanFilter::CheckFactorsUD(const RealArray &d)
+{
+   for (UnsignedInt ii = 0U; ii < stateSize; ii++)
+   {
+      if (d[ii] < 1e-32)
+      {
+         MessageInterface::ShowMessage("WARNING The covariance is no longer positive definite! Epoch = %s\n", currentEpochGT.ToString().c_str());
+         return false;
+      }
+   }
+   return true;
+}
+
+
 void ExtendedKalmanFilter::AdvanceEpoch()
 {
    // Reset the STM
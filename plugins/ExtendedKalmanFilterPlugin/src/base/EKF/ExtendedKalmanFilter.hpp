@@ -37,6 +37,7 @@
 #include "SeqEstimator.hpp"
 #include "CholeskyFactorization.hpp"
 #include "QRFactorization.hpp"
+#include "UDFactorization.hpp"
 
 
 /**
@@ -57,6 +58,16 @@
  * or using the form derived by Bucy and Joseph (equation 4.7.19 on page 205).
  * This choice is made at compile time in the UpdateElements() method.  The
  * current default selection is the Bucy-Joseph update.
+ *
+ * 3.  The covariance is propagated and updated in factored form, selected with
+ * the MeasurementUpdateMethod field.  The default, SquareRoot, carries the
+ * Cholesky factor of the covariance and performs the time and measurement
+ * updates with QR factorizations.  The UD setting carries the U-D factors of
+ * the covariance, processes the measurement components one at a time with
+ * Bierman's scalar update (after decorrelating them when the measurement noise
+ * covariance is not diagonal), and performs the time update with Thornton's
+ * weighted Gram-Schmidt method.  The U-D kernels work in place on buffers
+ * sized once per run.
  */
 class KALMAN_API ExtendedKalmanFilter : public SeqEstimator
 {
@@ -69,6 +80,21 @@ public:
    GmatBase*               Clone() const;
    virtual void            Copy(const GmatBase*);
 
+   // methods overridden from GmatBase
+   virtual std::string     GetParameterText(const Integer id) const;
+   virtual Integer         GetParameterID(const std::string &str) const;
+   virtual Gmat::ParameterType
+                           GetParameterType(const Integer id) const;
+
+   virtual std::string     GetStringParameter(const Integer id) const;
+   virtual bool            SetStringParameter(const Integer id,
+                                              const std::string &value);
+   virtual std::string     GetStringParameter(const std::string &label) const;
+   virtual bool            SetStringParameter(const std::string &label,
+                                              const std::string &value);
+   virtual const StringArray&
+                           GetPropertyEnumStrings(const Integer id) const;
+
 protected:
    /// The measurement Residuals (O-C)
    Rvector                 yi;
@@ -83,6 +109,43 @@ protected:
    Rmatrix                 sqrtP_T;
    Rmatrix                 sqrtPupdate_T;
 
+   /// The covariance update method, "SquareRoot" or "UD"
+   std::string             updateMethod;
+   /// Flag set during initialization when the U-D factors are used
+   bool                    useUDFactors;
+   /// The U-D factors of the covariance, row-major
+   RealArray               udU;
+   RealArray               udD;
+   /// The U-D factors after the measurement update
+   RealArray               udUpdateU;
+   RealArray               udUpdateD;
+   /// Time update matrix [Phi U | U_q] and its weights [D, D_q]
+   RealArray               udW;
+   RealArray               udWeights;
+   /// Decorrelated measurement partials, noise variances and gain columns
+   RealArray               udH;
+   RealArray               udR;
+   RealArray               udGain;
+   /// Work space for the factorizations and the composed covariance
+   RealArray               udWork;
+   RealArray               udP;
+
+   /// Parameter IDs for the ExtendedKalmanFilter
+   enum
+   {
+      MEASUREMENT_UPDATE_METHOD = SeqEstimatorParamCount,
+      ExtendedKalmanFilterParamCount
+   };
+
+   /// Strings describing the ExtendedKalmanFilter parameters
+   static const std::string
+                           PARAMETER_TEXT[ExtendedKalmanFilterParamCount -
+                                              SeqEstimatorParamCount];
+   /// Types of the ExtendedKalmanFilter parameters
+   static const Gmat::ParameterType
+                           PARAMETER_TYPE[ExtendedKalmanFilterParamCount -
+                                              SeqEstimatorParamCount];
+
    virtual void            CompleteInitialization();
    virtual void            Estimate();
 
@@ -95,6 +158,12 @@ private:
    void                    UpdateElements(UpdateInfoType &updateStat);
    void                    AdvanceEpoch();
 
+   void                    TimeUpdateUD(const Rmatrix &stm_S,
+                                        const Rmatrix &Q_S);
+   void                    ComputeGainUD(UpdateInfoType &updateStat);
+   void                    ComposeCovarianceUD(Rmatrix &cov);
+   bool                    CheckFactorsUD(const RealArray &d);
+
    void                    UpdateCovarianceSimple();
    void                    UpdateCovarianceJoseph();
 
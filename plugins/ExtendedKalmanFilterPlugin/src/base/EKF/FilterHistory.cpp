@@ -0,0 +1,771 @@
+//$Id$
+//------------------------------------------------------------------------------
+//                              FilterHistory
+//------------------------------------------------------------------------------
+// GMAT: General Mission Analysis Tool
+//
+// Copyright (c) 2002 - 2020 United States Government as represented by the
+// Administrator of The National Aeronautics and Space Administration.
+// All Other Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// You may not use this file except in compliance with the License.
+// You may obtain a copy of the License at:
+// http://www.apache.org/licenses/LICENSE-2.0.
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied.   See the License for the specific language
+// governing permissions and limitations under the License.
+//
+// Author: GMAT Development Team
+// Created: 2026/10/17
+//
+/**
+ * Implementation of the store for the update records of a sequential estimator
+ *
+ * Record layout (native byte order; the file only lives for one run):
+ *
+ *    epoch, isObs, state, cov, sigmaVNB, processNoise, stm, [measStat]
+ *
+ * where the measurement statistics are present only for observation records.
+ * Epochs are written as days, seconds and fraction of a second, arrays as a
+ * count followed by the values, and matrices as their dimensions, a layout
+ * flag and the elements.  Matrices that are exactly symmetric store only the
+ * upper triangle.  All values are copied bit for bit, so decoded records are
+ * identical to the ones added.
+ */
+//------------------------------------------------------------------------------
+
+#include "FilterHistory.hpp"
+#include "MemoryMappedFile.hpp"
+#include "EstimatorException.hpp"
+#include "MessageInterface.hpp"
+#include "FileUtil.hpp"
+#include "TimeTypes.hpp"
+#include <atomic>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+
+//#define DEBUG_FILTER_HISTORY
+
+//------------------------------------------------------------------------------
+// Storage
+//------------------------------------------------------------------------------
+/**
+ * The encoded records of a history.
+ *
+ * The first baseCount records belong to the base storage, which is shared with
+ * other histories.  Offsets of the other records count bytes from the first
+ * record added to this storage; records below spilledBytes are in the scratch
+ * file, the rest are in the buffer.
+ */
+//------------------------------------------------------------------------------
+struct FilterHistory::Storage
+{
+   /// Fields of a record kept in memory for searches
+   struct RecordKey
+   {
+      GmatTime    epoch;
+      bool        isObs;
+      UnsignedInt recNum;
+      size_t      offset;
+      size_t      length;
+   };
+
+   std::vector<RecordKey>  keys;
+   /// Storage holding the first baseCount records, or NULL
+   std::shared_ptr<Storage> base;
+   UnsignedInt             baseCount;
+   /// Encoded records not yet written to the scratch file
+   std::vector<char>       buffer;
+   /// Bytes written to the scratch file
+   size_t                  spilledBytes;
+   std::string             fileName;
+   std::ofstream           file;
+   /// Mapping of the scratch file, made on the first read of a spilled record
+   MemoryMappedFile        *mapping;
+   /// Reader used if the scratch file cannot be mapped
+   std::ifstream           reader;
+   std::vector<char>       readBuffer;
+
+   Storage();
+   ~Storage();
+
+   void        Spill();
+   const char* Read(size_t offset, size_t length);
+};
+
+
+//------------------------------------------------------------------------------
+// Storage()
+//------------------------------------------------------------------------------
+FilterHistory::Storage::Storage() :
+   baseCount      (0),
+   spilledBytes   (0),
+   mapping        (NULL)
+{
+}
+
+
+//------------------------------------------------------------------------------
+// ~Storage()
+//------------------------------------------------------------------------------
+/**
+ * Releases the mapping and removes the scratch file.
+ */
+//------------------------------------------------------------------------------
+FilterHistory::Storage::~Storage()
+{
+   MemoryMappedFile::Release(mapping);
+   if (reader.is_open())
+      reader.close();
+   if (file.is_open())
+      file.close();
+   if (fileName != "")
+      remove(fileName.c_str());
+}
+
+
+//------------------------------------------------------------------------------
+// void Spill()
+//------------------------------------------------------------------------------
+/**
+ * Appends the buffered records to the scratch file, creating it if needed.
+ */
+//------------------------------------------------------------------------------
+void FilterHistory::Storage::Spill()
+{
+   static std::atomic<UnsignedInt> fileCount(0);
+
+   if (buffer.empty())
+      return;
+
+   if (!file.is_open())
+   {
+      std::stringstream name;
+      name << GmatFileUtil::GetTemporaryDirectory() << "GMAT_FilterHistory_"
+           << GmatTimeUtil::FormatCurrentTime(4) << "_" << fileCount++ << "_"
+           << (void*)this << ".bin";
+      fileName = name.str();
+
+      file.open(fileName.c_str(), std::ios::binary | std::ios::trunc);
+      if (!file)
+         throw EstimatorException("Unable to open the filter history file " +
+               fileName);
+
+      #ifdef DEBUG_FILTER_HISTORY
+         MessageInterface::ShowMessage("FilterHistory: spilling records to "
+               "%s\n", fileName.c_str());
+      #endif
+   }
+
+   // The mapping no longer covers the whole file
+   MemoryMappedFile::Release(mapping);
+   mapping = NULL;
+   if (reader.is_open())
+      reader.close();
+
+   file.write(&buffer[0], buffer.size());
+   if (!file)
+      throw EstimatorException("Unable to write to the filter history file " +
+            fileName);
+
+   spilledBytes += buffer.size();
+   buffer.clear();
+}
+
+
+//------------------------------------------------------------------------------
+// const char* Read(size_t offset, size_t length)
+//------------------------------------------------------------------------------
+/**
+ * Returns the encoded bytes of a record.
+ *
+ * @param offset The offset of the record
+ * @param length The size of the record
+ *
+ * @return Pointer to the record; valid until the next Read() or Spill()
+ */
+//------------------------------------------------------------------------------
+const char* FilterHistory::Storage::Read(size_t offset, size_t length)
+{
+   if (offset >= spilledBytes)
+      return &buffer[offset - spilledBytes];
+
+   if ((mapping == NULL) && !reader.is_open())
+   {
+      file.flush();
+      mapping = MemoryMappedFile::Open(fileName);
+      if (mapping == NULL)
+      {
+         reader.open(fileName.c_str(), std::ios::binary);
+         if (!reader)
+            throw EstimatorException("Unable to read the filter history "
+                  "file " + fileName);
+      }
+   }
+
+   if (mapping != NULL)
+   {
+      if (offset + length > mapping->GetSize())
+         throw EstimatorException("The filter history file " + fileName +
+               " is truncated");
+      return mapping->GetData() + offset;
+   }
+
+   readBuffer.resize(length);
+   reader.clear();
+   reader.seekg(offset);
+   reader.read(&readBuffer[0], length);
+   if (!reader)
+      throw EstimatorException("Unable to read the filter history file " +
+            fileName);
+   return &readBuffer[0];
+}
+
+
+//------------------------------------------------------------------------------
+// Encoding helpers
+//------------------------------------------------------------------------------
+
+static void PutBytes(std::vector<char> &out, const void *data, size_t size)
+{
+   const char *bytes = (const char*)data;
+   out.insert(out.end(), bytes, bytes + size);
+}
+
+static void PutInteger(std::vector<char> &out, Integer value)
+{
+   PutBytes(out, &value, sizeof(Integer));
+}
+
+static void PutReal(std::vector<char> &out, Real value)
+{
+   PutBytes(out, &value, sizeof(Real));
+}
+
+static void PutBool(std::vector<char> &out, bool value)
+{
+   out.push_back(value ? 1 : 0);
+}
+
+static void PutTime(std::vector<char> &out, const GmatTime &value)
+{
+   Real fraction = value.GetFracSec();
+   long days = value.GetDays(), sec = value.GetSec();
+   PutBytes(out, &days, sizeof(long));
+   PutBytes(out, &sec, sizeof(long));
+   PutReal(out, fraction);
+}
+
+static void PutString(std::vector<char> &out, const std::string &value)
+{
+   PutInteger(out, (Integer)value.size());
+   PutBytes(out, value.data(), value.size());
+}
+
+static void PutArray(std::vector<char> &out, const RealArray &value)
+{
+   PutInteger(out, (Integer)value.size());
+   if (!value.empty())
+      PutBytes(out, &value[0], value.size() * sizeof(Real));
+}
+
+static void PutMatrix(std::vector<char> &out, const Rmatrix &value)
+{
+   Integer rows = value.GetNumRows(), cols = value.GetNumColumns();
+   PutInteger(out, rows);
+   PutInteger(out, cols);
+
+   // Compare bit patterns so that -0.0 and NaN elements round trip
+   bool symmetric = (rows == cols);
+   for (Integer i = 0; symmetric && (i < rows); ++i)
+      for (Integer j = i + 1; symmetric && (j < cols); ++j)
+         symmetric = (memcmp(&value(i, j), &value(j, i), sizeof(Real)) == 0);
+
+   PutBool(out, symmetric);
+   for (Integer i = 0; i < rows; ++i)
+      for (Integer j = (symmetric ? i : 0); j < cols; ++j)
+         PutReal(out, value(i, j));
+}
+
+static void GetBytes(const char *&in, void *data, size_t size)
+{
+   memcpy(data, in, size);
+   in += size;
+}
+
+static Integer GetInteger(const char *&in)
+{
+   Integer value;
+   GetBytes(in, &value, sizeof(Integer));
+   return value;
+}
+
+static Real GetReal(const char *&in)
+{
+   Real value;
+   GetBytes(in, &value, sizeof(Real));
+   return value;
+}
+
+static bool GetBool(const char *&in)
+{
+   return (*(in++) != 0);
+}
+
+static void GetTime(const char *&in, GmatTime &value)
+{
+   long days, sec;
+   GetBytes(in, &days, sizeof(long));
+   GetBytes(in, &sec, sizeof(long));
+   value.SetDays(days);
+   value.SetSec(sec);
+   value.SetFracSec(GetReal(in));
+}
+
+static void GetString(const char *&in, std::string &value)
+{
+   Integer size = GetInteger(in);
+   value.assign(in, size);
+   in += size;
+}
+
+static void GetArray(const char *&in, RealArray &value)
+{
+   Integer size = GetInteger(in);
+   value.resize(size);
+   if (size > 0)
+      GetBytes(in, &value[0], size * sizeof(Real));
+}
+
+static void GetMatrix(const char *&in, Rmatrix &value)
+{
+   Integer rows = GetInteger(in);
+   Integer cols = GetInteger(in);
+   if ((value.GetNumRows() != rows) || (value.GetNumColumns() != cols))
+      value.SetSize(rows, cols);
+
+   bool symmetric = GetBool(in);
+   for (Integer i = 0; i < rows; ++i)
+   {
+      for (Integer j = (symmetric ? i : 0); j < cols; ++j)
+      {
+         value(i, j) = GetReal(in);
+         if (symmetric)
+            value(j, i) = value(i, j);
+      }
+   }
+}
+
+
+//------------------------------------------------------------------------------
+// void EncodeRecord(const SeqEstimator::UpdateInfoType &info,
+//       std::vector<char> &out)
+//------------------------------------------------------------------------------
+/**
+ * Appends the encoded form of an update record to a buffer.
+ */
+//------------------------------------------------------------------------------
+static void EncodeRecord(const SeqEstimator::UpdateInfoType &info,
+                         std::vector<char> &out)
+{
+   PutTime(out, info.epoch);
+   PutBool(out, info.isObs);
+   PutArray(out, info.state);
+   PutMatrix(out, info.cov);
+   PutMatrix(out, info.sigmaVNB);
+   PutMatrix(out, info.processNoise);
+   PutMatrix(out, info.stm);
+
+   if (!info.isObs)
+      return;
+
+   const SeqEstimator::FilterMeasurementInfoType &meas = info.measStat;
+   PutTime(out, meas.epoch);
+   PutInteger(out, (Integer)meas.recNum);
+   PutInteger(out, meas.modelSize);
+   PutInteger(out, meas.editFlag);
+   PutBool(out, meas.isCalculated);
+   PutString(out, meas.removedReason);
+   PutString(out, meas.station);
+   PutString(out, meas.type);
+   PutInteger(out, meas.uniqueID);
+   PutReal(out, meas.frequency);
+   PutReal(out, meas.feasibilityValue);
+   PutArray(out, meas.measValue);
+   PutArray(out, meas.residual);
+   PutArray(out, meas.weight);
+   PutInteger(out, (Integer)meas.hAccum.size());
+   for (UnsignedInt i = 0; i < meas.hAccum.size(); ++i)
+      PutArray(out, meas.hAccum[i]);
+   PutReal(out, meas.tropoCorrectValue);
+   PutReal(out, meas.ionoCorrectValue);
+   PutArray(out, meas.state);
+   PutMatrix(out, meas.cov);
+   PutMatrix(out, meas.sigmaVNB);
+   PutArray(out, meas.scaledResid);
+   PutMatrix(out, meas.kalmanGain);
+}
+
+
+//------------------------------------------------------------------------------
+// void DecodeRecord(const char *in, SeqEstimator::UpdateInfoType &info)
+//------------------------------------------------------------------------------
+/**
+ * Fills an update record from its encoded form, reusing its storage.
+ */
+//------------------------------------------------------------------------------
+static void DecodeRecord(const char *in, SeqEstimator::UpdateInfoType &info)
+{
+   GetTime(in, info.epoch);
+   info.isObs = GetBool(in);
+   GetArray(in, info.state);
+   GetMatrix(in, info.cov);
+   GetMatrix(in, info.sigmaVNB);
+   GetMatrix(in, info.processNoise);
+   GetMatrix(in, info.stm);
+
+   if (!info.isObs)
+   {
+      info.measStat = SeqEstimator::FilterMeasurementInfoType();
+      return;
+   }
+
+   SeqEstimator::FilterMeasurementInfoType &meas = info.measStat;
+   GetTime(in, meas.epoch);
+   meas.recNum = (UnsignedInt)GetInteger(in);
+   meas.modelSize = GetInteger(in);
+   meas.editFlag = GetInteger(in);
+   meas.isCalculated = GetBool(in);
+   GetString(in, meas.removedReason);
+   GetString(in, meas.station);
+   GetString(in, meas.type);
+   meas.uniqueID = GetInteger(in);
+   meas.frequency = GetReal(in);
+   meas.feasibilityValue = GetReal(in);
+   GetArray(in, meas.measValue);
+   GetArray(in, meas.residual);
+   GetArray(in, meas.weight);
+   meas.hAccum.resize(GetInteger(in));
+   for (UnsignedInt i = 0; i < meas.hAccum.size(); ++i)
+      GetArray(in, meas.hAccum[i]);
+   meas.tropoCorrectValue = GetReal(in);
+   meas.ionoCorrectValue = GetReal(in);
+   GetArray(in, meas.state);
+   GetMatrix(in, meas.cov);
+   GetMatrix(in, meas.sigmaVNB);
+   GetArray(in, meas.scaledResid);
+   GetMatrix(in, meas.kalmanGain);
+}
+
+
+//------------------------------------------------------------------------------
+// FilterHistory()
+//------------------------------------------------------------------------------
+/**
+ * Default constructor; the memory limit defaults to 1 GB.
+ */
+//------------------------------------------------------------------------------
+FilterHistory::FilterHistory() :
+   storage        (new Storage()),
+   memoryLimit    (1024 * 1048576UL)
+{
+   ResetCache();
+}
+
+
+//------------------------------------------------------------------------------
+// ~FilterHistory()
+//------------------------------------------------------------------------------
+FilterHistory::~FilterHistory()
+{
+}
+
+
+//------------------------------------------------------------------------------
+// FilterHistory(const FilterHistory &fh)
+//------------------------------------------------------------------------------
+/**
+ * Copy constructor; the copy shares the records of fh.
+ *
+ * @param fh The history whose records are shared
+ */
+//------------------------------------------------------------------------------
+FilterHistory::FilterHistory(const FilterHistory &fh) :
+   storage        (fh.storage),
+   memoryLimit    (fh.memoryLimit)
+{
+   ResetCache();
+}
+
+
+//------------------------------------------------------------------------------
+// FilterHistory& operator=(const FilterHistory &fh)
+//------------------------------------------------------------------------------
+/**
+ * Assignment operator; this history then shares the records of fh.
+ */
+//------------------------------------------------------------------------------
+FilterHistory& FilterHistory::operator=(const FilterHistory &fh)
+{
+   if (this != &fh)
+   {
+      storage     = fh.storage;
+      memoryLimit = fh.memoryLimit;
+      ResetCache();
+   }
+   return *this;
+}
+
+
+//------------------------------------------------------------------------------
+// void SetMemoryLimit(Real megabytes)
+//------------------------------------------------------------------------------
+/**
+ * Sets how much encoded data is kept in memory before spilling to disk.
+ *
+ * @param megabytes The limit in MB; 0 writes every record to disk
+ */
+//------------------------------------------------------------------------------
+void FilterHistory::SetMemoryLimit(Real megabytes)
+{
+   if (megabytes < 0.0)
+      throw EstimatorException("The filter history memory limit cannot be "
+            "negative");
+   memoryLimit = (size_t)(megabytes * 1048576.0);
+}
+
+
+//------------------------------------------------------------------------------
+// Real GetMemoryLimit() const
+//------------------------------------------------------------------------------
+Real FilterHistory::GetMemoryLimit() const
+{
+   return memoryLimit / 1048576.0;
+}
+
+
+//------------------------------------------------------------------------------
+// void Clear()
+//------------------------------------------------------------------------------
+/**
+ * Removes all records.  Copies sharing the records keep them.
+ */
+//------------------------------------------------------------------------------
+void FilterHistory::Clear()
+{
+   storage.reset(new Storage());
+   ResetCache();
+}
+
+
+//------------------------------------------------------------------------------
+// void Add(const SeqEstimator::UpdateInfoType &info)
+//------------------------------------------------------------------------------
+/**
+ * Appends a record to the history.
+ *
+ * @param info The record
+ */
+//------------------------------------------------------------------------------
+void FilterHistory::Add(const SeqEstimator::UpdateInfoType &info)
+{
+   if (storage.use_count() > 1)
+      Detach();
+
+   Storage::RecordKey key;
+   key.epoch  = info.epoch;
+   key.isObs  = info.isObs;
+   key.recNum = (info.isObs ? info.measStat.recNum : 0);
+   key.offset = storage->spilledBytes + storage->buffer.size();
+
+   EncodeRecord(info, storage->buffer);
+
+   key.length = storage->spilledBytes + storage->buffer.size() - key.offset;
+   storage->keys.push_back(key);
+
+   if (storage->buffer.size() > memoryLimit)
+      storage->Spill();
+}
+
+
+//------------------------------------------------------------------------------
+// UnsignedInt GetSize() const
+//------------------------------------------------------------------------------
+UnsignedInt FilterHistory::GetSize() const
+{
+   return storage->keys.size();
+}
+
+
+//------------------------------------------------------------------------------
+// bool IsEmpty() const
+//------------------------------------------------------------------------------
+bool FilterHistory::IsEmpty() const
+{
+   return storage->keys.empty();
+}
+
+
+//------------------------------------------------------------------------------
+// const SeqEstimator::UpdateInfoType& operator[](UnsignedInt index) const
+//------------------------------------------------------------------------------
+/**
+ * Returns a record.
+ *
+ * @param index The index of the record, in the order the records were added
+ *
+ * @return The decoded record; the references returned by the last three calls
+ *         remain valid
+ */
+//------------------------------------------------------------------------------
+const SeqEstimator::UpdateInfoType&
+      FilterHistory::operator[](UnsignedInt index) const
+{
+   if (index >= storage->keys.size())
+      throw EstimatorException("Filter history index out of range");
+
+   ++useCount;
+
+   Integer slot = 0;
+   for (Integer i = 0; i < CACHE_SIZE; ++i)
+   {
+      if (cacheIndex[i] == (Integer)index)
+      {
+         cacheUse[i] = useCount;
+         return cache[i];
+      }
+      if (cacheUse[i] < cacheUse[slot])
+         slot = i;
+   }
+
+   DecodeRecord(GetRecordData(index), cache[slot]);
+   cacheIndex[slot] = index;
+   cacheUse[slot] = useCount;
+
+   return cache[slot];
+}
+
+
+//------------------------------------------------------------------------------
+// const SeqEstimator::UpdateInfoType& Back() const
+//------------------------------------------------------------------------------
+/**
+ * Returns the last record added.
+ */
+//------------------------------------------------------------------------------
+const SeqEstimator::UpdateInfoType& FilterHistory::Back() const
+{
+   if (storage->keys.empty())
+      throw EstimatorException("The filter history is empty");
+   return (*this)[storage->keys.size() - 1];
+}
+
+
+//------------------------------------------------------------------------------
+// const GmatTime& GetEpoch(UnsignedInt index) const
+//------------------------------------------------------------------------------
+/**
+ * Returns the epoch of a record without decoding it.
+ */
+//------------------------------------------------------------------------------
+const GmatTime& FilterHistory::GetEpoch(UnsignedInt index) const
+{
+   return storage->keys.at(index).epoch;
+}
+
+
+//------------------------------------------------------------------------------
+// bool IsObs(UnsignedInt index) const
+//------------------------------------------------------------------------------
+/**
+ * Returns the observation flag of a record without decoding it.
+ */
+//------------------------------------------------------------------------------
+bool FilterHistory::IsObs(UnsignedInt index) const
+{
+   return storage->keys.at(index).isObs;
+}
+
+
+//------------------------------------------------------------------------------
+// UnsignedInt GetRecordNumber(UnsignedInt index) const
+//------------------------------------------------------------------------------
+/**
+ * Returns the measurement record number of a record without decoding it.
+ *
+ * @return The record number, or 0 if the record is not an observation
+ */
+//------------------------------------------------------------------------------
+UnsignedInt FilterHistory::GetRecordNumber(UnsignedInt index) const
+{
+   return storage->keys.at(index).recNum;
+}
+
+
+//------------------------------------------------------------------------------
+// size_t GetSpilledBytes() const
+//------------------------------------------------------------------------------
+/**
+ * Returns the number of bytes written to the scratch file.
+ */
+//------------------------------------------------------------------------------
+size_t FilterHistory::GetSpilledBytes() const
+{
+   return storage->spilledBytes;
+}
+
+
+//------------------------------------------------------------------------------
+// void ResetCache()
+//------------------------------------------------------------------------------
+void FilterHistory::ResetCache()
+{
+   for (Integer i = 0; i < CACHE_SIZE; ++i)
+   {
+      cacheIndex[i] = -1;
+      cacheUse[i] = 0;
+   }
+   useCount = 0;
+}
+
+
+//------------------------------------------------------------------------------
+// void Detach()
+//------------------------------------------------------------------------------
+/**
+ * Moves this history to a new storage layered on the shared one, so records
+ * can be added without affecting the other histories.
+ */
+//------------------------------------------------------------------------------
+void FilterHistory::Detach()
+{
+   std::shared_ptr<Storage> shared = storage;
+   storage.reset(new Storage());
+   storage->keys = shared->keys;
+   storage->base = shared;
+   storage->baseCount = shared->keys.size();
+}
+
+
+//------------------------------------------------------------------------------
+// const char* GetRecordData(UnsignedInt index) const
+//------------------------------------------------------------------------------
+/**
+ * Returns the encoded bytes of a record.
+ */
+//------------------------------------------------------------------------------
+const char* FilterHistory::GetRecordData(UnsignedInt index) const
+{
+   const Storage::RecordKey &key = storage->keys[index];
+
+   Storage *owner = storage.get();
+   while (index < owner->baseCount)
+      owner = owner->base.get();
+
+   return owner->Read(key.offset, key.length);
+}
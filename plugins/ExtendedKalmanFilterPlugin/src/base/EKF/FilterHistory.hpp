@@ -0,0 +1,107 @@
+//$Id$
+//------------------------------------------------------------------------------
+//                              FilterHistory
+//------------------------------------------------------------------------------
+// GMAT: General Mission Analysis Tool
+//
+// Copyright (c) 2002 - 2020 United States Government as represented by the
+// Administrator of The National Aeronautics and Space Administration.
+// All Other Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// You may not use this file except in compliance with the License.
+// You may obtain a copy of the License at:
+// http://www.apache.org/licenses/LICENSE-2.0.
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied.   See the License for the specific language
+// governing permissions and limitations under the License.
+//
+// Author: GMAT Development Team
+// Created: 2026/10/17
+//
+/**
+ * Definition of the store for the update records of a sequential estimator
+ */
+//------------------------------------------------------------------------------
+
+
+#ifndef FilterHistory_hpp
+#define FilterHistory_hpp
+
+#include "kalman_defs.hpp"
+#include "SeqEstimator.hpp"
+#include <memory>
+
+/**
+ * Holds the SeqEstimator::UpdateInfoType records written by a filter pass.
+ *
+ * Records are appended in the order the filter produces them and are stored
+ * in a compact binary form.  Once the encoded records held in memory exceed the
+ * memory limit they are written, in sequence, to a scratch file in the
+ * temporary directory; that file is memory mapped when spilled records are
+ * read back.  Reads decode a record into one of a few cached copies; the
+ * references returned by the last three reads stay valid.
+ *
+ * The epoch, observation flag and record number of each record are kept in
+ * memory so that searches over the history do not decode records.
+ *
+ * Copies share the stored records.  Adding to a shared history starts a new
+ * storage layered on the shared one, so the records are never copied; Clear()
+ * detaches the history from the others.
+ */
+class KALMAN_API FilterHistory
+{
+public:
+   FilterHistory();
+   ~FilterHistory();
+   FilterHistory(const FilterHistory &fh);
+   FilterHistory&       operator=(const FilterHistory &fh);
+
+   void                 SetMemoryLimit(Real megabytes);
+   Real                 GetMemoryLimit() const;
+
+   void                 Clear();
+   void                 Add(const SeqEstimator::UpdateInfoType &info);
+
+   UnsignedInt          GetSize() const;
+   bool                 IsEmpty() const;
+   const SeqEstimator::UpdateInfoType&
+                        operator[](UnsignedInt index) const;
+   const SeqEstimator::UpdateInfoType&
+                        Back() const;
+
+   const GmatTime&      GetEpoch(UnsignedInt index) const;
+   bool                 IsObs(UnsignedInt index) const;
+   UnsignedInt          GetRecordNumber(UnsignedInt index) const;
+
+   size_t               GetSpilledBytes() const;
+
+protected:
+   /// Encoded records and the scratch file; defined in FilterHistory.cpp
+   struct Storage;
+
+   /// The records, shared between copies
+   std::shared_ptr<Storage>   storage;
+   /// Size of the encoded records kept in memory before spilling, in bytes
+   size_t                     memoryLimit;
+
+   /// Number of decoded records kept for operator[]
+   static const Integer       CACHE_SIZE = 4;
+   /// Decoded records
+   mutable SeqEstimator::UpdateInfoType
+                              cache[CACHE_SIZE];
+   /// History index held in each cache slot, -1 for none
+   mutable Integer            cacheIndex[CACHE_SIZE];
+   /// Read counter value at the last use of each cache slot
+   mutable UnsignedInt        cacheUse[CACHE_SIZE];
+   /// Counter of reads; the least recently used slot is replaced on a miss
+   mutable UnsignedInt        useCount;
+
+   void                 ResetCache();
+   void                 Detach();
+   const char*          GetRecordData(UnsignedInt index) const;
+};
+
+#endif // FilterHistory_hpp
@@ -30,6 +30,7 @@
 //------------------------------------------------------------------------------
 
 #include "SeqEstimator.hpp"
+#include "FilterHistory.hpp"
 
 #include "GmatConstants.hpp"
 #include "FileUtil.hpp"
@@ -88,6 +89,7 @@ SeqEstimator::PARAMETER_TEXT[] =
    "WarmStartEpochFormat",          // The epoch format used by WarmStartEpoch
    "WarmStartEpoch",                // The epoch to initialize the SeqEstimator from based on the InputWarmStartFile
    "OutputWarmStartFile",           // The file to write SeqEstimator data to
+   "HistoryMemoryLimit",            // Memory (MB) for the update records before they go to disk
 };
 
 const Gmat::ParameterType
@@ -100,6 +102,7 @@ SeqEstimator::PARAMETER_TYPE[] =
    Gmat::STRING_TYPE,
    Gmat::STRING_TYPE,
    Gmat::STRING_TYPE,
+   Gmat::REAL_TYPE,
 };
 // End EKF mod
 
@@ -128,6 +131,7 @@ SeqEstimator::SeqEstimator(const std::string &type,
    restartEpochFormat      ("TAIModJulian"),
    restartEpoch            ("FirstMeasurement"),
    outputDataFile          (""),
+   historyMemoryLimit      (1024.0),
    vnbFrame                (NULL)
 // End EKF mod
 {
@@ -136,6 +140,8 @@ SeqEstimator::SeqEstimator(const std::string &type,
 
    objectTypeNames.push_back("SeqEstimator");
    parameterCount = SeqEstimatorParamCount;
+
+   updateStats = new FilterHistory();
 }
 
 
@@ -144,6 +150,9 @@ SeqEstimator::SeqEstimator(const std::string &type,
 //------------------------------------------------------------------------------
 /**
  * Destructor
+ *
+ * Deletes the update history created by the constructors, along with its
+ * scratch file if records were spilled.
  */
 //------------------------------------------------------------------------------
 SeqEstimator::~SeqEstimator()
@@ -152,6 +161,7 @@ SeqEstimator::~SeqEstimator()
       dataFile.close();
    if (vnbFrame)
       delete vnbFrame;
+   delete updateStats;
 }
 
 
@@ -178,10 +188,13 @@ SeqEstimator::SeqEstimator(const SeqEstimator & se) :
    restartEpochFormat      (se.restartEpochFormat),
    restartEpoch            (se.restartEpoch),
    outputDataFile          (se.outputDataFile),
+   historyMemoryLimit      (se.historyMemoryLimit),
    vnbFrame                (NULL)
 // End EKF mod
 {
    hiLowData.push_back(&sigma);
+
+   updateStats = new FilterHistory();
 }
 
 
@@ -212,6 +225,7 @@ SeqEstimator& SeqEstimator::operator=(
       restartEpochFormat = se.restartEpochFormat;
       restartEpoch = se.restartEpoch;
       outputDataFile = se.outputDataFile;
+      historyMemoryLimit = se.historyMemoryLimit;
       vnbFrame = NULL;
    }
    return *this;
@@ -381,6 +395,9 @@ Real SeqEstimator::GetRealParameter(const Integer id) const
    if (id == DELAY_RECTIFY_TIME)
       return delayRectifySpan;
 
+   if (id == HISTORY_MEMORY_LIMIT)
+      return historyMemoryLimit;
+
    return Estimator::GetRealParameter(id);
 }
 
@@ -428,6 +445,16 @@ Real SeqEstimator::SetRealParameter(const Integer id, const Real value)
       return delayRectifySpan;
    }
 
+   if (id == HISTORY_MEMORY_LIMIT)
+   {
+      if (value >= 0.0)
+         historyMemoryLimit = value;
+      else
+         throw EstimatorException("Error: " + GetName() + "." + GetParameterText(id) + " cannot be negative\n");
+
+      return historyMemoryLimit;
+   }
+
    return Estimator::SetRealParameter(id, value);
 }
 
@@ -888,17 +915,19 @@ bool SeqEstimator::IsFinalPass()
 
 
 //------------------------------------------------------------------------------
-// std::vector<SeqEstimator::UpdateInfoType> GetUpdateStats()
+// const FilterHistory& GetUpdateStats()
 //------------------------------------------------------------------------------
 /**
- * This returns the vector of UpdateInfoType
+ * This returns the UpdateInfoType records of the last run
+ *
+ * Copies of the returned history share its records.
  *
- * @return the vector of UpdateInfoType
+ * @return the history of UpdateInfoType records
  */
  //------------------------------------------------------------------------------
-std::vector<SeqEstimator::UpdateInfoType> SeqEstimator::GetUpdateStats()
+const FilterHistory& SeqEstimator::GetUpdateStats()
 {
-   return updateStats;
+   return *updateStats;
 }
 
 
@@ -1125,7 +1154,8 @@ void SeqEstimator::CompleteInitialization()
    solv2KeplMatrixPrev = solv2KeplMatrix;
 
    measStats.clear();
-   updateStats.clear();
+   updateStats->Clear();
+   updateStats->SetMemoryLimit(historyMemoryLimit);
    isInitialized = true;
 
 // EKF mod 12/16
@@ -1226,7 +1256,7 @@ void SeqEstimator::CompleteInitialization()
 
       WriteDataFile();
       AddMatlabFilterData(updateStat);
-      updateStats.push_back(updateStat);
+      updateStats->Add(updateStat);
 }
 
 //------------------------------------------------------------------------------
@@ -1375,7 +1405,7 @@ void SeqEstimator::TimeUpdate()
    Rmatrix dX_dS = cart2SolvMatrixPrev;
    Rmatrix dS_dX = cart2SolvMatrix.Inverse();
 
-   Rmatrix Q_S = dS_dX * Q * dS_dX.Transpose();
+   Rmatrix Q_S = MatrixTimesMatrixTimesTranspose(dS_dX, Q);
    Rmatrix stm_S = dS_dX * (*stm) * dX_dS;
 
    // Update offset from reference trajectory
@@ -1391,7 +1421,8 @@ void SeqEstimator::TimeUpdate()
          (*offsetState)[i] = xOffset[i];
    }
 
-   pBar = stm_S * (*(stateCovariance->GetCovariance())) * stm_S.Transpose() + Q_S;
+   pBar = MatrixTimesMatrixTimesTranspose(stm_S,
+         *(stateCovariance->GetCovariance())) + Q_S;
 
    #ifdef DEBUG_ESTIMATION
       MessageInterface::ShowMessage("Q = \n");
@@ -1650,7 +1681,7 @@ void SeqEstimator::PrepareForStep()
 //------------------------------------------------------------------------------
 /**
  * This method performs actions common to sequential estimators to update the
- * filter information and add it to the updateStats vector
+ * filter information and add it to the updateStats history
  */
  //------------------------------------------------------------------------------
 void SeqEstimator::FilterUpdate()
@@ -1698,7 +1729,7 @@ void SeqEstimator::FilterUpdate()
       {
          WriteDataFile();
          AddMatlabFilterData(updateStat);
-         updateStats.push_back(updateStat);
+         updateStats->Add(updateStat);
       }
 
       // Reset the STM
@@ -2123,7 +2154,7 @@ bool SeqEstimator::DataFilter()
    const MeasurementData *calculatedMeas = measManager.GetMeasurement(modelsToAccess[0]);      // Get calculated measurement data C
 
    Rmatrix R = *(GetMeasurementCovariance()->GetCovariance());
-   Rmatrix Rbar = H * pBar * H.Transpose() + R;
+   Rmatrix Rbar = MatrixTimesMatrixTimesTranspose(H, pBar) + R;
 
    // Adjust computed and residual based on value of xOffset
    Rvector H_x(measSize);
@@ -2248,11 +2279,11 @@ void SeqEstimator::WriteReportFileSummaryPart5(Solver::SolverState sState)
    textFile5 << "******************************************************************  FILTER COVARIANCE REPORT  ******************************************************************\n";
    textFile5 << "\n";
 
-   for (UnsignedInt ii = 0U; ii < updateStats.size(); ii++)
+   for (UnsignedInt ii = 0U; ii < updateStats->GetSize(); ii++)
    {
       if (GmatMathUtil::Mod(ii, 80) < 0.001)
          WriteCovariancePageHeader();
-      BuildCovarianceLine(updateStats[ii]);
+      BuildCovarianceLine((*updateStats)[ii]);
    }
    textFile5 << "\n";
    textFile5 << "***********************************************************************  END OF REPORT  ************************************************************************\n";
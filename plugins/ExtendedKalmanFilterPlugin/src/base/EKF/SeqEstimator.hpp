@@ -37,6 +37,8 @@
 #include "Estimator.hpp"
 #include "ProcessNoiseModel.hpp"
 
+class FilterHistory;
+
 /**
  * Provides core functionality used in sequential estimation.
  *
@@ -149,7 +151,7 @@ public:
    };
 
    // Functions added for smoothing
-   virtual std::vector<UpdateInfoType> GetUpdateStats();
+   virtual const FilterHistory& GetUpdateStats();
    virtual void         SetAnchorEpoch(const GmatTime& epoch, bool noiseBetween);
    virtual bool         UpdateInitialConditions();
 
@@ -190,6 +192,8 @@ protected:
    std::string outputDataFile;
    /// The output data file
    std::ofstream dataFile;
+   /// Memory (MB) used for the update records before they are written to disk
+   Real        historyMemoryLimit;
 
    /// Changes in the state vector
    Rvector                 dx;
@@ -242,6 +246,7 @@ protected:
       RESTART_EPOCH_FORMAT,
       RESTART_EPOCH,
       OUTPUT_DATA_FILE,
+      HISTORY_MEMORY_LIMIT,
 
       SeqEstimatorParamCount
    };
@@ -297,7 +302,11 @@ protected:
 
    virtual void           WriteCovariancePageHeader();
 
-   std::vector<UpdateInfoType> updateStats;
+   /// Update records of the last run, spilled to disk past historyMemoryLimit.
+   /// Owned by the estimator: created by the constructors and deleted by the
+   /// destructor.  Held by pointer because FilterHistory.hpp needs the
+   /// UpdateInfoType declared here.
+   FilterHistory *updateStats;
 
    virtual void           BuildCovarianceLine(const UpdateInfoType &updateStat);
 
@@ -141,11 +141,9 @@ bool RunSmoother::Initialize()
 
             if (obj && obj->IsOfType("SeqEstimator"))
             {
-               std::vector<SeqEstimator::UpdateInfoType> forwardFilterInfo;
-
                // Get the filter statistics from this instance.
-               forwardFilterInfo = ((SeqEstimator*) obj)->GetUpdateStats();
-               ((Smoother*) theEstimator)->SetForwardFilterInfo(forwardFilterInfo);
+               ((Smoother*) theEstimator)->SetForwardFilterInfo(
+                     ((SeqEstimator*) obj)->GetUpdateStats());
                break;
             }
          }
@@ -277,7 +277,7 @@ void ProcessNoiseBase::ConvertMatrix(Rmatrix &mat, const GmatTime &epoch)
       MessageInterface::ShowMessage("\n");
    #endif
 
-   mat = transform*mat*transform.Transpose();
+   mat = MatrixTimesMatrixTimesTranspose(transform, mat);
 
    #ifdef DEBUG_CONVERSION
       MessageInterface::ShowMessage("   Output matrix:\n");
@@ -154,25 +154,26 @@ void  Smoother::Copy(const GmatBase* orig)
  //------------------------------------------------------------------------------
 void Smoother::SmoothState(SmootherInfoType &smootherStat, bool includeUpdate)
 {
-   UnsignedInt backFilterIndex = FindIndex(forwardFilterInfo[filterIndex],
-                                           backwardFilterInfo);
+   const SeqEstimator::UpdateInfoType &forwardInfo = forwardFilterInfo[filterIndex];
+   UnsignedInt backFilterIndex = FindIndex(forwardInfo, backwardFilterInfo);
+   const SeqEstimator::UpdateInfoType &backwardInfo = backwardFilterInfo[backFilterIndex];
 
-   Rvector forwardState = forwardFilterInfo[filterIndex].state;
-   Rvector backwardState = backwardFilterInfo[backFilterIndex].state;
+   Rvector forwardState = forwardInfo.state;
+   Rvector backwardState = backwardInfo.state;
 
-   Rmatrix forwardCov = forwardFilterInfo[filterIndex].cov;
-   Rmatrix backwardCov = backwardFilterInfo[backFilterIndex].cov;
+   Rmatrix forwardCov = forwardInfo.cov;
+   Rmatrix backwardCov = backwardInfo.cov;
 
-   smootherStat.epoch = forwardFilterInfo[filterIndex].epoch;
-   smootherStat.isObs = forwardFilterInfo[filterIndex].isObs;
+   smootherStat.epoch = forwardInfo.epoch;
+   smootherStat.isObs = forwardInfo.isObs;
 
    if (smootherStat.isObs && includeUpdate)
    {
-      Rvector forwardAprioriState = forwardFilterInfo[filterIndex].measStat.state;
-      Rvector backwardAprioriState = backwardFilterInfo[backFilterIndex].measStat.state;
+      Rvector forwardAprioriState = forwardInfo.measStat.state;
+      Rvector backwardAprioriState = backwardInfo.measStat.state;
 
-      Rmatrix forwardAprioriCov = forwardFilterInfo[filterIndex].measStat.cov;
-      Rmatrix backwardAprioriCov = backwardFilterInfo[backFilterIndex].measStat.cov;
+      Rmatrix forwardAprioriCov = forwardInfo.measStat.cov;
+      Rmatrix backwardAprioriCov = backwardInfo.measStat.cov;
 
       Rmatrix weight1, weight2;
 
@@ -207,8 +208,8 @@ void Smoother::SmoothState(SmootherInfoType &smootherStat, bool includeUpdate)
       if (smootherStat.isObs)
       {
          // Replace forward state & cov with pre-update values
-         forwardState = forwardFilterInfo[filterIndex].measStat.state;
-         forwardCov = forwardFilterInfo[filterIndex].measStat.cov;
+         forwardState = forwardInfo.measStat.state;
+         forwardCov = forwardInfo.measStat.cov;
       }
 
       Rmatrix weight;
@@ -236,27 +237,31 @@ void Smoother::SmoothState(SmootherInfoType &smootherStat, bool includeUpdate)
 
 
 //------------------------------------------------------------------------------
-// UnsignedInt FindIndex(SeqEstimator::UpdateInfoType &filterInfo,
-//                       std::vector<SeqEstimator::UpdateInfoType> &filterInfoVector)
+// UnsignedInt FindIndex(const SeqEstimator::UpdateInfoType &filterInfo,
+//                       const FilterHistory &filterInfoVector)
 //------------------------------------------------------------------------------
 /**
  * Find the index of a filter info struct that matches the provied struct
+ *
+ * Only the epochs and record numbers kept in memory by the history are read,
+ * so the search does not decode records.
  */
  //------------------------------------------------------------------------------
-UnsignedInt Smoother::FindIndex(SeqEstimator::UpdateInfoType &filterInfo,
-                                std::vector<SeqEstimator::UpdateInfoType> &filterInfoVector)
+UnsignedInt Smoother::FindIndex(const SeqEstimator::UpdateInfoType &filterInfo,
+                                const FilterHistory &filterInfoVector)
 {
    bool found = false;
    UnsignedInt searchIndex = 0;
 
-   for (UnsignedInt ii = 0U; ii < filterInfoVector.size(); ii++)
+   for (UnsignedInt ii = 0U; ii < filterInfoVector.GetSize(); ii++)
    {
-      if (GmatMathUtil::IsEqual(filterInfo.epoch, filterInfoVector[ii].epoch, ESTTIME_ROUNDOFF))
+      if (GmatMathUtil::IsEqual(filterInfo.epoch, filterInfoVector.GetEpoch(ii), ESTTIME_ROUNDOFF))
       {
          found = true;
          searchIndex = ii;
 
-         if (ObsMatch(filterInfo, filterInfoVector[ii]))
+         if (ObsMatch(filterInfo, filterInfoVector.IsObs(ii),
+                      filterInfoVector.GetRecordNumber(ii)))
             break;
       }
    }
@@ -269,18 +274,23 @@ UnsignedInt Smoother::FindIndex(SeqEstimator::UpdateInfoType &filterInfo,
 
 
 //------------------------------------------------------------------------------
-// bool ObsMatch(SeqEstimator::UpdateInfoType &filterInfo1,
-//               SeqEstimator::UpdateInfoType &filterInfo2)
+// bool ObsMatch(const SeqEstimator::UpdateInfoType &filterInfo1,
+//               bool isObs2, UnsignedInt recNum2)
 //------------------------------------------------------------------------------
 /**
- * Find if the two filter info struct correspond to the same measurement(s)
+ * Find if a filter info struct and a history record correspond to the same
+ * measurement(s)
+ *
+ * @param filterInfo1 The filter info
+ * @param isObs2      The observation flag of the history record
+ * @param recNum2     The measurement record number of the history record
  */
  //------------------------------------------------------------------------------
-bool Smoother::ObsMatch(SeqEstimator::UpdateInfoType &filterInfo1,
-                               SeqEstimator::UpdateInfoType &filterInfo2)
+bool Smoother::ObsMatch(const SeqEstimator::UpdateInfoType &filterInfo1,
+                        bool isObs2, UnsignedInt recNum2)
 {
    // See if one has a measurement while the other doesn't
-   if (filterInfo1.isObs != filterInfo2.isObs)
+   if (filterInfo1.isObs != isObs2)
       return false;
 
    // If both are not measurements, we're done
@@ -290,7 +300,7 @@ bool Smoother::ObsMatch(SeqEstimator::UpdateInfoType &filterInfo1,
    // If both are measurements, need to compare record numbers
    // TODO: When batch update is implemented, will need to check that each element
    //       of recNum match
-   if (filterInfo1.measStat.recNum == filterInfo2.measStat.recNum)
+   if (filterInfo1.measStat.recNum == recNum2)
       return true;
 
    // Otherwise, false
@@ -319,12 +329,13 @@ bool Smoother::WriteAdditionalMatData()
    matBackFilter.SetInitialRealValue(NAN);
 
    // populate backwards filter mat data
-   for (UnsignedInt ii = 0U; ii < backwardFilterInfo.size(); ii++)
+   for (UnsignedInt ii = 0U; ii < backwardFilterInfo.GetSize(); ii++)
    {
-      AddMatlabFilterData(backwardFilterInfo[ii], matBackFilter, matBackFilterIndex);
+      const SeqEstimator::UpdateInfoType &backwardInfo = backwardFilterInfo[ii];
+      AddMatlabFilterData(backwardInfo, matBackFilter, matBackFilterIndex);
 
-      if (backwardFilterInfo[ii].isObs)
-         AddMatlabData(backwardFilterInfo[ii].measStat, matBackComputed, matBackComputedIndex);
+      if (backwardInfo.isObs)
+         AddMatlabData(backwardInfo.measStat, matBackComputed, matBackComputedIndex);
    }
 
    // Add backward filter computed data
@@ -52,10 +52,10 @@ public:
 
 protected:
    virtual void           SmoothState(SmootherInfoType &smootherStat, bool includeUpdate);
-   virtual UnsignedInt    FindIndex(SeqEstimator::UpdateInfoType &filterInfo,
-                                    std::vector<SeqEstimator::UpdateInfoType> &filterInfoVector);
-   virtual bool           ObsMatch(SeqEstimator::UpdateInfoType &filterInfo1,
-                                   SeqEstimator::UpdateInfoType &filterInfo2);
+   virtual UnsignedInt    FindIndex(const SeqEstimator::UpdateInfoType &filterInfo,
+                                    const FilterHistory &filterInfoVector);
+   virtual bool           ObsMatch(const SeqEstimator::UpdateInfoType &filterInfo1,
+                                   bool isObs2, UnsignedInt recNum2);
 
    virtual bool           WriteAdditionalMatData();
 };
@@ -805,7 +805,7 @@ void SmootherBase::StateCleanUp()
          BeginPredicting(predictTimeSpan);
          filter->TakeAction("RunForwards");
          filter->UpdateCurrentEpoch(currentEpochGT);
-         filter->SetAnchorEpoch(forwardFilterInfo[0].epoch, false);
+         filter->SetAnchorEpoch(forwardFilterInfo.GetEpoch(0), false);
          filter->BeginPredicting(predictTimeSpan);
          currentState = PROPAGATING;
          smootherState = PREDICTING;
@@ -887,7 +887,7 @@ void SmootherBase::PrepareFilter()
    GmatState estimationStateFilterS = esmFilter->GetEstimationState();
 
    // Reset state to estimation epoch
-   SeqEstimator::UpdateInfoType lastState = forwardFilterInfo.back();
+   const SeqEstimator::UpdateInfoType &lastState = forwardFilterInfo.Back();
 
    estimationEpochGT = lastState.epoch;
    currentEpochGT = lastState.epoch;
@@ -910,15 +910,17 @@ void SmootherBase::PrepareFilter()
 
 
 //------------------------------------------------------------------------------
-//  void SetForwardFilterInfo(std::vector<SeqEstimator::UpdateInfoType> filterInfo)
+//  void SetForwardFilterInfo(const FilterHistory &filterInfo)
 //------------------------------------------------------------------------------
 /**
  * Passes the filter info from the forward filter pass to the smoother
  *
+ * The records are shared with the forward filter, not copied.
+ *
  * @param filterInfo The filter info to set
  */
  //------------------------------------------------------------------------------
-void SmootherBase::SetForwardFilterInfo(std::vector<SeqEstimator::UpdateInfoType> filterInfo)
+void SmootherBase::SetForwardFilterInfo(const FilterHistory &filterInfo)
 {
    forwardFilterInfo = filterInfo;
 }
@@ -1275,20 +1277,20 @@ void SmootherBase::CompleteInitialization()
 
    while (atFirstEpoch)
    {
-      obsAtFirstEpoch = obsAtFirstEpoch || forwardFilterInfo[ii].isObs;
+      obsAtFirstEpoch = obsAtFirstEpoch || forwardFilterInfo.IsObs(ii);
 
       if (obsAtFirstEpoch)
          break; // Don't need to keep checking
 
       ii++; // Go to next item
 
-      if (ii == forwardFilterInfo.size())
+      if (ii == forwardFilterInfo.GetSize())
          break; // Exit, we've reached the end of the vector
 
-      atFirstEpoch = GmatMathUtil::IsEqual(forwardFilterInfo[0].epoch, forwardFilterInfo[ii].epoch, ESTTIME_ROUNDOFF);
+      atFirstEpoch = GmatMathUtil::IsEqual(forwardFilterInfo.GetEpoch(0), forwardFilterInfo.GetEpoch(ii), ESTTIME_ROUNDOFF);
    }
 
-   TrimObsByEpoch(forwardFilterInfo[0].epoch, !obsAtFirstEpoch);
+   TrimObsByEpoch(forwardFilterInfo.GetEpoch(0), !obsAtFirstEpoch);
 
    esm.MapObjectsToVector();
 
@@ -1316,13 +1318,14 @@ void SmootherBase::CompleteInitialization()
    filter->SetRealParameter("DelayRectifyTimeSpan", delayFilterRectifySpan);
 
    // Use edit flags from forward filter for backward filter and smoother
-   for (UnsignedInt ii = 0U; ii < forwardFilterInfo.size(); ii++)
+   for (UnsignedInt ii = 0U; ii < forwardFilterInfo.GetSize(); ii++)
    {
-      if (forwardFilterInfo[ii].isObs)
+      if (forwardFilterInfo.IsObs(ii))
       {
-         Integer recNum = forwardFilterInfo[ii].measStat.recNum;
-         Integer editFlag = forwardFilterInfo[ii].measStat.editFlag;
-         std::string removedReason = forwardFilterInfo[ii].measStat.removedReason;
+         const SeqEstimator::UpdateInfoType &info = forwardFilterInfo[ii];
+         Integer recNum = info.measStat.recNum;
+         Integer editFlag = info.measStat.editFlag;
+         std::string removedReason = info.measStat.removedReason;
 
          filter->GetMeasurementManager()->GetObsDataObject(recNum)->inUsed = (editFlag == NORMAL_FLAG);
          filter->GetMeasurementManager()->GetObsDataObject(recNum)->removedReason = removedReason;
@@ -1334,12 +1337,12 @@ void SmootherBase::CompleteInitialization()
 
    // Set initial covariance for backwards filter
    Real covarianceIncrease = 1e10;
-   *(filter->GetEstimationStateManager()->GetCovariance()->GetCovariance()) = forwardFilterInfo.back().cov * covarianceIncrease;
+   *(filter->GetEstimationStateManager()->GetCovariance()->GetCovariance()) = forwardFilterInfo.Back().cov * covarianceIncrease;
 
    // Complete initialization of backwards filter
    filter->CompleteInitialization();
-   filter->SetAnchorEpoch(forwardFilterInfo[0].epoch, true);
-   filter->TrimObsByEpoch(forwardFilterInfo[0].epoch, false);
+   filter->SetAnchorEpoch(forwardFilterInfo.GetEpoch(0), true);
+   filter->TrimObsByEpoch(forwardFilterInfo.GetEpoch(0), false);
    filter->StateCleanUp();
    currentState = filter->GetState();
 }
@@ -1366,29 +1369,30 @@ void SmootherBase::FindTimeStep()
    }
    else
    {
-      if (filterIndex == forwardFilterInfo.size())
+      if (filterIndex == forwardFilterInfo.GetSize())
       {
          currentState = CHECKINGRUN;
          return;
       }
 
-      if (currentEpochGT == forwardFilterInfo[filterIndex].epoch)
+      if (currentEpochGT == forwardFilterInfo.GetEpoch(filterIndex))
       {
          timeStep = 0;
 
-         if (forwardFilterInfo[filterIndex].isObs)
+         if (forwardFilterInfo.IsObs(filterIndex))
             currentState = CALCULATING;
          else
          {
             SmootherUpdate();
             filterIndex++;
-            timeStep = (forwardFilterInfo[filterIndex].epoch - currentEpochGT).GetTimeInSec();
+            if (filterIndex < forwardFilterInfo.GetSize())
+               timeStep = (forwardFilterInfo.GetEpoch(filterIndex) - currentEpochGT).GetTimeInSec();
             currentState = PROPAGATING;
          }
       }
       else
       {
-         timeStep = (forwardFilterInfo[filterIndex].epoch - currentEpochGT).GetTimeInSec();
+         timeStep = (forwardFilterInfo.GetEpoch(filterIndex) - currentEpochGT).GetTimeInSec();
          currentState = PROPAGATING;
       }
    }
@@ -1480,9 +1484,9 @@ void SmootherBase::Estimate()
          // measStat.scaledResid = GmatMathUtil::Sqrt(yi * (H * pBar * H.Transpose() + R).Inverse() * yi);
 
          // The element-by-element scaled residual calculation:
+         Rmatrix Rbar = MatrixTimesMatrixTimesTranspose(H, pBar) + R;
          for (UnsignedInt k = 0; k < measStat.residual.size(); ++k)
          {
-            Rmatrix Rbar = H * pBar * H.Transpose() + R;
             Real sigmaVal = GmatMathUtil::Sqrt(Rbar(k, k));
             Real scaledResid = measStat.residual[k] / sigmaVal;
             measStat.scaledResid.push_back(scaledResid);
@@ -1704,7 +1708,7 @@ void SmootherBase::AdvanceEpoch()
    filterIndex++;
    resetState = true;
 
-   if (filterIndex == forwardFilterInfo.size())
+   if (filterIndex == forwardFilterInfo.GetSize())
    {
       currentState = CHECKINGRUN;
       return;
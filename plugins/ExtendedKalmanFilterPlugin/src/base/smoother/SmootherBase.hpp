@@ -33,6 +33,7 @@
 #include "kalman_defs.hpp"
 #include "Estimator.hpp"
 #include "SeqEstimator.hpp"
+#include "FilterHistory.hpp"
 
 /**
  * Provides core functionality used in smoothing.
@@ -120,7 +121,7 @@ public:
 
    SeqEstimator*        GetFilter();
    void                 PrepareFilter();
-   void                 SetForwardFilterInfo(std::vector<SeqEstimator::UpdateInfoType> filterInfo);
+   void                 SetForwardFilterInfo(const FilterHistory &filterInfo);
 
    virtual bool         ResetState();
    virtual void         MoveToNext(bool includeUpdate);
@@ -136,8 +137,8 @@ protected:
    std::string  filterName;
 
    // Filter info
-   std::vector<SeqEstimator::UpdateInfoType> forwardFilterInfo;
-   std::vector<SeqEstimator::UpdateInfoType> backwardFilterInfo;
+   FilterHistory forwardFilterInfo;
+   FilterHistory backwardFilterInfo;
 
    // Filter info index
    UnsignedInt filterIndex;
@@ -0,0 +1,324 @@
+//$Id$
+//------------------------------------------------------------------------------
+//                           LinearAlgebraFixture
+//------------------------------------------------------------------------------
+// GMAT: General Mission Analysis Tool
+//
+// Copyright (c) 2002 - 2020 United States Government as represented by the
+// Administrator of the National Aeronautics and Space Administration.
+// All Other Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// You may not use this file except in compliance with the License.
+// You may obtain a copy of the License at:
+// http://www.apache.org/licenses/LICENSE-2.0.
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied.   See the License for the specific language
+// governing permissions and limitations under the License.
+//
+// Author: GMAT Development Team
+// Created: 2026/10/17
+//
+/**
+ * Implements LinearAlgebraFixture, the reproducible random test data shared
+ * by the matrix, factorization and estimation unit tests.
+ */
+//------------------------------------------------------------------------------
+
+#include "LinearAlgebraFixture.hpp"
+#include "MatrixUtil.hpp"
+#include <algorithm>
+#include <cmath>
+
+
+//------------------------------------------------------------------------------
+// LinearAlgebraFixture(UnsignedInt seed)
+//------------------------------------------------------------------------------
+/**
+ * Constructor
+ *
+ * @param seed Seed of the generator; the same seed gives the same data
+ */
+//------------------------------------------------------------------------------
+LinearAlgebraFixture::LinearAlgebraFixture(UnsignedInt seed) :
+   generator   (seed),
+   uniform     (-1.0, 1.0)
+{
+}
+
+
+//------------------------------------------------------------------------------
+// Real Uniform()
+//------------------------------------------------------------------------------
+/**
+ * Returns the next uniform random value in [-1, 1)
+ */
+//------------------------------------------------------------------------------
+Real LinearAlgebraFixture::Uniform()
+{
+   return uniform(generator);
+}
+
+
+//------------------------------------------------------------------------------
+// Rmatrix RandomMatrix(Integer rows, Integer cols)
+//------------------------------------------------------------------------------
+/**
+ * Returns a matrix of uniform random elements in [-1, 1)
+ */
+//------------------------------------------------------------------------------
+Rmatrix LinearAlgebraFixture::RandomMatrix(Integer rows, Integer cols)
+{
+   Rmatrix m(rows, cols);
+   for (Integer i = 0; i < rows; ++i)
+      for (Integer j = 0; j < cols; ++j)
+         m(i, j) = Uniform();
+   return m;
+}
+
+
+//------------------------------------------------------------------------------
+// Rmatrix SpdMatrix(Integer n)
+//------------------------------------------------------------------------------
+/**
+ * Returns a well conditioned symmetric positive definite matrix, A^T A + n I
+ */
+//------------------------------------------------------------------------------
+Rmatrix LinearAlgebraFixture::SpdMatrix(Integer n)
+{
+   Rmatrix a = RandomMatrix(n, n);
+   Rmatrix spd = TransposeTimesMatrix(a, a);
+   for (Integer i = 0; i < n; ++i)
+      spd(i, i) += n;
+   return spd;
+}
+
+
+//------------------------------------------------------------------------------
+// RealArray Covariance(Integer n, Real decades)
+//------------------------------------------------------------------------------
+/**
+ * Returns a correlated covariance, row-major, with the standard deviations
+ * spread evenly over a number of orders of magnitude
+ *
+ * @param n       Size of the covariance
+ * @param decades Spread of the standard deviations, in orders of magnitude
+ */
+//------------------------------------------------------------------------------
+RealArray LinearAlgebraFixture::Covariance(Integer n, Real decades)
+{
+   RealArray a(n * n);
+   for (Integer i = 0; i < n * n; ++i)
+      a[i] = Uniform();
+   RealArray sig(n);
+   for (Integer i = 0; i < n; ++i)
+      sig[i] = std::pow(10.0, (n > 1 ? decades * i / (n - 1) : 0.0));
+
+   RealArray p(n * n, 0.0);
+   for (Integer i = 0; i < n; ++i)
+      for (Integer j = 0; j < n; ++j)
+      {
+         Real sum = (i == j ? n : 0.0);
+         for (Integer k = 0; k < n; ++k)
+            sum += 0.2 * a[i * n + k] * a[j * n + k];
+         p[i * n + j] = sig[i] * sig[j] * sum / n;
+      }
+   return p;
+}
+
+
+//------------------------------------------------------------------------------
+// FilterProblem MakeFilterProblem(Integer n, Integer steps, Real priorScale,
+//       Real r)
+//------------------------------------------------------------------------------
+/**
+ * Builds a covariance filtering problem with three scalar measurements per
+ * time update
+ *
+ * @param n          State size
+ * @param steps      Number of time updates
+ * @param priorScale Spread of the prior sigmas, in orders of magnitude
+ * @param r          Measurement variance
+ */
+//------------------------------------------------------------------------------
+FilterProblem LinearAlgebraFixture::MakeFilterProblem(Integer n, Integer steps,
+      Real priorScale, Real r)
+{
+   FilterProblem prob;
+   prob.n = n;
+   prob.steps = steps;
+   prob.measPerStep = 3;
+   prob.r = r;
+   prob.p0 = Covariance(n, priorScale);
+
+   // Near-identity transition, I + A with A small and skew symmetric, and
+   // diagonal process noise with some zero elements
+   prob.phi.assign(n * n, 0.0);
+   prob.q.assign(n * n, 0.0);
+   for (Integer i = 0; i < n; ++i)
+   {
+      prob.phi[i * n + i] = 1.0;
+      for (Integer j = i + 1; j < n; ++j)
+      {
+         prob.phi[i * n + j] = 0.01 * Uniform();
+         prob.phi[j * n + i] = -prob.phi[i * n + j];
+      }
+      prob.q[i * n + i] = (i % 4 == 3 ? 0.0 : 1.0e-6);
+   }
+
+   prob.h.resize(steps * prob.measPerStep * n);
+   for (UnsignedInt i = 0; i < prob.h.size(); ++i)
+      prob.h[i] = Uniform();
+
+   return prob;
+}
+
+
+//------------------------------------------------------------------------------
+// NormalEquationsProblem MakeNormalEquationsProblem(Integer passes,
+//       Integer perPass, Integer emptyPass, Integer globalCount = 7,
+//       Integer biasesPerPass = 2)
+//------------------------------------------------------------------------------
+/**
+ * Builds a least squares problem in which each measurement observes the
+ * global parameters and one bias of its pass.  The global parameters come
+ * after the first pass biases, so the two kinds of parameters are interleaved.
+ *
+ * @param passes        Number of passes
+ * @param perPass       Number of measurements per pass
+ * @param emptyPass     Index of a pass without measurements, or -1
+ * @param globalCount   Number of global parameters
+ * @param biasesPerPass Number of bias parameters of each pass
+ */
+//------------------------------------------------------------------------------
+NormalEquationsProblem LinearAlgebraFixture::MakeNormalEquationsProblem(
+      Integer passes, Integer perPass, Integer emptyPass, Integer globalCount,
+      Integer biasesPerPass)
+{
+   NormalEquationsProblem prob;
+   IntegerArray globalIndex;
+   for (Integer b = 0; b < passes; ++b)
+   {
+      for (Integer k = 0; k < biasesPerPass; ++k)
+         prob.blocks.push_back(b);
+      if (b == 0)
+         for (Integer i = 0; i < globalCount; ++i)
+         {
+            globalIndex.push_back(prob.blocks.size());
+            prob.blocks.push_back(-1);
+         }
+   }
+
+   Integer n = prob.blocks.size();
+   for (Integer b = 0; b < passes; ++b)
+   {
+      if (b == emptyPass)
+         continue;
+
+      Integer first = (b == 0 ? 0 : globalCount + b * biasesPerPass);
+      for (Integer m = 0; m < perPass; ++m)
+      {
+         LeastSquaresMeasurement meas;
+         meas.h.assign(n, 0.0);
+         for (Integer i = 0; i < globalCount; ++i)
+            meas.h[globalIndex[i]] = Uniform() * std::pow(10.0, i % 3);
+         // One bias observed by each measurement type of the pass
+         meas.h[first + (m % biasesPerPass)] = 1.0;
+         meas.weight = 1.0 / (0.01 + 0.005 * (1.0 + Uniform()));
+         meas.residual = Uniform();
+         prob.meas.push_back(meas);
+      }
+   }
+
+   return prob;
+}
+
+
+//------------------------------------------------------------------------------
+// Real MaxDifference(const Rmatrix &a, const Rmatrix &b)
+//------------------------------------------------------------------------------
+/**
+ * Returns the largest absolute difference of the elements
+ */
+//------------------------------------------------------------------------------
+Real LinearAlgebraFixture::MaxDifference(const Rmatrix &a, const Rmatrix &b)
+{
+   Real diff = 0.0;
+   for (Integer i = 0; i < a.GetNumRows(); ++i)
+      for (Integer j = 0; j < a.GetNumColumns(); ++j)
+         diff = std::max(diff, std::fabs(a(i, j) - b(i, j)));
+   return diff;
+}
+
+
+//------------------------------------------------------------------------------
+// Real MaxRelativeDifference(const Rmatrix &a, const Rmatrix &b)
+//------------------------------------------------------------------------------
+/**
+ * Returns the largest absolute difference of the elements, relative to the
+ * largest element of a
+ */
+//------------------------------------------------------------------------------
+Real LinearAlgebraFixture::MaxRelativeDifference(const Rmatrix &a,
+      const Rmatrix &b)
+{
+   Real maxA = 0.0;
+   for (Integer i = 0; i < a.GetNumRows(); ++i)
+      for (Integer j = 0; j < a.GetNumColumns(); ++j)
+         maxA = std::max(maxA, std::fabs(a(i, j)));
+   Real diff = MaxDifference(a, b);
+   return (maxA > 0.0 ? diff / maxA : diff);
+}
+
+
+//------------------------------------------------------------------------------
+// Real MaxRelativeDifference(const RealArray &a, const RealArray &b)
+//------------------------------------------------------------------------------
+Real LinearAlgebraFixture::MaxRelativeDifference(const RealArray &a,
+      const RealArray &b)
+{
+   Real maxA = 0.0, diff = 0.0;
+   for (UnsignedInt i = 0; i < a.size(); ++i)
+   {
+      maxA = std::max(maxA, std::fabs(a[i]));
+      diff = std::max(diff, std::fabs(a[i] - b[i]));
+   }
+   return (maxA > 0.0 ? diff / maxA : diff);
+}
+
+
+//------------------------------------------------------------------------------
+// Rmatrix ToMatrix(const RealArray &a, Integer n)
+//------------------------------------------------------------------------------
+/**
+ * Returns an n x n row-major array as an Rmatrix
+ */
+//------------------------------------------------------------------------------
+Rmatrix LinearAlgebraFixture::ToMatrix(const RealArray &a, Integer n)
+{
+   Rmatrix m(n, n);
+   for (Integer i = 0; i < n; ++i)
+      for (Integer j = 0; j < n; ++j)
+         m(i, j) = a[i * n + j];
+   return m;
+}
+
+
+//------------------------------------------------------------------------------
+// RealArray ToArray(const Rmatrix &m)
+//------------------------------------------------------------------------------
+/**
+ * Returns the elements of a matrix as a row-major array
+ */
+//------------------------------------------------------------------------------
+RealArray LinearAlgebraFixture::ToArray(const Rmatrix &m)
+{
+   Integer rows = m.GetNumRows(), cols = m.GetNumColumns();
+   RealArray a(rows * cols);
+   for (Integer i = 0; i < rows; ++i)
+      for (Integer j = 0; j < cols; ++j)
+         a[i * cols + j] = m(i, j);
+   return a;
+}
@@ -0,0 +1,104 @@
+//$Id$
+//------------------------------------------------------------------------------
+//                           LinearAlgebraFixture
+//------------------------------------------------------------------------------
+// GMAT: General Mission Analysis Tool
+//
+// Copyright (c) 2002 - 2020 United States Government as represented by the
+// Administrator of the National Aeronautics and Space Administration.
+// All Other Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// You may not use this file except in compliance with the License.
+// You may obtain a copy of the License at:
+// http://www.apache.org/licenses/LICENSE-2.0.
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied.   See the License for the specific language
+// governing permissions and limitations under the License.
+//
+// Author: GMAT Development Team
+// Created: 2026/10/17
+//
+/**
+ * Declares LinearAlgebraFixture, the reproducible random test data shared by
+ * the matrix, factorization and estimation unit tests.
+ */
+//------------------------------------------------------------------------------
+#ifndef LinearAlgebraFixture_hpp
+#define LinearAlgebraFixture_hpp
+
+#include "utildefs.hpp"
+#include "Rmatrix.hpp"
+#include <random>
+#include <vector>
+
+
+/// Covariance filtering problem: time updates, each followed by scalar
+/// measurement updates
+struct FilterProblem
+{
+   Integer   n;
+   Integer   steps;
+   Integer   measPerStep;
+   RealArray p0;          // Initial covariance, row-major
+   RealArray phi;         // State transition matrix, row-major
+   RealArray q;           // Process noise, row-major
+   RealArray h;           // Partials, steps * measPerStep rows of n
+   Real      r;           // Measurement variance
+};
+
+
+/// One scalar measurement of a least squares problem
+struct LeastSquaresMeasurement
+{
+   RealArray h;           // Partials with respect to every parameter
+   Real      weight;
+   Real      residual;
+};
+
+
+/// Least squares problem with global parameters and a few bias parameters
+/// per tracking pass
+struct NormalEquationsProblem
+{
+   IntegerArray                         blocks;  // Pass of each parameter,
+                                                 // -1 for global ones
+   std::vector<LeastSquaresMeasurement> meas;
+};
+
+
+class LinearAlgebraFixture
+{
+public:
+   LinearAlgebraFixture(UnsignedInt seed = 20261017);
+
+   Real           Uniform();
+   Rmatrix        RandomMatrix(Integer rows, Integer cols);
+   Rmatrix        SpdMatrix(Integer n);
+   RealArray      Covariance(Integer n, Real decades);
+
+   FilterProblem  MakeFilterProblem(Integer n, Integer steps, Real priorScale,
+                                    Real r);
+   NormalEquationsProblem
+                  MakeNormalEquationsProblem(Integer passes, Integer perPass,
+                                             Integer emptyPass,
+                                             Integer globalCount = 7,
+                                             Integer biasesPerPass = 2);
+
+   static Real    MaxDifference(const Rmatrix &a, const Rmatrix &b);
+   static Real    MaxRelativeDifference(const Rmatrix &a, const Rmatrix &b);
+   static Real    MaxRelativeDifference(const RealArray &a,
+                                        const RealArray &b);
+   static Rmatrix ToMatrix(const RealArray &a, Integer n);
+   static RealArray ToArray(const Rmatrix &m);
+
+private:
+   /// Generator of the test data; each fixture starts from its seed
+   std::mt19937                         generator;
+   /// Uniform values in [-1, 1)
+   std::uniform_real_distribution<Real> uniform;
+};
+
+#endif // LinearAlgebraFixture_hpp
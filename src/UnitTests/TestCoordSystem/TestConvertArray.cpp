@@ -0,0 +1,214 @@
+//$Id$
+//------------------------------------------------------------------------------
+//                              TestConvertArray
+//------------------------------------------------------------------------------
+// GMAT: General Mission Analysis Tool
+//
+// Copyright (c) 2002 - 2020 United States Government as represented by the
+// Administrator of the National Aeronautics and Space Administration.
+// All Other Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// You may not use this file except in compliance with the License.
+// You may obtain a copy of the License at:
+// http://www.apache.org/licenses/LICENSE-2.0.
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied.   See the License for the specific language
+// governing permissions and limitations under the License.
+//
+// Author: GMAT Development Team
+// Created: 2026/10/17
+//
+/**
+ * Unit test program for the array form of CoordinateConverter::Convert().
+ *
+ * A set of states, several of them sharing an epoch and one epoch repeated
+ * out of order, is converted with one array call and with one single state
+ * call per state.  The results must agree for a rotating body-fixed system, a
+ * translated system centered on Luna, and the ICRF to FK5 base system change
+ * in both directions.  The array form is also run in place, with the output
+ * written over the input.
+ *
+ * Run it from the GMAT bin directory so the startup file is found.
+ */
+//------------------------------------------------------------------------------
+
+#include "Moderator.hpp"
+#include "CoordinateConverter.hpp"
+#include "CoordinateSystem.hpp"
+#include "BaseException.hpp"
+#include "GmatBaseException.hpp"
+#include "TestOutput.hpp"
+
+#include <cmath>
+#include <iostream>
+#include <sstream>
+
+/// Number of states converted
+const Integer STATES = 40;
+/// A1 epoch of the first state
+const Real START_EPOCH = 28855.0;
+/// Position agreement, km
+const Real POS_TOL = 1.0e-6;
+/// Velocity agreement, km/s
+const Real VEL_TOL = 1.0e-9;
+
+const std::string SCRIPT =
+   "Create Spacecraft Sat;\n"
+   "Create CoordinateSystem EarthICRF;\n"
+   "EarthICRF.Origin = Earth;\n"
+   "EarthICRF.Axes = ICRF;\n"
+   "Create CoordinateSystem LunaMJ2000Ec;\n"
+   "LunaMJ2000Ec.Origin = Luna;\n"
+   "LunaMJ2000Ec.Axes = MJ2000Ec;\n"
+   "Create Propagator Prop;\n"
+   "BeginMissionSequence;\n"
+   "Propagate Prop(Sat) {Sat.ElapsedSecs = 60};\n";
+
+
+//------------------------------------------------------------------------------
+// void MakeStates(RealArray &epochs, RealArray &states)
+//------------------------------------------------------------------------------
+/**
+ * Builds low Earth orbit states, two per epoch one minute apart; the last
+ * four states go back to the first epoch.
+ */
+//------------------------------------------------------------------------------
+void MakeStates(RealArray &epochs, RealArray &states)
+{
+   const Real radius = 6878.0, rate = 0.0011;
+
+   epochs.resize(STATES);
+   states.resize(6 * STATES);
+   for (Integer i = 0; i < STATES; ++i)
+   {
+      epochs[i] = START_EPOCH +
+            (i < STATES - 4 ? (i / 2) / 1440.0 : 0.0);
+      Real angle = rate * 60.0 * i;
+      Real *s = &states[6 * i];
+      s[0] = radius * std::cos(angle);
+      s[1] = radius * std::sin(angle) * 0.8;
+      s[2] = radius * std::sin(angle) * 0.6;
+      s[3] = -radius * rate * std::sin(angle);
+      s[4] = radius * rate * std::cos(angle) * 0.8;
+      s[5] = radius * rate * std::cos(angle) * 0.6;
+   }
+}
+
+
+//------------------------------------------------------------------------------
+// CoordinateSystem* GetCoordinateSystem(Moderator *mod,
+//       const std::string &name)
+//------------------------------------------------------------------------------
+CoordinateSystem* GetCoordinateSystem(Moderator *mod, const std::string &name)
+{
+   CoordinateSystem *cs = (CoordinateSystem*)mod->GetInternalObject(name);
+   if (cs == NULL)
+      throw GmatBaseException("The coordinate system " + name +
+            " is not in the sandbox");
+   return cs;
+}
+
+
+//------------------------------------------------------------------------------
+// void RunCase(TestOutput &out, Moderator *mod, const std::string &from,
+//       const std::string &to)
+//------------------------------------------------------------------------------
+void RunCase(TestOutput &out, Moderator *mod, const std::string &from,
+             const std::string &to)
+{
+   CoordinateSystem *inCS  = GetCoordinateSystem(mod, from);
+   CoordinateSystem *outCS = GetCoordinateSystem(mod, to);
+   CoordinateConverter converter;
+   converter.Initialize();
+
+   RealArray epochs, inStates;
+   MakeStates(epochs, inStates);
+   RealArray single(inStates.size()), array(inStates.size());
+
+   for (Integer i = 0; i < STATES; ++i)
+      if (!converter.Convert(A1Mjd(epochs[i]), &inStates[6 * i], inCS,
+                             &single[6 * i], outCS))
+         throw GmatBaseException("The single state conversion failed");
+   if (!converter.Convert(STATES, &epochs[0], &inStates[0], inCS, &array[0],
+                          outCS))
+      throw GmatBaseException("The array conversion failed");
+
+   RealArray inPlace(inStates);
+   if (!converter.Convert(STATES, &epochs[0], &inPlace[0], inCS, &inPlace[0],
+                          outCS))
+      throw GmatBaseException("The in place array conversion failed");
+
+   Real posError = 0.0, velError = 0.0, inPlaceError = 0.0;
+   for (Integer i = 0; i < 6 * STATES; ++i)
+   {
+      Real diff = std::fabs(array[i] - single[i]);
+      if ((i % 6) < 3)
+         posError = (diff > posError ? diff : posError);
+      else
+         velError = (diff > velError ? diff : velError);
+      diff = std::fabs(inPlace[i] - array[i]);
+      inPlaceError = (diff > inPlaceError ? diff : inPlaceError);
+   }
+
+   out.Put("============================== test " + from + " to " + to);
+   out.Put("Largest position difference (km) = ", posError);
+   out.Put("Largest velocity difference (km/s) = ", velError);
+   out.Put("---------- the array form should match the single state calls");
+   out.Validate(posError, 0.0, POS_TOL);
+   out.Validate(velError, 0.0, VEL_TOL);
+   out.Put("---------- the array form should work in place");
+   out.Validate(inPlaceError, 0.0, POS_TOL);
+}
+
+
+//------------------------------------------------------------------------------
+// int RunTest(TestOutput &out)
+//------------------------------------------------------------------------------
+int RunTest(TestOutput &out)
+{
+   Moderator *mod = Moderator::Instance();
+   if (!mod->Initialize("gmat_startup_file.txt"))
+      throw GmatBaseException("Moderator initialization failed");
+
+   std::istringstream script(SCRIPT);
+   if (!mod->InterpretScript(&script, true))
+      throw GmatBaseException("The test script did not interpret");
+   if (mod->RunMission() < 0)
+      throw GmatBaseException("The test mission failed");
+
+   RunCase(out, mod, "EarthMJ2000Eq", "EarthFixed");
+   RunCase(out, mod, "EarthFixed", "EarthMJ2000Eq");
+   RunCase(out, mod, "EarthMJ2000Eq", "LunaMJ2000Ec");
+   RunCase(out, mod, "EarthICRF", "EarthMJ2000Eq");
+   RunCase(out, mod, "EarthMJ2000Eq", "EarthICRF");
+   RunCase(out, mod, "EarthICRF", "EarthFixed");
+
+   return 1;
+}
+
+
+//------------------------------------------------------------------------------
+// int main()
+//------------------------------------------------------------------------------
+int main()
+{
+   TestOutput out("TestConvertArrayOut.txt");
+
+   try
+   {
+      RunTest(out);
+      out.Put("\nSuccessfully ran unit testing of the array Convert()!!");
+   }
+   catch (BaseException &e)
+   {
+      out.Put(e.GetFullMessage());
+      out.Close();
+      return 1;
+   }
+
+   out.Close();
+   return 0;
+}
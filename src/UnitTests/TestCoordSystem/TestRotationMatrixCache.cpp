@@ -0,0 +1,197 @@
+//$Id$
+//------------------------------------------------------------------------------
+//                              TestRotationMatrixCache
+//------------------------------------------------------------------------------
+// GMAT: General Mission Analysis Tool
+//
+// Copyright (c) 2002 - 2020 United States Government as represented by the
+// Administrator of the National Aeronautics and Space Administration.
+// All Other Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// You may not use this file except in compliance with the License.
+// You may obtain a copy of the License at:
+// http://www.apache.org/licenses/LICENSE-2.0.
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied.   See the License for the specific language
+// governing permissions and limitations under the License.
+//
+// Author: GMAT Development Team
+// Created: 2026/10/17
+//
+/**
+ * Unit test program for the RotationMatrixCache.
+ *
+ * Checks the hit, miss and eviction counters, that equal signatures share an
+ * id, and that Clear() and a change of EOP file drop the entries and the
+ * signatures and start a new generation, so that ids registered before no
+ * longer find anything.
+ */
+//------------------------------------------------------------------------------
+
+#include "RotationMatrixCache.hpp"
+#include "EopFile.hpp"
+#include "BaseException.hpp"
+#include "TestOutput.hpp"
+
+#include <iostream>
+
+/// A1 epoch of the first entry
+const Real EPOCH = 28855.0;
+
+
+//------------------------------------------------------------------------------
+// void MakeMatrices(Real seed, Real *rot, Real *rotDot)
+//------------------------------------------------------------------------------
+/**
+ * Fills the two matrices with values that identify the seed
+ */
+//------------------------------------------------------------------------------
+void MakeMatrices(Real seed, Real *rot, Real *rotDot)
+{
+   for (Integer i = 0; i < 9; ++i)
+   {
+      rot[i]    = seed + i;
+      rotDot[i] = -seed - i;
+   }
+}
+
+
+//------------------------------------------------------------------------------
+// bool Matches(Real seed, const Real *rot, const Real *rotDot)
+//------------------------------------------------------------------------------
+bool Matches(Real seed, const Real *rot, const Real *rotDot)
+{
+   Real expRot[9], expRotDot[9];
+   MakeMatrices(seed, expRot, expRotDot);
+   for (Integer i = 0; i < 9; ++i)
+      if ((rot[i] != expRot[i]) || (rotDot[i] != expRotDot[i]))
+         return false;
+   return true;
+}
+
+
+//------------------------------------------------------------------------------
+// int RunTest(TestOutput &out)
+//------------------------------------------------------------------------------
+int RunTest(TestOutput &out)
+{
+   RotationMatrixCache *cache = RotationMatrixCache::Instance();
+   cache->Clear();
+   cache->ResetStatistics();
+
+   Real rot[9], rotDot[9];
+   Integer generation, sameGeneration, otherGeneration;
+
+   out.Put("============================== test registration");
+   Integer earthFixed = cache->RegisterAxes("BodyFixed|Earth|FK5", generation);
+   Integer again = cache->RegisterAxes("BodyFixed|Earth|FK5", sameGeneration);
+   Integer mod = cache->RegisterAxes("MOD|Earth|FK5", otherGeneration);
+   out.Put("---------- equal signatures should share an id");
+   out.Validate(again, earthFixed);
+   out.Validate(mod != earthFixed, true);
+   out.Validate(sameGeneration, generation);
+   out.Validate(otherGeneration, generation);
+   out.Validate(cache->GetGeneration(), generation);
+   out.Validate(cache->GetSignatureCount(), 2);
+
+   out.Put("============================== test the counters");
+   A1Mjd epoch(EPOCH);
+   out.Put("---------- an empty cache should miss");
+   out.Validate(cache->Find(earthFixed, epoch, rot, rotDot), false);
+   MakeMatrices(1.0, rot, rotDot);
+   cache->Add(earthFixed, epoch, rot, rotDot);
+   MakeMatrices(2.0, rot, rotDot);
+   cache->Add(mod, epoch, rot, rotDot);
+   out.Put("---------- the added matrices should be found by id and epoch");
+   out.Validate(cache->Find(earthFixed, epoch, rot, rotDot), true);
+   out.Validate(Matches(1.0, rot, rotDot), true);
+   out.Validate(cache->Find(mod, epoch, rot, rotDot), true);
+   out.Validate(Matches(2.0, rot, rotDot), true);
+   out.Put("---------- another epoch, or the same one as a GmatTime, should "
+           "miss");
+   out.Validate(cache->Find(earthFixed, A1Mjd(EPOCH + 1.0), rot, rotDot),
+                false);
+   out.Validate(cache->Find(earthFixed, GmatTime(EPOCH), rot, rotDot), false);
+   out.Validate(cache->GetHitCount(), 2);
+   out.Validate(cache->GetMissCount(), 3);
+   out.Validate(cache->GetSize(), 2);
+
+   out.Put("============================== test eviction");
+   Integer capacity = cache->GetCapacity();
+   cache->SetCapacity(2);
+   // Touch the Earth fixed entry so the MOD entry is the oldest
+   cache->Find(earthFixed, epoch, rot, rotDot);
+   MakeMatrices(3.0, rot, rotDot);
+   cache->Add(earthFixed, A1Mjd(EPOCH + 1.0), rot, rotDot);
+   out.Put("---------- the least recently used entry should be evicted");
+   out.Validate(cache->GetEvictionCount(), 1);
+   out.Validate(cache->GetSize(), 2);
+   out.Validate(cache->Find(mod, epoch, rot, rotDot), false);
+   out.Validate(cache->Find(earthFixed, epoch, rot, rotDot), true);
+   cache->SetCapacity(capacity);
+
+   out.Put("============================== test Clear()");
+   cache->Clear();
+   out.Put("---------- the entries and signatures should be dropped");
+   out.Validate(cache->GetSize(), 0);
+   out.Validate(cache->GetSignatureCount(), 0);
+   out.Validate(cache->GetGeneration() != generation, true);
+   out.Validate(cache->Find(earthFixed, epoch, rot, rotDot), false);
+   Integer reregistered = cache->RegisterAxes("BodyFixed|Earth|FK5",
+         generation);
+   out.Put("---------- ids should not be reused after a Clear()");
+   out.Validate(reregistered != earthFixed, true);
+   out.Validate(reregistered != mod, true);
+   out.Validate(generation, cache->GetGeneration());
+
+   out.Put("============================== test an EOP file change");
+   MakeMatrices(4.0, rot, rotDot);
+   cache->Add(reregistered, epoch, rot, rotDot);
+   out.Validate(cache->Find(reregistered, epoch, rot, rotDot), true);
+   Integer hits = cache->GetHitCount(), misses = cache->GetMissCount();
+
+   EopFile eop("eop_before.txt");
+   eop.ResetEopFile("eop_after.txt");
+   out.Put("---------- the change should start a new generation");
+   out.Validate(cache->GetGeneration() != generation, true);
+   out.Validate(cache->GetSize(), 0);
+   out.Validate(cache->GetSignatureCount(), 0);
+   out.Put("---------- matrices made with the old data should not be found");
+   out.Validate(cache->Find(reregistered, epoch, rot, rotDot), false);
+   out.Validate(cache->GetHitCount(), hits);
+   out.Validate(cache->GetMissCount(), misses + 1);
+
+   out.Put("---------- resetting to the same file should change nothing");
+   generation = cache->GetGeneration();
+   eop.ResetEopFile("eop_after.txt");
+   out.Validate(cache->GetGeneration(), generation);
+
+   return 1;
+}
+
+
+//------------------------------------------------------------------------------
+// int main()
+//------------------------------------------------------------------------------
+int main()
+{
+   TestOutput out("TestRotationMatrixCacheOut.txt");
+
+   try
+   {
+      RunTest(out);
+      out.Put("\nSuccessfully ran unit testing of RotationMatrixCache!!");
+   }
+   catch (BaseException &e)
+   {
+      out.Put(e.GetFullMessage());
+      out.Close();
+      return 1;
+   }
+
+   out.Close();
+   return 0;
+}
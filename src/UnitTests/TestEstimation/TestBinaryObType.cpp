@@ -0,0 +1,244 @@
+//$Id$
+//------------------------------------------------------------------------------
+//                              TestBinaryObType
+//------------------------------------------------------------------------------
+// GMAT: General Mission Analysis Tool
+//
+// Copyright (c) 2002 - 2020 United States Government as represented by the
+// Administrator of the National Aeronautics and Space Administration.
+// All Other Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// You may not use this file except in compliance with the License.
+// You may obtain a copy of the License at:
+// http://www.apache.org/licenses/LICENSE-2.0.
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied.   See the License for the specific language
+// governing permissions and limitations under the License.
+//
+// Author: GMAT Development Team
+// Created: 2026/10/17
+//
+/**
+ * Unit test program for the GMATBinary observation file.
+ *
+ * A GMATInternal text file with range, Doppler and sequential range records
+ * is converted to a binary file with BinaryObType::Convert().  Every record
+ * read back from the binary file must equal the record read from the text
+ * file, field by field and bit for bit.  The program then checks that a time
+ * window returns the same records as filtering the text file, and that the
+ * records passed over are counted.
+ */
+//------------------------------------------------------------------------------
+
+#include "gmatdefs.hpp"
+#include "GmatObType.hpp"
+#include "BinaryObType.hpp"
+#include "ObservationData.hpp"
+#include "MeasurementException.hpp"
+#include "TestOutput.hpp"
+
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+
+/// Records in the text file; more than two blocks of the epoch index
+const Integer RECORD_COUNT = 2500;
+/// Record spacing, days
+const Real SPACING = 10.0 / 86400.0;
+/// TAI epoch of the first record
+const Real FIRST_EPOCH = 21545.0;
+
+const std::string TEXT_FILE = "./TestBinaryObType.gmd";
+const std::string BINARY_FILE = "./TestBinaryObType.gmb";
+
+
+//------------------------------------------------------------------------------
+// void WriteTextFile()
+//------------------------------------------------------------------------------
+/**
+ * Writes the GMATInternal file, cycling through four measurement types
+ */
+//------------------------------------------------------------------------------
+void WriteTextFile()
+{
+   std::ofstream gmd(TEXT_FILE.c_str());
+   gmd << "% GMAT Internal Measurement Data File\n\n";
+   gmd << std::setprecision(16);
+   for (Integer i = 0; i < RECORD_COUNT; ++i)
+   {
+      Real epoch = FIRST_EPOCH + i * SPACING;
+      std::string station = ((i / 7) % 2 == 0 ? "GDS" : "CAN");
+      gmd << std::fixed << std::setprecision(15) << epoch
+          << std::setprecision(12);
+      switch (i % 4)
+      {
+         case 0:
+            gmd << "    Range    9004    " << station << "    EstSat    "
+                << 7000.0 + 0.123456789 * i << "\n";
+            break;
+         case 1:
+            gmd << "    DSN_TCP    9006    " << station << "    EstSat    1"
+                   "    10    " << -2.5 + 1.0e-4 * i << "\n";
+            break;
+         case 2:
+            gmd << "    RangeRate    9012    " << station << "    EstSat    1"
+                   "    10    " << 3.25 - 1.0e-5 * i << "\n";
+            break;
+         default:
+            gmd << "    DSN_SeqRange    9005    " << station << "    EstSat"
+                   "    " << 123456.0 + i << "    1    7186541250.0"
+                   "    1048576.0\n";
+            break;
+      }
+   }
+}
+
+
+//------------------------------------------------------------------------------
+// Comparison helpers; reals are compared bit for bit
+//------------------------------------------------------------------------------
+bool Same(Real a, Real b)
+{
+   return memcmp(&a, &b, sizeof(Real)) == 0;
+}
+
+bool Same(const RealArray &a, const RealArray &b)
+{
+   if (a.size() != b.size())
+      return false;
+   for (UnsignedInt i = 0; i < a.size(); ++i)
+      if (!Same(a[i], b[i]))
+         return false;
+   return true;
+}
+
+bool Same(const ObservationData &a, const ObservationData &b)
+{
+   return Same(a.epoch, b.epoch) && (a.epochGT == b.epochGT) &&
+          (a.epochSystem == b.epochSystem) && (a.typeName == b.typeName) &&
+          (a.type == b.type) && (a.unit == b.unit) &&
+          (a.dataFormat == b.dataFormat) &&
+          (a.participantIDs == b.participantIDs) &&
+          (a.sensorIDs == b.sensorIDs) && (a.strands == b.strands) &&
+          (a.dataMap == b.dataMap) && Same(a.value, b.value) &&
+          Same(a.value_orig, b.value_orig) &&
+          (a.uplinkBand == b.uplinkBand) &&
+          Same(a.uplinkFreqAtRecei, b.uplinkFreqAtRecei) &&
+          Same(a.rangeModulo, b.rangeModulo) &&
+          Same(a.dopplerCountInterval, b.dopplerCountInterval) &&
+          (a.tdrsServiceID == b.tdrsServiceID) &&
+          Same(a.tdrsNode4Freq, b.tdrsNode4Freq) &&
+          (a.tdrsNode4Band == b.tdrsNode4Band) &&
+          (a.tdrsSMARID == b.tdrsSMARID) &&
+          (a.tdrsDataFlag == b.tdrsDataFlag) &&
+          (a.epochAtEnd == b.epochAtEnd) &&
+          (a.epochAtIntegrationEnd == b.epochAtIntegrationEnd);
+}
+
+
+//------------------------------------------------------------------------------
+// int RunTest(TestOutput &out)
+//------------------------------------------------------------------------------
+int RunTest(TestOutput &out)
+{
+   WriteTextFile();
+
+   out.Put("============================== test GMATInternal to GMATBinary "
+           "conversion");
+   GmatObType source;
+   source.SetStreamName(TEXT_FILE);
+   Integer written = BinaryObType::Convert(&source, BINARY_FILE);
+   source.Close();
+   out.Put("---------- every text record should be written");
+   out.Validate(written, RECORD_COUNT);
+
+   GmatObType text;
+   text.SetStreamName(TEXT_FILE);
+   text.Open(true, false);
+   BinaryObType binary;
+   binary.SetStreamName(BINARY_FILE);
+   binary.Open(true, false);
+   out.Validate(binary.GetRecordCount(), RECORD_COUNT);
+
+   Integer read = 0, matched = 0;
+   ObservationData *fromText, *fromBinary;
+   while ((fromText = text.ReadObservation()) != NULL)
+   {
+      fromBinary = binary.ReadObservation();
+      if (fromBinary == NULL)
+         break;
+      ++read;
+      if (Same(*fromText, *fromBinary))
+         ++matched;
+   }
+   out.Put("---------- the records read back should match the text records");
+   out.Validate(read, RECORD_COUNT);
+   out.Validate(matched, RECORD_COUNT);
+   out.Validate(binary.ReadObservation() == NULL, true);
+   text.Close();
+   binary.Close();
+
+   out.Put("============================== test the time window");
+   // Observations are in A1; the window covers records 1100 to 1199 and
+   // falls inside the second block of the epoch index
+   text.Open(true, false);
+   binary.Open(true, false);
+   const Real taiToA1 = 0.0343817 / 86400.0;
+   Real start = FIRST_EPOCH + 1099.5 * SPACING + taiToA1;
+   Real end = FIRST_EPOCH + 1199.5 * SPACING + taiToA1;
+   binary.SetTimeWindow(start, end);
+
+   Integer inWindow = 0;
+   matched = 0;
+   while ((fromText = text.ReadObservation()) != NULL)
+   {
+      if ((fromText->epoch < start) || (fromText->epoch > end))
+         continue;
+      ++inWindow;
+      fromBinary = binary.ReadObservation();
+      if ((fromBinary != NULL) && Same(*fromText, *fromBinary))
+         ++matched;
+   }
+   out.Put("---------- the window should return the text records inside it");
+   out.Validate(inWindow, 100);
+   out.Validate(matched, inWindow);
+   out.Validate(binary.ReadObservation() == NULL, true);
+   out.Put("---------- the records outside should be counted as skipped");
+   out.Validate(binary.GetSkippedCount(), RECORD_COUNT - inWindow);
+   text.Close();
+   binary.Close();
+
+   remove(TEXT_FILE.c_str());
+   remove(BINARY_FILE.c_str());
+
+   return 1;
+}
+
+
+//------------------------------------------------------------------------------
+// int main()
+//------------------------------------------------------------------------------
+int main()
+{
+   TestOutput out("TestBinaryObTypeOut.txt");
+
+   try
+   {
+      RunTest(out);
+      out.Put("\nSuccessfully ran unit testing of BinaryObType!!");
+   }
+   catch (BaseException &e)
+   {
+      out.Put(e.GetFullMessage());
+      out.Close();
+      return 1;
+   }
+
+   out.Close();
+   return 0;
+}
@@ -0,0 +1,290 @@
+//$Id$
+//------------------------------------------------------------------------------
+//                              TestFilterHistory
+//------------------------------------------------------------------------------
+// GMAT: General Mission Analysis Tool
+//
+// Copyright (c) 2002 - 2020 United States Government as represented by the
+// Administrator of the National Aeronautics and Space Administration.
+// All Other Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// You may not use this file except in compliance with the License.
+// You may obtain a copy of the License at:
+// http://www.apache.org/licenses/LICENSE-2.0.
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied.   See the License for the specific language
+// governing permissions and limitations under the License.
+//
+// Author: GMAT Development Team
+// Created: 2026/10/17
+//
+/**
+ * Unit test program for the FilterHistory store of the sequential estimators.
+ *
+ * Checks that records read back from memory and from the scratch file are
+ * bitwise equal to the records added, that records spill to disk only once the
+ * encoded size exceeds the memory limit, and that a reference returned by
+ * operator[] stays valid across the following reads.
+ */
+//------------------------------------------------------------------------------
+
+#include "gmatdefs.hpp"
+#include "FilterHistory.hpp"
+#include "BaseException.hpp"
+#include "TestOutput.hpp"
+
+#include <cstring>
+#include <iostream>
+
+typedef SeqEstimator::UpdateInfoType Record;
+
+
+//------------------------------------------------------------------------------
+// void FillMatrix(Rmatrix &m, Integer rows, Integer cols, Real seed,
+//       bool symmetric)
+//------------------------------------------------------------------------------
+/**
+ * Sizes and fills a matrix; the records hold 0 x 0 matrices until sized.
+ */
+//------------------------------------------------------------------------------
+void FillMatrix(Rmatrix &m, Integer rows, Integer cols, Real seed,
+                bool symmetric)
+{
+   m.SetSize(rows, cols);
+   for (Integer i = 0; i < rows; ++i)
+      for (Integer j = 0; j < cols; ++j)
+         m(i, j) = seed / (1.0 + i + j) + (symmetric ? 0.0 : 0.1 * i);
+}
+
+
+//------------------------------------------------------------------------------
+// Record MakeRecord(Integer index)
+//------------------------------------------------------------------------------
+/**
+ * Builds a record with values that differ between records.  Every third
+ * record is a time update; the others are observations.
+ */
+//------------------------------------------------------------------------------
+Record MakeRecord(Integer index)
+{
+   Record rec;
+   Real seed = 1.0 + index / 7.0;
+
+   rec.epoch = GmatTime(21545.0 + index / 1440.0);
+   rec.isObs = ((index % 3) != 0);
+   for (Integer i = 0; i < 6; ++i)
+      rec.state.push_back(7000.0 * seed + i / 3.0);
+   FillMatrix(rec.cov, 6, 6, seed, true);
+   rec.sigmaVNB = Rmatrix33(seed, 0.0, 0.0, 0.0, 2.0 * seed, 0.0,
+                            0.0, 0.0, -0.0);
+   FillMatrix(rec.processNoise, 6, 6, 1.0e-9 * seed, true);
+   FillMatrix(rec.stm, 6, 6, seed, false);
+
+   if (rec.isObs)
+   {
+      SeqEstimator::FilterMeasurementInfoType &meas = rec.measStat;
+      meas.epoch = rec.epoch;
+      meas.recNum = 100 + index;
+      meas.modelSize = 1;
+      meas.editFlag = index % 2;
+      meas.isCalculated = true;
+      meas.removedReason = (meas.editFlag ? "OLSE" : "N");
+      meas.station = "GDS";
+      meas.type = "Range";
+      meas.uniqueID = 3000 + index;
+      meas.frequency = 2.2e9;
+      meas.feasibilityValue = 0.5 * seed;
+      meas.measValue.push_back(12345.678 * seed);
+      meas.residual.push_back(1.0e-3 / seed);
+      meas.weight.push_back(1.0e4);
+      meas.hAccum.push_back(RealArray(6, seed));
+      meas.tropoCorrectValue = 0.002;
+      meas.ionoCorrectValue = 0.001;
+      meas.state = rec.state;
+      FillMatrix(meas.cov, 6, 6, seed, true);
+      meas.sigmaVNB = rec.sigmaVNB;
+      meas.scaledResid.push_back(0.25 * seed);
+      FillMatrix(meas.kalmanGain, 6, 1, seed, false);
+   }
+   return rec;
+}
+
+
+//------------------------------------------------------------------------------
+// Comparison helpers; reals are compared bit for bit
+//------------------------------------------------------------------------------
+bool Same(Real a, Real b)
+{
+   return memcmp(&a, &b, sizeof(Real)) == 0;
+}
+
+bool Same(const RealArray &a, const RealArray &b)
+{
+   if (a.size() != b.size())
+      return false;
+   for (UnsignedInt i = 0; i < a.size(); ++i)
+      if (!Same(a[i], b[i]))
+         return false;
+   return true;
+}
+
+bool Same(const Rmatrix &a, const Rmatrix &b)
+{
+   if ((a.GetNumRows() != b.GetNumRows()) ||
+       (a.GetNumColumns() != b.GetNumColumns()))
+      return false;
+   for (Integer i = 0; i < a.GetNumRows(); ++i)
+      for (Integer j = 0; j < a.GetNumColumns(); ++j)
+         if (!Same(a(i, j), b(i, j)))
+            return false;
+   return true;
+}
+
+bool Same(const GmatTime &a, const GmatTime &b)
+{
+   return (a.GetDays() == b.GetDays()) && (a.GetSec() == b.GetSec()) &&
+          Same(a.GetFracSec(), b.GetFracSec());
+}
+
+bool Same(const Record &a, const Record &b)
+{
+   if (!Same(a.epoch, b.epoch) || (a.isObs != b.isObs) ||
+       !Same(a.state, b.state) || !Same(a.cov, b.cov) ||
+       !Same(a.sigmaVNB, b.sigmaVNB) ||
+       !Same(a.processNoise, b.processNoise) || !Same(a.stm, b.stm))
+      return false;
+   if (!a.isObs)
+      return true;
+
+   const SeqEstimator::FilterMeasurementInfoType &ma = a.measStat;
+   const SeqEstimator::FilterMeasurementInfoType &mb = b.measStat;
+   if (!Same(ma.epoch, mb.epoch) || (ma.recNum != mb.recNum) ||
+       (ma.modelSize != mb.modelSize) || (ma.editFlag != mb.editFlag) ||
+       (ma.isCalculated != mb.isCalculated) ||
+       (ma.removedReason != mb.removedReason) ||
+       (ma.station != mb.station) || (ma.type != mb.type) ||
+       (ma.uniqueID != mb.uniqueID) || !Same(ma.frequency, mb.frequency) ||
+       !Same(ma.feasibilityValue, mb.feasibilityValue) ||
+       !Same(ma.measValue, mb.measValue) ||
+       !Same(ma.residual, mb.residual) || !Same(ma.weight, mb.weight) ||
+       (ma.hAccum.size() != mb.hAccum.size()) ||
+       !Same(ma.tropoCorrectValue, mb.tropoCorrectValue) ||
+       !Same(ma.ionoCorrectValue, mb.ionoCorrectValue) ||
+       !Same(ma.state, mb.state) || !Same(ma.cov, mb.cov) ||
+       !Same(ma.sigmaVNB, mb.sigmaVNB) ||
+       !Same(ma.scaledResid, mb.scaledResid) ||
+       !Same(ma.kalmanGain, mb.kalmanGain))
+      return false;
+   for (UnsignedInt i = 0; i < ma.hAccum.size(); ++i)
+      if (!Same(ma.hAccum[i], mb.hAccum[i]))
+         return false;
+   return true;
+}
+
+
+//------------------------------------------------------------------------------
+// int RunTest(TestOutput &out)
+//------------------------------------------------------------------------------
+int RunTest(TestOutput &out)
+{
+   const Integer count = 20;
+
+   out.Put("============================== test round trip through the "
+           "scratch file");
+   FilterHistory spilled;
+   spilled.SetMemoryLimit(0.0);
+   for (Integer i = 0; i < count; ++i)
+      spilled.Add(MakeRecord(i));
+   out.Put("---------- every record should be in the scratch file");
+   out.Validate(spilled.GetSpilledBytes() > 0, true);
+   out.Validate((Integer)spilled.GetSize(), count);
+
+   bool allSame = true, keysSame = true;
+   for (Integer i = count - 1; i >= 0; --i)
+   {
+      Record expected = MakeRecord(i);
+      allSame = allSame && Same(spilled[i], expected);
+      keysSame = keysSame && Same(spilled.GetEpoch(i), expected.epoch) &&
+            (spilled.IsObs(i) == expected.isObs) &&
+            (spilled.GetRecordNumber(i) ==
+             (expected.isObs ? expected.measStat.recNum : 0));
+   }
+   out.Put("---------- records read back should match the records added");
+   out.Validate(allSame, true);
+   out.Put("---------- epochs, flags and record numbers should match");
+   out.Validate(keysSame, true);
+
+   out.Put("---------- a copy should read the shared records");
+   FilterHistory copy(spilled);
+   copy.Add(MakeRecord(count));
+   out.Validate(Same(copy[3], MakeRecord(3)) &&
+                Same(copy.Back(), MakeRecord(count)), true);
+   out.Validate((Integer)spilled.GetSize(), count);
+
+   out.Put("============================== test HistoryMemoryLimit boundary");
+   // Time update records all have the same encoded size
+   FilterHistory sizer;
+   sizer.SetMemoryLimit(0.0);
+   sizer.Add(MakeRecord(0));
+   size_t recordBytes = sizer.GetSpilledBytes();
+
+   FilterHistory limited;
+   limited.SetMemoryLimit(3.0 * recordBytes / 1048576.0);
+   for (Integer i = 0; i < 3; ++i)
+      limited.Add(MakeRecord(3 * i));
+   out.Put("---------- records up to the limit should stay in memory");
+   out.Validate((Integer)limited.GetSpilledBytes(), 0);
+   limited.Add(MakeRecord(9));
+   out.Put("---------- the record past the limit should spill the buffer");
+   out.Validate((Integer)limited.GetSpilledBytes(), (Integer)(4 * recordBytes));
+   limited.Add(MakeRecord(12));
+   out.Validate(Same(limited[0], MakeRecord(0)) &&
+                Same(limited[4], MakeRecord(12)), true);
+
+   out.Put("============================== test references across reads");
+   const Record &first = spilled[0];
+   const Record &second = spilled[1];
+   const Record *firstAddress = &first;
+   spilled[2];
+   spilled[3];
+   out.Put("---------- the first reference should survive three more reads");
+   out.Validate(Same(first, MakeRecord(0)), true);
+   out.Validate(Same(second, MakeRecord(1)), true);
+   out.Put("---------- a repeated read should return the cached record");
+   out.Validate(&spilled[0] == firstAddress, true);
+   // Record 1 is now the least recently used; four new reads replace it
+   for (Integer i = 4; i < 8; ++i)
+      spilled[i];
+   out.Put("---------- the most recent reads should still be valid");
+   out.Validate(Same(spilled[7], MakeRecord(7)) &&
+                Same(spilled[4], MakeRecord(4)), true);
+
+   return 1;
+}
+
+
+//------------------------------------------------------------------------------
+// int main()
+//------------------------------------------------------------------------------
+int main()
+{
+   TestOutput out("TestFilterHistoryOut.txt");
+
+   try
+   {
+      RunTest(out);
+      out.Put("\nSuccessfully ran unit testing of FilterHistory!!");
+   }
+   catch (BaseException &e)
+   {
+      out.Put(e.GetFullMessage());
+      out.Close();
+      return 1;
+   }
+
+   out.Close();
+   return 0;
+}
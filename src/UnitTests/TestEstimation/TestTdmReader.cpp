@@ -0,0 +1,369 @@
+//$Id$
+//------------------------------------------------------------------------------
+//                              TestTdmReader
+//------------------------------------------------------------------------------
+// GMAT: General Mission Analysis Tool
+//
+// Copyright (c) 2002 - 2020 United States Government as represented by the
+// Administrator of the National Aeronautics and Space Administration.
+// All Other Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// You may not use this file except in compliance with the License.
+// You may obtain a copy of the License at:
+// http://www.apache.org/licenses/LICENSE-2.0.
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied.   See the License for the specific language
+// governing permissions and limitations under the License.
+//
+// Author: GMAT Development Team
+// Created: 2026/10/17
+//
+/**
+ * Unit test program for the streaming (SAX) TDM reader.
+ *
+ * A two segment TDM file is written and read twice: by TdmReadWriter, which
+ * parses it progressively with SAX2, and by a Xerces DOM walk of the whole
+ * document that follows the DOM reader TdmReadWriter used before.  The DOM
+ * walk includes the two corrections made with the SAX reader: the last record
+ * of the file is kept, and TRANSMIT and START clear the epoch flags.  Every
+ * record must match field by field.
+ */
+//------------------------------------------------------------------------------
+
+#include "gmatdefs.hpp"
+#include "TdmReadWriter.hpp"
+#include "ObservationData.hpp"
+#include "MeasurementException.hpp"
+#include "DateUtil.hpp"
+#include "TestOutput.hpp"
+
+#include "xercesc/parsers/XercesDOMParser.hpp"
+#include "xercesc/dom/DOM.hpp"
+#include "xercesc/util/PlatformUtils.hpp"
+#include "xercesc/util/XMLString.hpp"
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <map>
+#include <vector>
+
+XERCES_CPP_NAMESPACE_USE
+
+/// Observation elements per segment; more than one parse buffer
+const Integer OBS_PER_SEGMENT = 600;
+/// Every fifth epoch of the first segment carries two observations
+const Integer PAIR_SPACING = 5;
+
+const std::string TDM_FILE = "./TestTdmReader.xml";
+
+
+//------------------------------------------------------------------------------
+// void WriteTdmFile()
+//------------------------------------------------------------------------------
+/**
+ * Writes a range segment with calendar epochs and a Doppler segment with day
+ * of year epochs
+ */
+//------------------------------------------------------------------------------
+void WriteTdmFile()
+{
+   std::ofstream tdm(TDM_FILE.c_str());
+   tdm << "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+       << "<tdm id=\"CCSDS_TDM_VERS\" version=\"1.0\">\n"
+       << "  <header>\n"
+       << "    <COMMENT>GMAT unit test data</COMMENT>\n"
+       << "    <CREATION_DATE>2026-10-17T00:00:00</CREATION_DATE>\n"
+       << "    <ORIGINATOR>GMAT</ORIGINATOR>\n"
+       << "  </header>\n"
+       << "  <body>\n";
+
+   tdm << "    <segment>\n"
+       << "      <metadata>\n"
+       << "        <TIME_SYSTEM>UTC</TIME_SYSTEM>\n"
+       << "        <PARTICIPANT_1>GDS</PARTICIPANT_1>\n"
+       << "        <PARTICIPANT_2>EstSat</PARTICIPANT_2>\n"
+       << "        <MODE>SEQUENTIAL</MODE>\n"
+       << "        <PATH>1,2,1</PATH>\n"
+       << "        <TRANSMIT_BAND>X</TRANSMIT_BAND>\n"
+       << "        <RECEIVE_BAND>X</RECEIVE_BAND>\n"
+       << "        <TIMETAG_REF>RECEIVE</TIMETAG_REF>\n"
+       << "        <INTEGRATION_INTERVAL>1.0</INTEGRATION_INTERVAL>\n"
+       << "        <INTEGRATION_REF>END</INTEGRATION_REF>\n"
+       << "        <RANGE_MODE>COHERENT</RANGE_MODE>\n"
+       << "        <RANGE_MODULUS>1048576</RANGE_MODULUS>\n"
+       << "        <RANGE_UNITS>RU</RANGE_UNITS>\n"
+       << "      </metadata>\n"
+       << "      <data>\n";
+   Integer second = 0;
+   for (Integer i = 0; i < OBS_PER_SEGMENT; ++i)
+   {
+      if ((i % PAIR_SPACING) != 1)
+         second += 10;
+      tdm << "        <observation><EPOCH>2024-01-15T"
+          << std::setfill('0') << std::setw(2) << second / 3600 << ":"
+          << std::setw(2) << (second / 60) % 60 << ":"
+          << std::setw(2) << second % 60 << ".125</EPOCH>"
+          << std::setfill(' ') << "<RANGE>" << std::setprecision(12)
+          << 123456.0 + 17.25 * i << "</RANGE></observation>\n";
+   }
+   tdm << "      </data>\n"
+       << "    </segment>\n";
+
+   tdm << "    <segment>\n"
+       << "      <metadata>\n"
+       << "        <COMMENT>Two way Doppler</COMMENT>\n"
+       << "        <TIME_SYSTEM>UTC</TIME_SYSTEM>\n"
+       << "        <PARTICIPANT_1>CAN</PARTICIPANT_1>\n"
+       << "        <PARTICIPANT_2>EstSat</PARTICIPANT_2>\n"
+       << "        <MODE>SEQUENTIAL</MODE>\n"
+       << "        <PATH>1,2,1</PATH>\n"
+       << "        <TRANSMIT_BAND>S</TRANSMIT_BAND>\n"
+       << "        <TIMETAG_REF>TRANSMIT</TIMETAG_REF>\n"
+       << "        <INTEGRATION_INTERVAL>10.0</INTEGRATION_INTERVAL>\n"
+       << "        <INTEGRATION_REF>START</INTEGRATION_REF>\n"
+       << "        <FREQ_OFFSET>0.0</FREQ_OFFSET>\n"
+       << "      </metadata>\n"
+       << "      <data>\n";
+   for (Integer i = 0; i < OBS_PER_SEGMENT; ++i)
+   {
+      second = 10 * i;
+      tdm << "        <observation><EPOCH>2024-016T"
+          << std::setfill('0') << std::setw(2) << second / 3600 << ":"
+          << std::setw(2) << (second / 60) % 60 << ":"
+          << std::setw(2) << second % 60 << ".5</EPOCH>"
+          << std::setfill(' ') << "<DOPPLER_INTEGRATED>"
+          << std::setprecision(12) << -2.5 + 1.0e-4 * i
+          << "</DOPPLER_INTEGRATED></observation>\n";
+   }
+   tdm << "      </data>\n"
+       << "    </segment>\n"
+       << "  </body>\n"
+       << "</tdm>\n";
+}
+
+
+//------------------------------------------------------------------------------
+// DOM reference reader
+//------------------------------------------------------------------------------
+std::string Text(const DOMElement *element)
+{
+   char *chars = XMLString::transcode(element->getTextContent());
+   std::string str(chars);
+   XMLString::release(&chars);
+   return str;
+}
+
+std::string Name(const DOMElement *element)
+{
+   char *chars = XMLString::transcode(element->getNodeName());
+   std::string str(chars);
+   XMLString::release(&chars);
+   return str;
+}
+
+GmatEpoch ParseEpoch(const std::string &strEpoch)
+{
+   Integer year, month, day, doy, hour, minute;
+   Real sec;
+
+   if (sscanf(strEpoch.c_str(), "%d-%d-%dT%d:%d:%lf", &year, &month, &day,
+              &hour, &minute, &sec) != 6)
+   {
+      sscanf(strEpoch.c_str(), "%d-%dT%d:%d:%lf", &year, &doy, &hour,
+             &minute, &sec);
+      ToMonthDayFromYearDOY(year, doy, month, day);
+   }
+   return ModifiedJulianDate(year, month, day, hour, minute, sec);
+}
+
+
+//------------------------------------------------------------------------------
+// void ReadWithDom(std::vector<ObservationData> &records)
+//------------------------------------------------------------------------------
+/**
+ * Builds the expected records from a DOM of the whole file
+ */
+//------------------------------------------------------------------------------
+void ReadWithDom(std::vector<ObservationData> &records)
+{
+   std::map<std::string, Real> bands;
+   bands["S"] = 1.0;
+   bands["X"] = 2.0;
+   bands["KA"] = 3.0;
+   bands["KU"] = 4.0;
+   bands["L"] = 5.0;
+
+   XMLPlatformUtils::Initialize();
+   XercesDOMParser *parser = new XercesDOMParser();
+   parser->setDoNamespaces(true);
+   parser->parse(TDM_FILE.c_str());
+   if (parser->getErrorCount() != 0)
+      throw MeasurementException("The DOM parser failed to read " + TDM_FILE);
+
+   DOMElement *body = parser->getDocument()->getDocumentElement()->
+         getLastElementChild();
+   ObservationData theTemplate;
+
+   for (DOMElement *segment = body->getFirstElementChild(); segment != NULL;
+        segment = segment->getNextElementSibling())
+   {
+      theTemplate.Clear();
+      for (DOMElement *item = segment->getFirstElementChild()->
+              getFirstElementChild(); item != NULL;
+           item = item->getNextElementSibling())
+      {
+         std::string name = Name(item), text = Text(item);
+         if ((name == "TIME_SYSTEM") && (text == "UTC"))
+            theTemplate.epochSystem = TimeSystemConverter::UTCMJD;
+         else if (name.find("PARTICIPANT_") == 0)
+            theTemplate.participantIDs.push_back(text);
+         else if (name == "PATH")
+         {
+            StringArray ids;
+            for (UnsignedInt i = 0; i < text.size(); i += 2)
+               ids.push_back(theTemplate.participantIDs.at(text[i] - '1'));
+            theTemplate.strands.push_back(ids);
+         }
+         else if (name == "TRANSMIT_BAND")
+         {
+            theTemplate.value.push_back(bands.count(text) ? bands[text] : 0.0);
+            theTemplate.dataMap.push_back(name);
+         }
+         else if (name == "TIMETAG_REF")
+            theTemplate.epochAtEnd = (text == "RECEIVE");
+         else if (name == "INTEGRATION_REF")
+            theTemplate.epochAtIntegrationEnd = (text == "END");
+         else if ((name == "RANGE_MODULUS") || (name == "FREQ_OFFSET") ||
+                  (name == "INTEGRATION_INTERVAL"))
+         {
+            theTemplate.value.push_back(atof(text.c_str()));
+            theTemplate.dataMap.push_back(name);
+         }
+         else if (name == "RANGE_UNITS")
+            theTemplate.unit = text;
+      }
+
+      // Consecutive observations with the same epoch form one record
+      std::string lastEpoch;
+      for (DOMElement *obs = segment->getLastElementChild()->
+              getFirstElementChild(); obs != NULL;
+           obs = obs->getNextElementSibling())
+      {
+         std::string epoch = Text(obs->getFirstElementChild());
+         std::string name = Name(obs->getLastElementChild());
+         if (theTemplate.typeName == "")
+            theTemplate.typeName = name;
+         if (epoch != lastEpoch)
+         {
+            records.push_back(theTemplate);
+            records.back().epoch = ParseEpoch(epoch);
+         }
+         records.back().value.push_back(
+               atof(Text(obs->getLastElementChild()).c_str()));
+         records.back().dataMap.push_back(name);
+         lastEpoch = epoch;
+      }
+   }
+
+   delete parser;
+   XMLPlatformUtils::Terminate();
+}
+
+
+//------------------------------------------------------------------------------
+// bool Same(const ObservationData &a, const ObservationData &b)
+//------------------------------------------------------------------------------
+bool Same(const ObservationData &a, const ObservationData &b)
+{
+   if ((a.value.size() != b.value.size()) ||
+       (memcmp(&a.epoch, &b.epoch, sizeof(Real)) != 0))
+      return false;
+   for (UnsignedInt i = 0; i < a.value.size(); ++i)
+      if (memcmp(&a.value[i], &b.value[i], sizeof(Real)) != 0)
+         return false;
+   return (a.epochSystem == b.epochSystem) && (a.typeName == b.typeName) &&
+          (a.unit == b.unit) && (a.participantIDs == b.participantIDs) &&
+          (a.strands == b.strands) && (a.dataMap == b.dataMap) &&
+          (a.epochAtEnd == b.epochAtEnd) &&
+          (a.epochAtIntegrationEnd == b.epochAtIntegrationEnd);
+}
+
+
+//------------------------------------------------------------------------------
+// int RunTest(TestOutput &out)
+//------------------------------------------------------------------------------
+int RunTest(TestOutput &out)
+{
+   WriteTdmFile();
+
+   std::vector<ObservationData> expected;
+   ReadWithDom(expected);
+   Integer pairs = OBS_PER_SEGMENT / PAIR_SPACING;
+   out.Put("============================== test the DOM reference");
+   out.Put("---------- paired observations should share a record");
+   out.Validate((Integer)expected.size(), 2 * OBS_PER_SEGMENT - pairs);
+
+   out.Put("============================== test SAX against DOM");
+   // The read sequence used by TdmObType::ReadObservation()
+   TdmReadWriter reader;
+   reader.Initialize();
+   reader.Validate(TDM_FILE);
+   out.Put("---------- the root element should be read");
+   out.Validate(reader.SetBody(), true);
+   ObservationData *theTemplate = reader.ProcessMetadata();
+
+   Integer read = 0, matched = 0;
+   while (theTemplate != NULL)
+   {
+      ObservationData *newData = new ObservationData(*theTemplate);
+      theTemplate = reader.LoadRecord(newData);
+      if (theTemplate != NULL)
+      {
+         if ((read < (Integer)expected.size()) &&
+             Same(*newData, expected[read]))
+            ++matched;
+         ++read;
+      }
+      delete newData;
+   }
+   reader.Finalize();
+
+   out.Put("---------- every record should be read, including the last");
+   out.Validate(read, (Integer)expected.size());
+   out.Put("---------- the records should match the DOM records");
+   out.Validate(matched, read);
+
+   remove(TDM_FILE.c_str());
+
+   return 1;
+}
+
+
+//------------------------------------------------------------------------------
+// int main()
+//------------------------------------------------------------------------------
+int main()
+{
+   TestOutput out("TestTdmReaderOut.txt");
+
+   try
+   {
+      RunTest(out);
+      out.Put("\nSuccessfully ran unit testing of TdmReadWriter!!");
+   }
+   catch (BaseException &e)
+   {
+      out.Put(e.GetFullMessage());
+      out.Close();
+      return 1;
+   }
+
+   out.Close();
+   return 0;
+}
@@ -0,0 +1,295 @@
+//$Id$
+//------------------------------------------------------------------------------
+//                           TestNativeEventSearch
+//------------------------------------------------------------------------------
+// GMAT: General Mission Analysis Tool
+//
+// Copyright (c) 2002 - 2020 United States Government as represented by the
+// Administrator of the National Aeronautics and Space Administration.
+// All Other Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// You may not use this file except in compliance with the License.
+// You may obtain a copy of the License at:
+// http://www.apache.org/licenses/LICENSE-2.0.
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied.   See the License for the specific language
+// governing permissions and limitations under the License.
+//
+// Author: GMAT Development Team
+// Created: 2026/10/17
+//
+/**
+ * Test driver comparing the native contact and eclipse searches with the
+ * SPICE searches.
+ *
+ * One mission runs a ContactLocator and an EclipseLocator with each search
+ * method on the same spacecraft.  The reports must list the same intervals,
+ * in the same order, with start and stop times that agree within
+ * EPOCH_TOLERANCE.
+ *
+ * Run it from the GMAT bin directory so the startup file, with the
+ * EventLocator plugin, is found.
+ */
+//------------------------------------------------------------------------------
+
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include "gmatdefs.hpp"
+#include "Moderator.hpp"
+#include "FileManager.hpp"
+#include "TimeSystemConverter.hpp"
+#include "GmatConstants.hpp"
+#include "RealUtilities.hpp"
+#include "GmatBaseException.hpp"
+#include "TestOutput.hpp"
+
+using namespace std;
+
+/// Largest allowed difference of the interval start and stop times (s)
+const Real EPOCH_TOLERANCE = 0.01;
+
+/// One line of an event report
+struct ReportedEvent
+{
+   std::string section;     // Observer of a contact, empty for an eclipse
+   Real        start;       // UTC modified Julian dates
+   Real        stop;
+   std::string description; // Occulting body and type of an eclipse
+};
+
+
+//------------------------------------------------------------------------------
+// std::string BuildScript()
+//------------------------------------------------------------------------------
+/**
+ * Builds the mission: a one day LEO propagation with two contact and two
+ * eclipse locators that differ only in the search method.
+ */
+//------------------------------------------------------------------------------
+std::string BuildScript()
+{
+   std::stringstream s;
+   s << "Create Spacecraft Sat;\n"
+        "Sat.DateFormat = UTCGregorian;\n"
+        "Sat.Epoch = '01 Jan 2020 12:00:00.000';\n"
+        "Sat.CoordinateSystem = EarthMJ2000Eq;\n"
+        "Sat.DisplayStateType = Keplerian;\n"
+        "Sat.SMA = 6978;\n"
+        "Sat.ECC = 0.001;\n"
+        "Sat.INC = 51.6;\n"
+        "Sat.RAAN = 30;\n"
+        "Sat.AOP = 0;\n"
+        "Sat.TA = 0;\n"
+        "Create ForceModel FM;\n"
+        "FM.CentralBody = Earth;\n"
+        "FM.PrimaryBodies = {Earth};\n"
+        "FM.GravityField.Earth.Degree = 8;\n"
+        "FM.GravityField.Earth.Order = 8;\n"
+        "FM.PointMasses = {Luna, Sun};\n"
+        "Create Propagator Prop;\n"
+        "Prop.FM = FM;\n"
+        "Prop.Type = RungeKutta89;\n"
+        "Prop.MaxStep = 60;\n"
+        "Create GroundStation Station1;\n"
+        "Station1.StateType = Spherical;\n"
+        "Station1.Location1 = 28.5;\n"
+        "Station1.Location2 = 279.4;\n"
+        "Station1.MinimumElevationAngle = 7;\n"
+        "Create GroundStation Station2;\n"
+        "Station2.StateType = Spherical;\n"
+        "Station2.Location1 = -35.4;\n"
+        "Station2.Location2 = 148.9;\n";
+
+   const char *methods[] = { "Native", "SPICE" };
+   for (Integer i = 0; i < 2; ++i)
+   {
+      std::string method = methods[i];
+      s << "Create ContactLocator Contacts" << method << ";\n"
+        << "Contacts" << method << ".Target = Sat;\n"
+        << "Contacts" << method << ".Filename = 'TestContacts" << method
+        << ".txt';\n"
+        << "Contacts" << method << ".Observers = {Station1, Station2};\n"
+        << "Contacts" << method << ".UseLightTimeDelay = true;\n"
+        << "Contacts" << method << ".UseStellarAberration = true;\n"
+        << "Contacts" << method << ".RunMode = Automatic;\n"
+        << "Contacts" << method << ".UseEntireInterval = true;\n"
+        << "Contacts" << method << ".SearchMethod = " << method << ";\n"
+        << "Create EclipseLocator Eclipses" << method << ";\n"
+        << "Eclipses" << method << ".Spacecraft = Sat;\n"
+        << "Eclipses" << method << ".Filename = 'TestEclipses" << method
+        << ".txt';\n"
+        << "Eclipses" << method << ".OccultingBodies = {Earth, Luna};\n"
+        << "Eclipses" << method
+        << ".EclipseTypes = {'Umbra', 'Penumbra', 'Antumbra'};\n"
+        << "Eclipses" << method << ".UseLightTimeDelay = true;\n"
+        << "Eclipses" << method << ".UseStellarAberration = true;\n"
+        << "Eclipses" << method << ".RunMode = Automatic;\n"
+        << "Eclipses" << method << ".UseEntireInterval = true;\n"
+        << "Eclipses" << method << ".SearchMethod = " << method << ";\n";
+   }
+
+   s << "BeginMissionSequence;\n"
+        "Propagate Prop(Sat) {Sat.ElapsedDays = 1};\n";
+   return s.str();
+}
+
+
+//------------------------------------------------------------------------------
+// std::vector<ReportedEvent> ReadReport(const std::string &fileName)
+//------------------------------------------------------------------------------
+/**
+ * Reads the intervals of a contact or eclipse report from the output
+ * directory.
+ *
+ * Interval lines start with two UTC Gregorian epochs and the duration; an
+ * eclipse line then names the occulting body and the eclipse type, and
+ * possibly the total event.
+ */
+//------------------------------------------------------------------------------
+std::vector<ReportedEvent> ReadReport(const std::string &fileName)
+{
+   std::string outPath =
+         FileManager::Instance()->GetAbsPathname(FileManager::OUTPUT_PATH);
+   if ((outPath != "") && (outPath[outPath.size() - 1] != '/') &&
+       (outPath[outPath.size() - 1] != '\\'))
+      outPath += "/";
+
+   std::ifstream report((outPath + fileName).c_str());
+   if (!report)
+      throw GmatBaseException("Cannot open the event report " + fileName);
+
+   TimeSystemConverter *converter = TimeSystemConverter::Instance();
+   std::vector<ReportedEvent> events;
+   std::string line, section;
+
+   while (getline(report, line))
+   {
+      if (line.compare(0, 10, "Observer: ") == 0)
+      {
+         section = line.substr(10);
+         continue;
+      }
+
+      std::istringstream fields(line);
+      std::string day1, month1, year1, time1, day2, month2, year2, time2;
+      Real duration;
+      if (!(fields >> day1 >> month1 >> year1 >> time1 >> day2 >> month2 >>
+            year2 >> time2 >> duration) || (month1.size() != 3) ||
+          (time1.find(':') == std::string::npos))
+         continue;
+
+      ReportedEvent ev;
+      ev.section = section;
+      ev.start = converter->ConvertGregorianToMjd(day1 + " " + month1 + " " +
+            year1 + " " + time1);
+      ev.stop  = converter->ConvertGregorianToMjd(day2 + " " + month2 + " " +
+            year2 + " " + time2);
+      std::string body, type;
+      if (fields >> body >> type)
+         ev.description = body + " " + type;
+      events.push_back(ev);
+   }
+
+   return events;
+}
+
+
+//------------------------------------------------------------------------------
+// void CompareReports(TestOutput &out, const std::string &what)
+//------------------------------------------------------------------------------
+/**
+ * Checks that the native report of a locator lists the SPICE intervals.
+ *
+ * @param out  The test output
+ * @param what "Contacts" or "Eclipses"
+ */
+//------------------------------------------------------------------------------
+void CompareReports(TestOutput &out, const std::string &what)
+{
+   std::vector<ReportedEvent> native = ReadReport("Test" + what + "Native.txt");
+   std::vector<ReportedEvent> spice  = ReadReport("Test" + what + "SPICE.txt");
+
+   out.Put("---------- " + what + ": number of intervals, native and SPICE");
+   out.Validate((int)native.size(), (int)spice.size());
+   out.Put("---------- " + what + ": at least one interval is found");
+   out.Validate(spice.empty(), false);
+
+   Real largest = 0.0;
+   for (UnsignedInt i = 0; i < spice.size(); ++i)
+   {
+      out.Validate(native[i].section + native[i].description,
+                   spice[i].section + spice[i].description);
+
+      Real dStart = GmatMathUtil::Abs(native[i].start - spice[i].start) *
+            GmatTimeConstants::SECS_PER_DAY;
+      Real dStop  = GmatMathUtil::Abs(native[i].stop - spice[i].stop) *
+            GmatTimeConstants::SECS_PER_DAY;
+      out.CheckValue(dStart, 0.0, EPOCH_TOLERANCE);
+      out.CheckValue(dStop,  0.0, EPOCH_TOLERANCE);
+      if (dStart > largest) largest = dStart;
+      if (dStop  > largest) largest = dStop;
+   }
+   out.Put("---------- " + what + ": largest epoch difference (s)", largest);
+}
+
+
+//------------------------------------------------------------------------------
+// int RunTest(TestOutput &out)
+//------------------------------------------------------------------------------
+int RunTest(TestOutput &out)
+{
+   out.Put("============================== test native event search");
+   Moderator *mod = Moderator::Instance();
+   if (!mod->Initialize("gmat_startup_file.txt"))
+      throw GmatBaseException("The Moderator did not initialize");
+
+   std::istringstream script(BuildScript());
+   out.Put("---------- interpret the mission");
+   out.Validate(mod->InterpretScript(&script, true), true);
+
+   out.Put("---------- run the mission");
+   out.Validate(mod->RunMission() >= 0, true);
+
+   CompareReports(out, "Contacts");
+   CompareReports(out, "Eclipses");
+
+   mod->Finalize();
+   return 1;
+}
+
+
+//------------------------------------------------------------------------------
+// int main()
+//------------------------------------------------------------------------------
+int main()
+{
+   TestOutput out("TestNativeEventSearchOut.txt");
+   out.SetPrecision(12);
+
+   try
+   {
+      RunTest(out);
+      out.Put("\nSuccessfully ran unit testing of the native event search!!");
+   }
+   catch (BaseException &e)
+   {
+      out.Put(e.GetFullMessage());
+      out.Close();
+      return 1;
+   }
+   catch (...)
+   {
+      out.Put("Unknown error occurred\n");
+      out.Close();
+      return 1;
+   }
+
+   out.Close();
+   return 0;
+}
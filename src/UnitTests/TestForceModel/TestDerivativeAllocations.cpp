@@ -0,0 +1,248 @@
+//$Id$
+//------------------------------------------------------------------------------
+//                          TestDerivativeAllocations
+//------------------------------------------------------------------------------
+// GMAT: General Mission Analysis Tool
+//
+// Copyright (c) 2002 - 2020 United States Government as represented by the
+// Administrator of the National Aeronautics and Space Administration.
+// All Other Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// You may not use this file except in compliance with the License.
+// You may obtain a copy of the License at:
+// http://www.apache.org/licenses/LICENSE-2.0.
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied.   See the License for the specific language
+// governing permissions and limitations under the License.
+//
+// Author: GMAT Development Team
+// Created: 2026/10/17
+//
+/**
+ * Unit test program checking that ODEModel::GetDerivatives() does not touch
+ * the heap once the model is initialized.
+ *
+ * The program replaces the global operator new so every allocation is counted
+ * by MemoryTracker while counting is on.  Each case interprets a force model,
+ * propagates one spacecraft for a minute so the model is initialized the way
+ * Propagate does it, warms the model up, and then requires zero allocations
+ * over a series of derivative evaluations.  The cases are the Earth, Luna and
+ * Sun point masses, and a LEO model with a 20x20 Earth gravity field, the Luna
+ * and Sun point masses, solar radiation pressure and Jacchia-Roberts drag.  The
+ * evaluation rate of each case is reported.
+ *
+ * Run it from the GMAT bin directory so the startup file is found.
+ */
+//------------------------------------------------------------------------------
+
+#include "Moderator.hpp"
+#include "GmatCommand.hpp"
+#include "PropSetup.hpp"
+#include "ODEModel.hpp"
+#include "MemoryTracker.hpp"
+#include "BaseException.hpp"
+#include "GmatBaseException.hpp"
+#include "TestOutput.hpp"
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <new>
+#include <sstream>
+
+
+//------------------------------------------------------------------------------
+// Counting allocator
+//------------------------------------------------------------------------------
+void* operator new(std::size_t size)
+{
+   MemoryTracker::CountAllocation();
+   void *ptr = std::malloc(size == 0 ? 1 : size);
+   if (ptr == NULL)
+      throw std::bad_alloc();
+   return ptr;
+}
+
+void operator delete(void *ptr) noexcept
+{
+   std::free(ptr);
+}
+
+void operator delete(void *ptr, std::size_t) noexcept
+{
+   std::free(ptr);
+}
+
+
+//------------------------------------------------------------------------------
+// std::string BuildScript(const std::string &forces)
+//------------------------------------------------------------------------------
+/**
+ * Builds a script that propagates a LEO spacecraft for one minute.
+ *
+ * @param forces The force model settings, one "FM.Field = value;" per line
+ *
+ * @return The script
+ */
+//------------------------------------------------------------------------------
+std::string BuildScript(const std::string &forces)
+{
+   std::stringstream s;
+   s << "Create Spacecraft Sat;\n"
+     << "Sat.DateFormat = UTCGregorian;\n"
+     << "Sat.Epoch = '01 Jan 2020 12:00:00.000';\n"
+     << "Sat.CoordinateSystem = EarthMJ2000Eq;\n"
+     << "Sat.DisplayStateType = Keplerian;\n"
+     << "Sat.SMA = 6878;\n"
+     << "Sat.ECC = 0.001;\n"
+     << "Sat.INC = 51.6;\n"
+     << "Sat.DryMass = 500;\n"
+     << "Sat.Cd = 2.2;\n"
+     << "Sat.Cr = 1.8;\n"
+     << "Sat.DragArea = 4;\n"
+     << "Sat.SRPArea = 4;\n"
+     << "Create ForceModel FM;\n"
+     << "FM.CentralBody = Earth;\n"
+     << forces
+     << "Create Propagator Prop;\n"
+     << "Prop.FM = FM;\n"
+     << "Prop.Type = RungeKutta89;\n"
+     << "BeginMissionSequence;\n"
+     << "Propagate Prop(Sat) {Sat.ElapsedSecs = 60};\n";
+   return s.str();
+}
+
+
+//------------------------------------------------------------------------------
+// ODEModel* BuildModel(Moderator *mod, const std::string &forces,
+//       RealArray &state)
+//------------------------------------------------------------------------------
+/**
+ * Runs a one minute propagation and returns the force model of its Propagate
+ * command, initialized for the spacecraft.
+ *
+ * @param mod    The initialized Moderator
+ * @param forces The force model settings
+ * @param state  Receives the propagation state
+ *
+ * @return The model
+ */
+//------------------------------------------------------------------------------
+ODEModel* BuildModel(Moderator *mod, const std::string &forces,
+                     RealArray &state)
+{
+   std::istringstream script(BuildScript(forces));
+   if (!mod->InterpretScript(&script, true))
+      throw GmatBaseException("The test script did not interpret");
+   if (mod->RunMission() < 0)
+      throw GmatBaseException("The test mission failed");
+
+   GmatCommand *cmd = mod->GetFirstCommand();
+   while ((cmd != NULL) && (cmd->GetTypeName() != "Propagate"))
+      cmd = cmd->GetNext();
+   if (cmd == NULL)
+      throw GmatBaseException("The test mission has no Propagate command");
+
+   // The command keeps its PropSetups, initialized, after the run
+   PropSetup *prop = (PropSetup*)cmd->GetClone(0);
+   if ((prop == NULL) || (prop->GetODEModel() == NULL))
+      throw GmatBaseException("The Propagate command has no force model");
+
+   GmatState *gs = prop->GetPropStateManager()->GetState();
+   state.assign(gs->GetState(), gs->GetState() + gs->GetSize());
+   return prop->GetODEModel();
+}
+
+
+//------------------------------------------------------------------------------
+// void RunCase(TestOutput &out, Moderator *mod, const std::string &label,
+//       const std::string &forces)
+//------------------------------------------------------------------------------
+void RunCase(TestOutput &out, Moderator *mod, const std::string &label,
+             const std::string &forces)
+{
+   const Integer evaluations = 10000;
+
+   out.Put("============================== test " + label);
+   RealArray state;
+   ODEModel *model = BuildModel(mod, forces, state);
+
+   // The first calls load ephemeris and weather data and size the buffers
+   for (Integer i = 0; i < 16; ++i)
+      model->GetDerivatives(&state[0], i * 3.75, 1);
+
+   MemoryTracker::ResetAllocationCount();
+   MemoryTracker::SetAllocationCounting(true);
+
+   std::chrono::steady_clock::time_point start =
+         std::chrono::steady_clock::now();
+   for (Integer i = 0; i < evaluations; ++i)
+      model->GetDerivatives(&state[0], (i % 16) * 3.75, 1);
+   std::chrono::duration<double> elapsed =
+         std::chrono::steady_clock::now() - start;
+
+   MemoryTracker::SetAllocationCounting(false);
+   UnsignedInt allocations = MemoryTracker::GetAllocationCount();
+
+   out.Put("Derivative evaluations per second = ",
+           evaluations / elapsed.count());
+   out.Put("---------- GetDerivatives() should not allocate");
+   out.Validate((Integer)allocations, 0);
+}
+
+
+//------------------------------------------------------------------------------
+// int RunTest(TestOutput &out)
+//------------------------------------------------------------------------------
+int RunTest(TestOutput &out)
+{
+   Moderator *mod = Moderator::Instance();
+   if (!mod->Initialize("gmat_startup_file.txt"))
+      throw GmatBaseException("Moderator initialization failed");
+
+   RunCase(out, mod, "point masses",
+           "FM.PrimaryBodies = {Earth};\n"
+           "FM.GravityField.Earth.Degree = 0;\n"
+           "FM.GravityField.Earth.Order = 0;\n"
+           "FM.PointMasses = {Luna, Sun};\n");
+
+   RunCase(out, mod, "harmonic gravity, drag and SRP",
+           "FM.PrimaryBodies = {Earth};\n"
+           "FM.GravityField.Earth.Degree = 20;\n"
+           "FM.GravityField.Earth.Order = 20;\n"
+           "FM.GravityField.Earth.PotentialFile = 'JGM2.cof';\n"
+           "FM.PointMasses = {Luna, Sun};\n"
+           "FM.SRP = On;\n"
+           "FM.Drag.AtmosphereModel = JacchiaRoberts;\n"
+           "FM.Drag.HistoricWeatherSource = 'ConstantFluxAndGeoMag';\n"
+           "FM.Drag.PredictedWeatherSource = 'ConstantFluxAndGeoMag';\n");
+
+   return 1;
+}
+
+
+//------------------------------------------------------------------------------
+// int main()
+//------------------------------------------------------------------------------
+int main()
+{
+   TestOutput out("TestDerivativeAllocationsOut.txt");
+
+   try
+   {
+      RunTest(out);
+      out.Put("\nSuccessfully ran the derivative allocation test!!");
+   }
+   catch (BaseException &e)
+   {
+      out.Put(e.GetFullMessage());
+      out.Close();
+      return 1;
+   }
+
+   out.Close();
+   return 0;
+}
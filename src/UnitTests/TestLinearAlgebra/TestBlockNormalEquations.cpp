@@ -0,0 +1,299 @@
+//$Id$
+//------------------------------------------------------------------------------
+//                           TestBlockNormalEquations
+//------------------------------------------------------------------------------
+// GMAT: General Mission Analysis Tool
+//
+// Copyright (c) 2002 - 2020 United States Government as represented by the
+// Administrator of the National Aeronautics and Space Administration.
+// All Other Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// You may not use this file except in compliance with the License.
+// You may obtain a copy of the License at:
+// http://www.apache.org/licenses/LICENSE-2.0.
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied.   See the License for the specific language
+// governing permissions and limitations under the License.
+//
+// Author: GMAT Development Team
+// Created: 2026/10/17
+//
+/**
+ * Unit test program for BlockNormalEquations.
+ *
+ * A least squares problem with 7 global parameters and two bias parameters per
+ * tracking pass is accumulated both into a dense information matrix, as
+ * BatchEstimator::Accumulate() does, and into BlockNormalEquations.  The
+ * solution and covariance of the Schur complement solver are compared with
+ * the dense Cholesky inverse, including passes without data, an a priori and
+ * the removal of edited measurements.  The accumulate and solve times are
+ * measured by the NormalEquations benchmarks of gmat_bench.
+ */
+//------------------------------------------------------------------------------
+
+#include "utildefs.hpp"
+#include "Rmatrix.hpp"
+#include "Rvector.hpp"
+#include "BlockNormalEquations.hpp"
+#include "CholeskyFactorization.hpp"
+#include "BaseException.hpp"
+#include "LinearAlgebraFixture.hpp"
+#include "TestOutput.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+
+
+//------------------------------------------------------------------------------
+// void AccumulateDense(const NormalEquationsProblem &prob, Rmatrix &info,
+//       Rvector &rhs)
+//------------------------------------------------------------------------------
+/**
+ * Accumulates the dense normal equations as BatchEstimator::Accumulate() does
+ */
+//------------------------------------------------------------------------------
+void AccumulateDense(const NormalEquationsProblem &prob, Rmatrix &info,
+      Rvector &rhs)
+{
+   Integer n = prob.blocks.size();
+   info.SetSize(n, n);
+   rhs.SetSize(n);
+   for (Integer i = 0; i < n; ++i)
+      rhs[i] = 0.0;
+   for (UnsignedInt k = 0; k < prob.meas.size(); ++k)
+   {
+      const LeastSquaresMeasurement &m = prob.meas[k];
+      for (Integer i = 0; i < n; ++i)
+      {
+         for (Integer j = 0; j < n; ++j)
+            info(i, j) += m.h[i] * m.h[j] * m.weight;
+         rhs[i] += m.h[i] * m.weight * m.residual;
+      }
+   }
+}
+
+
+//------------------------------------------------------------------------------
+// void SolveDense(const Rmatrix &info, const Rvector &rhs, RealArray &dx,
+//       Rmatrix &cov)
+//------------------------------------------------------------------------------
+/**
+ * Solves the dense normal equations the way BatchEstimator does with the
+ * Cholesky inversion: zero rows are removed, the matrix is inverted and the
+ * solution is the covariance times the right hand side
+ */
+//------------------------------------------------------------------------------
+void SolveDense(const Rmatrix &info, const Rvector &rhs, RealArray &dx,
+      Rmatrix &cov)
+{
+   Integer n = info.GetNumRows();
+   IntegerArray removed, aux;
+   Integer numRemoved;
+   Rmatrix reduced = MatrixFactorization::CompressNormalMatrix(info, removed,
+         aux, numRemoved);
+
+   CholeskyFactorization cf;
+   cf.Invert(reduced);
+   cov = MatrixFactorization::ExpandNormalMatrixInverse(reduced, aux,
+         numRemoved);
+
+   dx.assign(n, 0.0);
+   for (Integer i = 0; i < n; ++i)
+      for (Integer j = 0; j < n; ++j)
+         dx[i] += cov(i, j) * rhs[j];
+}
+
+
+//------------------------------------------------------------------------------
+// Real NormalResidual(const Rmatrix &info, const Rvector &rhs,
+//       const RealArray &dx)
+//------------------------------------------------------------------------------
+/**
+ * Returns the relative residual of the normal equations, |A dx - b| / |b|,
+ * over the parameters that are not removed
+ */
+//------------------------------------------------------------------------------
+Real NormalResidual(const Rmatrix &info, const Rvector &rhs,
+      const RealArray &dx)
+{
+   Real num = 0.0, den = 0.0;
+   for (Integer i = 0; i < info.GetNumRows(); ++i)
+   {
+      Real r = -rhs[i];
+      for (Integer j = 0; j < info.GetNumColumns(); ++j)
+         r += info(i, j) * dx[j];
+      num += r * r;
+      den += rhs[i] * rhs[i];
+   }
+   return std::sqrt(num / den);
+}
+
+
+//------------------------------------------------------------------------------
+// void CheckSolution(TestOutput &out, const Rmatrix &info, const Rvector &rhs,
+//       const RealArray &dx, const RealArray &bdx)
+//------------------------------------------------------------------------------
+/**
+ * Compares the two solutions, and checks that the block solution solves the
+ * normal equations at least as well as the dense one
+ */
+//------------------------------------------------------------------------------
+void CheckSolution(TestOutput &out, const Rmatrix &info, const Rvector &rhs,
+      const RealArray &dx, const RealArray &bdx)
+{
+   out.Put("---------- solution difference should be below 1e-10");
+   out.Validate(LinearAlgebraFixture::MaxRelativeDifference(dx, bdx), 0.0,
+                1.0e-10);
+
+   Real denseResidual = NormalResidual(info, rhs, dx);
+   Real tolerance = std::max(denseResidual, 1.0e-12);
+   out.Put("dense normal equation residual = ", denseResidual);
+   out.Put("---------- block normal equation residual should be below ",
+           tolerance);
+   out.Validate(NormalResidual(info, rhs, bdx), 0.0, tolerance);
+}
+
+
+//------------------------------------------------------------------------------
+//int RunTest(TestOutput &out)
+//------------------------------------------------------------------------------
+int RunTest(TestOutput &out)
+{
+   LinearAlgebraFixture fixture;
+   NormalEquationsProblem prob = fixture.MakeNormalEquationsProblem(12, 20, 5);
+   Integer n = prob.blocks.size();
+
+   out.Put("============================== test 12 passes, pass 5 without "
+           "data");
+
+   BlockNormalEquations bne;
+   bne.SetStructure(prob.blocks);
+   for (UnsignedInt k = 0; k < prob.meas.size(); ++k)
+      bne.Accumulate(prob.meas[k].h, prob.meas[k].weight,
+            prob.meas[k].residual);
+
+   Rmatrix info, cov, bcov;
+   Rvector rhs;
+   RealArray dx, bdx;
+   AccumulateDense(prob, info, rhs);
+
+   out.Put("---------- information difference should be below 1e-14");
+   out.Validate(LinearAlgebraFixture::MaxRelativeDifference(info,
+                bne.GetInformation()), 0.0, 1.0e-14);
+
+   SolveDense(info, rhs, dx, cov);
+   bne.Solve(bdx);
+   bne.GetCovariance(bcov);
+   CheckSolution(out, info, rhs, dx, bdx);
+   out.Put("---------- covariance difference should be below 1e-9");
+   out.Validate(LinearAlgebraFixture::MaxRelativeDifference(cov, bcov), 0.0,
+                1.0e-9);
+   out.Put("---------- the two biases of the empty pass are removed");
+   out.Validate((int)bne.GetRemovedIndexes().size(), 2);
+
+   // A priori on every parameter, block diagonal
+   out.Put("============================== test with an a priori");
+   Rmatrix apriori(n, n);
+   Rvector aprioriRhs(n);
+   for (Integer i = 0; i < n; ++i)
+   {
+      apriori(i, i) = 1.0e2 + i;
+      aprioriRhs[i] = 0.01 * i;
+      if ((i > 0) && (prob.blocks[i] == prob.blocks[i - 1]))
+      {
+         apriori(i, i - 1) = 1.0;
+         apriori(i - 1, i) = 1.0;
+      }
+   }
+   bne.AddInformation(apriori, aprioriRhs);
+   info = info + apriori;
+   rhs = rhs + aprioriRhs;
+
+   SolveDense(info, rhs, dx, cov);
+   bne.Solve(bdx);
+   bne.GetCovariance(bcov);
+   CheckSolution(out, info, rhs, dx, bdx);
+   out.Put("---------- covariance difference should be below 1e-9");
+   out.Validate(LinearAlgebraFixture::MaxRelativeDifference(cov, bcov), 0.0,
+                1.0e-9);
+
+   // The block covariance is the full one within the global set and within
+   // each pass, and zero elsewhere
+   Rmatrix blockCov, expected(n, n);
+   bne.GetBlockCovariance(blockCov);
+   for (Integer i = 0; i < n; ++i)
+      for (Integer j = 0; j < n; ++j)
+         if (prob.blocks[i] == prob.blocks[j])
+            expected(i, j) = bcov(i, j);
+   out.Put("---------- block covariance difference should be below 1e-15");
+   out.Validate(LinearAlgebraFixture::MaxRelativeDifference(expected,
+                blockCov), 0.0, 1.0e-15);
+
+   // Remove every third measurement, as the inner loop editing does
+   out.Put("============================== test with edited measurements "
+           "removed");
+   BlockNormalEquations edited(bne);
+   for (UnsignedInt k = 0; k < prob.meas.size(); k += 3)
+   {
+      const LeastSquaresMeasurement &m = prob.meas[k];
+      edited.Accumulate(m.h, -m.weight, m.residual);
+      for (Integer i = 0; i < n; ++i)
+      {
+         for (Integer j = 0; j < n; ++j)
+            info(i, j) -= m.h[i] * m.h[j] * m.weight;
+         rhs[i] -= m.h[i] * m.weight * m.residual;
+      }
+   }
+
+   SolveDense(info, rhs, dx, cov);
+   edited.Solve(bdx);
+   CheckSolution(out, info, rhs, dx, bdx);
+
+   // A measurement depending on biases of two passes is rejected
+   out.Put("============================== test a measurement coupling two "
+           "passes");
+   RealArray h(n, 0.0);
+   h[0] = 1.0;
+   h[n - 1] = 1.0;
+   bool thrown = false;
+   try
+   {
+      bne.Accumulate(h, 1.0, 0.0);
+   }
+   catch (BaseException &)
+   {
+      thrown = true;
+   }
+   out.Put("---------- Accumulate() should throw");
+   out.Validate(thrown, true);
+
+   return 1;
+}
+
+
+//------------------------------------------------------------------------------
+// int main()
+//------------------------------------------------------------------------------
+int main()
+{
+   TestOutput out("TestBlockNormalEquationsOut.txt");
+
+   try
+   {
+      RunTest(out);
+      out.Put("\nSuccessfully ran unit testing of BlockNormalEquations!!");
+   }
+   catch (BaseException &e)
+   {
+      out.Put(e.GetFullMessage());
+      out.Close();
+      return 1;
+   }
+
+   out.Close();
+   return 0;
+}
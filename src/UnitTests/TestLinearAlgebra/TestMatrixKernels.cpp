@@ -0,0 +1,265 @@
+//$Id$
+//------------------------------------------------------------------------------
+//                              TestMatrixKernels
+//------------------------------------------------------------------------------
+// GMAT: General Mission Analysis Tool
+//
+// Copyright (c) 2002 - 2020 United States Government as represented by the
+// Administrator of the National Aeronautics and Space Administration.
+// All Other Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// You may not use this file except in compliance with the License.
+// You may obtain a copy of the License at:
+// http://www.apache.org/licenses/LICENSE-2.0.
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied.   See the License for the specific language
+// governing permissions and limitations under the License.
+//
+// Author: GMAT Development Team
+// Created: 2026/10/17
+//
+/**
+ * Unit test program for the GmatMatrixUtil kernels.
+ *
+ * The blocked product is compared with a plain triple loop for all transpose
+ * combinations, for shapes on both sides of the packing threshold and for
+ * several alpha and beta values.  The fused Rmatrix forms, AddProduct() and
+ * the Cholesky, LU and QR inverses are checked as well; with a GMAT_USE_BLAS
+ * build the larger cases exercise the BLAS and LAPACK routes.  The timings of
+ * these kernels are in the gmat_bench math group.
+ */
+//------------------------------------------------------------------------------
+
+#include "utildefs.hpp"
+#include "Rmatrix.hpp"
+#include "Rvector.hpp"
+#include "MatrixUtil.hpp"
+#include "CholeskyFactorization.hpp"
+#include "LUFactorization.hpp"
+#include "QRFactorization.hpp"
+#include "BaseException.hpp"
+#include "LinearAlgebraFixture.hpp"
+#include "TestOutput.hpp"
+
+#include <algorithm>
+#include <string>
+
+/// Source of the test matrices
+static LinearAlgebraFixture fixture;
+
+
+//------------------------------------------------------------------------------
+// void NaiveMultiply(bool ta, bool tb, Integer m, Integer n, Integer k,
+//       Real alpha, const Real *a, const Real *b, Real beta, Real *c)
+//------------------------------------------------------------------------------
+/**
+ * Reference product, C = alpha op(A) op(B) + beta C, as a plain triple loop
+ */
+//------------------------------------------------------------------------------
+void NaiveMultiply(bool ta, bool tb, Integer m, Integer n, Integer k,
+      Real alpha, const Real *a, const Real *b, Real beta, Real *c)
+{
+   for (Integer i = 0; i < m; ++i)
+      for (Integer j = 0; j < n; ++j)
+      {
+         Real sum = 0.0;
+         for (Integer p = 0; p < k; ++p)
+            sum += (ta ? a[p * m + i] : a[i * k + p]) *
+                   (tb ? b[j * k + p] : b[p * n + j]);
+         c[i * n + j] = alpha * sum + (beta == 0.0 ? 0.0 : beta * c[i * n + j]);
+      }
+}
+
+
+//------------------------------------------------------------------------------
+// void TestProducts(TestOutput &out)
+//------------------------------------------------------------------------------
+void TestProducts(TestOutput &out)
+{
+   out.Put("============================== test products");
+
+   const Integer shapes[][3] = { {1, 1, 1}, {3, 3, 3}, {6, 6, 6},
+                                 {7, 5, 9}, {37, 41, 29}, {130, 300, 270} };
+   const Real scales[][2] = { {1.0, 0.0}, {-0.5, 1.0}, {2.0, -3.0} };
+
+   for (Integer s = 0; s < 6; ++s)
+   {
+      Integer m = shapes[s][0], n = shapes[s][1], k = shapes[s][2];
+      Real worst = 0.0;
+      for (Integer t = 0; t < 4; ++t)
+      {
+         bool ta = ((t & 1) != 0), tb = ((t & 2) != 0);
+         Rmatrix a = (ta ? fixture.RandomMatrix(k, m) :
+                           fixture.RandomMatrix(m, k));
+         Rmatrix b = (tb ? fixture.RandomMatrix(n, k) :
+                           fixture.RandomMatrix(k, n));
+         for (Integer sc = 0; sc < 3; ++sc)
+         {
+            Rmatrix c = fixture.RandomMatrix(m, n), expected = c;
+            GmatMatrixUtil::Multiply(ta, tb, m, n, k, scales[sc][0],
+                  a.GetDataVector(), b.GetDataVector(), scales[sc][1],
+                  (Real*)c.GetDataVector());
+            NaiveMultiply(ta, tb, m, n, k, scales[sc][0], a.GetDataVector(),
+                  b.GetDataVector(), scales[sc][1],
+                  (Real*)expected.GetDataVector());
+            worst = std::max(worst,
+                  LinearAlgebraFixture::MaxDifference(c, expected) / k);
+         }
+      }
+      out.Put("---------- " + std::to_string(m) + " x " + std::to_string(k) +
+            " times " + std::to_string(k) + " x " + std::to_string(n));
+      out.Validate(worst, 0.0, 1.0e-14);
+   }
+
+   // Without BLAS the product sums in the order of the triple loop
+   if (!GmatMatrixUtil::IsBlasAvailable())
+   {
+      Rmatrix a = fixture.RandomMatrix(60, 70);
+      Rmatrix b = fixture.RandomMatrix(70, 50);
+      Rmatrix expected(60, 50);
+      NaiveMultiply(false, false, 60, 50, 70, 1.0, a.GetDataVector(),
+            b.GetDataVector(), 0.0, (Real*)expected.GetDataVector());
+      out.Put("---------- operator* matches the triple loop exactly");
+      out.Validate(LinearAlgebraFixture::MaxDifference(a * b, expected) == 0.0,
+            true);
+   }
+}
+
+
+//------------------------------------------------------------------------------
+// void TestFusedForms(TestOutput &out)
+//------------------------------------------------------------------------------
+void TestFusedForms(TestOutput &out)
+{
+   out.Put("============================== test fused forms");
+
+   Rmatrix h = fixture.RandomMatrix(40, 90);
+   Rmatrix p = fixture.SpdMatrix(90), w = fixture.SpdMatrix(40);
+
+   out.Put("---------- H P H^T");
+   out.Validate(LinearAlgebraFixture::MaxDifference(
+         MatrixTimesMatrixTimesTranspose(h, p), h * p * h.Transpose()),
+         0.0, 1.0e-9);
+   out.Put("---------- H^T W H");
+   out.Validate(LinearAlgebraFixture::MaxDifference(
+         TransposeTimesMatrixTimesMatrix(h, w), h.Transpose() * w * h),
+         0.0, 1.0e-9);
+   out.Put("---------- transpose products");
+   out.Validate(LinearAlgebraFixture::MaxDifference(TransposeTimesMatrix(h, h),
+         h.Transpose() * h), 0.0, 1.0e-12);
+   out.Validate(LinearAlgebraFixture::MaxDifference(MatrixTimesTranspose(h, h),
+         h * h.Transpose()), 0.0, 1.0e-12);
+   out.Validate(LinearAlgebraFixture::MaxDifference(
+         TransposeTimesTranspose(p, h), p.Transpose() * h.Transpose()),
+         0.0, 1.0e-12);
+
+   Rmatrix acc = p;
+   acc.AddProduct(h, h, -0.5, true, false);
+   out.Put("---------- AddProduct");
+   out.Validate(LinearAlgebraFixture::MaxDifference(acc,
+         p - h.Transpose() * h * 0.5), 0.0, 1.0e-12);
+   Rmatrix self = p;
+   self.AddProduct(self, self);
+   out.Put("---------- AddProduct with itself");
+   out.Validate(LinearAlgebraFixture::MaxDifference(self, p + p * p),
+         0.0, 1.0e-9);
+
+   bool thrown = false;
+   try
+   {
+      Rmatrix wrong = fixture.RandomMatrix(3, 4);
+      wrong.AddProduct(h, h);
+   }
+   catch (BaseException &)
+   {
+      thrown = true;
+   }
+   out.Put("---------- AddProduct dimension check");
+   out.Validate(thrown, true);
+}
+
+
+//------------------------------------------------------------------------------
+// void TestInverses(TestOutput &out)
+//------------------------------------------------------------------------------
+void TestInverses(TestOutput &out)
+{
+   out.Put("============================== test inverses");
+
+   for (Integer n = 10; n <= 70; n += 60)
+   {
+      Rmatrix spd = fixture.SpdMatrix(n), gen = fixture.RandomMatrix(n, n);
+      Rmatrix eye(n, n);
+      for (Integer i = 0; i < n; ++i)
+      {
+         eye(i, i) = 1.0;
+         gen(i, i) += 4.0;
+      }
+      std::string size = " " + std::to_string(n) + " x " + std::to_string(n);
+
+      Rmatrix inv = spd;
+      CholeskyFactorization cf;
+      cf.Invert(inv);
+      out.Put("---------- Cholesky" + size);
+      out.Validate(LinearAlgebraFixture::MaxDifference(spd * inv, eye),
+            0.0, 1.0e-10);
+
+      Rmatrix r(n, n);
+      cf.Factor(spd, r);
+      out.Put("---------- Cholesky factor" + size);
+      out.Validate(LinearAlgebraFixture::MaxDifference(
+            TransposeTimesMatrix(r, r), spd), 0.0, 1.0e-10);
+
+      inv = gen;
+      LUFactorization lu;
+      lu.Invert(inv);
+      out.Put("---------- LU" + size);
+      out.Validate(LinearAlgebraFixture::MaxDifference(gen * inv, eye),
+            0.0, 1.0e-10);
+
+      Rvector rhs(n), x(n);
+      for (Integer i = 0; i < n; ++i)
+         rhs[i] = 1.0 + i;
+      lu.SolveSystem(gen, rhs, x);
+      Rvector resid = gen * x - rhs;
+      out.Put("---------- LU solve" + size);
+      out.Validate(resid.GetMagnitude(), 0.0, 1.0e-10);
+
+      inv = gen;
+      QRFactorization qr;
+      qr.Invert(inv);
+      out.Put("---------- QR" + size);
+      out.Validate(LinearAlgebraFixture::MaxDifference(gen * inv, eye),
+            0.0, 1.0e-10);
+   }
+}
+
+
+//------------------------------------------------------------------------------
+// int main()
+//------------------------------------------------------------------------------
+int main()
+{
+   TestOutput out("TestMatrixKernelsOut.txt");
+   out.Put(GmatMatrixUtil::IsBlasAvailable() ? "BLAS build" : "Native kernels");
+
+   try
+   {
+      TestProducts(out);
+      TestFusedForms(out);
+      TestInverses(out);
+      out.Put("\nSuccessfully ran unit testing of the matrix kernels!!");
+   }
+   catch (BaseException &e)
+   {
+      out.Put(e.GetFullMessage());
+      out.Close();
+      return 1;
+   }
+
+   out.Close();
+   return 0;
+}
@@ -0,0 +1,364 @@
+//$Id$
+//------------------------------------------------------------------------------
+//                               TestUDFilter
+//------------------------------------------------------------------------------
+// GMAT: General Mission Analysis Tool
+//
+// Copyright (c) 2002 - 2020 United States Government as represented by the
+// Administrator of the National Aeronautics and Space Administration.
+// All Other Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// You may not use this file except in compliance with the License.
+// You may obtain a copy of the License at:
+// http://www.apache.org/licenses/LICENSE-2.0.
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied.   See the License for the specific language
+// governing permissions and limitations under the License.
+//
+// Author: GMAT Development Team
+// Created: 2026/10/17
+//
+/**
+ * Unit test program comparing the U-D covariance filter kernels in
+ * UDFactorization with the standard, P = (I - K H) Pbar, and Joseph forms of
+ * the covariance measurement update.
+ *
+ * A filter with 20 and with 50 state elements processes scalar measurements
+ * between time updates.  In a well conditioned case each form is compared with
+ * the Joseph form evaluated in long double.  In a case with a diffuse prior
+ * and very precise measurements the program reports which forms keep the
+ * covariance positive definite; the U-D form must.  The update rates are
+ * measured by the Covariance benchmarks of gmat_bench.
+ */
+//------------------------------------------------------------------------------
+
+#include "utildefs.hpp"
+#include "Rmatrix.hpp"
+#include "Rvector.hpp"
+#include "UDFactorization.hpp"
+#include "BaseException.hpp"
+#include "LinearAlgebraFixture.hpp"
+#include "TestOutput.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <vector>
+
+typedef std::vector<long double> LongArray;
+
+
+//------------------------------------------------------------------------------
+// void RunReference(const FilterProblem &prob, LongArray &p)
+//------------------------------------------------------------------------------
+/**
+ * Joseph form filter in long double
+ */
+//------------------------------------------------------------------------------
+void RunReference(const FilterProblem &prob, LongArray &p)
+{
+   Integer n = prob.n;
+   p.assign(prob.p0.begin(), prob.p0.end());
+   LongArray t(n * n), ph(n), k(n), a(n * n);
+
+   for (Integer s = 0; s < prob.steps; ++s)
+   {
+      // P = Phi P Phi^T + Q
+      for (Integer i = 0; i < n; ++i)
+         for (Integer j = 0; j < n; ++j)
+         {
+            long double sum = 0.0L;
+            for (Integer l = 0; l < n; ++l)
+               sum += prob.phi[i * n + l] * p[l * n + j];
+            t[i * n + j] = sum;
+         }
+      for (Integer i = 0; i < n; ++i)
+         for (Integer j = 0; j < n; ++j)
+         {
+            long double sum = prob.q[i * n + j];
+            for (Integer l = 0; l < n; ++l)
+               sum += t[i * n + l] * prob.phi[j * n + l];
+            p[i * n + j] = sum;
+         }
+
+      for (Integer m = 0; m < prob.measPerStep; ++m)
+      {
+         const Real *h = &prob.h[(s * prob.measPerStep + m) * n];
+         long double alpha = prob.r;
+         for (Integer i = 0; i < n; ++i)
+         {
+            long double sum = 0.0L;
+            for (Integer j = 0; j < n; ++j)
+               sum += p[i * n + j] * h[j];
+            ph[i] = sum;
+            alpha += h[i] * sum;
+         }
+         for (Integer i = 0; i < n; ++i)
+            k[i] = ph[i] / alpha;
+
+         // A = (I - K h) P, then P = A (I - K h)^T + K r K^T
+         for (Integer i = 0; i < n; ++i)
+            for (Integer j = 0; j < n; ++j)
+               a[i * n + j] = p[i * n + j] - k[i] * ph[j];
+         for (Integer i = 0; i < n; ++i)
+         {
+            long double ah = 0.0L;
+            for (Integer l = 0; l < n; ++l)
+               ah += a[i * n + l] * h[l];
+            for (Integer j = 0; j < n; ++j)
+               t[i * n + j] = a[i * n + j] - ah * k[j] +
+                     k[i] * prob.r * k[j];
+         }
+         p.swap(t);
+      }
+   }
+}
+
+
+//------------------------------------------------------------------------------
+// void RunMatrix(const FilterProblem &prob, bool joseph, Rmatrix &P)
+//------------------------------------------------------------------------------
+/**
+ * Filter using Rmatrix arithmetic, as in ExtendedKalmanFilter's
+ * UpdateCovarianceSimple() and UpdateCovarianceJoseph()
+ */
+//------------------------------------------------------------------------------
+void RunMatrix(const FilterProblem &prob, bool joseph, Rmatrix &P)
+{
+   Integer n = prob.n;
+   Rmatrix phi(n, n), Q(n, n), I = Rmatrix::Identity(n), R(1, 1), H(1, n);
+   P.SetSize(n, n);
+   for (Integer i = 0; i < n; ++i)
+      for (Integer j = 0; j < n; ++j)
+      {
+         P(i, j) = prob.p0[i * n + j];
+         phi(i, j) = prob.phi[i * n + j];
+         Q(i, j) = prob.q[i * n + j];
+      }
+   R(0, 0) = prob.r;
+
+   for (Integer s = 0; s < prob.steps; ++s)
+   {
+      P = phi * P * phi.Transpose() + Q;
+
+      for (Integer m = 0; m < prob.measPerStep; ++m)
+      {
+         const Real *h = &prob.h[(s * prob.measPerStep + m) * n];
+         for (Integer i = 0; i < n; ++i)
+            H(0, i) = h[i];
+
+         Rmatrix K = P * H.Transpose() * (H * P * H.Transpose() + R).Inverse();
+         if (joseph)
+            P = ((I - (K * H)) * P * (I - (K * H)).Transpose()) +
+                  (K * R * K.Transpose());
+         else
+            P = (I - (K * H)) * P;
+      }
+   }
+}
+
+
+//------------------------------------------------------------------------------
+// void RunUD(const FilterProblem &prob, RealArray &p, bool &positive)
+//------------------------------------------------------------------------------
+/**
+ * Filter using the U-D kernels
+ */
+//------------------------------------------------------------------------------
+void RunUD(const FilterProblem &prob, RealArray &p, bool &positive)
+{
+   Integer n = prob.n;
+   RealArray u(n * n), d(n), qu(n * n), w(2 * n * n), dw(2 * n), gain(n),
+         work(2 * n);
+
+   positive = UDFactorization::Factor(prob.p0.data(), n, u.data(), d.data());
+   UDFactorization::Factor(prob.q.data(), n, qu.data(), &dw[n]);
+
+   for (Integer s = 0; s < prob.steps; ++s)
+   {
+      for (Integer i = 0; i < n; ++i)
+      {
+         for (Integer k = 0; k < n; ++k)
+         {
+            Real sum = prob.phi[i * n + k];
+            for (Integer l = 0; l < k; ++l)
+               sum += prob.phi[i * n + l] * u[l * n + k];
+            w[i * 2 * n + k] = sum;
+            w[i * 2 * n + n + k] = qu[i * n + k];
+         }
+         dw[i] = d[i];
+      }
+      UDFactorization::TimeUpdate(w.data(), dw.data(), n, 2 * n, u.data(),
+            d.data(), work.data());
+
+      for (Integer m = 0; m < prob.measPerStep; ++m)
+         UDFactorization::MeasurementUpdate(u.data(), d.data(), n,
+               &prob.h[(s * prob.measPerStep + m) * n], prob.r, gain.data(),
+               work.data());
+
+      for (Integer i = 0; i < n; ++i)
+         if (!(d[i] > 0.0))
+            positive = false;
+   }
+
+   p.resize(n * n);
+   UDFactorization::Compose(u.data(), d.data(), n, p.data());
+}
+
+
+//------------------------------------------------------------------------------
+// Real RelativeError(const RealArray &p, const LongArray &ref, Integer n)
+//------------------------------------------------------------------------------
+/**
+ * Largest error of the covariance, relative to the reference sigmas:
+ * max |P_ij - Pref_ij| / sqrt(Pref_ii Pref_jj)
+ */
+//------------------------------------------------------------------------------
+Real RelativeError(const RealArray &p, const LongArray &ref, Integer n)
+{
+   Real worst = 0.0;
+   for (Integer i = 0; i < n; ++i)
+      for (Integer j = 0; j < n; ++j)
+      {
+         long double scale = std::sqrt(ref[i * n + i] * ref[j * n + j]);
+         Real err = (Real)(std::fabs(p[i * n + j] - ref[i * n + j]) / scale);
+         if (!(err <= worst))
+            worst = err;
+      }
+   return worst;
+}
+
+
+//------------------------------------------------------------------------------
+// bool IsPositiveDefinite(const RealArray &p, Integer n)
+//------------------------------------------------------------------------------
+bool IsPositiveDefinite(const RealArray &p, Integer n)
+{
+   RealArray u(n * n), d(n);
+   return UDFactorization::Factor(p.data(), n, u.data(), d.data());
+}
+
+
+//------------------------------------------------------------------------------
+// void RunCase(TestOutput &out, const std::string &label,
+//              const FilterProblem &prob, bool compare)
+//------------------------------------------------------------------------------
+/**
+ * Runs the three forms on a problem and checks the U-D form
+ *
+ * @param compare true to compare the forms with the long double reference,
+ *                false to check only that the covariance stays positive
+ *                definite
+ */
+//------------------------------------------------------------------------------
+void RunCase(TestOutput &out, const std::string &label,
+      const FilterProblem &prob, bool compare)
+{
+   Integer n = prob.n;
+   out.Put("---------- " + label + ", n = ", n, ", scalar updates = ",
+           prob.steps * prob.measPerStep);
+
+   Rmatrix P;
+   RunMatrix(prob, false, P);
+   RealArray standard = LinearAlgebraFixture::ToArray(P);
+   RunMatrix(prob, true, P);
+   RealArray joseph = LinearAlgebraFixture::ToArray(P);
+   RealArray ud;
+   bool udPositive;
+   RunUD(prob, ud, udPositive);
+
+   if (compare)
+   {
+      LongArray ref;
+      RunReference(prob, ref);
+
+      out.Put("Standard form error relative to the reference sigmas = ",
+              RelativeError(standard, ref, n));
+      out.Put("Joseph form error relative to the reference sigmas   = ",
+              RelativeError(joseph, ref, n));
+      out.Put("U-D form error relative to the reference sigmas should be "
+              "below 1e-9");
+      out.Validate(RelativeError(ud, ref, n), 0.0, 1.0e-9);
+      out.Put("U-D covariance should be positive definite");
+      out.Validate(udPositive, true);
+      return;
+   }
+
+   out.Put("Standard form covariance positive definite: ",
+           IsPositiveDefinite(standard, n));
+   out.Put("Joseph form covariance positive definite:   ",
+           IsPositiveDefinite(joseph, n));
+   out.Put("U-D covariance should be positive definite");
+   out.Validate(udPositive, true);
+}
+
+
+//------------------------------------------------------------------------------
+//int RunTest(TestOutput &out)
+//------------------------------------------------------------------------------
+int RunTest(TestOutput &out)
+{
+   LinearAlgebraFixture fixture;
+   Integer sizes[] = { 20, 50 };
+
+   out.Put("============================== test U-D covariance updates");
+   for (Integer i = 0; i < 2; ++i)
+   {
+      Integer n = sizes[i];
+
+      // Well conditioned: all forms agree
+      FilterProblem prob = fixture.MakeFilterProblem(n, 200, 1.0, 1.0e-2);
+      RunCase(out, "Well conditioned", prob, true);
+
+      // Prior sigmas spread over 8 decades and precise measurements.  The
+      // posterior is too sensitive to rounding for a reference comparison;
+      // the U-D factors must keep it positive definite.
+      prob = fixture.MakeFilterProblem(n, 200, 8.0, 1.0e-14);
+      RunCase(out, "Ill conditioned", prob, false);
+   }
+
+   out.Put("============================== test UDFactorization Factor() and "
+           "Invert()");
+   Rmatrix P = LinearAlgebraFixture::ToMatrix(fixture.Covariance(6, 1.0), 6);
+   Rmatrix U, D;
+   UDFactorization ud;
+   ud.Factor(P, U, D);
+   out.Put("---------- U D U^T should reproduce P");
+   out.Validate(LinearAlgebraFixture::MaxDifference(U * D * U.Transpose(), P),
+                0.0, 1.0e-12);
+
+   Rmatrix Pinv = P;
+   ud.Invert(Pinv);
+   out.Put("---------- P^-1 P should be the identity");
+   out.Validate(LinearAlgebraFixture::MaxDifference(Pinv * P,
+                Rmatrix::Identity(6)), 0.0, 1.0e-12);
+
+   return 1;
+}
+
+
+//------------------------------------------------------------------------------
+// int main()
+//------------------------------------------------------------------------------
+int main()
+{
+   TestOutput out("TestUDFilterOut.txt");
+
+   try
+   {
+      RunTest(out);
+      out.Put("\nSuccessfully ran unit testing of the U-D filter kernels!!");
+   }
+   catch (BaseException &e)
+   {
+      out.Put(e.GetFullMessage());
+      out.Close();
+      return 1;
+   }
+
+   out.Close();
+   return 0;
+}
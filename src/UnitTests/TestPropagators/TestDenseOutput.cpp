@@ -0,0 +1,250 @@
+//$Id$
+//------------------------------------------------------------------------------
+//                               TestDenseOutput
+//------------------------------------------------------------------------------
+// GMAT: General Mission Analysis Tool
+//
+// Copyright (c) 2002 - 2020 United States Government as represented by the
+// Administrator of the National Aeronautics and Space Administration.
+// All Other Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// You may not use this file except in compliance with the License.
+// You may obtain a copy of the License at:
+// http://www.apache.org/licenses/LICENSE-2.0.
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied.   See the License for the specific language
+// governing permissions and limitations under the License.
+//
+// Author: GMAT Development Team
+// Created: 2026/10/17
+//
+/**
+ * Unit test program for the dense output of the Runge-Kutta integrators.
+ *
+ * A two body orbit is propagated with Prince-Dormand 4(5), whose last stage is
+ * evaluated at the end state (first same as last), and with Runge-Kutta 8(9),
+ * which evaluates the end derivative on request.  The state interpolated at a
+ * stop epoch inside the last step is compared with the state reached by
+ * stepping exactly to the stop epoch.  The program also checks that a failed
+ * step leaves the dense output of the last accepted step unchanged.
+ */
+//------------------------------------------------------------------------------
+
+#include "gmatdefs.hpp"
+#include "PhysicalModel.hpp"
+#include "PrinceDormand45.hpp"
+#include "RungeKutta89.hpp"
+#include "PropagatorException.hpp"
+#include "TestOutput.hpp"
+
+#include <cmath>
+#include <iostream>
+
+
+//------------------------------------------------------------------------------
+// class KeplerModel
+//------------------------------------------------------------------------------
+/**
+ * Point mass gravity of the Earth on a single Cartesian state.  Derivative
+ * evaluations fail while failDerivatives is set.
+ */
+//------------------------------------------------------------------------------
+class KeplerModel : public PhysicalModel
+{
+public:
+   static const Real MU;
+
+   bool failDerivatives;
+
+   KeplerModel() :
+      PhysicalModel     (Gmat::PHYSICAL_MODEL, "KeplerModel"),
+      failDerivatives   (false)
+   {
+      dimension = 6;
+   }
+
+   virtual GmatBase* Clone() const
+   {
+      return new KeplerModel(*this);
+   }
+
+   virtual bool RenameRefObject(const UnsignedInt type,
+         const std::string &oldName, const std::string &newName)
+   {
+      return true;
+   }
+
+   virtual bool HasLocalClones()
+   {
+      return false;
+   }
+
+   virtual bool GetDerivatives(Real *state, Real dt = 0.0, Integer order = 1,
+         const Integer id = -1)
+   {
+      if (failDerivatives)
+         return false;
+
+      Real r = std::sqrt(state[0]*state[0] + state[1]*state[1] +
+                         state[2]*state[2]);
+      Real factor = -MU / (r * r * r);
+      for (Integer i = 0; i < 3; ++i)
+      {
+         deriv[i] = state[i + 3];
+         deriv[i + 3] = factor * state[i];
+      }
+      return true;
+   }
+};
+
+const Real KeplerModel::MU = 398600.4415;
+
+
+//------------------------------------------------------------------------------
+// Real PositionDifference(const Real *a, const Real *b)
+//------------------------------------------------------------------------------
+Real PositionDifference(const Real *a, const Real *b)
+{
+   Real sum = 0.0;
+   for (Integer i = 0; i < 3; ++i)
+      sum += (a[i] - b[i]) * (a[i] - b[i]);
+   return std::sqrt(sum);
+}
+
+
+//------------------------------------------------------------------------------
+// void SetUp(Propagator &prop, KeplerModel &model)
+//------------------------------------------------------------------------------
+/**
+ * Attaches the model to the integrator and sets an eccentric LEO state.
+ */
+//------------------------------------------------------------------------------
+void SetUp(Propagator &prop, KeplerModel &model)
+{
+   const Real state[6] = { 7100.0, 0.0, 1300.0, 0.0, 7.35, 1.0 };
+
+   prop.SetRealParameter("Accuracy", 1.0e-12);
+   prop.SetRealParameter("InitialStepSize", 60.0);
+   prop.SetRealParameter("MinStep", 1.0e-3);
+   prop.SetRealParameter("MaxStep", 120.0);
+   prop.SetPhysicalModel(&model);
+   prop.Initialize();
+   model.SetState(state);
+   model.SetTime(0.0);
+}
+
+
+//------------------------------------------------------------------------------
+// void RunCase(TestOutput &out, Propagator &stepped, Propagator &exact,
+//       const std::string &label)
+//------------------------------------------------------------------------------
+void RunCase(TestOutput &out, Propagator &stepped, Propagator &exact,
+             const std::string &label)
+{
+   const Real stopTime = 3000.0;
+   KeplerModel steppedModel, exactModel;
+
+   out.Put("============================== test " + label);
+   SetUp(stepped, steppedModel);
+   SetUp(exact, exactModel);
+
+   // Free steps until one crosses the stop epoch
+   Real stepStart = 0.0;
+   while (steppedModel.GetTime() < stopTime)
+   {
+      stepStart = steppedModel.GetTime();
+      if (!stepped.Step())
+         throw PropagatorException("The free step failed");
+   }
+   Real stepTaken = steppedModel.GetTime() - stepStart;
+
+   Real dense[6];
+   out.Put("---------- the stop epoch should be inside the last step");
+   out.Validate(stepped.CanInterpolate(stopTime), true);
+   out.Validate(stepped.GetDenseState(stopTime, dense), true);
+
+   // Exact stepping: the same free steps, then a step to the stop epoch
+   while (exactModel.GetTime() < stepStart)
+   {
+      if (!exact.Step())
+         throw PropagatorException("The free step failed");
+   }
+   if (!exact.Step(stopTime - exactModel.GetTime()))
+      throw PropagatorException("The step to the stop epoch failed");
+   const Real *exactState = exactModel.GetState();
+
+   // Cubic Hermite error bound, h^4 max|x''''| / 384, with the fourth
+   // derivative of the position bounded by n^4 a at perigee
+   Real r = std::sqrt(exactState[0]*exactState[0] +
+         exactState[1]*exactState[1] + exactState[2]*exactState[2]);
+   Real n4 = KeplerModel::MU * KeplerModel::MU / std::pow(6500.0, 6.0);
+   Real bound = std::pow(stepTaken, 4.0) * n4 * r / 384.0 * 4.0;
+   Real error = PositionDifference(dense, exactState);
+   out.Put("Last step (s) = ", stepTaken);
+   out.Put("Interpolation error (km) = ", error);
+   out.Put("---------- the interpolation error should be within the cubic "
+           "Hermite bound");
+   out.Validate(error <= bound, true);
+
+   // The end of the step is reproduced to rounding
+   Real endState[6];
+   out.Validate(stepped.GetDenseState(steppedModel.GetTime(), endState), true);
+   out.Put("---------- the end of the step should be the propagated state");
+   out.Validate(PositionDifference(endState, steppedModel.GetState()), 0.0,
+                1.0e-9);
+
+   // A failed step keeps the dense output of the accepted step
+   Real before[6], after[6];
+   Real midStep = stepStart + 0.5 * stepTaken;
+   stepped.GetDenseState(midStep, before);
+   steppedModel.failDerivatives = true;
+   bool failedStep = stepped.Step();
+   steppedModel.failDerivatives = false;
+   out.Put("---------- a step with failing derivatives should fail");
+   out.Validate(failedStep, false);
+   out.Put("---------- and leave the last accepted step in place");
+   out.Validate(stepped.GetDenseState(midStep, after), true);
+   out.Validate(PositionDifference(before, after), 0.0, 0.0);
+}
+
+
+//------------------------------------------------------------------------------
+// int RunTest(TestOutput &out)
+//------------------------------------------------------------------------------
+int RunTest(TestOutput &out)
+{
+   PrinceDormand45 pd45, pd45Exact;
+   RunCase(out, pd45, pd45Exact, "Prince-Dormand 4(5), first same as last");
+
+   RungeKutta89 rk89, rk89Exact;
+   RunCase(out, rk89, rk89Exact, "Runge-Kutta 8(9)");
+
+   return 1;
+}
+
+
+//------------------------------------------------------------------------------
+// int main()
+//------------------------------------------------------------------------------
+int main()
+{
+   TestOutput out("TestDenseOutputOut.txt");
+
+   try
+   {
+      RunTest(out);
+      out.Put("\nSuccessfully ran unit testing of the dense output!!");
+   }
+   catch (BaseException &e)
+   {
+      out.Put(e.GetFullMessage());
+      out.Close();
+      return 1;
+   }
+
+   out.Close();
+   return 0;
+}
@@ -0,0 +1,312 @@
+//$Id$
+//------------------------------------------------------------------------------
+//                             TestFixedSizeStorage
+//------------------------------------------------------------------------------
+// GMAT: General Mission Analysis Tool
+//
+// Copyright (c) 2002 - 2020 United States Government as represented by the
+// Administrator of the National Aeronautics and Space Administration.
+// All Other Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// You may not use this file except in compliance with the License.
+// You may obtain a copy of the License at:
+// http://www.apache.org/licenses/LICENSE-2.0.
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied.   See the License for the specific language
+// governing permissions and limitations under the License.
+//
+// Author: GMAT Development Team
+// Created: 2026/10/17
+//
+/**
+ * Unit test program for the inline element storage of Rvector3, Rvector6,
+ * Rmatrix33 and Rmatrix66, and for the move operations of Rvector and Rmatrix.
+ *
+ * The products of the fixed size classes are compared with the same products
+ * formed with the general Rmatrix and Rvector classes.  Copies, conversions
+ * from general matrices, resizing to another size and moves are exercised;
+ * the program is meant to be run under an address sanitizer as well.
+ */
+//------------------------------------------------------------------------------
+
+#include "utildefs.hpp"
+#include "Rvector.hpp"
+#include "Rvector3.hpp"
+#include "Rvector6.hpp"
+#include "Rmatrix.hpp"
+#include "Rmatrix33.hpp"
+#include "Rmatrix66.hpp"
+#include "BaseException.hpp"
+#include "LinearAlgebraFixture.hpp"
+#include "TestOutput.hpp"
+
+#include <utility>
+
+/// Largest allowed relative difference of the fixed size and general results
+const Real TOL = 1.0e-12;
+
+/// Source of the general matrices
+static LinearAlgebraFixture fixture;
+
+
+//------------------------------------------------------------------------------
+// Rmatrix General(Integer n)
+//------------------------------------------------------------------------------
+/**
+ * Returns a random, diagonally dominant n x n matrix
+ */
+//------------------------------------------------------------------------------
+Rmatrix General(Integer n)
+{
+   Rmatrix m = fixture.RandomMatrix(n, n);
+   for (Integer i = 0; i < n; ++i)
+      m(i,i) += 4.0;
+   return m;
+}
+
+
+//------------------------------------------------------------------------------
+// Real Diff(const Rmatrix &a, const Rmatrix &b)
+//------------------------------------------------------------------------------
+/**
+ * Returns the largest relative difference of two results, or 1 when their
+ * sizes differ
+ */
+//------------------------------------------------------------------------------
+Real Diff(const Rmatrix &a, const Rmatrix &b)
+{
+   if ((a.GetNumRows() != b.GetNumRows()) ||
+       (a.GetNumColumns() != b.GetNumColumns()))
+      return 1.0;
+   return LinearAlgebraFixture::MaxRelativeDifference(a, b);
+}
+
+
+//------------------------------------------------------------------------------
+// Real Diff(const Rvector &a, const Rvector &b)
+//------------------------------------------------------------------------------
+Real Diff(const Rvector &a, const Rvector &b)
+{
+   if (a.GetSize() != b.GetSize())
+      return 1.0;
+   RealArray va(a.GetDataVector(), a.GetDataVector() + a.GetSize());
+   RealArray vb(b.GetDataVector(), b.GetDataVector() + b.GetSize());
+   return LinearAlgebraFixture::MaxRelativeDifference(va, vb);
+}
+
+
+//------------------------------------------------------------------------------
+// void TestRmatrix33(TestOutput &out)
+//------------------------------------------------------------------------------
+void TestRmatrix33(TestOutput &out)
+{
+   out.Put("============================== test Rmatrix33");
+
+   Rmatrix ga = General(3), gb = General(3);
+   Rmatrix33 a(ga), b(gb);
+   Rvector gv(3, 1.0, -2.0, 0.5);
+   Rvector3 v(1.0, -2.0, 0.5);
+
+   out.Put("---------- conversion from Rmatrix");
+   out.Validate(Diff(a, ga), 0.0, TOL);
+   out.Put("---------- product");
+   out.Validate(Diff(a * b, ga * gb), 0.0, TOL);
+   out.Put("---------- sum and difference");
+   out.Validate(Diff(a + b - b * 2.0, ga + gb - gb * 2.0), 0.0, TOL);
+   out.Put("---------- transpose products");
+   out.Validate(Diff(TransposeTimesMatrix(a, b), ga.Transpose() * gb), 0.0,
+                TOL);
+   out.Validate(Diff(MatrixTimesTranspose(a, b), ga * gb.Transpose()), 0.0,
+                TOL);
+   out.Validate(Diff(TransposeTimesTranspose(a, b),
+                     ga.Transpose() * gb.Transpose()), 0.0, TOL);
+   out.Put("---------- inverse");
+   out.Validate(Diff(a.Inverse() * a, Rmatrix33()), 0.0, TOL);
+   out.Put("---------- matrix times vector");
+   out.Validate(Diff(a * v, ga * gv), 0.0, TOL);
+   // Rvector3 * Rmatrix33 has always formed the matrix times the vector
+   out.Put("---------- vector times matrix");
+   out.Validate(Diff(v * a, ga * gv), 0.0, TOL);
+
+   Rmatrix33 c(a);
+   c(0,0) = 100.0;
+   out.Put("---------- copies do not share elements");
+   out.Validate((a(0,0) != 100.0) && (c(0,0) == 100.0), true);
+   c = b;
+   out.Put("---------- assignment");
+   out.Validate(Diff(c, gb), 0.0, TOL);
+
+   c.SetSize(4, 4);
+   c(3,3) = 1.0;
+   out.Put("---------- resize to another size");
+   out.Validate((c.GetNumRows() == 4) && (c(3,3) == 1.0), true);
+   Rmatrix33 d(c);
+   out.Put("---------- copy of a resized matrix");
+   out.Validate((d.GetNumRows() == 4) && (d(3,3) == 1.0), true);
+   Rmatrix g4 = General(4);
+   d = g4;
+   out.Put("---------- assignment of a general matrix");
+   out.Validate(Diff(d, g4), 0.0, TOL);
+
+   bool thrown = false;
+   try
+   {
+      Rmatrix unsized;
+      Rmatrix33 e(unsized);
+   }
+   catch (BaseException &)
+   {
+      thrown = true;
+   }
+   out.Put("---------- conversion from an unsized matrix throws");
+   out.Validate(thrown, true);
+}
+
+
+//------------------------------------------------------------------------------
+// void TestRmatrix66(TestOutput &out)
+//------------------------------------------------------------------------------
+void TestRmatrix66(TestOutput &out)
+{
+   out.Put("============================== test Rmatrix66");
+
+   Rmatrix ga = General(6), gb = General(6);
+   Rmatrix66 a(ga), b(gb);
+   Rvector gv(6, 1.0, -2.0, 0.5, 3.0, -0.25, 2.0);
+   Rvector6 v(1.0, -2.0, 0.5, 3.0, -0.25, 2.0);
+
+   out.Put("---------- conversion from Rmatrix");
+   out.Validate(Diff(a, ga), 0.0, TOL);
+   out.Put("---------- product");
+   out.Validate(Diff(a * b, ga * gb), 0.0, TOL);
+   out.Put("---------- difference");
+   out.Validate(Diff(a - b, ga - gb), 0.0, TOL);
+   out.Put("---------- transpose products");
+   out.Validate(Diff(TransposeTimesMatrix(a, b), ga.Transpose() * gb), 0.0,
+                TOL);
+   out.Validate(Diff(MatrixTimesTranspose(a, b), ga * gb.Transpose()), 0.0,
+                TOL);
+   out.Validate(Diff(TransposeTimesTranspose(a, b),
+                     ga.Transpose() * gb.Transpose()), 0.0, TOL);
+   out.Put("---------- trace and transpose");
+   out.Validate(a.Trace(), ga.Trace(), TOL);
+   out.Validate(Diff(a.Transpose(), ga.Transpose()), 0.0, TOL);
+   out.Put("---------- matrix times vector");
+   out.Validate(Diff(a * v, ga * gv), 0.0, TOL);
+
+   Rmatrix66 c(a);
+   c = b;
+   out.Put("---------- assignment");
+   out.Validate(Diff(c, gb), 0.0, TOL);
+   Rmatrix33 upper = a.UpperRight();
+   out.Put("---------- sub-matrix");
+   out.Validate(upper(1,2) == ga(1,5), true);
+}
+
+
+//------------------------------------------------------------------------------
+// void TestVectors(TestOutput &out)
+//------------------------------------------------------------------------------
+void TestVectors(TestOutput &out)
+{
+   out.Put("============================== test Rvector3 and Rvector6");
+
+   Rvector3 r(1.0, 2.0, 3.0), s(-1.0, 0.5, 2.0);
+   out.Put("---------- cross product");
+   out.Validate(Diff(Cross(r, s), Rvector3(2.5, -5.0, 2.5)), 0.0, TOL);
+   Rvector3 t(r);
+   t[0] = 7.0;
+   out.Put("---------- copies do not share elements");
+   out.Validate((r[0] == 1.0) && (t[0] == 7.0), true);
+
+   Rvector6 state(1.0, 2.0, 3.0, 4.0, 5.0, 6.0);
+   state.SetV(Rvector3(-4.0, -5.0, -6.0));
+   out.Put("---------- SetV");
+   out.Validate(Diff(state, Rvector6(1.0, 2.0, 3.0, -4.0, -5.0, -6.0)), 0.0,
+                TOL);
+   out.Put("---------- dot product");
+   out.Validate(state * state == 91.0, true);
+
+   Rvector6 grown(state);
+   grown.SetSize(8);
+   grown[7] = 1.0;
+   out.Put("---------- resize to another size");
+   out.Validate((grown.GetSize() == 8) && (grown[7] == 1.0), true);
+   Rvector6 copy(grown);
+   out.Put("---------- copy of a resized vector");
+   out.Validate((copy.GetSize() == 8) && (copy[7] == 1.0), true);
+}
+
+
+//------------------------------------------------------------------------------
+// void TestMoves(TestOutput &out)
+//------------------------------------------------------------------------------
+void TestMoves(TestOutput &out)
+{
+   out.Put("============================== test Rvector and Rmatrix moves");
+
+   Rvector v(4, 1.0, 2.0, 3.0, 4.0);
+   const Real *storage = v.GetDataVector();
+   Rvector w(std::move(v));
+   out.Put("---------- move constructor takes the elements");
+   out.Validate((w.GetDataVector() == storage) && !v.IsSized(), true);
+
+   Rvector x(4);
+   x = std::move(w);
+   out.Put("---------- move assignment takes the elements");
+   out.Validate(x.GetDataVector() == storage, true);
+
+   Rmatrix m = General(5);
+   const Real *mstorage = m.GetDataVector();
+   Rmatrix n(std::move(m));
+   out.Put("---------- matrix move constructor");
+   out.Validate((n.GetDataVector() == mstorage) && !m.IsSized(), true);
+
+   bool thrown = false;
+   try
+   {
+      Rmatrix wrong(2, 3);
+      wrong = std::move(n);
+   }
+   catch (BaseException &)
+   {
+      thrown = true;
+   }
+   out.Put("---------- move assignment keeps the dimension check");
+   out.Validate(thrown, true);
+
+   Rvector3 fixed(1.0, 2.0, 3.0);
+   Rvector3 moved(std::move(fixed));
+   out.Put("---------- fixed size vectors are copied");
+   out.Validate((fixed[2] == 3.0) && (moved[2] == 3.0), true);
+}
+
+
+//------------------------------------------------------------------------------
+// int main()
+//------------------------------------------------------------------------------
+int main()
+{
+   TestOutput out("TestFixedSizeStorageOut.txt");
+
+   try
+   {
+      TestRmatrix33(out);
+      TestRmatrix66(out);
+      TestVectors(out);
+      TestMoves(out);
+      out.Put("\nSuccessfully ran unit testing of the fixed size storage!!");
+   }
+   catch (BaseException &e)
+   {
+      out.Put(e.GetFullMessage());
+      out.Close();
+      return 1;
+   }
+
+   out.Close();
+   return 0;
+}
@@ -42,6 +42,8 @@
 #include "ColorTypes.hpp"       // for GmatColor::
 #include "MessageInterface.hpp"
 #include "RgbColor.hpp"         // for ToIntColor()
+#include "WorkerPool.hpp"
+#include "SharedDataLock.hpp"
 #include <sstream>
 #include <cmath>
 
@@ -85,7 +87,7 @@
 //---------------------------------
 std::string Propagate::PropModeList[PropModeCount] =
 {
-   "", "Synchronized", "BackProp"
+   "", "Synchronized", "BackProp", "Parallel"
 };
 
 const std::string
@@ -167,6 +169,7 @@ Propagate::Propagate() :
    cartDim                     (0),
    singleStepMode              (false),
    currentMode                 (INDEPENDENT),
+   runParallel                 (false),
    stopCondEpochID             (-1),
    stopCondBaseEpochID         (-1),
    stopCondStopVarID           (-1),
@@ -282,6 +285,7 @@ Propagate::Propagate(const Propagate &prp) :
    cartDim                     (prp.cartDim),
    singleStepMode              (prp.singleStepMode),
    currentMode                 (prp.currentMode),
+   runParallel                 (prp.runParallel),
    stopCondEpochID             (prp.stopCondEpochID),
    stopCondBaseEpochID         (prp.stopCondBaseEpochID),
    stopCondStopVarID           (prp.stopCondStopVarID),
@@ -349,6 +353,7 @@ Propagate& Propagate::operator=(const Propagate &prp)
    cartDim                 = prp.cartDim;
    singleStepMode          = prp.singleStepMode;
    currentMode             = prp.currentMode;
+   runParallel             = prp.runParallel;
    stopCondEpochID         = prp.stopCondEpochID;
    stopCondBaseEpochID     = prp.stopCondBaseEpochID;
    stopCondStopVarID       = prp.stopCondStopVarID;
@@ -578,6 +583,9 @@ const std::string& Propagate::GetGeneratingString(Gmat::WriteMode mode,
 
    if (currentPropMode != "")
       gen += (" " + currentPropMode);
+
+   if (runParallel)
+      gen += (" Parallel");
    for (StringArray::iterator prop = propName.begin(); prop != propName.end();
         ++prop)
    {
@@ -1121,6 +1129,13 @@ bool Propagate::SetStringParameter(const Integer id, const std::string &value)
 {
    if (id == PROP_COUPLED)
    {
+      // Parallel stepping combines with any of the modes
+      if (value == PropModeList[PARALLEL])
+      {
+         runParallel = true;
+         return true;
+      }
+
       const StringArray pmodes = GetStringArrayParameter(AVAILABLE_PROP_MODES);
       if (find(pmodes.begin(), pmodes.end(), value) != pmodes.end())
       {
@@ -1224,8 +1239,8 @@ const StringArray& Propagate::GetStringArrayParameter(const Integer id) const
    if (id == AVAILABLE_PROP_MODES) {
       modeList.clear();
       for (Integer i = 0; i < PropModeCount; ++i)
-         // BackProp isn't really a prop sync mode
-         if (PropModeList[i] != "BackProp")
+         // BackProp and Parallel aren't really prop sync modes
+         if ((i != BACK_PROP) && (i != PARALLEL))
             modeList.push_back(PropModeList[i]);
       return modeList;
    }
@@ -2478,6 +2493,7 @@ void Propagate::CheckForOptions(Integer &loc, std::string &generatingString)
 {
    std::string modeStr;
    currentMode = INDEPENDENT;
+   runParallel = false;
 
    #ifdef DEBUG_PROPAGATE_ASSEMBLE
       MessageInterface::ShowMessage("Propagate::CheckForOptions(%d, %s) "
@@ -2509,6 +2525,10 @@ void Propagate::CheckForOptions(Integer &loc, std::string &generatingString)
                MessageInterface::ShowMessage("\nDirection is now %d\n", direction);
             #endif
          }
+         else if (modeId == PARALLEL)
+         {
+            runParallel = true;
+         }
          else
          {
             currentMode = (PropModes)modeId;
@@ -3450,6 +3470,9 @@ bool Propagate::Initialize()
          odem->SetState(psm->GetState());
          // Set solar system to ForceModel for Propagate inside a GmatFunction
          odem->SetSolarSystem(solarSys);
+         // Parallel runs give each model its own frames, so the nutation
+         // buffers do not depend on the order the PropSetups are stepped
+         odem->UseOwnCoordinateSystems(runParallel);
       }
       else
       {
@@ -3987,6 +4010,7 @@ void Propagate::PrepareToPropagate()
          if (propagators[n]->GetPropagator()->UsesODEModel())
          {
             fm.push_back(propagators[n]->GetODEModel());
+            fm[n]->SplitSpacecraft(runParallel);
             dim += fm[n]->GetDimension();
          }
          else
@@ -4745,6 +4769,13 @@ bool Propagate::TakeAStep(Real propStep)
                MessageInterface::ShowMessage
                   ("Propagate::TakeAStep() running in INDEPENDENT mode\n");
             #endif
+            if (runParallel && (p.size() > 1))
+            {
+               if (StepInParallel(0, 0.0, false) >= 0)
+                  throw CommandException(
+                     "Propagator failed to take a good step\n");
+               current = p.end();
+            }
             while (current != p.end())
             {
                if (!(*current)->Step())
@@ -4767,6 +4798,13 @@ bool Propagate::TakeAStep(Real propStep)
                                       "to take a good step\n");
             stepToTake = (*current)->GetStepTaken();
             ++current;
+            if (runParallel && (p.size() > 2))
+            {
+               if (StepInParallel(1, stepToTake, true) >= 0)
+                  throw CommandException("Propagator failed to take a good "
+                                         "synchronized step\n");
+               current = p.end();
+            }
             while (current != p.end())
             {
                if (!(*current)->Step(stepToTake))
@@ -4793,6 +4831,21 @@ bool Propagate::TakeAStep(Real propStep)
    }
    else
    {
+      if (runParallel && (p.size() > 1))
+      {
+         Integer failed = StepInParallel(0, propStep, true);
+         if (failed >= 0)
+         {
+            std::stringstream sizebuffer;
+            sizebuffer << propStep;
+            sizebuffer.precision(15);
+            throw CommandException("In Propagate::TakeAStep, Propagator " +
+               p[failed]->GetName() +
+               " failed to take a good final step (size = " + sizebuffer.str() + ")\n");
+         }
+         current = p.end();
+      }
+
       // Step all of the propagators by the input amount
       while (current != p.end())
       {
@@ -4868,6 +4921,65 @@ bool Propagate::TakeAStep(Real propStep)
 }
 
 
+//------------------------------------------------------------------------------
+// Integer StepInParallel(UnsignedInt start, Real stepSize, bool useStepSize)
+//------------------------------------------------------------------------------
+/**
+ * Steps the PropSetups from index start on concurrently.
+ *
+ * Each PropSetup owns its propagator, its ODEModel clone and, in parallel runs,
+ * clones of the coordinate systems its forces use, so the steps are
+ * independent and the tasks run unlocked.  The caches that all models share
+ * (the body ephemerides and the EOP data) take the SharedDataLock themselves
+ * while it is enabled.
+ *
+ * @param start       Index of the first PropSetup to step
+ * @param stepSize    The step size, used if useStepSize is true
+ * @param useStepSize true to take steps of stepSize, false to let the
+ *                    propagators choose their steps
+ *
+ * @return The index of the first PropSetup that failed to step, or -1
+ */
+//------------------------------------------------------------------------------
+Integer Propagate::StepInParallel(UnsignedInt start, Real stepSize,
+                                  bool useStepSize)
+{
+   Integer taskCount = (Integer)(p.size() - start);
+   // One flag per task; not vector<bool>, whose elements share words
+   std::vector<Integer> stepped(taskCount, 0);
+
+   #ifdef DEBUG_PROPAGATE_EXE
+      MessageInterface::ShowMessage("Propagate::StepInParallel(): stepping %d "
+            "PropSetups on %d threads\n", taskCount,
+            WorkerPool::Instance()->GetThreadCount());
+   #endif
+
+   SharedDataLock::Enable();
+   try
+   {
+      WorkerPool::Instance()->Run(taskCount, [&](Integer i)
+      {
+         Propagator *prop = p[start + i];
+         bool ok = (useStepSize ? prop->Step(stepSize) : prop->Step());
+         if (ok)
+            stepped[i] = 1;
+      });
+   }
+   catch (...)
+   {
+      SharedDataLock::Disable();
+      throw;
+   }
+   SharedDataLock::Disable();
+
+   for (Integer i = 0; i < taskCount; ++i)
+      if (stepped[i] == 0)
+         return (Integer)start + i;
+
+   return -1;
+}
+
+
 //------------------------------------------------------------------------------
 // void CheckStopConditions(Integer epochID)
 //------------------------------------------------------------------------------
@@ -5564,14 +5676,33 @@ Real Propagate::InterpolateToStop(StopCondition *sc)
    bool stopIsBracketed = false;
    Real elapsedSeconds = 0.0;
 
+   // The ring points inside the step that crossed the stop come from the
+   // integrators' dense output when every propagator has it for that step
+   Integer denseRingSteps = 4;
+   for (UnsignedInt i = 0; i < p.size(); ++i)
+      if (!p[i]->CanInterpolate(p[i]->GetTime() + denseRingSteps * ringStep))
+         denseRingSteps = 0;
+
+   #ifdef DEBUG_STOPPING_CONDITIONS
+      MessageInterface::ShowMessage("Filling ring buffer %s dense output\n",
+            (denseRingSteps > 0 ? "using" : "without"));
+   #endif
+
    while ((!stopIsBracketed) && (ringStepsTaken < 8))
    {
       #ifdef DEBUG_STOPPING_CONDITIONS
          MessageInterface::ShowMessage("Taking ring step %d, step size = "
                "%.12lf\n", ringStepsTaken, ringStep);
       #endif
+      if (ringStepsTaken < denseRingSteps)
+      {
+         for (UnsignedInt i = 0; i < p.size(); ++i)
+            if (!p[i]->InterpolateTo(p[i]->GetTime() + ringStep))
+               throw CommandException("Propagator failed to interpolate "
+                  "while filling ring buffer\n");
+      }
       // Take a fixed prop step
-      if (!TakeAStep(ringStep))
+      else if (!TakeAStep(ringStep))
          throw CommandException("Propagator Failed to Step fixed interval "
             "while filling ring buffer\n");
       elapsedSeconds += ringStep;
@@ -246,12 +246,14 @@ protected:
    /// Flag used to indicate that the first step logic must be executed
    bool                         checkFirstStep;
 
-   /// Allowed modes of propagation
+   /// Allowed modes of propagation; BACK_PROP and PARALLEL are options that
+   /// combine with the modes, listed here for their keywords
    enum PropModes
    {
       INDEPENDENT,
       SYNCHRONIZED,
       BACK_PROP,
+      PARALLEL,
       PropModeCount 
    };
 
@@ -277,6 +279,8 @@ protected:
    bool                    singleStepMode;
    /// Variable that tracks the current propagation mode
    PropModes               currentMode;
+   /// Flag indicating that the propagation is spread over the WorkerPool
+   bool                    runParallel;
    /// Bracketing timesteps used in the bisection method
    Real                    stepBrackets[2];
    
@@ -342,6 +346,8 @@ protected:
    virtual void            TakeFinalStep(Integer EpochID, Integer trigger);
    
    virtual bool            TakeAStep(Real propStep = 0.0);
+   Integer                 StepInParallel(UnsignedInt start, Real stepSize,
+                                          bool useStepSize);
    
    
 //------------------------------------------------------------------------------
@@ -44,8 +44,10 @@
 #include "MessageInterface.hpp"
 #include "CoordinateSystemException.hpp"
 #include "SolarSystem.hpp"
+#include "RotationMatrixCache.hpp"
 
 #include <iostream>
+#include <sstream>
 
 
 using namespace GmatMathUtil;           // for trig functions, etc.
@@ -129,6 +131,8 @@ coordName        (""),
 usesPrimary      (GmatCoordinate::NOT_USED),
 usesSecondary    (GmatCoordinate::NOT_USED),
 baseSystem       ("FK5"),
+rotationCacheId  (-1),
+rotationCacheGeneration (-1),
 eop              (NULL),
 itrf             (NULL),
 epochFormat      ("A1ModJulian"),
@@ -189,6 +193,8 @@ coordName         (axisSys.coordName),
 usesPrimary       (axisSys.usesPrimary),
 usesSecondary     (axisSys.usesSecondary),
 baseSystem        (axisSys.baseSystem),
+rotationCacheId   (-1),
+rotationCacheGeneration (-1),
 eop               (axisSys.eop),
 itrf              (axisSys.itrf),
 epochFormat       (axisSys.epochFormat),
@@ -247,6 +253,7 @@ const AxisSystem& AxisSystem::operator=(const AxisSystem &axisSys)
    usesPrimary       = axisSys.usesPrimary;
    usesSecondary     = axisSys.usesSecondary;
    baseSystem        = axisSys.baseSystem;
+   rotationCacheId   = -1;
    eop               = axisSys.eop;
    itrf              = axisSys.itrf;
    epochFormat       = axisSys.epochFormat;
@@ -703,6 +710,7 @@ void AxisSystem::SetZAxis(const std::string &toValue)
 void AxisSystem::SetEopFile(EopFile *eopF)
 {
    eop = eopF;
+   rotationCacheId = -1;
 }
 
 //------------------------------------------------------------------------------
@@ -718,6 +726,7 @@ void AxisSystem::SetEopFile(EopFile *eopF)
 void AxisSystem::SetCoefficientsFile(ItrfCoefficientsFile *itrfF)
 {
    itrf = itrfF;
+   rotationCacheId = -1;
 }
 
 //------------------------------------------------------------------------------
@@ -1056,6 +1065,8 @@ bool AxisSystem::Initialize()
    stData      = ST.GetDataVector();
    stDerivData = STderiv.GetDataVector();
    pmData      = PM.GetDataVector();
+   // The origin or EOP data may have changed; look the signature up again
+   rotationCacheId = -1;
    
    // Make sure to initialize the origin, if necessary
    InitializeReference(origin);
@@ -1082,7 +1093,7 @@ bool AxisSystem::RotateToBaseSystem(const A1Mjd &epoch, const Rvector &inState,
                                   Rvector &outState, 
                                   bool forceComputation)
 {
-   CalculateRotationMatrix(epoch, forceComputation);
+   UpdateRotationMatrix(epoch, forceComputation);
    bool retval = CompleteRotateToBase(inState, outState);
 
    #ifdef DEBUG_FIRST_CALL
@@ -1133,7 +1144,7 @@ bool AxisSystem::RotateToBaseSystem(const GmatTime &epoch, const Rvector &inStat
                                   Rvector &outState, 
                                   bool forceComputation)
 {
-   CalculateRotationMatrix(epoch, forceComputation);
+   UpdateRotationMatrix(epoch, forceComputation);
    bool retval = CompleteRotateToBase(inState, outState);
 
    #ifdef DEBUG_FIRST_CALL
@@ -1184,7 +1195,7 @@ bool AxisSystem::RotateToBaseSystem(const A1Mjd &epoch, const Real *inState,
                                   Real *outState,
                                   bool forceComputation)
 {
-   CalculateRotationMatrix(epoch, forceComputation);
+   UpdateRotationMatrix(epoch, forceComputation);
    bool retval = CompleteRotateToBase(inState, outState);
 
    #ifdef DEBUG_FIRST_CALL
@@ -1231,7 +1242,7 @@ bool AxisSystem::RotateToBaseSystem(const GmatTime &epoch, const Real *inState,
                                   Real *outState,
                                   bool forceComputation)
 {
-   CalculateRotationMatrix(epoch, forceComputation);
+   UpdateRotationMatrix(epoch, forceComputation);
    bool retval = CompleteRotateToBase(inState, outState);
 
    #ifdef DEBUG_FIRST_CALL
@@ -1284,7 +1295,7 @@ bool AxisSystem::RotateFromBaseSystem(const A1Mjd &epoch,
       MessageInterface::ShowMessage("Entering AxisSystem::RotateFromBaseSystem on object of type %s\n",
             (GetTypeName()).c_str());
    #endif
-   CalculateRotationMatrix(epoch, forceComputation);
+   UpdateRotationMatrix(epoch, forceComputation);
    #ifdef DEBUG_ROT_MATRIX
       MessageInterface::ShowMessage("In AxisSystem::rotateFromBaseSystem, DONE computing rotation matrix\n");
    #endif
@@ -1347,7 +1358,7 @@ bool AxisSystem::RotateFromBaseSystem(const GmatTime &epoch,
             (GetTypeName()).c_str());
    #endif
 
-   CalculateRotationMatrix(epoch, forceComputation);
+   UpdateRotationMatrix(epoch, forceComputation);
    #ifdef DEBUG_ROT_MATRIX
       MessageInterface::ShowMessage("In AxisSystem::rotateFromBaseSystem, DONE computing rotation matrix\n");
    #endif
@@ -1410,7 +1421,7 @@ bool AxisSystem::RotateFromBaseSystem(const A1Mjd &epoch,
             (GetTypeName()).c_str());
    #endif
 
-   CalculateRotationMatrix(epoch, forceComputation);
+   UpdateRotationMatrix(epoch, forceComputation);
    bool retval = CompleteRotateFromBase(inState, outState);
 
    #ifdef DEBUG_FIRST_CALL
@@ -1465,7 +1476,7 @@ bool AxisSystem::RotateFromBaseSystem(const GmatTime &epoch,
             (GetTypeName()).c_str());
    #endif
 
-   CalculateRotationMatrix(epoch, forceComputation);
+   UpdateRotationMatrix(epoch, forceComputation);
    bool retval = CompleteRotateFromBase(inState, outState);
 
    #ifdef DEBUG_FIRST_CALL
@@ -1508,10 +1519,10 @@ bool AxisSystem::RotateFromBaseSystem(const GmatTime &epoch,
 //------------------------------------------------------------------------------
 bool AxisSystem::CompleteRotateToBase(const Rvector &inState, Rvector &outState)
 {
-   static Rvector3 tmpPosVecTo;
-   static Rvector3 tmpVelVecTo;
-   static const Real  *tmpPosTo = tmpPosVecTo.GetDataVector();
-   static const Real  *tmpVelTo = tmpVelVecTo.GetDataVector();
+   static thread_local Rvector3 tmpPosVecTo;
+   static thread_local Rvector3 tmpVelVecTo;
+   static thread_local const Real  *tmpPosTo = tmpPosVecTo.GetDataVector();
+   static thread_local const Real  *tmpVelTo = tmpVelVecTo.GetDataVector();
    
    // *********** assuming only one 6-vector for now - UPDATE LATER!!!!!!
    tmpPosVecTo.Set(inState[0],inState[1], inState[2]);
@@ -1637,10 +1648,10 @@ bool AxisSystem::CompleteRotateToBase(const Real *inState, Real *outState)
 //------------------------------------------------------------------------------
 bool AxisSystem::CompleteRotateFromBase(const Rvector &inState, Rvector &outState)
 {
-   static Rvector3 tmpPosVec;
-   static Rvector3 tmpVelVec;
-   static const Real  *tmpPos = tmpPosVec.GetDataVector();
-   static const Real  *tmpVel = tmpVelVec.GetDataVector();
+   static thread_local Rvector3 tmpPosVec;
+   static thread_local Rvector3 tmpVelVec;
+   static thread_local const Real  *tmpPos = tmpPosVec.GetDataVector();
+   static thread_local const Real  *tmpVel = tmpVelVec.GetDataVector();
    
    // *********** assuming only one 6-vector for now - UPDATE LATER!!!!!!
    tmpPosVec.Set(inState[0],inState[1], inState[2]);
@@ -1761,6 +1772,136 @@ void AxisSystem::CalculateRotationMatrix(const GmatTime &atEpoch,
    CalculateRotationMatrix(A1Mjd(atEpoch.GetMjd()), forceComputation);
 }
 
+//------------------------------------------------------------------------------
+//  void UpdateRotationMatrix(const A1Mjd &atEpoch, bool forceComputation)
+//------------------------------------------------------------------------------
+/**
+ * Sets rotMatrix and rotDotMatrix for an epoch, taking them from the shared
+ * RotationMatrixCache when another axis system with the same configuration
+ * already computed them.
+ *
+ * @param atEpoch          epoch at which to compute the rotation matrix
+ * @param forceComputation flag to force the computation (bypasses the cache)
+ */
+//------------------------------------------------------------------------------
+void AxisSystem::UpdateRotationMatrix(const A1Mjd &atEpoch,
+                                      bool forceComputation)
+{
+   if (forceComputation || !UsesRotationCache())
+   {
+      CalculateRotationMatrix(atEpoch, forceComputation);
+      return;
+   }
+
+   // Register again after the cache dropped its signatures, e.g. because
+   // the EOP data was reloaded
+   RotationMatrixCache *cache = RotationMatrixCache::Instance();
+   if ((rotationCacheId < 0) ||
+       (rotationCacheGeneration != cache->GetGeneration()))
+      rotationCacheId = cache->RegisterAxes(GetRotationCacheKey(),
+                                            rotationCacheGeneration);
+
+   Real rot[9], rotDot[9];
+   if (cache->Find(rotationCacheId, atEpoch, rot, rotDot))
+   {
+      rotMatrix.Set(rot[0], rot[1], rot[2], rot[3], rot[4], rot[5],
+                    rot[6], rot[7], rot[8]);
+      rotDotMatrix.Set(rotDot[0], rotDot[1], rotDot[2], rotDot[3], rotDot[4],
+                       rotDot[5], rotDot[6], rotDot[7], rotDot[8]);
+      return;
+   }
+
+   // Cached axes do not depend on the previous call, so the forced
+   // computation matches the unforced one
+   CalculateRotationMatrix(atEpoch, true);
+   cache->Add(rotationCacheId, atEpoch, rotMatrix.GetDataVector(),
+              rotDotMatrix.GetDataVector());
+}
+
+//------------------------------------------------------------------------------
+//  void UpdateRotationMatrix(const GmatTime &atEpoch, bool forceComputation)
+//------------------------------------------------------------------------------
+/**
+ * @see UpdateRotationMatrix(const A1Mjd&, bool)
+ */
+//------------------------------------------------------------------------------
+void AxisSystem::UpdateRotationMatrix(const GmatTime &atEpoch,
+                                      bool forceComputation)
+{
+   if (forceComputation || !UsesRotationCache())
+   {
+      CalculateRotationMatrix(atEpoch, forceComputation);
+      return;
+   }
+
+   // Register again after the cache dropped its signatures, e.g. because
+   // the EOP data was reloaded
+   RotationMatrixCache *cache = RotationMatrixCache::Instance();
+   if ((rotationCacheId < 0) ||
+       (rotationCacheGeneration != cache->GetGeneration()))
+      rotationCacheId = cache->RegisterAxes(GetRotationCacheKey(),
+                                            rotationCacheGeneration);
+
+   Real rot[9], rotDot[9];
+   if (cache->Find(rotationCacheId, atEpoch, rot, rotDot))
+   {
+      rotMatrix.Set(rot[0], rot[1], rot[2], rot[3], rot[4], rot[5],
+                    rot[6], rot[7], rot[8]);
+      rotDotMatrix.Set(rotDot[0], rotDot[1], rotDot[2], rotDot[3], rotDot[4],
+                       rotDot[5], rotDot[6], rotDot[7], rotDot[8]);
+      return;
+   }
+
+   CalculateRotationMatrix(atEpoch, true);
+   cache->Add(rotationCacheId, atEpoch, rotMatrix.GetDataVector(),
+              rotDotMatrix.GetDataVector());
+}
+
+//------------------------------------------------------------------------------
+//  bool UsesRotationCache() const
+//------------------------------------------------------------------------------
+/**
+ * Indicates whether the rotation matrices of this axis system can be shared
+ * through the RotationMatrixCache.
+ *
+ * Derived classes return true only when the rotation is a pure function of the
+ * epoch and of the data in GetRotationCacheKey() - not, for example, when the
+ * nutation is held over an update interval, which makes the result depend on
+ * the previous call.
+ *
+ * @return false by default
+ */
+//------------------------------------------------------------------------------
+bool AxisSystem::UsesRotationCache() const
+{
+   return false;
+}
+
+//------------------------------------------------------------------------------
+//  std::string GetRotationCacheKey() const
+//------------------------------------------------------------------------------
+/**
+ * Returns the signature identifying everything besides the epoch that the
+ * rotation depends on.  Axis systems with equal signatures share cache
+ * entries.
+ *
+ * The data files are named rather than pointed to, so that a freed and reused
+ * address cannot match; a reload of the same file is caught by the cache's
+ * data version check.
+ *
+ * @return the signature
+ */
+//------------------------------------------------------------------------------
+std::string AxisSystem::GetRotationCacheKey() const
+{
+   std::stringstream key;
+   key << typeName << "|" << originName << "|" << baseSystem << "|"
+       << (eop == NULL ? "" : eop->GetFileName()) << "|"
+       << (itrf == NULL ? "" : itrf->GetNutationFileName()) << "|"
+       << (itrf == NULL ? "" : itrf->GetPlanetaryFileName());
+   return key.str();
+}
+
 //------------------------------------------------------------------------------
 // public methods inherited from GmatBase
 //------------------------------------------------------------------------------
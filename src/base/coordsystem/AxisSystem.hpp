@@ -211,6 +211,13 @@ protected:
    virtual bool CompleteRotateToBase(const Real *inState, Real *outState);
    virtual bool CompleteRotateFromBase(const Rvector &inState, Rvector &outState);
    virtual bool CompleteRotateFromBase(const Real *inState, Real *outState);
+
+   void                UpdateRotationMatrix(const A1Mjd &atEpoch,
+                                            bool forceComputation);
+   void                UpdateRotationMatrix(const GmatTime &atEpoch,
+                                            bool forceComputation);
+   virtual bool        UsesRotationCache() const;
+   virtual std::string GetRotationCacheKey() const;
    
    /// rotation matrix - 
    /// default constructor creates a 3x3 zero-matrix
@@ -244,6 +251,10 @@ protected:
    
    const Real *rotData;
    const Real *rotDotData;
+   /// Id in the RotationMatrixCache, or -1 until the first cached rotation
+   Integer    rotationCacheId;
+   /// RotationMatrixCache generation the id belongs to
+   Integer    rotationCacheGeneration;
 
    // data and methods for those AxisSystems that need all or part of the FK5 
    // reduction
@@ -31,6 +31,7 @@
 //------------------------------------------------------------------------------
 
 #include <iostream>
+#include <sstream>
 #include "gmatdefs.hpp"
 #include "GmatBase.hpp"
 #include "BodyFixedAxes.hpp"
@@ -829,7 +830,7 @@ void BodyFixedAxes::CalculateRotationMatrix(const GmatTime &atEpoch,
          Real R13[3][3];
          Real rotResult[3][3];
          Real rotDotResult[3][3];
-         static Rvector cartCoord(4);
+         static thread_local Rvector cartCoord(4);
          const Real *cartC = cartCoord.GetDataVector();
          #ifdef DEBUG_FIRST_CALL
             if (!firstCallFired)
@@ -955,3 +956,54 @@ void BodyFixedAxes::CalculateRotationMatrix(const GmatTime &atEpoch,
    #endif
 
 }
+
+//------------------------------------------------------------------------------
+//  bool UsesRotationCache() const
+//------------------------------------------------------------------------------
+/**
+ * Celestial body rotations are shared through the RotationMatrixCache.
+ * Spacecraft attitude is not a function of epoch alone, and the Earth
+ * rotation is shared only when the nutation is recomputed at every epoch.
+ *
+ * @return true if the rotation can be cached
+ */
+//------------------------------------------------------------------------------
+bool BodyFixedAxes::UsesRotationCache() const
+{
+   if ((origin == NULL) || !origin->IsOfType("CelestialBody"))
+      return false;
+
+   if (originName == GmatSolarSystemDefaults::EARTH_NAME)
+   {
+      Real interval = (overrideOriginInterval ? updateInterval :
+            ((Planet*) origin)->GetNutationUpdateInterval());
+      return (interval == 0.0);
+   }
+
+   return true;
+}
+
+//------------------------------------------------------------------------------
+//  std::string GetRotationCacheKey() const
+//------------------------------------------------------------------------------
+/**
+ * Adds the body's rotation data source, which selects the model used for
+ * bodies other than the Earth, and its orientation parameters, which differ
+ * between solar systems that name the same body.
+ *
+ * @return the signature
+ */
+//------------------------------------------------------------------------------
+std::string BodyFixedAxes::GetRotationCacheKey() const
+{
+   CelestialBody *body = (CelestialBody*)origin;
+   Rvector6 orientation = body->GetOrientationParameters();
+
+   std::stringstream key;
+   key.precision(17);
+   key << AxisSystem::GetRotationCacheKey() << "|"
+       << body->GetRotationDataSource();
+   for (Integer i = 0; i < 6; ++i)
+      key << "|" << orientation[i];
+   return key.str();
+}
@@ -89,6 +89,8 @@ protected:
    
    virtual void CalculateRotationMatrix(const A1Mjd &atEpoch,
                                         bool forceComputation = false);
+   virtual bool UsesRotationCache() const;
+   virtual std::string GetRotationCacheKey() const;
    
    virtual void CalculateRotationMatrix(const GmatTime &atEpoch,
                                         bool forceComputation = false);
@@ -41,6 +41,8 @@
 #include "TimeTypes.hpp"
 #include "ICRFFile.hpp"
 #include "MessageInterface.hpp"
+#include <cstring>
+#include <unordered_map>
 
 //#define DEBUG_FIRST_CALL
 //#define DEBUG_TO_FROM
@@ -712,6 +714,152 @@ bool CoordinateConverter::Convert(const GmatTime &epoch, const Real *inState,
 }
 
 
+//------------------------------------------------------------------------------
+// bool Convert(const Integer count, const Real *epochs, const Real *inStates,
+//              CoordinateSystem *inCoord, Real *outStates,
+//              CoordinateSystem *outCoord, bool forceComputation = false,
+//              bool omitTranslation = false)
+//------------------------------------------------------------------------------
+/**
+ * Converts a set of states from the inCoord CoordinateSystem to the outCoord
+ * CoordinateSystem.
+ *
+ * State i is inStates[6*i] ... inStates[6*i+5], at A1 MJD epochs[i]; the
+ * result goes to the same place in outStates, which the caller allocates
+ * (6 * count Reals, and may be inStates).  The coordinate systems are
+ * evaluated once for each distinct epoch, in the order the epochs first
+ * appear, which gives the same axis update behavior as calling the single
+ * state Convert() in that order.  The resulting translation and rotation are
+ * then applied to every state at that epoch.
+ *
+ * @param count            number of states
+ * @param epochs           count A1 MJD epochs
+ * @param inStates         6 * count input state elements (in inCoord system)
+ * @param inCoord          pointer to the input CoordinateSystem
+ * @param outStates        6 * count output state elements (in outCoord system)
+ * @param outCoord         pointer to the output CoordinateSystem
+ * @param forceComputation force the computation whether it's time to do
+ *                         it or not (default is false)
+ * @param omitTranslation  omit the translation whether coincident or not
+ *                         (default is false)
+ *
+ * @return true if successful; false otherwise.
+ */
+//------------------------------------------------------------------------------
+bool CoordinateConverter::Convert(const Integer count, const Real *epochs,
+                          const Real *inStates, CoordinateSystem *inCoord,
+                          Real *outStates, CoordinateSystem *outCoord,
+                          bool forceComputation, bool omitTranslation)
+{
+   if ((!inCoord) || (!outCoord))
+      throw CoordinateSystemException(
+         "Undefined coordinate system - conversion not performed.");
+
+   if (count <= 0)
+      return true;
+
+   if (inCoord->GetName() == outCoord->GetName())
+   {
+      if (outStates != inStates)
+         memcpy(outStates, inStates, 6 * count * sizeof(Real));
+      lastRotMatrix.Set(1.0,0.0,0.0,0.0,1.0,0.0,0.0,0.0,1.0);
+      return true;
+   }
+
+   std::string inBaseName  = inCoord->GetBaseSystem();
+   std::string outBaseName = outCoord->GetBaseSystem();
+
+   // Build one transform per distinct epoch
+   std::vector<StateTransform>      transforms;
+   std::vector<Integer>             transformIndex(count);
+   std::unordered_map<Real, Integer> epochIndex;
+
+   const Real zero[6] = {0.0, 0.0, 0.0, 0.0, 0.0, 0.0};
+   Real R1[9], R1dot[9], R2[9], R2dot[9], B[9], BR1[9], BR1dot[9];
+
+   for (Integer i = 0; i < count; ++i)
+   {
+      std::unordered_map<Real, Integer>::iterator found =
+            epochIndex.find(epochs[i]);
+      if (found != epochIndex.end())
+      {
+         transformIndex[i] = found->second;
+         continue;
+      }
+
+      StateTransform xform;
+
+      // The offset is the image of the zero state; this also leaves the
+      // rotation matrices for the epoch in the coordinate systems
+      if (!Convert(A1Mjd(epochs[i]), zero, inCoord, xform.b, outCoord,
+                   forceComputation, omitTranslation))
+         return false;
+
+      inCoord->GetLastRotationMatrix(R1);
+      inCoord->GetLastRotationDotMatrix(R1dot);
+      outCoord->GetLastRotationMatrix(R2);
+      outCoord->GetLastRotationDotMatrix(R2dot);
+
+      // Base system change, set by the Convert() call above
+      const Real *iToF = icrfToFK5.GetDataVector();
+      if (inBaseName == outBaseName)
+      {
+         for (Integer p = 0; p < 9; ++p)
+            B[p] = ((p % 4) == 0 ? 1.0 : 0.0);
+      }
+      else if (inBaseName == "ICRF")
+      {
+         for (Integer p = 0; p < 9; ++p)
+            B[p] = iToF[p];
+      }
+      else
+      {
+         for (Integer p = 0; p < 3; ++p)
+            for (Integer q = 0; q < 3; ++q)
+               B[3*p+q] = iToF[3*q+p];
+      }
+
+      // M = R2T * B * R1, Mdot = R2dotT * B * R1 + R2T * B * R1dot
+      for (Integer p = 0; p < 3; ++p)
+      {
+         for (Integer q = 0; q < 3; ++q)
+         {
+            BR1[3*p+q]    = B[3*p]   * R1[q]   + B[3*p+1] * R1[q+3] +
+                            B[3*p+2] * R1[q+6];
+            BR1dot[3*p+q] = B[3*p]   * R1dot[q]   + B[3*p+1] * R1dot[q+3] +
+                            B[3*p+2] * R1dot[q+6];
+         }
+      }
+      for (Integer p = 0; p < 3; ++p)
+      {
+         for (Integer q = 0; q < 3; ++q)
+         {
+            xform.M[3*p+q]    = R2[p]   * BR1[q]   + R2[p+3] * BR1[q+3] +
+                                R2[p+6] * BR1[q+6];
+            xform.Mdot[3*p+q] = R2dot[p]   * BR1[q]   + R2dot[p+3] * BR1[q+3] +
+                                R2dot[p+6] * BR1[q+6] +
+                                R2[p]   * BR1dot[q]   + R2[p+3] * BR1dot[q+3] +
+                                R2[p+6] * BR1dot[q+6];
+         }
+      }
+
+      transformIndex[i] = (Integer)transforms.size();
+      epochIndex[epochs[i]] = transformIndex[i];
+      transforms.push_back(xform);
+   }
+
+   #ifdef DEBUG_TO_FROM
+      MessageInterface::ShowMessage("Array Convert: %d states at %d epochs\n",
+            count, (Integer)transforms.size());
+   #endif
+
+   ApplyStateTransforms(&transforms[0], &transformIndex[0], inStates,
+         outStates, count);
+
+   return true;
+}
+
+
 //------------------------------------------------------------------------------
 // Rmatrix33 CoordinateConverter::GetLastRotationMatrix() const
 //------------------------------------------------------------------------------
@@ -989,6 +1137,51 @@ bool CoordinateConverter::ConvertFromBaseToBase(const GmatTime &epoch,
 }
 
 
+//------------------------------------------------------------------------------
+// void ApplyStateTransforms(const StateTransform *transforms,
+//       const Integer *transformIndex, const Real *inStates, Real *outStates,
+//       Integer count)
+//------------------------------------------------------------------------------
+/**
+ * Applies the per-epoch transforms to the states of the array form of
+ * Convert().
+ *
+ * @param transforms     transforms for the distinct epochs
+ * @param transformIndex transform used for each state
+ * @param inStates       input states, 6 elements each
+ * @param outStates      output states, 6 elements each
+ * @param count          number of states
+ */
+//------------------------------------------------------------------------------
+void CoordinateConverter::ApplyStateTransforms(
+      const StateTransform *transforms, const Integer *transformIndex,
+      const Real *inStates, Real *outStates, Integer count)
+{
+   for (Integer i = 0; i < count; ++i)
+   {
+      const StateTransform &xform = transforms[transformIndex[i]];
+      const Real *M    = xform.M;
+      const Real *Mdot = xform.Mdot;
+      const Real *in   = inStates + 6*i;
+      Real       *out  = outStates + 6*i;
+
+      // Copy first so the output may overwrite the input
+      Real pos[3] = {in[0], in[1], in[2]};
+      Real vel[3] = {in[3], in[4], in[5]};
+
+      for (Integer p = 0; p < 3; ++p)
+      {
+         out[p]   = M[3*p] * pos[0] + M[3*p+1] * pos[1] + M[3*p+2] * pos[2] +
+                    xform.b[p];
+         out[p+3] = Mdot[3*p] * pos[0] + Mdot[3*p+1] * pos[1] +
+                    Mdot[3*p+2] * pos[2] +
+                    M[3*p] * vel[0] + M[3*p+1] * vel[1] + M[3*p+2] * vel[2] +
+                    xform.b[p+3];
+      }
+   }
+}
+
+
 void CoordinateConverter::RotationMatrixFromICRFToFK5(const A1Mjd &atEpoch)
 {
    Real theEpoch = atEpoch.Get();
@@ -99,6 +99,14 @@ public:
       CoordinateSystem *outCoord,
       bool forceNutationComputation = false, bool omitTranslation = false);
 
+   // Array form: converts count states (6 Reals each, contiguous) at the
+   // matching A1 MJD epochs in one call
+   bool Convert(const Integer count, const Real *epochs, const Real *inStates,
+                CoordinateSystem *inCoord, Real *outStates,
+                CoordinateSystem *outCoord,
+                bool forceNutationComputation = false,
+                bool omitTranslation = false);
+
    // method to return the rotation matrix used to do the last conversion
    Rmatrix33    GetLastRotationMatrix() const;
    Rmatrix33    GetLastRotationDotMatrix() const;
@@ -130,6 +138,20 @@ protected:
                                       const std::string &inBase, const std::string &outBase,
                                       const Real *inBaseState, Real *outBaseState);
 private:
+   /// Affine map from input to output states at one epoch:
+   /// pos' = M pos + b, vel' = Mdot pos + M vel + bdot
+   struct StateTransform
+   {
+      Real M[9];
+      Real Mdot[9];
+      Real b[6];
+   };
+
+   static void  ApplyStateTransforms(const StateTransform *transforms,
+                                     const Integer *transformIndex,
+                                     const Real *inStates, Real *outStates,
+                                     Integer count);
+
    void         RotationMatrixFromICRFToFK5(const A1Mjd &atEpoch);
    Rmatrix33 icrfToFK5;
    Rmatrix33 icrfToFK5Dot;
@@ -1131,8 +1131,8 @@ Rvector CoordinateSystem::ToBaseSystem(const A1Mjd &epoch, const Rvector &inStat
                                        bool coincident,
                                        bool forceComputation)
 {
-   static Rvector internalState;
-   static Rvector finalState;
+   static thread_local Rvector internalState;
+   static thread_local Rvector finalState;
    #ifdef DEBUG_INPUTS_OUTPUTS
       MessageInterface::ShowMessage(
       "In CS::ToBaseSystem, inState = %.17f  %.17f  %.17f  %.17f  %.17f  %.17f\n",
@@ -1197,8 +1197,8 @@ Rvector CoordinateSystem::ToBaseSystem(const GmatTime &epoch, const Rvector &inS
                                        bool coincident,
                                        bool forceComputation)
 {
-   static Rvector internalState;
-   static Rvector finalState;
+   static thread_local Rvector internalState;
+   static thread_local Rvector finalState;
    #ifdef DEBUG_INPUTS_OUTPUTS
       MessageInterface::ShowMessage(
       "In CS::ToBaseSystem, inState = %.17f  %.17f  %.17f  %.17f  %.17f  %.17f\n",
@@ -1390,8 +1390,8 @@ Rvector CoordinateSystem::FromBaseSystem(const A1Mjd &epoch, const Rvector &inSt
                                          bool coincident,
                                          bool forceComputation)
 {
-   static Rvector internalState;
-   static Rvector finalState;
+   static thread_local Rvector internalState;
+   static thread_local Rvector finalState;
    #ifdef DEBUG_INPUTS_OUTPUTS
       MessageInterface::ShowMessage(
       "In CS::FromBaseSystem, inState = %.17f  %.17f  %.17f  %.17f  %.17f  %.17f\n",
@@ -1458,8 +1458,8 @@ Rvector CoordinateSystem::FromBaseSystem(const GmatTime &epoch, const Rvector &i
                                          bool coincident,
                                          bool forceComputation)
 {
-   static Rvector internalState;
-   static Rvector finalState;
+   static thread_local Rvector internalState;
+   static thread_local Rvector finalState;
    #ifdef DEBUG_INPUTS_OUTPUTS
       MessageInterface::ShowMessage(
       "In CS::FromBaseSystem, inState = %.17f  %.17f  %.17f  %.17f  %.17f  %.17f\n",
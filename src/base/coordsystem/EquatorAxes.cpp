@@ -409,7 +409,7 @@ void EquatorAxes::CalculateRotationMatrix(const A1Mjd &atEpoch,
       #endif // ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ end debug ~~~~
       // this method will return alpha (deg), delta (deg), 
       // W (deg), and Wdot (deg/day)
-      static Rvector cartCoord(4);  
+      static thread_local Rvector cartCoord(4);  
       const Real *cartC = cartCoord.GetDataVector();
       // this method will return alpha (deg), delta (deg), 
       // W (deg), and Wdot (deg/day)
@@ -571,3 +571,18 @@ Rmatrix33  ITRFAxes::GetRotationMatrix(const A1Mjd &atEpoch, bool forceComputati
 	CalculateRotationMatrix(atEpoch, forceComputation);
 	return rotMatrix;
 }
+
+//------------------------------------------------------------------------------
+//  bool UsesRotationCache() const
+//------------------------------------------------------------------------------
+/**
+ * The ITRF rotation depends only on the epoch and the EOP and IAU data, so it
+ * is shared through the RotationMatrixCache.
+ *
+ * @return true
+ */
+//------------------------------------------------------------------------------
+bool ITRFAxes::UsesRotationCache() const
+{
+   return true;
+}
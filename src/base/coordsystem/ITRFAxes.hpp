@@ -90,6 +90,7 @@ protected:
 
    virtual void CalculateRotationMatrix(const A1Mjd &atEpoch,
                                         bool forceComputation = false);
+   virtual bool UsesRotationCache() const;
 
    IAUFile*					    iauFile;
 };
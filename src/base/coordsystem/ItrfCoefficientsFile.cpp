@@ -69,6 +69,7 @@ const Integer ItrfCoefficientsFile::MAX_1996_PLANET_TERMS      = 112;
 const Real    ItrfCoefficientsFile::MULT_1996_PLANET           = 1.0e-04;
 const Integer ItrfCoefficientsFile::MAX_2000_PLANET_TERMS = 112;            // ????
 const Real    ItrfCoefficientsFile::MULT_2000_PLANET      = 1.0e-04;        // ????
+std::atomic<Integer> ItrfCoefficientsFile::dataVersion(0);
 
 //------------------------------------------------------------------------------
 // public methods
@@ -348,6 +349,7 @@ void ItrfCoefficientsFile::Initialize()
    }
    
     filesAreInitialized = true;
+    ++dataVersion;
 }
 
 
@@ -408,6 +410,22 @@ std::string ItrfCoefficientsFile::GetPlanetaryFileName() const
 }
 
 
+//------------------------------------------------------------------------------
+//  Integer GetDataVersion()
+//------------------------------------------------------------------------------
+/**
+ * Returns a counter that changes whenever an ItrfCoefficientsFile reads its
+ * files.
+ *
+ * @return the data version
+ */
+//------------------------------------------------------------------------------
+Integer ItrfCoefficientsFile::GetDataVersion()
+{
+   return dataVersion;
+}
+
+
 //------------------------------------------------------------------------------
 //  Integer GetNumberOfNutationTerms() const
 //------------------------------------------------------------------------------
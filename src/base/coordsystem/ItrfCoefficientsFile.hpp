@@ -39,6 +39,7 @@
 
 #include "gmatdefs.hpp"
 #include "Rvector.hpp"
+#include <atomic>
 
 namespace GmatItrf
 {
@@ -91,12 +92,18 @@ public:
                                   Rvector &Apval, Rvector &Bpval, 
                                   Rvector &Cpval, Rvector &Dpval);
    
+   // changes whenever any ItrfCoefficientsFile loads its data
+   static Integer GetDataVersion();
+   
   
 protected:
 
    // additional protected data
    // (NOTE - static const strings are initialized in source file)
    static const Integer MAX_1980_NUT_TERMS;//         = 106;
+   /// Incremented on each load, so caches of rotations computed from the
+   /// coefficients can tell when they are stale
+   static std::atomic<Integer> dataVersion;
    static const Real    MULT_1980_NUT;//              = 1.0e-04;
    static const std::string FIRST_NUT_PHRASE_1980;
    
@@ -216,3 +216,18 @@ void MODEcAxes::CalculateRotationMatrix(const A1Mjd &atEpoch,
    // (assume it is negligibly small)
    
 }
+
+//------------------------------------------------------------------------------
+//  bool UsesRotationCache() const
+//------------------------------------------------------------------------------
+/**
+ * The mean of date rotation depends only on the epoch, so it is shared
+ * through the RotationMatrixCache.
+ *
+ * @return true
+ */
+//------------------------------------------------------------------------------
+bool MODEcAxes::UsesRotationCache() const
+{
+   return true;
+}
@@ -189,3 +189,18 @@ void MODEqAxes::CalculateRotationMatrix(const A1Mjd &atEpoch,
    // rotDotMatrix is still the default zero matrix
    // (assume it is negligibly small)
 }
+
+//------------------------------------------------------------------------------
+//  bool UsesRotationCache() const
+//------------------------------------------------------------------------------
+/**
+ * The mean of date rotation depends only on the epoch, so it is shared
+ * through the RotationMatrixCache.
+ *
+ * @return true
+ */
+//------------------------------------------------------------------------------
+bool MODEqAxes::UsesRotationCache() const
+{
+   return true;
+}
@@ -67,5 +67,6 @@ protected:
    
    virtual void CalculateRotationMatrix(const A1Mjd &atEpoch,
                                         bool forceComputation = false);
+   virtual bool UsesRotationCache() const;
 };
 #endif // MODEqAxes_hpp
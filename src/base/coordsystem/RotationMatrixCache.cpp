@@ -0,0 +1,497 @@
+//$Id$
+//------------------------------------------------------------------------------
+//                              RotationMatrixCache
+//------------------------------------------------------------------------------
+// GMAT: General Mission Analysis Tool
+//
+// Copyright (c) 2002 - 2020 United States Government as represented by the
+// Administrator of the National Aeronautics and Space Administration.
+// All Other Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// You may not use this file except in compliance with the License.
+// You may obtain a copy of the License at:
+// http://www.apache.org/licenses/LICENSE-2.0.
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied.   See the License for the specific language
+// governing permissions and limitations under the License.
+//
+// Author: GMAT Development Team
+// Created: 2026/10/17
+//
+/**
+ * Implementation of the process-wide cache of axis system rotation matrices.
+ */
+//------------------------------------------------------------------------------
+#include "RotationMatrixCache.hpp"
+#include "EopFile.hpp"
+#include "ItrfCoefficientsFile.hpp"
+#include "MessageInterface.hpp"
+#include <cstring>
+#include <functional>
+
+//#define DEBUG_ROTATION_CACHE
+
+//---------------------------------
+// static data
+//---------------------------------
+RotationMatrixCache* RotationMatrixCache::instance = NULL;
+
+//---------------------------------
+// public
+//---------------------------------
+
+//------------------------------------------------------------------------------
+// RotationMatrixCache* Instance()
+//------------------------------------------------------------------------------
+/**
+ * Returns a pointer to the instance of the singleton.
+ *
+ * @return pointer to the instance
+ */
+//------------------------------------------------------------------------------
+RotationMatrixCache* RotationMatrixCache::Instance()
+{
+   if (instance == NULL)
+      instance = new RotationMatrixCache();
+
+   return instance;
+}
+
+
+//------------------------------------------------------------------------------
+// Integer RegisterAxes(const std::string &signature, Integer &generation)
+//------------------------------------------------------------------------------
+/**
+ * Returns the id used for an axis system signature, assigning one on first
+ * use.
+ *
+ * Axis systems with equal signatures compute identical rotations and share
+ * entries.  Ids are never reused.  The id is good until the generation
+ * changes; callers keep the generation returned here and register again when
+ * GetGeneration() reports a different one.
+ *
+ * @param signature  Text identifying everything the rotation depends on
+ *                   besides the epoch
+ * @param generation Receives the generation the id belongs to
+ *
+ * @return The id
+ */
+//------------------------------------------------------------------------------
+Integer RotationMatrixCache::RegisterAxes(const std::string &signature,
+      Integer &generation)
+{
+   std::lock_guard<std::mutex> lock(cacheMutex);
+
+   CheckDataVersions();
+   generation = this->generation;
+
+   std::map<std::string, Integer>::iterator i = axesIds.find(signature);
+   if (i != axesIds.end())
+      return i->second;
+
+   Integer id = nextId++;
+   axesIds[signature] = id;
+
+   #ifdef DEBUG_ROTATION_CACHE
+      MessageInterface::ShowMessage("RotationMatrixCache: axes %d = %s\n", id,
+            signature.c_str());
+   #endif
+
+   return id;
+}
+
+
+//------------------------------------------------------------------------------
+// Integer GetGeneration()
+//------------------------------------------------------------------------------
+/**
+ * Returns the current generation, first dropping everything if the EOP or
+ * ITRF coefficient data changed since the entries were made.
+ *
+ * @return The generation
+ */
+//------------------------------------------------------------------------------
+Integer RotationMatrixCache::GetGeneration()
+{
+   if ((EopFile::GetDataVersion() != eopVersion) ||
+       (ItrfCoefficientsFile::GetDataVersion() != itrfVersion))
+   {
+      std::lock_guard<std::mutex> lock(cacheMutex);
+      CheckDataVersions();
+   }
+
+   return generation;
+}
+
+
+//------------------------------------------------------------------------------
+// bool Find(Integer axesId, const A1Mjd &epoch, Real *rot, Real *rotDot)
+//------------------------------------------------------------------------------
+/**
+ * Looks up the rotation matrix and its time derivative at an epoch.
+ *
+ * @param axesId Id from RegisterAxes()
+ * @param epoch  The epoch
+ * @param rot    Receives the 9 rotation matrix elements, row by row
+ * @param rotDot Receives the 9 rotation matrix derivative elements
+ *
+ * @return true on a hit; the outputs are untouched on a miss
+ */
+//------------------------------------------------------------------------------
+bool RotationMatrixCache::Find(Integer axesId, const A1Mjd &epoch, Real *rot,
+      Real *rotDot)
+{
+   return FindEntry(MakeKey(axesId, epoch), rot, rotDot);
+}
+
+
+//------------------------------------------------------------------------------
+// bool Find(Integer axesId, const GmatTime &epoch, Real *rot, Real *rotDot)
+//------------------------------------------------------------------------------
+bool RotationMatrixCache::Find(Integer axesId, const GmatTime &epoch,
+      Real *rot, Real *rotDot)
+{
+   return FindEntry(MakeKey(axesId, epoch), rot, rotDot);
+}
+
+
+//------------------------------------------------------------------------------
+// void Add(Integer axesId, const A1Mjd &epoch, const Real *rot,
+//          const Real *rotDot)
+//------------------------------------------------------------------------------
+/**
+ * Stores the rotation matrix and its time derivative at an epoch.
+ *
+ * @param axesId Id from RegisterAxes()
+ * @param epoch  The epoch
+ * @param rot    The 9 rotation matrix elements, row by row
+ * @param rotDot The 9 rotation matrix derivative elements
+ */
+//------------------------------------------------------------------------------
+void RotationMatrixCache::Add(Integer axesId, const A1Mjd &epoch,
+      const Real *rot, const Real *rotDot)
+{
+   AddEntry(MakeKey(axesId, epoch), rot, rotDot);
+}
+
+
+//------------------------------------------------------------------------------
+// void Add(Integer axesId, const GmatTime &epoch, const Real *rot,
+//          const Real *rotDot)
+//------------------------------------------------------------------------------
+void RotationMatrixCache::Add(Integer axesId, const GmatTime &epoch,
+      const Real *rot, const Real *rotDot)
+{
+   AddEntry(MakeKey(axesId, epoch), rot, rotDot);
+}
+
+
+//------------------------------------------------------------------------------
+// void SetCapacity(Integer entries)
+//------------------------------------------------------------------------------
+/**
+ * Sets the maximum number of cached epochs (over all axis systems).
+ *
+ * @param entries The capacity; 0 disables caching
+ */
+//------------------------------------------------------------------------------
+void RotationMatrixCache::SetCapacity(Integer entries)
+{
+   std::lock_guard<std::mutex> lock(cacheMutex);
+
+   capacity = (entries < 0 ? 0 : entries);
+   while ((Integer)index.size() > capacity)
+   {
+      index.erase(this->entries.back().key);
+      this->entries.pop_back();
+      ++evictions;
+   }
+}
+
+
+//------------------------------------------------------------------------------
+// Integer GetCapacity()
+//------------------------------------------------------------------------------
+Integer RotationMatrixCache::GetCapacity()
+{
+   std::lock_guard<std::mutex> lock(cacheMutex);
+   return capacity;
+}
+
+
+//------------------------------------------------------------------------------
+// Integer GetSize()
+//------------------------------------------------------------------------------
+Integer RotationMatrixCache::GetSize()
+{
+   std::lock_guard<std::mutex> lock(cacheMutex);
+   return (Integer)index.size();
+}
+
+
+//------------------------------------------------------------------------------
+// Integer GetHitCount()
+//------------------------------------------------------------------------------
+Integer RotationMatrixCache::GetHitCount()
+{
+   std::lock_guard<std::mutex> lock(cacheMutex);
+   return hits;
+}
+
+
+//------------------------------------------------------------------------------
+// Integer GetMissCount()
+//------------------------------------------------------------------------------
+Integer RotationMatrixCache::GetMissCount()
+{
+   std::lock_guard<std::mutex> lock(cacheMutex);
+   return misses;
+}
+
+
+//------------------------------------------------------------------------------
+// Integer GetEvictionCount()
+//------------------------------------------------------------------------------
+Integer RotationMatrixCache::GetEvictionCount()
+{
+   std::lock_guard<std::mutex> lock(cacheMutex);
+   return evictions;
+}
+
+
+//------------------------------------------------------------------------------
+// Integer GetSignatureCount()
+//------------------------------------------------------------------------------
+Integer RotationMatrixCache::GetSignatureCount()
+{
+   std::lock_guard<std::mutex> lock(cacheMutex);
+   return (Integer)axesIds.size();
+}
+
+
+//------------------------------------------------------------------------------
+// void ResetStatistics()
+//------------------------------------------------------------------------------
+void RotationMatrixCache::ResetStatistics()
+{
+   std::lock_guard<std::mutex> lock(cacheMutex);
+   hits      = 0;
+   misses    = 0;
+   evictions = 0;
+}
+
+
+//------------------------------------------------------------------------------
+// void Clear()
+//------------------------------------------------------------------------------
+/**
+ * Drops all cached matrices and registered signatures, e.g. when a run ends
+ * and the bodies may change before the next one.  Axis systems register again
+ * on their next cached rotation.
+ */
+//------------------------------------------------------------------------------
+void RotationMatrixCache::Clear()
+{
+   std::lock_guard<std::mutex> lock(cacheMutex);
+
+   #ifdef DEBUG_ROTATION_CACHE
+      MessageInterface::ShowMessage("RotationMatrixCache::Clear(): %d entries, "
+            "%d hits, %d misses, %d evictions\n", (Integer)index.size(), hits,
+            misses, evictions);
+   #endif
+
+   DropAll();
+}
+
+
+//---------------------------------
+// private
+//---------------------------------
+
+//------------------------------------------------------------------------------
+// bool EpochKey::operator==(const EpochKey &key) const
+//------------------------------------------------------------------------------
+bool RotationMatrixCache::EpochKey::operator==(const EpochKey &key) const
+{
+   return (axesId == key.axesId) && (epochType == key.epochType) &&
+          (part[0] == key.part[0]) && (part[1] == key.part[1]) &&
+          (part[2] == key.part[2]);
+}
+
+
+//------------------------------------------------------------------------------
+// size_t EpochKeyHash::operator()(const EpochKey &key) const
+//------------------------------------------------------------------------------
+size_t RotationMatrixCache::EpochKeyHash::operator()(const EpochKey &key) const
+{
+   std::hash<Real> realHash;
+   size_t hash = (size_t)key.axesId * 31 + (size_t)key.epochType;
+   for (Integer i = 0; i < 3; ++i)
+      hash = hash * 1000003 ^ realHash(key.part[i]);
+   return hash;
+}
+
+
+//------------------------------------------------------------------------------
+// RotationMatrixCache()
+//------------------------------------------------------------------------------
+RotationMatrixCache::RotationMatrixCache() :
+   nextId      (0),
+   generation  (0),
+   eopVersion  (EopFile::GetDataVersion()),
+   itrfVersion (ItrfCoefficientsFile::GetDataVersion()),
+   capacity    (DEFAULT_CAPACITY),
+   hits        (0),
+   misses      (0),
+   evictions   (0)
+{
+}
+
+
+//------------------------------------------------------------------------------
+// ~RotationMatrixCache()
+//------------------------------------------------------------------------------
+RotationMatrixCache::~RotationMatrixCache()
+{
+}
+
+
+//------------------------------------------------------------------------------
+// void CheckDataVersions()
+//------------------------------------------------------------------------------
+/**
+ * Drops everything when EOP or ITRF coefficient data was loaded or replaced
+ * since the entries were made.  The caller holds the mutex.
+ */
+//------------------------------------------------------------------------------
+void RotationMatrixCache::CheckDataVersions()
+{
+   Integer eopNow  = EopFile::GetDataVersion();
+   Integer itrfNow = ItrfCoefficientsFile::GetDataVersion();
+   if ((eopNow == eopVersion) && (itrfNow == itrfVersion))
+      return;
+
+   #ifdef DEBUG_ROTATION_CACHE
+      MessageInterface::ShowMessage("RotationMatrixCache: EOP or ITRF data "
+            "changed; dropping %d entries\n", (Integer)index.size());
+   #endif
+
+   eopVersion  = eopNow;
+   itrfVersion = itrfNow;
+   DropAll();
+}
+
+
+//------------------------------------------------------------------------------
+// void DropAll()
+//------------------------------------------------------------------------------
+/**
+ * Empties the entries and signatures and starts a new generation.  The caller
+ * holds the mutex.
+ */
+//------------------------------------------------------------------------------
+void RotationMatrixCache::DropAll()
+{
+   index.clear();
+   entries.clear();
+   axesIds.clear();
+   ++generation;
+}
+
+
+//------------------------------------------------------------------------------
+// bool FindEntry(const EpochKey &key, Real *rot, Real *rotDot)
+//------------------------------------------------------------------------------
+bool RotationMatrixCache::FindEntry(const EpochKey &key, Real *rot,
+      Real *rotDot)
+{
+   std::lock_guard<std::mutex> lock(cacheMutex);
+
+   CheckDataVersions();
+
+   EntryMap::iterator i = index.find(key);
+   if (i == index.end())
+   {
+      ++misses;
+      return false;
+   }
+
+   // Move to the front of the recency list
+   entries.splice(entries.begin(), entries, i->second);
+   memcpy(rot,    i->second->rot,    9 * sizeof(Real));
+   memcpy(rotDot, i->second->rotDot, 9 * sizeof(Real));
+   ++hits;
+
+   return true;
+}
+
+
+//------------------------------------------------------------------------------
+// void AddEntry(const EpochKey &key, const Real *rot, const Real *rotDot)
+//------------------------------------------------------------------------------
+void RotationMatrixCache::AddEntry(const EpochKey &key, const Real *rot,
+      const Real *rotDot)
+{
+   std::lock_guard<std::mutex> lock(cacheMutex);
+
+   CheckDataVersions();
+   if (capacity == 0)
+      return;
+
+   EntryMap::iterator i = index.find(key);
+   if (i != index.end())
+   {
+      // Another thread computed the same epoch first
+      entries.splice(entries.begin(), entries, i->second);
+      return;
+   }
+
+   if ((Integer)index.size() >= capacity)
+   {
+      index.erase(entries.back().key);
+      entries.pop_back();
+      ++evictions;
+   }
+
+   Entry entry;
+   entry.key = key;
+   memcpy(entry.rot,    rot,    9 * sizeof(Real));
+   memcpy(entry.rotDot, rotDot, 9 * sizeof(Real));
+   entries.push_front(entry);
+   index[key] = entries.begin();
+}
+
+
+//------------------------------------------------------------------------------
+// EpochKey MakeKey(Integer axesId, const A1Mjd &epoch)
+//------------------------------------------------------------------------------
+RotationMatrixCache::EpochKey RotationMatrixCache::MakeKey(Integer axesId,
+      const A1Mjd &epoch)
+{
+   EpochKey key;
+   key.axesId    = axesId;
+   key.epochType = 0;
+   key.part[0]   = epoch.Get();
+   key.part[1]   = 0.0;
+   key.part[2]   = 0.0;
+   return key;
+}
+
+
+//------------------------------------------------------------------------------
+// EpochKey MakeKey(Integer axesId, const GmatTime &epoch)
+//------------------------------------------------------------------------------
+RotationMatrixCache::EpochKey RotationMatrixCache::MakeKey(Integer axesId,
+      const GmatTime &epoch)
+{
+   EpochKey key;
+   key.axesId    = axesId;
+   key.epochType = 1;
+   key.part[0]   = (Real)epoch.GetDays();
+   key.part[1]   = (Real)epoch.GetSec();
+   key.part[2]   = epoch.GetFracSec();
+   return key;
+}
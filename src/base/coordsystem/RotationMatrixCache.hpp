@@ -0,0 +1,145 @@
+//$Id$
+//------------------------------------------------------------------------------
+//                              RotationMatrixCache
+//------------------------------------------------------------------------------
+// GMAT: General Mission Analysis Tool
+//
+// Copyright (c) 2002 - 2020 United States Government as represented by the
+// Administrator of the National Aeronautics and Space Administration.
+// All Other Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// You may not use this file except in compliance with the License.
+// You may obtain a copy of the License at:
+// http://www.apache.org/licenses/LICENSE-2.0.
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied.   See the License for the specific language
+// governing permissions and limitations under the License.
+//
+// Author: GMAT Development Team
+// Created: 2026/10/17
+//
+/**
+ * Definition of the process-wide cache of axis system rotation matrices.
+ *
+ * Axis systems whose rotation to the base system is a pure function of epoch
+ * register a signature (type, origin, EOP data, ...) and share the matrices
+ * computed at each epoch, so the coordinate systems of subscribers, force
+ * models and measurement models evaluate the precession-nutation, sidereal
+ * time and polar motion models once per epoch.  The cache is bounded and
+ * evicts the least recently used entries.
+ *
+ * Entries and signatures are dropped when the EOP or ITRF coefficient data is
+ * loaded or replaced, and by Clear(); each drop starts a new generation, and
+ * axis systems register again when the generation changes.
+ */
+//------------------------------------------------------------------------------
+#ifndef RotationMatrixCache_hpp
+#define RotationMatrixCache_hpp
+
+#include "gmatdefs.hpp"
+#include "A1Mjd.hpp"
+#include "GmatTime.hpp"
+#include <atomic>
+#include <list>
+#include <map>
+#include <mutex>
+#include <unordered_map>
+
+class GMAT_API RotationMatrixCache
+{
+public:
+   static RotationMatrixCache* Instance();
+
+   Integer  RegisterAxes(const std::string &signature, Integer &generation);
+   Integer  GetGeneration();
+
+   bool     Find(Integer axesId, const A1Mjd &epoch, Real *rot,
+                 Real *rotDot);
+   bool     Find(Integer axesId, const GmatTime &epoch, Real *rot,
+                 Real *rotDot);
+   void     Add(Integer axesId, const A1Mjd &epoch, const Real *rot,
+                const Real *rotDot);
+   void     Add(Integer axesId, const GmatTime &epoch, const Real *rot,
+                const Real *rotDot);
+
+   void     SetCapacity(Integer entries);
+   Integer  GetCapacity();
+   Integer  GetSize();
+   Integer  GetHitCount();
+   Integer  GetMissCount();
+   Integer  GetEvictionCount();
+   Integer  GetSignatureCount();
+   void     ResetStatistics();
+   void     Clear();
+
+   /// Default number of cached epochs, summed over all axis systems
+   static const Integer DEFAULT_CAPACITY = 1024;
+
+private:
+   /// Axes and exact epoch; A1Mjd and GmatTime epochs are kept apart because
+   /// the axis systems use different code paths for them
+   struct EpochKey
+   {
+      Integer axesId;
+      Integer epochType;
+      Real    part[3];
+
+      bool operator==(const EpochKey &key) const;
+   };
+
+   struct EpochKeyHash
+   {
+      size_t operator()(const EpochKey &key) const;
+   };
+
+   struct Entry
+   {
+      EpochKey key;
+      Real     rot[9];
+      Real     rotDot[9];
+   };
+
+   typedef std::list<Entry> EntryList;
+   typedef std::unordered_map<EpochKey, EntryList::iterator, EpochKeyHash>
+         EntryMap;
+
+   RotationMatrixCache();
+   ~RotationMatrixCache();
+
+   void     CheckDataVersions();
+   void     DropAll();
+   bool     FindEntry(const EpochKey &key, Real *rot, Real *rotDot);
+   void     AddEntry(const EpochKey &key, const Real *rot, const Real *rotDot);
+   static EpochKey MakeKey(Integer axesId, const A1Mjd &epoch);
+   static EpochKey MakeKey(Integer axesId, const GmatTime &epoch);
+
+   /// Entries, most recently used first
+   EntryList              entries;
+   /// Index into the entries
+   EntryMap               index;
+   /// Registered axis system signatures and their ids
+   std::map<std::string, Integer> axesIds;
+   /// Next id to assign; ids are not reused, so stale ids only miss
+   Integer                nextId;
+   /// Incremented each time the entries and signatures are dropped
+   std::atomic<Integer>   generation;
+   /// EopFile and ItrfCoefficientsFile data versions the entries were made
+   /// with
+   std::atomic<Integer>   eopVersion;
+   std::atomic<Integer>   itrfVersion;
+   /// Maximum number of entries; 0 disables the cache
+   Integer                capacity;
+   /// Statistics, for tuning the capacity
+   Integer                hits;
+   Integer                misses;
+   Integer                evictions;
+   /// Guards all of the above; axis systems on several threads share it
+   std::mutex             cacheMutex;
+
+   static RotationMatrixCache *instance;
+};
+
+#endif // RotationMatrixCache_hpp
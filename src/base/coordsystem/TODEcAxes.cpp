@@ -235,3 +235,24 @@ void TODEcAxes::CalculateRotationMatrix(const A1Mjd &atEpoch,
    // rotDotMatrix is still the default zero matrix 
    // (assume it is negligibly small)
 }
+
+//------------------------------------------------------------------------------
+//  bool UsesRotationCache() const
+//------------------------------------------------------------------------------
+/**
+ * The rotation can be shared through the RotationMatrixCache only when the
+ * nutation is recomputed at every epoch; with a nonzero update interval the
+ * matrix depends on the epoch at which the nutation was last computed.
+ *
+ * @return true if the effective nutation update interval is zero
+ */
+//------------------------------------------------------------------------------
+bool TODEcAxes::UsesRotationCache() const
+{
+   if (origin == NULL)
+      return false;
+
+   Real interval = (overrideOriginInterval ?
+         ((Planet*) origin)->GetNutationUpdateInterval() : updateInterval);
+   return (interval == 0.0);
+}
@@ -67,6 +67,7 @@ protected:
 
    virtual void CalculateRotationMatrix(const A1Mjd &atEpoch,
                                         bool forceComputation = false);
+   virtual bool UsesRotationCache() const;
 
 };
 #endif // TODEqAxes_hpp
@@ -44,6 +44,7 @@
 #include "MessageInterface.hpp"
 #include "RealUtilities.hpp"
 #include "EphemManager.hpp"
+#include "Ephemeris.hpp"
 
 
 //#define DEBUG_DUMPEVENTDATA
@@ -82,6 +83,7 @@ EventLocator::PARAMETER_TEXT[EventLocatorParamCount - GmatBaseParamCount] =
    "WriteReport",          // WRITE_REPORT
    "RunMode",              // RUN_MODE
    "UseEntireInterval",    // USE_ENTIRE_INTERVAL
+   "SearchMethod",         // SEARCH_METHOD
 };
 
 const Gmat::ParameterType
@@ -99,6 +101,7 @@ EventLocator::PARAMETER_TYPE[EventLocatorParamCount - GmatBaseParamCount] =
    Gmat::BOOLEAN_TYPE,     // WRITE_REPORT
    Gmat::ENUMERATION_TYPE, // RUN_MODE
    Gmat::BOOLEAN_TYPE,     // USE_ENTIRE_INTERVAL
+   Gmat::ENUMERATION_TYPE, // SEARCH_METHOD
 };
 
 const std::string EventLocator::RUN_MODES[3] =
@@ -110,6 +113,14 @@ const std::string EventLocator::RUN_MODES[3] =
 
 const Integer EventLocator::numModes = 3;
 
+const std::string EventLocator::SEARCH_METHODS[2] =
+{
+      "SPICE",
+      "Native",
+};
+
+const Integer EventLocator::numSearchMethods = 2;
+
 const std::string EventLocator::defaultFormat        = "TAIModJulian";
 const Real        EventLocator::defaultInitialEpoch  = 21545;
 const Real        EventLocator::defaultFinalEpoch    = 21545.138;
@@ -142,6 +153,7 @@ EventLocator::EventLocator(const std::string &typeStr,
    writeReport             (true),
    locatingString          (""),
    runMode                 ("Automatic"),
+   searchMethod            ("SPICE"),
    useEntireInterval       (true),
    appendReport            (false),
    epochFormat             ("TAIModJulian"),
@@ -218,6 +230,7 @@ EventLocator::EventLocator(const EventLocator& el) :
    useStellarAberration    (el.useStellarAberration),
    writeReport             (el.writeReport),
    runMode                 (el.runMode),
+   searchMethod            (el.searchMethod),
    locatingString          (el.locatingString),
    useEntireInterval       (el.useEntireInterval),
    appendReport            (el.appendReport),
@@ -282,6 +295,7 @@ EventLocator& EventLocator::operator=(const EventLocator& el)
       useStellarAberration = el.useStellarAberration;
       writeReport          = el.writeReport;
       runMode              = el.runMode;
+      searchMethod         = el.searchMethod;
       locatingString       = el.locatingString;
       useEntireInterval    = el.useEntireInterval;
       appendReport         = el.appendReport;
@@ -590,6 +604,8 @@ std::string EventLocator::GetStringParameter(const Integer id) const
    }
    if (id == RUN_MODE)
       return runMode;
+   if (id == SEARCH_METHOD)
+      return searchMethod;
 
    return GmatBase::GetStringParameter(id);
 }
@@ -672,6 +688,29 @@ bool EventLocator::SetStringParameter(const Integer id,
             "RunMode", allowed.c_str());
       throw ee;
    }
+   if (id == SEARCH_METHOD)
+   {
+      for (Integer jj = 0; jj < numSearchMethods; jj++)
+      {
+         if (GmatStringUtil::ToUpper(value) ==
+             GmatStringUtil::ToUpper(SEARCH_METHODS[jj]))
+         {
+            searchMethod = SEARCH_METHODS[jj];
+            return true;
+         }
+      }
+      EventException ee("");
+      std::string allowed = "One of ";
+      for (Integer jj = 0; jj < numSearchMethods; jj++)
+      {
+         allowed += SEARCH_METHODS[jj];
+         if (jj != (numSearchMethods -1))
+            allowed += ", ";
+      }
+      ee.SetDetails(errorMessageFormat.c_str(), value.c_str(),
+            "SearchMethod", allowed.c_str());
+      throw ee;
+   }
    if (id == OCCULTING_BODIES)
    {
       #ifdef DEBUG_EVENTLOCATOR_SET
@@ -1133,6 +1172,12 @@ const StringArray& EventLocator::GetPropertyEnumStrings(const Integer id) const
       for (Integer ii = 0; ii < numModes; ii++)
          enumStrings.push_back(RUN_MODES[ii]);
 
+      return enumStrings;
+   case SEARCH_METHOD:
+      enumStrings.clear();
+      for (Integer ii = 0; ii < numSearchMethods; ii++)
+         enumStrings.push_back(SEARCH_METHODS[ii]);
+
       return enumStrings;
    default:
       return GmatBase::GetPropertyEnumStrings(id);
@@ -1698,8 +1743,9 @@ bool EventLocator::Initialize()
    #endif
    if (runMode != "Disabled")
    {
-      // Tell the spacecraft to start recording its data
-      sat->RecordEphemerisData();
+      // Tell the spacecraft to start recording its data; the native search
+      // uses the recorded states without the SPK kernels
+      sat->RecordEphemerisData(searchMethod != "Native");
    }
 
    fileWasWritten = false;
@@ -1788,8 +1834,11 @@ void EventLocator::LocateEvents(const std::string &reportNotice)
       Real coverageBegin;
       Real coverageEnd;
       scNow = sat->GetEpoch();
-      em->GetCoverage(initialEp, finalEp, useEntireInterval, true,
-                      findStart, findStop, coverageBegin, coverageEnd);
+      if (searchMethod == "Native")
+         GetRecordedCoverage(findStart, findStop, coverageBegin, coverageEnd);
+      else
+         em->GetCoverage(initialEp, finalEp, useEntireInterval, true,
+                         findStart, findStop, coverageBegin, coverageEnd);
       #ifdef DEBUG_TIME_SPENT
       Real timeSpent = (Real) (clock() - t);
       MessageInterface::ShowMessage(" --- time spent in GetCoverage = %12.10f (sec)\n",
@@ -2112,6 +2161,41 @@ std::string EventLocator::GetAbcorrString()
    return correction;
 }
 
+//------------------------------------------------------------------------------
+// void GetRecordedCoverage(Real &intvlStart, Real &intvlStop,
+//                          Real &cvrStart, Real &cvrStop)
+//------------------------------------------------------------------------------
+/**
+ * Returns the search window and coverage for the native search method.
+ *
+ * The coverage is the span of the states the EphemManager has kept in memory;
+ * input SPK kernels on the spacecraft are not included.  All outputs are 0.0
+ * when nothing has been recorded, as for EphemManager::GetCoverage().
+ *
+ * @param intvlStart Start of the window to search (A1Mjd)
+ * @param intvlStop  End of the window to search (A1Mjd)
+ * @param cvrStart   Start of the recorded data (A1Mjd)
+ * @param cvrStop    End of the recorded data (A1Mjd)
+ */
+//------------------------------------------------------------------------------
+void EventLocator::GetRecordedCoverage(Real &intvlStart, Real &intvlStop,
+                                       Real &cvrStart, Real &cvrStop)
+{
+   intvlStart = intvlStop = cvrStart = cvrStop = 0.0;
+
+   Ephemeris *record = em->GetStateRecord();
+   if ((record == NULL) || !record->GetCoverage(cvrStart, cvrStop))
+      return;
+
+   intvlStart = cvrStart;
+   intvlStop  = cvrStop;
+   if (!useEntireInterval)
+   {
+      if (initialEp > intvlStart)  intvlStart = initialEp;
+      if (finalEp   < intvlStop)   intvlStop  = finalEp;
+   }
+}
+
 CelestialBody* EventLocator::GetCelestialBody(const std::string &withName)
 {
    Integer sz = (Integer) occultingBodies.size();
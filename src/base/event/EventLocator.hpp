@@ -175,6 +175,9 @@ protected:
    bool                        writeReport;
    /// Should we do location at the end, when commanded to do so, or not at all?
    std::string                 runMode;
+   /// Event search engine: "SPICE" (gfoclt/gfposc on the temporary SPK
+   /// kernels) or "Native" (in-memory search of the recorded states)
+   std::string                 searchMethod;
    /// String to write when the locator is running
    std::string                 locatingString;
    /// Use the entire time interval (true  - use the entire interval; false,
@@ -256,6 +259,7 @@ protected:
        WRITE_REPORT,
        RUN_MODE,
        USE_ENTIRE_INTERVAL,
+       SEARCH_METHOD,
        EventLocatorParamCount
     };
 
@@ -267,6 +271,8 @@ protected:
        PARAMETER_TYPE[EventLocatorParamCount - GmatBaseParamCount];
     static const std::string RUN_MODES[3];
     static const Integer numModes;
+    static const std::string SEARCH_METHODS[2];
+    static const Integer numSearchMethods;
     static const std::string defaultFormat;
     static const Real        defaultInitialEpoch;
     static const Real        defaultFinalEpoch;
@@ -276,6 +282,10 @@ protected:
     Real                   EpochToReal(const std::string &ep);
     bool                   OpenReportFile(bool renameOld = true);
     virtual std::string    GetAbcorrString();
+    void                   GetRecordedCoverage(Real &intvlStart,
+                                               Real &intvlStop,
+                                               Real &cvrStart,
+                                               Real &cvrStop);
     virtual CelestialBody* GetCelestialBody(const std::string &withName);
     virtual std::string    GetNoEventsString(const std::string &forType);
     virtual void           SetLocatingString(const std::string &forType);
@@ -45,6 +45,7 @@
 #include "SubscriberException.hpp"
 #include "CommandUtil.hpp"         // for GetCommandSeqString()
 #include "MessageInterface.hpp"
+#include "RotationMatrixCache.hpp"
 
 #include <algorithm>       // for find
 
@@ -1511,6 +1512,9 @@ void Sandbox::Clear()
    solarSys = NULL;
 #endif
    
+   // Cached frame rotations refer to the bodies and EOP data of this run
+   RotationMatrixCache::Instance()->Clear();
+   
    #ifdef DEBUG_SANDBOX_CLEAR
    MessageInterface::ShowMessage
       ("--- Sandbox::Clear() now about to delete triggerManagers\n");
@@ -38,6 +38,7 @@
 #include "TimeTypes.hpp"
 #include "FileManager.hpp"    // for flux files
 #include "PropagationStateManager.hpp"
+#include "SharedDataLock.hpp"
 
 #include <sstream>                 // for <<
 #include <cmath>
@@ -3202,7 +3203,14 @@ Real DragForce::GetDensity(Real *state, Real when, Integer count)
          dragdata << "Calling atmos->Density() on " << atmos->GetTypeName()
                   << "\n";
       #endif
-      atmos->Density(state, density, when, count);
+      if (atmos == internalAtmos)
+         atmos->Density(state, density, when, count);
+      else
+      {
+         // The body's atmosphere model is shared by the drag forces using it
+         SharedDataLock::Guard guard;
+         atmos->Density(state, density, when, count);
+      }
       #ifdef DEBUG_DRAGFORCE_DENSITY
          dragdata << "Returned from atmos->Density()\n";
       #endif
@@ -78,6 +78,8 @@
 #include "GmatDefaults.hpp"
 #include "UtilityException.hpp"
 #include "FileManager.hpp"
+#include "SharedDataLock.hpp"
+#include "WorkerPool.hpp"
 #include <sstream>                 // for <<
 
 //#define DEBUG_GRAVITY_FIELD
@@ -169,7 +171,12 @@ GravityField::GravityField(const std::string &name, const std::string &forBodyNa
    orderTruncateReported  (false),
    degreeTruncateReported (false),
    gravityModel           (NULL),
-   j2k                    (NULL)
+   j2k                    (NULL),
+   tideLevel              (-1),
+   sunMu                  (0.0),
+   otherMu                (0.0),
+   polarX                 (0.0),
+   polarY                 (0.0)
 {
    objectTypeNames.push_back("GravityField");
    bodyName = forBodyName;
@@ -192,6 +199,7 @@ GravityField::GravityField(const std::string &name, const std::string &forBodyNa
 //------------------------------------------------------------------------------
 GravityField::~GravityField()
 {
+   ClearWorkerModels();
    if (gravityModel)
       delete gravityModel;
    
@@ -228,7 +236,12 @@ GravityField::GravityField(const GravityField &gf) :
     frv                    (gf.frv),
     trv                    (gf.trv),
     now                    (gf.now),
-    nowGT                  (gf.nowGT)
+    nowGT                  (gf.nowGT),
+    tideLevel              (-1),
+    sunMu                  (0.0),
+    otherMu                (0.0),
+    polarX                 (0.0),
+    polarY                 (0.0)
 {
    objectTypeNames.push_back("GravityField");
    bodyName = gf.bodyName;
@@ -271,9 +284,12 @@ GravityField& GravityField::operator=(const GravityField &gf)
    gfInitialized          = false;  // is that what I want to do?
    orderTruncateReported  = gf.orderTruncateReported;
    degreeTruncateReported = gf.degreeTruncateReported;
-//   if ((gravityModel) && (gravityModel->GetFilename() == "")) delete gravityModel;  // delete only Body ones
-   gravityModel           = gf.gravityModel;
-//   gravityModel           = NULL;
+   // Coefficients are shared through the store; the model itself is per object
+   // and is rebuilt in Initialize()
+   ClearWorkerModels();
+   if (gravityModel)
+      delete gravityModel;
+   gravityModel           = NULL;
    j2k                    = NULL;
    frv                    = gf.frv;
    trv                    = gf.trv;
@@ -355,6 +371,7 @@ bool GravityField::Initialize()
 
          // Changed to open filenameFullPath (LOJ: 2014.06.26)
          //gravityModel = GetGravityFile(filename,a,mu);
+         ClearWorkerModels();
          gravityModel = GetHarmonicGravity(filenameFullPath,tideFilenameFullPath,a,mu,body->GetName(), true);
          if (!gravityModel)
          {
@@ -530,6 +547,10 @@ bool GravityField::GetDerivatives(Real * state, Real dt, Integer dvorder,
       Rmatrix33 origingrad (0.0,0.0,0.0,0.0,0.0,0.0,0.0,0.0,0.0);
       Rmatrix33 emptyGradient(0.0,0.0,0.0,0.0,0.0,0.0,0.0,0.0,0.0);
       Rmatrix33 gradnew (0.0,0.0,0.0,0.0,0.0,0.0,0.0,0.0,0.0);
+
+      // Epoch dependent inputs are shared by the origin and all spacecraft
+      PrepareEpochData(dt);
+
       if (body != forceOrigin)
       {
          Real originstate[6] = { 0.0,0.0,0.0,0.0,0.0,0.0 };
@@ -539,6 +560,12 @@ bool GravityField::GetDerivatives(Real * state, Real dt, Integer dvorder,
 #endif
       }
 
+      // With SplitSpacecraft set, the fields of all of the spacecraft are
+      // summed on the WorkerPool before the derivatives are filled
+      bool useWorkers = splitSpacecraft && (cartesianCount > 1);
+      if (useWorkers)
+         CalculateSpacecraftInParallel(dt, state);
+
 
 		Integer i6 = (fillSTM ? stmStart : aMatrixStart);
       for (Integer n = 0; n < cartesianCount; ++n)
@@ -549,7 +576,14 @@ bool GravityField::GetDerivatives(Real * state, Real dt, Integer dvorder,
 
          Real accnew[3];  // JPD code
          gradnew = emptyGradient;
-         Calculate(dt,satState,accnew,gradnew);
+         if (useWorkers)
+         {
+            for (Integer i = 0; i < 3; ++i)
+               accnew[i] = satAcc[3*n + i];
+            gradnew = satGrad[n];
+         }
+         else
+            Calculate(dt,satState,accnew,gradnew);
          if (body != forceOrigin)
          {
             for (Integer i=0;  i<=2;  ++i)
@@ -784,6 +818,8 @@ Rvector6 GravityField::GetDerivativesForSpacecraft(Spacecraft *sc)
    Rmatrix33 emptyGradient(0.0,0.0,0.0,0.0,0.0,0.0,0.0,0.0,0.0);
    Rmatrix33 gradnew (0.0,0.0,0.0,0.0,0.0,0.0,0.0,0.0,0.0);
 
+   PrepareEpochData(0.0);
+
    if (body != forceOrigin)
    {
       Real originstate[6] = { 0.0,0.0,0.0,0.0,0.0,0.0 };
@@ -1416,60 +1452,38 @@ void GravityField::GetTideData (Real dt, const std::string bodyname,
 
 
 //------------------------------------------------------------------------------
-void GravityField::Calculate (Real dt, Real state[6], 
-                              Real acc[3], Rmatrix33& grad)
+// void PrepareEpochData(Real dt)
+//------------------------------------------------------------------------------
+/**
+ * Computes the field inputs that depend only on the evaluation epoch: the
+ * tide raising body data and the polar motion.  These are the same for every
+ * spacecraft in the state vector, so they are built once per derivative call
+ * and then used by Calculate() for each spacecraft.
+ *
+ * @param dt The time offset of the evaluation, in seconds
+ */
+//------------------------------------------------------------------------------
+void GravityField::PrepareEpochData(Real dt)
 {
-   #ifdef DEBUG_CALCULATE
-      MessageInterface::ShowMessage(
-            "Entering Calculate with dt = %12.10f, state = %12.10f  %12.10f  %12.10f  %12.10f  %12.10f  %12.10f\n",
-            dt, state[0], state[1], state[2], state[3], state[4], state[5]);
-      MessageInterface::ShowMessage("   acc = %12.10f  %12.10f  %12.10f\n", acc[0], acc[1], acc[2]);
-   #endif
-   
-   Real jday, now;
-   GmatTime jdayGT, nowGT;
+   Real now;
+   GmatTime nowGT;
    if (hasPrecisionTime)
    {
-      jdayGT = epochGT + GmatTimeConstants::JD_JAN_5_1941;
-      jdayGT.AddSeconds(elapsedTime);
-      jdayGT.AddSeconds(dt);
       nowGT = epochGT; nowGT.AddSeconds(elapsedTime); nowGT.AddSeconds(dt);
    }
    else
-   {
-      jday = epoch + GmatTimeConstants::JD_JAN_5_1941 +
-         (elapsedTime + dt) / GmatTimeConstants::SECS_PER_DAY;
       now = epoch + (elapsedTime + dt) / GmatTimeConstants::SECS_PER_DAY;
-      jdayGT = jday;
-      nowGT = now;
-   }
 
-   // convert to body fixed coordinate system
-   Real tmpState[6];
-//   CoordinateConverter cc; - move back to class, for performance
-   if (hasPrecisionTime)
-      cc.Convert(nowGT, state, inputCS, tmpState, fixedCS);  // which CSs to use here???
-   else
-      cc.Convert(now, state, inputCS, tmpState, fixedCS);  // which CSs to use here???
-
-   #ifdef DEBUG_CALCULATE
-      MessageInterface::ShowMessage(
-            "After Convert, jday = %s, now = %s, and tmpState = %12.10f  %12.10f  %12.10f  %12.10f  %12.10f  %12.10f\n",
-            jdayGT.ToString().c_str(), nowGT.ToString().c_str(), tmpState[0], tmpState[1], tmpState[2], tmpState[3], tmpState[4], tmpState[5]);
-   #endif
-   Rmatrix33 rotMatrix = cc.GetLastRotationMatrix();
-   #ifdef DEBUG_DERIVATIVES
-      MessageInterface::ShowMessage("---->>>> rotMatrix = %s\n", rotMatrix.ToString().c_str());
-   #endif
    // tide body pos and mu
-   Real sunpos[3]   = {0.0,0.0,0.0};
-   Real otherpos[3] = {0.0,0.0,0.0};
-   Real sunmukm     = 0.0;
-   Real othermukm   = 0.0; 
-   // Acceleration
-   Real      rotacc[3];
-   Rmatrix33 rotgrad;
-   Integer   tideLevel = -1;
+   for (Integer i = 0; i < 3; ++i)
+   {
+      sunPos[i]   = 0.0;
+      otherPos[i] = 0.0;
+   }
+   sunMu   = 0.0;
+   otherMu = 0.0;
+
+   tideLevel = -1;
    if (gravityModel != NULL)
       {
       for (int i=0;  i<=HarmonicGravity::ETideCount-1;  ++i)
@@ -1483,64 +1497,61 @@ void GravityField::Calculate (Real dt, Real state[6],
    if (tideLevel > 0)
       {
       // Always do Sun
-      GetTideData (dt,GmatSolarSystemDefaults::SUN_NAME,sunpos,sunmukm);
+      GetTideData (dt,GmatSolarSystemDefaults::SUN_NAME,sunPos,sunMu);
       // Other is central body for any moon, or Moon for Earth
       std::string cb = body->GetCentralBody();
       if (bodyName == GmatSolarSystemDefaults::EARTH_NAME) // We are Earth, do moon
-         GetTideData (dt,GmatSolarSystemDefaults::MOON_NAME,otherpos,othermukm);
+         GetTideData (dt,GmatSolarSystemDefaults::MOON_NAME,otherPos,otherMu);
       else if (cb == GmatSolarSystemDefaults::SUN_NAME) 
          ;   // We are other planet, no big moon
       else
          {
-         GetTideData (dt,cb,otherpos,othermukm);  // We are a moon, do planet(cb)
+         GetTideData (dt,cb,otherPos,otherMu);  // We are a moon, do planet(cb)
          }
       }
+
    // Get xp and yp from the EOP file
-   Real xp, yp, lod;
-   Real utcmjd;
-   GmatTime utcmjdGT;
+   Real lod;
    if (hasPrecisionTime)
    {
-      utcmjdGT = theTimeConverter->Convert(nowGT, TimeSystemConverter::A1MJD, TimeSystemConverter::UTCMJD,
+      GmatTime utcmjdGT = theTimeConverter->Convert(nowGT,
+         TimeSystemConverter::A1MJD, TimeSystemConverter::UTCMJD,
          GmatTimeConstants::JD_JAN_5_1941);
-      eop->GetPolarMotionAndLod(utcmjdGT, xp, yp, lod);
+      eop->GetPolarMotionAndLod(utcmjdGT, polarX, polarY, lod);
    }
    else
    {
-      utcmjd = theTimeConverter->Convert(now, TimeSystemConverter::A1MJD, TimeSystemConverter::UTCMJD,
+      Real utcmjd = theTimeConverter->Convert(now,
+         TimeSystemConverter::A1MJD, TimeSystemConverter::UTCMJD,
          GmatTimeConstants::JD_JAN_5_1941);
-      eop->GetPolarMotionAndLod(utcmjd, xp, yp, lod);
+      eop->GetPolarMotionAndLod(utcmjd, polarX, polarY, lod);
    }
+}
 
-   bool computeMatrix = fillAMatrix || fillSTM;
 
-   if (hasPrecisionTime)
-      gravityModel->CalculateFullField(jdayGT.GetMjd(), tmpState, degree, order, tideLevel,
-         sunpos, sunmukm, otherpos, othermukm,
-         xp, yp, computeMatrix, stmLimit, rotacc, rotgrad);
-   else
-      gravityModel->CalculateFullField (jday, tmpState, degree, order, tideLevel, 
-         sunpos, sunmukm, otherpos, othermukm,
-         xp, yp, computeMatrix, stmLimit, rotacc, rotgrad);
-
-   #ifdef DEBUG_DERIVATIVES
-      MessageInterface::ShowMessage("after CalculateFullField, rotgrad = %s\n", rotgrad.ToString().c_str());
+//------------------------------------------------------------------------------
+void GravityField::Calculate (Real dt, Real state[6], 
+                              Real acc[3], Rmatrix33& grad)
+{
+   #ifdef DEBUG_CALCULATE
+      MessageInterface::ShowMessage(
+            "Entering Calculate with dt = %12.10f, state = %12.10f  %12.10f  %12.10f  %12.10f  %12.10f  %12.10f\n",
+            dt, state[0], state[1], state[2], state[3], state[4], state[5]);
+      MessageInterface::ShowMessage("   acc = %12.10f  %12.10f  %12.10f\n", acc[0], acc[1], acc[2]);
    #endif
-   /*
-    MessageInterface::ShowMessage
-    ("HarmonicField::Calculate pos= %20.14f %20.14f %20.14f\n",
-    tmpState[0],tmpState[1],tmpState[2]);
-    MessageInterface::ShowMessage
-    ("HarmonicField::Calculate grad= %20.14e %20.14e %20.14e\n",
-    rotgrad(0,0),rotgrad(0,1),rotgrad(0,2));
-    MessageInterface::ShowMessage
-    ("HarmonicField::Calculate grad= %20.14e %20.14e %20.14e\n",
-    rotgrad(1,0),rotgrad(1,1),rotgrad(1,2));
-    MessageInterface::ShowMessage
-    ("HarmonicField::Calculate grad= %20.14e %20.14e %20.14e\n",
-    rotgrad(2,0),rotgrad(2,1),rotgrad(2,2));
-    */
-   
+
+   // convert to body fixed coordinate system
+   Real tmpState[6];
+   Rmatrix33 rotMatrix;
+   Real fieldEpoch;
+   ConvertToFixed(dt, state, tmpState, rotMatrix, fieldEpoch);
+
+   // Acceleration
+   Real      rotacc[3];
+   Rmatrix33 rotgrad;
+
+   CalculateFixedField(gravityModel, fieldEpoch, tmpState, rotacc, rotgrad);
+
    // Convert back to target CS
    InverseRotate (rotMatrix,rotacc,acc);
    grad = rotMatrix.Transpose() * rotgrad * rotMatrix;
@@ -1548,6 +1559,204 @@ void GravityField::Calculate (Real dt, Real state[6],
       MessageInterface::ShowMessage("at end of Calculate, after rotation, grad = %s\n", grad.ToString().c_str());
    #endif
 }
+
+
+//------------------------------------------------------------------------------
+// void ConvertToFixed(Real dt, Real state[6], Real fixedState[6],
+//                     Rmatrix33& rotMatrix, Real& fieldEpoch)
+//------------------------------------------------------------------------------
+/**
+ * Converts a state to the body fixed frame of the field.
+ *
+ * The conversion uses the model's converter and coordinate systems, which
+ * keep frame buffers, so it runs on the calling thread.
+ *
+ * @param dt         The time offset of the evaluation, in seconds
+ * @param state      The state in the input frame
+ * @param fixedState The state in the body fixed frame
+ * @param rotMatrix  The rotation from the input frame to the fixed frame
+ * @param fieldEpoch The A.1 Julian date used by the field summation
+ */
+//------------------------------------------------------------------------------
+void GravityField::ConvertToFixed (Real dt, Real state[6], Real fixedState[6],
+                                   Rmatrix33& rotMatrix, Real& fieldEpoch)
+{
+   Real jday, now;
+   GmatTime jdayGT, nowGT;
+   if (hasPrecisionTime)
+   {
+      jdayGT = epochGT + GmatTimeConstants::JD_JAN_5_1941;
+      jdayGT.AddSeconds(elapsedTime);
+      jdayGT.AddSeconds(dt);
+      nowGT = epochGT; nowGT.AddSeconds(elapsedTime); nowGT.AddSeconds(dt);
+      fieldEpoch = jdayGT.GetMjd();
+   }
+   else
+   {
+      jday = epoch + GmatTimeConstants::JD_JAN_5_1941 +
+         (elapsedTime + dt) / GmatTimeConstants::SECS_PER_DAY;
+      now = epoch + (elapsedTime + dt) / GmatTimeConstants::SECS_PER_DAY;
+      jdayGT = jday;
+      nowGT = now;
+      fieldEpoch = jday;
+   }
+
+//   CoordinateConverter cc; - move back to class, for performance
+   if (hasPrecisionTime)
+      cc.Convert(nowGT, state, inputCS, fixedState, fixedCS);  // which CSs to use here???
+   else
+      cc.Convert(now, state, inputCS, fixedState, fixedCS);  // which CSs to use here???
+
+   #ifdef DEBUG_CALCULATE
+      MessageInterface::ShowMessage(
+            "After Convert, jday = %s, now = %s, and tmpState = %12.10f  %12.10f  %12.10f  %12.10f  %12.10f  %12.10f\n",
+            jdayGT.ToString().c_str(), nowGT.ToString().c_str(), fixedState[0], fixedState[1], fixedState[2], fixedState[3], fixedState[4], fixedState[5]);
+   #endif
+   rotMatrix = cc.GetLastRotationMatrix();
+   #ifdef DEBUG_DERIVATIVES
+      MessageInterface::ShowMessage("---->>>> rotMatrix = %s\n", rotMatrix.ToString().c_str());
+   #endif
+}
+
+
+//------------------------------------------------------------------------------
+// void CalculateFixedField(HarmonicGravity *model, Real fieldEpoch,
+//                          Real fixedState[6], Real rotacc[3],
+//                          Rmatrix33& rotgrad)
+//------------------------------------------------------------------------------
+/**
+ * Sums the field at a body fixed state.
+ *
+ * Only the model's workspace and the immutable coefficients are used, so
+ * different models can be summed concurrently.
+ *
+ * @param model      The field model whose workspace is used
+ * @param fieldEpoch The A.1 Julian date of the evaluation
+ * @param fixedState The state in the body fixed frame
+ * @param rotacc     The acceleration in the body fixed frame
+ * @param rotgrad    The gradient in the body fixed frame, if needed
+ */
+//------------------------------------------------------------------------------
+void GravityField::CalculateFixedField (HarmonicGravity *model,
+      Real fieldEpoch, Real fixedState[6], Real rotacc[3], Rmatrix33& rotgrad)
+{
+   // Tide and polar motion data come from PrepareEpochData(), which is called
+   // once per evaluation rather than once per spacecraft
+   bool computeMatrix = fillAMatrix || fillSTM;
+
+   model->CalculateFullField(fieldEpoch, fixedState, degree, order, tideLevel,
+      sunPos, sunMu, otherPos, otherMu,
+      polarX, polarY, computeMatrix, stmLimit, rotacc, rotgrad);
+
+   #ifdef DEBUG_DERIVATIVES
+      MessageInterface::ShowMessage("after CalculateFullField, rotgrad = %s\n", rotgrad.ToString().c_str());
+   #endif
+}
+
+
+//------------------------------------------------------------------------------
+// void CalculateSpacecraftInParallel(Real dt, const Real *state)
+//------------------------------------------------------------------------------
+/**
+ * Computes the field for every spacecraft in the state vector, summing the
+ * fields on the WorkerPool.
+ *
+ * The frame conversions run first, in spacecraft order, on the calling
+ * thread.  The spacecraft are then split into contiguous blocks, one per
+ * task, and each task sums its block with its own field workspace.  The
+ * results are the same as for calls to Calculate() in spacecraft order.
+ * The accelerations, 3 per spacecraft, are returned in satAcc, and the
+ * gradients, one per spacecraft, in satGrad.
+ *
+ * @param dt    The time offset of the evaluation, in seconds
+ * @param state The state vector
+ */
+//------------------------------------------------------------------------------
+void GravityField::CalculateSpacecraftInParallel (Real dt, const Real *state)
+{
+   Integer count = cartesianCount;
+   if ((Integer)rotations.size() != count)
+   {
+      satAcc.resize(3 * count);
+      satGrad.resize(count);
+      fixedStates.resize(6 * count);
+      rotAcc.resize(3 * count);
+      rotations.resize(count);
+      rotGrad.resize(count);
+   }
+   Real fieldEpoch = 0.0;
+
+   for (Integer n = 0; n < count; ++n)
+   {
+      Real satState[6];
+      Integer nOffset = cartesianStart + n * stateSize;
+      for (Integer i = 0; i < 6; ++i)
+         satState[i] = state[i+nOffset];
+      ConvertToFixed(dt, satState, &fixedStates[6*n], rotations[n], fieldEpoch);
+   }
+
+   Integer blocks = WorkerPool::Instance()->GetThreadCount();
+   if (blocks > count)
+      blocks = count;
+   if (blocks < 1)
+      blocks = 1;
+
+   while ((Integer)workerModels.size() < blocks - 1)
+   {
+      HarmonicGravity *hg = GetHarmonicGravity(filenameFullPath,
+            tideFilenameFullPath, gravityModel->GetFieldRadius(),
+            -gravityModel->GetFactor(), body->GetName(), true);
+      if (hg == NULL)
+         throw ODEModelException("Gravity file " + filenameFullPath +
+               " cannot be opened or read.\n");
+      workerModels.push_back(hg);
+   }
+
+   // The tasks only use the lock for the time conversion in the Earth tides
+   SharedDataLock::Enable();
+   try
+   {
+      WorkerPool::Instance()->Run(blocks, [&](Integer b)
+      {
+         HarmonicGravity *model = (b == 0 ? gravityModel : workerModels[b-1]);
+         Integer first = (Integer)(((long long)b * count) / blocks);
+         Integer last  = (Integer)(((long long)(b + 1) * count) / blocks);
+         for (Integer n = first; n < last; ++n)
+            CalculateFixedField(model, fieldEpoch, &fixedStates[6*n],
+                  &rotAcc[3*n], rotGrad[n]);
+      });
+   }
+   catch (...)
+   {
+      SharedDataLock::Disable();
+      throw;
+   }
+   SharedDataLock::Disable();
+
+   // Convert back to target CS
+   for (Integer n = 0; n < count; ++n)
+   {
+      InverseRotate(rotations[n], &rotAcc[3*n], &satAcc[3*n]);
+      satGrad[n] = rotations[n].Transpose() * rotGrad[n] * rotations[n];
+   }
+}
+
+
+//------------------------------------------------------------------------------
+// void ClearWorkerModels()
+//------------------------------------------------------------------------------
+/**
+ * Deletes the field workspaces used by the extra WorkerPool tasks.
+ */
+//------------------------------------------------------------------------------
+void GravityField::ClearWorkerModels ()
+{
+   for (UnsignedInt i = 0; i < workerModels.size(); ++i)
+      delete workerModels[i];
+   workerModels.clear();
+}
+
+
 //------------------------------------------------------------------------------
 // GmatGrav::GravityModelType GetModelType(const char *filename, const char *forBody)
 //------------------------------------------------------------------------------
@@ -1677,8 +1886,14 @@ HarmonicGravity* GravityField::GetHarmonicGravity
    const Real &radius, const Real &mukm, const std::string& bodyname,
    const bool& loadCoefficients)
    {
+   // Coefficients are shared through the GravityCoefficientStore, so this is
+   // cheap once any model has loaded the file
    HarmonicGravity* hg = new HarmonicGravity (filename,tideFilename,radius,mukm,bodyname,loadCoefficients);
-   if (hg->GetNN() == 0) return NULL;
+   if (hg->GetNN() == 0)
+      {
+      delete hg;
+      return NULL;
+      }
    return hg;
    }
 //------------------------------------------------------------------------------
@@ -191,8 +191,6 @@ protected:
       GravityFieldParamCount
    };
 
-   static std::vector<HarmonicGravity*> cache;
-
    static const std::string PARAMETER_TEXT[
       GravityFieldParamCount - HarmonicFieldParamCount];
 
@@ -238,11 +236,45 @@ protected:
    CoordinateConverter cc;
    CoordinateSystem    *j2k;
 
+   // Epoch dependent field inputs, computed once per derivative evaluation
+   // and shared by every spacecraft in the state vector
+   /// Tide level applied at the current epoch
+   Integer  tideLevel;
+   /// Sun position (body fixed) and mu for the tide model
+   Real     sunPos[3];
+   Real     sunMu;
+   /// Position (body fixed) and mu of the other tide raising body
+   Real     otherPos[3];
+   Real     otherMu;
+   /// Polar motion at the current epoch
+   Real     polarX;
+   Real     polarY;
+
+   /// Field workspaces for the extra WorkerPool tasks when the spacecraft are
+   /// split; they share the coefficients of gravityModel
+   std::vector<HarmonicGravity*> workerModels;
+   /// Buffers of CalculateSpacecraftInParallel(), sized on the first call so
+   /// later calls do not allocate: the accelerations and gradients it returns,
+   /// and the body fixed states, rotations and fixed frame results
+   RealArray                     satAcc;
+   std::vector<Rmatrix33>        satGrad;
+   RealArray                     fixedStates;
+   RealArray                     rotAcc;
+   std::vector<Rmatrix33>        rotations;
+   std::vector<Rmatrix33>        rotGrad;
+
    //  JPD added these ...............
    void GetTideData (Real dt, const std::string bodyname, 
       Real pos[3], Real& mukm);
+   void PrepareEpochData (Real dt);
    void Calculate (Real dt, Real state[6],
       Real force[3], Rmatrix33& grad);
+   void ConvertToFixed (Real dt, Real state[6], Real fixedState[6],
+      Rmatrix33& rotMatrix, Real& fieldEpoch);
+   void CalculateFixedField (HarmonicGravity *model, Real fieldEpoch,
+      Real fixedState[6], Real rotacc[3], Rmatrix33& rotgrad);
+   void CalculateSpacecraftInParallel (Real dt, const Real *state);
+   void ClearWorkerModels ();
    void InverseRotate(Rmatrix33& rot, const Real in[3], Real out[3]);
    
 };
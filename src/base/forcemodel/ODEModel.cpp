@@ -71,6 +71,7 @@
 #include "GravityField.hpp"
 #include "FormationInterface.hpp"
 #include "StringUtil.hpp"
+#include "MatrixUtil.hpp"      // for the STM product
 
 #include <string.h> 
 #include <algorithm>    // for find()
@@ -292,6 +293,7 @@ ODEModel::ODEModel(const std::string &modelName, const std::string typeName) :
    warnedOnceForParameters (false),
    j2kBodyName       ("Earth"),
    j2kBody           (NULL),
+   ownCoordinateSystems (false),
    transientCount    (0),
    finiteDifferencingTimeJac (false),
    nonAnalyticTimeDerivs (NULL)
@@ -397,6 +399,7 @@ ODEModel::ODEModel(const ODEModel& fdf) :
    /// @note: Since the next three are global objects or reset by the Sandbox, 
    ///assignment works
    j2kBody                    (fdf.j2kBody),
+   ownCoordinateSystems       (fdf.ownCoordinateSystems),
    transientCount             (fdf.transientCount),
    finiteDifferencingTimeJac  (fdf.finiteDifferencingTimeJac),
    nonAnalyticTimeDerivs      (NULL)
@@ -530,6 +533,7 @@ ODEModel& ODEModel::operator=(const ODEModel& fdf)
    ///assignment works
    j2kBody             = fdf.j2kBody;
    forceMembersNotInitialized = fdf.forceMembersNotInitialized;
+   ownCoordinateSystems = fdf.ownCoordinateSystems;
    transientCount      = fdf.transientCount;
 
    finiteDifferencingTimeJac = fdf.finiteDifferencingTimeJac;
@@ -986,6 +990,46 @@ Integer ODEModel::GetNumForces()
 }
 
 
+//------------------------------------------------------------------------------
+// void SplitSpacecraft(bool truefalse)
+//------------------------------------------------------------------------------
+/**
+ * Passes the spacecraft splitting setting to the forces in the model
+ *
+ * @param truefalse true to let the forces evaluate the spacecraft on the
+ *                  WorkerPool
+ */
+//------------------------------------------------------------------------------
+void ODEModel::SplitSpacecraft(bool truefalse)
+{
+   PhysicalModel::SplitSpacecraft(truefalse);
+   for (std::vector<PhysicalModel *>::iterator current = forceList.begin();
+        current != forceList.end(); ++current)
+      (*current)->SplitSpacecraft(truefalse);
+}
+
+
+//------------------------------------------------------------------------------
+// void UseOwnCoordinateSystems(bool useOwn)
+//------------------------------------------------------------------------------
+/**
+ * Sets the forces up to use clones of the configured coordinate systems
+ *
+ * The configured systems keep frame buffers (the nutation between updates,
+ * for example) that depend on the order in which their users evaluate them.
+ * Models that are stepped concurrently use their own clones, so each model's
+ * results depend only on its own evaluations.  Call before the model is
+ * initialized.
+ *
+ * @param useOwn true to clone the coordinate systems set on the forces
+ */
+//------------------------------------------------------------------------------
+void ODEModel::UseOwnCoordinateSystems(bool useOwn)
+{
+   ownCoordinateSystems = useOwn;
+}
+
+
 //------------------------------------------------------------------------------
 // StringArray& GetForceTypeNames()
 //------------------------------------------------------------------------------
@@ -1831,6 +1875,7 @@ bool ODEModel::Initialize()
       (*current)->SetDimension(dimension);
       (*current)->ComputeMassJacobian(fillMassJacobian);
       (*current)->ComputeTimeJacobian(fillTimeJacobian);
+      (*current)->SplitSpacecraft(splitSpacecraft);
 
       // Only initialize the spacecraft independent pieces once
       if (forceMembersNotInitialized)
@@ -1946,6 +1991,9 @@ bool ODEModel::Initialize()
    if (!nonAnalyticTimeDerivs)
       return false;
 
+   if (psm != NULL)
+      RefreshStateObjects();
+
    isInitialized = true;
 
    #ifdef DEBUG_MU_MAP
@@ -2071,6 +2119,9 @@ void ODEModel::ClearInternalCoordinateSystems()
 /**
  * Manages the allocation of coordinate systems used internally.
  * 
+ * When the model uses its own coordinate systems, a system already set on the
+ * force is replaced by a clone that the model owns.
+ *
  * @param csId        Parameter name for the coordinate system label.
  * @param currentPm   Force that needs the CoordinateSystem.
  */
@@ -2088,74 +2139,87 @@ void ODEModel::SetInternalCoordinateSystem(const std::string csId,
    #endif
    csName = currentPm->GetStringParameter(csId);
 
+   GmatBase *assigned = NULL;
    try
    {
-      currentPm->GetRefObject(Gmat::COORDINATE_SYSTEM, csName);
+      assigned = currentPm->GetRefObject(Gmat::COORDINATE_SYSTEM, csName);
    }
    catch (BaseException &)
    {
-      #ifdef DEBUG_ODEMODEL_INIT
-         MessageInterface::ShowMessage(
-            "Adding a coordinate system named '%s' for the %s physical model\n",
-            csName.c_str(), currentPm->GetTypeName().c_str());
-      #endif
-      
-      for (std::vector<CoordinateSystem*>::iterator i =
-              internalCoordinateSystems.begin();
-           i != internalCoordinateSystems.end(); ++i)
-         if ((*i)->GetName() == csName)
-            cs = *i;
-      
-      if (cs == NULL)
-      {
-         std::string axisString;
-         if (csName.find("Fixed", 0) != std::string::npos)
-            axisString = "BodyFixed";
-         else
-            axisString = "MJ2000Eq";
+      assigned = NULL;
+   }
 
-         if (solarSystem == NULL)
-            throw ODEModelException("Trying to create a local coordinate "
-                  "system, but the solar system pointer is NULL");
+   // Configured systems are used as set, unless the model uses its own
+   if ((assigned != NULL) && !ownCoordinateSystems)
+      return;
 
-         SpacePoint *earthPtr = solarSystem->GetBody(GmatSolarSystemDefaults::EARTH_NAME);
-         cs = CoordinateSystem::CreateLocalCoordinateSystem(csName,
-               axisString, earthPtr, NULL, NULL, j2kBody, solarSystem);
-         
-         cs->SetName(csName);
-         cs->SetStringParameter("Origin", centralBodyName);
-         cs->SetRefObject(forceOrigin, Gmat::CELESTIAL_BODY, 
-            centralBodyName);
-         internalCoordinateSystems.push_back(cs);
-
-         // The pointers are added in CoordinateSystem::CreateLocalCoordinateSystem()
-         // #ifdef DEBUG_MEMORY
-         //    MemoryTracker::Instance()->Add
-         //       (cs, csName, "ODEModel::SetInternalCoordinateSystem()",
-         //        "cs = earthFixed->Clone()", this);
-         // #endif
+   #ifdef DEBUG_ODEMODEL_INIT
+      MessageInterface::ShowMessage(
+         "Adding a coordinate system named '%s' for the %s physical model\n",
+         csName.c_str(), currentPm->GetTypeName().c_str());
+   #endif
+   
+   for (std::vector<CoordinateSystem*>::iterator i =
+           internalCoordinateSystems.begin();
+        i != internalCoordinateSystems.end(); ++i)
+      if ((*i)->GetName() == csName)
+         cs = *i;
+   
+   if ((cs == NULL) && (assigned != NULL))
+   {
+      cs = (CoordinateSystem*)assigned->Clone();
+      internalCoordinateSystems.push_back(cs);
+   }
 
-         #ifdef DEBUG_ODEMODEL_INIT
-            MessageInterface::ShowMessage("Created %s with description\n\n%s\n", 
-               csName.c_str(), 
-               cs->GetGeneratingString(Gmat::SCRIPTING).c_str());
-         #endif
-      }
+   if (cs == NULL)
+   {
+      std::string axisString;
+      if (csName.find("Fixed", 0) != std::string::npos)
+         axisString = "BodyFixed";
+      else
+         axisString = "MJ2000Eq";
+
+      if (solarSystem == NULL)
+         throw ODEModelException("Trying to create a local coordinate "
+               "system, but the solar system pointer is NULL");
+
+      SpacePoint *earthPtr = solarSystem->GetBody(GmatSolarSystemDefaults::EARTH_NAME);
+      cs = CoordinateSystem::CreateLocalCoordinateSystem(csName,
+            axisString, earthPtr, NULL, NULL, j2kBody, solarSystem);
       
-      cs->SetSolarSystem(solarSystem);
-      cs->SetJ2000BodyName(j2kBody->GetName());
-      cs->SetJ2000Body(j2kBody);
-      cs->Initialize();
+      cs->SetName(csName);
+      cs->SetStringParameter("Origin", centralBodyName);
+      cs->SetRefObject(forceOrigin, Gmat::CELESTIAL_BODY, 
+         centralBodyName);
+      internalCoordinateSystems.push_back(cs);
+
+      // The pointers are added in CoordinateSystem::CreateLocalCoordinateSystem()
+      // #ifdef DEBUG_MEMORY
+      //    MemoryTracker::Instance()->Add
+      //       (cs, csName, "ODEModel::SetInternalCoordinateSystem()",
+      //        "cs = earthFixed->Clone()", this);
+      // #endif
 
-      #ifdef DEBUG_ODEMODEL_INIT     
-         MessageInterface::ShowMessage(
-            "New coordinate system named '%s' has definition\n%s\n",
+      #ifdef DEBUG_ODEMODEL_INIT
+         MessageInterface::ShowMessage("Created %s with description\n\n%s\n", 
             csName.c_str(), 
-            cs->GetGeneratingString(Gmat::SCRIPTING, "   ").c_str());
+            cs->GetGeneratingString(Gmat::SCRIPTING).c_str());
       #endif
-         
-      currentPm->SetRefObject(cs, Gmat::COORDINATE_SYSTEM, csName);
    }
+   
+   cs->SetSolarSystem(solarSystem);
+   cs->SetJ2000BodyName(j2kBody->GetName());
+   cs->SetJ2000Body(j2kBody);
+   cs->Initialize();
+
+   #ifdef DEBUG_ODEMODEL_INIT     
+      MessageInterface::ShowMessage(
+         "New coordinate system named '%s' has definition\n%s\n",
+         csName.c_str(), 
+         cs->GetGeneratingString(Gmat::SCRIPTING, "   ").c_str());
+   #endif
+      
+   currentPm->SetRefObject(cs, Gmat::COORDINATE_SYSTEM, csName);
 }
 
 
@@ -2342,38 +2406,57 @@ void ODEModel::UpdateInitialData(bool dynamicOnly, bool updateEpoch)
       throw ODEModelException("ODEModel::UpdateInitialData():  Cannot "
          "update the model " + instanceName + ": PropStateManager is NULL");
 
-   // Variables used to set spacecraft parameters
-   std::string parmName, stringParm;
-   std::vector<SpaceObject *>::iterator sat;
+   if (dynamicOnly)
+   {
+      // Called from GetDerivatives(): the object list is cached, and one pass
+      // updates every force
+      if (stateObjects.empty())
+         RefreshStateObjects();
+      if (!forceList.empty())
+         UpdateDynamicSpacecraftData(&stateObjects, 0);
+      parametersSetOnce = true;
+      return;
+   }
+
+   // The objects may have changed since the last call
+   RefreshStateObjects();
+
    for (std::vector<PhysicalModel*>::iterator i = forceList.begin();
         i != forceList.end(); ++i)
    {
-      stateObjects.clear();
-      psm->GetStateObjects(stateObjects, Gmat::SPACEOBJECT);
-		
-      if (dynamicOnly)
+      current = (*i);
+      if (!parametersSetOnce)
       {
-         UpdateDynamicSpacecraftData(&stateObjects, 0);
+         current->ClearSatelliteParameters();
       }
-      else
-      {
-         current = (*i);
-         if (!parametersSetOnce)
-         {
-            current->ClearSatelliteParameters();
-         }
 
-         SetupSpacecraftData(&stateObjects, 0, updateEpoch);
-      }
+      SetupSpacecraftData(&stateObjects, 0, updateEpoch);
    }
 	
-   if (!dynamicOnly)
-      psm->MapObjectsToVector();
+   psm->MapObjectsToVector();
 	
    parametersSetOnce = true;
 }
 
 
+//------------------------------------------------------------------------------
+// void RefreshStateObjects()
+//------------------------------------------------------------------------------
+/**
+ * Rebuilds the cached list of SpaceObjects propagated by this model.
+ *
+ * The list is read on every derivative evaluation, so it is built here, when
+ * the model is initialized or its spacecraft data is set up, instead of on
+ * each call.
+ */
+//------------------------------------------------------------------------------
+void ODEModel::RefreshStateObjects()
+{
+   stateObjects.clear();
+   psm->GetStateObjects(stateObjects, Gmat::SPACEOBJECT);
+}
+
+
 //------------------------------------------------------------------------------
 // void UpdateTransientForces()
 //------------------------------------------------------------------------------
@@ -2960,14 +3043,15 @@ bool ODEModel::GetDerivatives(Real * state, Real dt, Integer order,
       }
    #endif
 
-   // Temporary code: prevent multiple spacecraft in finite burn PropSetup
-   stateObjects.clear();
-
    if (psm == NULL)
       throw ODEModelException("ODEModel::GetDerivatives():  Cannot "
          "get derivatives for " + instanceName + ": PropStateManager is NULL");
 
-   psm->GetStateObjects(stateObjects, Gmat::SPACEOBJECT);
+   // The object list is cached in Initialize() and UpdateInitialData()
+   if (stateObjects.empty())
+      RefreshStateObjects();
+
+   // Temporary code: prevent multiple spacecraft in finite burn PropSetup
    if ((transientCount > 0) && (stateObjects.size() > 1))
       throw ODEModelException("Multiple Spacecraft are not allowed in "
             "a propagator driving a finite burn; try breaking commands "
@@ -3461,18 +3545,8 @@ bool ODEModel::CompleteDerivativeCalculations(Real *state)
       {
          // Convert A to Phi dot for STM pieces
          // \Phi\dot = A\tilde \Phi
-         for (Integer j = 0; j < stmRows; ++j)
-         {
-            for (Integer k = 0; k < stmRows; ++k)
-            {
-               Integer element = j * stmRows + k;
-               deriv[i6+element] = 0.0;
-               for (Integer l = 0; l < stmRows; ++l)
-               {
-                  deriv[i6+element] += aTilde[j*stmRows+l] * state[i6+l*stmRows+k];
-               }
-            }
-         }
+         GmatMatrixUtil::Multiply(false, false, stmRows, stmRows, stmRows,
+               1.0, aTilde, &state[i6], 0.0, &deriv[i6]);
 		}
 
       delete [] aTilde;
@@ -4975,6 +5049,9 @@ void ODEModel::SetPropStateManager(PropagationStateManager *sm)
    PhysicalModel::SetPropStateManager(sm);
    for (UnsignedInt i = 0; i < forceList.size(); ++i)
       forceList[i]->SetPropStateManager(psm);
+
+   // Rebuilt from the new manager on first use
+   stateObjects.clear();
 }
 
 
@@ -125,6 +125,8 @@ public:
    virtual bool GetDerivatives(Real * state, Real dt = 0.0, Integer order = 1, 
          const Integer id = -1);
    virtual Real EstimateError(Real *diffs, Real *answer) const;
+   virtual void SplitSpacecraft(bool truefalse);
+   void         UseOwnCoordinateSystems(bool useOwn);
 
    // Methods used for parameter access
    virtual Rvector6 GetDerivativesForSpacecraft(Spacecraft *sc);
@@ -402,9 +404,14 @@ protected:
    /// Locally defined coordinate systems, if needed
    std::vector <CoordinateSystem*>
                              internalCoordinateSystems;
+   /// Flag indicating that the forces use clones of the configured coordinate
+   /// systems, so their frame buffers are not shared with other models
+   bool                      ownCoordinateSystems;
    
+   /// SpaceObjects propagated by this model, cached for GetDerivatives()
    ObjectArray               stateObjects;
    
+   void                      RefreshStateObjects();
    void                      MoveToOrigin(Real newEpoch = -1.0);
    void                      ReturnFromOrigin(Real newEpoch = -1.0);
    void                      MoveToOriginGT(GmatTime newEpoch = -1.0);
@@ -198,7 +198,8 @@ PhysicalModel::PhysicalModel(UnsignedInt id, const std::string &typeStr,
    hasMassJacobian             (false),
    fillMassJacobian            (false),
    hasTimeJacobian             (false),
-   fillTimeJacobian            (false)
+   fillTimeJacobian            (false),
+   splitSpacecraft             (false)
 {
    objectTypes.push_back(Gmat::PHYSICAL_MODEL);
    objectTypeNames.push_back("PhysicalModel");
@@ -313,7 +314,8 @@ PhysicalModel::PhysicalModel(const PhysicalModel& pm) :
    hasMassJacobian             (pm.hasMassJacobian),   // Might remove after MJ work
    fillMassJacobian            (pm.fillMassJacobian),
    hasTimeJacobian             (pm.hasTimeJacobian),
-   fillTimeJacobian            (pm.fillTimeJacobian)
+   fillTimeJacobian            (pm.fillTimeJacobian),
+   splitSpacecraft             (pm.splitSpacecraft)
 {
    if (pm.modelState != NULL) 
    {
@@ -416,6 +418,7 @@ PhysicalModel& PhysicalModel::operator=(const PhysicalModel& pm)
    fillMassJacobian = pm.fillMassJacobian;
    hasTimeJacobian  = pm.hasTimeJacobian;
    fillTimeJacobian = pm.fillTimeJacobian;
+   splitSpacecraft  = pm.splitSpacecraft;
 
    theState = pm.theState;
 	scObjs         = pm.scObjs;                           // made changes by TUAN NGUYEN
@@ -2385,6 +2388,21 @@ void PhysicalModel::ComputeTimeJacobian(bool truefalse)
    fillTimeJacobian = truefalse;
 }
 
+//------------------------------------------------------------------------------
+// void SplitSpacecraft(bool truefalse)
+//------------------------------------------------------------------------------
+/**
+ * Toggle function for spreading the spacecraft over the WorkerPool
+ *
+ * Models that support it evaluate the spacecraft in the state vector
+ * concurrently; the results are the same as for serial evaluation.
+ */
+//------------------------------------------------------------------------------
+void PhysicalModel::SplitSpacecraft(bool truefalse)
+{
+   splitSpacecraft = truefalse;
+}
+
 //------------------------------------------------------------------------------
 // bool HasMassJacobian()
 //------------------------------------------------------------------------------
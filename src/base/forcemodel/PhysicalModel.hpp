@@ -283,6 +283,8 @@ public:
    void                ComputeMassJacobian(bool truefalse);
    /// Toggle time Jacobian computation
    void                ComputeTimeJacobian(bool truefalse);
+   /// Toggle spreading the spacecraft over the WorkerPool
+   virtual void        SplitSpacecraft(bool truefalse);
    /// Test to see if the mass Jacobian is implemented
    bool                HasMassJacobian();
    /// Test to see if the time Jacobian is implemented
@@ -383,6 +385,9 @@ protected:
    /// Trigger to build the time Jacobian data
    bool                      fillTimeJacobian;
 
+   /// Flag allowing the spacecraft to be evaluated on the WorkerPool
+   bool                      splitSpacecraft;
+
       /// Time converter singleton
    TimeSystemConverter *theTimeConverter;
 
@@ -480,64 +480,38 @@ bool PointMassForce::GetDerivatives(Real * state, Real dt, Integer order,
       
       if (fillCartesian)
       {
+         ComputeAccelerations(state, rv, a_indirect);
+
          for (Integer i = 0; i < satCount; i++) 
          {
             i6 = cartesianStart + i * 6;
-            
-            relativePosition[0] = rv[0] - state[ i6 ];
-            relativePosition[1] = rv[1] - state[i6+1];
-            relativePosition[2] = rv[2] - state[i6+2];
-      
-            r3 = relativePosition[0]*relativePosition[0] + 
-                 relativePosition[1]*relativePosition[1] + 
-                 relativePosition[2]*relativePosition[2];
-            
-            radius = sqrt(r3);
-            r3 *= radius;
-            mu_r = mu / r3;
-      
+
             #ifdef DEBUG_INDIRECT_TERM
-               MessageInterface::ShowMessage("   Raw acc for sp %d:  ", i);
-               MessageInterface::ShowMessage("[%16le %16le %16le]\n",
-                     relativePosition[0] * mu_r, relativePosition[1] * mu_r,
-                     relativePosition[2] * mu_r);
-               MessageInterface::ShowMessage("   Corrected acc =     [%16le "
-                     "%16le %16le]\n",
-                     relativePosition[0] * mu_r - a_indirect[0],
-                     relativePosition[1] * mu_r - a_indirect[1],
-                     relativePosition[2] * mu_r - a_indirect[2]);
+               MessageInterface::ShowMessage("   Corrected acc for sp %d =  "
+                     "[%16le %16le %16le]\n", i, accX[i], accY[i], accZ[i]);
             #endif
 
             if (order == 1) 
             {
                // Do dv/dt first, in case deriv = state
-               deriv[3 + i6] = relativePosition[0] * mu_r - a_indirect[0];
-               deriv[4 + i6] = relativePosition[1] * mu_r - a_indirect[1];
-               deriv[5 + i6] = relativePosition[2] * mu_r - a_indirect[2];
+               deriv[3 + i6] = accX[i];
+               deriv[4 + i6] = accY[i];
+               deriv[5 + i6] = accZ[i];
 
                /// ODEModel now fills in the velocity part, so removed it here
-               // dr/dt = v, but only fill this piece for the central body
-               //if (rbb3 == 0.0)
-               //{
-               //   deriv[i6]     = state[3 + i6];
-               //   deriv[1 + i6] = state[4 + i6];
-               //   deriv[2 + i6] = state[5 + i6];
-               //}
-               //else
                deriv[i6] = deriv[1 + i6] = deriv[2 + i6] = 0.0;
                #ifdef DEBUG_DERIVATIVES_FOR_SPACECRAFT
                   if ((dt == 0) && (i6 == 0))                  
                      MessageInterface::ShowMessage("***PMF AX in GD   : "
-                        "%.12lf * %.12le - %.12le = %.12le\n", 
-                        relativePosition[0], mu_r, a_indirect[0], deriv[3]);
+                        "%.12le\n", deriv[3]);
                #endif
             } 
             else 
             {
                // Feed accelerations to corresponding components directly for RKN
-               deriv[ i6 ] = relativePosition[0] * mu_r - a_indirect[0]; 
-               deriv[i6+1] = relativePosition[1] * mu_r - a_indirect[1]; 
-               deriv[i6+2] = relativePosition[2] * mu_r - a_indirect[2]; 
+               deriv[ i6 ] = accX[i]; 
+               deriv[i6+1] = accY[i]; 
+               deriv[i6+2] = accZ[i]; 
                deriv[i6+3] = 0.0; 
                deriv[i6+4] = 0.0; 
                deriv[i6+5] = 0.0; 
@@ -681,6 +655,65 @@ bool PointMassForce::GetDerivatives(Real * state, Real dt, Integer order,
    return true;
 }
 
+//------------------------------------------------------------------------------
+// void ComputeAccelerations(const Real *state, const Real bodyPos[3],
+//                           const Real aIndirect[3])
+//------------------------------------------------------------------------------
+/**
+ * Computes the point mass acceleration on every spacecraft in the state.
+ *
+ * The body position and indirect term are computed once per evaluation by the
+ * caller.  The spacecraft positions are gathered into contiguous component
+ * arrays, and the acceleration loop then runs over those arrays with no
+ * branches or strided access, so the compiler can vectorize it across
+ * spacecraft.  The arithmetic is the same as the per-spacecraft form, so
+ * results are unchanged.
+ *
+ * @param state     The state vector
+ * @param bodyPos   Position of the body relative to the force origin
+ * @param aIndirect The indirect acceleration term
+ */
+//------------------------------------------------------------------------------
+void PointMassForce::ComputeAccelerations(const Real *state,
+      const Real bodyPos[3], const Real aIndirect[3])
+{
+   if ((Integer)relX.size() != satCount)
+   {
+      relX.resize(satCount);
+      relY.resize(satCount);
+      relZ.resize(satCount);
+      accX.resize(satCount);
+      accY.resize(satCount);
+      accZ.resize(satCount);
+   }
+
+   Real *rx = relX.data(), *ry = relY.data(), *rz = relZ.data();
+   Real *ax = accX.data(), *ay = accY.data(), *az = accZ.data();
+
+   // Gather
+   const Real *pos = state + cartesianStart;
+   for (Integer i = 0; i < satCount; ++i, pos += 6)
+   {
+      rx[i] = bodyPos[0] - pos[0];
+      ry[i] = bodyPos[1] - pos[1];
+      rz[i] = bodyPos[2] - pos[2];
+   }
+
+   // Kernel
+   Real r3, radius, mu_r;
+   for (Integer i = 0; i < satCount; ++i)
+   {
+      r3 = rx[i]*rx[i] + ry[i]*ry[i] + rz[i]*rz[i];
+      radius = sqrt(r3);
+      r3 *= radius;
+      mu_r = mu / r3;
+
+      ax[i] = rx[i] * mu_r - aIndirect[0];
+      ay[i] = ry[i] * mu_r - aIndirect[1];
+      az[i] = rz[i] * mu_r - aIndirect[2];
+   }
+}
+
 //------------------------------------------------------------------------------
 // bool PointMassForce::GetComponentMap(Integer * map, Integer order) const
 //------------------------------------------------------------------------------
@@ -166,6 +166,15 @@ protected:
 
    Integer satCount;
 //   Integer cartIndex;
+
+   /// Spacecraft positions relative to the body, laid out contiguously by
+   /// component so the acceleration kernel vectorizes across spacecraft
+   RealArray relX, relY, relZ;
+   /// Accelerations from the kernel, in the same layout
+   RealArray accX, accY, accZ;
+
+   void ComputeAccelerations(const Real *state, const Real bodyPos[3],
+                             const Real aIndirect[3]);
    
    // for Debug
    void ShowBodyState(const std::string &header, Real time, Rvector6 &rv);
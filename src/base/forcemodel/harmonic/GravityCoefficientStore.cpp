@@ -0,0 +1,634 @@
+//$Id$
+//------------------------------------------------------------------------------
+//                           GravityCoefficientStore
+//------------------------------------------------------------------------------
+// GMAT: General Mission Analysis Tool
+//
+// Copyright (c) 2002 - 2020 United States Government as represented by the
+// Administrator of the National Aeronautics and Space Administration.
+// All Other Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// You may not use this file except in compliance with the License.
+// You may obtain a copy of the License at:
+// http://www.apache.org/licenses/LICENSE-2.0.
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied.   See the License for the specific language
+// governing permissions and limitations under the License.
+//
+// Author: GMAT Development Team
+// Created: 2026/10/17
+//
+/**
+ * Implements the process-wide store of parsed gravity coefficient sets and
+ * its binary cache files.
+ */
+//------------------------------------------------------------------------------
+#include "GravityCoefficientStore.hpp"
+#include "MemoryMappedFile.hpp"
+#include "MessageInterface.hpp"
+#include <fstream>
+#include <sstream>
+#include <cstdio>
+#include <cstring>
+#include <sys/stat.h>
+
+#ifdef _WIN32
+#include <process.h>
+#else
+#include <unistd.h>
+#endif
+
+//#define DEBUG_GRAVITY_STORE
+
+//---------------------------------
+// static data
+//---------------------------------
+std::map<std::string, GravityCoefficients*> GravityCoefficientStore::entries;
+std::mutex GravityCoefficientStore::storeMutex;
+
+namespace
+{
+   /// Binary cache file identification; bump the version on layout changes
+   const char    CACHE_MAGIC[8]     = { 'G','M','A','T','G','R','V','\0' };
+   const Integer CACHE_VERSION      = 1;
+   const char    *CACHE_EXTENSION   = ".gmatbin";
+
+   /// Flag bits stored in the binary cache file header
+   const Integer FLAG_NORMALIZED    = 1;
+   const Integer FLAG_ZERO_TIDE     = 2;
+   const Integer FLAG_TIDE_FREE     = 4;
+   const Integer FLAG_LOVE_NUMBERS  = 8;
+
+   /**
+    * Header of a binary cache file.  It is followed by the zero tide values
+    * (n, m, C, S as Reals), then the C block and the S block.  All members
+    * are 8-byte aligned so the blocks can be used in place from the mapping.
+    */
+   struct CacheFileHeader
+   {
+      char               magic[8];
+      Integer            version;
+      Integer            headerSize;
+      unsigned long long checksum;
+      Integer            nn;
+      Integer            mm;
+      Integer            flags;
+      Integer            zeroTideMax;
+      Integer            zeroTideCount;
+      Integer            unused;
+      Real               fieldRadius;
+      Real               factor;
+      Real               k[LoveMax+1][LoveMax+1];
+      Real               kPlus[LoveMax+1];
+      char               modelName[128];
+   };
+
+   //---------------------------------------------------------------------------
+   // unsigned long long HashBytes(const char *data, size_t size,
+   //                              unsigned long long hash)
+   //---------------------------------------------------------------------------
+   /**
+    * Folds a byte range into a 64-bit FNV-1a hash.
+    */
+   //---------------------------------------------------------------------------
+   unsigned long long HashBytes(const char *data, size_t size,
+                                unsigned long long hash)
+   {
+      const unsigned char *bytes = (const unsigned char*)data;
+      for (size_t i = 0; i < size; ++i)
+      {
+         hash ^= bytes[i];
+         hash *= 1099511628211ULL;
+      }
+      return hash;
+   }
+
+   //---------------------------------------------------------------------------
+   // size_t GetBlockSize(Integer nn)
+   //---------------------------------------------------------------------------
+   size_t GetBlockSize(Integer nn)
+   {
+      return (size_t)(nn + 1) * (size_t)(nn + 1);
+   }
+}
+
+//---------------------------------
+// GravityCoefficients
+//---------------------------------
+
+//------------------------------------------------------------------------------
+// GravityCoefficients()
+//------------------------------------------------------------------------------
+GravityCoefficients::GravityCoefficients() :
+   NN              (0),
+   MM              (0),
+   FieldRadius     (0.0),
+   Factor          (0.0),
+   ModelName       (""),
+   Normalized      (true),
+   HaveZeroTide    (false),
+   HaveTideFree    (true),
+   HaveLoveNumbers (false),
+   ZeroTideMax     (0),
+   CBlock          (NULL),
+   SBlock          (NULL),
+   mapping         (NULL),
+   refCount        (0),
+   stale           (false),
+   sourceStamp     ("")
+{
+   for (Integer i = 0; i <= LoveMax; ++i)
+   {
+      for (Integer j = 0; j <= LoveMax; ++j)
+         K[i][j] = 0.0;
+      KPlus[i] = 0.0;
+   }
+}
+
+
+//------------------------------------------------------------------------------
+// ~GravityCoefficients()
+//------------------------------------------------------------------------------
+GravityCoefficients::~GravityCoefficients()
+{
+   MemoryMappedFile::Release(mapping);
+}
+
+
+//---------------------------------
+// GravityCoefficientStore, public
+//---------------------------------
+
+//------------------------------------------------------------------------------
+// const GravityCoefficients* Acquire(const std::string &filename,
+//       const std::string &tideFilename, const std::string &bodyName)
+//------------------------------------------------------------------------------
+/**
+ * Returns the shared coefficients for a model, from memory or from its binary
+ * cache file.
+ *
+ * @param filename     Full path of the potential file
+ * @param tideFilename Full path of the tide file, or an empty string
+ * @param bodyName     Name of the central body
+ *
+ * @return The coefficients, or NULL if the model must be parsed and passed to
+ *         Add().  Each non-NULL return must be balanced by a Release().
+ */
+//------------------------------------------------------------------------------
+const GravityCoefficients* GravityCoefficientStore::Acquire(
+      const std::string &filename, const std::string &tideFilename,
+      const std::string &bodyName)
+{
+   std::string key   = MakeKey(filename, tideFilename, bodyName);
+   std::string stamp = GetSourceStamp(filename, tideFilename);
+
+   {
+      std::lock_guard<std::mutex> lock(storeMutex);
+
+      std::map<std::string, GravityCoefficients*>::iterator i =
+            entries.find(key);
+      if (i != entries.end())
+      {
+         GravityCoefficients *entry = i->second;
+         if (entry->sourceStamp == stamp)
+         {
+            ++(entry->refCount);
+            return entry;
+         }
+
+         // The files were edited since the entry was loaded; retire it
+         entries.erase(i);
+         if (entry->refCount == 0)
+            delete entry;
+         else
+            entry->stale = true;
+      }
+   }
+
+   GravityCoefficients *coefficients =
+         ReadCacheFile(filename, ComputeChecksum(filename, tideFilename,
+         bodyName));
+   if (coefficients == NULL)
+      return NULL;
+
+   return Insert(key, stamp, coefficients);
+}
+
+
+//------------------------------------------------------------------------------
+// const GravityCoefficients* Add(const std::string &filename,
+//       const std::string &tideFilename, const std::string &bodyName,
+//       GravityCoefficients *coefficients)
+//------------------------------------------------------------------------------
+/**
+ * Hands a freshly parsed coefficient set to the store.
+ *
+ * The set is written to the binary cache file and, when that succeeds,
+ * replaced by the mapped copy so it is shared with other processes.
+ *
+ * @param filename     Full path of the potential file
+ * @param tideFilename Full path of the tide file, or an empty string
+ * @param bodyName     Name of the central body
+ * @param coefficients The parsed set; the store takes ownership
+ *
+ * @return The shared coefficients, to be balanced by a Release()
+ */
+//------------------------------------------------------------------------------
+const GravityCoefficients* GravityCoefficientStore::Add(
+      const std::string &filename, const std::string &tideFilename,
+      const std::string &bodyName, GravityCoefficients *coefficients)
+{
+   std::string key   = MakeKey(filename, tideFilename, bodyName);
+   std::string stamp = GetSourceStamp(filename, tideFilename);
+   unsigned long long checksum = ComputeChecksum(filename, tideFilename,
+         bodyName);
+
+   if (WriteCacheFile(filename, checksum, *coefficients))
+   {
+      GravityCoefficients *mapped = ReadCacheFile(filename, checksum);
+      if (mapped != NULL)
+      {
+         delete coefficients;
+         coefficients = mapped;
+      }
+   }
+
+   return Insert(key, stamp, coefficients);
+}
+
+
+//------------------------------------------------------------------------------
+// void Release(const GravityCoefficients *coefficients)
+//------------------------------------------------------------------------------
+/**
+ * Drops one reference to a coefficient set.
+ *
+ * Unused sets stay loaded so that later models (e.g. force model clones) find
+ * them; ReleaseUnused() frees them.  Retired sets are freed with their last
+ * reference.
+ *
+ * @param coefficients The set returned from Acquire() or Add(); NULL is
+ *                     ignored
+ */
+//------------------------------------------------------------------------------
+void GravityCoefficientStore::Release(const GravityCoefficients *coefficients)
+{
+   if (coefficients == NULL)
+      return;
+
+   std::lock_guard<std::mutex> lock(storeMutex);
+
+   GravityCoefficients *entry = const_cast<GravityCoefficients*>(coefficients);
+   if ((--(entry->refCount) == 0) && entry->stale)
+      delete entry;
+}
+
+
+//------------------------------------------------------------------------------
+// void ReleaseUnused()
+//------------------------------------------------------------------------------
+/**
+ * Frees the coefficient sets that no model references.
+ */
+//------------------------------------------------------------------------------
+void GravityCoefficientStore::ReleaseUnused()
+{
+   std::lock_guard<std::mutex> lock(storeMutex);
+
+   std::map<std::string, GravityCoefficients*>::iterator i = entries.begin();
+   while (i != entries.end())
+   {
+      if (i->second->refCount == 0)
+      {
+         delete i->second;
+         entries.erase(i++);
+      }
+      else
+         ++i;
+   }
+}
+
+
+//------------------------------------------------------------------------------
+// Integer GetEntryCount()
+//------------------------------------------------------------------------------
+Integer GravityCoefficientStore::GetEntryCount()
+{
+   std::lock_guard<std::mutex> lock(storeMutex);
+   return (Integer)entries.size();
+}
+
+
+//------------------------------------------------------------------------------
+// std::string GetCacheFileName(const std::string &filename)
+//------------------------------------------------------------------------------
+/**
+ * Returns the name of the binary cache file kept next to a potential file.
+ */
+//------------------------------------------------------------------------------
+std::string GravityCoefficientStore::GetCacheFileName(
+      const std::string &filename)
+{
+   return filename + CACHE_EXTENSION;
+}
+
+
+//---------------------------------
+// GravityCoefficientStore, private
+//---------------------------------
+
+//------------------------------------------------------------------------------
+// std::string MakeKey(const std::string &filename,
+//       const std::string &tideFilename, const std::string &bodyName)
+//------------------------------------------------------------------------------
+std::string GravityCoefficientStore::MakeKey(const std::string &filename,
+      const std::string &tideFilename, const std::string &bodyName)
+{
+   // The body matters: Earth models get default Love numbers on load
+   return filename + "|" + tideFilename + "|" + bodyName;
+}
+
+
+//------------------------------------------------------------------------------
+// std::string GetSourceStamp(const std::string &filename,
+//       const std::string &tideFilename)
+//------------------------------------------------------------------------------
+/**
+ * Builds a cheap size and modification time signature of the source files,
+ * used to notice edits to files whose coefficients are already loaded.
+ */
+//------------------------------------------------------------------------------
+std::string GravityCoefficientStore::GetSourceStamp(
+      const std::string &filename, const std::string &tideFilename)
+{
+   std::string stamp;
+   const std::string *names[2] = { &filename, &tideFilename };
+
+   for (Integer i = 0; i < 2; ++i)
+   {
+      struct stat fileStat;
+      if ((names[i]->empty()) || (stat(names[i]->c_str(), &fileStat) != 0))
+         stamp += "-|";
+      else
+      {
+         std::stringstream ss;
+         ss << fileStat.st_size << ":" << fileStat.st_mtime << "|";
+         stamp += ss.str();
+      }
+   }
+
+   return stamp;
+}
+
+
+//------------------------------------------------------------------------------
+// unsigned long long ComputeChecksum(const std::string &filename,
+//       const std::string &tideFilename, const std::string &bodyName)
+//------------------------------------------------------------------------------
+/**
+ * Hashes the contents of the source files and the body name.
+ *
+ * The checksum ties a binary cache file to the exact text it was built from.
+ */
+//------------------------------------------------------------------------------
+unsigned long long GravityCoefficientStore::ComputeChecksum(
+      const std::string &filename, const std::string &tideFilename,
+      const std::string &bodyName)
+{
+   unsigned long long hash = 14695981039346656037ULL;
+   const std::string *names[2] = { &filename, &tideFilename };
+
+   for (Integer i = 0; i < 2; ++i)
+   {
+      MemoryMappedFile *source = NULL;
+      if (!names[i]->empty())
+         source = MemoryMappedFile::Open(*names[i]);
+      if (source != NULL)
+      {
+         hash = HashBytes(source->GetData(), source->GetSize(), hash);
+         MemoryMappedFile::Release(source);
+      }
+      // Separator, so content cannot shift between the two files
+      hash = HashBytes("|", 1, hash);
+   }
+
+   return HashBytes(bodyName.c_str(), bodyName.size(), hash);
+}
+
+
+//------------------------------------------------------------------------------
+// GravityCoefficients* ReadCacheFile(const std::string &filename,
+//       unsigned long long checksum)
+//------------------------------------------------------------------------------
+/**
+ * Maps the binary cache file of a potential file.
+ *
+ * @param filename Full path of the potential file
+ * @param checksum Checksum of the current source files
+ *
+ * @return A new coefficient set using the mapping, or NULL if there is no
+ *         cache file or it is out of date or malformed
+ */
+//------------------------------------------------------------------------------
+GravityCoefficients* GravityCoefficientStore::ReadCacheFile(
+      const std::string &filename, unsigned long long checksum)
+{
+   std::string cacheName = GetCacheFileName(filename);
+   MemoryMappedFile *mapping = MemoryMappedFile::Open(cacheName);
+   if (mapping == NULL)
+      return NULL;
+
+   CacheFileHeader header;
+   bool valid = (mapping->GetSize() >= sizeof(CacheFileHeader));
+   if (valid)
+   {
+      memcpy(&header, mapping->GetData(), sizeof(CacheFileHeader));
+      valid = (memcmp(header.magic, CACHE_MAGIC, 8) == 0) &&
+              (header.version == CACHE_VERSION) &&
+              (header.headerSize == (Integer)sizeof(CacheFileHeader)) &&
+              (header.checksum == checksum) &&
+              (header.nn > 0) && (header.mm >= 0) && (header.mm <= header.nn) &&
+              (header.zeroTideCount >= 0);
+   }
+   if (valid)
+      valid = (mapping->GetSize() == sizeof(CacheFileHeader) +
+               (4 * (size_t)header.zeroTideCount +
+               2 * GetBlockSize(header.nn)) * sizeof(Real));
+
+   if (!valid)
+   {
+      #ifdef DEBUG_GRAVITY_STORE
+         MessageInterface::ShowMessage("GravityCoefficientStore: %s is out "
+               "of date or malformed\n", cacheName.c_str());
+      #endif
+      MemoryMappedFile::Release(mapping);
+      return NULL;
+   }
+
+   GravityCoefficients *coefficients = new GravityCoefficients();
+   coefficients->NN              = header.nn;
+   coefficients->MM              = header.mm;
+   coefficients->FieldRadius     = header.fieldRadius;
+   coefficients->Factor          = header.factor;
+   header.modelName[sizeof(header.modelName) - 1] = '\0';
+   coefficients->ModelName       = header.modelName;
+   coefficients->Normalized      = ((header.flags & FLAG_NORMALIZED) != 0);
+   coefficients->HaveZeroTide    = ((header.flags & FLAG_ZERO_TIDE) != 0);
+   coefficients->HaveTideFree    = ((header.flags & FLAG_TIDE_FREE) != 0);
+   coefficients->HaveLoveNumbers = ((header.flags & FLAG_LOVE_NUMBERS) != 0);
+   coefficients->ZeroTideMax     = header.zeroTideMax;
+   for (Integer i = 0; i <= LoveMax; ++i)
+   {
+      for (Integer j = 0; j <= LoveMax; ++j)
+         coefficients->K[i][j] = header.k[i][j];
+      coefficients->KPlus[i] = header.kPlus[i];
+   }
+
+   const Real *payload =
+         (const Real*)(mapping->GetData() + sizeof(CacheFileHeader));
+   for (Integer i = 0; i < header.zeroTideCount; ++i, payload += 4)
+      coefficients->ZeroTideValues.push_back(HarmonicValue((Integer)payload[0],
+            (Integer)payload[1], payload[2], payload[3]));
+
+   coefficients->CBlock  = payload;
+   coefficients->SBlock  = payload + GetBlockSize(header.nn);
+   coefficients->mapping = mapping;
+
+   #ifdef DEBUG_GRAVITY_STORE
+      MessageInterface::ShowMessage("GravityCoefficientStore: mapped %s, "
+            "degree %d order %d\n", cacheName.c_str(), header.nn, header.mm);
+   #endif
+
+   return coefficients;
+}
+
+
+//------------------------------------------------------------------------------
+// bool WriteCacheFile(const std::string &filename,
+//       unsigned long long checksum, const GravityCoefficients &coefficients)
+//------------------------------------------------------------------------------
+/**
+ * Writes the binary cache file of a potential file.
+ *
+ * The file is written under a process-specific name and renamed into place,
+ * so concurrent processes never see a partial file.  Failures (for example a
+ * read-only data directory) are not errors; the model is then simply parsed
+ * again by the next process.
+ *
+ * @return true if the cache file is in place
+ */
+//------------------------------------------------------------------------------
+bool GravityCoefficientStore::WriteCacheFile(const std::string &filename,
+      unsigned long long checksum, const GravityCoefficients &coefficients)
+{
+   CacheFileHeader header;
+   memset(&header, 0, sizeof(CacheFileHeader));
+   memcpy(header.magic, CACHE_MAGIC, 8);
+   header.version       = CACHE_VERSION;
+   header.headerSize    = (Integer)sizeof(CacheFileHeader);
+   header.checksum      = checksum;
+   header.nn            = coefficients.NN;
+   header.mm            = coefficients.MM;
+   header.flags         = (coefficients.Normalized      ? FLAG_NORMALIZED   : 0) |
+                          (coefficients.HaveZeroTide    ? FLAG_ZERO_TIDE    : 0) |
+                          (coefficients.HaveTideFree    ? FLAG_TIDE_FREE    : 0) |
+                          (coefficients.HaveLoveNumbers ? FLAG_LOVE_NUMBERS : 0);
+   header.zeroTideMax   = coefficients.ZeroTideMax;
+   header.zeroTideCount = (Integer)coefficients.ZeroTideValues.size();
+   header.fieldRadius   = coefficients.FieldRadius;
+   header.factor        = coefficients.Factor;
+   for (Integer i = 0; i <= LoveMax; ++i)
+   {
+      for (Integer j = 0; j <= LoveMax; ++j)
+         header.k[i][j] = coefficients.K[i][j];
+      header.kPlus[i] = coefficients.KPlus[i];
+   }
+   strncpy(header.modelName, coefficients.ModelName.c_str(),
+         sizeof(header.modelName) - 1);
+
+   std::string cacheName = GetCacheFileName(filename);
+   #ifdef _WIN32
+      Integer pid = (Integer)_getpid();
+   #else
+      Integer pid = (Integer)getpid();
+   #endif
+   std::stringstream partName;
+   partName << cacheName << "." << pid;
+
+   std::ofstream out(partName.str().c_str(), std::ios::out | std::ios::binary);
+   if (!out.good())
+      return false;
+
+   out.write((const char*)&header, sizeof(CacheFileHeader));
+   for (UnsignedInt i = 0; i < coefficients.ZeroTideValues.size(); ++i)
+   {
+      const HarmonicValue &value = coefficients.ZeroTideValues[i];
+      Real record[4] = { (Real)value.N, (Real)value.M, value.C, value.S };
+      out.write((const char*)record, sizeof(record));
+   }
+   size_t blockBytes = GetBlockSize(coefficients.NN) * sizeof(Real);
+   out.write((const char*)coefficients.CBlock, blockBytes);
+   out.write((const char*)coefficients.SBlock, blockBytes);
+   out.close();
+
+   bool written = !out.fail();
+   if (written && (std::rename(partName.str().c_str(), cacheName.c_str()) != 0))
+   {
+      // Windows does not rename over an existing file
+      std::remove(cacheName.c_str());
+      written = (std::rename(partName.str().c_str(), cacheName.c_str()) == 0);
+   }
+   if (!written)
+      std::remove(partName.str().c_str());
+
+   #ifdef DEBUG_GRAVITY_STORE
+      MessageInterface::ShowMessage("GravityCoefficientStore: %s %s\n",
+            (written ? "wrote" : "could not write"), cacheName.c_str());
+   #endif
+
+   return written;
+}
+
+
+//------------------------------------------------------------------------------
+// const GravityCoefficients* Insert(const std::string &key,
+//       const std::string &stamp, GravityCoefficients *coefficients)
+//------------------------------------------------------------------------------
+/**
+ * Registers a loaded coefficient set, or discards it in favor of a current set
+ * that another thread registered first.
+ */
+//------------------------------------------------------------------------------
+const GravityCoefficients* GravityCoefficientStore::Insert(
+      const std::string &key, const std::string &stamp,
+      GravityCoefficients *coefficients)
+{
+   std::lock_guard<std::mutex> lock(storeMutex);
+
+   std::map<std::string, GravityCoefficients*>::iterator i = entries.find(key);
+   if (i != entries.end())
+   {
+      GravityCoefficients *entry = i->second;
+      if (entry->sourceStamp == stamp)
+      {
+         delete coefficients;
+         ++(entry->refCount);
+         return entry;
+      }
+
+      entries.erase(i);
+      if (entry->refCount == 0)
+         delete entry;
+      else
+         entry->stale = true;
+   }
+
+   coefficients->sourceStamp = stamp;
+   coefficients->refCount    = 1;
+   entries[key] = coefficients;
+
+   return coefficients;
+}
@@ -0,0 +1,137 @@
+//$Id$
+//------------------------------------------------------------------------------
+//                           GravityCoefficientStore
+//------------------------------------------------------------------------------
+// GMAT: General Mission Analysis Tool
+//
+// Copyright (c) 2002 - 2020 United States Government as represented by the
+// Administrator of the National Aeronautics and Space Administration.
+// All Other Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// You may not use this file except in compliance with the License.
+// You may obtain a copy of the License at:
+// http://www.apache.org/licenses/LICENSE-2.0.
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied.   See the License for the specific language
+// governing permissions and limitations under the License.
+//
+// Author: GMAT Development Team
+// Created: 2026/10/17
+//
+/**
+ * Declares the process-wide store of parsed gravity coefficient sets.
+ *
+ * Every HarmonicGravity built from the same potential file, tide file and body
+ * shares one read-only GravityCoefficients record.  The first process to parse
+ * a text potential file also writes a binary image of it next to the source
+ * (<file>.gmatbin), stamped with a checksum of the source files; later loads
+ * map that image instead of parsing, so concurrent GMAT processes share the
+ * same pages.
+ */
+//------------------------------------------------------------------------------
+#ifndef GravityCoefficientStore_hpp
+#define GravityCoefficientStore_hpp
+
+#include "gmatdefs.hpp"
+#include "HarmonicGravity.hpp"
+#include <map>
+#include <mutex>
+
+class MemoryMappedFile;
+
+//------------------------------------------------------------------------------
+/**
+ * Immutable coefficient set shared by the HarmonicGravity objects of a model.
+ *
+ * The C and S blocks are (NN+1) x (NN+1), row-major, the layout Harmonic uses
+ * for its coefficient arrays.  FieldRadius and Factor are 0 when the file does
+ * not set them, in which case the body values apply.
+ */
+//------------------------------------------------------------------------------
+class GMAT_API GravityCoefficients
+{
+public:
+   GravityCoefficients();
+   ~GravityCoefficients();
+
+   Integer     NN;
+   Integer     MM;
+   Real        FieldRadius;
+   Real        Factor;
+   std::string ModelName;
+   bool        Normalized;
+   bool        HaveZeroTide;
+   bool        HaveTideFree;
+   bool        HaveLoveNumbers;
+   Integer     ZeroTideMax;
+   std::vector<HarmonicValue> ZeroTideValues;
+   Real        K[LoveMax+1][LoveMax+1];
+   Real        KPlus[LoveMax+1];
+   /// Coefficient blocks, in storage or in a mapped binary cache file
+   const Real  *CBlock;
+   const Real  *SBlock;
+
+   /// Heap storage for the blocks when they were parsed in this process
+   RealArray   storage;
+
+private:
+   friend class GravityCoefficientStore;
+
+   // Owned by the store; no copies
+   GravityCoefficients(const GravityCoefficients&);
+   GravityCoefficients& operator=(const GravityCoefficients&);
+
+   /// Mapping of the binary cache file, when the blocks live there
+   MemoryMappedFile *mapping;
+   /// Number of Acquire()/Add() calls not yet released
+   Integer     refCount;
+   /// Set when the source files changed while the entry was in use
+   bool        stale;
+   /// Sizes and modification times of the source files at load time
+   std::string sourceStamp;
+};
+
+
+class GMAT_API GravityCoefficientStore
+{
+public:
+   static const GravityCoefficients* Acquire(const std::string &filename,
+                                             const std::string &tideFilename,
+                                             const std::string &bodyName);
+   static const GravityCoefficients* Add(const std::string &filename,
+                                         const std::string &tideFilename,
+                                         const std::string &bodyName,
+                                         GravityCoefficients *coefficients);
+   static void    Release(const GravityCoefficients *coefficients);
+   static void    ReleaseUnused();
+   static Integer GetEntryCount();
+   static std::string GetCacheFileName(const std::string &filename);
+
+private:
+   static std::string MakeKey(const std::string &filename,
+                              const std::string &tideFilename,
+                              const std::string &bodyName);
+   static std::string GetSourceStamp(const std::string &filename,
+                                     const std::string &tideFilename);
+   static unsigned long long ComputeChecksum(const std::string &filename,
+                                             const std::string &tideFilename,
+                                             const std::string &bodyName);
+   static GravityCoefficients* ReadCacheFile(const std::string &filename,
+                                             unsigned long long checksum);
+   static bool    WriteCacheFile(const std::string &filename,
+                                 unsigned long long checksum,
+                                 const GravityCoefficients &coefficients);
+   static const GravityCoefficients* Insert(const std::string &key,
+                                            const std::string &stamp,
+                                            GravityCoefficients *coefficients);
+
+   /// Loaded coefficient sets, keyed by file, tide file and body
+   static std::map<std::string, GravityCoefficients*> entries;
+   /// Guards the entries and their reference counts
+   static std::mutex storeMutex;
+};
+
+#endif // GravityCoefficientStore_hpp
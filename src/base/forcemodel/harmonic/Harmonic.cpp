@@ -34,10 +34,30 @@
 #include "MessageInterface.hpp"
 #include "RealUtilities.hpp"
 #include "StringUtil.hpp"
+#include "SharedDataLock.hpp"
+
+// The summation kernels use AVX2 when the build targets it (GMAT_USE_AVX2)
+#if defined(__AVX2__)
+   #define GMAT_HARMONIC_AVX2
+   #include <immintrin.h>
+#endif
+
+#ifdef GMAT_HARMONIC_AVX2
+//------------------------------------------------------------------------------
+// Real HorizontalSum(__m256d v)
+//------------------------------------------------------------------------------
+static inline Real HorizontalSum(__m256d v)
+   {
+   __m128d lo = _mm256_castpd256_pd128(v);
+   __m128d hi = _mm256_extractf128_pd(v, 1);
+   lo = _mm_add_pd(lo, hi);
+   return _mm_cvtsd_f64(_mm_add_sd(lo, _mm_unpackhi_pd(lo, lo)));
+   }
+#endif
 //------------------------------------------------------------------------------
 // static data
 //------------------------------------------------------------------------------
-bool Harmonic::matrixTruncationWasPosted = false;
+std::atomic<bool> Harmonic::matrixTruncationWasPosted(false);
 //------------------------------------------------------------------------------
 // public methods
 //------------------------------------------------------------------------------
@@ -58,7 +78,11 @@ Harmonic::Harmonic ()
      VR11       (NULL),
      VR02       (NULL),
      VR12       (NULL),
-     VR22       (NULL)
+     VR22       (NULL),
+     CRow       (NULL),
+     SRow       (NULL),
+     MValue     (NULL),
+     OwnsCoefficients (true)
    {
       theTimeConverter = TimeSystemConverter::Instance();
    }
@@ -88,6 +112,18 @@ Real Harmonic::GetFactor() const
    return Factor;
    }
 //------------------------------------------------------------------------------
+void Harmonic::CoefficientRow (const Real& jday, const Integer& n,
+   const Integer& mmax, Real* cRow, Real* sRow) const
+   {
+   // Default: one virtual call per coefficient; subclasses holding the
+   // coefficients in memory override this with a row copy
+   for (Integer m=0;  m<=mmax;  ++m)
+      {
+      cRow[m] = Cnm (jday,n,m);
+      sRow[m] = Snm (jday,n,m);
+      }
+   }
+//------------------------------------------------------------------------------
 void Harmonic::CalculateField (const Real& jday, const Real pos[3], 
    const Integer& nn, const Integer& mm, const bool& fillgradient,
    const Integer& gradientlimit, Real acc[3], Rmatrix33& gradient) const
@@ -99,20 +135,37 @@ void Harmonic::CalculateField (const Real& jday, const Real pos[3],
    Real t = pos[1]/r;
    Real u = pos[2]/r; // sin(phi), phi = geocentric latitude
 
+   Integer nMax = (NN < nn ? NN : nn) + XS;
+   Integer mMax = (MM < mm ? MM : mm) + XS;
+
    // Calculate values for A -----------------------------------------
    // generate the off-diagonal elements
    A[1][0] = u*sqrt(Real(3.0));
-   for (Integer n=1;  n<=NN+XS && n<=nn+XS;  ++n)
+   for (Integer n=1;  n<=nMax;  ++n)
       A[n+1][n] = u*sqrt(Real(2*n+3))*A[n][n];
 
-   // apply column-fill recursion formula (Table 2, Row I, Ref.[1])
-   for (Integer m=0;  m<=MM+XS && m<=mm+XS;  ++m)
+   // apply column-fill recursion formula (Table 2, Row I, Ref.[1]).  Each
+   // element only needs the two rows above it, so the fill runs a row at a
+   // time along contiguous memory (and vectorizes over m)
+   for (Integer n=2;  n<=nMax;  ++n)
+      {
+      Real *An = A[n];
+      const Real *An1 = A[n-1];
+      const Real *An2 = A[n-2];
+      const Real *N1n = N1[n];
+      const Real *N2n = N2[n];
+      Integer mLast = (n-2 < mMax ? n-2 : mMax);
+      for (Integer m=0;  m<=mLast;  ++m)
+         An[m] = u * N1n[m] * An1[m] - N2n[m] * An2[m];
+      }
+
+   // Ref.[3], Eq.(24)
+   Re[0] = 1;
+   Im[0] = 0;
+   for (Integer m=1;  m<=mMax;  ++m)
       {
-      for (Integer n=m+2;  n<=NN+XS && n<=nn+XS;  ++n)
-         A[n][m] = u * N1[n][m] * A[n-1][m] - N2[n][m] * A[n-2][m];
-      // Ref.[3], Eq.(24)
-      Re[m] = m==0 ? 1 : s*Re[m-1] - t*Im[m-1]; // real part of (s + i*t)^m
-      Im[m] = m==0 ? 0 : s*Im[m-1] + t*Re[m-1]; // imaginary part of (s + i*t)^m
+      Re[m] = s*Re[m-1] - t*Im[m-1]; // real part of (s + i*t)^m
+      Im[m] = s*Im[m-1] + t*Re[m-1]; // imaginary part of (s + i*t)^m
       }
 
    // Now do summation ------------------------------------------------
@@ -138,104 +191,86 @@ void Harmonic::CalculateField (const Real& jday, const Real pos[3],
       {
       rho_np1 *= rho;
       rho_np2 *= rho;
-      Real sum1 = 0;
-      Real sum2 = 0;
-      Real sum3 = 0;
-      Real sum4 = 0;
-      Real sum11 = 0;
-      Real sum12 = 0;
-      Real sum13 = 0;
-      Real sum14 = 0;
-      Real sum23 = 0;
-      Real sum24 = 0;
-      Real sum33 = 0;
-      Real sum34 = 0;
-      Real sum44 = 0;
+      Real sums[4]  = {0, 0, 0, 0};
+      Real gsums[9] = {0, 0, 0, 0, 0, 0, 0, 0, 0};
+
+      Integer mLast = n;
+      if (mLast > MM) mLast = MM;
+      if (mLast > mm) mLast = mm;
+
+      CoefficientRow (jday, n, mLast, CRow, SRow);
+
+      // m = 0 term; E and F vanish
+      Real D0 = (CRow[0]*Re[0] + SRow[0]*Im[0]) * sqrt2;
+      sums[2] += VR01[n][0] * A[n][1]   * D0;
+      sums[3] += VR11[n][0] * A[n+1][1] * D0;
+
+      // Pines Equations 27, 30 and 30b (Part of) for m >= 1
+      SumAccelerationTerms (1, mLast, CRow, SRow, Re, Im, A[n], A[n+1],
+         VR01[n], VR11[n], MValue, sqrt2, sums);
 
-      for (Integer m=0;  m <= n && m<=MM && m<=mm;  ++m) // wcs - removed "m<=n"
+      // Truncate the gradient at GRADIENT_MAX x GRADIENT_MAX
+      if (fillgradient)
          {
-         Real Cval = Cnm (jday,n,m);
-         Real Sval = Snm (jday,n,m);
-         // Pines Equation 27 (Part of)
-         Real D =            (Cval*Re[m]   + Sval*Im[m]) * sqrt2;
-         Real E = m==0 ? 0 : (Cval*Re[m-1] + Sval*Im[m-1]) * sqrt2;
-         Real F = m==0 ? 0 : (Sval*Re[m-1] - Cval*Im[m-1]) * sqrt2;
-         // Correct for normalization
-         Real Avv00 = A[n][m];
-         Real Avv01 = VR01[n][m] * A[n][m+1];
-         Real Avv11 = VR11[n][m] * A[n+1][m+1];
-         // Pines Equation 30 and 30b (Part of)
-         sum1 += m * Avv00 * E;
-         sum2 += m * Avv00 * F;
-         sum3 +=     Avv01 * D;
-         sum4 +=     Avv11 * D;
+         Integer gLast = (n <= gradientlimit ?
+               (mLast < gradientlimit ? mLast : gradientlimit) : -1);
+         if ((gLast < mLast) && !matrixTruncationWasPosted.exchange(true))
+            {
+            // The message system is shared; post under the shared data lock
+            SharedDataLock::Guard guard;
+            MessageInterface::ShowMessage("*** WARNING *** Gradient data "
+                  "for the state transition matrix and A-matrix "
+                  "computations are truncated at degree and order "
+                  "<= %d.\n", gradientlimit);
+            }
 
-         // Truncate the gradient at GRADIENT_MAX x GRADIENT_MAX
-         if (fillgradient)
+         // The m = 0 and m = 1 terms have no G and H contribution
+         for (Integer m=0;  m<=gLast && m<=1;  ++m)
             {
-            if ((m <= gradientlimit) && (n <= gradientlimit))
-               {
-               // Pines Equation 27 (Part of)
-               // 2015.09.18 GMT-5295 m<=2  -> m<=1
-               Real G = m<=1 ? 0 : (Cval*Re[m-2] + Sval*Im[m-2]) * sqrt2;
-               Real H = m<=1 ? 0 : (Sval*Re[m-2] - Cval*Im[m-2]) * sqrt2;
-               // Correct for normalization
-               Real Avv02 = VR02[n][m] * A[n][m+2];
-               Real Avv12 = VR12[n][m] * A[n+1][m+2];
-               Real Avv22 = VR22[n][m] * A[n+2][m+2];
-               if (GmatMathUtil::IsNaN(Avv02) || GmatMathUtil::IsInf(Avv02))
-                  Avv02 = 0.0;  // ************** wcs added ****
+            Real D =            (CRow[m]*Re[m]   + SRow[m]*Im[m]) * sqrt2;
+            Real E = m==0 ? 0 : (CRow[m]*Re[m-1] + SRow[m]*Im[m-1]) * sqrt2;
+            Real F = m==0 ? 0 : (SRow[m]*Re[m-1] - CRow[m]*Im[m-1]) * sqrt2;
+            Real Avv01 = VR01[n][m] * A[n][m+1];
+            Real Avv11 = VR11[n][m] * A[n+1][m+1];
+            Real Avv02 = VR02[n][m] * A[n][m+2];
+            Real Avv12 = VR12[n][m] * A[n+1][m+2];
+            Real Avv22 = VR22[n][m] * A[n+2][m+2];
+            if (GmatMathUtil::IsNaN(Avv02) || GmatMathUtil::IsInf(Avv02))
+               Avv02 = 0.0;  // ************** wcs added ****
+
+            // Pines Equation 36 (Part of)
+            gsums[2] += m       * Avv01 * E;
+            gsums[3] += m       * Avv11 * E;
+            gsums[4] += m       * Avv01 * F;
+            gsums[5] += m       * Avv11 * F;
+            gsums[6] +=           Avv02 * D;
+            gsums[7] +=           Avv12 * D;
+            gsums[8] +=           Avv22 * D;
+            }
 
-               // Pines Equation 36 (Part of)
-               sum11 += m*(m-1) * Avv00 * G;
-               sum12 += m*(m-1) * Avv00 * H;
-               sum13 += m       * Avv01 * E;
-               sum14 += m       * Avv11 * E;
-               sum23 += m       * Avv01 * F;
-               sum24 += m       * Avv11 * F;
-               sum33 +=           Avv02 * D;
-               sum34 +=           Avv12 * D;
-               sum44 +=           Avv22 * D;
-               }
-            else
-               {
-               if (matrixTruncationWasPosted == false)
-                  {
-                  MessageInterface::ShowMessage("*** WARNING *** Gradient data "
-                        "for the state transition matrix and A-matrix "
-                        "computations are truncated at degree and order "
-                        "<= %d.\n", gradientlimit);
-                  matrixTruncationWasPosted = true;
-                  }
-               }
-            } 
+         SumGradientTerms (2, gLast, CRow, SRow, Re, Im, A[n], A[n+1],
+            A[n+2], VR01[n], VR11[n], VR02[n], VR12[n], VR22[n], MValue,
+            sqrt2, gsums);
          }
+
       // Pines Equation 30 and 30b (Part of)
       Real rr = rho_np1/FieldRadius;
-      a1 += rr*sum1;
-      a2 += rr*sum2;
-      a3 += rr*sum3;
-      a4 -= rr*sum4;
+      a1 += rr*sums[0];
+      a2 += rr*sums[1];
+      a3 += rr*sums[2];
+      a4 -= rr*sums[3];
       if (fillgradient)
          {
          // Pines Equation 36 (Part of)
-         a11 += rho_np2/FieldRadius/FieldRadius*sum11;
-         a12 += rho_np2/FieldRadius/FieldRadius*sum12;
-         a13 += rho_np2/FieldRadius/FieldRadius*sum13;
-         a14 -= rho_np2/FieldRadius/FieldRadius*sum14;
-         a23 += rho_np2/FieldRadius/FieldRadius*sum23;
-         a24 -= rho_np2/FieldRadius/FieldRadius*sum24;
-         a33 += rho_np2/FieldRadius/FieldRadius*sum33;
-         a34 -= rho_np2/FieldRadius/FieldRadius*sum34;
-         a44 += rho_np2/FieldRadius/FieldRadius*sum44;
-         #ifdef DEBUG_GRADIENT
-         //   MessageInterface::ShowMessage("In Harmonic::CalField, fillgradient = %s\n", (fillgradient? "true" : "false"));
-         //   MessageInterface::ShowMessage("a33   = %12.10f\n", a33);
-         //   MessageInterface::ShowMessage("sum33 = %12.10f\n", sum33);
-         //   MessageInterface::ShowMessage("u     = %12.10f\n", u);
-         //   MessageInterface::ShowMessage("a44   = %12.10f\n", a44);
-         //   MessageInterface::ShowMessage("a34   = %12.10f\n", a34);
-         #endif
+         a11 += rho_np2/FieldRadius/FieldRadius*gsums[0];
+         a12 += rho_np2/FieldRadius/FieldRadius*gsums[1];
+         a13 += rho_np2/FieldRadius/FieldRadius*gsums[2];
+         a14 -= rho_np2/FieldRadius/FieldRadius*gsums[3];
+         a23 += rho_np2/FieldRadius/FieldRadius*gsums[4];
+         a24 -= rho_np2/FieldRadius/FieldRadius*gsums[5];
+         a33 += rho_np2/FieldRadius/FieldRadius*gsums[6];
+         a34 -= rho_np2/FieldRadius/FieldRadius*gsums[7];
+         a44 += rho_np2/FieldRadius/FieldRadius*gsums[8];
          }
       }
 
@@ -258,12 +293,224 @@ void Harmonic::CalculateField (const Real& jday, const Real pos[3],
       }
    }
 //------------------------------------------------------------------------------
+// Summation kernels
+//------------------------------------------------------------------------------
+/**
+ * Accumulates the acceleration sums of Pines Eqs. 30 and 30b over the orders
+ * mBegin..mEnd (mBegin >= 1) of one degree n.
+ *
+ * All inputs are contiguous rows, so the loop runs four orders at a time
+ * when the build targets AVX2; other builds use the scalar loop.  The vector
+ * path changes only the summation order, so results agree to round-off.
+ *
+ * sums[0..3] receive sum1, sum2, sum3 and sum4 of the reference.
+ */
+//------------------------------------------------------------------------------
+void Harmonic::SumAccelerationTerms (Integer mBegin, Integer mEnd,
+   const Real* cRow, const Real* sRow, const Real* re, const Real* im,
+   const Real* an, const Real* an1, const Real* vr01, const Real* vr11,
+   const Real* mValue, Real sqrt2, Real sums[4])
+   {
+   Integer m = mBegin;
+
+   #ifdef GMAT_HARMONIC_AVX2
+   if (mEnd - m + 1 >= 4)
+      {
+      __m256d vs2 = _mm256_set1_pd(sqrt2);
+      __m256d s1  = _mm256_setzero_pd();
+      __m256d s2  = _mm256_setzero_pd();
+      __m256d s3  = _mm256_setzero_pd();
+      __m256d s4  = _mm256_setzero_pd();
+      for (;  m+3 <= mEnd;  m += 4)
+         {
+         __m256d c    = _mm256_loadu_pd(cRow+m);
+         __m256d sv   = _mm256_loadu_pd(sRow+m);
+         __m256d re0  = _mm256_loadu_pd(re+m);
+         __m256d im0  = _mm256_loadu_pd(im+m);
+         __m256d re1  = _mm256_loadu_pd(re+m-1);
+         __m256d im1  = _mm256_loadu_pd(im+m-1);
+         __m256d D = _mm256_mul_pd(_mm256_add_pd(_mm256_mul_pd(c, re0),
+                                                 _mm256_mul_pd(sv, im0)), vs2);
+         __m256d E = _mm256_mul_pd(_mm256_add_pd(_mm256_mul_pd(c, re1),
+                                                 _mm256_mul_pd(sv, im1)), vs2);
+         __m256d F = _mm256_mul_pd(_mm256_sub_pd(_mm256_mul_pd(sv, re1),
+                                                 _mm256_mul_pd(c, im1)), vs2);
+         __m256d mAvv00 = _mm256_mul_pd(_mm256_loadu_pd(mValue+m),
+                                        _mm256_loadu_pd(an+m));
+         __m256d Avv01  = _mm256_mul_pd(_mm256_loadu_pd(vr01+m),
+                                        _mm256_loadu_pd(an+m+1));
+         __m256d Avv11  = _mm256_mul_pd(_mm256_loadu_pd(vr11+m),
+                                        _mm256_loadu_pd(an1+m+1));
+         s1 = _mm256_add_pd(s1, _mm256_mul_pd(mAvv00, E));
+         s2 = _mm256_add_pd(s2, _mm256_mul_pd(mAvv00, F));
+         s3 = _mm256_add_pd(s3, _mm256_mul_pd(Avv01, D));
+         s4 = _mm256_add_pd(s4, _mm256_mul_pd(Avv11, D));
+         }
+      sums[0] += HorizontalSum(s1);
+      sums[1] += HorizontalSum(s2);
+      sums[2] += HorizontalSum(s3);
+      sums[3] += HorizontalSum(s4);
+      }
+   #endif
+
+   for (;  m<=mEnd;  ++m)
+      {
+      // Pines Equation 27 (Part of)
+      Real D = (cRow[m]*re[m]   + sRow[m]*im[m])   * sqrt2;
+      Real E = (cRow[m]*re[m-1] + sRow[m]*im[m-1]) * sqrt2;
+      Real F = (sRow[m]*re[m-1] - cRow[m]*im[m-1]) * sqrt2;
+      // Correct for normalization
+      Real Avv00 = an[m];
+      Real Avv01 = vr01[m] * an[m+1];
+      Real Avv11 = vr11[m] * an1[m+1];
+      // Pines Equation 30 and 30b (Part of)
+      sums[0] += mValue[m] * Avv00 * E;
+      sums[1] += mValue[m] * Avv00 * F;
+      sums[2] +=             Avv01 * D;
+      sums[3] +=             Avv11 * D;
+      }
+   }
+//------------------------------------------------------------------------------
+/**
+ * Accumulates the gradient sums of Pines Eq. 36 over the orders mBegin..mEnd
+ * (mBegin >= 2) of one degree n; gsums[0..8] receive sum11, sum12, sum13,
+ * sum14, sum23, sum24, sum33, sum34 and sum44 of the reference.
+ */
+//------------------------------------------------------------------------------
+void Harmonic::SumGradientTerms (Integer mBegin, Integer mEnd,
+   const Real* cRow, const Real* sRow, const Real* re, const Real* im,
+   const Real* an, const Real* an1, const Real* an2, const Real* vr01,
+   const Real* vr11, const Real* vr02, const Real* vr12, const Real* vr22,
+   const Real* mValue, Real sqrt2, Real gsums[9])
+   {
+   Integer m = mBegin;
+
+   #ifdef GMAT_HARMONIC_AVX2
+   if (mEnd - m + 1 >= 4)
+      {
+      __m256d vs2  = _mm256_set1_pd(sqrt2);
+      __m256d one  = _mm256_set1_pd(1.0);
+      __m256d zero = _mm256_setzero_pd();
+      __m256d g[9];
+      for (Integer i = 0; i < 9; ++i)
+         g[i] = _mm256_setzero_pd();
+      for (;  m+3 <= mEnd;  m += 4)
+         {
+         __m256d c    = _mm256_loadu_pd(cRow+m);
+         __m256d sv   = _mm256_loadu_pd(sRow+m);
+         __m256d re0  = _mm256_loadu_pd(re+m);
+         __m256d im0  = _mm256_loadu_pd(im+m);
+         __m256d re1  = _mm256_loadu_pd(re+m-1);
+         __m256d im1  = _mm256_loadu_pd(im+m-1);
+         __m256d re2  = _mm256_loadu_pd(re+m-2);
+         __m256d im2  = _mm256_loadu_pd(im+m-2);
+         __m256d D = _mm256_mul_pd(_mm256_add_pd(_mm256_mul_pd(c, re0),
+                                                 _mm256_mul_pd(sv, im0)), vs2);
+         __m256d E = _mm256_mul_pd(_mm256_add_pd(_mm256_mul_pd(c, re1),
+                                                 _mm256_mul_pd(sv, im1)), vs2);
+         __m256d F = _mm256_mul_pd(_mm256_sub_pd(_mm256_mul_pd(sv, re1),
+                                                 _mm256_mul_pd(c, im1)), vs2);
+         __m256d G = _mm256_mul_pd(_mm256_add_pd(_mm256_mul_pd(c, re2),
+                                                 _mm256_mul_pd(sv, im2)), vs2);
+         __m256d H = _mm256_mul_pd(_mm256_sub_pd(_mm256_mul_pd(sv, re2),
+                                                 _mm256_mul_pd(c, im2)), vs2);
+         __m256d mv    = _mm256_loadu_pd(mValue+m);
+         __m256d mm1   = _mm256_mul_pd(mv, _mm256_sub_pd(mv, one));
+         __m256d Avv00 = _mm256_loadu_pd(an+m);
+         __m256d Avv01 = _mm256_mul_pd(_mm256_loadu_pd(vr01+m),
+                                       _mm256_loadu_pd(an+m+1));
+         __m256d Avv11 = _mm256_mul_pd(_mm256_loadu_pd(vr11+m),
+                                       _mm256_loadu_pd(an1+m+1));
+         __m256d Avv02 = _mm256_mul_pd(_mm256_loadu_pd(vr02+m),
+                                       _mm256_loadu_pd(an+m+2));
+         __m256d Avv12 = _mm256_mul_pd(_mm256_loadu_pd(vr12+m),
+                                       _mm256_loadu_pd(an1+m+2));
+         __m256d Avv22 = _mm256_mul_pd(_mm256_loadu_pd(vr22+m),
+                                       _mm256_loadu_pd(an2+m+2));
+         // Zero non-finite Avv02 entries (x - x is NaN unless x is finite)
+         __m256d finite = _mm256_cmp_pd(_mm256_sub_pd(Avv02, Avv02), zero,
+                                        _CMP_EQ_OQ);
+         Avv02 = _mm256_and_pd(Avv02, finite);
+
+         __m256d mAvv00 = _mm256_mul_pd(mm1, Avv00);
+         __m256d mAvv01 = _mm256_mul_pd(mv, Avv01);
+         __m256d mAvv11 = _mm256_mul_pd(mv, Avv11);
+         g[0] = _mm256_add_pd(g[0], _mm256_mul_pd(mAvv00, G));
+         g[1] = _mm256_add_pd(g[1], _mm256_mul_pd(mAvv00, H));
+         g[2] = _mm256_add_pd(g[2], _mm256_mul_pd(mAvv01, E));
+         g[3] = _mm256_add_pd(g[3], _mm256_mul_pd(mAvv11, E));
+         g[4] = _mm256_add_pd(g[4], _mm256_mul_pd(mAvv01, F));
+         g[5] = _mm256_add_pd(g[5], _mm256_mul_pd(mAvv11, F));
+         g[6] = _mm256_add_pd(g[6], _mm256_mul_pd(Avv02, D));
+         g[7] = _mm256_add_pd(g[7], _mm256_mul_pd(Avv12, D));
+         g[8] = _mm256_add_pd(g[8], _mm256_mul_pd(Avv22, D));
+         }
+      for (Integer i = 0; i < 9; ++i)
+         gsums[i] += HorizontalSum(g[i]);
+      }
+   #endif
+
+   for (;  m<=mEnd;  ++m)
+      {
+      // Pines Equation 27 (Part of)
+      Real D = (cRow[m]*re[m]   + sRow[m]*im[m])   * sqrt2;
+      Real E = (cRow[m]*re[m-1] + sRow[m]*im[m-1]) * sqrt2;
+      Real F = (sRow[m]*re[m-1] - cRow[m]*im[m-1]) * sqrt2;
+      // 2015.09.18 GMT-5295 m<=2  -> m<=1
+      Real G = (cRow[m]*re[m-2] + sRow[m]*im[m-2]) * sqrt2;
+      Real H = (sRow[m]*re[m-2] - cRow[m]*im[m-2]) * sqrt2;
+      // Correct for normalization
+      Real Avv00 = an[m];
+      Real Avv01 = vr01[m] * an[m+1];
+      Real Avv11 = vr11[m] * an1[m+1];
+      Real Avv02 = vr02[m] * an[m+2];
+      Real Avv12 = vr12[m] * an1[m+2];
+      Real Avv22 = vr22[m] * an2[m+2];
+      if (GmatMathUtil::IsNaN(Avv02) || GmatMathUtil::IsInf(Avv02))
+         Avv02 = 0.0;  // ************** wcs added ****
+
+      Real mv = mValue[m];
+      // Pines Equation 36 (Part of)
+      gsums[0] += mv*(mv-1) * Avv00 * G;
+      gsums[1] += mv*(mv-1) * Avv00 * H;
+      gsums[2] += mv        * Avv01 * E;
+      gsums[3] += mv        * Avv11 * E;
+      gsums[4] += mv        * Avv01 * F;
+      gsums[5] += mv        * Avv11 * F;
+      gsums[6] +=             Avv02 * D;
+      gsums[7] +=             Avv12 * D;
+      gsums[8] +=             Avv22 * D;
+      }
+   }
+//------------------------------------------------------------------------------
 // protected methods
 //------------------------------------------------------------------------------
 void Harmonic::Allocate()
    {
    AllocateArray(C,NN,0);
    AllocateArray(S,NN,0);
+   OwnsCoefficients = true;
+   AllocateWorkspace();
+   }
+//------------------------------------------------------------------------------
+void Harmonic::AttachCoefficients(const Real* cBlock, const Real* sBlock)
+   {
+   // Use (NN+1)x(NN+1) row-major blocks owned elsewhere (e.g. a shared,
+   // read-only coefficient set); only the row tables belong to this object
+   Integer dim = NN+1;
+   C = new Real*[dim];
+   S = new Real*[dim];
+   for (Integer n=0;  n<=dim-1;  ++n)
+      {
+      C[n] = const_cast<Real*>(cBlock + n*dim);
+      S[n] = const_cast<Real*>(sBlock + n*dim);
+      }
+   OwnsCoefficients = false;
+   AllocateWorkspace();
+   }
+//------------------------------------------------------------------------------
+void Harmonic::AllocateWorkspace()
+   {
    AllocateArray(A,NN,3);
    AllocateArray(V,NN,3);
    AllocateArray(Re,NN,3);
@@ -275,6 +522,12 @@ void Harmonic::Allocate()
    AllocateArray(VR02,NN,0);
    AllocateArray(VR12,NN,0);
    AllocateArray(VR22,NN,0);
+   AllocateArray(CRow,NN,3);
+   AllocateArray(SRow,NN,3);
+   AllocateArray(MValue,NN,3);
+
+   for (Integer m=0;  m<=NN+2;  ++m)
+      MValue[m] = Real(m);
 
    // initialize the diagonal elements (not a function of the input)
    A[0][0] = 1.0;
@@ -327,8 +580,19 @@ void Harmonic::Allocate()
 //------------------------------------------------------------------------------
 void Harmonic::Deallocate()
    {
-   DeallocateArray(C,NN,0);
-   DeallocateArray(S,NN,0);
+   if (OwnsCoefficients)
+      {
+      DeallocateArray(C,NN,0);
+      DeallocateArray(S,NN,0);
+      }
+   else
+      {
+      delete[] C;
+      delete[] S;
+      C = NULL;
+      S = NULL;
+      OwnsCoefficients = true;
+      }
    DeallocateArray(A,NN,3);
    DeallocateArray(V,NN,3);
    DeallocateArray(Re,NN,3);
@@ -340,20 +604,26 @@ void Harmonic::Deallocate()
    DeallocateArray(VR02,NN,0);
    DeallocateArray(VR12,NN,0);
    DeallocateArray(VR22,NN,0);
+   DeallocateArray(CRow,NN,3);
+   DeallocateArray(SRow,NN,3);
+   DeallocateArray(MValue,NN,3);
    }
 //------------------------------------------------------------------------------
 void Harmonic::AllocateArray(Real**& a, const Integer& nn, const Integer& excess)
    {
-   // Allocate out to full m, regardless of M_FileOrder
-   a = new Real*[nn+1+excess];
+   // Allocate out to full m, regardless of M_FileOrder.  The rows share one
+   // contiguous block so the per-degree kernels stream through memory.
+   Integer dim = nn+1+excess;
+   a = new Real*[dim];
    if (!a)
       throw ODEModelException ("Harmonic::AllocateArray failed");
-   for (Integer n=0;  n<=nn+1+excess-1;  ++n)
+   a[0] = new Real[dim*dim];   // wcs 2011.06.02 n -> nn
+   if (!a[0])
+      throw ODEModelException ("Harmonic::AllocateArray failed");
+   for (Integer n=0;  n<=dim-1;  ++n)
       {
-      a[n] = new Real[nn+1+excess];   // wcs 2011.06.02 n -> nn
-      if (!a[n])
-         throw ODEModelException ("Harmonic::AllocateArray failed");
-      for (Integer m=0;  m<=nn+1+excess-1;  ++m)   // wcs 2011.06.02  n -> nn
+      a[n] = a[0] + n*dim;
+      for (Integer m=0;  m<=dim-1;  ++m)   // wcs 2011.06.02  n -> nn
          a[n][m] = 0.0;
       }
    }
@@ -371,14 +641,8 @@ void Harmonic::DeallocateArray(Real**& a, const Integer& nn, const Integer& exce
    {
    if (a != NULL)
       {
-      for (Integer n=0;  n<=nn+1+excess-1;  ++n)
-         {
-         if (a[n] != NULL)
-            {
-            delete[] a[n];
-            a[n] = NULL;
-            }
-         }
+      // Rows point into the block owned by row 0
+      delete[] a[0];
       delete[] a;
       a = NULL;
       }
@@ -61,6 +61,7 @@
 #include "gmatdefs.hpp"
 #include "Rmatrix33.hpp"
 #include "TimeSystemConverter.hpp"   // for the TimeSystemConverter singleton
+#include <atomic>
 
 //------------------------------------------------------------------------------
 class GMAT_API Harmonic
@@ -77,6 +78,8 @@ public:
       const Integer& n, const Integer& m) const = 0;
    virtual Real Snm (const Real& jday, 
       const Integer& n, const Integer& m) const = 0;
+   virtual void CoefficientRow (const Real& jday, const Integer& n,
+      const Integer& mmax, Real* cRow, Real* sRow) const;
    Integer GetNN() const;
    Integer GetMM() const;
    Real GetFieldRadius() const;
@@ -103,15 +106,31 @@ protected:
    Real**      VR02;    // Temporary
    Real**      VR12;    // Temporary
    Real**      VR22;    // Temporary
-   /// Flag used to warn about truncating matrix calculations to 20x20 only once
-   static bool matrixTruncationWasPosted;
+   Real*       CRow;    // Coefficients C(n,0..m) for the degree being summed
+   Real*       SRow;    // Coefficients S(n,0..m) for the degree being summed
+   Real*       MValue;  // Order m as a Real, for the vector kernels
+   bool        OwnsCoefficients;  // false when C,S rows point into a shared block
+   /// Flag used to warn about truncating matrix calculations to 20x20 only
+   /// once; atomic since the field may be summed on several threads
+   static std::atomic<bool> matrixTruncationWasPosted;
 
    /// Time converter singleton
    TimeSystemConverter *theTimeConverter;
 protected:
    void Allocate();
+   void AttachCoefficients(const Real* cBlock, const Real* sBlock);
    void Deallocate();
+   static void SumAccelerationTerms (Integer mBegin, Integer mEnd,
+      const Real* cRow, const Real* sRow, const Real* re, const Real* im,
+      const Real* an, const Real* an1, const Real* vr01, const Real* vr11,
+      const Real* mValue, Real sqrt2, Real sums[4]);
+   static void SumGradientTerms (Integer mBegin, Integer mEnd,
+      const Real* cRow, const Real* sRow, const Real* re, const Real* im,
+      const Real* an, const Real* an1, const Real* an2, const Real* vr01,
+      const Real* vr11, const Real* vr02, const Real* vr12, const Real* vr22,
+      const Real* mValue, Real sqrt2, Real gsums[9]);
 protected:
+   void AllocateWorkspace();
    static void AllocateArray (Real**& a,   
       const Integer& nn, const Integer& excess);
    static void AllocateArray (Real*& a,    
@@ -29,6 +29,7 @@
  */
 //------------------------------------------------------------------------------
 #include "HarmonicGravity.hpp"
+#include "GravityCoefficientStore.hpp"
 #include "UtilityException.hpp"
 #include "MessageInterface.hpp"
 #include "GmatConstants.hpp"
@@ -37,6 +38,7 @@
 #include "RealUtilities.hpp"
 #include "TimeSystemConverter.hpp"
 #include "SolarSystem.hpp"
+#include "SharedDataLock.hpp"
 //------------------------------------------------------------------------------
 using namespace GmatMathUtil;
 //------------------------------------------------------------------------------
@@ -70,6 +72,7 @@ HarmonicGravity::HarmonicGravity
      HaveZeroTide (false),
      HaveLoveNumbers (false),
      TideLevel (0),
+     Coefficients (NULL),
      ZeroTideMax (0),
      ZeroTideValues (0)
    {
@@ -80,11 +83,16 @@ HarmonicGravity::HarmonicGravity
       KPlus[i] = 0;
    FieldRadius = radius;
    Factor = -mukm;
-   LM_Load (loadCoefficients);
+   if (loadCoefficients)
+      LoadSharedCoefficients ();
+   else
+      LM_Load (loadCoefficients);
    }
 //------------------------------------------------------------------------------
 HarmonicGravity::~HarmonicGravity()
    {
+   // The row tables go with Harmonic; the blocks stay with the store
+   GravityCoefficientStore::Release (Coefficients);
    }
 //------------------------------------------------------------------------------
 std::string HarmonicGravity::GetFilename()
@@ -165,6 +173,25 @@ Real HarmonicGravity::Snm (const Real& jday, const Integer& n, const Integer& m)
       }
    }
 //------------------------------------------------------------------------------
+void HarmonicGravity::CoefficientRow (const Real& jday, const Integer& n,
+   const Integer& mmax, Real* cRow, Real* sRow) const
+   {
+   const Real *c = C[n];
+   const Real *s = S[n];
+   for (Integer m=0;  m<=mmax;  ++m)
+      {
+      cRow[m] = c[m];
+      sRow[m] = s[m];
+      }
+   // Same tide corrections as Cnm() and Snm()
+   if ((n <= LoveMax) && (TideLevel > 0))
+      for (Integer m=0;  m<=mmax && m<=LoveMax;  ++m)
+         {
+         cRow[m] += DeltaC[n][m];
+         sRow[m] += DeltaS[n][m];
+         }
+   }
+//------------------------------------------------------------------------------
 void HarmonicGravity::CalculatePointField (const Real& jday, const Real pos[3],
    const Integer& nn, const Integer& mm,
    const bool& fillgradient, const Integer& gradientlimit,
@@ -266,6 +293,91 @@ void HarmonicGravity::WriteCofFile (const std::string& filename)
    f.close();
    }
 //------------------------------------------------------------------------------
+//--- Shared coefficient store
+//------------------------------------------------------------------------------
+void HarmonicGravity::LoadSharedCoefficients ()
+   {
+   const GravityCoefficients* shared =
+      GravityCoefficientStore::Acquire (Filename,TideFilename,BodyName);
+   if (shared == NULL)
+      {
+      // Parse the text file once; zero radius and mu mark values the file
+      // does not set, so the shared set does not capture this body's values
+      Real bodyRadius = FieldRadius;
+      Real bodyFactor = Factor;
+      FieldRadius = 0;
+      Factor = 0;
+      LM_Load (true);
+      if (NN == 0 || C == NULL)
+         {
+         // Nothing to share (e.g. a format not supported in this run mode)
+         if (FieldRadius == 0) FieldRadius = bodyRadius;
+         if (Factor == 0)      Factor = bodyFactor;
+         return;
+         }
+      shared = GravityCoefficientStore::Add (Filename,TideFilename,BodyName,
+         ExtractCoefficients ());
+      Deallocate ();
+      FieldRadius = bodyRadius;
+      Factor = bodyFactor;
+      }
+   UseCoefficients (shared);
+   }
+//------------------------------------------------------------------------------
+GravityCoefficients* HarmonicGravity::ExtractCoefficients () const
+   {
+   GravityCoefficients* out = new GravityCoefficients ();
+   out->NN = NN;
+   out->MM = MM;
+   out->FieldRadius = FieldRadius;
+   out->Factor = Factor;
+   out->ModelName = ModelName;
+   out->Normalized = Normalized;
+   out->HaveZeroTide = HaveZeroTide;
+   out->HaveTideFree = HaveTideFree;
+   out->HaveLoveNumbers = HaveLoveNumbers;
+   out->ZeroTideMax = ZeroTideMax;
+   out->ZeroTideValues = ZeroTideValues;
+   for (int i=0;  i<=LoveMax;  ++i)
+      {
+      for (int j=0;  j<=LoveMax;  ++j)
+         out->K[i][j] = K[i][j];
+      out->KPlus[i] = KPlus[i];
+      }
+   // C and S are single (NN+1)x(NN+1) blocks (see Harmonic::AllocateArray)
+   Integer size = (NN+1)*(NN+1);
+   out->storage.assign (C[0],C[0]+size);
+   out->storage.insert (out->storage.end(),S[0],S[0]+size);
+   out->CBlock = &out->storage[0];
+   out->SBlock = &out->storage[size];
+   return out;
+   }
+//------------------------------------------------------------------------------
+void HarmonicGravity::UseCoefficients (const GravityCoefficients* coefficients)
+   {
+   Coefficients = coefficients;
+   NN = coefficients->NN;
+   MM = coefficients->MM;
+   if (coefficients->FieldRadius != 0)
+      FieldRadius = coefficients->FieldRadius;
+   if (coefficients->Factor != 0)
+      Factor = coefficients->Factor;
+   ModelName = coefficients->ModelName;
+   Normalized = coefficients->Normalized;
+   HaveZeroTide = coefficients->HaveZeroTide;
+   HaveTideFree = coefficients->HaveTideFree;
+   HaveLoveNumbers = coefficients->HaveLoveNumbers;
+   ZeroTideMax = coefficients->ZeroTideMax;
+   ZeroTideValues = coefficients->ZeroTideValues;
+   for (int i=0;  i<=LoveMax;  ++i)
+      {
+      for (int j=0;  j<=LoveMax;  ++j)
+         K[i][j] = coefficients->K[i][j];
+      KPlus[i] = coefficients->KPlus[i];
+      }
+   AttachCoefficients (coefficients->CBlock,coefficients->SBlock);
+   }
+//------------------------------------------------------------------------------
 const std::string HarmonicGravity::ETideString[3] = { "None", "Solid", "SolidAndPole" };
 const Integer HarmonicGravity::ETideCount = 3;
 //==============================================================================
@@ -489,8 +601,13 @@ void HarmonicGravity::IncrementEarthTide (const Real& jday,
    //   Real JD = jday + 2300000.0;  // what is this number and why is it added on???  wcs
    // jday is A1 JD; we want UT1 (approximated by UTC) JD
    Real a1mjd  = jday - GmatTimeConstants::JD_JAN_5_1941;
-   Real JD     = theTimeConverter->Convert(a1mjd, TimeSystemConverter::A1MJD, TimeSystemConverter::UTCMJD,
+   Real JD;
+   {
+      // The time converter is shared by the models summed on other threads
+      SharedDataLock::Guard guard;
+      JD = theTimeConverter->Convert(a1mjd, TimeSystemConverter::A1MJD, TimeSystemConverter::UTCMJD,
                  GmatTimeConstants::JD_JAN_5_1941) + GmatTimeConstants::JD_JAN_5_1941;
+   }
    Real t  = (JD-GmatTimeConstants::JD_OF_J2000)/GmatTimeConstants::DAYS_PER_JULIAN_CENTURY;  // (ignore difference between TDB and TDT)
    Real t2 = t*t;
    Real t3 = t2*t;
@@ -37,6 +37,8 @@
 //------------------------------------------------------------------------------
 const Integer LoveMax = 4;
 //------------------------------------------------------------------------------
+class GravityCoefficients;
+//------------------------------------------------------------------------------
 class GMAT_API HarmonicValue {
 public:
    HarmonicValue ();
@@ -69,6 +71,8 @@ public:
    std::string TideString();
    virtual Real Cnm(const Real& jday, const Integer& n, const Integer& m) const;
    virtual Real Snm(const Real& jday, const Integer& n, const Integer& m) const;
+   virtual void CoefficientRow(const Real& jday, const Integer& n,
+      const Integer& mmax, Real* cRow, Real* sRow) const;
    void CalculatePointField(const Real& jday, const Real pos[3],
       const Integer& nn, const Integer& mm,
       const bool& fillgradient,  const Integer& gradientlimit,
@@ -99,6 +103,7 @@ private:
    bool HaveTideFree;         // In CTideFree,STideFree
    bool HaveLoveNumbers;      // In K,KPlus
    Integer TideLevel;   // Temporary during full field call
+   const GravityCoefficients* Coefficients;   // Shared C,S; NULL if parsed here
 
    // Tide Free coefficients
    Integer  ZeroTideMax;
@@ -117,6 +122,10 @@ private:
       const Real sunpos[3], const Real& sunmukm, 
       const Real otherpos[3], const Real& othermukm,
       const Real &xp, const Real &yp);
+   // Shared coefficient store
+   void LoadSharedCoefficients ();
+   GravityCoefficients* ExtractCoefficients () const;
+   void UseCoefficients (const GravityCoefficients* coefficients);
    // Load Module
    void LM_Error (const std::string& error);
    void LM_TideError (const std::string& error);
@@ -1152,6 +1152,92 @@ bool Propagator::Step(Real dt)
 }
 
 
+//------------------------------------------------------------------------------
+// Integer PropagateSteps(Integer count, Real dt, Real *history,
+//       Integer historySize)
+//------------------------------------------------------------------------------
+/**
+ * Propagates a sequence of fixed length intervals, recording the state after
+ * each one
+ *
+ * Each interval is covered by as many steps as the propagator needs; error
+ * controlled propagators may shorten a step, in which case the rest of the
+ * interval is stepped again.  Row i of the history holds the propagator time
+ * (GetTime()) followed by the GetDimension() elements of the state at the end
+ * of interval i + 1, so a single spacecraft Cartesian state produces 7
+ * columns.  The history is filled in place, which lets API users pass a
+ * preallocated array (a NumPy array in Python) and avoid a call per step.
+ *
+ * @param count       The number of intervals to propagate
+ * @param dt          The length of each interval, in seconds
+ * @param history     Row major storage for count x (GetDimension() + 1) Reals
+ * @param historySize The number of Reals available in history
+ *
+ * @return The number of rows filled, count
+ */
+//------------------------------------------------------------------------------
+Integer Propagator::PropagateSteps(Integer count, Real dt, Real *history,
+      Integer historySize)
+{
+   if (!isInitialized)
+      throw PropagatorException("The propagator " + instanceName +
+            " must be initialized before it can propagate a step sequence");
+
+   Integer columns = GetDimension() + 1;
+   if ((count < 0) || (columns < 2))
+   {
+      std::stringstream msg;
+      msg << "The propagator " << instanceName << " cannot propagate " << count
+          << " steps of a " << (columns - 1) << " element state";
+      throw PropagatorException(msg.str());
+   }
+   if ((history == NULL) || (historySize < count * columns))
+   {
+      std::stringstream msg;
+      msg << "The step history needs " << count << " x " << columns
+          << " elements for the propagator " << instanceName << ", but "
+          << historySize << " were provided";
+      throw PropagatorException(msg.str());
+   }
+
+   for (Integer i = 0; i < count; ++i)
+   {
+      Real remaining = dt;
+      while (GmatMathUtil::Abs(remaining) > STEP_SIZE_TOLERANCE)
+      {
+         if (!Step(remaining))
+         {
+            std::stringstream msg;
+            msg << "The propagator " << instanceName
+                << " failed to take a step of " << remaining << " seconds";
+            throw PropagatorException(msg.str());
+         }
+         Real taken = GetStepTaken();
+         if (taken == 0.0)
+            throw PropagatorException("The propagator " + instanceName +
+                  " did not advance the state");
+         remaining -= taken;
+      }
+
+      Real *row = history + i * columns;
+      const Real *state = GetState();
+      if (state == NULL)
+         throw PropagatorException("The propagator " + instanceName +
+               " has no state to record");
+      row[0] = GetTime();
+      for (Integer j = 1; j < columns; ++j)
+         row[j] = state[j-1];
+
+      #ifdef DEBUG_PROPAGATOR_FLOW
+         MessageInterface::ShowMessage("PropagateSteps row %d at t = %.12lf\n",
+               i, row[0]);
+      #endif
+   }
+
+   return count;
+}
+
+
 //------------------------------------------------------------------------------
 // void SetAsFinalStep(bool fs)
 //------------------------------------------------------------------------------
@@ -1276,3 +1362,68 @@ bool Propagator::UsesErrorControl()
 {
    return false;
 }
+
+
+//------------------------------------------------------------------------------
+// bool CanInterpolate(Real atTime)
+//------------------------------------------------------------------------------
+/**
+ * Checks if the propagator can evaluate its state at a time without stepping.
+ *
+ * Integrators with dense output can do this inside the last accepted step.
+ *
+ * @param atTime The elapsed time (see GetTime()) of the state
+ *
+ * @return true if GetDenseState() can provide the state; false by default
+ */
+//------------------------------------------------------------------------------
+bool Propagator::CanInterpolate(Real atTime)
+{
+   return false;
+}
+
+
+//------------------------------------------------------------------------------
+// bool GetDenseState(Real atTime, Real *denseState)
+//------------------------------------------------------------------------------
+/**
+ * Evaluates the propagation state vector at a time without stepping.
+ *
+ * @param atTime     The elapsed time (see GetTime()) of the state
+ * @param denseState Array that receives the state vector
+ *
+ * @return true if the state was evaluated; false by default
+ */
+//------------------------------------------------------------------------------
+bool Propagator::GetDenseState(Real atTime, Real *denseState)
+{
+   return false;
+}
+
+
+//------------------------------------------------------------------------------
+// bool InterpolateTo(Real atTime)
+//------------------------------------------------------------------------------
+/**
+ * Moves the propagation state vector to a time using GetDenseState().
+ *
+ * This is used in place of a Step() when the state is needed inside the
+ * previous step, e.g. while searching for a stopping condition.
+ *
+ * @param atTime The elapsed time (see GetTime()) of the new state
+ *
+ * @return true if the state was moved; false if dense output is not available
+ */
+//------------------------------------------------------------------------------
+bool Propagator::InterpolateTo(Real atTime)
+{
+   if (physicalModel == NULL)
+      return false;
+
+   Real *state = physicalModel->GetState();
+   if (!GetDenseState(atTime, state))
+      return false;
+
+   physicalModel->IncrementTime(atTime - physicalModel->GetTime());
+   return true;
+}
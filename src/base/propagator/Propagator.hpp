@@ -135,6 +135,8 @@ public:
    virtual bool Initialize();
    virtual void SetPhysicalModel(PhysicalModel *pPhysicalModel);
    virtual bool Step(Real dt);
+   virtual Integer PropagateSteps(Integer count, Real dt, Real *history,
+                                  Integer historySize);
    virtual void SetAsFinalStep(bool fs);
 
    virtual void Update(bool forwards = true);
@@ -171,6 +173,10 @@ public:
 
    virtual bool UsesErrorControl();
 
+   virtual bool CanInterpolate(Real atTime);
+   virtual bool GetDenseState(Real atTime, Real *denseState);
+   virtual bool InterpolateTo(Real atTime);
+
    // Abstract methods
 
    //---------------------------------------------------------------------------
@@ -64,6 +64,7 @@
 #include "gmatdefs.hpp"
 #include "RungeKutta.hpp"
 #include "MessageInterface.hpp"
+#include <algorithm>          // for std::swap()
 
 //#define DEBUG_PROPAGATOR_FLOW
 //#define DEBUG_RAW_STEP_STATE
@@ -96,7 +97,16 @@ RungeKutta::RungeKutta(Integer st, Integer order, const std::string &typeStr,
     incPower        (1.0/order),
     decPower        (1.0/(order-1)),
     stageState      (NULL),
-    candidateState  (NULL)
+    candidateState  (NULL),
+    stepStart       (NULL),
+    denseStart      (NULL),
+    denseEnd        (NULL),
+    denseStartDeriv (NULL),
+    denseEndDeriv   (NULL),
+    denseTime       (0.0),
+    denseStep       (0.0),
+    denseEndDerivKnown (false),
+    fsalStage       (-1)
 {
 }
 
@@ -131,7 +141,16 @@ RungeKutta::RungeKutta(const RungeKutta& rk) :
     incPower        (rk.incPower),
     decPower        (rk.decPower),
     stageState      (NULL),
-    candidateState  (NULL)
+    candidateState  (NULL),
+    stepStart       (NULL),
+    denseStart      (NULL),
+    denseEnd        (NULL),
+    denseStartDeriv (NULL),
+    denseEndDeriv   (NULL),
+    denseTime       (0.0),
+    denseStep       (0.0),
+    denseEndDerivKnown (false),
+    fsalStage       (-1)
 {
 }
 
@@ -162,6 +181,9 @@ RungeKutta& RungeKutta::operator=(const RungeKutta& rk)
     ee = NULL;
     stageState = NULL;
     candidateState = NULL;
+    stepStart = denseStart = denseEnd = denseStartDeriv = denseEndDeriv = NULL;
+    denseStep = 0.0;
+    fsalStage = -1;
 
     isInitialized = false;
 
@@ -325,6 +347,10 @@ bool RungeKutta::Step()
     Real originalTime = physicalModel->GetTime();
     Real originalStep = stepSize;
 
+    // Start of the step, kept for dense output if the step is accepted
+    if (stepStart != NULL)
+       memcpy(stepStart, physicalModel->GetState(), dimension*sizeof(Real));
+
     bool stepLimited = false; // Is the step limited by the force model?
 
     // Get the maximum step size allowed by the force models
@@ -386,6 +412,7 @@ bool RungeKutta::Step()
        MessageInterface::ShowMessage("\n");
     }
 
+    StoreDenseData();
     physicalModel->IncrementTime(stepTaken);
 
     if (stepLimited)
@@ -578,6 +605,94 @@ bool RungeKutta::Step(Real dt)
    return true;
 }
 
+//------------------------------------------------------------------------------
+// bool RungeKutta::CanInterpolate(Real atTime)
+//------------------------------------------------------------------------------
+/**
+ * Checks if dense output is available at a time
+ *
+ * @param atTime    The elapsed time of the requested state
+ *
+ * @return true if atTime lies in the last accepted step, and the current
+ *         elapsed time does too
+ */
+//------------------------------------------------------------------------------
+bool RungeKutta::CanInterpolate(Real atTime)
+{
+   if ((denseStep == 0.0) || (physicalModel == NULL))
+      return false;
+
+   // Allow for roundoff in the times that are passed in
+   const Real slack = 1.0e-12;
+   Real thetaAt  = (atTime - denseTime) / denseStep;
+   Real thetaNow = (physicalModel->GetTime() - denseTime) / denseStep;
+
+   return (thetaAt  >= -slack) && (thetaAt  <= 1.0 + slack) &&
+          (thetaNow >= -slack) && (thetaNow <= 1.0 + slack);
+}
+
+//------------------------------------------------------------------------------
+// bool RungeKutta::GetDenseState(Real atTime, Real *denseState)
+//------------------------------------------------------------------------------
+/**
+ * Evaluates the state inside the last accepted step
+ *
+ * The step is represented by the cubic Hermite polynomial through the states
+ * and derivatives at its ends.  The derivative at the start is the first stage
+ * of the step.  The derivative at the end is a stage of the step for
+ * first-same-as-last coefficient sets (e.g. Prince-Dormand 4(5)); otherwise it
+ * is evaluated once, on the first request for the step.
+ *
+ * @param atTime     The elapsed time of the requested state
+ * @param denseState The array that receives the state
+ *
+ * @return true on success, false if atTime is outside of the last step
+ */
+//------------------------------------------------------------------------------
+bool RungeKutta::GetDenseState(Real atTime, Real *denseState)
+{
+   if (!CanInterpolate(atTime))
+      return false;
+
+   Real theta = (atTime - denseTime) / denseStep;
+   if (theta <= 0.0)
+   {
+      memcpy(denseState, denseStart, dimension*sizeof(Real));
+      return true;
+   }
+   if (theta >= 1.0)
+   {
+      memcpy(denseState, denseEnd, dimension*sizeof(Real));
+      return true;
+   }
+
+   if (!denseEndDerivKnown)
+   {
+      Real stepDirection = (denseStep > 0.0 ? 1.0 : -1.0);
+      physicalModel->SetDirection(stepDirection);
+      memcpy(stageState, denseEnd, dimension*sizeof(Real));
+      if (!physicalModel->GetDerivatives(stageState,
+            denseTime + denseStep - physicalModel->GetTime()))
+         return false;
+      for (Integer i = 0; i < dimension; ++i)
+         denseEndDeriv[i] = denseStep * ddt[i];
+      denseEndDerivKnown = true;
+   }
+
+   Real theta2 = theta * theta;
+   Real theta3 = theta2 * theta;
+   Real h00 = 2.0 * theta3 - 3.0 * theta2 + 1.0;
+   Real h10 = theta3 - 2.0 * theta2 + theta;
+   Real h01 = 3.0 * theta2 - 2.0 * theta3;
+   Real h11 = theta3 - theta2;
+
+   for (Integer i = 0; i < dimension; ++i)
+      denseState[i] = h00 * denseStart[i] + h10 * denseStartDeriv[i] +
+                      h01 * denseEnd[i] + h11 * denseEndDeriv[i];
+
+   return true;
+}
+
 //---------------------------------
 // protected
 //---------------------------------
@@ -693,6 +808,36 @@ bool RungeKutta::AdaptStep(Real maxerror)
     return true;
 }
 
+//------------------------------------------------------------------------------
+// void RungeKutta::StoreDenseData()
+//------------------------------------------------------------------------------
+/**
+ * Saves the data describing an accepted step for dense output
+ *
+ * Called before the elapsed time is advanced.  The start of the step, saved
+ * in stepStart when the step began, becomes the dense start state here, so a
+ * step that fails leaves the data of the previous accepted step in place.
+ */
+//------------------------------------------------------------------------------
+void RungeKutta::StoreDenseData()
+{
+    if (denseStart == NULL)
+        return;
+
+    denseTime = physicalModel->GetTime();
+    denseStep = stepTaken;
+    std::swap(denseStart, stepStart);
+    memcpy(denseEnd, outState, dimension*sizeof(Real));
+    memcpy(denseStartDeriv, ki[0], dimension*sizeof(Real));
+    if (fsalStage >= 0)
+    {
+        memcpy(denseEndDeriv, ki[fsalStage], dimension*sizeof(Real));
+        denseEndDerivKnown = true;
+    }
+    else
+        denseEndDerivKnown = false;
+}
+
 //------------------------------------------------------------------------------
 // void RungeKutta::ClearArrays(void)
 //------------------------------------------------------------------------------
@@ -742,11 +887,85 @@ void RungeKutta::ClearArrays()
         delete [] candidateState;
     }
 
+    ClearDenseArrays();
+
     ki = bij = NULL;
     ai = cj = ee = stageState = candidateState = NULL;
     //    ai = cj = ee = stageState = candidateState = errorEstimates = NULL;
 }
 
+//------------------------------------------------------------------------------
+// void RungeKutta::ClearDenseArrays()
+//------------------------------------------------------------------------------
+/**
+ * Deallocates the dense output arrays
+ */
+//------------------------------------------------------------------------------
+void RungeKutta::ClearDenseArrays()
+{
+    if (stepStart != NULL)
+        delete [] stepStart;
+    if (denseStart != NULL)
+        delete [] denseStart;
+    if (denseEnd != NULL)
+        delete [] denseEnd;
+    if (denseStartDeriv != NULL)
+        delete [] denseStartDeriv;
+    if (denseEndDeriv != NULL)
+        delete [] denseEndDeriv;
+
+    stepStart = denseStart = denseEnd = denseStartDeriv = denseEndDeriv = NULL;
+    denseStep = 0.0;
+    denseEndDerivKnown = false;
+}
+
+//------------------------------------------------------------------------------
+// void RungeKutta::SetupDenseOutput()
+//------------------------------------------------------------------------------
+/**
+ * Allocates the dense output arrays and checks the coefficients for a stage
+ * that evaluates the derivative at the end of the step.
+ *
+ * Dense output needs a first stage at the start of the step, and first order
+ * derivatives (the Nystrom integrators store accelerations in the stages).
+ */
+//------------------------------------------------------------------------------
+void RungeKutta::SetupDenseOutput()
+{
+    ClearDenseArrays();
+    fsalStage = -1;
+
+    if ((derivativeOrder != 1) || (ai == NULL) || (ai[0] != 0.0))
+        return;
+
+    stepStart       = new Real[dimension];
+    denseStart      = new Real[dimension];
+    denseEnd        = new Real[dimension];
+    denseStartDeriv = new Real[dimension];
+    denseEndDeriv   = new Real[dimension];
+
+    // A stage at the end of the step whose state is the propagated state
+    for (Integer i = stages - 1; i > 0; --i)
+    {
+        if ((ai[i] != 1.0) || (cj[i] != 0.0))
+            continue;
+
+        bool isFsal = true;
+        for (Integer j = 0; j < i; ++j)
+            if (bij[i][j] != cj[j])
+                isFsal = false;
+        for (Integer j = i + 1; j < stages; ++j)
+            if (cj[j] != 0.0)
+                isFsal = false;
+
+        if (isFsal)
+        {
+            fsalStage = i;
+            break;
+        }
+    }
+}
+
 //------------------------------------------------------------------------------
 // bool RungeKutta::SetupAccumulator()
 //------------------------------------------------------------------------------
@@ -796,6 +1015,8 @@ bool RungeKutta::SetupAccumulator()
             return false;
         }
 
+        SetupDenseOutput();
+
         if (ki)
         {
             for (int i = 0; i < stages; i++)
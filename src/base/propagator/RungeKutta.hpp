@@ -163,6 +163,9 @@ public:
     virtual bool Step(Real dt);
     virtual bool RawStep();
 
+    virtual bool CanInterpolate(Real atTime);
+    virtual bool GetDenseState(Real atTime, Real *denseState);
+
 protected:
     /// The number of stages used to take an integration step
     Integer stages;
@@ -188,11 +191,34 @@ protected:
     /// Candidate state for the step (used if the error is acceptable)
     Real * candidateState;
 
+    // Dense output: the last accepted step is kept as a cubic Hermite segment
+    /// State at the start of the step in progress
+    Real * stepStart;
+    /// State at the start of the last accepted step
+    Real * denseStart;
+    /// State at the end of the last accepted step
+    Real * denseEnd;
+    /// Step size times the derivative at the start of the step
+    Real * denseStartDeriv;
+    /// Step size times the derivative at the end of the step
+    Real * denseEndDeriv;
+    /// Elapsed time at the start of the last accepted step
+    Real denseTime;
+    /// Size of the last accepted step; 0.0 if there is no dense output
+    Real denseStep;
+    /// Flag indicating that denseEndDeriv is filled for the current step
+    bool denseEndDerivKnown;
+    /// Stage evaluated at the end state (first same as last), or -1
+    Integer fsalStage;
+
 
     bool SetupAccumulator();
     void ClearArrays();
     virtual Real EstimateError();
     virtual bool AdaptStep(Real maxerror);
+    void StoreDenseData();
+    void ClearDenseArrays();
+    void SetupDenseOutput();
 
     //------------------------------------------------------------------------------
     // virtual void SetCoefficients(void)
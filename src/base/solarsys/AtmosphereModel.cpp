@@ -1701,8 +1701,7 @@ void AtmosphereModel::GetInputs(GmatEpoch epoch)
          switch(historicalDataSource)
          {
          case 1:
-            fDbuffer = fluxReader->GetInputs(epoch);
-            fluxReader->PrepareApData(fDbuffer, epoch);
+            fDbuffer = fluxReader->GetApInputs(epoch);
             f107 = fDbuffer.obsF107;
             f107a = fDbuffer.obsCtrF107a;
       for (Integer i = 0; i < 7; i++)
@@ -1730,8 +1729,7 @@ void AtmosphereModel::GetInputs(GmatEpoch epoch)
          {
          case 1:
          case 2:
-            fDbuffer = fluxReader->GetInputs(epoch);
-            fluxReader->PrepareApData(fDbuffer, epoch);
+            fDbuffer = fluxReader->GetApInputs(epoch);
             f107 = fDbuffer.obsF107;
             f107a = fDbuffer.obsCtrF107a;
             for (Integer i = 0; i < 7; i++)
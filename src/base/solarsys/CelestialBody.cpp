@@ -62,6 +62,7 @@
 #include "TimeTypes.hpp"
 #include "StateConversionUtil.hpp"
 #include "StringUtil.hpp"               // for ToString()
+#include "SharedDataLock.hpp"
 
 //#define DEBUG_CELESTIAL_BODY 1
 //#define DEBUG_GET_STATE
@@ -100,6 +101,27 @@
 using namespace GmatMathUtil;
 
 
+//------------------------------------------------------------------------------
+// const Rvector6& StateForCaller(const Rvector6 &bodyState)
+//------------------------------------------------------------------------------
+/**
+ * Returns a body state for GetState().  While parallel propagation shares the
+ * bodies, the state is copied to a buffer owned by the calling thread, so an
+ * ephemeris update on another thread cannot change it before the caller copies
+ * it.
+ */
+//------------------------------------------------------------------------------
+static const Rvector6& StateForCaller(const Rvector6 &bodyState)
+{
+   if (!SharedDataLock::IsEnabled())
+      return bodyState;
+
+   static thread_local Rvector6 threadState;
+   threadState = bodyState;
+   return threadState;
+}
+
+
 //------------------------------------------------------------------------------
 // static data
 //------------------------------------------------------------------------------
@@ -1021,6 +1043,10 @@ Real CelestialBody::GetFirstStateTime(){
 //------------------------------------------------------------------------------
 const Rvector6&  CelestialBody::GetState(A1Mjd atTime)
 {
+   // The ephemeris reader and the state buffers are shared by every user of
+   // the body
+   SharedDataLock::Guard guard;
+
    if (!theCentralBody) SetUpBody();
 
    #ifdef DEBUG_GET_STATE
@@ -1038,7 +1064,7 @@ const Rvector6&  CelestialBody::GetState(A1Mjd atTime)
       #ifdef DEBUG_GET_STATE
       MessageInterface::ShowMessage("   returning lastState %s\n", state.ToString().c_str());
       #endif
-      return lastState;
+      return StateForCaller(lastState);
    }
    
    Real*     posVel = NULL;
@@ -1110,7 +1136,7 @@ const Rvector6&  CelestialBody::GetState(A1Mjd atTime)
    MessageInterface::ShowMessage("   returning state %s\n", state.ToString().c_str());
    #endif
    
-   return state;
+   return StateForCaller(state);
 }
 
 
@@ -1131,6 +1157,8 @@ const Rvector6&  CelestialBody::GetState(A1Mjd atTime)
 //------------------------------------------------------------------------------
 const Rvector6&  CelestialBody::GetState(GmatTime atTime)
 {
+   SharedDataLock::Guard guard;
+
    if (!theCentralBody) SetUpBody();
 
 #ifdef DEBUG_GET_STATE
@@ -1148,7 +1176,7 @@ const Rvector6&  CelestialBody::GetState(GmatTime atTime)
 #ifdef DEBUG_GET_STATE
       MessageInterface::ShowMessage("   returning lastState %s\n", state.ToString().c_str());
 #endif
-      return lastState;
+      return StateForCaller(lastState);
    }
 
    Real*     posVel = NULL;
@@ -1228,7 +1256,7 @@ const Rvector6&  CelestialBody::GetState(GmatTime atTime)
    MessageInterface::ShowMessage("   returning state %s\n", state.ToString().c_str());
 #endif
 
-   return state;
+   return StateForCaller(state);
 }
 
 
@@ -1461,6 +1489,8 @@ const Rvector6&  CelestialBody::GetState(Real atTime)
 //------------------------------------------------------------------------------
 void CelestialBody::GetState(const A1Mjd &atTime, Real *outState)
 {
+   SharedDataLock::Guard guard;
+
    #ifdef DEBUG_GET_STATE
       MessageInterface::ShowMessage("Entering GetState with time %.17f\n",
       atTime.Get());
@@ -1598,6 +1628,8 @@ void CelestialBody::GetState(const A1Mjd &atTime, Real *outState)
 //------------------------------------------------------------------------------
 void CelestialBody::GetState(const GmatTime &atTime, Real *outState)
 {
+   SharedDataLock::Guard guard;
+
 #ifdef DEBUG_GET_STATE
    MessageInterface::ShowMessage("Entering GetState with time %.17f\n",
       GmatTime(atTime).GetMjd());
@@ -3117,6 +3149,8 @@ void CelestialBody::Set3dViewModelId(int id)
 //------------------------------------------------------------------------------
 const Rvector6 CelestialBody::GetMJ2000State(const A1Mjd &atTime)
 {
+   SharedDataLock::Guard guard;
+
    #ifdef DEBUG_CB_GET_MJ2000_STATE
    MessageInterface::ShowMessage("In GetMJ2000State, body is %s, time is %12.10f\n",
          instanceName.c_str(), atTime.Get());
@@ -3244,6 +3278,8 @@ const Rvector3 CelestialBody::GetMJ2000Velocity(const A1Mjd &atTime)
 //------------------------------------------------------------------------------
 const Rvector6 CelestialBody::GetMJ2000State(const GmatTime &atTime)
 {
+   SharedDataLock::Guard guard;
+
 #ifdef DEBUG_CB_GET_MJ2000_STATE
    MessageInterface::ShowMessage("In GetMJ2000State, body is %s, time is %12.10f\n",
       instanceName.c_str(), GmatTime(atTime).GetMjd());
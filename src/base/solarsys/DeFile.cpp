@@ -44,6 +44,7 @@
 #include "DeFile.hpp"
 #include "TimeSystemConverter.hpp"
 #include "MessageInterface.hpp"
+#include "MemoryMappedFile.hpp"
 #include <sstream>
 
 //#define __UNIT_TEST__
@@ -102,15 +103,19 @@ const Real DeFile::TT_OFFSET      = GmatTimeConstants::TT_TAI_OFFSET;
 //------------------------------------------------------------------------------
 //------------------------------------------------------------------------------
 //  DeFile(Gmat::DeFileType ofType, std::string fileName = "",
-//         Gmat::DeFileFormat fmt = DE_BINARY)
+//         Gmat::DeFileFormat fmt = DE_BINARY, bool memoryMapped = true)
 //------------------------------------------------------------------------------
 /**
  * This method creates an object of the DeFile class
  * (default constructor).
  *
- * @param <ofType>   parameter indicating the type of De File.
- * @param <fileName> parameter indicating the full path name of the file.
- * @param <fmt>      parameter indicating the format of the file.
+ * @param <ofType>       parameter indicating the type of De File.
+ * @param <fileName>     parameter indicating the full path name of the file.
+ * @param <fmt>          parameter indicating the format of the file.
+ * @param <memoryMapped> read the coefficient records in place from a shared
+ *                       memory mapping of the binary file rather than through
+ *                       fseek/fread.  Falls back to file reads if the file
+ *                       cannot be mapped.
  *
  * @note if an ASCII file is input on creation, it will be converted to
  *       a file in native binary format; the binary file will be read, for
@@ -118,8 +123,14 @@ const Real DeFile::TT_OFFSET      = GmatTimeConstants::TT_TAI_OFFSET;
  */
 //------------------------------------------------------------------------------
 DeFile::DeFile(Gmat::DeFileType ofType, std::string fileName,
-               Gmat::DeFileFormat fmt) :
-   PlanetaryEphem(fileName)
+               Gmat::DeFileFormat fmt, bool memoryMapped) :
+   PlanetaryEphem(fileName),
+   Ephemeris_File (NULL),
+   coeffRecord    (Coeff_Array),
+   useMemoryMap   (memoryMapped),
+   mappedFile     (NULL),
+   currentRecord  (0),
+   recordCount    (0)
 {
    defType       = ofType;
    theFileFormat = fmt;
@@ -149,6 +160,11 @@ DeFile::DeFile(const DeFile& def) :
    defType        (def.defType),
    arraySize      (def.arraySize),
    Ephemeris_File (def.Ephemeris_File),
+   coeffRecord    (Coeff_Array),
+   useMemoryMap   (def.useMemoryMap),
+   mappedFile     (NULL),
+   currentRecord  (def.currentRecord),
+   recordCount    (def.recordCount),
    T_beg          (def.T_beg),
    T_end          (def.T_end),
    T_span         (def.T_span),
@@ -166,6 +182,13 @@ DeFile::DeFile(const DeFile& def) :
 
    int i;
    for (i=0;i<MAX_ARRAY_SIZE;i++)  Coeff_Array[i] = def.Coeff_Array[i];
+
+   // Share the mapping; the current record stays valid as long as we hold it
+   if (def.mappedFile != NULL)
+   {
+      mappedFile  = MemoryMappedFile::Open(def.mappedFile->GetPath());
+      coeffRecord = def.coeffRecord;
+   }
 }
 
 //------------------------------------------------------------------------------
@@ -202,6 +225,18 @@ DeFile& DeFile::operator=(const DeFile& def)
    Ephemeris_File = def.Ephemeris_File;
    int i;
    for (i=0;i<MAX_ARRAY_SIZE;i++)  Coeff_Array[i] = def.Coeff_Array[i];
+
+   MemoryMappedFile::Release(mappedFile);
+   mappedFile     = NULL;
+   coeffRecord    = Coeff_Array;
+   if (def.mappedFile != NULL)
+   {
+      mappedFile  = MemoryMappedFile::Open(def.mappedFile->GetPath());
+      coeffRecord = def.coeffRecord;
+   }
+   useMemoryMap   = def.useMemoryMap;
+   currentRecord  = def.currentRecord;
+   recordCount    = def.recordCount;
    T_beg          = def.T_beg;
    T_end          = def.T_end;
    T_span         = def.T_span;
@@ -222,6 +257,8 @@ DeFile& DeFile::operator=(const DeFile& def)
 //------------------------------------------------------------------------------
 DeFile::~DeFile()
 {
+   MemoryMappedFile::Release(mappedFile);
+
    // close the file, if it's open
    if (Ephemeris_File != NULL)
    {
@@ -257,6 +294,19 @@ void DeFile::Initialize()
    #endif
 }
 
+//------------------------------------------------------------------------------
+// bool IsMemoryMapped() const
+//------------------------------------------------------------------------------
+/**
+ * This method returns true if the coefficient records are read from a memory
+ * mapping of the DE file, false if they are read with file I/O.
+ */
+//------------------------------------------------------------------------------
+bool DeFile::IsMemoryMapped() const
+{
+   return (mappedFile != NULL);
+}
+
 //------------------------------------------------------------------------------
 //  Integer GetBodyID(std::string bodyName)
 //------------------------------------------------------------------------------
@@ -1023,12 +1073,21 @@ void DeFile::Read_Coefficients( double Time )
    // if time is less than file begin time, do not update time info.
    if (Time > mFileBeg) //loj: 9/15/05 Added
    {
-      fseek(Ephemeris_File,(Offset-1)*arraySize*sizeof(double),SEEK_CUR);
+      size_t len;
+      if (mappedFile != NULL)
+      {
+         // Records are addressed in place; no file I/O
+         len = (SelectMappedRecord(currentRecord + Offset) ? arraySize : 0);
+      }
+      else
+      {
+         fseek(Ephemeris_File,(Offset-1)*arraySize*sizeof(double),SEEK_CUR);
 
-      // Intentionally get the return and then ignore it to move warning from
-      // system libraries to GMAT code base.  The "unused variable" warning here
-      // can be safely ignored.
-      size_t len = fread(&Coeff_Array,sizeof(double),arraySize,Ephemeris_File);
+         // Intentionally get the return and then ignore it to move warning from
+         // system libraries to GMAT code base.  The "unused variable" warning
+         // here can be safely ignored.
+         len = fread(&Coeff_Array,sizeof(double),arraySize,Ephemeris_File);
+      }
       if ((Integer)len != arraySize)
       {
          // Write detaild message (LOJ: 2015.10.03)
@@ -1039,8 +1098,8 @@ void DeFile::Read_Coefficients( double Time )
          throw ex;
       }
       
-      T_beg  = Coeff_Array[0] - baseEpoch;
-      T_end  = Coeff_Array[1] - baseEpoch;
+      T_beg  = coeffRecord[0] - baseEpoch;
+      T_end  = coeffRecord[1] - baseEpoch;
       T_span = T_end - T_beg;
    }
 }
@@ -1091,12 +1150,21 @@ void DeFile::Read_Coefficients(GmatTime Time)
    // if time is less than file begin time, do not update time info.
    if (Time > mFileBeg) //loj: 9/15/05 Added
    {
-      fseek(Ephemeris_File, (Offset - 1)*arraySize*sizeof(double), SEEK_CUR);
+      size_t len;
+      if (mappedFile != NULL)
+      {
+         // Records are addressed in place; no file I/O
+         len = (SelectMappedRecord(currentRecord + Offset) ? arraySize : 0);
+      }
+      else
+      {
+         fseek(Ephemeris_File, (Offset - 1)*arraySize*sizeof(double), SEEK_CUR);
 
-      // Intentionally get the return and then ignore it to move warning from
-      // system libraries to GMAT code base.  The "unused variable" warning here
-      // can be safely ignored.
-      size_t len = fread(&Coeff_Array, sizeof(double), arraySize, Ephemeris_File);
+         // Intentionally get the return and then ignore it to move warning from
+         // system libraries to GMAT code base.  The "unused variable" warning
+         // here can be safely ignored.
+         len = fread(&Coeff_Array, sizeof(double), arraySize, Ephemeris_File);
+      }
       if ((Integer)len != arraySize)
       {
          // Write detaild message (LOJ: 2015.10.03)
@@ -1107,8 +1175,8 @@ void DeFile::Read_Coefficients(GmatTime Time)
          throw ex;
       }
 
-      T_beg = Coeff_Array[0] - baseEpoch;
-      T_end = Coeff_Array[1] - baseEpoch;
+      T_beg = coeffRecord[0] - baseEpoch;
+      T_end = coeffRecord[1] - baseEpoch;
       T_span = T_end - T_beg;
    }
 }
@@ -1138,6 +1206,26 @@ int DeFile::Initialize_Ephemeris( char *fileName )
    
    int headerID;
   
+   /*--------------------------------------------------------------------------*/
+   /*  Map the ephemeris file if requested; header and record data are then    */
+   /*  read in place.                                                          */
+   /*--------------------------------------------------------------------------*/
+   MemoryMappedFile::Release(mappedFile);
+   mappedFile  = NULL;
+   coeffRecord = Coeff_Array;
+
+   if (useMemoryMap && MapEphemeris(fileName))
+   {
+      R1 = H1.data;
+
+      T_beg  = coeffRecord[0] - baseEpoch;
+      T_end  = coeffRecord[1] - baseEpoch;
+      T_span = T_end - T_beg;
+
+      headerID = (int) R1.DENUM;
+      return (headerID == EPHEMERIS ? SUCCESS : FAILURE);
+   }
+
    /*--------------------------------------------------------------------------*/
    /*  Open ephemeris file.                                                    */
    /*--------------------------------------------------------------------------*/
@@ -1161,8 +1249,8 @@ int DeFile::Initialize_Ephemeris( char *fileName )
       R1 = H1.data;
               
       /*..........................................Set current time variables */
-      T_beg  = Coeff_Array[0] - baseEpoch;
-      T_end  = Coeff_Array[1] - baseEpoch;
+      T_beg  = coeffRecord[0] - baseEpoch;
+      T_end  = coeffRecord[1] - baseEpoch;
       T_span = T_end - T_beg;
 
       /*..............................Convert header ephemeris ID to integer */
@@ -1205,6 +1293,96 @@ int DeFile::Initialize_Ephemeris( char *fileName )
    }
 }
 
+//------------------------------------------------------------------------------
+// bool MapEphemeris(const char *fileName)
+//------------------------------------------------------------------------------
+/**
+ * Maps the binary DE file and points the current record at the first
+ * coefficient record.  The mapping is shared with every other DeFile that
+ * reads the same file (e.g. the solar systems of Sandbox clones).
+ *
+ * @param fileName The binary DE file
+ *
+ * @return true if the file was mapped and holds at least one data record;
+ *         false if the caller should fall back to buffered file reads
+ */
+//------------------------------------------------------------------------------
+bool DeFile::MapEphemeris(const char *fileName)
+{
+   mappedFile = MemoryMappedFile::Open(fileName);
+   if (mappedFile == NULL)
+      return false;
+
+   // Two header records precede the coefficient records
+   size_t recordBytes = arraySize * sizeof(double);
+   Integer records = (Integer)(mappedFile->GetSize() / recordBytes) - 2;
+   if (records < 1)
+   {
+      MemoryMappedFile::Release(mappedFile);
+      mappedFile = NULL;
+      return false;
+   }
+
+   // The header records are packed; copy them field by field
+   const char *header = mappedFile->GetData();
+   recOneType &one = H1.data;
+   memcpy(one.label, header, sizeof(one.label));
+   header += sizeof(one.label);
+   memcpy(one.constName, header, sizeof(one.constName));
+   header += sizeof(one.constName);
+   memcpy(one.timeData, header, sizeof(one.timeData));
+   header += sizeof(one.timeData);
+   memcpy(&one.numConst, header, sizeof(one.numConst));
+   header += sizeof(one.numConst);
+   memcpy(&one.AU, header, sizeof(one.AU));
+   header += sizeof(one.AU);
+   memcpy(&one.EMRAT, header, sizeof(one.EMRAT));
+   header += sizeof(one.EMRAT);
+   memcpy(one.coeffPtr, header, sizeof(one.coeffPtr));
+   header += sizeof(one.coeffPtr);
+   memcpy(&one.DENUM, header, sizeof(one.DENUM));
+   header += sizeof(one.DENUM);
+   memcpy(one.libratPtr, header, sizeof(one.libratPtr));
+   header += sizeof(one.libratPtr);
+   memcpy(&one.RSize, header, sizeof(one.RSize));
+
+   header = mappedFile->GetData() + recordBytes;
+   memcpy(H2.data.constValue, header, sizeof(H2.data.constValue));
+
+   recordCount = records;
+   SelectMappedRecord(0);
+
+   #ifdef DEBUG_DEFILE_INIT
+   MessageInterface::ShowMessage
+      ("   Mapped %s, %d coefficient records\n", fileName, recordCount);
+   #endif
+
+   return true;
+}
+
+//------------------------------------------------------------------------------
+// bool SelectMappedRecord(Integer recordIndex)
+//------------------------------------------------------------------------------
+/**
+ * Makes a record of the mapped file the current coefficient record.
+ *
+ * @param recordIndex Index of the coefficient record, 0 being the first
+ *                    record after the headers
+ *
+ * @return true if the record exists, false if it is off the file
+ */
+//------------------------------------------------------------------------------
+bool DeFile::SelectMappedRecord(Integer recordIndex)
+{
+   if ((recordIndex < 0) || (recordIndex >= recordCount))
+      return false;
+
+   currentRecord = recordIndex;
+   coeffRecord   = (const double*)(mappedFile->GetData()) +
+                   (size_t)(recordIndex + 2) * arraySize;
+   return true;
+}
+
 /**==========================================================================**/
 /**  Interpolate_Libration                                                   **/
 /**                                                                          **/
@@ -1286,7 +1464,7 @@ void DeFile::Interpolate_Libration( double Time , int Target ,
    if ( G == 1 )
    {
       Tc = 2.0*(Time - T_beg) / T_span - 1.0;
-      for (i=C ; i<(C+3*N) ; i++)  A[i-C] = Coeff_Array[i];
+      for (i=C ; i<(C+3*N) ; i++)  A[i-C] = coeffRecord[i];
    }
    else if ( G > 1 )
    {
@@ -1306,7 +1484,7 @@ void DeFile::Interpolate_Libration( double Time , int Target ,
       Tc = 2.0*(Time - T_seg) / T_sub - 1.0;
       C  = C + 3 * offset * N;
        
-      for (i=C ; i<(C+3*N) ; i++) A[i-C] = Coeff_Array[i];
+      for (i=C ; i<(C+3*N) ; i++) A[i-C] = coeffRecord[i];
    }
    else                                   /* Something has gone terribly wrong */
    {
@@ -1411,7 +1589,7 @@ void DeFile::Interpolate_Libration( const GmatTime &Time , int Target ,
    if ( G == 1 )
    {
       Tc = 2.0*(Time - T_beg).GetMjd() / T_span - 1.0;
-      for (i=C ; i<(C+3*N) ; i++)  A[i-C] = Coeff_Array[i];
+      for (i=C ; i<(C+3*N) ; i++)  A[i-C] = coeffRecord[i];
    }
    else if ( G > 1 )
    {
@@ -1431,7 +1609,7 @@ void DeFile::Interpolate_Libration( const GmatTime &Time , int Target ,
       Tc = 2.0*(Time - T_seg).GetMjd() / T_sub - 1.0;
       C  = C + 3 * offset * N;
        
-      for (i=C ; i<(C+3*N) ; i++) A[i-C] = Coeff_Array[i];
+      for (i=C ; i<(C+3*N) ; i++) A[i-C] = coeffRecord[i];
    }
    else                                   /* Something has gone terribly wrong */
    {
@@ -1534,7 +1712,7 @@ void DeFile::Interpolate_Nutation( double Time , int Target , double Nutation[2]
    if ( G == 1 )
    {
       Tc = 2.0*(Time - T_beg) / T_span - 1.0;
-      for (i=C ; i<(C+3*N) ; i++)  A[i-C] = Coeff_Array[i];
+      for (i=C ; i<(C+3*N) ; i++)  A[i-C] = coeffRecord[i];
    }
    else if ( G > 1 )
    {
@@ -1554,7 +1732,7 @@ void DeFile::Interpolate_Nutation( double Time , int Target , double Nutation[2]
       Tc = 2.0*(Time - T_seg) / T_sub - 1.0;
       C  = C + 3 * offset * N;
        
-      for (i=C ; i<(C+3*N) ; i++) A[i-C] = Coeff_Array[i];
+      for (i=C ; i<(C+3*N) ; i++) A[i-C] = coeffRecord[i];
    }
    else                                   /* Something has gone terribly wrong */
    {
@@ -1642,7 +1820,7 @@ void DeFile::Interpolate_Position( double Time , int Target , double Position[3]
    if ( G == 1 )
    {
       Tc = 2.0*(Time - T_beg) / T_span - 1.0;
-      for (i=C ; i<(C+3*N) ; i++)  A[i-C] = Coeff_Array[i];
+      for (i=C ; i<(C+3*N) ; i++)  A[i-C] = coeffRecord[i];
    }
    else if ( G > 1 )
    {
@@ -1662,7 +1840,7 @@ void DeFile::Interpolate_Position( double Time , int Target , double Position[3]
       Tc = 2.0*(Time - T_seg) / T_sub - 1.0;
       C  = C + 3 * offset * N;
        
-      for (i=C ; i<(C+3*N) ; i++) A[i-C] = Coeff_Array[i];
+      for (i=C ; i<(C+3*N) ; i++) A[i-C] = coeffRecord[i];
    }
    else                                   /* Something has gone terribly wrong */
    {
@@ -1766,7 +1944,7 @@ void DeFile::Interpolate_State(double Time , int Target, stateType *p)
    if ( G == 1 )
    {
       Tc = 2.0*(Time - T_beg) / T_span - 1.0;
-      for (i=C ; i<(C+3*N) ; i++)  A[i-C] = Coeff_Array[i];
+      for (i=C ; i<(C+3*N) ; i++)  A[i-C] = coeffRecord[i];
    }
    else if ( G > 1 )
    {
@@ -1785,7 +1963,7 @@ void DeFile::Interpolate_State(double Time , int Target, stateType *p)
       Tc = 2.0*(Time - T_seg) / T_sub - 1.0;
       C  = C + 3 * offset * N;
        
-      for (i=C ; i<(C+3*N) ; i++) A[i-C] = Coeff_Array[i];
+      for (i=C ; i<(C+3*N) ; i++) A[i-C] = coeffRecord[i];
    }
    else                                   /* Something has gone terribly wrong */
    {
@@ -1898,7 +2076,7 @@ void DeFile::Interpolate_State(GmatTime Time, int Target, stateType *p)
       
       Tc = 2.0*(Time - T_beg).GetMjd() / T_span - 1.0;
 
-      for (i = C; i<(C + 3 * N); i++)  A[i - C] = Coeff_Array[i];
+      for (i = C; i<(C + 3 * N); i++)  A[i - C] = coeffRecord[i];
    }
    else if (G > 1)
    {
@@ -1921,7 +2099,7 @@ void DeFile::Interpolate_State(GmatTime Time, int Target, stateType *p)
       Tc = 2.0*(Time - T_seg).GetMjd() / T_sub - 1.0;
       C = C + 3 * offset * N;
 
-      for (i = C; i<(C + 3 * N); i++) A[i - C] = Coeff_Array[i];
+      for (i = C; i<(C + 3 * N); i++) A[i - C] = coeffRecord[i];
    }
    else                                   /* Something has gone terribly wrong */
    {
@@ -2054,7 +2232,7 @@ void DeFile::Interpolate_State_Delta(const GmatTime &Time, const GmatTime &Time2
       Tc2 = 2.0*(Time2 - T_beg).GetMjd() / T_span - 1.0;
       dt = 2.0*(Time2 - Time).GetMjd() / T_span;
 
-      for (i = C; i<(C + 3 * N); i++)  A[i - C] = Coeff_Array[i];
+      for (i = C; i<(C + 3 * N); i++)  A[i - C] = coeffRecord[i];
    }
    else if (G > 1)
    {
@@ -2079,7 +2257,7 @@ void DeFile::Interpolate_State_Delta(const GmatTime &Time, const GmatTime &Time2
       dt = 2.0*(Time2 - Time).GetMjd() / T_sub;
       C = C + 3 * offset * N;
 
-      for (i = C; i<(C + 3 * N); i++) A[i - C] = Coeff_Array[i];
+      for (i = C; i<(C + 3 * N); i++) A[i - C] = coeffRecord[i];
    }
    else                                   /* Something has gone terribly wrong */
    {
@@ -48,13 +48,16 @@
 
 #include <stdio.h> // for FILE, etc. (for JPL/JSC code (Hoffman))
 
+class MemoryMappedFile;
+
 class GMAT_API DeFile : public PlanetaryEphem
 {
 public:
 
    /// default constructor
    DeFile(Gmat::DeFileType ofType, std::string fileName = "",
-          Gmat::DeFileFormat fmt = Gmat::DE_BINARY);  
+          Gmat::DeFileFormat fmt = Gmat::DE_BINARY,
+          bool memoryMapped = true);
    /// copy constructor
    DeFile(const DeFile& def);
    /// operator=
@@ -75,6 +78,8 @@ public:
    // std::string      GetBinaryFileName() const;
    // /// method to return the type of De File
     Gmat::DeFileType GetDeFileType() const;
+   /// method to check whether records are read from a memory mapped file
+   bool             IsMemoryMapped() const;
    
    /// method to return the position and velocity of the specified body
    /// at the specified time
@@ -337,6 +342,18 @@ private:
    recOneType         R1;
    FILE               *Ephemeris_File;
    double             Coeff_Array[MAX_ARRAY_SIZE];   // MAX
+   /// Coefficients of the current record; points to Coeff_Array for buffered
+   /// reads or directly into the shared mapping of the file
+   const double       *coeffRecord;
+
+   /// Flag requesting that the binary file be memory mapped when possible
+   bool               useMemoryMap;
+   /// Shared mapping of the binary file, or NULL for buffered file reads
+   MemoryMappedFile   *mappedFile;
+   /// Index of the current coefficient record (0 is the first data record)
+   Integer            currentRecord;
+   /// Number of coefficient records in the mapped file
+   Integer            recordCount;
    double             T_beg , T_end , T_span;
    /// The base epoch for internal time calculations
    double             baseEpoch;
@@ -371,6 +388,9 @@ private:
    /*-------------------------------------------------------------------------*/
    int Initialize_Ephemeris( char *fileName );
 
+   bool MapEphemeris(const char *fileName);
+   bool SelectMappedRecord(Integer recordIndex);
+
    /*-------------------------------------------------------------------------*/
    /*  Interpolate_Libration     - from JPL/JSC code (Hoffman)                */
    /*-------------------------------------------------------------------------*/
@@ -181,7 +181,9 @@ SolarFluxReader::SolarFluxReader():
    warnEpochAfter    (true),
    f107RefEpoch      (18408.0),  // 5/31/91, epoch when the station moved (Vallado)
    interpolateFlux   (true),
-   interpolateGeo    (false)
+   interpolateGeo    (false),
+   apInputsEpoch     (-1.0),
+   kpInputsEpoch     (-1.0)
 {
    if (!obsFluxData.empty())
       obsFluxData.clear();
@@ -229,12 +231,15 @@ SolarFluxReader::SolarFluxReader(const SolarFluxReader &sfr) :
    warnEpochAfter    (true),
    f107RefEpoch      (sfr.f107RefEpoch),
    interpolateFlux   (sfr.interpolateFlux),
-   interpolateGeo    (sfr.interpolateGeo)
+   interpolateGeo    (sfr.interpolateGeo),
+   apInputsEpoch     (-1.0),
+   kpInputsEpoch     (-1.0)
 {
    obsFileName = sfr.obsFileName;
    predictFileName = sfr.predictFileName;
    obsFluxData = sfr.obsFluxData;
    predictFluxData = sfr.predictFluxData;
+   predictDayIndex = sfr.predictDayIndex;
    beg_ObsTag = sfr.beg_ObsTag;
    end_ObsTag = sfr.end_ObsTag;
    begObs = sfr.begObs;
@@ -259,6 +264,7 @@ SolarFluxReader& SolarFluxReader::operator=(const SolarFluxReader &sfr)
    predictFileName = sfr.predictFileName;
    obsFluxData = sfr.obsFluxData;
    predictFluxData = sfr.predictFluxData;
+   predictDayIndex = sfr.predictDayIndex;
    beg_ObsTag = sfr.beg_ObsTag;
    end_ObsTag = sfr.end_ObsTag;
    begObs = sfr.begObs;
@@ -277,6 +283,7 @@ SolarFluxReader& SolarFluxReader::operator=(const SolarFluxReader &sfr)
    f107RefEpoch = sfr.f107RefEpoch;
    interpolateFlux = sfr.interpolateFlux;
    interpolateGeo = sfr.interpolateGeo;
+   ClearPreparedInputs();
 
    return *this;
 }
@@ -339,6 +346,8 @@ bool SolarFluxReader::LoadFluxData(const std::string &obsFile, const std::string
 
    obsFluxData.clear();
    predictFluxData.clear();
+   predictDayIndex.clear();
+   ClearPreparedInputs();
 
    FileManager *fm = FileManager::Instance();
 
@@ -733,11 +742,71 @@ bool SolarFluxReader::LoadPredictData()
          predictFluxData[i].index = (Integer)(predictFluxData[i].epoch - predictStart);
          predictFluxData[i].id = i;
       }
+
+      BuildPredictIndex();
    }
 
    return true;
 }
 
+
+//------------------------------------------------------------------------------
+// void BuildPredictIndex()
+//------------------------------------------------------------------------------
+/**
+ * Builds the day-by-day index into the predict records.
+ *
+ * The historic records are daily, so GetInputs() finds them from the day
+ * offset alone.  The predict records are monthly; this table gives the record
+ * in effect at the start of each day, so finding a predict record also takes
+ * constant time.
+ */
+//------------------------------------------------------------------------------
+void SolarFluxReader::BuildPredictIndex()
+{
+   predictDayIndex.clear();
+   if (predictFluxData.empty())
+      return;
+
+   Integer days = (Integer)(predictEnd - predictStart) + 1;
+   UnsignedInt record = 0;
+   predictDayIndex.reserve(days);
+   for (Integer day = 0; day < days; ++day)
+   {
+      GmatEpoch dayStart = predictStart + day;
+      while ((record + 1 < predictFluxData.size()) &&
+             (predictFluxData[record + 1].epoch <= dayStart))
+         ++record;
+      predictDayIndex.push_back(record);
+   }
+}
+
+
+//------------------------------------------------------------------------------
+// Integer FindPredictRecord(GmatEpoch epoch)
+//------------------------------------------------------------------------------
+/**
+ * Finds the last predict record at or before an epoch.
+ *
+ * @param epoch The epoch; must be in [predictStart, predictEnd]
+ *
+ * @return The record index
+ */
+//------------------------------------------------------------------------------
+Integer SolarFluxReader::FindPredictRecord(GmatEpoch epoch)
+{
+   Integer day = (Integer)(epoch - predictStart);
+   if (day >= (Integer)predictDayIndex.size())
+      day = predictDayIndex.size() - 1;
+
+   UnsignedInt record = predictDayIndex[day];
+   while ((record + 1 < predictFluxData.size()) &&
+          (predictFluxData[record + 1].epoch <= epoch))
+      ++record;
+
+   return record;
+}
+
 //------------------------------------------------------------------------------
 // FluxData SolarFluxReader::GetInputs(GmatEpoch epoch)
 //------------------------------------------------------------------------------
@@ -810,15 +879,8 @@ SolarFluxReader::FluxData SolarFluxReader::GetInputs(GmatEpoch epoch)
          else
          {
             // Look up the data for epoch
-            for (UnsignedInt i = 1; i < predictFluxData.size(); ++i)
-            {
-               if (predictFluxData[i].epoch > epoch)
-               {
-                  fD = predictFluxData[i-1];
-                  fD.index = -1;
-                  break;
-               }
-            }
+            fD = predictFluxData[FindPredictRecord(epoch)];
+            fD.index = -1;
          }
       }
       else // Off the CSSI file and there is no predict data read
@@ -884,6 +946,76 @@ SolarFluxReader::FluxData SolarFluxReader::GetInputs(GmatEpoch epoch)
    return fD;
 }
 
+
+//------------------------------------------------------------------------------
+// const FluxData& GetApInputs(GmatEpoch epoch)
+//------------------------------------------------------------------------------
+/**
+ * Gets the flux data for an epoch, prepared for the MSISE models.
+ *
+ * This is GetInputs() followed by PrepareApData().  Drag evaluates the density
+ * several times at each epoch (once per derivative call, plus once per
+ * perturbation when it builds partials), so the last result is kept and
+ * returned again when the epoch repeats.
+ *
+ * @param epoch The epoch for the requested data
+ *
+ * @return The prepared data; valid until the next call
+ */
+//------------------------------------------------------------------------------
+const SolarFluxReader::FluxData& SolarFluxReader::GetApInputs(GmatEpoch epoch)
+{
+   if (epoch != apInputsEpoch)
+   {
+      apInputs = GetInputs(epoch);
+      PrepareApData(apInputs, epoch);
+      apInputsEpoch = epoch;
+   }
+
+   return apInputs;
+}
+
+
+//------------------------------------------------------------------------------
+// const FluxData& GetKpInputs(GmatEpoch epoch)
+//------------------------------------------------------------------------------
+/**
+ * Gets the flux data for an epoch, prepared for the Jacchia-Roberts model.
+ *
+ * This is GetInputs() followed by PrepareKpData(), with the last result kept
+ * as in GetApInputs().
+ *
+ * @param epoch The epoch for the requested data
+ *
+ * @return The prepared data; valid until the next call
+ */
+//------------------------------------------------------------------------------
+const SolarFluxReader::FluxData& SolarFluxReader::GetKpInputs(GmatEpoch epoch)
+{
+   if (epoch != kpInputsEpoch)
+   {
+      kpInputs = GetInputs(epoch);
+      PrepareKpData(kpInputs, epoch);
+      kpInputsEpoch = epoch;
+   }
+
+   return kpInputs;
+}
+
+
+//------------------------------------------------------------------------------
+// void ClearPreparedInputs()
+//------------------------------------------------------------------------------
+/**
+ * Discards the results kept by GetApInputs() and GetKpInputs().
+ */
+//------------------------------------------------------------------------------
+void SolarFluxReader::ClearPreparedInputs()
+{
+   apInputsEpoch = -1.0;
+   kpInputsEpoch = -1.0;
+}
+
 //------------------------------------------------------------------------------
 // PrepareApData(GmatEpoch epoch, Integer index, FluxData &fD)
 //------------------------------------------------------------------------------
@@ -948,7 +1080,7 @@ void SolarFluxReader::PrepareApData(SolarFluxReader::FluxData &fD, GmatEpoch epo
          apValues[j] = fD.ap[i];
       if (fD.index > 0)
       {
-         FluxData fD_OneBefore = obsFluxData[fD.index - 1];
+         const FluxData &fD_OneBefore = obsFluxData[fD.index - 1];
          for (i = 7; i >= 0; j++,i--)
             apValues[j] = fD_OneBefore.ap[i];
       }
@@ -959,7 +1091,7 @@ void SolarFluxReader::PrepareApData(SolarFluxReader::FluxData &fD, GmatEpoch epo
       }
       if (fD.index > 1)
       {
-         FluxData fD_TwoBefore = obsFluxData[fD.index - 2];
+         const FluxData &fD_TwoBefore = obsFluxData[fD.index - 2];
          for (i = 7; i >= 0; j++,i--)
             apValues[j] = fD_TwoBefore.ap[i];
       }
@@ -971,7 +1103,7 @@ void SolarFluxReader::PrepareApData(SolarFluxReader::FluxData &fD, GmatEpoch epo
 
       if ( fD.index > 2)
       {
-         FluxData fD_ThreeBefore = obsFluxData[fD.index - 3];
+         const FluxData &fD_ThreeBefore = obsFluxData[fD.index - 3];
          for (i = 7; i >= 0; j++,i--)
             apValues[j] = fD_ThreeBefore.ap[i];
       }
@@ -1183,7 +1315,7 @@ void SolarFluxReader::PrepareKpData(SolarFluxReader::FluxData &fD, GmatEpoch epo
    if (fD.isObsData)
    {
       f107index = fD.id;
-      FluxData fD_OneBefore = obsFluxData[fD.id - 1];
+      const FluxData &fD_OneBefore = obsFluxData[fD.id - 1];
 
       // Fill in fD.kp[0] so it contains the reading at epoch - 6.7 Hrs, per
       // Vallado and Finkleman
@@ -1548,6 +1680,9 @@ void SolarFluxReader::SetSchattenFlags(Integer timingSet, Integer magnitudeSet)
       schattenApIndex = 2;
    }
 
+   // The prepared predict values depend on the indices
+   ClearPreparedInputs();
+
    #ifdef DEBUG_FIRSTFEW_READS
       numberReadIndex = 0;
    #endif
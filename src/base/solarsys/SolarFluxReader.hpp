@@ -200,8 +200,21 @@ private:
    /// Flag used to toggle interpolation for the geomagnetic index (predict only)
    bool interpolateGeo;
 
+   /// Predict record in effect at the start of each day after predictStart
+   std::vector<Integer> predictDayIndex;
+
+   /// Last result of GetApInputs() and its epoch
+   FluxData apInputs;
+   GmatEpoch apInputsEpoch;
+   /// Last result of GetKpInputs() and its epoch
+   FluxData kpInputs;
+   GmatEpoch kpInputsEpoch;
+
    bool LoadObsData();
    bool LoadPredictData();
+   void BuildPredictIndex();
+   Integer FindPredictRecord(GmatEpoch epoch);
+   void ClearPreparedInputs();
    Real ConvertApToKp(Real ap);
 
 public:
@@ -213,6 +226,10 @@ public:
    bool LoadFluxData(const std::string &obsFile = "", const std::string &predictFile = "");
    /// Get Flux data from either of two vectors filled in during LoadFluxData
    FluxData GetInputs(GmatEpoch epoch);
+   /// Get Flux data prepared for the MSISE models
+   const FluxData& GetApInputs(GmatEpoch epoch);
+   /// Get Flux data prepared for the Jacchia-Roberts model
+   const FluxData& GetKpInputs(GmatEpoch epoch);
 
    void GetEpochs(GmatEpoch &hStart, GmatEpoch &hEnd, GmatEpoch &pStart,
                   GmatEpoch &pEnd);
@@ -2013,10 +2013,11 @@ Real Spacecraft::GetSpacecraftBusPower()
 }
 
 //------------------------------------------------------------------------------
-// RecordEphemeris()
-// Record the Spacecraft ephemeris in the background (needed by Event Location)
+// RecordEphemeris(bool needKernels = true)
+// Record the Spacecraft ephemeris in the background (needed by Event Location);
+// needKernels is false when the caller only searches the in-memory states
 //------------------------------------------------------------------------------
-void Spacecraft::RecordEphemerisData()
+void Spacecraft::RecordEphemerisData(bool needKernels)
 // Set up the ephemMgr here - set the coord sys, obj ptr, etc.
 {
    if (!ephemMgr)
@@ -2028,7 +2029,7 @@ void Spacecraft::RecordEphemerisData()
       ephemMgr->SetSolarSystem(solarSystem);
       ephemMgr->Initialize();
    }
-   ephemMgr->RecordEphemerisData();
+   ephemMgr->RecordEphemerisData(needKernels);
 }
 
 //------------------------------------------------------------------------------
@@ -7910,7 +7911,7 @@ Real Spacecraft::UpdateTotalMass()
    totalMass = dryMass;
    for (ObjectArray::iterator i = tanks.begin(); i < tanks.end(); ++i)
    {
-      totalMass += (*i)->GetRealParameter("FuelMass");
+      totalMass += (*i)->GetRealParameter(FuelTank::FUEL_MASS);
    }
 
    #ifdef DEBUG_UPDATE_TOTAL_MASS
@@ -7947,7 +7948,7 @@ Real Spacecraft::UpdateTotalMass() const
    Real tmass = dryMass;
    for (ObjectArray::const_iterator i = tanks.begin(); i < tanks.end(); ++i)
    {
-      tmass += (*i)->GetRealParameter("FuelMass");
+      tmass += (*i)->GetRealParameter(FuelTank::FUEL_MASS);
    }
 
    #ifdef DEBUG_UPDATE_TOTAL_MASS
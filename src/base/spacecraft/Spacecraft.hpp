@@ -117,7 +117,7 @@ public:
    Real                 GetSpacecraftBusPower();
 
    // Record the Spacecraft ephemeris in the background (needed by Event Location)
-   virtual void         RecordEphemerisData();
+   virtual void         RecordEphemerisData(bool needKernels = true);
    /// Load the recorded ephemeris and start up another file to continue recording
    virtual void         ProvideEphemerisData();
 
@@ -37,6 +37,7 @@
 #include "GmatBase.hpp"
 #include "CoordinateSystem.hpp"
 #include "EphemerisFile.hpp"
+#include "Ephemeris.hpp"
 #include "Publisher.hpp"
 #include "Spacecraft.hpp"
 #include "FileManager.hpp"
@@ -90,7 +91,9 @@ EphemManager::EphemManager(bool deleteFiles) :
    intStart               (0.0),
    intStop                (0.0),
    coverStart             (0.0),
-   coverStop              (0.0)
+   coverStop              (0.0),
+   stateRecord            (NULL),
+   writeKernels           (false)
 {
 #ifdef __USE_SPICE__
    spice = NULL;
@@ -153,6 +156,9 @@ EphemManager::~EphemManager()
    #endif
    // delete the current EphemerisFile
    if (ephemFile) delete ephemFile;
+
+   // and the in-memory copy of the recorded states
+   if (stateRecord) delete stateRecord;
    #ifdef DEBUG_EPHEM_MANAGER
       MessageInterface::ShowMessage("Destructing EphemManager ... deleting spice\n");
    #endif
@@ -187,7 +193,9 @@ EphemManager::EphemManager(const EphemManager& copy) :
    intStart               (copy.intStart),
    intStop                (copy.intStop),
    coverStart             (copy.coverStart),
-   coverStop              (copy.coverStop)
+   coverStop              (copy.coverStop),
+   stateRecord            (NULL),
+   writeKernels           (copy.writeKernels)
 {
    #ifdef __USE_SPICE__
       spice = NULL;
@@ -222,6 +230,10 @@ EphemManager& EphemManager::operator=(const EphemManager& copy)
    intStop                  = copy.intStop;
    coverStart               = copy.coverStart;
    coverStop                = copy.coverStop;
+   // The recorded states belong to the recording ephemFile, which is not copied
+   if (stateRecord) delete stateRecord;
+   stateRecord              = NULL;
+   writeKernels             = copy.writeKernels;
 
    #ifdef __USE_SPICE__
       if (spice) delete spice;
@@ -257,9 +269,21 @@ bool EphemManager::Initialize()
 }
 
 //------------------------------------------------------------------------------
-// RecordEphemerisData()
+// RecordEphemerisData(bool needKernels = true)
+//------------------------------------------------------------------------------
+/**
+ * Starts, or continues, recording the ephemeris of the object.
+ *
+ * The states are always kept in memory.  The temporary SPK kernels are written
+ * and loaded only if a caller needs them; a locator using the native search
+ * does not.
+ *
+ * @param needKernels true if the caller reads the data through SPICE
+ *
+ * @return true on success
+ */
 //------------------------------------------------------------------------------
-bool EphemManager::RecordEphemerisData()
+bool EphemManager::RecordEphemerisData(bool needKernels)
 {
    #ifdef DEBUG_EPHEM_MANAGER
       MessageInterface::ShowMessage(
@@ -267,122 +291,145 @@ bool EphemManager::RecordEphemerisData()
             theObj->GetName().c_str());
    #endif
 
-   Spacecraft *theSc = (Spacecraft*) theObj;
-
    #ifndef __USE_SPICE__
-      std::string errmsg = "ERROR - cannot record ephemeris data for spacecraft ";
-      errmsg += theSc->GetName() + " without SPICE included in build!\n";
-      throw SubscriberException(errmsg);
-   #else
-
-      // If it's already recording, continue
-      if (!ephemFile)
+      if (needKernels)
       {
-         #ifdef DEBUG_EPHEM_MANAGER_FILES
-            MessageInterface::ShowMessage(
-                  "In EphemManager::RecordEphemerisData for SC %s, setting up ephemFile\n",
-                  theObj->GetName().c_str());
-         #endif
-         if (theType != SPK)
-            throw SubscriberException("Only SPK currently allowed for EphemManager\n");
+         Spacecraft *theSc = (Spacecraft*) theObj;
+         std::string errmsg = "ERROR - cannot record ephemeris data for spacecraft ";
+         errmsg += theSc->GetName() + " without SPICE included in build!\n";
+         throw SubscriberException(errmsg);
+      }
+   #endif
 
-         if (!spice)
+   // A user of the kernels may follow users of the in-memory states only.
+   // Recording starts at initialization, so the file can still be replaced
+   // by one that writes the kernels.
+   if (needKernels && !writeKernels && ephemFile)
+   {
+      Publisher::Instance()->Unsubscribe(ephemFile);
+      delete ephemFile;
+      ephemFile = NULL;
+      recording = false;
+   }
+   if (needKernels)
+      writeKernels = true;
+
+   // If it's already recording, continue
+   if (!ephemFile)
+   {
+      #ifdef DEBUG_EPHEM_MANAGER_FILES
+         MessageInterface::ShowMessage(
+               "In EphemManager::RecordEphemerisData for SC %s, setting up ephemFile\n",
+               theObj->GetName().c_str());
+      #endif
+      if (theType != SPK)
+         throw SubscriberException("Only SPK currently allowed for EphemManager\n");
+
+      #ifdef __USE_SPICE__
+         if (writeKernels && !spice)
             spice = new SpiceInterface();
+      #endif
 
-         // Set up the name for the EphemerisFile, and the file name
-         std::stringstream ss("");
-//         ss << "tmp_" << theObjName << "_" << ephemCount << "_" << GmatTimeUtil::FormatCurrentTime(4);
-         ss << "tmp_" << theObjName << "_" << GmatTimeUtil::FormatCurrentTime(4);
-         ephemName = ss.str();
-         ss << ".bsp";
-         fileName = ss.str();
-         #ifdef DEBUG_EM_FILENAME
-            MessageInterface::ShowMessage("(base) Filename for NEW ephemFile is determined to be: %s\n",
-                  fileName.c_str());
-         #endif
-         ephemFile         = new EphemerisFile(ephemName);
-         #ifdef DEBUG_EPHEM_MANAGER_FILES
-            MessageInterface::ShowMessage(
-                  "In EphemManager::RecordEphemerisData, ephemFile is at <%p> with name %s\n",
-                  ephemFile, ephemName.c_str());
-         #endif
+      // Set up the name for the EphemerisFile, and the file name
+      std::stringstream ss("");
+//      ss << "tmp_" << theObjName << "_" << ephemCount << "_" << GmatTimeUtil::FormatCurrentTime(4);
+      ss << "tmp_" << theObjName << "_" << GmatTimeUtil::FormatCurrentTime(4);
+      ephemName = ss.str();
+      ss << ".bsp";
+      fileName = ss.str();
+      #ifdef DEBUG_EM_FILENAME
+         MessageInterface::ShowMessage("(base) Filename for NEW ephemFile is determined to be: %s\n",
+               fileName.c_str());
+      #endif
+      ephemFile         = new EphemerisFile(ephemName);
+      #ifdef DEBUG_EPHEM_MANAGER_FILES
+         MessageInterface::ShowMessage(
+               "In EphemManager::RecordEphemerisData, ephemFile is at <%p> with name %s\n",
+               ephemFile, ephemName.c_str());
+      #endif
 
-         // For now, put it in the Output path << this should be put into the
-         // appropriate TMPDIR for the platform
-//         FileManager *fm = FileManager::Instance();
-//         std::string spkPath = fm->GetPathname(FileManager::OUTPUT_PATH);
-//         fileName = spkPath + fileName;
-         std::string spkTmpPath = GmatFileUtil::GetTemporaryDirectory();
-         fileName = spkTmpPath + fileName;
-         #ifdef DEBUG_EM_FILENAME
-            MessageInterface::ShowMessage("(full-path) Filename for NEW ephemFile is determined to be: %s\n",
-                  fileName.c_str());
-         #endif
-         #ifdef DEBUG_EPHEM_MANAGER_FILES
-            MessageInterface::ShowMessage(
-                  "In EphemManager::RecordEphemerisData,  fileName (full path) = %s\n",
-                  fileName.c_str());
-         #endif
+      // For now, put it in the Output path << this should be put into the
+      // appropriate TMPDIR for the platform
+//      FileManager *fm = FileManager::Instance();
+//      std::string spkPath = fm->GetPathname(FileManager::OUTPUT_PATH);
+//      fileName = spkPath + fileName;
+      std::string spkTmpPath = GmatFileUtil::GetTemporaryDirectory();
+      fileName = spkTmpPath + fileName;
+      #ifdef DEBUG_EM_FILENAME
+         MessageInterface::ShowMessage("(full-path) Filename for NEW ephemFile is determined to be: %s\n",
+               fileName.c_str());
+      #endif
+      #ifdef DEBUG_EPHEM_MANAGER_FILES
+         MessageInterface::ShowMessage(
+               "In EphemManager::RecordEphemerisData,  fileName (full path) = %s\n",
+               fileName.c_str());
+      #endif
 
-         // Set up the EphemerisFile to write what we need - currently only SPK Orbit
-         ephemFile->SetStringParameter("FileFormat", "SPK");
-         ephemFile->SetStringParameter("StateType", "Cartesian");
-         ephemFile->SetStringParameter("Spacecraft", theObjName);
-         ephemFile->SetStringParameter("CoordinateSystem", coordSysName); // only MJ2000Eq so far!!
-         ephemFile->SetStringParameter("Filename", fileName);
-         ephemFile->SetStringParameter("Interpolator", "Hermite");
-         ephemFile->SetIntegerParameter(ephemFile->GetParameterID("InterpolationOrder"), 7);
-//         ephemFile->SetBackgroundGeneration(true); // must be set after initialization
-
-         ephemFile->SetInternalCoordSystem(coordSys);
-         ephemFile->SetRefObject(theObj,   Gmat::SPACECRAFT,        theObjName);
-         ephemFile->SetRefObject(coordSys, Gmat::COORDINATE_SYSTEM, coordSysName);
-
-         ephemFile->Initialize();
-         ephemFile->TakeAction("ToggleOn");
-         ephemFile->SetBackgroundGeneration(true);
-
-         // Subscribe to the data
-         Publisher *pub = Publisher::Instance();
-         #ifdef DEBUG_EPHEM_MANAGER
-            MessageInterface::ShowMessage(
-                  "In EphemManager::RecordEphemerisData, subscribing to publisher\n");
-         #endif
-         pub->Subscribe(ephemFile);
+      // Set up the EphemerisFile to write what we need - currently only SPK Orbit
+      ephemFile->SetStringParameter("FileFormat", "SPK");
+      ephemFile->SetStringParameter("StateType", "Cartesian");
+      ephemFile->SetStringParameter("Spacecraft", theObjName);
+      ephemFile->SetStringParameter("CoordinateSystem", coordSysName); // only MJ2000Eq so far!!
+      ephemFile->SetStringParameter("Filename", fileName);
+      ephemFile->SetStringParameter("Interpolator", "Hermite");
+      ephemFile->SetIntegerParameter(ephemFile->GetParameterID("InterpolationOrder"), 7);
+//      ephemFile->SetBackgroundGeneration(true); // must be set after initialization
+
+      // Keep an in-memory copy of the states for the native event search;
+      // without users of the kernels, no SPK is written
+      if (!stateRecord)
+         stateRecord = new Ephemeris();
+      stateRecord->ClearPoints();
+      ephemFile->SetStateRecord(stateRecord, !writeKernels);
+
+      ephemFile->SetInternalCoordSystem(coordSys);
+      ephemFile->SetRefObject(theObj,   Gmat::SPACECRAFT,        theObjName);
+      ephemFile->SetRefObject(coordSys, Gmat::COORDINATE_SYSTEM, coordSysName);
+
+      ephemFile->Initialize();
+      ephemFile->TakeAction("ToggleOn");
+      ephemFile->SetBackgroundGeneration(true);
+
+      // Subscribe to the data
+      Publisher *pub = Publisher::Instance();
+      #ifdef DEBUG_EPHEM_MANAGER
+         MessageInterface::ShowMessage(
+               "In EphemManager::RecordEphemerisData, subscribing to publisher\n");
+      #endif
+      pub->Subscribe(ephemFile);
 
-         ephemCount++;
-      }
-      else if (!recording)
-      {
-         // Set up the name for the EphemerisFile, and the file name
-         std::stringstream ss("");
-//         ss << "tmp_" << theObjName << "_" << ephemCount << "_" << GmatTimeUtil::FormatCurrentTime(4);
-         ss << "tmp_" << theObjName << "_" << GmatTimeUtil::FormatCurrentTime(4);
-         ephemName = ss.str();
-         ss << ".bsp";
-         fileName = ss.str();
-         std::string spkTmpPath = GmatFileUtil::GetTemporaryDirectory();
-         fileName = spkTmpPath + fileName;
-         #ifdef DEBUG_EM_FILENAME
-            MessageInterface::ShowMessage("(full path) Filename for existing ephemFile is determined to be: %s\n",
-                  fileName.c_str());
-         #endif
-         // if it has an ephemFile but it is not recording,
-         // reset the SPK filename
-         ephemFile->SetStringParameter("Filename", fileName);
-      }
-      else
-      {
-         // continue recording
-         #ifdef DEBUG_EPHEM_MANAGER_FILES
-            MessageInterface::ShowMessage(
-                  "In EphemManager::RecordEphemerisData for SC %s, ephemFile is already recording!!!\n",
-                  theObj->GetName().c_str());
-         #endif
-      }
-      recording = true;
-      return true;
-   #endif
+      ephemCount++;
+   }
+   else if (!recording)
+   {
+      // Set up the name for the EphemerisFile, and the file name
+      std::stringstream ss("");
+//      ss << "tmp_" << theObjName << "_" << ephemCount << "_" << GmatTimeUtil::FormatCurrentTime(4);
+      ss << "tmp_" << theObjName << "_" << GmatTimeUtil::FormatCurrentTime(4);
+      ephemName = ss.str();
+      ss << ".bsp";
+      fileName = ss.str();
+      std::string spkTmpPath = GmatFileUtil::GetTemporaryDirectory();
+      fileName = spkTmpPath + fileName;
+      #ifdef DEBUG_EM_FILENAME
+         MessageInterface::ShowMessage("(full path) Filename for existing ephemFile is determined to be: %s\n",
+               fileName.c_str());
+      #endif
+      // if it has an ephemFile but it is not recording,
+      // reset the SPK filename
+      ephemFile->SetStringParameter("Filename", fileName);
+   }
+   else
+   {
+      // continue recording
+      #ifdef DEBUG_EPHEM_MANAGER_FILES
+         MessageInterface::ShowMessage(
+               "In EphemManager::RecordEphemerisData for SC %s, ephemFile is already recording!!!\n",
+               theObj->GetName().c_str());
+      #endif
+   }
+   recording = true;
+   return true;
 }
 
 //------------------------------------------------------------------------------
@@ -395,7 +442,7 @@ bool EphemManager::ProvideEphemerisData()
             fileName.c_str());
    #endif
    StopRecording(true);   //  false); SPK appending turned off for now.
-   RecordEphemerisData();
+   RecordEphemerisData(writeKernels);
    return true;
 }
 
@@ -460,8 +507,9 @@ void EphemManager::StopRecording(bool done)
       }
 
    }
-   // Load the current SPK file, if it has been written
-   if (GmatFileUtil::DoesFileExist(fileName))
+   // Load the current SPK file, if it has been written; nothing is written
+   // when only the in-memory states are used
+   if (writeKernels && GmatFileUtil::DoesFileExist(fileName))
    {
       #ifdef __USE_SPICE__
          #ifdef DEBUG_EPHEM_MANAGER
@@ -1478,6 +1526,33 @@ void EphemManager::GetRequiredCoverageWindow(SpiceCell* w, Real s1, Real e1,
 }
 #endif //#ifdef __USE_SPICE__
 
+//------------------------------------------------------------------------------
+// Ephemeris* GetStateRecord()
+//------------------------------------------------------------------------------
+/**
+ * Returns the in-memory copy of the states written to the managed
+ * EphemerisFile.
+ *
+ * The states are in the EphemManager's coordinate system.  Every state written
+ * since the EphemerisFile was created is kept, across the SPK files loaded by
+ * ProvideEphemerisData().
+ *
+ * @return The record, or NULL if nothing has been recorded
+ */
+//------------------------------------------------------------------------------
+Ephemeris* EphemManager::GetStateRecord()
+{
+   return stateRecord;
+}
+
+//------------------------------------------------------------------------------
+// CoordinateSystem* GetCoordinateSystem()
+//------------------------------------------------------------------------------
+CoordinateSystem* EphemManager::GetCoordinateSystem()
+{
+   return coordSys;
+}
+
 //------------------------------------------------------------------------------
 // SetObject()
 //------------------------------------------------------------------------------
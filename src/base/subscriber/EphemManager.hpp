@@ -46,6 +46,7 @@
 
 // Declare forward reference
 class EphemerisFile;
+class Ephemeris;
 
 /**
  * Manager for ephemeris recording for the specified object
@@ -71,7 +72,7 @@ public:
    virtual bool         Initialize();
 
    /// Create the EphemerisFile and set to begin recording
-   virtual bool         RecordEphemerisData();
+   virtual bool         RecordEphemerisData(bool needKernels = true);
    /// Load the created file and set up to continue (with a new EphemerisFile)
    virtual bool         ProvideEphemerisData();
    /// Stop recording - load the last ephem data - this must be called
@@ -118,6 +119,10 @@ public:
                                     Real &cvrStart,
                                     Real &cvrStop);
 
+   /// In-memory copy of the recorded states, used by the native event search
+   Ephemeris*           GetStateRecord();
+   CoordinateSystem*    GetCoordinateSystem();
+
    /// Set reference objects
    virtual void         SetObject(GmatBase *obj);
    virtual void         SetEphemType(ManagedEphemType eType);
@@ -165,6 +170,11 @@ protected:
    Real                 coverStart;
    /// stop time of the actual coverage window (coverage of loaded SPKs)
    Real                 coverStop;
+   /// States written to ephemFile, kept in memory (owned)
+   Ephemeris            *stateRecord;
+   /// Are SPK kernels written and loaded?  false when every user of the
+   /// data searches the in-memory states
+   bool                 writeKernels;
    #ifdef __USE_SPICE__
       /// need a SpiceInterface to load and unload kernels
       SpiceInterface       *spice;
@@ -74,7 +74,8 @@ EphemWriterSPK::EphemWriterSPK(const std::string &name, const std::string &type)
    EphemerisWriter       (type, name),
    spkWriter             (NULL),
    spkWriteFailed        (false),
-   numSPKSegmentsWritten (0)
+   numSPKSegmentsWritten (0),
+   lastRecordedEpoch     (-999.999)
 {
    fileType = SPK_ORBIT;
    
@@ -136,7 +137,8 @@ EphemWriterSPK::EphemWriterSPK(const EphemWriterSPK &ef) :
    EphemerisWriter       (ef),
    spkWriter             (NULL),
    spkWriteFailed        (ef.spkWriteFailed),
-   numSPKSegmentsWritten (ef.numSPKSegmentsWritten)
+   numSPKSegmentsWritten (ef.numSPKSegmentsWritten),
+   lastRecordedEpoch     (ef.lastRecordedEpoch)
 {
 }
 
@@ -158,6 +160,7 @@ EphemWriterSPK& EphemWriterSPK::operator=(const EphemWriterSPK& ef)
    spkWriter            = NULL;
    spkWriteFailed       = ef.spkWriteFailed;
    numSPKSegmentsWritten = ef.numSPKSegmentsWritten;
+   lastRecordedEpoch    = ef.lastRecordedEpoch;
    
    return *this;
 }
@@ -288,7 +291,9 @@ void EphemWriterSPK::CreateEphemerisFile(bool useDefaultFileName,
    
    EphemerisWriter::CreateEphemerisFile(useDefaultFileName, stType, outFormat, covFormat);
    
-   CreateSpiceKernelWriter();
+   // No kernel is written when the states are only kept in memory
+   if (!recordStatesOnly)
+      CreateSpiceKernelWriter();
    isEphemFileOpened = true;
    
    #ifdef DEBUG_EPHEMFILE_CREATE
@@ -496,7 +501,9 @@ void EphemWriterSPK::HandleSpkOrbitData(bool writeData, bool timeToWrite)
    {
       bool bufferData = false;
       
-      if ((a1MjdArray.empty()) ||
+      if (recordStatesOnly)
+         bufferData = (currEpochInDays > lastRecordedEpoch);
+      else if ((a1MjdArray.empty()) ||
           (!a1MjdArray.empty() && currEpochInDays > a1MjdArray.back()->GetReal()))
          bufferData = true;
       
@@ -516,7 +523,14 @@ void EphemWriterSPK::HandleSpkOrbitData(bool writeData, bool timeToWrite)
               outCov[ii] = currCov[ii];
          }
          
-         BufferOrbitData(currEpochInDays, outState, outCov);
+         if (!recordStatesOnly)
+            BufferOrbitData(currEpochInDays, outState, outCov);
+         
+         if (stateRecord)
+         {
+            stateRecord->AddPoint(currEpochInDays, outState);
+            lastRecordedEpoch = currEpochInDays;
+         }
          
          #ifdef DEBUG_EPHEMFILE_SPICE
          DebugWriteOrbit("In HandleSpkOrbitData:", currEpochInDays, currState, true, true);
@@ -568,6 +582,15 @@ void EphemWriterSPK::StartNewSegment(const std::string &comments,
       return;
    }
    
+   if (recordStatesOnly)
+   {
+      // The next state, even at the same epoch, starts a new arc in the
+      // state record
+      lastRecordedEpoch = -999.999;
+      InitializeData(saveEpochInfo);
+      return;
+   }
+   
    #ifdef DEBUG_EPHEMFILE_RESTART
    MessageInterface::ShowMessage
       ("EphemWriterSPK::StartNewSegment() Calling FinishUpWriting(), canFinalize=%d\n",
@@ -965,6 +988,10 @@ void EphemWriterSPK::WriteSpkComments(const std::string &comments)
    WriteString("\nCOMMENT  " + comments + "\n");
    #endif
    
+   // There is no kernel for the comments when only the states are recorded
+   if (recordStatesOnly)
+      return;
+   
    #ifdef __USE_SPICE__
    if (a1MjdArray.empty() && !writeCommentAfterData)
    {
@@ -58,6 +58,9 @@ protected:
    /// number of SPK segments that have been written
    Integer     numSPKSegmentsWritten;
    
+   /// epoch of the last state put in the state record when no SPK is written
+   Real        lastRecordedEpoch;
+   
    // Abstract methods required by all subclasses
    virtual void BufferOrbitData(Real epochInDays, const Real state[6], const Real cov[21]);
    
@@ -150,6 +150,8 @@ EphemerisFile::EphemerisFile(const std::string &name, const std::string &type) :
    spacecraft              (NULL),
    outCoordSystem          (NULL),
    ephemWriter             (NULL),
+   stateRecord             (NULL),
+   recordStatesOnly        (false),
    fullPathFileName        (""),
    spacecraftName          (""),
    spacecraftId            (""),
@@ -320,6 +322,8 @@ EphemerisFile::EphemerisFile(const EphemerisFile &ef) :
    spacecraft              (ef.spacecraft),
    outCoordSystem          (ef.outCoordSystem),
    ephemWriter             (NULL),
+   stateRecord             (NULL),
+   recordStatesOnly        (false),
    fullPathFileName        (ef.fullPathFileName),
    spacecraftName          (ef.spacecraftName),
    spacecraftId            (ef.spacecraftId),
@@ -393,6 +397,8 @@ EphemerisFile& EphemerisFile::operator=(const EphemerisFile& ef)
    spacecraft           = ef.spacecraft;
    outCoordSystem       = ef.outCoordSystem;
    ephemWriter          = NULL;
+   stateRecord          = NULL;
+   recordStatesOnly     = false;
    fullPathFileName     = ef.fullPathFileName;
    spacecraftName       = ef.spacecraftName;
    spacecraftId         = ef.spacecraftId;
@@ -537,6 +543,26 @@ void EphemerisFile::SetBackgroundGeneration(bool inBackground)
 }
 
 
+//------------------------------------------------------------------------------
+// void SetStateRecord(Ephemeris *record, bool recordOnly = false)
+//------------------------------------------------------------------------------
+/**
+ * Sets an in-memory ephemeris that receives every state written to the file.
+ *
+ * @param record     The ephemeris (not owned), or NULL to stop recording
+ * @param recordOnly true to fill the ephemeris without writing the file; only
+ *                   the SPK format supports this
+ */
+//------------------------------------------------------------------------------
+void EphemerisFile::SetStateRecord(Ephemeris *record, bool recordOnly)
+{
+   stateRecord = record;
+   recordStatesOnly = recordOnly;
+   if (ephemWriter)
+      ephemWriter->SetStateRecord(record, recordOnly);
+}
+
+
 //----------------------------------
 // methods inherited from Subscriber
 //----------------------------------
@@ -1872,6 +1898,7 @@ void EphemerisFile::CreateEphemerisWriter()
                                useFixedStepSize, interpolatorName, interpolationOrder);
    ephemWriter->SetInitialTime(initialEpochA1Mjd, finalEpochA1Mjd);
    ephemWriter->SetIsEphemGlobal(IsGlobal());
+   ephemWriter->SetStateRecord(stateRecord, recordStatesOnly);
    ephemWriter->Initialize();
    CreateEphemerisFile();
    
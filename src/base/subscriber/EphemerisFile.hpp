@@ -51,6 +51,8 @@ public:
                                           bool saveFileName);
    
    virtual void         SetBackgroundGeneration(bool inBackground);
+   virtual void         SetStateRecord(Ephemeris *record,
+                                       bool recordOnly = false);
    
    // Need to be able to close background SPKs and leave ready for appending
    // Finalization
@@ -120,6 +122,10 @@ protected:
    Spacecraft        *spacecraft;
    CoordinateSystem  *outCoordSystem;
    EphemerisWriter   *ephemWriter;
+   /// In-memory ephemeris passed to the writer (not owned)
+   Ephemeris         *stateRecord;
+   /// Keep the states in stateRecord without writing the file
+   bool              recordStatesOnly;
    
    /// ephemeris full file name including the path
    std::string fullPathFileName;
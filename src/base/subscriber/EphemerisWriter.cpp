@@ -139,7 +139,9 @@ EphemerisWriter::EphemerisWriter(const std::string &name, const std::string &typ
    finalEpochProcessed  (false),
    writeDataInDataCS    (true),
    writeCommentAfterData (true),
-   insufficientDataPoints (false)
+   insufficientDataPoints (false),
+   stateRecord          (NULL),
+   recordStatesOnly     (false)
 {
    #ifdef DEBUG_EPHEMFILE_INSTANCE
    MessageInterface::ShowMessage
@@ -245,7 +247,9 @@ EphemerisWriter::EphemerisWriter(const EphemerisWriter &ef) :
    finalEpochProcessed  (ef.finalEpochProcessed),
    writeDataInDataCS    (ef.writeDataInDataCS),
    writeCommentAfterData (ef.writeCommentAfterData),
-   insufficientDataPoints (ef.insufficientDataPoints)
+   insufficientDataPoints (ef.insufficientDataPoints),
+   stateRecord          (NULL),
+   recordStatesOnly     (false)
 {
    #ifdef DEBUG_EPHEMFILE_INSTANCE
    MessageInterface::ShowMessage
@@ -470,6 +474,23 @@ void EphemerisWriter::SetBackgroundGeneration(bool inBackground)
    generateInBackground = inBackground;
 }
 
+//------------------------------------------------------------------------------
+// void SetStateRecord(Ephemeris *record, bool recordOnly = false)
+//------------------------------------------------------------------------------
+/**
+ * Sets an in-memory ephemeris that receives a copy of every state written.
+ *
+ * @param record     The ephemeris, or NULL to stop recording
+ * @param recordOnly true to keep the states in the record only, without
+ *                   writing the file (used by the SPK writer)
+ */
+//------------------------------------------------------------------------------
+void EphemerisWriter::SetStateRecord(Ephemeris *record, bool recordOnly)
+{
+   stateRecord = record;
+   recordStatesOnly = (recordOnly && (record != NULL));
+}
+
 //------------------------------------------------------------------------------
 // void SetRunFlags(bool finalize, bool endOfRun, bool finalized)
 //------------------------------------------------------------------------------
@@ -1457,6 +1478,9 @@ void EphemerisWriter::WriteOrbitData(Real reqEpochInSecs, const Real state[6], c
    #endif
    BufferOrbitData(reqEpochInSecs/GmatTimeConstants::SECS_PER_DAY, outState, outCov);
    
+   if (stateRecord)
+      stateRecord->AddPoint(reqEpochInSecs/GmatTimeConstants::SECS_PER_DAY, outState);
+   
    #ifdef DEBUG_EPHEMFILE_WRITE
    MessageInterface::ShowMessage("EphemerisWriter::WriteOrbitData() leaving\n");
    #endif
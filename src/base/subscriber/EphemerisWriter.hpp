@@ -31,6 +31,7 @@
 #include "Spacecraft.hpp"
 #include "CoordinateSystem.hpp"
 #include "CoordinateConverter.hpp"
+#include "Ephemeris.hpp"
 #include <iostream>
 #include <fstream>
 
@@ -57,6 +58,7 @@ public:
    void  SetIsEphemGlobal(bool isGlobal);
    void  SetIsEphemLocal(bool isLocal);
    void  SetBackgroundGeneration(bool inBackground);
+   void  SetStateRecord(Ephemeris *record, bool recordOnly = false);
    void  SetRunFlags(bool finalize, bool endOfRun, bool isFinalized);
    void  SetOrbitData(Real epochInDays, Real state[6], Real cov[21]);
    void  SetEpochAndDirection(Real prvEpochInSecs, Real curEpochInSecs,
@@ -218,6 +220,12 @@ protected:
    /// to write to ephemeris file (It is currently used by the background SPK)
    bool        insufficientDataPoints;
    
+   /// In-memory copy of the written states (not owned; NULL if not used)
+   Ephemeris   *stateRecord;
+   /// Keep the states in stateRecord only; writers that support it do not
+   /// create the file
+   bool        recordStatesOnly;
+   
    CoordinateConverter coordConverter;
    
    /// for maneuver handling
@@ -0,0 +1,319 @@
+//$Id$
+//------------------------------------------------------------------------------
+//                               gmat_bench driver
+//------------------------------------------------------------------------------
+// GMAT: General Mission Analysis Tool
+//
+// Copyright (c) 2002 - 2020 United States Government as represented by the
+// Administrator of the National Aeronautics and Space Administration.
+// All Other Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// You may not use this file except in compliance with the License.
+// You may obtain a copy of the License at:
+// http://www.apache.org/licenses/LICENSE-2.0.
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied.   See the License for the specific language
+// governing permissions and limitations under the License.
+//
+// Author: GMAT Development Team
+// Created: 2026/10/17
+//
+/**
+ * Program entry point for gmat_bench, the GMAT performance benchmark driver.
+ *
+ * Exit status: 0 when the run completes (and nothing regressed against the
+ * baseline), 1 when benchmarks regressed, 2 on usage or run errors.
+ */
+//------------------------------------------------------------------------------
+
+#include "BenchmarkRunner.hpp"
+#include "BenchmarkReport.hpp"
+#include "BenchmarkSuites.hpp"
+#include "BaseException.hpp"
+#include "ConsoleMessageReceiver.hpp"
+#include "Moderator.hpp"
+#include "GmatGlobal.hpp"
+#include "StringUtil.hpp"
+#include <ctime>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <thread>
+
+namespace
+{
+   //---------------------------------------------------------------------------
+   // void ShowUsage()
+   //---------------------------------------------------------------------------
+   void ShowUsage()
+   {
+      std::cout
+         << "Usage: gmat_bench [options]\n"
+         << "   --list               List the benchmarks and exit\n"
+         << "   --filter <text>      Run benchmarks whose name or group "
+            "contains the text\n"
+         << "                        (repeatable)\n"
+         << "   --micro              Run only the micro benchmarks\n"
+         << "   --macro              Run only the macro (mission) benchmarks\n"
+         << "   --repetitions <n>    Timed samples per benchmark (default 10 "
+            "micro, 3 macro)\n"
+         << "   --min-time <s>       Minimum time of a micro benchmark sample "
+            "(default 0.1)\n"
+         << "   --output <file>      Write the results as JSON\n"
+         << "   --baseline <file>    Compare the medians with a JSON baseline\n"
+         << "   --threshold <pct>    Slowdown reported as a regression "
+            "(default 10)\n"
+         << "   --startup <file>     GMAT startup file (default "
+            "gmat_startup_file.txt)\n"
+         << "   --verbose            Show GMAT messages on the console\n"
+         << "   --help               Show this message\n";
+   }
+
+   //---------------------------------------------------------------------------
+   // std::map<std::string,std::string> GetRunInfo()
+   //---------------------------------------------------------------------------
+   /**
+    * Describes the build and machine, stored with the results.
+    */
+   std::map<std::string,std::string> GetRunInfo()
+   {
+      std::map<std::string,std::string> info;
+
+      char buffer[32];
+      std::time_t now = std::time(NULL);
+      std::strftime(buffer, sizeof(buffer), "%Y-%m-%dT%H:%M:%SZ",
+            std::gmtime(&now));
+      info["date"] = buffer;
+      info["gmat_version"] = GmatGlobal::Instance()->GetGmatVersion();
+
+      #if defined(__clang__)
+         info["compiler"] = std::string("clang ") + __clang_version__;
+      #elif defined(__GNUC__)
+         info["compiler"] = std::string("gcc ") + __VERSION__;
+      #elif defined(_MSC_VER)
+         info["compiler"] = "msvc " + GmatStringUtil::ToString(_MSC_VER, 1);
+      #else
+         info["compiler"] = "unknown";
+      #endif
+
+      #ifdef NDEBUG
+         info["build_type"] = "release";
+      #else
+         info["build_type"] = "debug";
+      #endif
+
+      #ifdef __AVX2__
+         info["avx2"] = "on";
+      #else
+         info["avx2"] = "off";
+      #endif
+
+      #ifdef GMAT_USE_BLAS
+         info["blas"] = "on";
+      #else
+         info["blas"] = "off";
+      #endif
+
+      info["hardware_threads"] =
+            GmatStringUtil::ToString((Integer)std::thread::hardware_concurrency(),
+            1);
+      return info;
+   }
+
+   //---------------------------------------------------------------------------
+   // bool GetValue(int argc, char *argv[], int &index, std::string &value)
+   //---------------------------------------------------------------------------
+   bool GetValue(int argc, char *argv[], int &index, std::string &value)
+   {
+      if (index + 1 >= argc)
+      {
+         std::cout << "The option " << argv[index] << " needs a value\n";
+         return false;
+      }
+      value = argv[++index];
+      return true;
+   }
+}
+
+
+//------------------------------------------------------------------------------
+// int main(int argc, char *argv[])
+//------------------------------------------------------------------------------
+/**
+ * The program entry point.
+ *
+ * @param <argc> The count of the input arguments.
+ * @param <argv> The input arguments.
+ *
+ * @return 0 on success, 1 on regressions, 2 on errors
+ */
+//------------------------------------------------------------------------------
+int main(int argc, char *argv[])
+{
+   bool        listOnly = false, runMicro = true, runMacro = true;
+   bool        verbose = false;
+   Integer     repetitions = -1;
+   Real        minTime = -1.0, threshold = 10.0;
+   std::string outputFile, baselineFile;
+   std::string startupFile = "gmat_startup_file.txt";
+   StringArray filters;
+
+   for (int i = 1; i < argc; ++i)
+   {
+      std::string arg = argv[i], value;
+
+      if (arg == "--list")
+         listOnly = true;
+      else if (arg == "--micro")
+         runMacro = false;
+      else if (arg == "--macro")
+         runMicro = false;
+      else if (arg == "--verbose")
+         verbose = true;
+      else if ((arg == "--help") || (arg == "-h"))
+      {
+         ShowUsage();
+         return 0;
+      }
+      else if ((arg == "--filter") || (arg == "--output") ||
+               (arg == "--baseline") || (arg == "--startup") ||
+               (arg == "--repetitions") || (arg == "--min-time") ||
+               (arg == "--threshold"))
+      {
+         if (!GetValue(argc, argv, i, value))
+            return 2;
+
+         bool valid = true;
+         if (arg == "--filter")
+            filters.push_back(value);
+         else if (arg == "--output")
+            outputFile = value;
+         else if (arg == "--baseline")
+            baselineFile = value;
+         else if (arg == "--startup")
+            startupFile = value;
+         else if (arg == "--repetitions")
+            valid = GmatStringUtil::ToInteger(value, repetitions) &&
+                    (repetitions > 0);
+         else if (arg == "--min-time")
+            valid = GmatStringUtil::ToReal(value, minTime) && (minTime > 0.0);
+         else
+            valid = GmatStringUtil::ToReal(value, threshold) &&
+                    (threshold >= 0.0);
+
+         if (!valid)
+         {
+            std::cout << "The value \"" << value << "\" is not valid for "
+                      << arg << "\n";
+            return 2;
+         }
+      }
+      else
+      {
+         std::cout << "Unknown option " << arg << "\n\n";
+         ShowUsage();
+         return 2;
+      }
+   }
+
+   if (!runMicro && !runMacro)
+   {
+      std::cout << "--micro and --macro cannot be combined\n";
+      return 2;
+   }
+
+   Integer status = 0;
+   try
+   {
+      // GMAT messages go to the log file so they do not break up the table
+      ConsoleMessageReceiver *theMessageReceiver =
+            ConsoleMessageReceiver::Instance();
+      theMessageReceiver->ToggleConsolePrinting(verbose);
+      MessageInterface::SetMessageReceiver(theMessageReceiver);
+
+      Moderator *mod = Moderator::Instance();
+      if ((mod == NULL) || !mod->Initialize(startupFile))
+      {
+         std::cout << "Moderator failed to initialize with the startup file "
+                   << startupFile << "\n";
+         return 2;
+      }
+      mod->CreateDefaultParameters();
+
+      BenchmarkRunner runner;
+      GmatBench::AddMathBenchmarks(runner);
+      GmatBench::AddForceModelBenchmarks(runner);
+      GmatBench::AddCoordinateBenchmarks(runner);
+      GmatBench::AddMissionBenchmarks(runner);
+
+      for (UnsignedInt i = 0; i < filters.size(); ++i)
+         runner.AddFilter(filters[i]);
+      runner.SetKinds(runMicro, runMacro);
+      if (repetitions > 0)
+         runner.SetRepetitions(repetitions, repetitions);
+      if (minTime > 0.0)
+         runner.SetMinimumSampleTime(minTime);
+
+      if (listOnly)
+      {
+         const std::vector<Benchmark*> &all = runner.GetBenchmarks();
+         for (UnsignedInt i = 0; i < all.size(); ++i)
+            if (runner.IsSelected(all[i]))
+               std::cout << all[i]->GetName() << "  [" << all[i]->GetGroup()
+                         << (all[i]->IsMacro() ? ", macro" : ", micro")
+                         << "]\n";
+      }
+      else
+      {
+         std::map<std::string,std::string> runInfo = GetRunInfo();
+         std::cout << "GMAT " << runInfo["gmat_version"] << ", "
+                   << runInfo["compiler"] << ", " << runInfo["build_type"]
+                   << ", " << runInfo["hardware_threads"]
+                   << " hardware threads\n\n";
+
+         std::vector<BenchmarkResult> results = runner.RunAll(std::cout);
+
+         for (UnsignedInt i = 0; i < results.size(); ++i)
+            if (results[i].status == "failed")
+               status = 2;
+
+         if (outputFile != "")
+         {
+            std::ofstream out(outputFile.c_str());
+            if (!out.is_open())
+            {
+               std::cout << "Unable to write the results to " << outputFile
+                         << "\n";
+               status = 2;
+            }
+            else
+            {
+               BenchmarkReport::WriteJson(out, runInfo, results);
+               std::cout << "\nResults written to " << outputFile << "\n";
+            }
+         }
+
+         if (baselineFile != "")
+         {
+            std::vector<BenchmarkResult> baseline;
+            BenchmarkReport::ReadJson(baselineFile, baseline);
+            Integer regressions = BenchmarkReport::Compare(results, baseline,
+                  threshold / 100.0, std::cout);
+            if ((regressions > 0) && (status == 0))
+               status = 1;
+         }
+      }
+   }
+   catch (BaseException &ex)
+   {
+      std::cout << ex.GetFullMessage() << "\n";
+      status = 2;
+   }
+
+   Moderator::Instance()->Finalize();
+   return status;
+}
@@ -0,0 +1,132 @@
+//$Id$
+//------------------------------------------------------------------------------
+//                                  Benchmark
+//------------------------------------------------------------------------------
+// GMAT: General Mission Analysis Tool
+//
+// Copyright (c) 2002 - 2020 United States Government as represented by the
+// Administrator of the National Aeronautics and Space Administration.
+// All Other Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// You may not use this file except in compliance with the License.
+// You may obtain a copy of the License at:
+// http://www.apache.org/licenses/LICENSE-2.0.
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied.   See the License for the specific language
+// governing permissions and limitations under the License.
+//
+// Author: GMAT Development Team
+// Created: 2026/10/17
+//
+/**
+ * Implements the Benchmark base class.
+ */
+//------------------------------------------------------------------------------
+
+#include "Benchmark.hpp"
+
+
+//------------------------------------------------------------------------------
+// Benchmark(const std::string &benchName, const std::string &benchGroup,
+//           bool macro)
+//------------------------------------------------------------------------------
+/**
+ * Constructor
+ *
+ * @param benchName  The unique benchmark name
+ * @param benchGroup The area the benchmark covers
+ * @param macro      True for benchmarks timed one Run() per sample
+ */
+//------------------------------------------------------------------------------
+Benchmark::Benchmark(const std::string &benchName,
+                     const std::string &benchGroup, bool macro) :
+   name        (benchName),
+   group       (benchGroup),
+   unit        ("call"),
+   operations  (1.0),
+   isMacro     (macro)
+{
+}
+
+
+//------------------------------------------------------------------------------
+// ~Benchmark()
+//------------------------------------------------------------------------------
+Benchmark::~Benchmark()
+{
+}
+
+
+//------------------------------------------------------------------------------
+// const std::string& GetName() const
+//------------------------------------------------------------------------------
+const std::string& Benchmark::GetName() const
+{
+   return name;
+}
+
+
+//------------------------------------------------------------------------------
+// const std::string& GetGroup() const
+//------------------------------------------------------------------------------
+const std::string& Benchmark::GetGroup() const
+{
+   return group;
+}
+
+
+//------------------------------------------------------------------------------
+// const std::string& GetUnit() const
+//------------------------------------------------------------------------------
+const std::string& Benchmark::GetUnit() const
+{
+   return unit;
+}
+
+
+//------------------------------------------------------------------------------
+// Real GetOperationCount() const
+//------------------------------------------------------------------------------
+Real Benchmark::GetOperationCount() const
+{
+   return operations;
+}
+
+
+//------------------------------------------------------------------------------
+// bool IsMacro() const
+//------------------------------------------------------------------------------
+bool Benchmark::IsMacro() const
+{
+   return isMacro;
+}
+
+
+//------------------------------------------------------------------------------
+// void Setup()
+//------------------------------------------------------------------------------
+/**
+ * Prepares the benchmark data.  Not timed.
+ *
+ * Implementations throw a BenchmarkException when the benchmark cannot run,
+ * e.g. because a data file is missing; the runner then reports it as skipped.
+ */
+//------------------------------------------------------------------------------
+void Benchmark::Setup()
+{
+}
+
+
+//------------------------------------------------------------------------------
+// void TearDown()
+//------------------------------------------------------------------------------
+/**
+ * Releases the data built by Setup().  Not timed.
+ */
+//------------------------------------------------------------------------------
+void Benchmark::TearDown()
+{
+}
@@ -0,0 +1,78 @@
+//$Id$
+//------------------------------------------------------------------------------
+//                                  Benchmark
+//------------------------------------------------------------------------------
+// GMAT: General Mission Analysis Tool
+//
+// Copyright (c) 2002 - 2020 United States Government as represented by the
+// Administrator of the National Aeronautics and Space Administration.
+// All Other Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// You may not use this file except in compliance with the License.
+// You may obtain a copy of the License at:
+// http://www.apache.org/licenses/LICENSE-2.0.
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied.   See the License for the specific language
+// governing permissions and limitations under the License.
+//
+// Author: GMAT Development Team
+// Created: 2026/10/17
+//
+/**
+ * Base class for the benchmarks run by gmat_bench.
+ */
+//------------------------------------------------------------------------------
+#ifndef Benchmark_hpp
+#define Benchmark_hpp
+
+#include "gmatdefs.hpp"
+
+/**
+ * A timed piece of work.
+ *
+ * Setup() prepares the data and is not timed.  Run() performs the timed work,
+ * which counts as GetOperationCount() operations of the named unit (calls,
+ * steps, records...), so rates are reported per operation.  TearDown()
+ * releases what Setup() built.  Micro benchmarks are short and are repeated
+ * until a timing sample is long enough; macro benchmarks (mission runs, file
+ * reads) are timed one Run() per sample.
+ */
+class Benchmark
+{
+public:
+   Benchmark(const std::string &benchName, const std::string &benchGroup,
+             bool macro = false);
+   virtual ~Benchmark();
+
+   const std::string&   GetName() const;
+   const std::string&   GetGroup() const;
+   const std::string&   GetUnit() const;
+   Real                 GetOperationCount() const;
+   bool                 IsMacro() const;
+
+   virtual void         Setup();
+   virtual void         Run() = 0;
+   virtual void         TearDown();
+
+protected:
+   /// Unique name, e.g. "ODEModel/GetDerivatives/PointMass"
+   std::string          name;
+   /// Area covered, used to select benchmarks
+   std::string          group;
+   /// Name of one operation of Run()
+   std::string          unit;
+   /// Number of operations performed by one Run() call
+   Real                 operations;
+   /// True for long running benchmarks, timed one Run() per sample
+   bool                 isMacro;
+
+private:
+   // Benchmarks are owned by the runner and are not copied
+   Benchmark(const Benchmark&);
+   Benchmark& operator=(const Benchmark&);
+};
+
+#endif // Benchmark_hpp
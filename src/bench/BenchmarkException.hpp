@@ -0,0 +1,40 @@
+//$Id$
+//------------------------------------------------------------------------------
+//                              BenchmarkException
+//------------------------------------------------------------------------------
+// GMAT: General Mission Analysis Tool
+//
+// Copyright (c) 2002 - 2020 United States Government as represented by the
+// Administrator of the National Aeronautics and Space Administration.
+// All Other Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// You may not use this file except in compliance with the License.
+// You may obtain a copy of the License at:
+// http://www.apache.org/licenses/LICENSE-2.0.
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied.   See the License for the specific language
+// governing permissions and limitations under the License.
+//
+// Author: GMAT Development Team
+// Created: 2026/10/17
+//
+/**
+ * Defines the exception used by the benchmark driver.
+ */
+//------------------------------------------------------------------------------
+#ifndef BenchmarkException_hpp
+#define BenchmarkException_hpp
+
+#include "BaseException.hpp"
+
+class BenchmarkException : public BaseException
+{
+public:
+   BenchmarkException(const std::string& details = "")
+      : BaseException("Benchmark Exception: ", details) {};
+};
+
+#endif // BenchmarkException_hpp
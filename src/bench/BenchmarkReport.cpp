@@ -0,0 +1,603 @@
+//$Id$
+//------------------------------------------------------------------------------
+//                               BenchmarkReport
+//------------------------------------------------------------------------------
+// GMAT: General Mission Analysis Tool
+//
+// Copyright (c) 2002 - 2020 United States Government as represented by the
+// Administrator of the National Aeronautics and Space Administration.
+// All Other Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// You may not use this file except in compliance with the License.
+// You may obtain a copy of the License at:
+// http://www.apache.org/licenses/LICENSE-2.0.
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied.   See the License for the specific language
+// governing permissions and limitations under the License.
+//
+// Author: GMAT Development Team
+// Created: 2026/10/17
+//
+/**
+ * Implements the JSON output of gmat_bench and the comparison with a baseline.
+ */
+//------------------------------------------------------------------------------
+
+#include "BenchmarkReport.hpp"
+#include "BenchmarkException.hpp"
+#include <cmath>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <ostream>
+#include <sstream>
+
+//---------------------------------
+// static data
+//---------------------------------
+const std::string BenchmarkReport::FORMAT_NAME = "gmat_bench";
+
+
+namespace
+{
+   /**
+    * A parsed JSON value.  Only what is needed to read results files back is
+    * supported: objects, arrays, strings, numbers, booleans and null.
+    */
+   struct JsonValue
+   {
+      enum Kind
+      {
+         NULL_VALUE,
+         BOOLEAN_VALUE,
+         NUMBER_VALUE,
+         STRING_VALUE,
+         ARRAY_VALUE,
+         OBJECT_VALUE
+      };
+
+      Kind                    kind;
+      bool                    flag;
+      Real                    number;
+      std::string             text;
+      std::vector<JsonValue>  items;
+      std::vector<std::pair<std::string, JsonValue> >
+                              members;
+
+      JsonValue() : kind(NULL_VALUE), flag(false), number(0.0) {}
+
+      const JsonValue* Find(const std::string &key) const
+      {
+         for (UnsignedInt i = 0; i < members.size(); ++i)
+            if (members[i].first == key)
+               return &members[i].second;
+         return NULL;
+      }
+   };
+
+
+   /**
+    * Recursive descent parser for JSON text.
+    */
+   class JsonParser
+   {
+   public:
+      JsonParser(const std::string &source) : src(source), pos(0) {}
+
+      JsonValue Parse()
+      {
+         JsonValue value = ParseValue();
+         SkipSpace();
+         if (pos != src.size())
+            Fail("unexpected text after the document");
+         return value;
+      }
+
+   private:
+      const std::string &src;
+      size_t            pos;
+
+      void Fail(const std::string &reason)
+      {
+         std::stringstream msg;
+         msg << "Malformed JSON at offset " << pos << ": " << reason;
+         throw BenchmarkException(msg.str());
+      }
+
+      void SkipSpace()
+      {
+         while ((pos < src.size()) && ((src[pos] == ' ') ||
+                (src[pos] == '\t') || (src[pos] == '\n') || (src[pos] == '\r')))
+            ++pos;
+      }
+
+      char Peek()
+      {
+         SkipSpace();
+         if (pos >= src.size())
+            Fail("unexpected end of text");
+         return src[pos];
+      }
+
+      void Expect(char c)
+      {
+         if (Peek() != c)
+            Fail(std::string("expected '") + c + "'");
+         ++pos;
+      }
+
+      void ExpectWord(const std::string &word)
+      {
+         if (src.compare(pos, word.size(), word) != 0)
+            Fail("unknown literal");
+         pos += word.size();
+      }
+
+      JsonValue ParseValue()
+      {
+         JsonValue value;
+         char c = Peek();
+
+         if (c == '{')
+         {
+            value.kind = JsonValue::OBJECT_VALUE;
+            ++pos;
+            if (Peek() == '}')
+            {
+               ++pos;
+               return value;
+            }
+            while (true)
+            {
+               if (Peek() != '"')
+                  Fail("expected a member name");
+               std::string key = ParseString();
+               Expect(':');
+               value.members.push_back(std::make_pair(key, ParseValue()));
+               if (Peek() == ',')
+               {
+                  ++pos;
+                  continue;
+               }
+               Expect('}');
+               break;
+            }
+         }
+         else if (c == '[')
+         {
+            value.kind = JsonValue::ARRAY_VALUE;
+            ++pos;
+            if (Peek() == ']')
+            {
+               ++pos;
+               return value;
+            }
+            while (true)
+            {
+               value.items.push_back(ParseValue());
+               if (Peek() == ',')
+               {
+                  ++pos;
+                  continue;
+               }
+               Expect(']');
+               break;
+            }
+         }
+         else if (c == '"')
+         {
+            value.kind = JsonValue::STRING_VALUE;
+            value.text = ParseString();
+         }
+         else if (c == 't')
+         {
+            ExpectWord("true");
+            value.kind = JsonValue::BOOLEAN_VALUE;
+            value.flag = true;
+         }
+         else if (c == 'f')
+         {
+            ExpectWord("false");
+            value.kind = JsonValue::BOOLEAN_VALUE;
+         }
+         else if (c == 'n')
+            ExpectWord("null");
+         else
+         {
+            const char *start = src.c_str() + pos;
+            char *end = NULL;
+            value.number = std::strtod(start, &end);
+            if (end == start)
+               Fail("expected a value");
+            value.kind = JsonValue::NUMBER_VALUE;
+            pos += end - start;
+         }
+
+         return value;
+      }
+
+      std::string ParseString()
+      {
+         std::string text;
+         ++pos;      // Opening quote
+
+         while (true)
+         {
+            if (pos >= src.size())
+               Fail("unterminated string");
+            char c = src[pos++];
+            if (c == '"')
+               break;
+            if (c != '\\')
+            {
+               text += c;
+               continue;
+            }
+
+            if (pos >= src.size())
+               Fail("unterminated string");
+            c = src[pos++];
+            switch (c)
+            {
+            case 'b':
+               text += '\b';
+               break;
+            case 'f':
+               text += '\f';
+               break;
+            case 'n':
+               text += '\n';
+               break;
+            case 'r':
+               text += '\r';
+               break;
+            case 't':
+               text += '\t';
+               break;
+            case 'u':
+               {
+                  if (pos + 4 > src.size())
+                     Fail("short unicode escape");
+                  unsigned long code = std::strtoul(
+                        src.substr(pos, 4).c_str(), NULL, 16);
+                  pos += 4;
+                  // Encode as UTF-8; names in results files are ASCII
+                  if (code < 0x80)
+                     text += (char)code;
+                  else if (code < 0x800)
+                  {
+                     text += (char)(0xC0 | (code >> 6));
+                     text += (char)(0x80 | (code & 0x3F));
+                  }
+                  else
+                  {
+                     text += (char)(0xE0 | (code >> 12));
+                     text += (char)(0x80 | ((code >> 6) & 0x3F));
+                     text += (char)(0x80 | (code & 0x3F));
+                  }
+               }
+               break;
+            default:
+               // \" \\ and \/
+               text += c;
+               break;
+            }
+         }
+
+         return text;
+      }
+   };
+
+
+   //---------------------------------------------------------------------------
+   // void WriteNumber(std::ostream &out, Real value)
+   //---------------------------------------------------------------------------
+   /**
+    * Writes a number; values JSON cannot represent are written as null.
+    */
+   //---------------------------------------------------------------------------
+   void WriteNumber(std::ostream &out, Real value)
+   {
+      if (std::isfinite(value))
+         out << std::setprecision(10) << value;
+      else
+         out << "null";
+   }
+
+
+   //---------------------------------------------------------------------------
+   // Real GetNumber(const JsonValue &obj, const std::string &key, Real def)
+   //---------------------------------------------------------------------------
+   Real GetNumber(const JsonValue &obj, const std::string &key, Real def)
+   {
+      const JsonValue *value = obj.Find(key);
+      if ((value == NULL) || (value->kind != JsonValue::NUMBER_VALUE))
+         return def;
+      return value->number;
+   }
+
+
+   //---------------------------------------------------------------------------
+   // std::string GetText(const JsonValue &obj, const std::string &key,
+   //       const std::string &def)
+   //---------------------------------------------------------------------------
+   std::string GetText(const JsonValue &obj, const std::string &key,
+         const std::string &def)
+   {
+      const JsonValue *value = obj.Find(key);
+      if ((value == NULL) || (value->kind != JsonValue::STRING_VALUE))
+         return def;
+      return value->text;
+   }
+}
+
+
+//------------------------------------------------------------------------------
+// void WriteJson(std::ostream &out,
+//       const std::map<std::string, std::string> &runInfo,
+//       const std::vector<BenchmarkResult> &results)
+//------------------------------------------------------------------------------
+/**
+ * Writes a results file.
+ *
+ * @param out     The output stream
+ * @param runInfo Description of the build and host, written in "run"
+ * @param results The benchmark results
+ */
+//------------------------------------------------------------------------------
+void BenchmarkReport::WriteJson(std::ostream &out,
+      const std::map<std::string, std::string> &runInfo,
+      const std::vector<BenchmarkResult> &results)
+{
+   out << "{\n";
+   out << "  \"format\": " << Quote(FORMAT_NAME) << ",\n";
+   out << "  \"version\": " << FORMAT_VERSION << ",\n";
+
+   out << "  \"run\": {";
+   for (std::map<std::string, std::string>::const_iterator i =
+         runInfo.begin(); i != runInfo.end(); ++i)
+   {
+      out << (i == runInfo.begin() ? "\n" : ",\n");
+      out << "    " << Quote(i->first) << ": " << Quote(i->second);
+   }
+   out << "\n  },\n";
+
+   out << "  \"benchmarks\": [";
+   for (UnsignedInt i = 0; i < results.size(); ++i)
+   {
+      const BenchmarkResult &r = results[i];
+      out << (i == 0 ? "\n" : ",\n");
+      out << "    {\n";
+      out << "      \"name\": " << Quote(r.name) << ",\n";
+      out << "      \"group\": " << Quote(r.group) << ",\n";
+      out << "      \"kind\": " << Quote(r.isMacro ? "macro" : "micro")
+          << ",\n";
+      out << "      \"status\": " << Quote(r.status) << ",\n";
+      if (r.message != "")
+         out << "      \"message\": " << Quote(r.message) << ",\n";
+      out << "      \"unit\": " << Quote(r.unit) << ",\n";
+      out << "      \"operations\": ";
+      WriteNumber(out, r.operations);
+      out << ",\n      \"runs_per_sample\": " << r.runsPerSample;
+
+      if (r.status == "ok")
+      {
+         out << ",\n      \"median_ns\": ";
+         WriteNumber(out, r.median * 1.0e9);
+         out << ",\n      \"min_ns\": ";
+         WriteNumber(out, r.minimum * 1.0e9);
+         out << ",\n      \"mean_ns\": ";
+         WriteNumber(out, r.mean * 1.0e9);
+         out << ",\n      \"stddev_ns\": ";
+         WriteNumber(out, r.stdDev * 1.0e9);
+         out << ",\n      \"ops_per_second\": ";
+         WriteNumber(out, (r.median > 0.0 ? 1.0 / r.median : 0.0));
+         out << ",\n      \"samples_ns\": [";
+         for (UnsignedInt j = 0; j < r.samples.size(); ++j)
+         {
+            if (j > 0)
+               out << ", ";
+            WriteNumber(out, r.samples[j] * 1.0e9);
+         }
+         out << "]";
+      }
+      out << "\n    }";
+   }
+   out << "\n  ]\n}\n";
+}
+
+
+//------------------------------------------------------------------------------
+// void ReadJson(const std::string &fileName,
+//       std::vector<BenchmarkResult> &results)
+//------------------------------------------------------------------------------
+/**
+ * Reads a results file written by WriteJson().
+ *
+ * @param fileName The file
+ * @param results  Receives the benchmark results
+ */
+//------------------------------------------------------------------------------
+void BenchmarkReport::ReadJson(const std::string &fileName,
+      std::vector<BenchmarkResult> &results)
+{
+   std::ifstream in(fileName.c_str());
+   if (!in)
+      throw BenchmarkException("Unable to open the results file " + fileName);
+
+   std::stringstream contents;
+   contents << in.rdbuf();
+   std::string text = contents.str();
+
+   JsonParser parser(text);
+   JsonValue root = parser.Parse();
+
+   if ((root.kind != JsonValue::OBJECT_VALUE) ||
+       (GetText(root, "format", "") != FORMAT_NAME))
+      throw BenchmarkException(fileName + " is not a gmat_bench results file");
+
+   const JsonValue *list = root.Find("benchmarks");
+   if ((list == NULL) || (list->kind != JsonValue::ARRAY_VALUE))
+      throw BenchmarkException(fileName + " has no benchmarks array");
+
+   results.clear();
+   for (UnsignedInt i = 0; i < list->items.size(); ++i)
+   {
+      const JsonValue &entry = list->items[i];
+      if (entry.kind != JsonValue::OBJECT_VALUE)
+         continue;
+
+      BenchmarkResult r;
+      r.name = GetText(entry, "name", "");
+      if (r.name == "")
+         continue;
+      r.group         = GetText(entry, "group", "");
+      r.unit          = GetText(entry, "unit", "call");
+      r.status        = GetText(entry, "status", "ok");
+      r.message       = GetText(entry, "message", "");
+      r.isMacro       = (GetText(entry, "kind", "micro") == "macro");
+      r.operations    = GetNumber(entry, "operations", 1.0);
+      r.runsPerSample = (Integer)GetNumber(entry, "runs_per_sample", 0.0);
+
+      const JsonValue *samples = entry.Find("samples_ns");
+      if ((samples != NULL) && (samples->kind == JsonValue::ARRAY_VALUE))
+         for (UnsignedInt j = 0; j < samples->items.size(); ++j)
+            if (samples->items[j].kind == JsonValue::NUMBER_VALUE)
+               r.samples.push_back(samples->items[j].number * 1.0e-9);
+      r.ComputeStatistics();
+
+      // The stored median is used if present, so hand edited baselines work
+      r.median = GetNumber(entry, "median_ns", r.median * 1.0e9) * 1.0e-9;
+      r.minimum = GetNumber(entry, "min_ns", r.minimum * 1.0e9) * 1.0e-9;
+
+      results.push_back(r);
+   }
+}
+
+
+//------------------------------------------------------------------------------
+// Integer Compare(const std::vector<BenchmarkResult> &current,
+//       const std::vector<BenchmarkResult> &baseline, Real threshold,
+//       std::ostream &out)
+//------------------------------------------------------------------------------
+/**
+ * Compares results with a baseline and writes a table of the changes.
+ *
+ * A benchmark regresses when its median time per operation exceeds the
+ * baseline median by more than the threshold.  Benchmarks missing from either
+ * set, or not run successfully, are listed but do not count.
+ *
+ * @param current   The results of this run
+ * @param baseline  The stored results
+ * @param threshold Allowed relative slowdown, e.g. 0.1 for 10%
+ * @param out       Stream receiving the table
+ *
+ * @return The number of regressions
+ */
+//------------------------------------------------------------------------------
+Integer BenchmarkReport::Compare(const std::vector<BenchmarkResult> &current,
+      const std::vector<BenchmarkResult> &baseline, Real threshold,
+      std::ostream &out)
+{
+   Integer regressions = 0, improvements = 0, unchanged = 0;
+
+   std::stringstream limit;
+   limit << std::fixed << std::setprecision(1) << threshold * 100.0;
+   out << "\nComparison with the baseline (threshold " << limit.str()
+       << "%)\n";
+   out << std::left << std::setw(56) << "Benchmark" << std::right
+       << std::setw(14) << "Baseline" << std::setw(14) << "Current"
+       << std::setw(10) << "Change" << "\n";
+
+   for (UnsignedInt i = 0; i < current.size(); ++i)
+   {
+      const BenchmarkResult &now = current[i];
+      const BenchmarkResult *then = NULL;
+      for (UnsignedInt j = 0; j < baseline.size(); ++j)
+      {
+         if (baseline[j].name == now.name)
+         {
+            then = &baseline[j];
+            break;
+         }
+      }
+
+      out << std::left << std::setw(56) << now.name << std::right;
+
+      if (now.status != "ok")
+      {
+         out << std::setw(14) << "" << std::setw(14) << now.status << "\n";
+         continue;
+      }
+      if ((then == NULL) || (then->status != "ok") || (then->median <= 0.0))
+      {
+         out << std::setw(14) << "-" << std::setw(14)
+             << BenchmarkRunner::FormatTime(now.median) << "     new\n";
+         continue;
+      }
+
+      Real change = now.median / then->median - 1.0;
+      std::stringstream percent;
+      percent << std::showpos << std::fixed << std::setprecision(1)
+              << change * 100.0 << "%";
+
+      out << std::setw(14) << BenchmarkRunner::FormatTime(then->median)
+          << std::setw(14) << BenchmarkRunner::FormatTime(now.median)
+          << std::setw(10) << percent.str();
+
+      if (change > threshold)
+      {
+         out << "  REGRESSION";
+         ++regressions;
+      }
+      else if (change < -threshold)
+      {
+         out << "  faster";
+         ++improvements;
+      }
+      else
+         ++unchanged;
+      out << "\n";
+   }
+
+   out << regressions << " regression(s), " << improvements
+       << " improvement(s), " << unchanged << " within the threshold\n";
+
+   return regressions;
+}
+
+
+//------------------------------------------------------------------------------
+// std::string Quote(const std::string &text)
+//------------------------------------------------------------------------------
+/**
+ * Returns the text as a JSON string literal.
+ */
+//------------------------------------------------------------------------------
+std::string BenchmarkReport::Quote(const std::string &text)
+{
+   std::stringstream quoted;
+   quoted << '"';
+   for (UnsignedInt i = 0; i < text.size(); ++i)
+   {
+      unsigned char c = text[i];
+      if (c == '"')
+         quoted << "\\\"";
+      else if (c == '\\')
+         quoted << "\\\\";
+      else if (c == '\n')
+         quoted << "\\n";
+      else if (c == '\t')
+         quoted << "\\t";
+      else if (c < 0x20)
+         quoted << "\\u" << std::hex << std::setw(4) << std::setfill('0')
+                << (int)c << std::dec << std::setfill(' ');
+      else
+         quoted << c;
+   }
+   quoted << '"';
+   return quoted.str();
+}
@@ -0,0 +1,74 @@
+//$Id$
+//------------------------------------------------------------------------------
+//                               BenchmarkReport
+//------------------------------------------------------------------------------
+// GMAT: General Mission Analysis Tool
+//
+// Copyright (c) 2002 - 2020 United States Government as represented by the
+// Administrator of the National Aeronautics and Space Administration.
+// All Other Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// You may not use this file except in compliance with the License.
+// You may obtain a copy of the License at:
+// http://www.apache.org/licenses/LICENSE-2.0.
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied.   See the License for the specific language
+// governing permissions and limitations under the License.
+//
+// Author: GMAT Development Team
+// Created: 2026/10/17
+//
+/**
+ * Declares the JSON output of gmat_bench and the comparison with a baseline.
+ */
+//------------------------------------------------------------------------------
+#ifndef BenchmarkReport_hpp
+#define BenchmarkReport_hpp
+
+#include "gmatdefs.hpp"
+#include "BenchmarkRunner.hpp"
+#include <iosfwd>
+#include <map>
+#include <vector>
+
+/**
+ * Writes and reads benchmark results as JSON, and compares two result sets.
+ *
+ * The file holds a "run" object describing the build and host, and a
+ * "benchmarks" array with one object per benchmark:
+ *
+ *    { "name": ..., "group": ..., "kind": "micro" | "macro",
+ *      "status": "ok" | "skipped" | "failed", "unit": ...,
+ *      "operations": ..., "runs_per_sample": ...,
+ *      "median_ns": ..., "min_ns": ..., "mean_ns": ..., "stddev_ns": ...,
+ *      "ops_per_second": ..., "samples_ns": [ ... ] }
+ *
+ * Times are nanoseconds per operation.  A results file can be used as the
+ * baseline of a later run; benchmarks are matched by name and compared by
+ * their median times.
+ */
+class BenchmarkReport
+{
+public:
+   static void    WriteJson(std::ostream &out,
+                            const std::map<std::string, std::string> &runInfo,
+                            const std::vector<BenchmarkResult> &results);
+   static void    ReadJson(const std::string &fileName,
+                           std::vector<BenchmarkResult> &results);
+   static Integer Compare(const std::vector<BenchmarkResult> &current,
+                          const std::vector<BenchmarkResult> &baseline,
+                          Real threshold, std::ostream &out);
+
+   /// Format identifier written in the "format" field
+   static const std::string FORMAT_NAME;
+   /// Version of the file layout
+   static const Integer     FORMAT_VERSION = 1;
+
+private:
+   static std::string Quote(const std::string &text);
+};
+
+#endif // BenchmarkReport_hpp
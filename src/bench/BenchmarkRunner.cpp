@@ -0,0 +1,406 @@
+//$Id$
+//------------------------------------------------------------------------------
+//                               BenchmarkRunner
+//------------------------------------------------------------------------------
+// GMAT: General Mission Analysis Tool
+//
+// Copyright (c) 2002 - 2020 United States Government as represented by the
+// Administrator of the National Aeronautics and Space Administration.
+// All Other Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// You may not use this file except in compliance with the License.
+// You may obtain a copy of the License at:
+// http://www.apache.org/licenses/LICENSE-2.0.
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied.   See the License for the specific language
+// governing permissions and limitations under the License.
+//
+// Author: GMAT Development Team
+// Created: 2026/10/17
+//
+/**
+ * Implements the class that times the registered benchmarks.
+ */
+//------------------------------------------------------------------------------
+
+#include "BenchmarkRunner.hpp"
+#include "BaseException.hpp"
+#include "MessageInterface.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <iomanip>
+#include <ostream>
+#include <sstream>
+
+//#define DEBUG_CALIBRATION
+
+namespace
+{
+   /// Upper limit on the Run() calls in one micro benchmark sample
+   const Integer MAX_RUNS_PER_SAMPLE = 100000000;
+}
+
+
+//------------------------------------------------------------------------------
+// BenchmarkResult()
+//------------------------------------------------------------------------------
+BenchmarkResult::BenchmarkResult() :
+   status         ("ok"),
+   isMacro        (false),
+   operations     (1.0),
+   runsPerSample  (0),
+   median         (0.0),
+   minimum        (0.0),
+   mean           (0.0),
+   stdDev         (0.0)
+{
+}
+
+
+//------------------------------------------------------------------------------
+// void ComputeStatistics()
+//------------------------------------------------------------------------------
+/**
+ * Sets the median, minimum, mean and sample standard deviation of the samples.
+ */
+//------------------------------------------------------------------------------
+void BenchmarkResult::ComputeStatistics()
+{
+   median = minimum = mean = stdDev = 0.0;
+   if (samples.empty())
+      return;
+
+   RealArray sorted = samples;
+   std::sort(sorted.begin(), sorted.end());
+   UnsignedInt count = sorted.size();
+
+   minimum = sorted[0];
+   median = ((count % 2) == 1 ? sorted[count / 2] :
+         0.5 * (sorted[count / 2 - 1] + sorted[count / 2]));
+
+   for (UnsignedInt i = 0; i < count; ++i)
+      mean += sorted[i];
+   mean /= count;
+
+   if (count > 1)
+   {
+      for (UnsignedInt i = 0; i < count; ++i)
+         stdDev += (sorted[i] - mean) * (sorted[i] - mean);
+      stdDev = std::sqrt(stdDev / (count - 1));
+   }
+}
+
+
+//------------------------------------------------------------------------------
+// BenchmarkRunner()
+//------------------------------------------------------------------------------
+BenchmarkRunner::BenchmarkRunner() :
+   includeMicro      (true),
+   includeMacro      (true),
+   microRepetitions  (DEFAULT_MICRO_REPETITIONS),
+   macroRepetitions  (DEFAULT_MACRO_REPETITIONS),
+   minimumSampleTime (0.1)
+{
+}
+
+
+//------------------------------------------------------------------------------
+// ~BenchmarkRunner()
+//------------------------------------------------------------------------------
+BenchmarkRunner::~BenchmarkRunner()
+{
+   for (UnsignedInt i = 0; i < benchmarks.size(); ++i)
+      delete benchmarks[i];
+}
+
+
+//------------------------------------------------------------------------------
+// void Add(Benchmark *bench)
+//------------------------------------------------------------------------------
+/**
+ * Registers a benchmark.  The runner takes ownership of it.
+ *
+ * @param bench The benchmark
+ */
+//------------------------------------------------------------------------------
+void BenchmarkRunner::Add(Benchmark *bench)
+{
+   if (bench != NULL)
+      benchmarks.push_back(bench);
+}
+
+
+//------------------------------------------------------------------------------
+// const std::vector<Benchmark*>& GetBenchmarks() const
+//------------------------------------------------------------------------------
+const std::vector<Benchmark*>& BenchmarkRunner::GetBenchmarks() const
+{
+   return benchmarks;
+}
+
+
+//------------------------------------------------------------------------------
+// void AddFilter(const std::string &text)
+//------------------------------------------------------------------------------
+/**
+ * Restricts the run to benchmarks whose name or group contains the text.
+ * Several filters select the benchmarks matching any of them.
+ *
+ * @param text The name fragment
+ */
+//------------------------------------------------------------------------------
+void BenchmarkRunner::AddFilter(const std::string &text)
+{
+   filters.push_back(text);
+}
+
+
+//------------------------------------------------------------------------------
+// void SetKinds(bool runMicro, bool runMacro)
+//------------------------------------------------------------------------------
+void BenchmarkRunner::SetKinds(bool runMicro, bool runMacro)
+{
+   includeMicro = runMicro;
+   includeMacro = runMacro;
+}
+
+
+//------------------------------------------------------------------------------
+// void SetRepetitions(Integer forMicro, Integer forMacro)
+//------------------------------------------------------------------------------
+/**
+ * Sets the number of timing samples taken for each kind of benchmark.
+ *
+ * @param forMicro Samples for micro benchmarks
+ * @param forMacro Samples for macro benchmarks
+ */
+//------------------------------------------------------------------------------
+void BenchmarkRunner::SetRepetitions(Integer forMicro, Integer forMacro)
+{
+   microRepetitions = (forMicro < 1 ? 1 : forMicro);
+   macroRepetitions = (forMacro < 1 ? 1 : forMacro);
+}
+
+
+//------------------------------------------------------------------------------
+// void SetMinimumSampleTime(Real seconds)
+//------------------------------------------------------------------------------
+void BenchmarkRunner::SetMinimumSampleTime(Real seconds)
+{
+   minimumSampleTime = (seconds < 0.0 ? 0.0 : seconds);
+}
+
+
+//------------------------------------------------------------------------------
+// bool IsSelected(const Benchmark *bench) const
+//------------------------------------------------------------------------------
+bool BenchmarkRunner::IsSelected(const Benchmark *bench) const
+{
+   if (bench->IsMacro() ? !includeMacro : !includeMicro)
+      return false;
+
+   if (filters.empty())
+      return true;
+
+   for (UnsignedInt i = 0; i < filters.size(); ++i)
+   {
+      if ((bench->GetName().find(filters[i]) != std::string::npos) ||
+          (bench->GetGroup().find(filters[i]) != std::string::npos))
+         return true;
+   }
+   return false;
+}
+
+
+//------------------------------------------------------------------------------
+// const std::vector<BenchmarkResult>& RunAll(std::ostream &progress)
+//------------------------------------------------------------------------------
+/**
+ * Measures the selected benchmarks in registration order.
+ *
+ * @param progress Stream receiving one line per benchmark
+ *
+ * @return The results
+ */
+//------------------------------------------------------------------------------
+const std::vector<BenchmarkResult>& BenchmarkRunner::RunAll(
+      std::ostream &progress)
+{
+   results.clear();
+
+   for (UnsignedInt i = 0; i < benchmarks.size(); ++i)
+   {
+      if (!IsSelected(benchmarks[i]))
+         continue;
+
+      progress << std::left << std::setw(56) << benchmarks[i]->GetName()
+               << std::flush;
+
+      BenchmarkResult result = Measure(benchmarks[i]);
+      results.push_back(result);
+
+      if (result.status == "ok")
+      {
+         std::stringstream spread;
+         spread << std::fixed << std::setprecision(1)
+                << (result.median > 0.0 ?
+                    100.0 * result.stdDev / result.median : 0.0);
+         progress << std::right << std::setw(12) << FormatTime(result.median)
+                  << " / " << std::left << std::setw(8) << result.unit
+                  << " +/- " << spread.str() << "%" << std::endl;
+      }
+      else
+         progress << result.status << ": " << result.message << std::endl;
+   }
+
+   return results;
+}
+
+
+//------------------------------------------------------------------------------
+// BenchmarkResult Measure(Benchmark *bench)
+//------------------------------------------------------------------------------
+/**
+ * Sets up, times and tears down one benchmark.
+ *
+ * @param bench The benchmark
+ *
+ * @return The timing, or a skipped or failed status with its reason
+ */
+//------------------------------------------------------------------------------
+BenchmarkResult BenchmarkRunner::Measure(Benchmark *bench)
+{
+   BenchmarkResult result;
+   result.name    = bench->GetName();
+   result.group   = bench->GetGroup();
+   result.unit    = bench->GetUnit();
+   result.isMacro = bench->IsMacro();
+
+   try
+   {
+      bench->Setup();
+   }
+   catch (BaseException &ex)
+   {
+      result.status  = "skipped";
+      result.message = ex.GetFullMessage();
+      try
+      {
+         bench->TearDown();
+      }
+      catch (BaseException &)
+      {
+      }
+      return result;
+   }
+
+   // Setup() may size the work, so the count is read afterwards
+   result.operations = bench->GetOperationCount();
+   if (result.operations <= 0.0)
+      result.operations = 1.0;
+
+   try
+   {
+      Integer runs = 1;
+      Real elapsed = TimeRuns(bench, runs);
+
+      if (!bench->IsMacro())
+      {
+         // Grow the sample until it lasts the minimum time
+         while ((elapsed < minimumSampleTime) && (runs < MAX_RUNS_PER_SAMPLE))
+         {
+            Integer factor = 10;
+            if (elapsed > 0.0)
+               factor = (Integer)std::ceil(1.2 * minimumSampleTime / elapsed);
+            factor = std::max(2, std::min(factor, 10));
+            runs = std::min(runs * factor, MAX_RUNS_PER_SAMPLE);
+            elapsed = TimeRuns(bench, runs);
+
+            #ifdef DEBUG_CALIBRATION
+               MessageInterface::ShowMessage("   %s: %d runs in %le s\n",
+                     bench->GetName().c_str(), runs, elapsed);
+            #endif
+         }
+      }
+
+      Integer repetitions = (bench->IsMacro() ? macroRepetitions :
+            microRepetitions);
+      result.runsPerSample = runs;
+      for (Integer i = 0; i < repetitions; ++i)
+         result.samples.push_back(TimeRuns(bench, runs) /
+               (runs * result.operations));
+   }
+   catch (BaseException &ex)
+   {
+      result.status  = "failed";
+      result.message = ex.GetFullMessage();
+      result.samples.clear();
+   }
+
+   try
+   {
+      bench->TearDown();
+   }
+   catch (BaseException &ex)
+   {
+      if (result.status == "ok")
+      {
+         result.status  = "failed";
+         result.message = ex.GetFullMessage();
+         result.samples.clear();
+      }
+   }
+
+   result.ComputeStatistics();
+   return result;
+}
+
+
+//------------------------------------------------------------------------------
+// std::string FormatTime(Real seconds)
+//------------------------------------------------------------------------------
+/**
+ * Formats a duration with a unit suited to its size, e.g. "12.3 us".
+ */
+//------------------------------------------------------------------------------
+std::string BenchmarkRunner::FormatTime(Real seconds)
+{
+   std::stringstream text;
+   text << std::fixed << std::setprecision(3);
+
+   if (seconds < 1.0e-6)
+      text << seconds * 1.0e9 << " ns";
+   else if (seconds < 1.0e-3)
+      text << seconds * 1.0e6 << " us";
+   else if (seconds < 1.0)
+      text << seconds * 1.0e3 << " ms";
+   else
+      text << seconds << " s";
+
+   return text.str();
+}
+
+
+//------------------------------------------------------------------------------
+// Real TimeRuns(Benchmark *bench, Integer runs)
+//------------------------------------------------------------------------------
+/**
+ * Times a number of consecutive Run() calls.
+ *
+ * @return The elapsed wall clock time, in seconds
+ */
+//------------------------------------------------------------------------------
+Real BenchmarkRunner::TimeRuns(Benchmark *bench, Integer runs)
+{
+   std::chrono::steady_clock::time_point start =
+         std::chrono::steady_clock::now();
+   for (Integer i = 0; i < runs; ++i)
+      bench->Run();
+   std::chrono::duration<double> elapsed =
+         std::chrono::steady_clock::now() - start;
+   return elapsed.count();
+}
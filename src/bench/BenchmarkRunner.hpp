@@ -0,0 +1,121 @@
+//$Id$
+//------------------------------------------------------------------------------
+//                               BenchmarkRunner
+//------------------------------------------------------------------------------
+// GMAT: General Mission Analysis Tool
+//
+// Copyright (c) 2002 - 2020 United States Government as represented by the
+// Administrator of the National Aeronautics and Space Administration.
+// All Other Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// You may not use this file except in compliance with the License.
+// You may obtain a copy of the License at:
+// http://www.apache.org/licenses/LICENSE-2.0.
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied.   See the License for the specific language
+// governing permissions and limitations under the License.
+//
+// Author: GMAT Development Team
+// Created: 2026/10/17
+//
+/**
+ * Declares the class that times the registered benchmarks.
+ */
+//------------------------------------------------------------------------------
+#ifndef BenchmarkRunner_hpp
+#define BenchmarkRunner_hpp
+
+#include "gmatdefs.hpp"
+#include "Benchmark.hpp"
+#include <iosfwd>
+#include <vector>
+
+/**
+ * Timing of one benchmark.  Times are seconds per operation.
+ */
+struct BenchmarkResult
+{
+   std::string name;
+   std::string group;
+   std::string unit;
+   /// "ok", "skipped" (Setup() failed) or "failed" (Run() failed)
+   std::string status;
+   /// Reason for a skipped or failed benchmark
+   std::string message;
+   bool        isMacro;
+   /// Operations per Run() call
+   Real        operations;
+   /// Run() calls per timing sample
+   Integer     runsPerSample;
+   /// Time per operation of each sample
+   RealArray   samples;
+   Real        median;
+   Real        minimum;
+   Real        mean;
+   Real        stdDev;
+
+   BenchmarkResult();
+   void        ComputeStatistics();
+};
+
+
+/**
+ * Runs the benchmarks and collects their timings.
+ *
+ * Each selected benchmark is set up, run once untimed to warm caches and load
+ * data, and then timed for a number of samples.  For micro benchmarks the
+ * number of Run() calls per sample is calibrated so a sample lasts at least
+ * the minimum sample time.  Exceptions thrown by Setup() mark a benchmark as
+ * skipped, and those thrown by Run() mark it as failed; the other benchmarks
+ * still run.
+ */
+class BenchmarkRunner
+{
+public:
+   BenchmarkRunner();
+   ~BenchmarkRunner();
+
+   void        Add(Benchmark *bench);
+   const std::vector<Benchmark*>&
+               GetBenchmarks() const;
+
+   void        AddFilter(const std::string &text);
+   void        SetKinds(bool runMicro, bool runMacro);
+   void        SetRepetitions(Integer forMicro, Integer forMacro);
+   void        SetMinimumSampleTime(Real seconds);
+   bool        IsSelected(const Benchmark *bench) const;
+
+   const std::vector<BenchmarkResult>&
+               RunAll(std::ostream &progress);
+   BenchmarkResult
+               Measure(Benchmark *bench);
+
+   static std::string
+               FormatTime(Real seconds);
+
+   /// Default number of samples for micro benchmarks
+   static const Integer DEFAULT_MICRO_REPETITIONS = 10;
+   /// Default number of samples for macro benchmarks
+   static const Integer DEFAULT_MACRO_REPETITIONS = 3;
+
+private:
+   /// The benchmarks, owned by the runner
+   std::vector<Benchmark*>       benchmarks;
+   /// Results of the last RunAll()
+   std::vector<BenchmarkResult>  results;
+   /// Name fragments selecting benchmarks; empty selects all
+   StringArray                   filters;
+   bool                          includeMicro;
+   bool                          includeMacro;
+   Integer                       microRepetitions;
+   Integer                       macroRepetitions;
+   /// Shortest micro benchmark sample, in seconds
+   Real                          minimumSampleTime;
+
+   Real        TimeRuns(Benchmark *bench, Integer runs);
+};
+
+#endif // BenchmarkRunner_hpp
@@ -0,0 +1,49 @@
+//$Id$
+//------------------------------------------------------------------------------
+//                               BenchmarkSuites
+//------------------------------------------------------------------------------
+// GMAT: General Mission Analysis Tool
+//
+// Copyright (c) 2002 - 2020 United States Government as represented by the
+// Administrator of the National Aeronautics and Space Administration.
+// All Other Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// You may not use this file except in compliance with the License.
+// You may obtain a copy of the License at:
+// http://www.apache.org/licenses/LICENSE-2.0.
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied.   See the License for the specific language
+// governing permissions and limitations under the License.
+//
+// Author: GMAT Development Team
+// Created: 2026/10/17
+//
+/**
+ * Declares the functions registering the gmat_bench benchmarks.
+ *
+ * Each suite lives in its own file.  The math suite needs only the utility
+ * library; the others use objects configured through the Moderator, which must
+ * be initialized before they run.
+ */
+//------------------------------------------------------------------------------
+#ifndef BenchmarkSuites_hpp
+#define BenchmarkSuites_hpp
+
+class BenchmarkRunner;
+
+namespace GmatBench
+{
+   // Matrices, factorizations, state conversions and ephemeris lookup
+   void AddMathBenchmarks(BenchmarkRunner &runner);
+   // ODEModel derivatives, integrators and parallel propagation
+   void AddForceModelBenchmarks(BenchmarkRunner &runner);
+   // Coordinate conversions, frame rotations and DE file reads
+   void AddCoordinateBenchmarks(BenchmarkRunner &runner);
+   // Script parsing, mission output, event location and estimation
+   void AddMissionBenchmarks(BenchmarkRunner &runner);
+}
+
+#endif // BenchmarkSuites_hpp
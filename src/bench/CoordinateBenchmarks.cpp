@@ -0,0 +1,328 @@
+//$Id$
+//------------------------------------------------------------------------------
+//                             CoordinateBenchmarks
+//------------------------------------------------------------------------------
+// GMAT: General Mission Analysis Tool
+//
+// Copyright (c) 2002 - 2020 United States Government as represented by the
+// Administrator of the National Aeronautics and Space Administration.
+// All Other Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// You may not use this file except in compliance with the License.
+// You may obtain a copy of the License at:
+// http://www.apache.org/licenses/LICENSE-2.0.
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied.   See the License for the specific language
+// governing permissions and limitations under the License.
+//
+// Author: GMAT Development Team
+// Created: 2026/10/17
+//
+/**
+ * Benchmarks of coordinate conversions, the shared rotation cache and the DE
+ * file reader.
+ */
+//------------------------------------------------------------------------------
+
+#include "BenchmarkSuites.hpp"
+#include "BenchmarkRunner.hpp"
+#include "BenchmarkException.hpp"
+#include "ScriptBenchmark.hpp"
+#include "Moderator.hpp"
+#include "CoordinateSystem.hpp"
+#include "CoordinateConverter.hpp"
+#include "RotationMatrixCache.hpp"
+#include "SolarSystem.hpp"
+#include "DeFile.hpp"
+#include <cmath>
+
+namespace
+{
+   /// Start of the converted spans, A1 modified Julian date
+   const Real START_EPOCH = 28855.0;
+
+   /// Coordinate systems used by the benchmarks, and a short mission that
+   /// makes the sandbox initialize them
+   const std::string SCRIPT =
+      "Create Spacecraft Sat;\n"
+      "Create CoordinateSystem EarthTOD;\n"
+      "EarthTOD.Origin = Earth;\n"
+      "EarthTOD.Axes = TODEq;\n"
+      "Create CoordinateSystem EarthMOD;\n"
+      "EarthMOD.Origin = Earth;\n"
+      "EarthMOD.Axes = MODEq;\n"
+      "Create CoordinateSystem LunaFixed;\n"
+      "LunaFixed.Origin = Luna;\n"
+      "LunaFixed.Axes = BodyFixed;\n"
+      "Create CoordinateSystem StationFixed;\n"
+      "StationFixed.Origin = Earth;\n"
+      "StationFixed.Axes = BodyFixed;\n"
+      "Create Propagator Prop;\n"
+      "BeginMissionSequence;\n"
+      "Propagate Prop(Sat) {Sat.ElapsedSecs = 60};\n";
+
+   /// Initializes the sandbox and returns one of its coordinate systems
+   CoordinateSystem* GetCoordinateSystem(const std::string &name)
+   {
+      CoordinateSystem *cs = (CoordinateSystem*)
+            Moderator::Instance()->GetInternalObject(name);
+      if (cs == NULL)
+         throw BenchmarkException("The coordinate system " + name +
+               " is not in the sandbox");
+      return cs;
+   }
+
+   /// Low Earth orbit states, one minute apart
+   void MakeStates(Integer count, RealArray &epochs, RealArray &states)
+   {
+      epochs.resize(count);
+      states.resize(6 * count);
+      const Real radius = 6878.0, rate = 0.0011;
+      for (Integer i = 0; i < count; ++i)
+      {
+         Real angle = rate * 60.0 * i;
+         epochs[i] = START_EPOCH + i / 1440.0;
+         Real *s = &states[6 * i];
+         s[0] = radius * std::cos(angle);
+         s[1] = radius * std::sin(angle) * 0.8;
+         s[2] = radius * std::sin(angle) * 0.6;
+         s[3] = -radius * rate * std::sin(angle);
+         s[4] = radius * rate * std::cos(angle) * 0.8;
+         s[5] = radius * rate * std::cos(angle) * 0.6;
+      }
+   }
+
+
+   //---------------------------------------------------------------------------
+   // CoordinateConverter::Convert
+   //---------------------------------------------------------------------------
+   /**
+    * Conversion of an hour of states from EarthMJ2000Eq, one call per state or
+    * one call of the array form.
+    */
+   class ConvertBenchmark : public Benchmark
+   {
+   public:
+      /**
+       * @param toName    The output coordinate system
+       * @param arrayForm true to convert all states in one array call, false
+       *                  to convert one state per call
+       */
+      ConvertBenchmark(const std::string &toName, bool arrayForm) :
+         Benchmark(std::string("CoordinateConverter/") +
+                   (arrayForm ? "ConvertArray/" : "Convert/") + toName,
+                   "coordinates"),
+         outName     (toName),
+         useArray    (arrayForm),
+         inCS        (NULL),
+         outCS       (NULL)
+      {
+         unit = "state";
+         operations = STATES;
+      }
+
+      virtual void Setup()
+      {
+         ScriptBenchmark::Interpret(SCRIPT);
+         ScriptBenchmark::RunMission();
+         inCS  = GetCoordinateSystem("EarthMJ2000Eq");
+         outCS = GetCoordinateSystem(outName);
+         converter.Initialize();
+         MakeStates(STATES, epochs, inStates);
+         outStates.resize(inStates.size());
+      }
+
+      virtual void Run()
+      {
+         if (useArray)
+            converter.Convert(STATES, &epochs[0], &inStates[0], inCS,
+                  &outStates[0], outCS);
+         else
+         {
+            for (Integer i = 0; i < STATES; ++i)
+               converter.Convert(A1Mjd(epochs[i]), &inStates[6 * i], inCS,
+                     &outStates[6 * i], outCS);
+         }
+      }
+
+      virtual void TearDown()
+      {
+         inCS = outCS = NULL;
+      }
+
+   private:
+      static const Integer STATES = 60;
+
+      std::string          outName;
+      bool                 useArray;
+      CoordinateSystem     *inCS, *outCS;
+      CoordinateConverter  converter;
+      RealArray            epochs, inStates, outStates;
+   };
+
+
+   //---------------------------------------------------------------------------
+   // Shared rotations
+   //---------------------------------------------------------------------------
+   /**
+    * Several output systems sharing Earth-fixed axes, converted at the same
+    * epochs, with the shared rotation cache enabled or emptied.
+    */
+   class SharedRotationBenchmark : public Benchmark
+   {
+   public:
+      SharedRotationBenchmark(bool useCache) :
+         Benchmark(std::string("RotationMatrixCache/SharedEpoch/") +
+                   (useCache ? "Cached" : "Uncached"), "coordinates"),
+         cached      (useCache),
+         oldCapacity (RotationMatrixCache::DEFAULT_CAPACITY),
+         inCS        (NULL)
+      {
+         unit = "state";
+         operations = STATES * SYSTEMS;
+      }
+
+      virtual void Setup()
+      {
+         ScriptBenchmark::Interpret(SCRIPT);
+         ScriptBenchmark::RunMission();
+         inCS = GetCoordinateSystem("EarthMJ2000Eq");
+         outCS.clear();
+         outCS.push_back(GetCoordinateSystem("EarthFixed"));
+         outCS.push_back(GetCoordinateSystem("StationFixed"));
+         outCS.push_back(GetCoordinateSystem("EarthTOD"));
+         converter.Initialize();
+         MakeStates(STATES, epochs, states);
+
+         oldCapacity = RotationMatrixCache::Instance()->GetCapacity();
+         RotationMatrixCache::Instance()->SetCapacity(cached ?
+               RotationMatrixCache::DEFAULT_CAPACITY : 0);
+      }
+
+      virtual void Run()
+      {
+         // Each run starts cold so the epochs are not found from the last run
+         RotationMatrixCache::Instance()->Clear();
+         Real out[6];
+         for (Integer i = 0; i < STATES; ++i)
+            for (Integer j = 0; j < SYSTEMS; ++j)
+               converter.Convert(A1Mjd(epochs[i]), &states[6 * i], inCS, out,
+                     outCS[j]);
+      }
+
+      virtual void TearDown()
+      {
+         RotationMatrixCache::Instance()->SetCapacity(oldCapacity);
+         inCS = NULL;
+         outCS.clear();
+      }
+
+   private:
+      static const Integer STATES  = 60;
+      static const Integer SYSTEMS = 3;
+
+      bool                             cached;
+      Integer                          oldCapacity;
+      CoordinateSystem                 *inCS;
+      std::vector<CoordinateSystem*>   outCS;
+      CoordinateConverter              converter;
+      RealArray                        epochs, states;
+   };
+
+
+   //---------------------------------------------------------------------------
+   // DeFile::GetPosVel
+   //---------------------------------------------------------------------------
+   /**
+    * Body states read from the DE file for a day of one minute steps or at
+    * epochs scattered over eighty years.
+    */
+   class DeFileBenchmark : public Benchmark
+   {
+   public:
+      DeFileBenchmark(bool scatter) :
+         Benchmark(std::string("DeFile/GetPosVel/") +
+                   (scatter ? "Scattered" : "Sequential"), "coordinates"),
+         scattered   (scatter),
+         deFile      (NULL),
+         step        (0)
+      {
+         unit = "state";
+         operations = EPOCHS * BODIES;
+      }
+
+      virtual void Setup()
+      {
+         ScriptBenchmark::Interpret(SCRIPT);
+         ScriptBenchmark::RunMission();
+         SolarSystem *solar = Moderator::Instance()->GetSolarSystemInUse();
+         deFile = (solar == NULL ? NULL :
+               dynamic_cast<DeFile*>(solar->GetPlanetaryEphem()));
+         if (deFile == NULL)
+            throw BenchmarkException("The solar system does not use a DE "
+                  "file ephemeris");
+
+         const std::string names[BODIES] = {
+               GmatSolarSystemDefaults::SUN_NAME,
+               GmatSolarSystemDefaults::MOON_NAME,
+               GmatSolarSystemDefaults::MARS_NAME,
+               GmatSolarSystemDefaults::JUPITER_NAME };
+         for (Integer i = 0; i < BODIES; ++i)
+            bodies[i] = deFile->GetBodyID(names[i]);
+         step = 0;
+      }
+
+      virtual void Run()
+      {
+         for (Integer i = 0; i < EPOCHS; ++i, ++step)
+         {
+            Real epoch;
+            // The scattered epochs stay within the span of the DE405 file
+            // shipped with GMAT
+            if (scattered)
+               epoch = 6545.0 + std::fmod(step * 0.6180339887498949, 1.0) *
+                     30000.0;
+            else
+               epoch = START_EPOCH + std::fmod(step / 1440.0, 1.0);
+            for (Integer j = 0; j < BODIES; ++j)
+               deFile->GetPosVel(bodies[j], A1Mjd(epoch));
+         }
+      }
+
+      virtual void TearDown()
+      {
+         deFile = NULL;
+      }
+
+   private:
+      static const Integer EPOCHS = 250;
+      static const Integer BODIES = 4;
+
+      bool     scattered;
+      DeFile   *deFile;
+      Integer  bodies[BODIES];
+      Integer  step;
+   };
+}
+
+
+//------------------------------------------------------------------------------
+// void AddCoordinateBenchmarks(BenchmarkRunner &runner)
+//------------------------------------------------------------------------------
+void GmatBench::AddCoordinateBenchmarks(BenchmarkRunner &runner)
+{
+   const char *systems[] = { "EarthFixed", "EarthTOD", "EarthMOD",
+                             "LunaFixed" };
+   for (Integer i = 0; i < 4; ++i)
+      runner.Add(new ConvertBenchmark(systems[i], false));
+   runner.Add(new ConvertBenchmark("EarthFixed", true));
+
+   runner.Add(new SharedRotationBenchmark(true));
+   runner.Add(new SharedRotationBenchmark(false));
+
+   runner.Add(new DeFileBenchmark(false));
+   runner.Add(new DeFileBenchmark(true));
+}
@@ -0,0 +1,342 @@
+//$Id$
+//------------------------------------------------------------------------------
+//                             ForceModelBenchmarks
+//------------------------------------------------------------------------------
+// GMAT: General Mission Analysis Tool
+//
+// Copyright (c) 2002 - 2020 United States Government as represented by the
+// Administrator of the National Aeronautics and Space Administration.
+// All Other Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// You may not use this file except in compliance with the License.
+// You may obtain a copy of the License at:
+// http://www.apache.org/licenses/LICENSE-2.0.
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied.   See the License for the specific language
+// governing permissions and limitations under the License.
+//
+// Author: GMAT Development Team
+// Created: 2026/10/17
+//
+/**
+ * Benchmarks of the force models, the integrators and parallel propagation.
+ */
+//------------------------------------------------------------------------------
+
+#include "BenchmarkSuites.hpp"
+#include "BenchmarkRunner.hpp"
+#include "ScriptBenchmark.hpp"
+#include "PropSetup.hpp"
+#include "ODEModel.hpp"
+#include "PropagationStateManager.hpp"
+#include "GmatState.hpp"
+#include "WorkerPool.hpp"
+#include <sstream>
+
+namespace
+{
+   //---------------------------------------------------------------------------
+   // Script generation
+   //---------------------------------------------------------------------------
+
+   /// A LEO spacecraft; the index staggers the orbits
+   std::string Spacecraft(const std::string &name, Integer index)
+   {
+      std::stringstream s;
+      s << "Create Spacecraft " << name << ";\n"
+        << name << ".DateFormat = UTCGregorian;\n"
+        << name << ".Epoch = '01 Jan 2020 12:00:00.000';\n"
+        << name << ".CoordinateSystem = EarthMJ2000Eq;\n"
+        << name << ".DisplayStateType = Keplerian;\n"
+        << name << ".SMA = " << 6878.0 + 25.0 * index << ";\n"
+        << name << ".ECC = 0.001;\n"
+        << name << ".INC = " << 51.6 + 0.5 * index << ";\n"
+        << name << ".RAAN = " << 10.0 * index << ";\n"
+        << name << ".AOP = 0;\n"
+        << name << ".TA = " << 7.0 * index << ";\n"
+        << name << ".DryMass = 500;\n"
+        << name << ".Cd = 2.2;\n"
+        << name << ".Cr = 1.8;\n"
+        << name << ".DragArea = 4;\n"
+        << name << ".SRPArea = 4;\n";
+      return s.str();
+   }
+
+   /// Comma separated list of the spacecraft names Sat1 ... SatN
+   std::string SpacecraftList(Integer count)
+   {
+      std::stringstream s;
+      for (Integer i = 1; i <= count; ++i)
+         s << (i > 1 ? ", " : "") << "Sat" << i;
+      return s.str();
+   }
+
+   /**
+    * A force model, its propagator and the spacecraft.
+    *
+    * @param count      Number of spacecraft
+    * @param forces     Force model settings, one "FM.Field = value;" per line
+    * @param integrator The integrator type
+    */
+   std::string Configuration(Integer count, const std::string &forces,
+         const std::string &integrator = "RungeKutta89")
+   {
+      std::stringstream s;
+      for (Integer i = 1; i <= count; ++i)
+      {
+         std::stringstream name;
+         name << "Sat" << i;
+         s << Spacecraft(name.str(), i - 1);
+      }
+      s << "Create ForceModel FM;\n"
+        << "FM.CentralBody = Earth;\n"
+        << "FM.PrimaryBodies = {Earth};\n"
+        << forces
+        << "Create Propagator Prop;\n"
+        << "Prop.FM = FM;\n"
+        << "Prop.Type = " << integrator << ";\n"
+        << "Prop.InitialStepSize = 60;\n"
+        << "Prop.Accuracy = 1e-11;\n"
+        << "Prop.MinStep = 0.001;\n"
+        << "Prop.MaxStep = 2700;\n";
+      if (integrator == "AdamsBashforthMoulton")
+         s << "Prop.LowerError = 1e-14;\n"
+           << "Prop.TargetError = 1e-12;\n";
+      return s.str();
+   }
+
+   /// Earth gravity of the given degree and order; JGM2 goes to 70, EGM96
+   /// to 360
+   std::string Gravity(Integer degree,
+         const std::string &potentialFile = "JGM2.cof")
+   {
+      std::stringstream s;
+      s << "FM.GravityField.Earth.Degree = " << degree << ";\n"
+        << "FM.GravityField.Earth.Order = " << degree << ";\n"
+        << "FM.GravityField.Earth.PotentialFile = '" << potentialFile
+        << "';\n";
+      return s.str();
+   }
+
+   std::string Drag(const std::string &atmosphere, bool fromFiles)
+   {
+      std::string s = Gravity(4) +
+         "FM.Drag.AtmosphereModel = " + atmosphere + ";\n";
+      if (fromFiles)
+         s += "FM.Drag.HistoricWeatherSource = 'CSSISpaceWeatherFile';\n"
+              "FM.Drag.PredictedWeatherSource = 'SchattenFile';\n";
+      else
+         s += "FM.Drag.HistoricWeatherSource = 'ConstantFluxAndGeoMag';\n"
+              "FM.Drag.PredictedWeatherSource = 'ConstantFluxAndGeoMag';\n";
+      return s;
+   }
+
+   /// The forces of a typical LEO operations force model
+   std::string FullForces()
+   {
+      return Gravity(20) +
+         "FM.PointMasses = {Luna, Sun};\n"
+         "FM.SRP = On;\n"
+         "FM.Drag.AtmosphereModel = JacchiaRoberts;\n";
+   }
+
+
+   //---------------------------------------------------------------------------
+   // ODEModel::GetDerivatives
+   //---------------------------------------------------------------------------
+   /**
+    * Derivative evaluations of an initialized force model.
+    *
+    * A one minute propagation initializes the model for the spacecraft, then
+    * each run evaluates the derivatives at offsets spread over a step the way
+    * the stages of an integrator do.
+    */
+   class DerivativeBenchmark : public Benchmark
+   {
+   public:
+      DerivativeBenchmark(const std::string &label, Integer count,
+                          const std::string &forces) :
+         Benchmark("ODEModel/GetDerivatives/" + label, "forcemodel"),
+         script   (Configuration(count, forces) +
+                   "BeginMissionSequence;\n"
+                   "Propagate Prop(" + SpacecraftList(count) +
+                   ") {Sat1.ElapsedSecs = 60};\n"),
+         model    (NULL)
+      {
+         unit = "call";
+         operations = CALLS;
+      }
+
+      virtual void Setup()
+      {
+         ScriptBenchmark::Interpret(script);
+         ScriptBenchmark::RunMission();
+
+         PropSetup *prop = ScriptBenchmark::GetPropagateClone(0);
+         model = prop->GetODEModel();
+         GmatState *gs = prop->GetPropStateManager()->GetState();
+         state.assign(gs->GetState(), gs->GetState() + gs->GetSize());
+      }
+
+      virtual void Run()
+      {
+         for (Integer i = 0; i < CALLS; ++i)
+            model->GetDerivatives(&state[0], (i % 16) * 3.75, 1);
+      }
+
+      virtual void TearDown()
+      {
+         model = NULL;
+      }
+
+   private:
+      /// Derivative calls in one run
+      static const Integer CALLS = 100;
+
+      std::string script;
+      ODEModel    *model;
+      RealArray   state;
+   };
+
+
+   //---------------------------------------------------------------------------
+   // Parallel propagation
+   //---------------------------------------------------------------------------
+   /**
+    * One day of eight spacecraft, stepped serially or by Propagate Parallel
+    * with a given number of worker threads.  The spacecraft either have a
+    * PropSetup each, stepped concurrently, or share one PropSetup, whose
+    * gravity field is summed for the spacecraft concurrently.  The Earth
+    * nutation keeps its default update interval; each parallel model buffers
+    * it in its own copies of the coordinate systems.
+    */
+   class ParallelPropagateBenchmark : public ScriptBenchmark
+   {
+   public:
+      ParallelPropagateBenchmark(Integer threadCount, bool onePropSetup) :
+         ScriptBenchmark(Name(threadCount, onePropSetup), "forcemodel",
+                         Script(threadCount >= 0, onePropSetup), "day"),
+         threads        (threadCount),
+         oldThreads     (0)
+      {
+      }
+
+      virtual void Setup()
+      {
+         oldThreads = WorkerPool::Instance()->GetThreadCount();
+         if (threads >= 0)
+            WorkerPool::Instance()->SetThreadCount(threads);
+         ScriptBenchmark::Setup();
+      }
+
+      virtual void TearDown()
+      {
+         WorkerPool::Instance()->SetThreadCount(oldThreads);
+      }
+
+   private:
+      static const Integer SPACECRAFT = 8;
+
+      /// Worker threads; 0 uses one per core, -1 runs without Parallel
+      Integer threads;
+      Integer oldThreads;
+
+      static std::string Name(Integer threadCount, bool onePropSetup)
+      {
+         std::stringstream name;
+         name << (onePropSetup ? "Propagate/OnePropSetup/" : "Propagate/");
+         if (threadCount < 0)
+            name << "Serial";
+         else if (threadCount == 0)
+            name << "Parallel/AllCores";
+         else
+            name << "Parallel/" << threadCount;
+         return name.str();
+      }
+
+      static std::string Script(bool parallel, bool onePropSetup)
+      {
+         std::stringstream s;
+         s << Configuration(SPACECRAFT, FullForces());
+         if (!onePropSetup)
+            for (Integer i = 2; i <= SPACECRAFT; ++i)
+               s << "Create Propagator Prop" << i << ";\n"
+                 << "Prop" << i << ".FM = FM;\n"
+                 << "Prop" << i << ".Type = RungeKutta89;\n";
+         s << "BeginMissionSequence;\n"
+           << "Propagate" << (parallel ? " Parallel" : "") << " Prop(Sat1";
+         for (Integer i = 2; i <= SPACECRAFT; ++i)
+         {
+            if (onePropSetup)
+               s << ", Sat" << i;
+            else
+               s << ") Prop" << i << "(Sat" << i;
+         }
+         s << ") {Sat1.ElapsedDays = 1};\n";
+         return s.str();
+      }
+   };
+}
+
+
+//------------------------------------------------------------------------------
+// void AddForceModelBenchmarks(BenchmarkRunner &runner)
+//------------------------------------------------------------------------------
+void GmatBench::AddForceModelBenchmarks(BenchmarkRunner &runner)
+{
+   runner.Add(new DerivativeBenchmark("PointMass", 1, Gravity(0)));
+   runner.Add(new DerivativeBenchmark("ThirdBodies", 1,
+         Gravity(0) + "FM.PointMasses = {Luna, Sun};\n"));
+   runner.Add(new DerivativeBenchmark("ThirdBodies/10Spacecraft", 10,
+         Gravity(0) + "FM.PointMasses = {Luna, Sun};\n"));
+   runner.Add(new DerivativeBenchmark("ThirdBodies/100Spacecraft", 100,
+         Gravity(0) + "FM.PointMasses = {Luna, Sun};\n"));
+   runner.Add(new DerivativeBenchmark("ThirdBodies/1000Spacecraft", 1000,
+         Gravity(0) + "FM.PointMasses = {Luna, Sun};\n"));
+   runner.Add(new DerivativeBenchmark("JGM2/8x8", 1, Gravity(8)));
+   runner.Add(new DerivativeBenchmark("JGM2/70x70", 1, Gravity(70)));
+   runner.Add(new DerivativeBenchmark("EGM96/120x120", 1,
+         Gravity(120, "EGM96.cof")));
+   runner.Add(new DerivativeBenchmark("EGM96/360x360", 1,
+         Gravity(360, "EGM96.cof")));
+   runner.Add(new DerivativeBenchmark("Drag/JacchiaRoberts/ConstantFlux", 1,
+         Drag("JacchiaRoberts", false)));
+   runner.Add(new DerivativeBenchmark("Drag/JacchiaRoberts/FluxFiles", 1,
+         Drag("JacchiaRoberts", true)));
+   runner.Add(new DerivativeBenchmark("Drag/MSISE90/ConstantFlux", 1,
+         Drag("MSISE90", false)));
+   runner.Add(new DerivativeBenchmark("Drag/MSISE90/FluxFiles", 1,
+         Drag("MSISE90", true)));
+   runner.Add(new DerivativeBenchmark("SRP", 1,
+         Gravity(0) + "FM.PointMasses = {Sun};\nFM.SRP = On;\n"));
+   runner.Add(new DerivativeBenchmark("FullModel", 1, FullForces()));
+
+   // Benchmark name and script type of each integrator.  The Runge-Kutta-
+   // Nystrom integrator, which steps the second order equations of motion, is
+   // scripted as RungeKutta68.
+   const char *integrators[][2] = {
+         { "RungeKutta89",          "RungeKutta89" },
+         { "PrinceDormand78",       "PrinceDormand78" },
+         { "PrinceDormand45",       "PrinceDormand45" },
+         { "RungeKuttaNystrom68",   "RungeKutta68" },
+         { "RungeKutta56",          "RungeKutta56" },
+         { "AdamsBashforthMoulton", "AdamsBashforthMoulton" } };
+   for (Integer i = 0; i < 6; ++i)
+   {
+      std::string name = integrators[i][0];
+      runner.Add(new ScriptBenchmark("Propagator/" + name + "/OneDay",
+            "forcemodel", Configuration(1, FullForces(), integrators[i][1]) +
+            "BeginMissionSequence;\n"
+            "Propagate Prop(Sat1) {Sat1.ElapsedDays = 1};\n", "day"));
+   }
+
+   Integer threads[] = { -1, 1, 2, 4, 0 };
+   for (Integer i = 0; i < 5; ++i)
+   {
+      runner.Add(new ParallelPropagateBenchmark(threads[i], false));
+      runner.Add(new ParallelPropagateBenchmark(threads[i], true));
+   }
+}
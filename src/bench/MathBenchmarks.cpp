@@ -0,0 +1,638 @@
+//$Id$
+//------------------------------------------------------------------------------
+//                                MathBenchmarks
+//------------------------------------------------------------------------------
+// GMAT: General Mission Analysis Tool
+//
+// Copyright (c) 2002 - 2020 United States Government as represented by the
+// Administrator of the National Aeronautics and Space Administration.
+// All Other Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// You may not use this file except in compliance with the License.
+// You may obtain a copy of the License at:
+// http://www.apache.org/licenses/LICENSE-2.0.
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied.   See the License for the specific language
+// governing permissions and limitations under the License.
+//
+// Author: GMAT Development Team
+// Created: 2026/10/17
+//
+/**
+ * Benchmarks of the utility library: matrix kernels and factorizations,
+ * covariance updates, state conversions and ephemeris interpolation.
+ */
+//------------------------------------------------------------------------------
+
+#include "BenchmarkSuites.hpp"
+#include "BenchmarkRunner.hpp"
+#include "Benchmark.hpp"
+#include "Rmatrix.hpp"
+#include "Rmatrix66.hpp"
+#include "Rvector6.hpp"
+#include "CholeskyFactorization.hpp"
+#include "LUFactorization.hpp"
+#include "UDFactorization.hpp"
+#include "BlockNormalEquations.hpp"
+#include "StateConversionUtil.hpp"
+#include "Ephemeris.hpp"
+#include <cmath>
+#include <sstream>
+#include <vector>
+
+namespace
+{
+   //---------------------------------------------------------------------------
+   // Test data
+   //---------------------------------------------------------------------------
+
+   /// Well conditioned general matrix
+   Rmatrix General(Integer rows, Integer cols, Real seed)
+   {
+      Rmatrix m(rows, cols);
+      for (Integer i = 0; i < rows; ++i)
+         for (Integer j = 0; j < cols; ++j)
+            m(i,j) = std::sin(seed + 1.3 * i + 0.7 * j) +
+                     (i == j ? rows : 0.0);
+      return m;
+   }
+
+   /// Symmetric positive definite matrix
+   Rmatrix Covariance(Integer n)
+   {
+      Rmatrix a = General(n, n, 0.4);
+      Rmatrix p = MatrixTimesTranspose(a, a);
+      for (Integer i = 0; i < n; ++i)
+         p(i,i) += 1.0;
+      return p;
+   }
+
+   std::string Sized(const std::string &base, Integer n)
+   {
+      std::stringstream name;
+      name << base << "/" << n;
+      return name.str();
+   }
+
+
+   //---------------------------------------------------------------------------
+   // Rmatrix products
+   //---------------------------------------------------------------------------
+   class MatrixProductBenchmark : public Benchmark
+   {
+   public:
+      MatrixProductBenchmark(Integer size) :
+         Benchmark(Sized("Rmatrix/Multiply", size), "math"),
+         n        (size)
+      {
+         unit = "product";
+      }
+
+      virtual void Setup()
+      {
+         a = General(n, n, 0.1);
+         b = General(n, n, 0.9);
+      }
+
+      virtual void Run()
+      {
+         c = a * b;
+      }
+
+   private:
+      Integer n;
+      Rmatrix a, b, c;
+   };
+
+
+   /// H P H^T, formed with the fused kernel or with two separate products
+   class CovarianceMapBenchmark : public Benchmark
+   {
+   public:
+      CovarianceMapBenchmark(Integer measurements, Integer states,
+                             bool useFused) :
+         Benchmark(Sized(std::string("Rmatrix/HPHt/") +
+                   (useFused ? "Fused" : "Separate"), states), "math"),
+         m        (measurements),
+         n        (states),
+         fused    (useFused)
+      {
+         unit = "product";
+      }
+
+      virtual void Setup()
+      {
+         h = General(m, n, 0.3);
+         p = Covariance(n);
+      }
+
+      virtual void Run()
+      {
+         if (fused)
+            result = MatrixTimesMatrixTimesTranspose(h, p);
+         else
+            result = h * p * h.Transpose();
+      }
+
+   private:
+      Integer m, n;
+      bool    fused;
+      Rmatrix h, p, result;
+   };
+
+
+   /// The 6x6 products of state transition matrix and covariance work
+   class FixedMatrixBenchmark : public Benchmark
+   {
+   public:
+      FixedMatrixBenchmark() :
+         Benchmark("Rmatrix66/Multiply", "math")
+      {
+         unit = "product";
+      }
+
+      virtual void Setup()
+      {
+         a = Rmatrix66(General(6, 6, 0.2));
+         b = Rmatrix66(General(6, 6, 1.1));
+         v = Rvector6(7000.0, 100.0, -20.0, 0.1, 7.5, 0.01);
+      }
+
+      virtual void Run()
+      {
+         c = a * b;
+         w = c * v;
+      }
+
+   private:
+      Rmatrix66 a, b, c;
+      Rvector6  v, w;
+   };
+
+
+   //---------------------------------------------------------------------------
+   // Factorizations
+   //---------------------------------------------------------------------------
+   class FactorizationBenchmark : public Benchmark
+   {
+   public:
+      enum Operation
+      {
+         CHOLESKY_INVERT,
+         LU_INVERT,
+         LU_SOLVE
+      };
+
+      FactorizationBenchmark(Operation op, Integer size) :
+         Benchmark(Sized(NameOf(op), size), "math"),
+         operation   (op),
+         n           (size)
+      {
+         unit = (op == LU_SOLVE ? "solve" : "inverse");
+      }
+
+      virtual void Setup()
+      {
+         matrix = Covariance(n);
+         rhs.SetSize(n);
+         for (Integer i = 0; i < n; ++i)
+            rhs[i] = 1.0 + i;
+         solution.SetSize(n);
+      }
+
+      virtual void Run()
+      {
+         // The inversions work in place, so each run starts from a copy
+         if (operation == CHOLESKY_INVERT)
+         {
+            work = matrix;
+            cholesky.Invert(work);
+         }
+         else if (operation == LU_INVERT)
+         {
+            work = matrix;
+            lu.Invert(work);
+         }
+         else
+            lu.SolveSystem(matrix, rhs, solution);
+      }
+
+   private:
+      Operation               operation;
+      Integer                 n;
+      Rmatrix                 matrix, work;
+      Rvector                 rhs, solution;
+      CholeskyFactorization   cholesky;
+      LUFactorization         lu;
+
+      static std::string NameOf(Operation op)
+      {
+         if (op == CHOLESKY_INVERT)
+            return "CholeskyFactorization/Invert";
+         if (op == LU_INVERT)
+            return "LUFactorization/Invert";
+         return "LUFactorization/SolveSystem";
+      }
+   };
+
+
+   //---------------------------------------------------------------------------
+   // Kalman filter covariance updates
+   //---------------------------------------------------------------------------
+   /**
+    * A batch of scalar measurement updates, in U-D form or with the dense
+    * Joseph form used by the extended Kalman filter.
+    */
+   class MeasurementUpdateBenchmark : public Benchmark
+   {
+   public:
+      MeasurementUpdateBenchmark(Integer states, bool useUD) :
+         Benchmark(Sized(std::string("Covariance/MeasurementUpdate/") +
+                   (useUD ? "UD" : "Joseph"), states), "math"),
+         n        (states),
+         ud       (useUD),
+         r        (1.0e-4)
+      {
+         unit = "update";
+         operations = UPDATES;
+      }
+
+      virtual void Setup()
+      {
+         p0 = Covariance(n);
+         h = General(UPDATES, n, 2.0);
+
+         u0.assign(n * n, 0.0);
+         d0.assign(n, 0.0);
+         UDFactorization::Factor(p0.GetDataVector(), n, &u0[0], &d0[0]);
+         u.resize(n * n);
+         d.resize(n);
+         gain.resize(n);
+         work.resize(2 * n);
+      }
+
+      virtual void Run()
+      {
+         if (ud)
+         {
+            u = u0;
+            d = d0;
+            for (Integer k = 0; k < UPDATES; ++k)
+               UDFactorization::MeasurementUpdate(&u[0], &d[0], n,
+                     h.GetDataVector() + k * n, r, &gain[0], &work[0]);
+         }
+         else
+         {
+            Rmatrix p = p0;
+            Rmatrix hk(1, n), identity(n, n);
+            for (Integer i = 0; i < n; ++i)
+               identity(i,i) = 1.0;
+
+            for (Integer k = 0; k < UPDATES; ++k)
+            {
+               for (Integer i = 0; i < n; ++i)
+                  hk(0,i) = h(k,i);
+               Rmatrix ph = MatrixTimesTranspose(p, hk);
+               Real alpha = (hk * ph)(0,0) + r;
+               Rmatrix kalman = ph / alpha;
+
+               Rmatrix ikh = identity;
+               ikh.AddProduct(kalman, hk, -1.0);
+               p = MatrixTimesMatrixTimesTranspose(ikh, p);
+               p.AddProduct(kalman, kalman, r, false, true);
+            }
+         }
+      }
+
+   private:
+      /// Scalar measurements processed in one run
+      static const Integer UPDATES = 10;
+
+      Integer     n;
+      bool        ud;
+      Real        r;
+      Rmatrix     p0, h;
+      RealArray   u0, d0, u, d, gain, work;
+   };
+
+
+   class UDTimeUpdateBenchmark : public Benchmark
+   {
+   public:
+      UDTimeUpdateBenchmark(Integer states) :
+         Benchmark(Sized("UDFactorization/TimeUpdate", states), "math"),
+         n        (states)
+      {
+         unit = "update";
+      }
+
+      virtual void Setup()
+      {
+         // W = [Phi U | U_q] with weights [D, D_q], as formed by the filter
+         Rmatrix phi = General(n, n, 0.6) / (Real)n;
+         RealArray u(n * n), d(n), qu(n * n), qd(n);
+         Rmatrix p = Covariance(n), q = Covariance(n) * 1.0e-6;
+         UDFactorization::Factor(p.GetDataVector(), n, &u[0], &d[0]);
+         UDFactorization::Factor(q.GetDataVector(), n, &qu[0], &qd[0]);
+
+         w0.assign(2 * n * n, 0.0);
+         dw.assign(2 * n, 0.0);
+         for (Integer i = 0; i < n; ++i)
+         {
+            for (Integer k = 0; k < n; ++k)
+            {
+               Real sum = phi(i,k);
+               for (Integer l = 0; l < k; ++l)
+                  sum += phi(i,l) * u[l * n + k];
+               w0[i * 2 * n + k] = sum;
+               w0[i * 2 * n + n + k] = qu[i * n + k];
+            }
+            dw[i] = d[i];
+            dw[n + i] = qd[i];
+         }
+         w.resize(w0.size());
+         uOut.resize(n * n);
+         dOut.resize(n);
+         work.resize(2 * n);
+      }
+
+      virtual void Run()
+      {
+         w = w0;
+         UDFactorization::TimeUpdate(&w[0], &dw[0], n, 2 * n, &uOut[0],
+               &dOut[0], &work[0]);
+      }
+
+   private:
+      Integer     n;
+      RealArray   w0, w, dw, uOut, dOut, work;
+   };
+
+
+   //---------------------------------------------------------------------------
+   // Batch normal equations
+   //---------------------------------------------------------------------------
+   /**
+    * Accumulation and solution of the normal equations of a problem with 7
+    * global parameters and two biases per tracking pass, densely as
+    * BatchEstimator does by default, or with the Schur complement of
+    * BlockNormalEquations.
+    */
+   class NormalEquationsBenchmark : public Benchmark
+   {
+   public:
+      NormalEquationsBenchmark(Integer trackingPasses, bool useBlocks) :
+         Benchmark(Sized(std::string("NormalEquations/AccumulateAndSolve/") +
+                   (useBlocks ? "Block" : "Dense"), trackingPasses), "math"),
+         passes   (trackingPasses),
+         blocked  (useBlocks)
+      {
+         unit = "solution";
+      }
+
+      virtual void Setup()
+      {
+         // Biases of pass b, then the global parameters at the end
+         structure.clear();
+         for (Integer b = 0; b < passes; ++b)
+            for (Integer k = 0; k < BIASES; ++k)
+               structure.push_back(b);
+         for (Integer i = 0; i < GLOBALS; ++i)
+            structure.push_back(-1);
+         n = structure.size();
+
+         // Each global partial has its own frequency, so the globals are
+         // observable together
+         partials.clear();
+         for (Integer b = 0; b < passes; ++b)
+            for (Integer m = 0; m < PER_PASS; ++m)
+            {
+               RealArray h(n, 0.0);
+               Real angle = 0.3 * b + 1.1 * m;
+               for (Integer i = 0; i < GLOBALS; ++i)
+                  h[n - GLOBALS + i] = std::sin((i + 1) * angle + 0.7 * i);
+               h[b * BIASES + (m % BIASES)] = 1.0;
+               partials.push_back(h);
+            }
+      }
+
+      virtual void Run()
+      {
+         const Real weight = 1.0e4;
+         if (blocked)
+         {
+            BlockNormalEquations bne;
+            bne.SetStructure(structure);
+            for (UnsignedInt k = 0; k < partials.size(); ++k)
+               bne.Accumulate(partials[k], weight, 0.01 * (k % 7));
+            bne.Solve(dx);
+         }
+         else
+         {
+            Rmatrix info(n, n);
+            Rvector rhs(n);
+            for (UnsignedInt k = 0; k < partials.size(); ++k)
+            {
+               const RealArray &h = partials[k];
+               for (Integer i = 0; i < n; ++i)
+               {
+                  if (h[i] == 0.0)
+                     continue;
+                  for (Integer j = 0; j < n; ++j)
+                     info(i,j) += h[i] * h[j] * weight;
+                  rhs[i] += h[i] * weight * 0.01 * (k % 7);
+               }
+            }
+            cholesky.Invert(info);
+            dx.assign(n, 0.0);
+            for (Integer i = 0; i < n; ++i)
+               for (Integer j = 0; j < n; ++j)
+                  dx[i] += info(i,j) * rhs[j];
+         }
+      }
+
+   private:
+      static const Integer GLOBALS  = 7;
+      static const Integer BIASES   = 2;
+      /// Measurements in each pass
+      static const Integer PER_PASS = 30;
+
+      Integer                 passes, n;
+      bool                    blocked;
+      IntegerArray            structure;
+      std::vector<RealArray>  partials;
+      RealArray               dx;
+      CholeskyFactorization   cholesky;
+   };
+
+
+   //---------------------------------------------------------------------------
+   // State conversions
+   //---------------------------------------------------------------------------
+   class StateConversionBenchmark : public Benchmark
+   {
+   public:
+      StateConversionBenchmark(const std::string &from, const std::string &to) :
+         Benchmark("StateConversionUtil/" + from + "To" + to, "math"),
+         fromType (from),
+         toType   (to)
+      {
+         unit = "conversion";
+         operations = STATES;
+      }
+
+      virtual void Setup()
+      {
+         // Low to high orbits with a spread of shapes and orientations
+         states.clear();
+         for (Integer i = 0; i < STATES; ++i)
+         {
+            Rvector6 kep(6878.0 + 500.0 * i, 0.001 + 0.01 * (i % 20),
+                         5.0 + 2.5 * (i % 60), 7.0 * i, 11.0 * i, 13.0 * i);
+            if (fromType == "Keplerian")
+               states.push_back(kep);
+            else
+               states.push_back(StateConversionUtil::KeplerianToCartesian(
+                     GmatSolarSystemDefaults::PLANET_MU[
+                     GmatSolarSystemDefaults::EARTH], kep));
+         }
+      }
+
+      virtual void Run()
+      {
+         for (Integer i = 0; i < STATES; ++i)
+            result = StateConversionUtil::Convert(states[i], fromType, toType);
+      }
+
+   private:
+      /// States converted in one run
+      static const Integer STATES = 64;
+
+      std::string             fromType, toType;
+      std::vector<Rvector6>   states;
+      Rvector6                result;
+   };
+
+
+   //---------------------------------------------------------------------------
+   // Ephemeris interpolation
+   //---------------------------------------------------------------------------
+   /**
+    * Interpolation in a one million point ephemeris, with lookups marching
+    * through the span or scattered across it.
+    */
+   class EphemerisLookupBenchmark : public Benchmark
+   {
+   public:
+      EphemerisLookupBenchmark(bool scatter) :
+         Benchmark(std::string("Ephemeris/InterpolatePoint/") +
+                   (scatter ? "Scattered" : "Sequential"), "math"),
+         scattered   (scatter),
+         ephem       (NULL),
+         step        (0)
+      {
+         unit = "lookup";
+         operations = LOOKUPS;
+      }
+
+      virtual void Setup()
+      {
+         // Circular orbit sampled every minute
+         ephem = new Ephemeris();
+         Real posvel[6];
+         const Real radius = 7000.0, rate = 0.00108;
+         for (Integer i = 0; i < POINTS; ++i)
+         {
+            Real t = 60.0 * i, angle = rate * t;
+            posvel[0] = radius * std::cos(angle);
+            posvel[1] = radius * std::sin(angle);
+            posvel[2] = 0.1 * posvel[1];
+            posvel[3] = -radius * rate * std::sin(angle);
+            posvel[4] = radius * rate * std::cos(angle);
+            posvel[5] = 0.1 * posvel[4];
+            ephem->AddPoint(START + t / 86400.0, posvel);
+         }
+         step = 0;
+      }
+
+      virtual void Run()
+      {
+         const Real span = (POINTS - 1) * 60.0 / 86400.0;
+         for (Integer i = 0; i < LOOKUPS; ++i, ++step)
+         {
+            Real offset;
+            if (scattered)
+               // Deterministic pseudo-random spread over the span
+               offset = std::fmod(step * 0.6180339887498949, 1.0) * span;
+            else
+               offset = std::fmod(step * 37.0 / 86400.0, span);
+            state = ephem->InterpolatePoint(START + offset);
+         }
+      }
+
+      virtual void TearDown()
+      {
+         delete ephem;
+         ephem = NULL;
+      }
+
+   private:
+      static const Integer POINTS  = 1000000;
+      static const Integer LOOKUPS = 1000;
+      static constexpr Real START  = 27000.0;
+
+      bool        scattered;
+      Ephemeris   *ephem;
+      Integer     step;
+      Rvector6    state;
+   };
+}
+
+
+//------------------------------------------------------------------------------
+// void AddMathBenchmarks(BenchmarkRunner &runner)
+//------------------------------------------------------------------------------
+void GmatBench::AddMathBenchmarks(BenchmarkRunner &runner)
+{
+   Integer sizes[] = { 6, 50, 200 };
+   for (Integer i = 0; i < 3; ++i)
+      runner.Add(new MatrixProductBenchmark(sizes[i]));
+   runner.Add(new CovarianceMapBenchmark(30, 50, true));
+   runner.Add(new CovarianceMapBenchmark(30, 50, false));
+   runner.Add(new FixedMatrixBenchmark());
+
+   runner.Add(new FactorizationBenchmark(
+         FactorizationBenchmark::CHOLESKY_INVERT, 50));
+   runner.Add(new FactorizationBenchmark(
+         FactorizationBenchmark::CHOLESKY_INVERT, 200));
+   runner.Add(new FactorizationBenchmark(
+         FactorizationBenchmark::LU_INVERT, 50));
+   runner.Add(new FactorizationBenchmark(
+         FactorizationBenchmark::LU_SOLVE, 200));
+
+   Integer states[] = { 9, 30 };
+   for (Integer i = 0; i < 2; ++i)
+   {
+      runner.Add(new MeasurementUpdateBenchmark(states[i], true));
+      runner.Add(new MeasurementUpdateBenchmark(states[i], false));
+      runner.Add(new UDTimeUpdateBenchmark(states[i]));
+   }
+
+   Integer passes[] = { 25, 100, 200 };
+   for (Integer i = 0; i < 3; ++i)
+   {
+      runner.Add(new NormalEquationsBenchmark(passes[i], true));
+      runner.Add(new NormalEquationsBenchmark(passes[i], false));
+   }
+
+   runner.Add(new StateConversionBenchmark("Cartesian", "Keplerian"));
+   runner.Add(new StateConversionBenchmark("Keplerian", "Cartesian"));
+   runner.Add(new StateConversionBenchmark("Cartesian", "Equinoctial"));
+   runner.Add(new StateConversionBenchmark("Cartesian", "BrouwerMeanShort"));
+
+   runner.Add(new EphemerisLookupBenchmark(false));
+   runner.Add(new EphemerisLookupBenchmark(true));
+}
@@ -0,0 +1,665 @@
+//$Id$
+//------------------------------------------------------------------------------
+//                              MissionBenchmarks
+//------------------------------------------------------------------------------
+// GMAT: General Mission Analysis Tool
+//
+// Copyright (c) 2002 - 2020 United States Government as represented by the
+// Administrator of the National Aeronautics and Space Administration.
+// All Other Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// You may not use this file except in compliance with the License.
+// You may obtain a copy of the License at:
+// http://www.apache.org/licenses/LICENSE-2.0.
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied.   See the License for the specific language
+// governing permissions and limitations under the License.
+//
+// Author: GMAT Development Team
+// Created: 2026/10/17
+//
+/**
+ * End to end benchmarks: script parsing, mission output, event location,
+ * batch estimation and tracking data reads.
+ *
+ * The estimation benchmarks need the estimation plugin to be loaded by the
+ * startup file; without it their scripts do not interpret and they are
+ * skipped.  The tracking data readers are called directly, so they are only
+ * built when the driver links the plugin (GMAT_BENCH_ESTIMATION).
+ */
+//------------------------------------------------------------------------------
+
+#include "BenchmarkSuites.hpp"
+#include "BenchmarkRunner.hpp"
+#include "BenchmarkException.hpp"
+#include "ScriptBenchmark.hpp"
+#include "FileManager.hpp"
+#include <fstream>
+#include <sstream>
+#include <iomanip>
+#include <cmath>
+
+#ifdef GMAT_BENCH_ESTIMATION
+#include "Moderator.hpp"
+#include "ObType.hpp"
+#include "BinaryObType.hpp"
+#endif
+
+namespace
+{
+   //---------------------------------------------------------------------------
+   // Shared script pieces
+   //---------------------------------------------------------------------------
+
+   /// Full path of a file written by the benchmarks in the output directory
+   std::string OutputFile(const std::string &fileName)
+   {
+      std::string path =
+            FileManager::Instance()->GetAbsPathname(FileManager::OUTPUT_PATH);
+      if (!path.empty() && (path[path.size() - 1] != '/') &&
+          (path[path.size() - 1] != '\\'))
+         path += "/";
+      return path + fileName;
+   }
+
+   /// A LEO spacecraft and a propagator with a moderate force model
+   const std::string LEO_CONFIGURATION =
+      "Create Spacecraft Sat;\n"
+      "Sat.DateFormat = UTCGregorian;\n"
+      "Sat.Epoch = '01 Jan 2020 12:00:00.000';\n"
+      "Sat.CoordinateSystem = EarthMJ2000Eq;\n"
+      "Sat.DisplayStateType = Keplerian;\n"
+      "Sat.SMA = 6978;\n"
+      "Sat.ECC = 0.001;\n"
+      "Sat.INC = 51.6;\n"
+      "Sat.RAAN = 30;\n"
+      "Sat.AOP = 0;\n"
+      "Sat.TA = 0;\n"
+      "Create ForceModel FM;\n"
+      "FM.CentralBody = Earth;\n"
+      "FM.PrimaryBodies = {Earth};\n"
+      "FM.GravityField.Earth.Degree = 8;\n"
+      "FM.GravityField.Earth.Order = 8;\n"
+      "FM.PointMasses = {Luna, Sun};\n"
+      "Create Propagator Prop;\n"
+      "Prop.FM = FM;\n"
+      "Prop.Type = RungeKutta89;\n"
+      "Prop.MaxStep = 60;\n";
+
+   const std::string ONE_DAY =
+      "BeginMissionSequence;\n"
+      "Propagate Prop(Sat) {Sat.ElapsedDays = 1};\n";
+
+
+   //---------------------------------------------------------------------------
+   // Script parsing
+   //---------------------------------------------------------------------------
+   /**
+    * Interpretation of a large generated script: many resources, coordinate
+    * systems, parameter reports and a long mission sequence.
+    */
+   class InterpretBenchmark : public Benchmark
+   {
+   public:
+      InterpretBenchmark() :
+         Benchmark("ScriptInterpreter/InterpretScript/Large", "mission", true)
+      {
+         unit = "line";
+      }
+
+      virtual void Setup()
+      {
+         std::stringstream s;
+         for (Integer i = 0; i < RESOURCES; ++i)
+         {
+            s << "Create Spacecraft Sat" << i << ";\n"
+              << "Sat" << i << ".DateFormat = UTCGregorian;\n"
+              << "Sat" << i << ".Epoch = '01 Jan 2020 12:00:00.000';\n"
+              << "Sat" << i << ".SMA = " << 7000 + i << ";\n"
+              << "Sat" << i << ".ECC = 0.01;\n"
+              << "Sat" << i << ".INC = " << (i % 90) << ";\n"
+              << "Create CoordinateSystem Frame" << i << ";\n"
+              << "Frame" << i << ".Origin = Sat" << i << ";\n"
+              << "Frame" << i << ".Axes = VNB;\n"
+              << "Frame" << i << ".Primary = Earth;\n"
+              << "Frame" << i << ".Secondary = Sat" << i << ";\n"
+              << "Create Variable Var" << i << ";\n"
+              << "Create ReportFile Report" << i << ";\n"
+              << "Report" << i << ".Filename = 'Report" << i << ".txt';\n"
+              << "Report" << i << ".Add = {Sat" << i << ".A1ModJulian, Sat"
+              << i << ".Frame" << i << ".X, Sat" << i << ".Earth.Altitude};\n";
+         }
+         s << "Create Propagator Prop;\n"
+           << "BeginMissionSequence;\n";
+         for (Integer i = 0; i < RESOURCES; ++i)
+            s << "Var" << i << " = Sat" << i << ".SMA * 2 + sqrt(Sat" << i
+              << ".ECC);\n"
+              << "If Var" << i << " > 14000\n"
+              << "   Propagate Prop(Sat" << i << ") {Sat" << i
+              << ".Periapsis};\n"
+              << "   Report Report" << i << " Sat" << i << ".X Var" << i
+              << ";\n"
+              << "EndIf;\n";
+         script = s.str();
+
+         Integer lines = 0;
+         for (std::string::size_type i = 0; i < script.size(); ++i)
+            if (script[i] == '\n')
+               ++lines;
+         operations = lines;
+      }
+
+      virtual void Run()
+      {
+         ScriptBenchmark::Interpret(script);
+      }
+
+   private:
+      static const Integer RESOURCES = 200;
+
+      std::string script;
+   };
+
+
+   //---------------------------------------------------------------------------
+   // Mission output
+   //---------------------------------------------------------------------------
+   std::string ReportScript()
+   {
+      return LEO_CONFIGURATION +
+         "Create ReportFile Report;\n"
+         "Report.Filename = '" + OutputFile("gmat_bench_report.txt") + "';\n"
+         "Report.Add = {Sat.UTCGregorian, Sat.X, Sat.Y, Sat.Z, Sat.VX, "
+         "Sat.VY, Sat.VZ, Sat.Earth.SMA, Sat.Earth.ECC, Sat.EarthMJ2000Eq.INC, "
+         "Sat.Earth.Altitude, Sat.Earth.Latitude, Sat.Earth.Longitude};\n" +
+         ONE_DAY;
+   }
+
+   std::string EphemerisScript(const std::string &format,
+                               const std::string &fileName)
+   {
+      return LEO_CONFIGURATION +
+         "Create EphemerisFile Ephem;\n"
+         "Ephem.Spacecraft = Sat;\n"
+         "Ephem.Filename = '" + OutputFile(fileName) + "';\n"
+         "Ephem.FileFormat = " + format + ";\n"
+         "Ephem.EpochFormat = UTCGregorian;\n"
+         "Ephem.InitialEpoch = InitialSpacecraftEpoch;\n"
+         "Ephem.FinalEpoch = FinalSpacecraftEpoch;\n"
+         "Ephem.StepSize = IntegratorSteps;\n"
+         "Ephem.CoordinateSystem = EarthMJ2000Eq;\n" +
+         ONE_DAY;
+   }
+
+
+   //---------------------------------------------------------------------------
+   // Event location
+   //---------------------------------------------------------------------------
+   std::string ContactScript(const std::string &method)
+   {
+      return LEO_CONFIGURATION +
+         "Create GroundStation Station1;\n"
+         "Station1.StateType = Spherical;\n"
+         "Station1.Location1 = 28.5;\n"
+         "Station1.Location2 = 279.4;\n"
+         "Create GroundStation Station2;\n"
+         "Station2.StateType = Spherical;\n"
+         "Station2.Location1 = 40.4;\n"
+         "Station2.Location2 = 355.8;\n"
+         "Create GroundStation Station3;\n"
+         "Station3.StateType = Spherical;\n"
+         "Station3.Location1 = -35.4;\n"
+         "Station3.Location2 = 148.9;\n"
+         "Create ContactLocator Contacts;\n"
+         "Contacts.Target = Sat;\n"
+         "Contacts.Filename = '" + OutputFile("gmat_bench_contacts.txt") +
+         "';\n"
+         "Contacts.Observers = {Station1, Station2, Station3};\n"
+         "Contacts.UseLightTimeDelay = true;\n"
+         "Contacts.UseStellarAberration = true;\n"
+         "Contacts.RunMode = Automatic;\n"
+         "Contacts.UseEntireInterval = true;\n"
+         "Contacts.SearchMethod = " + method + ";\n" +
+         ONE_DAY;
+   }
+
+   std::string EclipseScript(const std::string &method)
+   {
+      return LEO_CONFIGURATION +
+         "Create EclipseLocator Eclipses;\n"
+         "Eclipses.Spacecraft = Sat;\n"
+         "Eclipses.Filename = '" + OutputFile("gmat_bench_eclipses.txt") +
+         "';\n"
+         "Eclipses.OccultingBodies = {Earth, Luna};\n"
+         "Eclipses.EclipseTypes = {'Umbra', 'Penumbra', 'Antumbra'};\n"
+         "Eclipses.UseLightTimeDelay = true;\n"
+         "Eclipses.UseStellarAberration = true;\n"
+         "Eclipses.RunMode = Automatic;\n"
+         "Eclipses.UseEntireInterval = true;\n"
+         "Eclipses.SearchMethod = " + method + ";\n" +
+         ONE_DAY;
+   }
+
+
+   //---------------------------------------------------------------------------
+   // Batch estimation
+   //---------------------------------------------------------------------------
+
+   /// Spacecraft, stations and tracking hardware of the range and range rate
+   /// estimation sample
+   std::string TrackingConfiguration(bool biasSolveFor)
+   {
+      std::stringstream s;
+      const char *sats[] = { "SimSat", "EstSat" };
+      for (Integer i = 0; i < 2; ++i)
+      {
+         std::string sc = sats[i];
+         s << "Create Spacecraft " << sc << ";\n"
+           << sc << ".DateFormat = UTCGregorian;\n"
+           << sc << ".Epoch = '10 Jun 2010 00:00:00.000';\n"
+           << sc << ".CoordinateSystem = EarthMJ2000Eq;\n"
+           << sc << ".DisplayStateType = Cartesian;\n"
+           << sc << ".X = " << (i == 0 ? "576.869556" : "576.8") << ";\n"
+           << sc << ".Y = " << (i == 0 ? "-5701.142761" : "-5701.1") << ";\n"
+           << sc << ".Z = " << (i == 0 ? "-4170.593691" : "-4170.5") << ";\n"
+           << sc << ".VX = -1.76450794;\n"
+           << sc << ".VY = 4.18128798;\n"
+           << sc << ".VZ = -5.96578986;\n"
+           << sc << ".DryMass = 850;\n"
+           << sc << ".Id = 'LEOSat';\n"
+           << sc << ".AddHardware = {Transponder1, SpacecraftAntenna};\n";
+      }
+      // Nutation at every epoch, as for precise orbit determination; the
+      // batch estimator only models observations concurrently in that case
+      s << "Earth.NutationUpdateInterval = 0;\n"
+        << "EstSat.SolveFors = {CartesianState};\n"
+        << "Create Antenna SpacecraftAntenna;\n"
+        << "Create Transponder Transponder1;\n"
+        << "Transponder1.PrimaryAntenna = SpacecraftAntenna;\n"
+        << "Transponder1.HardwareDelay = 0.00005;\n"
+        << "Transponder1.TurnAroundRatio = '240/221';\n"
+        << "Create Transmitter Transmitter1;\n"
+        << "Create Antenna Antenna1;\n"
+        << "Create Receiver Receiver1;\n"
+        << "Transmitter1.PrimaryAntenna = Antenna1;\n"
+        << "Transmitter1.Frequency = 2067.5;\n"
+        << "Receiver1.PrimaryAntenna = Antenna1;\n";
+
+      const char *stations[] = { "GDS", "CAN", "MAD" };
+      const char *locations[] = {
+            "-2353.621251", "-4641.341542", "3677.052370",
+            "-4461.083514", "2682.281745", "-3674.570392",
+            "4849.519988", "-360.641653", "4114.504590" };
+      for (Integer i = 0; i < 3; ++i)
+      {
+         std::string gs = stations[i];
+         s << "Create GroundStation " << gs << ";\n"
+           << gs << ".CentralBody = Earth;\n"
+           << gs << ".StateType = Cartesian;\n"
+           << gs << ".HorizonReference = Ellipsoid;\n"
+           << gs << ".Location1 = " << locations[3 * i] << ";\n"
+           << gs << ".Location2 = " << locations[3 * i + 1] << ";\n"
+           << gs << ".Location3 = " << locations[3 * i + 2] << ";\n"
+           << gs << ".Id = '" << gs << "';\n"
+           << gs << ".AddHardware = {Transmitter1, Receiver1, Antenna1};\n"
+           << gs << ".MinimumElevationAngle = 10;\n"
+           << gs << ".ErrorModels = {" << gs << "Range, " << gs
+           << "RangeRate};\n"
+           << "Create ErrorModel " << gs << "Range;\n"
+           << gs << "Range.Type = 'Range';\n"
+           << gs << "Range.NoiseSigma = 0.010;\n"
+           << gs << "Range.Bias = 0.0;\n"
+           << gs << "Range.SolveFors = {" << (biasSolveFor ? "Bias" : "")
+           << "};\n"
+           << "Create ErrorModel " << gs << "RangeRate;\n"
+           << gs << "RangeRate.Type = 'RangeRate';\n"
+           << gs << "RangeRate.NoiseSigma = 0.00001;\n"
+           << gs << "RangeRate.Bias = 0.0;\n"
+           << gs << "RangeRate.SolveFors = {};\n";
+      }
+
+      s << "Create ForceModel ODProp_ForceModel;\n"
+        << "ODProp_ForceModel.CentralBody = Earth;\n"
+        << "ODProp_ForceModel.PointMasses = {Earth};\n"
+        << "ODProp_ForceModel.Drag = None;\n"
+        << "ODProp_ForceModel.SRP = Off;\n"
+        << "ODProp_ForceModel.ErrorControl = None;\n"
+        << "Create Propagator ODProp;\n"
+        << "ODProp.FM = ODProp_ForceModel;\n"
+        << "ODProp.Type = 'RungeKutta56';\n"
+        << "ODProp.InitialStepSize = 60;\n"
+        << "ODProp.Accuracy = 1e-13;\n"
+        << "ODProp.MinStep = 0;\n"
+        << "ODProp.MaxStep = 60;\n"
+        << "ODProp.MaxStepAttempts = 50;\n";
+      return s.str();
+   }
+
+   std::string TrackingFileSet(const std::string &name, const std::string &sc,
+                               const std::string &fileName)
+   {
+      std::stringstream s;
+      s << "Create TrackingFileSet " << name << ";\n";
+      const char *stations[] = { "GDS", "CAN", "MAD" };
+      for (Integer i = 0; i < 3; ++i)
+         s << name << ".AddTrackingConfig = {{" << stations[i] << ", " << sc
+           << ", " << stations[i] << "}, 'Range', 'RangeRate'};\n";
+      s << name << ".FileName = {'" << OutputFile(fileName) << "'};\n"
+        << name << ".UseLightTime = True;\n"
+        << name << ".UseRelativityCorrection = False;\n"
+        << name << ".UseETminusTAI = False;\n"
+        << name << ".SimRangeModuloConstant = 67108864;\n"
+        << name << ".SimDopplerCountInterval = 10.;\n";
+      return s.str();
+   }
+
+   const std::string TEXT_DATA   = "gmat_bench_range.gmd";
+   const std::string BINARY_DATA = "gmat_bench_range.gmb";
+   const std::string TDM_DATA    = "gmat_bench_range.tdm";
+
+   /**
+    * Simulates two days of range and range rate data into a GMATInternal and
+    * a GMATBinary file, once per process.
+    */
+   void SimulateTrackingData()
+   {
+      static bool simulated = false;
+      if (simulated)
+         return;
+
+      std::stringstream s;
+      s << TrackingConfiguration(false)
+        << TrackingFileSet("simText", "SimSat", TEXT_DATA)
+        << TrackingFileSet("simBinary", "SimSat", BINARY_DATA);
+      const char *names[] = { "simulateText", "simulateBinary" };
+      const char *sets[] = { "simText", "simBinary" };
+      for (Integer i = 0; i < 2; ++i)
+         s << "Create Simulator " << names[i] << ";\n"
+           << names[i] << ".AddData = {" << sets[i] << "};\n"
+           << names[i] << ".EpochFormat = 'UTCGregorian';\n"
+           << names[i] << ".InitialEpoch = '10 Jun 2010 00:00:00.000';\n"
+           << names[i] << ".FinalEpoch = '12 Jun 2010 00:00:00.000';\n"
+           << names[i] << ".MeasurementTimeStep = 60;\n"
+           << names[i] << ".Propagator = ODProp;\n"
+           // Without noise the two files hold the same observations
+           << names[i] << ".AddNoise = Off;\n";
+      s << "BeginMissionSequence;\n"
+        << "RunSimulator simulateText;\n"
+        << "RunSimulator simulateBinary;\n";
+
+      ScriptBenchmark::Interpret(s.str());
+      ScriptBenchmark::RunMission();
+      simulated = true;
+   }
+
+   /**
+    * One iteration of the batch estimator on the simulated data.
+    */
+   class BatchEstimatorBenchmark : public ScriptBenchmark
+   {
+   public:
+      /**
+       * @param label     Name of the variant
+       * @param fileName  The tracking data file
+       * @param options   Extra BatchEstimator settings, "bat.Field = value;"
+       * @param biases    Solve for the station range biases
+       */
+      BatchEstimatorBenchmark(const std::string &label,
+            const std::string &fileName, const std::string &options,
+            bool biases) :
+         ScriptBenchmark("BatchEstimator/RangeAndRangeRate/" + label,
+               "estimation", Script(fileName, options, biases), "iteration")
+      {
+      }
+
+      virtual void Setup()
+      {
+         SimulateTrackingData();
+         ScriptBenchmark::Setup();
+      }
+
+   private:
+      static std::string Script(const std::string &fileName,
+            const std::string &options, bool biases)
+      {
+         return TrackingConfiguration(biases) +
+            TrackingFileSet("estData", "EstSat", fileName) +
+            "Create BatchEstimator bat;\n"
+            "bat.ShowProgress = False;\n"
+            "bat.Measurements = {estData};\n"
+            "bat.AbsoluteTol = 0.0001;\n"
+            "bat.RelativeTol = 0.001;\n"
+            "bat.MaximumIterations = 1;\n"
+            "bat.MaxConsecutiveDivergences = 3;\n"
+            "bat.Propagator = ODProp;\n"
+            "bat.ShowAllResiduals = Off;\n"
+            "bat.OLSEInitialRMSSigma = 1000;\n"
+            "bat.OLSEMultiplicativeConstant = 3;\n"
+            "bat.OLSEAdditiveConstant = 0;\n"
+            "bat.InversionAlgorithm = 'Internal';\n"
+            "bat.EstimationEpoch = 'FromParticipants';\n"
+            "bat.ReportStyle = 'Normal';\n"
+            "bat.ReportFile = '" + OutputFile("gmat_bench_batch.txt") + "';\n" +
+            options +
+            "BeginMissionSequence;\n"
+            "RunEstimator bat;\n";
+      }
+   };
+
+
+#ifdef GMAT_BENCH_ESTIMATION
+   //---------------------------------------------------------------------------
+   // Tracking data reads
+   //---------------------------------------------------------------------------
+
+   /**
+    * Writes a CCSDS TDM file of two way range records at one second spacing.
+    *
+    * No schema location is given, so the reader parses it without validation.
+    */
+   void WriteTdmFile(const std::string &fileName, Integer records)
+   {
+      std::ofstream tdm(fileName.c_str());
+      if (!tdm.is_open())
+         throw BenchmarkException("Unable to write the TDM file " + fileName);
+
+      tdm << "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+          << "<tdm id=\"CCSDS_TDM_VERS\" version=\"1.0\">\n"
+          << "<header>\n"
+          << "  <CREATION_DATE>2026-10-17T00:00:00</CREATION_DATE>\n"
+          << "  <ORIGINATOR>GMAT</ORIGINATOR>\n"
+          << "</header>\n"
+          << "<body>\n<segment>\n<metadata>\n"
+          << "  <TIME_SYSTEM>UTC</TIME_SYSTEM>\n"
+          << "  <PARTICIPANT_1>GDS</PARTICIPANT_1>\n"
+          << "  <PARTICIPANT_2>LEOSat</PARTICIPANT_2>\n"
+          << "  <MODE>SEQUENTIAL</MODE>\n"
+          << "  <PATH>1,2,1</PATH>\n"
+          << "  <RANGE_UNITS>km</RANGE_UNITS>\n"
+          << "</metadata>\n<data>\n";
+
+      tdm << std::fixed << std::setprecision(6);
+      for (Integer i = 0; i < records; ++i)
+      {
+         Integer day = 10 + i / 86400, secs = i % 86400;
+         tdm << "<observation><EPOCH>2010-06-"
+             << std::setw(2) << std::setfill('0') << day << "T"
+             << std::setw(2) << secs / 3600 << ":"
+             << std::setw(2) << (secs / 60) % 60 << ":"
+             << std::setw(2) << secs % 60 << std::setfill(' ')
+             << "</EPOCH><RANGE>"
+             << 2000.0 + 1500.0 * std::sin(i * 1.0e-3)
+             << "</RANGE></observation>\n";
+      }
+      tdm << "</data>\n</segment>\n</body>\n</tdm>\n";
+   }
+
+   /**
+    * Reads every observation of a tracking data file through an ObType.
+    */
+   class ObTypeReadBenchmark : public Benchmark
+   {
+   public:
+      ObTypeReadBenchmark(const std::string &obTypeName,
+                          const std::string &fileName) :
+         Benchmark("ObType/ReadObservation/" + obTypeName, "estimation",
+                   true),
+         typeName    (obTypeName),
+         file        (fileName)
+      {
+         unit = "record";
+      }
+
+      virtual void Setup()
+      {
+         if (typeName == "TDM")
+            WriteTdmFile(OutputFile(file), TDM_RECORDS);
+         else
+            SimulateTrackingData();
+         operations = ReadAll();
+         if (operations <= 0.0)
+            throw BenchmarkException("No observations were read from " +
+                  OutputFile(file));
+      }
+
+      virtual void Run()
+      {
+         ReadAll();
+      }
+
+   private:
+      static const Integer TDM_RECORDS = 100000;
+
+      std::string typeName;
+      std::string file;
+
+      Integer ReadAll()
+      {
+         ObType *reader =
+               Moderator::Instance()->CreateObType(typeName, "");
+         if (reader == NULL)
+            throw BenchmarkException("The tracking data type " + typeName +
+                  " is not available");
+
+         Integer count = 0;
+         try
+         {
+            reader->SetStreamName(OutputFile(file));
+            reader->Initialize();
+            if (!reader->Open(true, false))
+               throw BenchmarkException("Unable to open " + OutputFile(file));
+            while (reader->ReadObservation() != NULL)
+               ++count;
+            reader->Close();
+         }
+         catch (...)
+         {
+            delete reader;
+            throw;
+         }
+         delete reader;
+         return count;
+      }
+   };
+
+
+   /**
+    * Conversion of the GMATInternal file to the binary format.
+    */
+   class BinaryConvertBenchmark : public Benchmark
+   {
+   public:
+      BinaryConvertBenchmark() :
+         Benchmark("BinaryObType/Convert/GMATInternal", "estimation", true)
+      {
+         unit = "record";
+      }
+
+      virtual void Setup()
+      {
+         SimulateTrackingData();
+         operations = Convert();
+      }
+
+      virtual void Run()
+      {
+         Convert();
+      }
+
+   private:
+      Integer Convert()
+      {
+         ObType *source =
+               Moderator::Instance()->CreateObType("GMATInternal", "");
+         if (source == NULL)
+            throw BenchmarkException("The GMATInternal data type is not "
+                  "available");
+
+         Integer count = 0;
+         try
+         {
+            source->SetStreamName(OutputFile(TEXT_DATA));
+            source->Initialize();
+            count = BinaryObType::Convert(source,
+                  OutputFile("gmat_bench_converted.gmb"));
+         }
+         catch (...)
+         {
+            delete source;
+            throw;
+         }
+         delete source;
+         return count;
+      }
+   };
+#endif
+}
+
+
+//------------------------------------------------------------------------------
+// void AddMissionBenchmarks(BenchmarkRunner &runner)
+//------------------------------------------------------------------------------
+void GmatBench::AddMissionBenchmarks(BenchmarkRunner &runner)
+{
+   runner.Add(new InterpretBenchmark());
+
+   runner.Add(new ScriptBenchmark("Propagate/OneDay", "mission",
+         LEO_CONFIGURATION + ONE_DAY, "day"));
+   runner.Add(new ScriptBenchmark("ReportFile/OneDay", "mission",
+         ReportScript(), "day"));
+   runner.Add(new ScriptBenchmark("EphemerisFile/CCSDS-OEM/OneDay", "mission",
+         EphemerisScript("CCSDS-OEM", "gmat_bench_ephem.oem"), "day"));
+   runner.Add(new ScriptBenchmark("EphemerisFile/STK-TimePosVel/OneDay",
+         "mission", EphemerisScript("STK-TimePosVel", "gmat_bench_ephem.e"),
+         "day"));
+
+   const char *methods[] = { "Native", "SPICE" };
+   for (Integer i = 0; i < 2; ++i)
+   {
+      std::string method = methods[i];
+      runner.Add(new ScriptBenchmark("ContactLocator/" + method + "/OneDay",
+            "mission", ContactScript(method), "day"));
+      runner.Add(new ScriptBenchmark("EclipseLocator/" + method + "/OneDay",
+            "mission", EclipseScript(method), "day"));
+   }
+
+   runner.Add(new BatchEstimatorBenchmark("Text", TEXT_DATA, "", false));
+   runner.Add(new BatchEstimatorBenchmark("Binary", BINARY_DATA, "", false));
+   runner.Add(new BatchEstimatorBenchmark("Binary/Parallel", BINARY_DATA,
+         "bat.ParallelMeasurementModeling = true;\n"
+         "bat.ParallelAccumulation = true;\n", false));
+   runner.Add(new BatchEstimatorBenchmark("Biases/Dense", BINARY_DATA, "",
+         true));
+   runner.Add(new BatchEstimatorBenchmark("Biases/Sparse", BINARY_DATA,
+         "bat.SparseNormalEquations = true;\n", true));
+
+#ifdef GMAT_BENCH_ESTIMATION
+   runner.Add(new ObTypeReadBenchmark("GMATInternal", TEXT_DATA));
+   runner.Add(new ObTypeReadBenchmark("GMATBinary", BINARY_DATA));
+   runner.Add(new ObTypeReadBenchmark("TDM", TDM_DATA));
+   runner.Add(new BinaryConvertBenchmark());
+#endif
+}
@@ -0,0 +1,176 @@
+//$Id$
+//------------------------------------------------------------------------------
+//                               ScriptBenchmark
+//------------------------------------------------------------------------------
+// GMAT: General Mission Analysis Tool
+//
+// Copyright (c) 2002 - 2020 United States Government as represented by the
+// Administrator of the National Aeronautics and Space Administration.
+// All Other Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// You may not use this file except in compliance with the License.
+// You may obtain a copy of the License at:
+// http://www.apache.org/licenses/LICENSE-2.0.
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied.   See the License for the specific language
+// governing permissions and limitations under the License.
+//
+// Author: GMAT Development Team
+// Created: 2026/10/17
+//
+/**
+ * Implements the benchmark that times the run of a scripted mission.
+ */
+//------------------------------------------------------------------------------
+
+#include "ScriptBenchmark.hpp"
+#include "BenchmarkException.hpp"
+#include "Moderator.hpp"
+#include "GmatCommand.hpp"
+#include "PropSetup.hpp"
+#include <sstream>
+
+
+//------------------------------------------------------------------------------
+// ScriptBenchmark(const std::string &benchName, const std::string &benchGroup,
+//       const std::string &scriptText, const std::string &unitName,
+//       Real unitCount)
+//------------------------------------------------------------------------------
+/**
+ * Constructor
+ *
+ * @param benchName  The unique benchmark name
+ * @param benchGroup The area the benchmark covers
+ * @param scriptText The mission script
+ * @param unitName   Name of the operations counted in one run
+ * @param unitCount  Operations in one run, e.g. the propagated days
+ */
+//------------------------------------------------------------------------------
+ScriptBenchmark::ScriptBenchmark(const std::string &benchName,
+      const std::string &benchGroup, const std::string &scriptText,
+      const std::string &unitName, Real unitCount) :
+   Benchmark   (benchName, benchGroup, true),
+   script      (scriptText)
+{
+   unit       = unitName;
+   operations = unitCount;
+}
+
+
+//------------------------------------------------------------------------------
+// ~ScriptBenchmark()
+//------------------------------------------------------------------------------
+ScriptBenchmark::~ScriptBenchmark()
+{
+}
+
+
+//------------------------------------------------------------------------------
+// void Setup()
+//------------------------------------------------------------------------------
+void ScriptBenchmark::Setup()
+{
+   Interpret(script);
+}
+
+
+//------------------------------------------------------------------------------
+// void Run()
+//------------------------------------------------------------------------------
+void ScriptBenchmark::Run()
+{
+   RunMission();
+}
+
+
+//------------------------------------------------------------------------------
+// void Interpret(const std::string &scriptText)
+//------------------------------------------------------------------------------
+/**
+ * Replaces the configured objects and mission sequence with a script.
+ *
+ * @param scriptText The script
+ */
+//------------------------------------------------------------------------------
+void ScriptBenchmark::Interpret(const std::string &scriptText)
+{
+   std::istringstream stream(scriptText);
+   if (!Moderator::Instance()->InterpretScript(&stream, true))
+      throw BenchmarkException("The benchmark script did not interpret; see "
+            "the GMAT log for details");
+}
+
+
+//------------------------------------------------------------------------------
+// void RunMission()
+//------------------------------------------------------------------------------
+/**
+ * Runs the interpreted mission.
+ */
+//------------------------------------------------------------------------------
+void ScriptBenchmark::RunMission()
+{
+   Integer status = Moderator::Instance()->RunMission();
+   if (status < 0)
+   {
+      std::stringstream msg;
+      msg << "The benchmark mission failed with status " << status
+          << "; see the GMAT log for details";
+      throw BenchmarkException(msg.str());
+   }
+}
+
+
+//------------------------------------------------------------------------------
+// GmatCommand* FindCommand(const std::string &typeName)
+//------------------------------------------------------------------------------
+/**
+ * Finds the first command of a type in the mission sequence.
+ *
+ * @param typeName The command type, e.g. "Propagate"
+ *
+ * @return The command, or NULL if there is none
+ */
+//------------------------------------------------------------------------------
+GmatCommand* ScriptBenchmark::FindCommand(const std::string &typeName)
+{
+   GmatCommand *cmd = Moderator::Instance()->GetFirstCommand();
+   while (cmd != NULL)
+   {
+      if (cmd->GetTypeName() == typeName)
+         return cmd;
+      cmd = cmd->GetNext();
+   }
+   return NULL;
+}
+
+
+//------------------------------------------------------------------------------
+// PropSetup* GetPropagateClone(Integer index)
+//------------------------------------------------------------------------------
+/**
+ * Returns a propagator of the first Propagate command after a mission run.
+ *
+ * The command keeps its PropSetups once the run completes, with the force
+ * model initialized for the propagated spacecraft, so their derivatives can be
+ * evaluated directly.
+ *
+ * @param index Index of the PropSetup in the command
+ *
+ * @return The PropSetup
+ */
+//------------------------------------------------------------------------------
+PropSetup* ScriptBenchmark::GetPropagateClone(Integer index)
+{
+   GmatCommand *cmd = FindCommand("Propagate");
+   if (cmd == NULL)
+      throw BenchmarkException("The benchmark mission has no Propagate command");
+
+   PropSetup *prop = (PropSetup*)cmd->GetClone(index);
+   if ((prop == NULL) || (prop->GetODEModel() == NULL))
+      throw BenchmarkException("The Propagate command has no force model");
+   return prop;
+}
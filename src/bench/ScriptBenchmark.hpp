@@ -0,0 +1,67 @@
+//$Id$
+//------------------------------------------------------------------------------
+//                               ScriptBenchmark
+//------------------------------------------------------------------------------
+// GMAT: General Mission Analysis Tool
+//
+// Copyright (c) 2002 - 2020 United States Government as represented by the
+// Administrator of the National Aeronautics and Space Administration.
+// All Other Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// You may not use this file except in compliance with the License.
+// You may obtain a copy of the License at:
+// http://www.apache.org/licenses/LICENSE-2.0.
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied.   See the License for the specific language
+// governing permissions and limitations under the License.
+//
+// Author: GMAT Development Team
+// Created: 2026/10/17
+//
+/**
+ * Declares the benchmark that times the run of a scripted mission.
+ */
+//------------------------------------------------------------------------------
+#ifndef ScriptBenchmark_hpp
+#define ScriptBenchmark_hpp
+
+#include "Benchmark.hpp"
+
+class GmatCommand;
+class PropSetup;
+
+/**
+ * Macro benchmark timing Moderator::RunMission() on a script.
+ *
+ * The script is interpreted by Setup(), so only the mission run is timed:
+ * sandbox initialization, the mission sequence and its output.  The helpers
+ * are also used by micro benchmarks that take initialized objects from the
+ * sandbox of a short mission.
+ */
+class ScriptBenchmark : public Benchmark
+{
+public:
+   ScriptBenchmark(const std::string &benchName,
+                   const std::string &benchGroup,
+                   const std::string &scriptText,
+                   const std::string &unitName = "run",
+                   Real unitCount = 1.0);
+   virtual ~ScriptBenchmark();
+
+   virtual void         Setup();
+   virtual void         Run();
+
+   static void          Interpret(const std::string &scriptText);
+   static void          RunMission();
+   static GmatCommand*  FindCommand(const std::string &typeName);
+   static PropSetup*    GetPropagateClone(Integer index = 0);
+
+protected:
+   /// The mission script
+   std::string          script;
+};
+
+#endif // ScriptBenchmark_hpp
@@ -45,7 +45,7 @@
 template <class T>
 ArrayTemplate<T>::ArrayTemplate()
   :
-  elementD((T*) 0), sizeD(0), isSizedD(false)
+  elementD((T*) 0), sizeD(0), isSizedD(false), ownsElementsD(true)
 {
 }
 
@@ -132,6 +132,43 @@ ArrayTemplate<T>::ArrayTemplate(const ArrayTemplate<T> &array)
    }
 }
 
+//------------------------------------------------------------------------------
+//  <move constructor>
+//  ArrayTemplate(ArrayTemplate<T> &&array)
+//
+//  Notes: Takes over the elements of array, leaving it unsized.  Elements held
+//         in the storage of a fixed size class are copied.
+//------------------------------------------------------------------------------
+template <class T>
+ArrayTemplate<T>::ArrayTemplate(ArrayTemplate<T> &&array)
+  :
+  elementD((T*) 0), sizeD(0), isSizedD(false), ownsElementsD(true)
+{
+   if (array.IsSized() == false)
+   {
+       throw ArrayTemplateExceptions::UnsizedArray();
+   }
+
+   if (array.ownsElementsD)
+   {
+      elementD = array.elementD;
+      sizeD    = array.sizeD;
+      isSizedD = true;
+
+      array.elementD = (T*) 0;
+      array.sizeD    = 0;
+      array.isSizedD = false;
+   }
+   else
+   {
+      init(array.sizeD);
+      for (int i = 0; i < sizeD; i++)
+      {
+         elementD[i] = array.elementD[i];
+      }
+   }
+}
+
 //------------------------------------------------------------------------------
 //  <destructor>
 //  ~ArrayTemplate()
@@ -139,7 +176,8 @@ ArrayTemplate<T>::ArrayTemplate(const ArrayTemplate<T> &array)
 template <class T>
 ArrayTemplate<T>::~ArrayTemplate()
 {
-   delete [] elementD;
+   if (ownsElementsD)
+      delete [] elementD;
 }
 
 //------------------------------------------------------------------------------
@@ -173,6 +211,49 @@ const ArrayTemplate<T>& ArrayTemplate<T>::operator=(
    return *this;
 }
 
+//------------------------------------------------------------------------------
+//  const ArrayTemplate<T>& operator=(ArrayTemplate<T> &&array)
+//
+//  Notes: Exchanges the element storage when both arrays own it, and copies
+//         otherwise.  The size rules are those of the copy assignment.
+//------------------------------------------------------------------------------
+template <class T>
+const ArrayTemplate<T>& ArrayTemplate<T>::operator=(ArrayTemplate<T> &&array)
+{
+   if (this == &array)
+      return *this;
+
+   if (array.IsSized() == false)
+   {
+       throw ArrayTemplateExceptions::UnsizedArray();
+   }
+
+   if (!ownsElementsD || !array.ownsElementsD)
+      return operator=(static_cast<const ArrayTemplate<T>&>(array));
+
+   if ((isSizedD == true) && (sizeD != array.sizeD))
+   {
+      throw ArrayTemplateExceptions::DimensionError();
+   }
+
+   T *previous = elementD;
+   bool wasSized = isSizedD;
+
+   elementD = array.elementD;
+   sizeD    = array.sizeD;
+   isSizedD = true;
+
+   // array takes the old elements, and is deleted or reused by its owner
+   array.elementD = previous;
+   if (wasSized == false)
+   {
+      array.sizeD    = 0;
+      array.isSizedD = false;
+   }
+
+   return *this;
+}
+
 //------------------------------------------------------------------------------
 //  bool operator==(const ArrayTemplate<T> &array) const
 //------------------------------------------------------------------------------
@@ -298,17 +379,24 @@ template <class T>
 void
 ArrayTemplate<T>::SetSize(int size)
 {
+   if (size < 0)
+   {
+       throw ArrayTemplateExceptions::IllegalSize();
+   }
+
    if (isSizedD == true)
    {
+      // Fixed size storage is kept when the size does not change, and
+      // replaced by allocated storage when it does
+      if (!ownsElementsD && (size == sizeD))
+         return;
+
        //throw ArrayTemplateExceptions::ArrayAlreadySized();
       // wcs - 2005.02.01 - need to be able to resize
-      delete [] elementD;
+      if (ownsElementsD)
+         delete [] elementD;
    }
 
-   if (size < 0)
-   {
-       throw ArrayTemplateExceptions::IllegalSize();
-   }
    init(size);   
 }
 
@@ -428,4 +516,21 @@ ArrayTemplate<T>::init(int s)
        elementD = new T[sizeD];
    }
    isSizedD = true;
+   ownsElementsD = true;
+}
+
+//------------------------------------------------------------------------------
+//  void initFixed(T *storage, int s)
+//
+//  Notes: Used by fixed size derived classes, which hold their s elements in
+//         storage that lives as long as the object and is not deleted here.
+//------------------------------------------------------------------------------
+template <class T>
+void
+ArrayTemplate<T>::initFixed(T *storage, int s)
+{
+   elementD = storage;
+   sizeD = s;
+   isSizedD = true;
+   ownsElementsD = false;
 }
@@ -84,11 +84,13 @@ public:
                                                          // allowed by compiler
     ArrayTemplate(Integer sizeOfArray, const T* array); // copy from c style array  
     ArrayTemplate(const ArrayTemplate<T> &array); 
+    ArrayTemplate(ArrayTemplate<T> &&array);
     virtual ~ArrayTemplate();
    
     // operators
    
     const ArrayTemplate<T>& operator=(const ArrayTemplate<T> &array); 
+    const ArrayTemplate<T>& operator=(ArrayTemplate<T> &&array);
     bool operator==(const ArrayTemplate<T> &array) const;
     bool operator!=(const ArrayTemplate<T> &array) const;
     virtual T&        operator()(Integer index);          
@@ -107,10 +109,13 @@ public:
  
 protected:
     void init(Integer s);      // used internally for initialization
+    void initFixed(T *storage, Integer s);  // uses storage of a derived class
 
     T    *elementD;
     Integer  sizeD;
     bool isSizedD;
+    /// false when elementD is storage held by a fixed size derived class
+    bool ownsElementsD;
 
 private:
 };
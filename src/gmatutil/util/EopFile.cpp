@@ -45,6 +45,7 @@
 #include "RealUtilities.hpp"
 #include "MessageInterface.hpp"
 #include "TimeSystemConverter.hpp"
+#include "SharedDataLock.hpp"
 
 //#define DEBUG_OFFSET
 //#define DEBUG_EOP_READ
@@ -54,6 +55,7 @@
 // static data
 //------------------------------------------------------------------------------
 const Integer EopFile::MAX_TABLE_SIZE = 50405;  // up to year >= 2100
+std::atomic<Integer> EopFile::dataVersion(0);
 
 //------------------------------------------------------------------------------
 // public methods
@@ -336,6 +338,7 @@ void EopFile::Initialize()
    previousIndex = lastIndex;
    
    isInitialized = true;
+   ++dataVersion;
 
 //   // Set the pointer on the GmatGlobal
 //   GmatGlobal::Instance()->SetEopFile(this);
@@ -354,6 +357,7 @@ void EopFile::ResetEopFile(const std::string &toName,
       eopFileName   = toName;
       eopFType      = toType;
       isInitialized = false;
+      ++dataVersion;
    }
 }
 
@@ -388,6 +392,9 @@ Real EopFile::GetUt1UtcOffset(const Real taiMjd)
 {
    //MessageInterface::ShowMessage("===> GetUt1UtcOffset() utcMjd=%f\n", utcMjd);
    
+   // The last offset and index are shared by every user of the file
+   SharedDataLock::Guard guard;
+
    if (!isInitialized)  Initialize();
    
    if (lastTaiMjd == taiMjd) return lastOffset;
@@ -511,6 +518,8 @@ Rmatrix EopFile::GetPolarMotionData()
 bool EopFile::GetPolarMotionAndLod(const GmatTime &forUtcMjd, Real &xval, Real  &yval,
                                    Real &lodval)
 {
+   SharedDataLock::Guard guard;
+
    if (!isInitialized)  Initialize();
    
    Integer i = 0;
@@ -637,3 +646,19 @@ void EopFile::GetTimeRange(Real& timeMin, Real& timeMax)
 
    //MessageInterface::ShowMessage("timeMin = %lf A1Mjd    timeMax = %lf A1Mjd\n", timeMin, timeMax);
 }
+
+
+//------------------------------------------------------------------------------
+// Integer GetDataVersion()
+//------------------------------------------------------------------------------
+/**
+ * Returns a counter that changes whenever an EopFile reads its file or is
+ * reset to a different one.
+ *
+ * @return the data version
+ */
+//------------------------------------------------------------------------------
+Integer EopFile::GetDataVersion()
+{
+   return dataVersion;
+}
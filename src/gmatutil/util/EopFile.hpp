@@ -37,6 +37,7 @@
 #include "utildefs.hpp"
 #include "Rmatrix.hpp"
 #include "Rvector.hpp"
+#include <atomic>
 
 
 class TimeSystemConverter;
@@ -83,10 +84,16 @@ public:
    virtual bool    GetPolarMotionAndLod(const GmatTime &forUtcMjd, Real &xval, Real  &yval,
                                         Real &lodval);
    void            GetTimeRange(Real& timeMin, Real &timeMax);
+   
+   // changes whenever any EopFile loads or switches its data
+   static Integer  GetDataVersion();
 
 protected:
 
    static const Integer MAX_TABLE_SIZE;
+   /// Incremented on each load or file change, so caches of values computed
+   /// from EOP data can tell when they are stale
+   static std::atomic<Integer> dataVersion;
 
    GmatEop::EopFileType eopFType;
    std::string          eopFileName;
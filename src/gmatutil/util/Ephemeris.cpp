@@ -30,17 +30,56 @@
 
 #include "Ephemeris.hpp"
 
-#include "LagrangeInterpolator.hpp"
 #include "HermiteInterpolator.hpp"
 #include "GmatConstants.hpp"           // For SECS_PER_DAY
 #include "UtilityException.hpp"
 #include "MessageInterface.hpp"
 
 #include <sstream>
+#include <algorithm>            // For upper_bound
 
 //#define TEST_HERMITE_INTERP
 
 
+//------------------------------------------------------------------------------
+// static functions
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+// bool SegmentHolds(const Ephemeris::Segment &segment,
+//       const GmatEpoch forEpoch)
+//------------------------------------------------------------------------------
+/**
+ * Checks if an epoch is in the half-open span [segStart, segEnd) of a segment
+ */
+//------------------------------------------------------------------------------
+static bool SegmentHolds(const Ephemeris::Segment &segment,
+      const GmatEpoch forEpoch)
+{
+   return (segment.segStart <= forEpoch) && (forEpoch < segment.segEnd);
+}
+
+//------------------------------------------------------------------------------
+// bool EpochBeforeSegment(const GmatEpoch forEpoch,
+//       const Ephemeris::Segment &segment)
+//------------------------------------------------------------------------------
+static bool EpochBeforeSegment(const GmatEpoch forEpoch,
+      const Ephemeris::Segment &segment)
+{
+   return forEpoch < segment.segStart;
+}
+
+//------------------------------------------------------------------------------
+// bool EpochBeforePoint(const GmatEpoch forEpoch,
+//       const Ephemeris::EphemPoint &point)
+//------------------------------------------------------------------------------
+static bool EpochBeforePoint(const GmatEpoch forEpoch,
+      const Ephemeris::EphemPoint &point)
+{
+   return forEpoch < point.theEpoch;
+}
+
+
 //------------------------------------------------------------------------------
 // Ephemeris()
 //------------------------------------------------------------------------------
@@ -58,6 +97,8 @@ Ephemeris::Ephemeris() :
    warnInterpolationDegradation  (true),
    useHermite                    (true)
 {
+   ResetLookup();
+
    #ifdef TEST_HERMITE_INTERP
       // Temporary code to test the Hermite interpolator
       interp = new HermiteInterpolator("", 3, 3);
@@ -128,6 +169,7 @@ Ephemeris::Ephemeris(const Ephemeris& ephem) :
    warnInterpolationDegradation  (true),
    useHermite                    (ephem.useHermite)
 {
+   ResetLookup();
 }
 
 //------------------------------------------------------------------------------
@@ -157,6 +199,7 @@ Ephemeris& Ephemeris::operator=(const Ephemeris& ephem)
       warnInterpolationDegradation = true;
       useHermite                   = ephem.useHermite;
       segmentStartTimes.clear();
+      ResetLookup();
    }
 
    return *this;
@@ -194,25 +237,59 @@ const RealArray& Ephemeris::GetSegmentTimes()
 Integer Ephemeris::FindSegment(const GmatEpoch forEpoch)
 {
    Integer retval = -1;
+   Integer count = theEphem.size();
 
-   for (UnsignedInt i = 0; i < theEphem.size(); ++i)
+   // Sequential access usually stays in the last segment or moves to the next
+   for (Integer i = lastSegment; (i >= 0) && (i < count) &&
+         (i <= lastSegment + 1); ++i)
    {
-      #ifdef DEBUG_INTERPOLATION
-         MessageInterface::ShowMessage("Checking if %.12lf is between %.12lf and %.12lf\n",
-               forEpoch, theEphem[i].segStart, theEphem[i].segEnd);
-      #endif
-
-      if ((theEphem[i].segStart <= forEpoch) && (forEpoch < theEphem[i].segEnd))
+      if (SegmentHolds(theEphem[i], forEpoch) &&
+          ((i == 0) || !SegmentHolds(theEphem[i-1], forEpoch)))
       {
          retval = i;
          break;
       }
+   }
 
-      // Special case: Only one point in the segment
-      if ((theEphem[i].segStart == forEpoch) && (forEpoch == theEphem[i].segEnd))
+   if ((retval == -1) && (count > 0))
+   {
+      // Last segment starting at or before the epoch
+      Integer i = std::upper_bound(theEphem.begin(), theEphem.end(), forEpoch,
+            EpochBeforeSegment) - theEphem.begin() - 1;
+      if ((i >= 0) && SegmentHolds(theEphem[i], forEpoch))
+      {
+         // Report the first segment holding the epoch
+         while ((i > 0) && SegmentHolds(theEphem[i-1], forEpoch))
+            --i;
          retval = i;
+      }
+   }
+
+   if (retval == -1)
+   {
+      // Not in a segment span: out of range, or a single point segment
+      for (UnsignedInt i = 0; i < theEphem.size(); ++i)
+      {
+         #ifdef DEBUG_INTERPOLATION
+            MessageInterface::ShowMessage("Checking if %.12lf is between %.12lf and %.12lf\n",
+                  forEpoch, theEphem[i].segStart, theEphem[i].segEnd);
+         #endif
+
+         if (SegmentHolds(theEphem[i], forEpoch))
+         {
+            retval = i;
+            break;
+         }
+
+         // Special case: Only one point in the segment
+         if ((theEphem[i].segStart == forEpoch) && (forEpoch == theEphem[i].segEnd))
+            retval = i;
+      }
    }
 
+   if (retval != -1)
+      lastSegment = retval;
+
    // Handle the last point on the ephemeris
    if (forEpoch == a1EndEpoch)
       retval = theEphem.size() - 1;
@@ -255,18 +332,46 @@ Integer Ephemeris::PointsInSegment(const Integer forSegment)
 //------------------------------------------------------------------------------
 Integer Ephemeris::IndexInSegment(const Integer segNum, const GmatEpoch forEpoch)
 {
-   Integer retval = -1;
+   const std::vector<EphemPoint> &points = theEphem[segNum].points;
+   Integer count = points.size();
 
-   Real diff = 9e99, temp;
-   for (UnsignedInt i = 0; i < theEphem[segNum].points.size(); ++i)
+   if (count == 0)
+      return -1;
+
+   // Find the last point at or before the epoch, checking the bracket used
+   // last time and the next one before searching
+   Integer below = -2;
+   if (segNum == lastPointSegment)
    {
-      temp = GmatMathUtil::Abs(theEphem[segNum].points[i].theEpoch - forEpoch);
-      if (temp < diff)
+      for (Integer i = lastPoint; (i >= 0) && (i < count) &&
+            (i <= lastPoint + 1); ++i)
       {
-         diff = temp;
-         retval = i;
+         if ((points[i].theEpoch <= forEpoch) &&
+             ((i + 1 == count) || (forEpoch < points[i+1].theEpoch)))
+         {
+            below = i;
+            break;
+         }
       }
    }
+   if (below == -2)
+      below = std::upper_bound(points.begin(), points.end(), forEpoch,
+            EpochBeforePoint) - points.begin() - 1;
+
+   lastPointSegment = segNum;
+   lastPoint = below;
+
+   // Pick the closer neighbor, taking the earlier point on a tie
+   Integer retval = below;
+   if (below < 0)
+      retval = 0;
+   else if ((below + 1 < count) && (points[below+1].theEpoch - forEpoch <
+         forEpoch - points[below].theEpoch))
+      retval = below + 1;
+
+   while ((retval > 0) &&
+          (points[retval-1].theEpoch == points[retval].theEpoch))
+      --retval;
 
    return retval;
 }
@@ -342,11 +447,12 @@ Rvector6 Ephemeris::InterpolatePoint(const GmatEpoch forEpoch)
 
       if (interp != NULL)
          delete interp;
+      interp = NULL;
+      // Lagrange interpolation evaluates the window directly
       if (useHermite)
          interp = new HermiteInterpolator("", 6, maxOrder);
-      else
-         interp = new LagrangeInterpolator("", 6, maxOrder);
       currentOrder = maxOrder;
+      windowSegment = -1;
    }
 
    if ((currentOrder < order) && warnInterpolationDegradation)
@@ -364,27 +470,64 @@ Rvector6 Ephemeris::InterpolatePoint(const GmatEpoch forEpoch)
    if (startIndex + currentOrder + 1 > theEphem[segNo].points.size())
       startIndex = theEphem[segNo].points.size() - currentOrder - 1;
 
-   interp->Clear();
-   for (UnsignedInt i = 0; i <= currentOrder; ++i)
-      interp->AddPoint(theEphem[segNo].points[startIndex+i].theEpoch,
-            theEphem[segNo].points[startIndex+i].posvel.GetDataVector());
+   const std::vector<EphemPoint> &points = theEphem[segNo].points;
 
-   // Use derivative data for problems with lower than 7th order polynomials
-   if ((useHermite) && (currentOrder < 7))
+   // Reload the window only when the propagation moves past it
+   if ((segNo != windowSegment) || (startIndex != windowStart) ||
+       (currentOrder != windowOrder) ||
+       (points[startIndex].theEpoch != windowFirstEpoch) ||
+       (points[startIndex+currentOrder].theEpoch != windowLastEpoch))
    {
-      Real vel[6];
-      for (UnsignedInt i = 0; i <= currentOrder; ++i)
+      #ifdef DEBUG_INTERPOLATION
+         MessageInterface::ShowMessage("Loading window at point %d of "
+               "segment %d\n", startIndex, segNo);
+      #endif
+
+      if (useHermite)
+      {
+         interp->Clear();
+         for (UnsignedInt i = 0; i <= currentOrder; ++i)
+            interp->AddPoint(points[startIndex+i].theEpoch,
+                  points[startIndex+i].posvel.GetDataVector());
+
+         // Use derivative data for problems with lower than 7th order polynomials
+         if (currentOrder < 7)
+         {
+            Real vel[6];
+            for (UnsignedInt i = 0; i <= currentOrder; ++i)
+            {
+               const Real *v = points[startIndex+i].posvel.GetDataVector();
+               for (Integer j = 0; j < 3; ++j)
+               {
+                  // Since independent variable is in days, scale velocity the same
+                  vel[j] = v[j+3] * GmatTimeConstants::SECS_PER_DAY;
+                  vel[j+3] = -9.999999999e99;
+               }
+               ((HermiteInterpolator*)interp)->AddDerivative(
+                     points[startIndex+i].theEpoch, vel);
+            }
+         }
+      }
+      else
       {
-         const Real *v = theEphem[segNo].points[startIndex+i].posvel.GetDataVector();
-         for (Integer j = 0; j < 3; ++j)
+         // Barycentric weights w_i = 1 / prod_{j != i} (t_i - t_j)
+         GmatEpoch t0 = points[startIndex].theEpoch;
+         baryWeights.assign(currentOrder + 1, 1.0);
+         for (Integer i = 0; i <= currentOrder; ++i)
          {
-            // Since independent variable is in days, scale velocity the same
-            vel[j] = v[j+3] * GmatTimeConstants::SECS_PER_DAY;
-            vel[j+3] = -9.999999999e99;
+            Real ti = points[startIndex+i].theEpoch - t0;
+            for (Integer j = 0; j <= currentOrder; ++j)
+               if (j != i)
+                  baryWeights[i] *= ti - (points[startIndex+j].theEpoch - t0);
+            baryWeights[i] = 1.0 / baryWeights[i];
          }
-         ((HermiteInterpolator*)interp)->AddDerivative(
-               theEphem[segNo].points[startIndex+i].theEpoch, vel);
       }
+
+      windowSegment    = segNo;
+      windowStart      = startIndex;
+      windowOrder      = currentOrder;
+      windowFirstEpoch = points[startIndex].theEpoch;
+      windowLastEpoch  = points[startIndex+currentOrder].theEpoch;
    }
 
    Real interpolents[6];
@@ -400,8 +543,175 @@ Rvector6 Ephemeris::InterpolatePoint(const GmatEpoch forEpoch)
    }
    else
    {
-      if (interp->Interpolate(forEpoch, interpolents))
+      if (InterpolateBarycentric(forEpoch, interpolents))
          retval.Set(interpolents);
    }
    return retval;
 }
+
+
+//------------------------------------------------------------------------------
+// void AddPoint(const GmatEpoch epoch, const Real *posvel)
+//------------------------------------------------------------------------------
+/**
+ * Appends a state to the ephem, for ephemerides built in memory
+ *
+ * Points are expected in increasing time order.  A point at or before the
+ * last one starts a new segment, so a state repeated at a maneuver epoch
+ * separates the arcs before and after the maneuver.
+ *
+ * @param epoch  A.1 epoch of the state
+ * @param posvel The position and velocity
+ */
+//------------------------------------------------------------------------------
+void Ephemeris::AddPoint(const GmatEpoch epoch, const Real *posvel)
+{
+   if (theEphem.empty() || (epoch <= theEphem.back().segEnd))
+   {
+      Segment seg;
+      seg.segStart = epoch;
+      seg.segEnd   = epoch;
+      theEphem.push_back(seg);
+      segmentStartTimes.push_back(epoch);
+   }
+
+   EphemPoint point;
+   point.theEpoch = epoch;
+   point.posvel.Set(posvel);
+   theEphem.back().points.push_back(point);
+   theEphem.back().segEnd = epoch;
+
+   if ((theEphem.size() == 1) && (theEphem[0].points.size() == 1))
+   {
+      a1StartEpoch = epoch;
+      a1EndEpoch   = epoch;
+   }
+   else
+   {
+      if (epoch < a1StartEpoch)
+         a1StartEpoch = epoch;
+      if (epoch > a1EndEpoch)
+         a1EndEpoch = epoch;
+   }
+}
+
+
+//------------------------------------------------------------------------------
+// void ClearPoints()
+//------------------------------------------------------------------------------
+/**
+ * Removes all ephem data
+ */
+//------------------------------------------------------------------------------
+void Ephemeris::ClearPoints()
+{
+   theEphem.clear();
+   segmentStartTimes.clear();
+   a1StartEpoch = -1.0;
+   a1EndEpoch   = 999999.0;
+   ResetLookup();
+}
+
+
+//------------------------------------------------------------------------------
+// bool GetCoverage(GmatEpoch &start, GmatEpoch &end)
+//------------------------------------------------------------------------------
+/**
+ * Retrieves the span covered by the ephem data
+ *
+ * @param start The earliest epoch in the ephem
+ * @param end   The latest epoch in the ephem
+ *
+ * @return true if there is data, false if the ephem is empty
+ */
+//------------------------------------------------------------------------------
+bool Ephemeris::GetCoverage(GmatEpoch &start, GmatEpoch &end)
+{
+   if (theEphem.empty())
+      return false;
+
+   start = theEphem[0].segStart;
+   end   = theEphem[0].segEnd;
+   for (UnsignedInt i = 1; i < theEphem.size(); ++i)
+   {
+      if (theEphem[i].segStart < start)
+         start = theEphem[i].segStart;
+      if (theEphem[i].segEnd > end)
+         end = theEphem[i].segEnd;
+   }
+   return true;
+}
+
+
+//------------------------------------------------------------------------------
+// void ResetLookup()
+//------------------------------------------------------------------------------
+/**
+ * Clears the search hints and the interpolation window.
+ *
+ * Derived classes call this after (re)building theEphem.
+ */
+//------------------------------------------------------------------------------
+void Ephemeris::ResetLookup()
+{
+   lastSegment      = -1;
+   lastPointSegment = -1;
+   lastPoint        = -1;
+   windowSegment    = -1;
+   windowStart      = -1;
+   windowOrder      = -1;
+   windowFirstEpoch = -1.0;
+   windowLastEpoch  = -1.0;
+   baryWeights.clear();
+}
+
+
+//------------------------------------------------------------------------------
+// bool InterpolateBarycentric(const GmatEpoch forEpoch, Real *interpolents)
+//------------------------------------------------------------------------------
+/**
+ * Evaluates the Lagrange polynomial through the window points using the
+ * second (true) barycentric form and the weights set when the window loaded.
+ *
+ * @param forEpoch     The epoch
+ * @param interpolents The interpolated position and velocity
+ *
+ * @return true on success
+ */
+//------------------------------------------------------------------------------
+bool Ephemeris::InterpolateBarycentric(const GmatEpoch forEpoch,
+      Real *interpolents)
+{
+   if ((windowSegment < 0) ||
+       (baryWeights.size() != (size_t)(windowOrder + 1)))
+      return false;
+
+   const std::vector<EphemPoint> &points = theEphem[windowSegment].points;
+   Real numerator[6] = {0.0, 0.0, 0.0, 0.0, 0.0, 0.0};
+   Real denominator = 0.0;
+
+   for (Integer i = 0; i <= windowOrder; ++i)
+   {
+      const EphemPoint &point = points[windowStart + i];
+      const Real *data = point.posvel.GetDataVector();
+      Real dt = forEpoch - point.theEpoch;
+
+      // On a node the polynomial is the node value
+      if (dt == 0.0)
+      {
+         for (Integer j = 0; j < 6; ++j)
+            interpolents[j] = data[j];
+         return true;
+      }
+
+      Real term = baryWeights[i] / dt;
+      denominator += term;
+      for (Integer j = 0; j < 6; ++j)
+         numerator[j] += term * data[j];
+   }
+
+   for (Integer j = 0; j < 6; ++j)
+      interpolents[j] = numerator[j] / denominator;
+
+   return true;
+}
@@ -56,6 +56,10 @@ public:
 //         const Integer pointNumber, const Integer forSegment = 0);
    virtual Rvector6 InterpolatePoint(const GmatEpoch forEpoch);
 
+   void             AddPoint(const GmatEpoch epoch, const Real *posvel);
+   void             ClearPoints();
+   bool             GetCoverage(GmatEpoch &start, GmatEpoch &end);
+
    /// Structure containing the minimal data GMAT needs for an ephem
    struct EphemPoint
    {
@@ -97,6 +101,29 @@ protected:
    bool warnInterpolationDegradation;
    /// Flag to toggle between Lagrange and Hermite interpolation
    bool useHermite;
+
+   /// Segment found by the last FindSegment() call, checked first next time
+   Integer lastSegment;
+   /// Segment searched by the last IndexInSegment() call
+   Integer lastPointSegment;
+   /// Last point at or before the epoch in the last IndexInSegment() call
+   Integer lastPoint;
+
+   /// Segment of the points loaded into the interpolation window
+   Integer windowSegment;
+   /// Index of the first point in the interpolation window
+   Integer windowStart;
+   /// Interpolation order used when the window was loaded
+   Integer windowOrder;
+   /// Epochs of the first and last window points, used to detect reloads
+   GmatEpoch windowFirstEpoch;
+   GmatEpoch windowLastEpoch;
+   /// Barycentric Lagrange weights for the window, relative to its first epoch
+   RealArray baryWeights;
+
+   void           ResetLookup();
+   bool           InterpolateBarycentric(const GmatEpoch forEpoch,
+                                         Real *interpolents);
 };
 
 #endif /* Ephemeris_hpp */
@@ -0,0 +1,277 @@
+//$Id$
+//------------------------------------------------------------------------------
+//                              MemoryMappedFile
+//------------------------------------------------------------------------------
+// GMAT: General Mission Analysis Tool
+//
+// Copyright (c) 2002 - 2020 United States Government as represented by the
+// Administrator of the National Aeronautics and Space Administration.
+// All Other Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// You may not use this file except in compliance with the License.
+// You may obtain a copy of the License at:
+// http://www.apache.org/licenses/LICENSE-2.0.
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied.   See the License for the specific language
+// governing permissions and limitations under the License.
+//
+// Author: GMAT Development Team
+// Created: 2026/10/17
+//
+/**
+ * Implements the read-only, reference counted memory mapping of a file.
+ */
+//------------------------------------------------------------------------------
+#include "MemoryMappedFile.hpp"
+#include "MessageInterface.hpp"
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+//#define DEBUG_MEMORY_MAP
+
+//---------------------------------
+// static data
+//---------------------------------
+std::map<std::string, MemoryMappedFile*> MemoryMappedFile::openFiles;
+std::mutex MemoryMappedFile::registryMutex;
+
+//---------------------------------
+// public
+//---------------------------------
+
+//------------------------------------------------------------------------------
+// MemoryMappedFile* Open(const std::string &path)
+//------------------------------------------------------------------------------
+/**
+ * Returns the shared mapping of a file, mapping it on first use.
+ *
+ * @param path The full path of the file
+ *
+ * @return The mapping, or NULL if the file cannot be mapped (the caller is
+ *         expected to fall back to buffered reads in that case)
+ */
+//------------------------------------------------------------------------------
+MemoryMappedFile* MemoryMappedFile::Open(const std::string &path)
+{
+   std::lock_guard<std::mutex> lock(registryMutex);
+
+   std::map<std::string, MemoryMappedFile*>::iterator i = openFiles.find(path);
+   if (i != openFiles.end())
+   {
+      ++(i->second->refCount);
+      return i->second;
+   }
+
+   MemoryMappedFile *mappedFile = new MemoryMappedFile(path);
+   if (!mappedFile->Map())
+   {
+      delete mappedFile;
+      return NULL;
+   }
+
+   mappedFile->refCount = 1;
+   openFiles[path] = mappedFile;
+
+   #ifdef DEBUG_MEMORY_MAP
+      MessageInterface::ShowMessage("MemoryMappedFile: mapped %s, %lu bytes\n",
+            path.c_str(), (unsigned long)mappedFile->size);
+   #endif
+
+   return mappedFile;
+}
+
+
+//------------------------------------------------------------------------------
+// void Release(MemoryMappedFile *mappedFile)
+//------------------------------------------------------------------------------
+/**
+ * Drops one reference to a mapping, unmapping the file with the last one.
+ *
+ * @param mappedFile The mapping returned from Open(); NULL is ignored
+ */
+//------------------------------------------------------------------------------
+void MemoryMappedFile::Release(MemoryMappedFile *mappedFile)
+{
+   if (mappedFile == NULL)
+      return;
+
+   std::lock_guard<std::mutex> lock(registryMutex);
+
+   if (--(mappedFile->refCount) > 0)
+      return;
+
+   openFiles.erase(mappedFile->filePath);
+   delete mappedFile;
+}
+
+
+//------------------------------------------------------------------------------
+// const char* GetData() const
+//------------------------------------------------------------------------------
+const char* MemoryMappedFile::GetData() const
+{
+   return data;
+}
+
+
+//------------------------------------------------------------------------------
+// size_t GetSize() const
+//------------------------------------------------------------------------------
+size_t MemoryMappedFile::GetSize() const
+{
+   return size;
+}
+
+
+//------------------------------------------------------------------------------
+// const std::string& GetPath() const
+//------------------------------------------------------------------------------
+const std::string& MemoryMappedFile::GetPath() const
+{
+   return filePath;
+}
+
+
+//------------------------------------------------------------------------------
+// Integer GetReferenceCount() const
+//------------------------------------------------------------------------------
+Integer MemoryMappedFile::GetReferenceCount() const
+{
+   std::lock_guard<std::mutex> lock(registryMutex);
+   return refCount;
+}
+
+
+//---------------------------------
+// private
+//---------------------------------
+
+//------------------------------------------------------------------------------
+// MemoryMappedFile(const std::string &path)
+//------------------------------------------------------------------------------
+MemoryMappedFile::MemoryMappedFile(const std::string &path) :
+   filePath       (path),
+   data           (NULL),
+   size           (0),
+   refCount       (0)
+   #ifdef _WIN32
+   ,
+   fileHandle     (NULL),
+   mappingHandle  (NULL)
+   #endif
+{
+}
+
+
+//------------------------------------------------------------------------------
+// ~MemoryMappedFile()
+//------------------------------------------------------------------------------
+MemoryMappedFile::~MemoryMappedFile()
+{
+   Unmap();
+}
+
+
+//------------------------------------------------------------------------------
+// bool Map()
+//------------------------------------------------------------------------------
+/**
+ * Maps the whole file read-only.
+ *
+ * @return true on success, false if the file is missing, empty, or cannot be
+ *         mapped
+ */
+//------------------------------------------------------------------------------
+bool MemoryMappedFile::Map()
+{
+   #ifdef _WIN32
+      HANDLE file = CreateFileA(filePath.c_str(), GENERIC_READ, FILE_SHARE_READ,
+            NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+      if (file == INVALID_HANDLE_VALUE)
+         return false;
+
+      LARGE_INTEGER fileSize;
+      if (!GetFileSizeEx(file, &fileSize) || (fileSize.QuadPart == 0))
+      {
+         CloseHandle(file);
+         return false;
+      }
+
+      HANDLE mapping = CreateFileMappingA(file, NULL, PAGE_READONLY, 0, 0, NULL);
+      if (mapping == NULL)
+      {
+         CloseHandle(file);
+         return false;
+      }
+
+      void *view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+      if (view == NULL)
+      {
+         CloseHandle(mapping);
+         CloseHandle(file);
+         return false;
+      }
+
+      fileHandle    = file;
+      mappingHandle = mapping;
+      data          = (const char*)view;
+      size          = (size_t)fileSize.QuadPart;
+   #else
+      int fd = open(filePath.c_str(), O_RDONLY);
+      if (fd < 0)
+         return false;
+
+      struct stat fileStat;
+      if ((fstat(fd, &fileStat) != 0) || (fileStat.st_size == 0))
+      {
+         close(fd);
+         return false;
+      }
+
+      void *view = mmap(NULL, (size_t)fileStat.st_size, PROT_READ, MAP_SHARED,
+            fd, 0);
+      // The mapping stays valid after the descriptor is closed
+      close(fd);
+
+      if (view == MAP_FAILED)
+         return false;
+
+      data = (const char*)view;
+      size = (size_t)fileStat.st_size;
+   #endif
+
+   return true;
+}
+
+
+//------------------------------------------------------------------------------
+// void Unmap()
+//------------------------------------------------------------------------------
+void MemoryMappedFile::Unmap()
+{
+   if (data == NULL)
+      return;
+
+   #ifdef _WIN32
+      UnmapViewOfFile((LPCVOID)data);
+      CloseHandle((HANDLE)mappingHandle);
+      CloseHandle((HANDLE)fileHandle);
+      mappingHandle = NULL;
+      fileHandle    = NULL;
+   #else
+      munmap((void*)data, size);
+   #endif
+
+   data = NULL;
+   size = 0;
+}
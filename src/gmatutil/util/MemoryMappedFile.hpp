@@ -0,0 +1,82 @@
+//$Id$
+//------------------------------------------------------------------------------
+//                              MemoryMappedFile
+//------------------------------------------------------------------------------
+// GMAT: General Mission Analysis Tool
+//
+// Copyright (c) 2002 - 2020 United States Government as represented by the
+// Administrator of the National Aeronautics and Space Administration.
+// All Other Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// You may not use this file except in compliance with the License.
+// You may obtain a copy of the License at:
+// http://www.apache.org/licenses/LICENSE-2.0.
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied.   See the License for the specific language
+// governing permissions and limitations under the License.
+//
+// Author: GMAT Development Team
+// Created: 2026/10/17
+//
+/**
+ * Declares a read-only, reference counted memory mapping of a file.
+ *
+ * Mappings are shared process-wide: opening the same path twice returns the
+ * same object, so several readers (e.g. the DE files of cloned solar systems)
+ * use one set of pages.  Callers must balance each Open() with a Release().
+ */
+//------------------------------------------------------------------------------
+#ifndef MemoryMappedFile_hpp
+#define MemoryMappedFile_hpp
+
+#include "utildefs.hpp"
+#include <map>
+#include <mutex>
+
+class GMATUTIL_API MemoryMappedFile
+{
+public:
+   static MemoryMappedFile* Open(const std::string &path);
+   static void              Release(MemoryMappedFile *mappedFile);
+
+   const char*              GetData() const;
+   size_t                   GetSize() const;
+   const std::string&       GetPath() const;
+   Integer                  GetReferenceCount() const;
+
+private:
+   MemoryMappedFile(const std::string &path);
+   ~MemoryMappedFile();
+
+   // Mappings are owned by the registry; no copies
+   MemoryMappedFile(const MemoryMappedFile&);
+   MemoryMappedFile& operator=(const MemoryMappedFile&);
+
+   bool                     Map();
+   void                     Unmap();
+
+   /// Full path of the mapped file, used as the registry key
+   std::string              filePath;
+   /// Start of the mapped view, or NULL if not mapped
+   const char               *data;
+   /// Size of the mapped view in bytes
+   size_t                   size;
+   /// Number of Open() calls not yet released
+   Integer                  refCount;
+
+   #ifdef _WIN32
+   /// Native file and mapping handles
+   void                     *fileHandle;
+   void                     *mappingHandle;
+   #endif
+
+   /// Process-wide registry of open mappings, keyed by path
+   static std::map<std::string, MemoryMappedFile*> openFiles;
+   /// Guards the registry and the reference counts
+   static std::mutex        registryMutex;
+};
+
+#endif // MemoryMappedFile_hpp
@@ -33,12 +33,18 @@
 #include "MemoryTracker.hpp"
 #include "MessageInterface.hpp"
 #include <stdio.h>                 // for sprintf()
+#include <atomic>
 
 //--------------------------------------
 //  initialize static variables
 //--------------------------------------
 MemoryTracker* MemoryTracker::instance = NULL;
 
+// Allocation counting state; plain atomics so CountAllocation() can be called
+// from inside operator new
+static std::atomic<bool>        countAllocations(false);
+static std::atomic<UnsignedInt> allocationCount(0);
+
 //------------------------------------------------------------------------------
 // MemoryTracker* Instance()
 //------------------------------------------------------------------------------
@@ -202,6 +208,55 @@ StringArray& MemoryTracker::GetTracks(bool clearTracks, bool writeScriptName)
 }
 
 
+//------------------------------------------------------------------------------
+// void CountAllocation()
+//------------------------------------------------------------------------------
+/**
+ * Counts one heap allocation if counting is on.
+ *
+ * GMAT does not replace the global allocator; test programs that need the
+ * count define operator new and call this method from it.  It does not
+ * allocate.
+ */
+//------------------------------------------------------------------------------
+void MemoryTracker::CountAllocation()
+{
+   if (countAllocations.load(std::memory_order_relaxed))
+      allocationCount.fetch_add(1, std::memory_order_relaxed);
+}
+
+
+//------------------------------------------------------------------------------
+// void SetAllocationCounting(bool on)
+//------------------------------------------------------------------------------
+void MemoryTracker::SetAllocationCounting(bool on)
+{
+   countAllocations = on;
+}
+
+
+//------------------------------------------------------------------------------
+// UnsignedInt GetAllocationCount()
+//------------------------------------------------------------------------------
+/**
+ * Returns the number of allocations counted since the last reset.
+ */
+//------------------------------------------------------------------------------
+UnsignedInt MemoryTracker::GetAllocationCount()
+{
+   return allocationCount;
+}
+
+
+//------------------------------------------------------------------------------
+// void ResetAllocationCount()
+//------------------------------------------------------------------------------
+void MemoryTracker::ResetAllocationCount()
+{
+   allocationCount = 0;
+}
+
+
 //------------------------------------------------------------------------------
 //  MemoryTracker()
 //------------------------------------------------------------------------------
@@ -51,6 +51,13 @@ public:
    UnsignedInt    GetNumberOfTracks();
    StringArray&   GetTracks(bool clearTracks = false, bool writeScriptName = false);
    
+   // Heap allocation counting; a test program's operator new calls
+   // CountAllocation() to check that a code path does not allocate
+   static void        CountAllocation();
+   static void        SetAllocationCounting(bool on);
+   static UnsignedInt GetAllocationCount();
+   static void        ResetAllocationCount();
+   
 private:
    
    static MemoryTracker *instance;
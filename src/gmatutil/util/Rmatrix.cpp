@@ -38,8 +38,11 @@
 #include <stdarg.h>
 #include <sstream>
 #include <stdio.h>            // Fix for header rearrangement in gcc 4.4
+#include <utility>            // for std::move()
+#include <vector>
 #include "MessageInterface.hpp"
 #include "LUFactorization.hpp"
+#include "MatrixUtil.hpp"     // for the product kernels
 
 //#define DEBUG_DETERMINANT
 //#define DEBUG_MULTIPLY
@@ -99,6 +102,15 @@ Rmatrix::Rmatrix(const Rmatrix &m)
 {
 }
 
+
+//------------------------------------------------------------------------------
+//  Rmatrix(Rmatrix &&m)
+//------------------------------------------------------------------------------
+Rmatrix::Rmatrix(Rmatrix &&m)
+   : TableTemplate<Real>(std::move(m)) 
+{
+}
+
 // ekf mod 12/16
 //------------------------------------------------------------------------------
 //  Rmatrix::Identity(unsigned int size)
@@ -241,6 +253,16 @@ const Rmatrix& Rmatrix::operator=(const Rmatrix &m)
 }
 
 
+//------------------------------------------------------------------------------
+//  const Rmatrix& operator=(Rmatrix &&m)
+//------------------------------------------------------------------------------
+const Rmatrix& Rmatrix::operator=(Rmatrix &&m) 
+{
+   TableTemplate<Real>::operator=(std::move(m));
+   return *this;
+}
+
+
 //------------------------------------------------------------------------------
 //  bool operator==(const Rmatrix &m)const
 //------------------------------------------------------------------------------
@@ -484,10 +506,8 @@ Rmatrix Rmatrix::operator*(const Rmatrix &m) const
    {
       Rmatrix prod(rowsD, m.colsD);  // declare a zero matrix
       
-      for (int i = 0; i < rowsD; i++)
-         for (int j = 0; j < m.colsD; j++)
-            for (int k = 0; k < colsD; k++)
-               prod(i, j) += elementD[i*colsD + k] * m(k, j);
+      GmatMatrixUtil::Multiply(false, false, rowsD, m.colsD, colsD, 1.0,
+                               elementD, m.elementD, 0.0, prod.elementD);
       
       #ifdef DEBUG_MULTIPLY
       MessageInterface::ShowMessage
@@ -511,6 +531,52 @@ const Rmatrix& Rmatrix::operator*=(const Rmatrix &m)
 }
 
 
+//------------------------------------------------------------------------------
+//  void AddProduct(const Rmatrix &a, const Rmatrix &b, Real factor,
+//                  bool transposeA, bool transposeB)
+//------------------------------------------------------------------------------
+/**
+ * Adds factor * op(a) * op(b) to this matrix in place.
+ *
+ * @param a          The left operand
+ * @param b          The right operand
+ * @param factor     Scale applied to the product
+ * @param transposeA Flag to use the transpose of a
+ * @param transposeB Flag to use the transpose of b
+ */
+//------------------------------------------------------------------------------
+void Rmatrix::AddProduct(const Rmatrix &a, const Rmatrix &b, Real factor,
+                         bool transposeA, bool transposeB)
+{
+   if ((isSizedD == false) || (a.IsSized() == false) ||
+       (b.IsSized() == false))
+      throw TableTemplateExceptions::UnsizedTable();
+
+   Integer m = (transposeA ? a.colsD : a.rowsD);
+   Integer k = (transposeA ? a.rowsD : a.colsD);
+   Integer kb = (transposeB ? b.colsD : b.rowsD);
+   Integer n = (transposeB ? b.rowsD : b.colsD);
+
+   if ((k != kb) || (m != rowsD) || (n != colsD))
+      throw TableTemplateExceptions::DimensionError();
+
+   // The kernel must not write to its operands, so a product involving this
+   // matrix is formed separately
+   if ((elementD == a.elementD) || (elementD == b.elementD))
+   {
+      std::vector<Real> prod(rowsD * colsD);
+      GmatMatrixUtil::Multiply(transposeA, transposeB, m, n, k, factor,
+                               a.elementD, b.elementD, 0.0, &prod[0]);
+      for (Integer i = 0; i < rowsD * colsD; ++i)
+         elementD[i] += prod[i];
+      return;
+   }
+
+   GmatMatrixUtil::Multiply(transposeA, transposeB, m, n, k, factor,
+                            a.elementD, b.elementD, 1.0, elementD);
+}
+
+
 //------------------------------------------------------------------------------
 //  const Rmatrix operator/(const Rmatrix &m) const
 //------------------------------------------------------------------------------
@@ -1354,18 +1420,8 @@ Rmatrix TransposeTimesMatrix(const Rmatrix &m1, const Rmatrix &m2)
       throw TableTemplateExceptions::DimensionError();
     
    Rmatrix m(m1.colsD, m2.colsD);
-
-   int i, j, k;
-   for (i = 0; i < m1.colsD; i++)
-   {
-      for (j = 0; j < m2.colsD; j++)
-      {
-         for (k = 0; k < m1.rowsD; k++)
-         {
-            m(i, j) += m1(k, i)*m2(k, j);
-         }
-      }
-   }
+   GmatMatrixUtil::Multiply(true, false, m1.colsD, m2.colsD, m1.rowsD, 1.0,
+                            m1.elementD, m2.elementD, 0.0, m.elementD);
 
    return m;
 }
@@ -1382,22 +1438,12 @@ Rmatrix MatrixTimesTranspose(const Rmatrix &m1, const Rmatrix &m2)
       throw TableTemplateExceptions::UnsizedTable();
    }
 
-   if (m1.rowsD != m2.rowsD)
+   if (m1.colsD != m2.colsD)
       throw TableTemplateExceptions::DimensionError();
     
    Rmatrix m(m1.rowsD, m2.rowsD);
-
-   int i, j, k;
-   for (i = 0; i < m1.rowsD; i++)
-   {
-      for (j = 0; j < m2.rowsD; j++)
-      {
-         for (k = 0; k < m1.colsD; k++)
-         {
-            m(i, j) += m1(i, k)*m2(j, k);
-         }
-      }
-   }
+   GmatMatrixUtil::Multiply(false, true, m1.rowsD, m2.rowsD, m1.colsD, 1.0,
+                            m1.elementD, m2.elementD, 0.0, m.elementD);
 
    return m;
 }
@@ -1414,23 +1460,79 @@ Rmatrix TransposeTimesTranspose(const Rmatrix &m1, const Rmatrix &m2)
       throw TableTemplateExceptions::UnsizedTable();
    }
 
-   if (m1.rowsD != m2.rowsD)
+   if (m1.rowsD != m2.colsD)
       throw TableTemplateExceptions::DimensionError();
     
    Rmatrix m(m1.colsD, m2.rowsD);
+   GmatMatrixUtil::Multiply(true, true, m1.colsD, m2.rowsD, m1.rowsD, 1.0,
+                            m1.elementD, m2.elementD, 0.0, m.elementD);
 
-   int i, j, k;
-   for (i = 0; i < m1.colsD; i++)
-   {
-      for (j = 0; j < m2.rowsD; j++)
-      {
-         for (k = 0; k < m1.rowsD; k++)
-         {
-            m(i, j) += m1(k, i)*m2(j, k);
-         }
-      }
-   }
+   return m;
+}
+
+
+//------------------------------------------------------------------------------
+//  <friend>
+//  Rmatrix MatrixTimesMatrixTimesTranspose(const Rmatrix &a, const Rmatrix &b)
+//------------------------------------------------------------------------------
+/**
+ * Forms a * b * a^T, as used to map a covariance through a Jacobian, without
+ * building the transpose or a temporary Rmatrix.
+ *
+ * @param a The outer matrix, m x k
+ * @param b The inner matrix, k x k
+ *
+ * @return The m x m product
+ */
+//------------------------------------------------------------------------------
+Rmatrix MatrixTimesMatrixTimesTranspose(const Rmatrix &a, const Rmatrix &b)
+{
+   if ((a.IsSized() == false) || (b.IsSized() == false))
+      throw TableTemplateExceptions::UnsizedTable();
+
+   if ((b.rowsD != a.colsD) || (b.colsD != a.colsD))
+      throw TableTemplateExceptions::DimensionError();
+
+   std::vector<Real> ab(a.rowsD * a.colsD);
+   GmatMatrixUtil::Multiply(false, false, a.rowsD, a.colsD, a.colsD, 1.0,
+                            a.elementD, b.elementD, 0.0, &ab[0]);
+
+   Rmatrix m(a.rowsD, a.rowsD);
+   GmatMatrixUtil::Multiply(false, true, a.rowsD, a.rowsD, a.colsD, 1.0,
+                            &ab[0], a.elementD, 0.0, m.elementD);
+   return m;
+}
+
+
+//------------------------------------------------------------------------------
+//  <friend>
+//  Rmatrix TransposeTimesMatrixTimesMatrix(const Rmatrix &a, const Rmatrix &w)
+//------------------------------------------------------------------------------
+/**
+ * Forms a^T * w * a, as used for weighted normal equations, without building
+ * the transpose or a temporary Rmatrix.
+ *
+ * @param a The outer matrix, k x n
+ * @param w The inner matrix, k x k
+ *
+ * @return The n x n product
+ */
+//------------------------------------------------------------------------------
+Rmatrix TransposeTimesMatrixTimesMatrix(const Rmatrix &a, const Rmatrix &w)
+{
+   if ((a.IsSized() == false) || (w.IsSized() == false))
+      throw TableTemplateExceptions::UnsizedTable();
+
+   if ((w.rowsD != a.rowsD) || (w.colsD != a.rowsD))
+      throw TableTemplateExceptions::DimensionError();
+
+   std::vector<Real> wa(a.rowsD * a.colsD);
+   GmatMatrixUtil::Multiply(false, false, a.rowsD, a.colsD, a.rowsD, 1.0,
+                            w.elementD, a.elementD, 0.0, &wa[0]);
 
+   Rmatrix m(a.colsD, a.colsD);
+   GmatMatrixUtil::Multiply(true, false, a.colsD, a.colsD, a.rowsD, 1.0,
+                            a.elementD, &wa[0], 0.0, m.elementD);
    return m;
 }
 
@@ -64,6 +64,7 @@ public:
    Rmatrix(int r, int c);
    Rmatrix(int r, int c, Real a1, ...);
    Rmatrix(const Rmatrix &m);
+   Rmatrix(Rmatrix &&m);
    virtual ~Rmatrix();
    
 // ekf mod 12/16
@@ -77,6 +78,7 @@ public:
    IsOrthonormal(Real accuracyRequired = GmatRealConstants::REAL_EPSILON) const;
    
    const Rmatrix& operator=(const Rmatrix &m);
+   const Rmatrix& operator=(Rmatrix &&m);
    bool operator==(const Rmatrix &m)const;
    bool operator!=(const Rmatrix &m)const;
    
@@ -89,6 +91,8 @@ public:
    
    Rmatrix operator*(const Rmatrix &RHSRmatrix) const;
    const Rmatrix& operator*=(const Rmatrix &RHSRmatrix);
+   void AddProduct(const Rmatrix &a, const Rmatrix &b, Real factor = 1.0,
+                   bool transposeA = false, bool transposeB = false);
    
    Rmatrix operator/(const Rmatrix &RHSRmatrix) const;
    const Rmatrix& operator/=(const Rmatrix &RHSRmatrix);
@@ -137,6 +141,8 @@ public:
    GMATUTIL_API friend Rmatrix TransposeTimesMatrix(const Rmatrix &m1, const Rmatrix &m2);
    GMATUTIL_API friend Rmatrix MatrixTimesTranspose(const Rmatrix &m1, const Rmatrix &m2);
    GMATUTIL_API friend Rmatrix TransposeTimesTranspose(const Rmatrix &m1, const Rmatrix &m2);
+   GMATUTIL_API friend Rmatrix MatrixTimesMatrixTimesTranspose(const Rmatrix &a, const Rmatrix &b);
+   GMATUTIL_API friend Rmatrix TransposeTimesMatrixTimesMatrix(const Rmatrix &a, const Rmatrix &w);
    
    GMATUTIL_API friend std::istream& operator>> (std::istream &input, Rmatrix &a);
    GMATUTIL_API friend std::ostream& operator<< (std::ostream &output, const Rmatrix &a);
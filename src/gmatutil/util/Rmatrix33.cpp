@@ -59,14 +59,13 @@ const std::string Rmatrix33::descs[9] =
 //  Rmatrix33(bool IsIdentityRmatrix = true)
 //------------------------------------------------------------------------------
 Rmatrix33::Rmatrix33(bool IdentityRmatrix)  
-   : Rmatrix(3,3) 
+   : Rmatrix() 
 { 
-    if(IdentityRmatrix == true)
-    {
-        elementD[0] = 1.0;
-        elementD[4] = 1.0;
-        elementD[8] = 1.0;
-    }
+    initFixed(inlineElementD, 3, 3);
+    Real diagonal = (IdentityRmatrix ? 1.0 : 0.0);
+    Set(diagonal, 0.0, 0.0,
+        0.0, diagonal, 0.0,
+        0.0, 0.0, diagonal);
 }
 
 //------------------------------------------------------------------------------
@@ -77,17 +76,12 @@ Rmatrix33::Rmatrix33(bool IdentityRmatrix)
 Rmatrix33::Rmatrix33(Real a00, Real a01, Real a02,
            Real a10, Real a11, Real a12,
            Real a20, Real a21, Real a22)
-   : Rmatrix(3,3)
+   : Rmatrix()
 {
-    elementD[0] = a00;
-    elementD[1] = a01;
-    elementD[2] = a02;
-    elementD[3] = a10;
-    elementD[4] = a11;
-    elementD[5] = a12;
-    elementD[6] = a20;
-    elementD[7] = a21;
-    elementD[8] = a22;
+    initFixed(inlineElementD, 3, 3);
+    Set(a00, a01, a02,
+        a10, a11, a12,
+        a20, a21, a22);
 }
 
 
@@ -95,16 +89,34 @@ Rmatrix33::Rmatrix33(Real a00, Real a01, Real a02,
 //  const Rmatrix33(const Rmatrix33 &m)
 //------------------------------------------------------------------------------
 Rmatrix33::Rmatrix33(const Rmatrix33 &m) 
-  : Rmatrix(m)
+  : Rmatrix()
 {
+    // A matrix resized to another size is copied as it is
+    if ((m.rowsD == 3) && (m.colsD == 3))
+        initFixed(inlineElementD, 3, 3);
+    else
+        init(m.rowsD, m.colsD);
+    for (int i = 0; i < rowsD*colsD; i++)
+        elementD[i] = m.elementD[i];
 }
 
 //------------------------------------------------------------------------------
 //  const Rmatrix33(const Rmatrix &m)
 //------------------------------------------------------------------------------
 Rmatrix33::Rmatrix33(const Rmatrix &m) 
-  : Rmatrix(m)
+  : Rmatrix()
 {
+    if (m.IsSized() == false)
+        throw TableTemplateExceptions::UnsizedTable();
+
+    // A matrix of another size is copied as it is, in allocated storage
+    if ((m.GetNumRows() == 3) && (m.GetNumColumns() == 3))
+        initFixed(inlineElementD, 3, 3);
+    else
+        init(m.GetNumRows(), m.GetNumColumns());
+
+    for (int i = 0; i < rowsD*colsD; i++)
+        elementD[i] = m.GetDataVector()[i];
 }
 
 //------------------------------------------------------------------------------
@@ -119,7 +131,13 @@ Rmatrix33::~Rmatrix33()
 //------------------------------------------------------------------------------
 const Rmatrix33& Rmatrix33::operator=(const Rmatrix33 &m) 
 {
-    Rmatrix::operator=(m);
+    if ((rowsD == 3) && (colsD == 3) && (m.rowsD == 3) && (m.colsD == 3))
+    {
+        for (int i = 0; i < 9; i++)
+            elementD[i] = m.elementD[i];
+    }
+    else
+        Rmatrix::operator=(m);
     return *this;
 }
 
@@ -268,15 +286,15 @@ const Rmatrix33& Rmatrix33::operator-=(const Rmatrix33& m)
 Rmatrix33 Rmatrix33::operator*(const Rmatrix33& m) const 
 {
     return
-    Rmatrix33((*this)(0,0)*m(0,0) + (*this)(0,1)*m(1,0) + (*this)(0,2)*m(2,0),
-         (*this)(0,0)*m(0,1) + (*this)(0,1)*m(1,1) + (*this)(0,2)*m(2,1),
-         (*this)(0,0)*m(0,2) + (*this)(0,1)*m(1,2) + (*this)(0,2)*m(2,2),
-         (*this)(1,0)*m(0,0) + (*this)(1,1)*m(1,0) + (*this)(1,2)*m(2,0),
-         (*this)(1,0)*m(0,1) + (*this)(1,1)*m(1,1) + (*this)(1,2)*m(2,1),
-         (*this)(1,0)*m(0,2) + (*this)(1,1)*m(1,2) + (*this)(1,2)*m(2,2),
-         (*this)(2,0)*m(0,0) + (*this)(2,1)*m(1,0) + (*this)(2,2)*m(2,0),
-         (*this)(2,0)*m(0,1) + (*this)(2,1)*m(1,1) + (*this)(2,2)*m(2,1),
-         (*this)(2,0)*m(0,2) + (*this)(2,1)*m(1,2) + (*this)(2,2)*m(2,2));
+    Rmatrix33(elementD[0]*m.elementD[0] + elementD[1]*m.elementD[3] + elementD[2]*m.elementD[6],
+         elementD[0]*m.elementD[1] + elementD[1]*m.elementD[4] + elementD[2]*m.elementD[7],
+         elementD[0]*m.elementD[2] + elementD[1]*m.elementD[5] + elementD[2]*m.elementD[8],
+         elementD[3]*m.elementD[0] + elementD[4]*m.elementD[3] + elementD[5]*m.elementD[6],
+         elementD[3]*m.elementD[1] + elementD[4]*m.elementD[4] + elementD[5]*m.elementD[7],
+         elementD[3]*m.elementD[2] + elementD[4]*m.elementD[5] + elementD[5]*m.elementD[8],
+         elementD[6]*m.elementD[0] + elementD[7]*m.elementD[3] + elementD[8]*m.elementD[6],
+         elementD[6]*m.elementD[1] + elementD[7]*m.elementD[4] + elementD[8]*m.elementD[7],
+         elementD[6]*m.elementD[2] + elementD[7]*m.elementD[5] + elementD[8]*m.elementD[8]);
 }
 
 //------------------------------------------------------------------------------
@@ -286,15 +304,15 @@ const Rmatrix33& Rmatrix33::operator*=(const Rmatrix33& m)
 {
     Rmatrix33& a = *this;  // rename the object on the left
     
-    *this = Rmatrix33(a(0,0)*m(0,0) + a(0,1)*m(1,0) + a(0,2)*m(2,0),
-             a(0,0)*m(0,1) + a(0,1)*m(1,1) + a(0,2)*m(2,1),
-             a(0,0)*m(0,2) + a(0,1)*m(1,2) + a(0,2)*m(2,2),
-             a(1,0)*m(0,0) + a(1,1)*m(1,0) + a(1,2)*m(2,0),
-             a(1,0)*m(0,1) + a(1,1)*m(1,1) + a(1,2)*m(2,1),
-             a(1,0)*m(0,2) + a(1,1)*m(1,2) + a(1,2)*m(2,2),
-             a(2,0)*m(0,0) + a(2,1)*m(1,0) + a(2,2)*m(2,0),
-             a(2,0)*m(0,1) + a(2,1)*m(1,1) + a(2,2)*m(2,1),
-             a(2,0)*m(0,2) + a(2,1)*m(1,2) + a(2,2)*m(2,2));
+    *this = Rmatrix33(a.elementD[0]*m.elementD[0] + a.elementD[1]*m.elementD[3] + a.elementD[2]*m.elementD[6],
+             a.elementD[0]*m.elementD[1] + a.elementD[1]*m.elementD[4] + a.elementD[2]*m.elementD[7],
+             a.elementD[0]*m.elementD[2] + a.elementD[1]*m.elementD[5] + a.elementD[2]*m.elementD[8],
+             a.elementD[3]*m.elementD[0] + a.elementD[4]*m.elementD[3] + a.elementD[5]*m.elementD[6],
+             a.elementD[3]*m.elementD[1] + a.elementD[4]*m.elementD[4] + a.elementD[5]*m.elementD[7],
+             a.elementD[3]*m.elementD[2] + a.elementD[4]*m.elementD[5] + a.elementD[5]*m.elementD[8],
+             a.elementD[6]*m.elementD[0] + a.elementD[7]*m.elementD[3] + a.elementD[8]*m.elementD[6],
+             a.elementD[6]*m.elementD[1] + a.elementD[7]*m.elementD[4] + a.elementD[8]*m.elementD[7],
+             a.elementD[6]*m.elementD[2] + a.elementD[7]*m.elementD[5] + a.elementD[8]*m.elementD[8]);
     return *this;
 }
 
@@ -399,9 +417,9 @@ Rmatrix33 Rmatrix33::operator-() const
 //------------------------------------------------------------------------------
 Rvector3 Rmatrix33::operator*(const Rvector3& v) const 
 {
-    return Rvector3((*this)(0,0)*v(0) + (*this)(0,1)*v(1) + (*this)(0,2)*v(2),
-           (*this)(1,0)*v(0) + (*this)(1,1)*v(1) + (*this)(1,2)*v(2),
-           (*this)(2,0)*v(0) + (*this)(2,1)*v(1) + (*this)(2,2)*v(2));
+    return Rvector3(elementD[0]*v.elementD[0] + elementD[1]*v.elementD[1] + elementD[2]*v.elementD[2],
+           elementD[3]*v.elementD[0] + elementD[4]*v.elementD[1] + elementD[5]*v.elementD[2],
+           elementD[6]*v.elementD[0] + elementD[7]*v.elementD[1] + elementD[8]*v.elementD[2]);
            
 }
 
@@ -531,15 +549,15 @@ Rmatrix33 SkewSymmetric(const Rvector3& v)
 //------------------------------------------------------------------------------
 Rmatrix33 TransposeTimesMatrix(const Rmatrix33& m1, const Rmatrix33& m2)
 {
-    return Rmatrix33(m1(0,0)*m2(0,0) + m1(1,0)*m2(1,0) + m1(2,0)*m2(2,0),
-                     m1(0,0)*m2(0,1) + m1(1,0)*m2(1,1) + m1(2,0)*m2(2,1),
-                     m1(0,0)*m2(0,2) + m1(1,0)*m2(1,2) + m1(2,0)*m2(2,2),
-                     m1(0,1)*m2(0,0) + m1(1,1)*m2(1,0) + m1(2,1)*m2(2,0),
-                     m1(0,1)*m2(0,1) + m1(1,1)*m2(1,1) + m1(2,1)*m2(2,1),
-                     m1(0,1)*m2(0,2) + m1(1,1)*m2(1,2) + m1(2,1)*m2(2,2),
-                     m1(0,2)*m2(0,0) + m1(1,2)*m2(1,0) + m1(2,2)*m2(2,0),
-                     m1(0,2)*m2(0,1) + m1(1,2)*m2(1,1) + m1(2,2)*m2(2,1),
-                     m1(0,2)*m2(0,2) + m1(1,2)*m2(1,2) + m1(2,2)*m2(2,2));
+    return Rmatrix33(m1.elementD[0]*m2.elementD[0] + m1.elementD[3]*m2.elementD[3] + m1.elementD[6]*m2.elementD[6],
+                     m1.elementD[0]*m2.elementD[1] + m1.elementD[3]*m2.elementD[4] + m1.elementD[6]*m2.elementD[7],
+                     m1.elementD[0]*m2.elementD[2] + m1.elementD[3]*m2.elementD[5] + m1.elementD[6]*m2.elementD[8],
+                     m1.elementD[1]*m2.elementD[0] + m1.elementD[4]*m2.elementD[3] + m1.elementD[7]*m2.elementD[6],
+                     m1.elementD[1]*m2.elementD[1] + m1.elementD[4]*m2.elementD[4] + m1.elementD[7]*m2.elementD[7],
+                     m1.elementD[1]*m2.elementD[2] + m1.elementD[4]*m2.elementD[5] + m1.elementD[7]*m2.elementD[8],
+                     m1.elementD[2]*m2.elementD[0] + m1.elementD[5]*m2.elementD[3] + m1.elementD[8]*m2.elementD[6],
+                     m1.elementD[2]*m2.elementD[1] + m1.elementD[5]*m2.elementD[4] + m1.elementD[8]*m2.elementD[7],
+                     m1.elementD[2]*m2.elementD[2] + m1.elementD[5]*m2.elementD[5] + m1.elementD[8]*m2.elementD[8]);
 }
 
 
@@ -549,15 +567,15 @@ Rmatrix33 TransposeTimesMatrix(const Rmatrix33& m1, const Rmatrix33& m2)
 //------------------------------------------------------------------------------
 Rmatrix33 MatrixTimesTranspose(const Rmatrix33& m1, const Rmatrix33& m2)
 {
-    return Rmatrix33(m1(0,0)*m2(0,0) + m1(0,1)*m2(0,1) + m1(0,2)*m2(0,2),
-                     m1(0,0)*m2(1,0) + m1(0,1)*m2(1,1) + m1(0,2)*m2(1,2),
-                     m1(0,0)*m2(2,0) + m1(0,1)*m2(2,1) + m1(0,2)*m2(2,2),
-                     m1(1,0)*m2(0,0) + m1(1,1)*m2(0,1) + m1(1,2)*m2(0,2),
-                     m1(1,0)*m2(1,0) + m1(1,1)*m2(1,1) + m1(1,2)*m2(1,2),
-                     m1(1,0)*m2(2,0) + m1(1,1)*m2(2,1) + m1(1,2)*m2(2,2),
-                     m1(2,0)*m2(0,0) + m1(2,1)*m2(0,1) + m1(2,2)*m2(0,2),
-                     m1(2,0)*m2(1,0) + m1(2,1)*m2(1,1) + m1(2,2)*m2(1,2),
-                     m1(2,0)*m2(2,0) + m1(2,1)*m2(2,1) + m1(2,2)*m2(2,2));
+    return Rmatrix33(m1.elementD[0]*m2.elementD[0] + m1.elementD[1]*m2.elementD[1] + m1.elementD[2]*m2.elementD[2],
+                     m1.elementD[0]*m2.elementD[3] + m1.elementD[1]*m2.elementD[4] + m1.elementD[2]*m2.elementD[5],
+                     m1.elementD[0]*m2.elementD[6] + m1.elementD[1]*m2.elementD[7] + m1.elementD[2]*m2.elementD[8],
+                     m1.elementD[3]*m2.elementD[0] + m1.elementD[4]*m2.elementD[1] + m1.elementD[5]*m2.elementD[2],
+                     m1.elementD[3]*m2.elementD[3] + m1.elementD[4]*m2.elementD[4] + m1.elementD[5]*m2.elementD[5],
+                     m1.elementD[3]*m2.elementD[6] + m1.elementD[4]*m2.elementD[7] + m1.elementD[5]*m2.elementD[8],
+                     m1.elementD[6]*m2.elementD[0] + m1.elementD[7]*m2.elementD[1] + m1.elementD[8]*m2.elementD[2],
+                     m1.elementD[6]*m2.elementD[3] + m1.elementD[7]*m2.elementD[4] + m1.elementD[8]*m2.elementD[5],
+                     m1.elementD[6]*m2.elementD[6] + m1.elementD[7]*m2.elementD[7] + m1.elementD[8]*m2.elementD[8]);
 }
 
 
@@ -567,15 +585,15 @@ Rmatrix33 MatrixTimesTranspose(const Rmatrix33& m1, const Rmatrix33& m2)
 //------------------------------------------------------------------------------
 Rmatrix33 TransposeTimesTranspose(const Rmatrix33& m1, const Rmatrix33& m2) 
 {
-    return Rmatrix33(m1(0,0)*m2(0,0) + m1(1,0)*m2(0,1) + m1(2,0)*m2(0,2),
-                     m1(0,0)*m2(1,0) + m1(1,0)*m2(1,1) + m1(2,0)*m2(1,2),
-                     m1(0,0)*m2(2,0) + m1(1,0)*m2(2,1) + m1(2,0)*m2(2,2),
-                     m1(0,1)*m2(0,0) + m1(1,1)*m2(0,1) + m1(2,1)*m2(0,2),
-                     m1(0,1)*m2(1,0) + m1(1,1)*m2(1,1) + m1(2,1)*m2(1,2),
-                     m1(0,1)*m2(2,0) + m1(1,1)*m2(2,1) + m1(2,1)*m2(2,2),
-                     m1(0,2)*m2(0,0) + m1(1,2)*m2(0,1) + m1(2,2)*m2(0,2),
-                     m1(0,2)*m2(1,0) + m1(1,2)*m2(1,1) + m1(2,2)*m2(1,2),
-                     m1(0,2)*m2(2,0) + m1(1,2)*m2(2,1) + m1(2,2)*m2(2,2));
+    return Rmatrix33(m1.elementD[0]*m2.elementD[0] + m1.elementD[3]*m2.elementD[1] + m1.elementD[6]*m2.elementD[2],
+                     m1.elementD[0]*m2.elementD[3] + m1.elementD[3]*m2.elementD[4] + m1.elementD[6]*m2.elementD[5],
+                     m1.elementD[0]*m2.elementD[6] + m1.elementD[3]*m2.elementD[7] + m1.elementD[6]*m2.elementD[8],
+                     m1.elementD[1]*m2.elementD[0] + m1.elementD[4]*m2.elementD[1] + m1.elementD[7]*m2.elementD[2],
+                     m1.elementD[1]*m2.elementD[3] + m1.elementD[4]*m2.elementD[4] + m1.elementD[7]*m2.elementD[5],
+                     m1.elementD[1]*m2.elementD[6] + m1.elementD[4]*m2.elementD[7] + m1.elementD[7]*m2.elementD[8],
+                     m1.elementD[2]*m2.elementD[0] + m1.elementD[5]*m2.elementD[1] + m1.elementD[8]*m2.elementD[2],
+                     m1.elementD[2]*m2.elementD[3] + m1.elementD[5]*m2.elementD[4] + m1.elementD[8]*m2.elementD[5],
+                     m1.elementD[2]*m2.elementD[6] + m1.elementD[5]*m2.elementD[7] + m1.elementD[8]*m2.elementD[8]);
 }
 
 
@@ -28,6 +28,9 @@
 //
 /**
  * Declares linear algebra operations for 3x3 matrices.
+ *
+ * The elements are held in the object, so constructing and copying an
+ * Rmatrix33 does not allocate.
  */
 //------------------------------------------------------------------------------
 #ifndef Rmatrix33_hpp
@@ -106,5 +109,8 @@ public:
          
 private:
    static const std::string descs[9];
+
+   /// Element storage, row major, used by the base class through elementD
+   Real inlineElementD[9];
 };
 #endif // Rmatrix33_hpp
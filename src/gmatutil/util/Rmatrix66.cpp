@@ -51,8 +51,12 @@
 //  Rmatrix66(bool isIdentityMatrix = true)
 //------------------------------------------------------------------------------
 Rmatrix66::Rmatrix66(bool isIdentityMatrix)
-   : Rmatrix(6,6) 
+   : Rmatrix() 
 { 
+   initFixed(inlineElementD, 6, 6);
+   for (int i = 0; i < rowsD*colsD; i++)
+      elementD[i] = 0.0;
+
    if (isIdentityMatrix)
    {
       elementD[0]  = 1.0;  elementD[7]  = 1.0;  elementD[14] = 1.0;
@@ -64,8 +68,12 @@ Rmatrix66::Rmatrix66(bool isIdentityMatrix)
 //  Rmatrix66(int nArgs, Real a1,...)
 //------------------------------------------------------------------------------
 Rmatrix66::Rmatrix66(int nArgs, Real a1, ...)
-   : Rmatrix(6,6)
+   : Rmatrix()
 {
+   initFixed(inlineElementD, 6, 6);
+   for (int i = 0; i < rowsD*colsD; i++)
+      elementD[i] = 0.0;
+
    va_list ap;
    elementD[0] = a1;
    va_start(ap, a1);
@@ -82,16 +90,34 @@ Rmatrix66::Rmatrix66(int nArgs, Real a1, ...)
 //  const Rmatrix66(const Rmatrix66 &m)
 //------------------------------------------------------------------------------
 Rmatrix66::Rmatrix66(const Rmatrix66 &m) 
-  : Rmatrix(m)
+  : Rmatrix()
 {
+   // A matrix resized to another size is copied as it is
+   if ((m.rowsD == 6) && (m.colsD == 6))
+      initFixed(inlineElementD, 6, 6);
+   else
+      init(m.rowsD, m.colsD);
+   for (int i = 0; i < rowsD*colsD; i++)
+      elementD[i] = m.elementD[i];
 }
 
 //------------------------------------------------------------------------------
 //  const Rmatrix66(const Rmatrix &m)
 //------------------------------------------------------------------------------
 Rmatrix66::Rmatrix66(const Rmatrix &m) 
-  : Rmatrix(m)
+  : Rmatrix()
 {
+   if (m.IsSized() == false)
+      throw TableTemplateExceptions::UnsizedTable();
+
+   // A matrix of another size is copied as it is, in allocated storage
+   if ((m.GetNumRows() == 6) && (m.GetNumColumns() == 6))
+      initFixed(inlineElementD, 6, 6);
+   else
+      init(m.GetNumRows(), m.GetNumColumns());
+
+   for (int i = 0; i < rowsD*colsD; i++)
+      elementD[i] = m.GetDataVector()[i];
 }
 
 //------------------------------------------------------------------------------
@@ -106,7 +132,13 @@ Rmatrix66::~Rmatrix66()
 //------------------------------------------------------------------------------
 const Rmatrix66& Rmatrix66::operator=(const Rmatrix66 &m) 
 {
-    Rmatrix::operator=(m);
+    if ((rowsD == 6) && (colsD == 6) && (m.rowsD == 6) && (m.colsD == 6))
+    {
+        for (int i = 0; i < rowsD*colsD; i++)
+            elementD[i] = m.elementD[i];
+    }
+    else
+        Rmatrix::operator=(m);
     return *this;
 }
 
@@ -292,7 +324,7 @@ Rmatrix66 Rmatrix66::operator-(const Rmatrix66& m) const
    Rmatrix66 diff(false);
    
    for (int i = 0; i < rowsD*colsD; i++)
-      diff.elementD[i] = elementD[i] + m.elementD[i];
+      diff.elementD[i] = elementD[i] - m.elementD[i];
    
    return diff;
 }
@@ -316,12 +348,14 @@ Rmatrix66 Rmatrix66::operator*(const Rmatrix66& m) const
 {
    Rmatrix66 prod(false);
    
+   // Row by row, so the inner loop runs over contiguous elements
    for (int i = 0; i < rowsD; i++)
    {
-      for (int j = 0; j < m.colsD; j++)
+      for (int k = 0; k < colsD; k++)
       {
-         for (int k = 0; k < colsD; k++)
-            prod(i, j) += elementD[i*colsD + k]*m(k, j);
+         Real a = elementD[i*colsD + k];
+         for (int j = 0; j < m.colsD; j++)
+            prod.elementD[i*m.colsD + j] += a*m.elementD[k*m.colsD + j];
       }
    }
    
@@ -432,10 +466,7 @@ Rvector6 Rmatrix66::operator*(const Rvector6& v) const
    { 
       var = 0.0;
       for (int j = 0; j < colsD; j++)
-      {
-         prod.elementD[i] = elementD[i*colsD + j]*v.elementD[j];
-         var = var + prod.elementD[i];
-      }
+         var = var + elementD[i*colsD + j]*v.elementD[j];
       prod.elementD[i] = var;
    }
    
@@ -513,7 +544,7 @@ Rmatrix66 Rmatrix66::Transpose() const
    for (int i = 0; i < rowsD; i++)
    {
       for (int j = 0; j < colsD; j++)
-         tran(j, i) = elementD[i*colsD + j]; 
+         tran.elementD[j*rowsD + i] = elementD[i*colsD + j]; 
    }
    
    return tran;
@@ -573,12 +604,13 @@ Rmatrix66 TransposeTimesMatrix(const Rmatrix66& m1, const Rmatrix66& m2)
 {
    Rmatrix66 m(false);
    
-   for (int i = 0; i < m1.colsD; i++)
+   for (int k = 0; k < m1.rowsD; k++)
    {
-      for (int j = 0; j < m2.rowsD; j++)
+      for (int i = 0; i < m1.colsD; i++)
       {
-         for (int k = 0; k < m1.rowsD; k++)
-            m(i, j) += m1(k, i)*m2(j, k);
+         Real a = m1.elementD[k*m1.colsD + i];
+         for (int j = 0; j < m2.colsD; j++)
+            m.elementD[i*m2.colsD + j] += a*m2.elementD[k*m2.colsD + j];
       }
    }
    
@@ -598,8 +630,10 @@ Rmatrix66 MatrixTimesTranspose(const Rmatrix66& m1, const Rmatrix66& m2)
    {
       for (int j = 0; j < m2.rowsD; j++)
       {
+         Real sum = 0.0;
          for (int k = 0; k < m1.colsD; k++)
-            m(i, j) += m1(i, k)*m2(j, k);
+            sum += m1.elementD[i*m1.colsD + k]*m2.elementD[j*m2.colsD + k];
+         m.elementD[i*m2.rowsD + j] = sum;
       }
    }
    
@@ -619,8 +653,10 @@ Rmatrix66 TransposeTimesTranspose(const Rmatrix66& m1, const Rmatrix66& m2)
    {
       for (int j = 0; j < m2.rowsD; j++)
       {
+         Real sum = 0.0;
          for (int k = 0; k < m1.rowsD; k++)
-            m(i, j) += m1(k, i)*m2(j, k);
+            sum += m1.elementD[k*m1.colsD + i]*m2.elementD[j*m2.colsD + k];
+         m.elementD[i*m2.rowsD + j] = sum;
       }
    }
    
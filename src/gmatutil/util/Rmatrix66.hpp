@@ -25,6 +25,9 @@
 //
 /**
  * Declares linear algebra operations for 6x6 matrices.
+ *
+ * The elements are held in the object, so constructing and copying an
+ * Rmatrix66 does not allocate.
  */
 //------------------------------------------------------------------------------
 #ifndef Rmatrix66_hpp
@@ -104,5 +107,7 @@ public:
    
    
 private:
+   /// Element storage, row major, used by the base class through elementD
+   Real inlineElementD[36];
 };
 #endif // Rmatrix66_hpp
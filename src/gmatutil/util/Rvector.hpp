@@ -57,6 +57,7 @@ public:
    Rvector(int size, Real a1, ... );  //Note: . is required for Real value. eg) 123., 100.
    Rvector(const RealArray &ra);
    Rvector(const Rvector &v);
+   Rvector(Rvector &&v);
    virtual ~Rvector();
    
    void Set(int numElem, Real a1, ...);
@@ -68,6 +69,7 @@ public:
    Rvector GetUnitRvector() const; 
    const Rvector& Normalize();
    const Rvector& operator=(const Rvector &v); 
+   const Rvector& operator=(Rvector &&v);
    bool operator==(const Rvector &v)const;
    bool operator!=(const Rvector &v)const;
    Rvector operator-() const;                     // negation 
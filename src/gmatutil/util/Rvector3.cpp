@@ -54,36 +54,56 @@ const std::string Rvector3::DATA_DESCRIPTIONS[NUM_DATA] =
 //  Rvector3()
 //------------------------------------------------------------------------------
 Rvector3::Rvector3()
-   : Rvector(3)
+   : Rvector()
 {
+   initFixed(inlineElementD, NUM_DATA);
+   inlineElementD[0] = 0.0;
+   inlineElementD[1] = 0.0;
+   inlineElementD[2] = 0.0;
 }
 
 //------------------------------------------------------------------------------
 //  Rvector3(const Real e1, const Real e2, const Real e3)
 //------------------------------------------------------------------------------
 Rvector3::Rvector3(const Real e1, const Real e2, const Real e3)
-   : Rvector(3, e1, e2, e3) 
+   : Rvector() 
 {
+   initFixed(inlineElementD, NUM_DATA);
+   inlineElementD[0] = e1;
+   inlineElementD[1] = e2;
+   inlineElementD[2] = e3;
 }
 
 //------------------------------------------------------------------------------
 //  Rvector3(const Rvector3 &v)
 //------------------------------------------------------------------------------
 Rvector3::Rvector3(const Rvector3 &v)
-   : Rvector(v)
+   : Rvector()
 {
+   // A vector resized to another size is copied as it is
+   if (v.sizeD == NUM_DATA)
+      initFixed(inlineElementD, NUM_DATA);
+   else
+      init(v.sizeD);
+   for (Integer i = 0; i < sizeD; i++)
+      elementD[i] = v.elementD[i];
 }
 
 //------------------------------------------------------------------------------
 //  Rvector3(const RealArray &ra)
 //------------------------------------------------------------------------------
 Rvector3::Rvector3(const RealArray &ra)
-   : Rvector(ra)
+   : Rvector()
 {
    // This check must be made here or the resulting Rvector3 may not
    // be of size 3!!
    if (ra.size() != 3)
       throw ArrayTemplateExceptions::DimensionError();
+
+   initFixed(inlineElementD, NUM_DATA);
+   inlineElementD[0] = ra[0];
+   inlineElementD[1] = ra[1];
+   inlineElementD[2] = ra[2];
 }
 
 //------------------------------------------------------------------------------
@@ -187,9 +207,9 @@ Rvector3& Rvector3::operator=(const Rvector3 &v)
 //------------------------------------------------------------------------------
 bool Rvector3::operator==(const Rvector3 &v) const
 {
-   if (elementD[0] == v[0] &&
-       elementD[1] == v[1] &&
-       elementD[2] == v[2])
+   if (elementD[0] == v.elementD[0] &&
+       elementD[1] == v.elementD[1] &&
+       elementD[2] == v.elementD[2])
    {
       return true;
    }
@@ -315,9 +335,10 @@ const Rvector3& Rvector3::operator/=(Real s)
 //------------------------------------------------------------------------------
 Rvector3 Rvector3::operator*(const Rmatrix33& m) const
 {
-    return Rvector3(elementD[0]*m(0,0) + elementD[1]*m(0,1) + elementD[2]*m(0,2),
-           elementD[0]*m(1,0) + elementD[1]*m(1,1) + elementD[2]*m(1,2),
-           elementD[0]*m(2,0) + elementD[1]*m(2,1) + elementD[2]*m(2,2));
+    const Real *a = m.elementD;
+    return Rvector3(elementD[0]*a[0] + elementD[1]*a[1] + elementD[2]*a[2],
+           elementD[0]*a[3] + elementD[1]*a[4] + elementD[2]*a[5],
+           elementD[0]*a[6] + elementD[1]*a[7] + elementD[2]*a[8]);
 }
 
 //------------------------------------------------------------------------------
@@ -26,6 +26,9 @@
 //
 /**
  * Provides linear algebra operations for 3-element Real vectors.
+ *
+ * The elements are held in the object, so constructing and copying an
+ * Rvector3 does not allocate.
  */
 //------------------------------------------------------------------------------
 #ifndef Rvector3_hpp
@@ -89,5 +92,8 @@ public:
 private:
    static const Integer NUM_DATA = 3;
    static const std::string DATA_DESCRIPTIONS[NUM_DATA];
+
+   /// Element storage, used by the base class through elementD
+   Real inlineElementD[NUM_DATA];
 };
 #endif // Rvector3_hpp
@@ -67,8 +67,11 @@ const std::string Rvector6::DATA_DESCRIPTIONS[NUM_DATA] =
  */
 //------------------------------------------------------------------------------
 Rvector6::Rvector6()
-   : Rvector(6)
+   : Rvector()
 {
+   initFixed(inlineElementD, NUM_DATA_INIT);
+   for (Integer i = 0; i < sizeD; i++)
+      inlineElementD[i] = 0.0;
 }
 
 //------------------------------------------------------------------------------
@@ -82,8 +85,10 @@ Rvector6::Rvector6()
 //------------------------------------------------------------------------------
 Rvector6::Rvector6(const Real e1, const Real e2, const Real e3,
                    const Real e4, const Real e5, const Real e6)
-   : Rvector(6, e1, e2, e3, e4, e5, e6) 
+   : Rvector() 
 {
+   initFixed(inlineElementD, NUM_DATA_INIT);
+   Set(e1, e2, e3, e4, e5, e6);
 }
 
 //------------------------------------------------------------------------------
@@ -95,8 +100,10 @@ Rvector6::Rvector6(const Real e1, const Real e2, const Real e3,
  */
 //------------------------------------------------------------------------------
 Rvector6::Rvector6(const Rvector3 &r, const Rvector3 &v)
-   : Rvector(6, r[0], r[1], r[2], v[0], v[1], v[2])
+   : Rvector()
 {
+   initFixed(inlineElementD, NUM_DATA_INIT);
+   Set(r.Get(0), r.Get(1), r.Get(2), v.Get(0), v.Get(1), v.Get(2));
 }
 
 //loj: 4/20/04 added
@@ -109,8 +116,10 @@ Rvector6::Rvector6(const Rvector3 &r, const Rvector3 &v)
  */
 //------------------------------------------------------------------------------
 Rvector6::Rvector6(const Real vec[6])
-   : Rvector(6, vec[0], vec[1], vec[2], vec[3], vec[4], vec[5])
+   : Rvector()
 {
+   initFixed(inlineElementD, NUM_DATA_INIT);
+   Set(vec);
 }
 
 //------------------------------------------------------------------------------
@@ -121,20 +130,30 @@ Rvector6::Rvector6(const Real vec[6])
  */
 //------------------------------------------------------------------------------
 Rvector6::Rvector6(const Rvector6 &v)
-   : Rvector(v)
+   : Rvector()
 {
+   // A vector resized to another size is copied as it is
+   if (v.sizeD == NUM_DATA_INIT)
+      initFixed(inlineElementD, NUM_DATA_INIT);
+   else
+      init(v.sizeD);
+   for (Integer i = 0; i < sizeD; i++)
+      elementD[i] = v.elementD[i];
 }
 
 //------------------------------------------------------------------------------
 //  Rvector6(const RealArray &ra)
 //------------------------------------------------------------------------------
 Rvector6::Rvector6(const RealArray &ra)
-: Rvector(ra)
+: Rvector()
 {
    // This check must be made here or the resulting Rvector6 may not
    // be of size 6!!
    if (ra.size() != 6)
       throw ArrayTemplateExceptions::DimensionError();
+
+   initFixed(inlineElementD, NUM_DATA_INIT);
+   Set(&ra[0]);
 }
 
 
@@ -274,9 +293,9 @@ void Rvector6::SetR(const Rvector3 &v)
 //------------------------------------------------------------------------------
 void Rvector6::SetV(const Rvector3 &v)
 {
-   elementD[3] = v.Get(3);
-   elementD[4] = v.Get(4);
-   elementD[5] = v.Get(5);
+   elementD[3] = v.Get(0);
+   elementD[4] = v.Get(1);
+   elementD[5] = v.Get(2);
 }
 
 //------------------------------------------------------------------------------
@@ -288,12 +307,12 @@ void Rvector6::SetV(const Rvector3 &v)
 //------------------------------------------------------------------------------
 bool Rvector6::operator==(const Rvector6 &v) const
 {
-   if (elementD[0] == v[0] &&
-       elementD[1] == v[1] &&
-       elementD[2] == v[2] &&
-       elementD[3] == v[3] &&
-       elementD[4] == v[4] &&
-       elementD[5] == v[5])
+   if (elementD[0] == v.elementD[0] &&
+       elementD[1] == v.elementD[1] &&
+       elementD[2] == v.elementD[2] &&
+       elementD[3] == v.elementD[3] &&
+       elementD[4] == v.elementD[4] &&
+       elementD[5] == v.elementD[5])
    {
       return true;
    }
@@ -434,10 +453,8 @@ const Rvector6& Rvector6::operator*=(Real s)
 Real Rvector6::operator*(const Rvector6& v) const 
 {
    Real sum = 0.0;
-   
-   for (int i=0; i<sizeD; i++)
+   for (Integer i = 0; i < sizeD; i++)
       sum += elementD[i] * v.elementD[i];
-   
    return sum;
 }
 
@@ -26,6 +26,9 @@
 //
 /**
  * Provides linear algebra operations for 6-element Real vectors.
+ *
+ * The elements are held in the object, so constructing and copying an
+ * Rvector6 does not allocate.
  */
 //------------------------------------------------------------------------------
 #ifndef Rvector6_hpp
@@ -98,5 +101,8 @@ public:
 private:
    static const Integer NUM_DATA;
    static const std::string DATA_DESCRIPTIONS[NUM_DATA_INIT];
+
+   /// Element storage, used by the base class through elementD
+   Real inlineElementD[NUM_DATA_INIT];
 };
 #endif // Rvector6_hpp
@@ -1656,6 +1656,7 @@ bool STKEphemerisFile::ReadDataRecords(int logOption)
       }
    }
    a1EndEpoch = currentEpoch;
+   ResetLookup();
 
    #ifdef DEBUG_SEGMENTING
       MessageInterface::ShowMessage("Segment Start Times:\n");
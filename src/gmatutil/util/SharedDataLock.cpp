@@ -0,0 +1,128 @@
+//$Id$
+//------------------------------------------------------------------------------
+//                              SharedDataLock
+//------------------------------------------------------------------------------
+// GMAT: General Mission Analysis Tool
+//
+// Copyright (c) 2002 - 2020 United States Government as represented by the
+// Administrator of the National Aeronautics and Space Administration.
+// All Other Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// You may not use this file except in compliance with the License.
+// You may obtain a copy of the License at:
+// http://www.apache.org/licenses/LICENSE-2.0.
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied.   See the License for the specific language
+// governing permissions and limitations under the License.
+//
+// Author: GMAT Development Team
+// Created: 2026/10/17
+//
+/**
+ * Implements the lock that protects the run's shared data during parallel work.
+ */
+//------------------------------------------------------------------------------
+#include "SharedDataLock.hpp"
+#include <atomic>
+#include <mutex>
+
+//---------------------------------
+// static data
+//---------------------------------
+
+/// The lock itself
+static std::mutex sharedDataMutex;
+/// Number of Enable() calls not yet matched by Disable()
+static std::atomic<Integer> enableCount(0);
+/// Set while the calling thread holds the lock
+static thread_local bool held = false;
+
+//---------------------------------
+// public
+//---------------------------------
+
+//------------------------------------------------------------------------------
+// void Enable()
+//------------------------------------------------------------------------------
+/**
+ * Turns the lock on; call before starting parallel tasks.  Calls nest.
+ */
+//------------------------------------------------------------------------------
+void SharedDataLock::Enable()
+{
+   ++enableCount;
+}
+
+
+//------------------------------------------------------------------------------
+// void Disable()
+//------------------------------------------------------------------------------
+/**
+ * Undoes an Enable(); call after the parallel tasks are done.
+ */
+//------------------------------------------------------------------------------
+void SharedDataLock::Disable()
+{
+   if (enableCount > 0)
+      --enableCount;
+}
+
+
+//------------------------------------------------------------------------------
+// bool IsEnabled()
+//------------------------------------------------------------------------------
+bool SharedDataLock::IsEnabled()
+{
+   return enableCount > 0;
+}
+
+
+//------------------------------------------------------------------------------
+// Guard()
+//------------------------------------------------------------------------------
+SharedDataLock::Guard::Guard() :
+   locked   (false)
+{
+   if (IsEnabled() && !held)
+   {
+      Lock();
+      locked = true;
+   }
+}
+
+
+//------------------------------------------------------------------------------
+// ~Guard()
+//------------------------------------------------------------------------------
+SharedDataLock::Guard::~Guard()
+{
+   if (locked && held)
+      Unlock();
+}
+
+
+//---------------------------------
+// private
+//---------------------------------
+
+//------------------------------------------------------------------------------
+// void Lock()
+//------------------------------------------------------------------------------
+void SharedDataLock::Lock()
+{
+   sharedDataMutex.lock();
+   held = true;
+}
+
+
+//------------------------------------------------------------------------------
+// void Unlock()
+//------------------------------------------------------------------------------
+void SharedDataLock::Unlock()
+{
+   held = false;
+   sharedDataMutex.unlock();
+}
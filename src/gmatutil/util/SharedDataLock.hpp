@@ -0,0 +1,64 @@
+//$Id$
+//------------------------------------------------------------------------------
+//                              SharedDataLock
+//------------------------------------------------------------------------------
+// GMAT: General Mission Analysis Tool
+//
+// Copyright (c) 2002 - 2020 United States Government as represented by the
+// Administrator of the National Aeronautics and Space Administration.
+// All Other Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// You may not use this file except in compliance with the License.
+// You may obtain a copy of the License at:
+// http://www.apache.org/licenses/LICENSE-2.0.
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied.   See the License for the specific language
+// governing permissions and limitations under the License.
+//
+// Author: GMAT Development Team
+// Created: 2026/10/17
+//
+/**
+ * Declares the lock that protects the run's shared data during parallel work.
+ *
+ * Objects shared by all of the force models of a run (celestial bodies and
+ * their ephemeris readers, the EOP file, the body atmosphere models) keep
+ * unsynchronized caches.  Code that runs force models on several threads
+ * enables the lock, and those objects hold a Guard while they read or update
+ * their caches; everything else runs unlocked.  While the lock is not enabled,
+ * Guard does nothing.
+ */
+//------------------------------------------------------------------------------
+#ifndef SharedDataLock_hpp
+#define SharedDataLock_hpp
+
+#include "utildefs.hpp"
+
+class GMATUTIL_API SharedDataLock
+{
+public:
+   static void Enable();
+   static void Disable();
+   static bool IsEnabled();
+
+   /// Holds the lock for its lifetime, unless the thread holds it already
+   class GMATUTIL_API Guard
+   {
+   public:
+      Guard();
+      ~Guard();
+   private:
+      bool locked;
+      Guard(const Guard&);
+      Guard& operator=(const Guard&);
+   };
+
+private:
+   static void Lock();
+   static void Unlock();
+};
+
+#endif // SharedDataLock_hpp
@@ -42,7 +42,7 @@
 template <class T>
 TableTemplate<T>::TableTemplate()
    :
-   elementD((T*) 0), rowsD(0), colsD(0), isSizedD(false)
+   elementD((T*) 0), rowsD(0), colsD(0), isSizedD(false), ownsElementsD(true)
 {
 }
 
@@ -137,6 +137,45 @@ TableTemplate<T>::TableTemplate(const TableTemplate<T> &Table)
    }
 }
 
+//------------------------------------------------------------------------------
+//  <move constructor>
+//  TableTemplate(TableTemplate<T> &&table)
+//
+//  Notes: Takes over the elements of table, leaving it unsized.  Elements held
+//         in the storage of a fixed size class are copied.
+//------------------------------------------------------------------------------
+template <class T>
+TableTemplate<T>::TableTemplate(TableTemplate<T> &&table)
+   :
+   elementD((T*) 0), rowsD(0), colsD(0), isSizedD(false), ownsElementsD(true)
+{
+   if (table.IsSized() == false)
+   {
+      throw TableTemplateExceptions::UnsizedTable();
+   }
+
+   if (table.ownsElementsD)
+   {
+      elementD = table.elementD;
+      rowsD    = table.rowsD;
+      colsD    = table.colsD;
+      isSizedD = true;
+
+      table.elementD = (T*) 0;
+      table.rowsD    = 0;
+      table.colsD    = 0;
+      table.isSizedD = false;
+   }
+   else
+   {
+      init(table.rowsD, table.colsD);
+      for (int i = 0; i < rowsD*colsD; i++)
+      {
+         elementD[i] = table.elementD[i];
+      }
+   }
+}
+
 //------------------------------------------------------------------------------
 //  <destructor>
 //  ~TableTemplate()
@@ -144,7 +183,8 @@ TableTemplate<T>::TableTemplate(const TableTemplate<T> &Table)
 template <class T>
 TableTemplate<T>::~TableTemplate() 
 {
-   delete[] elementD;
+   if (ownsElementsD)
+      delete[] elementD;
 }
 
 //------------------------------------------------------------------------------
@@ -256,6 +296,53 @@ TableTemplate<T>::operator=(const TableTemplate<T> &table)
    return *this;
 }
 
+//------------------------------------------------------------------------------
+//  TableTemplate<T>& operator=(TableTemplate<T> &&table)
+//
+//  Notes: Exchanges the element storage when both tables own it, and copies
+//         otherwise.  The size rules are those of the copy assignment.
+//------------------------------------------------------------------------------
+template <class T>
+TableTemplate<T>&
+TableTemplate<T>::operator=(TableTemplate<T> &&table) 
+{
+   if (this == &table)
+      return *this;
+
+   if (table.IsSized() == false)
+   {
+      throw TableTemplateExceptions::UnsizedTable();
+   }
+
+   if (!ownsElementsD || !table.ownsElementsD)
+      return operator=(static_cast<const TableTemplate<T>&>(table));
+
+   if ((isSizedD == true) &&
+       ((rowsD != table.rowsD) || (colsD != table.colsD)))
+   {
+      throw TableTemplateExceptions::DimensionError();
+   }
+
+   T *previous = elementD;
+   bool wasSized = isSizedD;
+
+   elementD = table.elementD;
+   rowsD    = table.rowsD;
+   colsD    = table.colsD;
+   isSizedD = true;
+
+   // table takes the old elements, and is deleted or reused by its owner
+   table.elementD = previous;
+   if (wasSized == false)
+   {
+      table.rowsD    = 0;
+      table.colsD    = 0;
+      table.isSizedD = false;
+   }
+
+   return *this;
+}
+
 //------------------------------------------------------------------------------
 //  virtual T GetElement(int r, int c)
 //
@@ -317,6 +404,21 @@ TableTemplate<T>::SetSize(int r, int c, bool zeroElements)
    Integer  oldRows         = rowsD;
    Integer  oldCols         = colsD;
 
+   if ((r < 0) || (c < 0))
+   {
+      throw TableTemplateExceptions::IllegalSize();
+   }
+
+   // Fixed size storage is kept when the size does not change, and replaced
+   // by allocated storage when it does
+   if ((isSizedD == true) && !ownsElementsD && (r == rowsD) && (c == colsD))
+   {
+      if (zeroElements)
+         for (int i = 0; i < rowsD*colsD; i++)
+            elementD[i] = 0.0;
+      return;
+   }
+
    if (isSizedD == true)
    {
       //throw TableTemplateExceptions::TableAlreadySized();
@@ -327,12 +429,8 @@ TableTemplate<T>::SetSize(int r, int c, bool zeroElements)
          for (int i=0; i<rowsD*colsD; i++)
             saved[i] = elementD[i];
       }
-      delete [] elementD;
-   }
-
-   if ((r < 0) || (c < 0))
-   {
-      throw TableTemplateExceptions::IllegalSize();
+      if (ownsElementsD)
+         delete [] elementD;
    }
 
    init(r, c);
@@ -368,6 +466,15 @@ TableTemplate<T>::ChangeSize(int r, int c, bool zeroElements)
       throw TableTemplateExceptions::IllegalSize();
    }
 
+   // Fixed size storage is kept when the size does not change
+   if (!ownsElementsD && (r == rowsD) && (c == colsD))
+   {
+      if (zeroElements)
+         for (int i = 0; i < rowsD*colsD; i++)
+            elementD[i] = 0.0;
+      return;
+   }
+
 
    // Step 1. Copy current table to a temporary buffer
    T        *saved          = NULL;
@@ -387,7 +494,7 @@ TableTemplate<T>::ChangeSize(int r, int c, bool zeroElements)
 
 
    // Step 2. Remove the current table
-   if (elementD != NULL)
+   if ((elementD != NULL) && ownsElementsD)
       delete [] elementD;
    elementD = NULL;
 
@@ -473,5 +580,24 @@ TableTemplate<T>::init(int r, int c)
          elementD[i] = 0.0;
    }
    isSizedD = true;
+   ownsElementsD = true;
+}
+
+//------------------------------------------------------------------------------
+//  void initFixed(T *storage, int r, int c)
+//
+//  Notes: Used by fixed size derived classes, which hold their r*c elements
+//         in storage that lives as long as the object and is not deleted here.
+//         Unlike init(), the elements are not set to zero.
+//------------------------------------------------------------------------------
+template <class T>
+void
+TableTemplate<T>::initFixed(T *storage, int r, int c)
+{
+   rowsD = r;
+   colsD = c;
+   elementD = storage;
+   isSizedD = true;
+   ownsElementsD = false;
 }
 
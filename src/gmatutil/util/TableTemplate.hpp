@@ -86,11 +86,13 @@ public:
     // TableTemplate(Integer r, Integer c, const T &a11,...);
     TableTemplate(Integer r, Integer c, const T* array);
     TableTemplate(const TableTemplate<T> &table);
+    TableTemplate(TableTemplate<T> &&table);
     virtual ~TableTemplate();
 
     T& operator()(Integer r, Integer c);
     const T& operator()(Integer r, Integer c) const;
     TableTemplate<T>& operator=(const TableTemplate<T> &table);
+    TableTemplate<T>& operator=(TableTemplate<T> &&table);
     bool operator==(const TableTemplate<T> &table) const;
     bool operator!=(const TableTemplate<T> &table) const;
     
@@ -104,13 +106,16 @@ public:
     virtual Integer  GetNumColumns() const;
     virtual Integer  GetNumRows() const;
     
-    const T* GetDataVector() {return elementD;}
+    const T* GetDataVector() const {return elementD;}
    
 protected:
     T   *elementD;
     Integer rowsD, colsD;
     bool isSizedD;
+    /// false when elementD is storage held by a fixed size derived class
+    bool ownsElementsD;
     void init(Integer r, Integer c);
+    void initFixed(T *storage, Integer r, Integer c);
 
 private:
 };
@@ -0,0 +1,320 @@
+//$Id$
+//------------------------------------------------------------------------------
+//                                WorkerPool
+//------------------------------------------------------------------------------
+// GMAT: General Mission Analysis Tool
+//
+// Copyright (c) 2002 - 2020 United States Government as represented by the
+// Administrator of the National Aeronautics and Space Administration.
+// All Other Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// You may not use this file except in compliance with the License.
+// You may obtain a copy of the License at:
+// http://www.apache.org/licenses/LICENSE-2.0.
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied.   See the License for the specific language
+// governing permissions and limitations under the License.
+//
+// Author: GMAT Development Team
+// Created: 2026/10/17
+//
+/**
+ * Implements the process-wide pool of worker threads used for parallel loops.
+ */
+//------------------------------------------------------------------------------
+#include "WorkerPool.hpp"
+#include "MessageInterface.hpp"
+
+//#define DEBUG_WORKER_POOL
+
+//---------------------------------
+// static data
+//---------------------------------
+WorkerPool* WorkerPool::instance = NULL;
+
+/// Set on threads that are executing pool tasks
+static thread_local bool inPoolTask = false;
+
+//---------------------------------
+// public
+//---------------------------------
+
+//------------------------------------------------------------------------------
+// WorkerPool* Instance()
+//------------------------------------------------------------------------------
+/**
+ * Returns a pointer to the instance of the singleton.
+ *
+ * @return pointer to the instance
+ */
+//------------------------------------------------------------------------------
+WorkerPool* WorkerPool::Instance()
+{
+   static std::mutex instanceMutex;
+   std::lock_guard<std::mutex> lock(instanceMutex);
+
+   if (instance == NULL)
+      instance = new WorkerPool();
+
+   return instance;
+}
+
+
+//------------------------------------------------------------------------------
+// void Run(Integer taskCount, const std::function<void(Integer)> &task)
+//------------------------------------------------------------------------------
+/**
+ * Runs task(i) for i = 0 ... taskCount-1 and waits for all of them.
+ *
+ * Tasks are handed out in index order to the workers and the calling thread.
+ * Every task runs even if another one throws; the first exception is then
+ * rethrown here.
+ *
+ * @param taskCount Number of tasks
+ * @param task      The task body; called with the task index
+ */
+//------------------------------------------------------------------------------
+void WorkerPool::Run(Integer taskCount,
+                     const std::function<void(Integer)> &task)
+{
+   if (taskCount <= 0)
+      return;
+
+   if (inPoolTask || (taskCount == 1) || (threadCount <= 1))
+   {
+      // Nested or trivial loop: run it here
+      bool wasInTask = inPoolTask;
+      inPoolTask = true;
+      std::exception_ptr error;
+      for (Integer i = 0; i < taskCount; ++i)
+      {
+         try
+         {
+            task(i);
+         }
+         catch (...)
+         {
+            if (!error)
+               error = std::current_exception();
+         }
+      }
+      inPoolTask = wasInTask;
+      if (error)
+         std::rethrow_exception(error);
+      return;
+   }
+
+   std::lock_guard<std::mutex> runLock(runMutex);
+
+   std::unique_lock<std::mutex> lock(poolMutex);
+   if (workers.empty())
+      StartWorkers();
+
+   job          = &task;
+   jobSize      = taskCount;
+   nextTask     = 0;
+   pendingTasks = taskCount;
+   firstError   = std::exception_ptr();
+   ++generation;
+   lock.unlock();
+   workReady.notify_all();
+
+   #ifdef DEBUG_WORKER_POOL
+      MessageInterface::ShowMessage("WorkerPool::Run(): %d tasks on %d "
+            "threads\n", taskCount, threadCount);
+   #endif
+
+   ExecuteTasks();
+
+   lock.lock();
+   jobDone.wait(lock, [this]{ return (pendingTasks == 0) && (busyWorkers == 0); });
+   job = NULL;
+   std::exception_ptr error = firstError;
+   firstError = std::exception_ptr();
+   lock.unlock();
+
+   if (error)
+      std::rethrow_exception(error);
+}
+
+
+//------------------------------------------------------------------------------
+// void SetThreadCount(Integer count)
+//------------------------------------------------------------------------------
+/**
+ * Sets the number of threads used by Run(), counting the caller.
+ *
+ * @param count The thread count; 0 selects one thread per core, and 1 makes
+ *              Run() serial
+ */
+//------------------------------------------------------------------------------
+void WorkerPool::SetThreadCount(Integer count)
+{
+   std::lock_guard<std::mutex> runLock(runMutex);
+
+   if (count <= 0)
+      count = (Integer)std::thread::hardware_concurrency();
+   if (count < 1)
+      count = 1;
+
+   if (count == threadCount)
+      return;
+
+   StopWorkers();
+   threadCount = count;
+}
+
+
+//------------------------------------------------------------------------------
+// Integer GetThreadCount()
+//------------------------------------------------------------------------------
+Integer WorkerPool::GetThreadCount()
+{
+   std::lock_guard<std::mutex> lock(poolMutex);
+   return threadCount;
+}
+
+
+//---------------------------------
+// private
+//---------------------------------
+
+//------------------------------------------------------------------------------
+// WorkerPool()
+//------------------------------------------------------------------------------
+WorkerPool::WorkerPool() :
+   threadCount    ((Integer)std::thread::hardware_concurrency()),
+   job            (NULL),
+   jobSize        (0),
+   nextTask       (0),
+   pendingTasks   (0),
+   busyWorkers    (0),
+   generation     (0),
+   stopping       (false)
+{
+   if (threadCount < 1)
+      threadCount = 1;
+}
+
+
+//------------------------------------------------------------------------------
+// ~WorkerPool()
+//------------------------------------------------------------------------------
+WorkerPool::~WorkerPool()
+{
+   StopWorkers();
+}
+
+
+//------------------------------------------------------------------------------
+// void StartWorkers()
+//------------------------------------------------------------------------------
+/**
+ * Starts the worker threads; called with poolMutex held.
+ */
+//------------------------------------------------------------------------------
+void WorkerPool::StartWorkers()
+{
+   stopping = false;
+   // Workers start from the current generation so they pick up the job that
+   // is about to be posted
+   for (Integer i = 1; i < threadCount; ++i)
+      workers.push_back(std::thread(&WorkerPool::WorkerLoop, this,
+                                    generation));
+}
+
+
+//------------------------------------------------------------------------------
+// void StopWorkers()
+//------------------------------------------------------------------------------
+/**
+ * Stops and joins the worker threads; they are restarted by the next Run().
+ */
+//------------------------------------------------------------------------------
+void WorkerPool::StopWorkers()
+{
+   {
+      std::lock_guard<std::mutex> lock(poolMutex);
+      stopping = true;
+   }
+   workReady.notify_all();
+
+   for (UnsignedInt i = 0; i < workers.size(); ++i)
+      workers[i].join();
+   workers.clear();
+}
+
+
+//------------------------------------------------------------------------------
+// void WorkerLoop(unsigned long seen)
+//------------------------------------------------------------------------------
+/**
+ * Body of the worker threads: waits for a job, helps execute it, repeats.
+ *
+ * @param seen The last job generation this worker has already handled
+ */
+//------------------------------------------------------------------------------
+void WorkerPool::WorkerLoop(unsigned long seen)
+{
+   std::unique_lock<std::mutex> lock(poolMutex);
+
+   while (true)
+   {
+      workReady.wait(lock, [this, &seen]{
+         return stopping || ((job != NULL) && (generation != seen)); });
+      if (stopping)
+         return;
+
+      seen = generation;
+      ++busyWorkers;
+      lock.unlock();
+
+      ExecuteTasks();
+
+      lock.lock();
+      --busyWorkers;
+      if ((pendingTasks == 0) && (busyWorkers == 0))
+         jobDone.notify_all();
+   }
+}
+
+
+//------------------------------------------------------------------------------
+// void ExecuteTasks()
+//------------------------------------------------------------------------------
+/**
+ * Claims and runs tasks of the current job until none are left.
+ */
+//------------------------------------------------------------------------------
+void WorkerPool::ExecuteTasks()
+{
+   inPoolTask = true;
+
+   while (true)
+   {
+      Integer index = nextTask.fetch_add(1);
+      if (index >= jobSize)
+         break;
+
+      std::exception_ptr error;
+      try
+      {
+         (*job)(index);
+      }
+      catch (...)
+      {
+         error = std::current_exception();
+      }
+
+      std::lock_guard<std::mutex> lock(poolMutex);
+      if (error && !firstError)
+         firstError = error;
+      if (--pendingTasks == 0)
+         jobDone.notify_all();
+   }
+
+   inPoolTask = false;
+}
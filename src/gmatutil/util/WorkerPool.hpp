@@ -0,0 +1,93 @@
+//$Id$
+//------------------------------------------------------------------------------
+//                                WorkerPool
+//------------------------------------------------------------------------------
+// GMAT: General Mission Analysis Tool
+//
+// Copyright (c) 2002 - 2020 United States Government as represented by the
+// Administrator of the National Aeronautics and Space Administration.
+// All Other Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// You may not use this file except in compliance with the License.
+// You may obtain a copy of the License at:
+// http://www.apache.org/licenses/LICENSE-2.0.
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied.   See the License for the specific language
+// governing permissions and limitations under the License.
+//
+// Author: GMAT Development Team
+// Created: 2026/10/17
+//
+/**
+ * Declares the process-wide pool of worker threads used for parallel loops.
+ *
+ * Run() executes task(0) ... task(count-1) on the pool and the calling thread
+ * and returns when all of them are done.  The first exception thrown by a task
+ * is rethrown on the calling thread.  Calls made from inside a task run
+ * serially, so nested parallel loops do not deadlock.
+ */
+//------------------------------------------------------------------------------
+#ifndef WorkerPool_hpp
+#define WorkerPool_hpp
+
+#include "utildefs.hpp"
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+class GMATUTIL_API WorkerPool
+{
+public:
+   static WorkerPool* Instance();
+
+   void     Run(Integer taskCount, const std::function<void(Integer)> &task);
+
+   void     SetThreadCount(Integer count);
+   Integer  GetThreadCount();
+
+private:
+   WorkerPool();
+   ~WorkerPool();
+
+   // The pool is a singleton; no copies
+   WorkerPool(const WorkerPool&);
+   WorkerPool& operator=(const WorkerPool&);
+
+   void     StartWorkers();
+   void     StopWorkers();
+   void     WorkerLoop(unsigned long seen);
+   void     ExecuteTasks();
+
+   /// Threads used by Run(), including the caller
+   Integer                 threadCount;
+   /// The worker threads (threadCount - 1 of them once started)
+   std::vector<std::thread> workers;
+
+   /// The current job
+   const std::function<void(Integer)> *job;
+   Integer                 jobSize;
+   std::atomic<Integer>    nextTask;
+   Integer                 pendingTasks;
+   Integer                 busyWorkers;
+   unsigned long           generation;
+   bool                    stopping;
+   std::exception_ptr      firstError;
+
+   /// Guards the job state
+   std::mutex              poolMutex;
+   /// Serializes Run() calls from different threads
+   std::mutex              runMutex;
+   std::condition_variable workReady;
+   std::condition_variable jobDone;
+
+   static WorkerPool       *instance;
+};
+
+#endif // WorkerPool_hpp
@@ -36,7 +36,7 @@
 #include "MessageInterface.hpp"
 
 
-#define DEBUG_ZERO_FINDER
+//#define DEBUG_ZERO_FINDER
 
 
 BrentDekkerZero::BrentDekkerZero() :
@@ -76,6 +76,11 @@ void BrentDekkerZero::SetInterval(Real a0, Real b0, Real fa0, Real fb0,
    
    // Load up the c, fc, d, e variables
    SwapAC();
+
+   // Bracket half-width and tolerance, so CheckConvergence() is valid
+   // before the first step
+   tol = 2.0 * macheps * fabs(b) + t;
+   m = 0.5 * (c - b);
 }
 
 
@@ -193,7 +198,9 @@ Real BrentDekkerZero::TestDriver(Real aVal, Real bVal, Real tVal)
    SetInterval(aVal, bVal, fa0, fb0, tVal);
 
    Real newVal = bVal, nextVal = bVal, fNext;
-   Integer count = 0;
+   #ifdef DEBUG_ZERO_FINDER
+      Integer count = 0;
+   #endif
    while (CheckConvergence())
    {
       #ifdef DEBUG_ZERO_FINDER
@@ -257,10 +264,8 @@ void BrentDekkerZero::FindStepParameters()
 }
 
 
-#ifdef DEBUG_ZERO_FINDER
-   Real BrentDekkerZero::TestFunction(Real x)
-   {
-      // Zero at about 0.7544
-      return 3.0 * x * x * x - x * x + 7.0 * x - 6.0;  
-   }
-#endif
+Real BrentDekkerZero::TestFunction(Real x)
+{
+   // Zero at about 0.7544
+   return 3.0 * x * x * x - x * x + 7.0 * x - 6.0;
+}
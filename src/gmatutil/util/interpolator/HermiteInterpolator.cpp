@@ -46,7 +46,8 @@ HermiteInterpolator::HermiteInterpolator(const std::string &name, Integer dim,
       Integer points) :
    Interpolator            (name, "HermiteInterpolator", dim),
    pointsWanted            (points),
-   interpolateNewtonian    (true)
+   interpolateNewtonian    (true),
+   coefficientsCurrent     (false)
 {
    bufferSize = pointsWanted+1;
 }
@@ -76,7 +77,8 @@ HermiteInterpolator::~HermiteInterpolator()
 HermiteInterpolator::HermiteInterpolator(const HermiteInterpolator &hi) :
    Interpolator            (hi),
    pointsWanted            (hi.pointsWanted),
-   interpolateNewtonian    (hi.interpolateNewtonian)
+   interpolateNewtonian    (hi.interpolateNewtonian),
+   coefficientsCurrent     (false)
 {
 }
 
@@ -100,6 +102,7 @@ HermiteInterpolator& HermiteInterpolator::operator=(const HermiteInterpolator &h
 
       pointsWanted         = hi.pointsWanted;
       interpolateNewtonian = hi.interpolateNewtonian;
+      coefficientsCurrent  = false;
 
       CleanupArrays();
    }
@@ -133,10 +136,30 @@ void HermiteInterpolator::Clear()
    derivatives.clear();
    qCoeffs.clear();
    tValues.clear();
+   coefficientsCurrent = false;
    Interpolator::Clear();
 }
 
 
+//------------------------------------------------------------------------------
+// bool AddPoint(const Real ind, const Real *data)
+//------------------------------------------------------------------------------
+/**
+ * Adds a data point, invalidating the polynomial coefficients
+ *
+ * @param ind  The value of the independent parameter
+ * @param data The dependent data at ind
+ *
+ * @return true on success
+ */
+//------------------------------------------------------------------------------
+bool HermiteInterpolator::AddPoint(const Real ind, const Real *data)
+{
+   coefficientsCurrent = false;
+   return Interpolator::AddPoint(ind, data);
+}
+
+
 //------------------------------------------------------------------------------
 // bool AddDerivative(const Real ind, const Real *data, const Integer order)
 //------------------------------------------------------------------------------
@@ -165,6 +188,8 @@ bool HermiteInterpolator::AddDerivative(const Real ind, const Real *data,
       throw InterpolatorException("The Hermite interpolator is only configured "
             "through first order derivatives.");
 
+   coefficientsCurrent = false;
+
    // Setup the data structure if needed: derivatives[element][point][deriv]
    if (derivatives.size() == 0)
    {
@@ -269,7 +294,7 @@ bool HermiteInterpolator::Interpolate(const Real ind, Real *results)
 
    if (interpolateNewtonian)
    {
-      if (BuildQCoefficients())
+      if (coefficientsCurrent || BuildQCoefficients())
          retval = EvaluatePolynomial(ind, results);
    }
    else
@@ -305,7 +330,7 @@ bool HermiteInterpolator::InterpolateCartesianState(const Real ind, Real *result
    if (interpolateNewtonian)
    {
       Real derivative[6];
-      if (BuildQCoefficients())
+      if (coefficientsCurrent || BuildQCoefficients())
       {
          retval = EvaluatePolynomial(ind, results);
          if (retval)
@@ -439,6 +464,8 @@ bool HermiteInterpolator::BuildQCoefficients()
       retval = true;
    }
 
+   coefficientsCurrent = retval;
+
    #ifdef DUMP_INTERPOLATOR_DATA
       MessageInterface::ShowMessage("Q matrix:\n");
       for (UnsignedInt i = 0; i < qCoeffs.size(); ++i)
@@ -75,6 +75,7 @@ public:
    virtual Interpolator*   Clone() const;
    virtual void            Clear();
 
+   virtual bool            AddPoint(const Real ind, const Real *data);
    virtual bool            AddDerivative(const Real ind, const Real *data,
                                  const Integer order = 1);
    virtual bool            Interpolate(const Real ind, Real *results);
@@ -94,6 +95,9 @@ protected:
    std::vector<RealArray> qCoeffs;
    /// Independent data used with the polynomials
    std::vector<RealArray> tValues;
+   /// Flag indicating that qCoeffs match the current points, so repeated
+   /// interpolation in the same span skips the divided differences
+   bool coefficientsCurrent;
 
 //   // Inherited methods that need some revision for HermiteInterpolator
 //   virtual void AllocateArrays();
@@ -0,0 +1,806 @@
+//$Id$
+//------------------------------------------------------------------------------
+//                             BlockNormalEquations
+//------------------------------------------------------------------------------
+// GMAT: General Mission Analysis Tool
+//
+// Copyright (c) 2002 - 2020 United States Government as represented by the
+// Administrator of the National Aeronautics and Space Administration.
+// All Other Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// You may not use this file except in compliance with the License.
+// You may obtain a copy of the License at:
+// http://www.apache.org/licenses/LICENSE-2.0.
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied.   See the License for the specific language
+// governing permissions and limitations under the License.
+//
+// Author: GMAT Development Team
+// Created: 2026/10/17
+//
+/**
+ * Implements BlockNormalEquations class.
+ */
+//------------------------------------------------------------------------------
+
+#include "BlockNormalEquations.hpp"
+#include "UtilityException.hpp"
+#include <algorithm>
+#include <cmath>
+
+//------------------------------------------------------------------------------
+// BlockNormalEquations()
+//------------------------------------------------------------------------------
+/**
+ * Constructor
+ */
+//------------------------------------------------------------------------------
+BlockNormalEquations::BlockNormalEquations() :
+   parameterCount    (0),
+   isSolved          (false)
+{
+}
+
+//------------------------------------------------------------------------------
+// BlockNormalEquations(const BlockNormalEquations &bne)
+//------------------------------------------------------------------------------
+/**
+ * Copy constructor
+ */
+//------------------------------------------------------------------------------
+BlockNormalEquations::BlockNormalEquations(const BlockNormalEquations &bne) :
+   parameterCount    (bne.parameterCount),
+   blockOf           (bne.blockOf),
+   position          (bne.position),
+   globalIndex       (bne.globalIndex),
+   globalInfo        (bne.globalInfo),
+   globalRhs         (bne.globalRhs),
+   blocks            (bne.blocks),
+   activeGlobal      (bne.activeGlobal),
+   schurFactor       (bne.schurFactor),
+   removedIndexes    (bne.removedIndexes),
+   isSolved          (bne.isSolved)
+{
+}
+
+//------------------------------------------------------------------------------
+// ~BlockNormalEquations()
+//------------------------------------------------------------------------------
+/**
+ * Destructor
+ */
+//------------------------------------------------------------------------------
+BlockNormalEquations::~BlockNormalEquations()
+{
+}
+
+//------------------------------------------------------------------------------
+// BlockNormalEquations& operator=(const BlockNormalEquations &bne)
+//------------------------------------------------------------------------------
+/**
+ * Assignment operator
+ */
+//------------------------------------------------------------------------------
+BlockNormalEquations& BlockNormalEquations::operator=(
+      const BlockNormalEquations &bne)
+{
+   if (this != &bne)
+   {
+      parameterCount = bne.parameterCount;
+      blockOf        = bne.blockOf;
+      position       = bne.position;
+      globalIndex    = bne.globalIndex;
+      globalInfo     = bne.globalInfo;
+      globalRhs      = bne.globalRhs;
+      blocks         = bne.blocks;
+      activeGlobal   = bne.activeGlobal;
+      schurFactor    = bne.schurFactor;
+      removedIndexes = bne.removedIndexes;
+      isSolved       = bne.isSolved;
+   }
+   return *this;
+}
+
+//------------------------------------------------------------------------------
+// void SetStructure(const IntegerArray &parameterBlocks)
+//------------------------------------------------------------------------------
+/**
+ * Defines the parameters and clears the normal equations
+ *
+ * @param parameterBlocks The block of each parameter: -1 for a global
+ *                        parameter, or the index, starting at 0, of the block
+ *                        of local parameters it belongs to
+ */
+//------------------------------------------------------------------------------
+void BlockNormalEquations::SetStructure(const IntegerArray &parameterBlocks)
+{
+   parameterCount = parameterBlocks.size();
+   blockOf = parameterBlocks;
+   position.assign(parameterCount, 0);
+   globalIndex.clear();
+
+   Integer blockCount = 0;
+   for (Integer i = 0; i < parameterCount; ++i)
+      blockCount = std::max(blockCount, blockOf[i] + 1);
+
+   blocks.assign(blockCount, LocalBlock());
+   for (Integer i = 0; i < parameterCount; ++i)
+   {
+      if (blockOf[i] < 0)
+      {
+         blockOf[i] = -1;
+         position[i] = globalIndex.size();
+         globalIndex.push_back(i);
+      }
+      else
+      {
+         position[i] = blocks[blockOf[i]].index.size();
+         blocks[blockOf[i]].index.push_back(i);
+      }
+   }
+
+   Clear();
+}
+
+//------------------------------------------------------------------------------
+// void Clear()
+//------------------------------------------------------------------------------
+/**
+ * Zeros the information matrix and the right hand side
+ */
+//------------------------------------------------------------------------------
+void BlockNormalEquations::Clear()
+{
+   Integer g = globalIndex.size();
+   globalInfo.assign(g * g, 0.0);
+   globalRhs.assign(g, 0.0);
+
+   for (UnsignedInt b = 0; b < blocks.size(); ++b)
+   {
+      Integer l = blocks[b].index.size();
+      blocks[b].info.assign(l * l, 0.0);
+      blocks[b].coupling.assign(l * g, 0.0);
+      blocks[b].rhs.assign(l, 0.0);
+   }
+
+   isSolved = false;
+}
+
+//------------------------------------------------------------------------------
+// Integer GetParameterCount() const
+//------------------------------------------------------------------------------
+/**
+ * Returns the number of parameters
+ */
+//------------------------------------------------------------------------------
+Integer BlockNormalEquations::GetParameterCount() const
+{
+   return parameterCount;
+}
+
+//------------------------------------------------------------------------------
+// Integer GetBlockCount() const
+//------------------------------------------------------------------------------
+/**
+ * Returns the number of blocks of local parameters
+ */
+//------------------------------------------------------------------------------
+Integer BlockNormalEquations::GetBlockCount() const
+{
+   return blocks.size();
+}
+
+//------------------------------------------------------------------------------
+// void Accumulate(const RealArray &h, Real weight, Real residual)
+//------------------------------------------------------------------------------
+/**
+ * Adds a measurement to the normal equations
+ *
+ * The information matrix gets h^T weight h and the right hand side
+ * h^T weight residual.  A negative weight removes a measurement added before.
+ *
+ * @param h        Partials of the measurement w.r.t. every parameter
+ * @param weight   Weight of the measurement
+ * @param residual Observed minus computed value of the measurement
+ */
+//------------------------------------------------------------------------------
+void BlockNormalEquations::Accumulate(const RealArray &h, Real weight,
+      Real residual)
+{
+   if ((Integer)h.size() != parameterCount)
+      throw UtilityException("BlockNormalEquations: the measurement partials "
+            "do not match the number of parameters");
+
+   // Find the block of local parameters the measurement depends on
+   Integer block = -1;
+   for (Integer i = 0; i < parameterCount; ++i)
+   {
+      if ((h[i] != 0.0) && (blockOf[i] >= 0) && (blockOf[i] != block))
+      {
+         if (block >= 0)
+            throw UtilityException("BlockNormalEquations: a measurement "
+                  "depends on local parameters of two different blocks");
+         block = blockOf[i];
+      }
+   }
+
+   Integer g = globalIndex.size();
+   RealArray hg(g);
+   for (Integer i = 0; i < g; ++i)
+      hg[i] = h[globalIndex[i]];
+
+   for (Integer i = 0; i < g; ++i)
+   {
+      if (hg[i] == 0.0)
+         continue;
+      Real hw = hg[i] * weight;
+      Real *row = &globalInfo[i * g];
+      for (Integer j = 0; j < g; ++j)
+         row[j] += hw * hg[j];
+      globalRhs[i] += hw * residual;
+   }
+
+   if (block >= 0)
+   {
+      LocalBlock &lb = blocks[block];
+      Integer l = lb.index.size();
+      for (Integer k = 0; k < l; ++k)
+      {
+         Real hw = h[lb.index[k]] * weight;
+         if (hw == 0.0)
+            continue;
+         Real *row = &lb.info[k * l];
+         for (Integer m = 0; m < l; ++m)
+            row[m] += hw * h[lb.index[m]];
+         Real *coupling = (g > 0 ? &lb.coupling[k * g] : NULL);
+         for (Integer j = 0; j < g; ++j)
+            coupling[j] += hw * hg[j];
+         lb.rhs[k] += hw * residual;
+      }
+   }
+
+   isSolved = false;
+}
+
+//------------------------------------------------------------------------------
+// void AddInformation(const Rmatrix &info, const Rvector &rhs)
+//------------------------------------------------------------------------------
+/**
+ * Adds a full, symmetric information matrix and right hand side, e.g. the
+ * a priori information
+ *
+ * Elements coupling local parameters of different blocks must be zero.
+ *
+ * @param info The information matrix to add
+ * @param rhs  The right hand side to add
+ */
+//------------------------------------------------------------------------------
+void BlockNormalEquations::AddInformation(const Rmatrix &info,
+      const Rvector &rhs)
+{
+   if ((info.GetNumRows() != parameterCount) ||
+       (info.GetNumColumns() != parameterCount) ||
+       (rhs.GetSize() != parameterCount))
+      throw UtilityException("BlockNormalEquations: the information added "
+            "does not match the number of parameters");
+
+   for (Integer i = 0; i < parameterCount; ++i)
+   {
+      for (Integer j = 0; j < parameterCount; ++j)
+      {
+         if (info(i, j) != 0.0)
+            AddElement(i, j, info(i, j));
+      }
+
+      if (blockOf[i] < 0)
+         globalRhs[position[i]] += rhs[i];
+      else
+         blocks[blockOf[i]].rhs[position[i]] += rhs[i];
+   }
+
+   isSolved = false;
+}
+
+//------------------------------------------------------------------------------
+// Rmatrix GetInformation() const
+//------------------------------------------------------------------------------
+/**
+ * Returns the full information matrix
+ */
+//------------------------------------------------------------------------------
+Rmatrix BlockNormalEquations::GetInformation() const
+{
+   Rmatrix info(parameterCount, parameterCount);
+   Integer g = globalIndex.size();
+
+   for (Integer i = 0; i < g; ++i)
+      for (Integer j = 0; j < g; ++j)
+         info(globalIndex[i], globalIndex[j]) = globalInfo[i * g + j];
+
+   for (UnsignedInt b = 0; b < blocks.size(); ++b)
+   {
+      const LocalBlock &lb = blocks[b];
+      Integer l = lb.index.size();
+      for (Integer k = 0; k < l; ++k)
+      {
+         for (Integer m = 0; m < l; ++m)
+            info(lb.index[k], lb.index[m]) = lb.info[k * l + m];
+         for (Integer j = 0; j < g; ++j)
+         {
+            info(lb.index[k], globalIndex[j]) = lb.coupling[k * g + j];
+            info(globalIndex[j], lb.index[k]) = lb.coupling[k * g + j];
+         }
+      }
+   }
+
+   return info;
+}
+
+//------------------------------------------------------------------------------
+// Rvector GetRightHandSide() const
+//------------------------------------------------------------------------------
+/**
+ * Returns the full right hand side
+ */
+//------------------------------------------------------------------------------
+Rvector BlockNormalEquations::GetRightHandSide() const
+{
+   Rvector rhs(parameterCount);
+   for (UnsignedInt i = 0; i < globalIndex.size(); ++i)
+      rhs[globalIndex[i]] = globalRhs[i];
+   for (UnsignedInt b = 0; b < blocks.size(); ++b)
+      for (UnsignedInt k = 0; k < blocks[b].index.size(); ++k)
+         rhs[blocks[b].index[k]] = blocks[b].rhs[k];
+   return rhs;
+}
+
+//------------------------------------------------------------------------------
+// void Solve(RealArray &dx)
+//------------------------------------------------------------------------------
+/**
+ * Solves the normal equations
+ *
+ * The local parameters are eliminated block by block, the reduced system for
+ * the global parameters is solved, and the local parameters are recovered by
+ * back substitution.  The factors are kept for GetCovariance().
+ *
+ * @param dx The solution, one element per parameter
+ */
+//------------------------------------------------------------------------------
+void BlockNormalEquations::Solve(RealArray &dx)
+{
+   Integer g = globalIndex.size();
+
+   removedIndexes.clear();
+   activeGlobal.clear();
+   for (Integer i = 0; i < g; ++i)
+   {
+      if (IsGlobalRowZero(i))
+         removedIndexes.push_back(globalIndex[i]);
+      else
+         activeGlobal.push_back(i);
+   }
+   Integer ga = activeGlobal.size();
+
+   RealArray schur(ga * ga), s(ga);
+   for (Integer i = 0; i < ga; ++i)
+   {
+      for (Integer j = 0; j < ga; ++j)
+         schur[i * ga + j] = globalInfo[activeGlobal[i] * g + activeGlobal[j]];
+      s[i] = globalRhs[activeGlobal[i]];
+   }
+
+   // Eliminate the local parameters: S = G - C^T L^-1 C, s = r - C^T L^-1 rb
+   RealArray c;
+   for (UnsignedInt b = 0; b < blocks.size(); ++b)
+   {
+      LocalBlock &lb = blocks[b];
+      Integer l = lb.index.size();
+
+      lb.active.clear();
+      for (Integer k = 0; k < l; ++k)
+      {
+         bool isZero = true;
+         for (Integer m = 0; (m < l) && isZero; ++m)
+            isZero = (lb.info[k * l + m] == 0.0);
+         for (Integer j = 0; (j < g) && isZero; ++j)
+            isZero = (lb.coupling[k * g + j] == 0.0);
+
+         if (isZero)
+            removedIndexes.push_back(lb.index[k]);
+         else
+            lb.active.push_back(k);
+      }
+
+      Integer la = lb.active.size();
+      lb.factor.assign(la * la, 0.0);
+      lb.gain.assign(la * ga, 0.0);
+      lb.y.assign(la, 0.0);
+      if (la == 0)
+         continue;
+
+      for (Integer k = 0; k < la; ++k)
+      {
+         for (Integer m = 0; m < la; ++m)
+            lb.factor[k * la + m] = lb.info[lb.active[k] * l + lb.active[m]];
+         for (Integer j = 0; j < ga; ++j)
+            lb.gain[k * ga + j] = lb.coupling[lb.active[k] * g + activeGlobal[j]];
+         lb.y[k] = lb.rhs[lb.active[k]];
+      }
+
+      if (!Factor(&lb.factor[0], la))
+         throw UtilityException("BlockNormalEquations: the information "
+               "matrix of a block of local parameters is not positive "
+               "definite");
+
+      c = lb.gain;
+      if (ga > 0)
+         SolveFactored(&lb.factor[0], la, &lb.gain[0], ga);
+      SolveFactored(&lb.factor[0], la, &lb.y[0], 1);
+
+      for (Integer k = 0; k < la; ++k)
+      {
+         for (Integer i = 0; i < ga; ++i)
+         {
+            Real cki = c[k * ga + i];
+            if (cki == 0.0)
+               continue;
+            Real *row = &schur[i * ga];
+            const Real *gain = &lb.gain[k * ga];
+            for (Integer j = 0; j < ga; ++j)
+               row[j] -= cki * gain[j];
+            s[i] -= cki * lb.y[k];
+         }
+      }
+   }
+
+   schurFactor = schur;
+   if ((ga > 0) && !Factor(&schurFactor[0], ga))
+      throw UtilityException("BlockNormalEquations: the reduced information "
+            "matrix is not positive definite");
+
+   if (ga > 0)
+      SolveFactored(&schurFactor[0], ga, &s[0], 1);
+
+   // Back substitution: xb = Lb^-1 rb - Lb^-1 Cb xg
+   dx.assign(parameterCount, 0.0);
+   for (Integer i = 0; i < ga; ++i)
+      dx[globalIndex[activeGlobal[i]]] = s[i];
+
+   for (UnsignedInt b = 0; b < blocks.size(); ++b)
+   {
+      const LocalBlock &lb = blocks[b];
+      for (UnsignedInt k = 0; k < lb.active.size(); ++k)
+      {
+         Real value = lb.y[k];
+         for (Integer j = 0; j < ga; ++j)
+            value -= lb.gain[k * ga + j] * s[j];
+         dx[lb.index[lb.active[k]]] = value;
+      }
+   }
+
+   std::sort(removedIndexes.begin(), removedIndexes.end());
+   isSolved = true;
+}
+
+//------------------------------------------------------------------------------
+// void GetCovariance(Rmatrix &cov) const
+//------------------------------------------------------------------------------
+/**
+ * Builds the inverse of the information matrix from the factors of the last
+ * solution
+ *
+ * With S^-1 the inverse of the Schur complement and Kb = Lb^-1 Cb, the
+ * blocks of the inverse are
+ *
+ *    global-global   S^-1
+ *    local-global    -Kb S^-1
+ *    local-local     Lb^-1 delta_bc + Kb S^-1 Kc^T
+ *
+ * Rows and columns of removed parameters are zero.  The local-local blocks
+ * between different blocks make the cost grow with the square of the number
+ * of blocks; GetBlockCovariance() leaves them out.
+ *
+ * @param cov The covariance matrix
+ */
+//------------------------------------------------------------------------------
+void BlockNormalEquations::GetCovariance(Rmatrix &cov) const
+{
+   std::vector<RealArray> kp;
+   BuildBlockCovariance(cov, kp);
+
+   Integer ga = activeGlobal.size();
+   for (UnsignedInt b = 0; b < blocks.size(); ++b)
+   {
+      const LocalBlock &lb = blocks[b];
+      for (UnsignedInt k = 0; k < lb.active.size(); ++k)
+      {
+         Integer row = lb.index[lb.active[k]];
+         for (Integer i = 0; i < ga; ++i)
+         {
+            Integer col = globalIndex[activeGlobal[i]];
+            cov(row, col) = -kp[b][k * ga + i];
+            cov(col, row) = -kp[b][k * ga + i];
+         }
+      }
+
+      for (UnsignedInt c = b + 1; c < blocks.size(); ++c)
+      {
+         const LocalBlock &lc = blocks[c];
+         for (UnsignedInt k = 0; k < lb.active.size(); ++k)
+         {
+            Integer row = lb.index[lb.active[k]];
+            for (UnsignedInt m = 0; m < lc.active.size(); ++m)
+            {
+               Real value = 0.0;
+               for (Integer i = 0; i < ga; ++i)
+                  value += kp[b][k * ga + i] * lc.gain[m * ga + i];
+
+               Integer col = lc.index[lc.active[m]];
+               cov(row, col) = value;
+               cov(col, row) = value;
+            }
+         }
+      }
+   }
+}
+
+//------------------------------------------------------------------------------
+// void GetBlockCovariance(Rmatrix &cov) const
+//------------------------------------------------------------------------------
+/**
+ * Builds the global block and the diagonal local blocks of the inverse of
+ * the information matrix from the factors of the last solution
+ *
+ * These blocks, S^-1 and Lb^-1 + Kb S^-1 Kb^T, hold the variances of all
+ * the parameters and the correlations within each set.  The other elements
+ * are zero, so the cost grows linearly with the number of blocks.
+ *
+ * @param cov The covariance matrix
+ */
+//------------------------------------------------------------------------------
+void BlockNormalEquations::GetBlockCovariance(Rmatrix &cov) const
+{
+   std::vector<RealArray> kp;
+   BuildBlockCovariance(cov, kp);
+}
+
+//------------------------------------------------------------------------------
+// const IntegerArray& GetRemovedIndexes() const
+//------------------------------------------------------------------------------
+/**
+ * Returns the indices of the parameters removed from the last solution
+ * because their rows of the information matrix are zero
+ */
+//------------------------------------------------------------------------------
+const IntegerArray& BlockNormalEquations::GetRemovedIndexes() const
+{
+   return removedIndexes;
+}
+
+//------------------------------------------------------------------------------
+// bool Factor(Real *a, Integer n)
+//------------------------------------------------------------------------------
+/**
+ * Cholesky factorization, A = L L^T, in place
+ *
+ * @param a The symmetric n x n row-major matrix; on return its lower triangle
+ *          holds L
+ * @param n The matrix size
+ *
+ * @return false if the matrix is not positive definite
+ */
+//------------------------------------------------------------------------------
+bool BlockNormalEquations::Factor(Real *a, Integer n)
+{
+   for (Integer j = 0; j < n; ++j)
+   {
+      Real *rowJ = &a[j * n];
+      Real d = rowJ[j];
+      for (Integer k = 0; k < j; ++k)
+         d -= rowJ[k] * rowJ[k];
+      if (!(d > 0.0))
+         return false;
+      d = std::sqrt(d);
+      rowJ[j] = d;
+
+      for (Integer i = j + 1; i < n; ++i)
+      {
+         Real *rowI = &a[i * n];
+         Real sum = rowI[j];
+         for (Integer k = 0; k < j; ++k)
+            sum -= rowI[k] * rowJ[k];
+         rowI[j] = sum / d;
+      }
+   }
+   return true;
+}
+
+//------------------------------------------------------------------------------
+// void SolveFactored(const Real *l, Integer n, Real *b, Integer cols)
+//------------------------------------------------------------------------------
+/**
+ * Solves L L^T X = B in place, with L from Factor()
+ *
+ * @param l    The n x n Cholesky factor
+ * @param n    The matrix size
+ * @param b    The n x cols row-major right hand sides, replaced by X
+ * @param cols The number of right hand sides
+ */
+//------------------------------------------------------------------------------
+void BlockNormalEquations::SolveFactored(const Real *l, Integer n, Real *b,
+      Integer cols)
+{
+   // L Z = B
+   for (Integer i = 0; i < n; ++i)
+   {
+      Real *rowI = &b[i * cols];
+      for (Integer k = 0; k < i; ++k)
+      {
+         Real lik = l[i * n + k];
+         if (lik == 0.0)
+            continue;
+         const Real *rowK = &b[k * cols];
+         for (Integer c = 0; c < cols; ++c)
+            rowI[c] -= lik * rowK[c];
+      }
+      Real inv = 1.0 / l[i * n + i];
+      for (Integer c = 0; c < cols; ++c)
+         rowI[c] *= inv;
+   }
+
+   // L^T X = Z
+   for (Integer i = n - 1; i >= 0; --i)
+   {
+      Real *rowI = &b[i * cols];
+      for (Integer k = i + 1; k < n; ++k)
+      {
+         Real lki = l[k * n + i];
+         if (lki == 0.0)
+            continue;
+         const Real *rowK = &b[k * cols];
+         for (Integer c = 0; c < cols; ++c)
+            rowI[c] -= lki * rowK[c];
+      }
+      Real inv = 1.0 / l[i * n + i];
+      for (Integer c = 0; c < cols; ++c)
+         rowI[c] *= inv;
+   }
+}
+
+//------------------------------------------------------------------------------
+// Private Methods
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+// bool IsGlobalRowZero(Integer pos) const
+//------------------------------------------------------------------------------
+/**
+ * Checks if the row of a global parameter in the information matrix is zero
+ *
+ * @param pos Position of the parameter in the global set
+ */
+//------------------------------------------------------------------------------
+bool BlockNormalEquations::IsGlobalRowZero(Integer pos) const
+{
+   Integer g = globalIndex.size();
+   for (Integer j = 0; j < g; ++j)
+      if (globalInfo[pos * g + j] != 0.0)
+         return false;
+
+   for (UnsignedInt b = 0; b < blocks.size(); ++b)
+      for (UnsignedInt k = 0; k < blocks[b].index.size(); ++k)
+         if (blocks[b].coupling[k * g + pos] != 0.0)
+            return false;
+
+   return true;
+}
+
+//------------------------------------------------------------------------------
+// void AddElement(Integer i, Integer j, Real value)
+//------------------------------------------------------------------------------
+/**
+ * Adds a value to an element of the information matrix
+ *
+ * Elements with a global row and a local column are the transpose of the
+ * coupling and are skipped.
+ *
+ * @param i     Row index
+ * @param j     Column index
+ * @param value The value to add
+ */
+//------------------------------------------------------------------------------
+void BlockNormalEquations::AddElement(Integer i, Integer j, Real value)
+{
+   Integer bi = blockOf[i], bj = blockOf[j];
+   Integer g = globalIndex.size();
+
+   if ((bi < 0) && (bj < 0))
+      globalInfo[position[i] * g + position[j]] += value;
+   else if (bj < 0)
+      blocks[bi].coupling[position[i] * g + position[j]] += value;
+   else if (bi < 0)
+      return;
+   else if (bi == bj)
+      blocks[bi].info[position[i] * blocks[bi].index.size() + position[j]] +=
+            value;
+   else
+      throw UtilityException("BlockNormalEquations: the information added "
+            "couples local parameters of different blocks");
+}
+
+//------------------------------------------------------------------------------
+// void BuildBlockCovariance(Rmatrix &cov, std::vector<RealArray> &kp) const
+//------------------------------------------------------------------------------
+/**
+ * Sets the covariance to the global block, S^-1, and the diagonal local
+ * blocks, Lb^-1 + Kb S^-1 Kb^T, with zeros elsewhere
+ *
+ * @param cov The covariance matrix
+ * @param kp  Set to Kb S^-1 for each block, row-major over the active local
+ *            and global parameters
+ */
+//------------------------------------------------------------------------------
+void BlockNormalEquations::BuildBlockCovariance(Rmatrix &cov,
+      std::vector<RealArray> &kp) const
+{
+   if (!isSolved)
+      throw UtilityException("BlockNormalEquations: the covariance requires "
+            "a solution of the current normal equations");
+
+   cov.SetSize(parameterCount, parameterCount);
+   for (Integer i = 0; i < parameterCount; ++i)
+      for (Integer j = 0; j < parameterCount; ++j)
+         cov(i, j) = 0.0;
+
+   Integer ga = activeGlobal.size();
+   RealArray pgg(ga * ga, 0.0);
+   for (Integer i = 0; i < ga; ++i)
+      pgg[i * ga + i] = 1.0;
+   if (ga > 0)
+      SolveFactored(&schurFactor[0], ga, &pgg[0], ga);
+
+   for (Integer i = 0; i < ga; ++i)
+      for (Integer j = 0; j < ga; ++j)
+         cov(globalIndex[activeGlobal[i]], globalIndex[activeGlobal[j]]) =
+               pgg[i * ga + j];
+
+   kp.assign(blocks.size(), RealArray());
+   for (UnsignedInt b = 0; b < blocks.size(); ++b)
+   {
+      const LocalBlock &lb = blocks[b];
+      Integer la = lb.active.size();
+      kp[b].assign(la * ga, 0.0);
+
+      for (Integer k = 0; k < la; ++k)
+      {
+         for (Integer j = 0; j < ga; ++j)
+         {
+            Real kkj = lb.gain[k * ga + j];
+            if (kkj == 0.0)
+               continue;
+            for (Integer i = 0; i < ga; ++i)
+               kp[b][k * ga + i] += kkj * pgg[j * ga + i];
+         }
+      }
+
+      RealArray linv(la * la, 0.0);
+      for (Integer k = 0; k < la; ++k)
+         linv[k * la + k] = 1.0;
+      if (la > 0)
+         SolveFactored(&lb.factor[0], la, &linv[0], la);
+
+      for (Integer k = 0; k < la; ++k)
+         for (Integer m = 0; m < la; ++m)
+         {
+            Real value = 0.0;
+            for (Integer i = 0; i < ga; ++i)
+               value += kp[b][k * ga + i] * lb.gain[m * ga + i];
+            cov(lb.index[lb.active[k]], lb.index[lb.active[m]]) =
+                  linv[k * la + m] + value;
+         }
+   }
+}
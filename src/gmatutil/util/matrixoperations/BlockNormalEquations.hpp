@@ -0,0 +1,139 @@
+//$Id$
+//------------------------------------------------------------------------------
+//                             BlockNormalEquations
+//------------------------------------------------------------------------------
+// GMAT: General Mission Analysis Tool
+//
+// Copyright (c) 2002 - 2020 United States Government as represented by the
+// Administrator of the National Aeronautics and Space Administration.
+// All Other Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// You may not use this file except in compliance with the License.
+// You may obtain a copy of the License at:
+// http://www.apache.org/licenses/LICENSE-2.0.
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied.   See the License for the specific language
+// governing permissions and limitations under the License.
+//
+// Author: GMAT Development Team
+// Created: 2026/10/17
+//
+/**
+ * Declares BlockNormalEquations class.
+ */
+//------------------------------------------------------------------------------
+
+#ifndef BlockNormalEquations_hpp
+#define BlockNormalEquations_hpp
+
+#include "utildefs.hpp"
+#include "Rmatrix.hpp"
+#include "Rvector.hpp"
+
+/**
+ * Normal equations of a least squares problem with local parameters.
+ *
+ * The parameters are split into global parameters, which any measurement may
+ * depend on, and blocks of local parameters, such as the biases of a single
+ * tracking configuration, which only their own measurements depend on.  The
+ * information matrix then has an arrow structure
+ *
+ *    [ G    C1^T  C2^T  ... ]
+ *    [ C1   L1              ]
+ *    [ C2         L2        ]
+ *
+ * and only G, the couplings Cb and the local blocks Lb are stored, so memory
+ * and accumulation cost grow linearly with the number of blocks.  Solve()
+ * eliminates the local parameters, factoring each Lb and the Schur complement
+ * S = G - sum(Cb^T Lb^-1 Cb) with Cholesky factorizations; no inverse is
+ * formed.  GetCovariance() builds the full inverse from the factors, and
+ * GetBlockCovariance() only its global and diagonal local blocks.
+ *
+ * Parameters whose rows of the information matrix are zero are removed before
+ * the solution, as MatrixFactorization::CompressNormalMatrix() does, and get
+ * zero corrections and covariance rows.
+ */
+class GMATUTIL_API BlockNormalEquations
+{
+public:
+   BlockNormalEquations();
+   BlockNormalEquations(const BlockNormalEquations &bne);
+   ~BlockNormalEquations();
+   BlockNormalEquations& operator=(const BlockNormalEquations &bne);
+
+   void     SetStructure(const IntegerArray &parameterBlocks);
+   void     Clear();
+   Integer  GetParameterCount() const;
+   Integer  GetBlockCount() const;
+
+   void     Accumulate(const RealArray &h, Real weight, Real residual);
+   void     AddInformation(const Rmatrix &info, const Rvector &rhs);
+   Rmatrix  GetInformation() const;
+   Rvector  GetRightHandSide() const;
+
+   void     Solve(RealArray &dx);
+   void     GetCovariance(Rmatrix &cov) const;
+   void     GetBlockCovariance(Rmatrix &cov) const;
+   const IntegerArray&
+            GetRemovedIndexes() const;
+
+   static bool Factor(Real *a, Integer n);
+   static void SolveFactored(const Real *l, Integer n, Real *b, Integer cols);
+
+private:
+   /// Information of a block of local parameters
+   struct LocalBlock
+   {
+      /// Parameter indices of the block
+      IntegerArray   index;
+      /// Local information matrix Lb, row-major
+      RealArray      info;
+      /// Coupling to the global parameters Cb, row-major, one row per local
+      RealArray      coupling;
+      /// Local part of the right hand side
+      RealArray      rhs;
+
+      /// Positions of the local parameters kept in the solution
+      IntegerArray   active;
+      /// Cholesky factor of the active part of Lb
+      RealArray      factor;
+      /// Lb^-1 Cb, over the active local and global parameters
+      RealArray      gain;
+      /// Lb^-1 times the local right hand side
+      RealArray      y;
+   };
+
+   /// Number of parameters
+   Integer                 parameterCount;
+   /// Block of each parameter, -1 for global parameters
+   IntegerArray            blockOf;
+   /// Position of each parameter in the global set or in its block
+   IntegerArray            position;
+   /// Parameter indices of the global parameters
+   IntegerArray            globalIndex;
+   /// Global information matrix G, row-major
+   RealArray               globalInfo;
+   /// Global part of the right hand side
+   RealArray               globalRhs;
+   /// The local blocks
+   std::vector<LocalBlock> blocks;
+
+   /// Positions of the global parameters kept in the solution
+   IntegerArray            activeGlobal;
+   /// Cholesky factor of the Schur complement
+   RealArray               schurFactor;
+   /// Indices of the parameters removed from the last solution
+   IntegerArray            removedIndexes;
+   /// Flag indicating that the factors match the accumulated data
+   bool                    isSolved;
+
+   bool     IsGlobalRowZero(Integer pos) const;
+   void     AddElement(Integer i, Integer j, Real value);
+   void     BuildBlockCovariance(Rmatrix &cov,
+                                 std::vector<RealArray> &kp) const;
+};
+
+#endif
@@ -33,6 +33,7 @@
 #include "RealUtilities.hpp"
 #include "UtilityException.hpp"
 #include "MessageInterface.hpp"
+#include "MatrixUtil.hpp"
 #include <iostream>
 
 //------------------------------------------------------------------------------
@@ -131,6 +132,19 @@ void CholeskyFactorization::Factor(const Rmatrix &inputMatrix, Rmatrix &R)
       throw UtilityException(errMessage);
    }
 
+   if (GmatMatrixUtil::UseLapack(rowCount))
+   {
+      R = inputMatrix;
+      if (GmatMatrixUtil::CholeskyFactor((Real*)R.GetDataVector(), rowCount)
+            != 0)
+      {
+         std::string errMessage =
+            "Matrix must be positive definite for Cholesky decomposition.";
+         throw UtilityException(errMessage);
+      }
+      return;
+   }
+
    Integer array_size = rowCount * (rowCount + 1) / 2;
    sum1 = new Real[array_size];
    Integer index = 0;
@@ -230,6 +244,19 @@ void CholeskyFactorization::Factor(const Rmatrix &inputMatrix, Rmatrix &R)
 //------------------------------------------------------------------------------
 void CholeskyFactorization::Invert(Rmatrix &inputMatrix)
 {
+   if ((inputMatrix.GetNumRows() == inputMatrix.GetNumColumns()) &&
+       GmatMatrixUtil::UseLapack(inputMatrix.GetNumRows()))
+   {
+      if (GmatMatrixUtil::CholeskyInvert((Real*)inputMatrix.GetDataVector(),
+            inputMatrix.GetNumRows()) != 0)
+      {
+         std::string errMessage =
+            "Matrix must be positive definite for Cholesky decomposition.";
+         throw UtilityException(errMessage);
+      }
+      return;
+   }
+
    Real work, din;
    Rmatrix R(inputMatrix.GetNumRows(), inputMatrix.GetNumRows());
    Rmatrix w;
@@ -328,6 +355,17 @@ Integer CholeskyFactorization::Invert(Real* sum1, Integer array_size)
 
    const Real epsilon = 1.0e-10;
 
+   if (GmatMatrixUtil::UseLapack(rowCount))
+   {
+      if (GmatMatrixUtil::PackedCholeskyInvert(sum1, rowCount) != 0)
+      {
+         std::string errMessage =
+            "Matrix must be positive definite for Cholesky decomposition.";
+         throw UtilityException(errMessage);
+      }
+      return 0;
+   }
+
    rowCountIf = 0;
    j = 1;
 
@@ -32,6 +32,7 @@
 #include "LUFactorization.hpp"
 #include "QRFactorization.hpp"
 #include "UtilityException.hpp"
+#include "MatrixUtil.hpp"
 #include <iostream>
 
 //------------------------------------------------------------------------------
@@ -274,6 +275,18 @@ void LUFactorization::Invert(Rmatrix &inputMatrix)
       throw UtilityException(errMessage);
    }
 
+   if (GmatMatrixUtil::UseLapack(inputMatrix.GetNumRows()))
+   {
+      if (GmatMatrixUtil::LUInvert((Real*)inputMatrix.GetDataVector(),
+            inputMatrix.GetNumRows()) != 0)
+      {
+         std::string errMessage =
+            "The matrix is singular, inverse cannot be computed.\n";
+         throw UtilityException(errMessage);
+      }
+      return;
+   }
+
    determinant = Determinant(inputMatrix);
 
    if (determinant == 0)
@@ -363,7 +376,19 @@ void LUFactorization::Invert(Rmatrix &inputMatrix)
 //------------------------------------------------------------------------------
 void LUFactorization::SolveSystem(const Rmatrix inputMatrix, Rvector b, Rvector &x)
 {
-   if (inputMatrix.GetNumRows() == inputMatrix.GetNumColumns())
+   if ((inputMatrix.GetNumRows() == inputMatrix.GetNumColumns()) &&
+       GmatMatrixUtil::UseLapack(inputMatrix.GetNumRows()))
+   {
+      x = b;
+      if (GmatMatrixUtil::LUSolve(inputMatrix.GetDataVector(),
+            inputMatrix.GetNumRows(), (Real*)x.GetDataVector()) != 0)
+      {
+         std::string errMessage =
+            "The matrix is singular, the system cannot be solved.\n";
+         throw UtilityException(errMessage);
+      }
+   }
+   else if (inputMatrix.GetNumRows() == inputMatrix.GetNumColumns())
    {
       // Use algorithms 3.1.1 and 3.1.2
       Rmatrix L(inputMatrix.GetNumRows(), inputMatrix.GetNumColumns());
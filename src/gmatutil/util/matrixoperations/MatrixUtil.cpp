@@ -0,0 +1,598 @@
+//$Id$
+//------------------------------------------------------------------------------
+//                                 MatrixUtil
+//------------------------------------------------------------------------------
+// GMAT: General Mission Analysis Tool
+//
+// Copyright (c) 2002 - 2020 United States Government as represented by the
+// Administrator of the National Aeronautics and Space Administration.
+// All Other Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// You may not use this file except in compliance with the License.
+// You may obtain a copy of the License at:
+// http://www.apache.org/licenses/LICENSE-2.0.
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied.   See the License for the specific language
+// governing permissions and limitations under the License.
+//
+// Author: GMAT Development Team
+// Created: 2026/10/17
+//
+/**
+ * Implements the dense matrix kernels in GmatMatrixUtil.
+ *
+ * The LAPACK routines work on column-major storage.  A row-major array seen
+ * column-major is the transpose of the matrix, so a symmetric matrix passes
+ * through unchanged, the lower triangle of a column-major factor is the upper
+ * triangle of the row-major one, and inverting the transpose in place leaves
+ * the row-major inverse.
+ */
+//------------------------------------------------------------------------------
+
+#include "MatrixUtil.hpp"
+#include "UtilityException.hpp"
+#include <algorithm>          // for std::min()
+#include <cstring>            // for memcpy()
+#include <vector>
+
+#ifdef GMAT_USE_BLAS
+extern "C"
+{
+   void dgemm_(const char *transa, const char *transb, const int *m,
+         const int *n, const int *k, const double *alpha, const double *a,
+         const int *lda, const double *b, const int *ldb, const double *beta,
+         double *c, const int *ldc);
+   void dpotrf_(const char *uplo, const int *n, double *a, const int *lda,
+         int *info);
+   void dpotri_(const char *uplo, const int *n, double *a, const int *lda,
+         int *info);
+   void dpptrf_(const char *uplo, const int *n, double *ap, int *info);
+   void dpptri_(const char *uplo, const int *n, double *ap, int *info);
+   void dgetrf_(const int *m, const int *n, double *a, const int *lda,
+         int *ipiv, int *info);
+   void dgetri_(const int *n, double *a, const int *lda, const int *ipiv,
+         double *work, const int *lwork, int *info);
+   void dgetrs_(const char *trans, const int *n, const int *nrhs,
+         const double *a, const int *lda, const int *ipiv, double *b,
+         const int *ldb, int *info);
+   void dgeqrf_(const int *m, const int *n, double *a, const int *lda,
+         double *tau, double *work, const int *lwork, int *info);
+   void dorgqr_(const int *m, const int *n, const int *k, double *a,
+         const int *lda, const double *tau, double *work, const int *lwork,
+         int *info);
+   void dtrtrs_(const char *uplo, const char *trans, const char *diag,
+         const int *n, const int *nrhs, const double *a, const int *lda,
+         double *b, const int *ldb, int *info);
+}
+#endif
+
+namespace
+{
+   /// Rows of the product tile held in registers
+   const Integer TILE_ROWS   = 4;
+   /// Columns of the product tile held in registers
+   const Integer TILE_COLS   = 8;
+   /// Rows of op(A) packed at a time
+   const Integer BLOCK_ROWS  = 64;
+   /// Depth of the packed panels
+   const Integer BLOCK_DEPTH = 256;
+   /// Width of the packed panel of op(B)
+   const Integer BLOCK_COLS  = 512;
+   /// Largest right operand, in elements, multiplied without packing
+   const Integer SMALL_SIZE  = 1024;
+
+   //---------------------------------------------------------------------------
+   // Real OpA(const Real *a, bool transposeA, Integer m, Integer k,
+   //       Integer i, Integer p)
+   //---------------------------------------------------------------------------
+   /**
+    * Returns element (i, p) of op(A), where A is m x k, or k x m if transposed
+    */
+   //---------------------------------------------------------------------------
+   inline Real OpA(const Real *a, bool transposeA, Integer m, Integer k,
+         Integer i, Integer p)
+   {
+      return (transposeA ? a[p * m + i] : a[i * k + p]);
+   }
+
+   //---------------------------------------------------------------------------
+   // void MultiplyTile(Integer kc, const Real *ap, const Real *bp, Real *c,
+   //       Integer ldc, Integer rows, Integer cols)
+   //---------------------------------------------------------------------------
+   /**
+    * Adds the product of a packed TILE_ROWS x kc sliver of op(A) and a packed
+    * kc x TILE_COLS sliver of op(B) to a tile of C.
+    *
+    * The tile is loaded into local sums first so each element keeps adding
+    * its terms in order of increasing depth.
+    *
+    * @param kc   Depth of the slivers
+    * @param ap   The op(A) sliver, TILE_ROWS values per depth
+    * @param bp   The op(B) sliver, TILE_COLS values per depth
+    * @param c    The first element of the tile
+    * @param ldc  Row stride of C
+    * @param rows Rows of the tile inside C
+    * @param cols Columns of the tile inside C
+    */
+   //---------------------------------------------------------------------------
+   void MultiplyTile(Integer kc, const Real *ap, const Real *bp, Real *c,
+         Integer ldc, Integer rows, Integer cols)
+   {
+      Real sum[TILE_ROWS][TILE_COLS] = {};
+      for (Integer r = 0; r < rows; ++r)
+         for (Integer j = 0; j < cols; ++j)
+            sum[r][j] = c[r * ldc + j];
+
+      for (Integer p = 0; p < kc; ++p)
+      {
+         const Real *ar = ap + p * TILE_ROWS;
+         const Real *bj = bp + p * TILE_COLS;
+         for (Integer r = 0; r < TILE_ROWS; ++r)
+            for (Integer j = 0; j < TILE_COLS; ++j)
+               sum[r][j] += ar[r] * bj[j];
+      }
+
+      for (Integer r = 0; r < rows; ++r)
+         for (Integer j = 0; j < cols; ++j)
+            c[r * ldc + j] = sum[r][j];
+   }
+
+   #ifndef GMAT_USE_BLAS
+   //---------------------------------------------------------------------------
+   // void NoLapack(const std::string &routine)
+   //---------------------------------------------------------------------------
+   /**
+    * Reports a call to a LAPACK route in a build without LAPACK
+    */
+   //---------------------------------------------------------------------------
+   void NoLapack(const std::string &routine)
+   {
+      throw UtilityException("GmatMatrixUtil::" + routine + "() requires "
+            "GMAT to be built with GMAT_USE_BLAS");
+   }
+   #endif
+}
+
+
+//------------------------------------------------------------------------------
+// void Multiply(bool transposeA, bool transposeB, Integer m, Integer n,
+//       Integer k, Real alpha, const Real *a, const Real *b, Real beta,
+//       Real *c)
+//------------------------------------------------------------------------------
+/**
+ * Forms C = alpha op(A) op(B) + beta C on row-major arrays.
+ *
+ * op(A) is m x k and op(B) is k x n; A is stored k x m when transposeA is set
+ * and B is stored n x k when transposeB is set.  C is m x n and must not
+ * overlap A or B.  With beta == 0 the input contents of C are ignored.
+ *
+ * Right operands of up to SMALL_SIZE elements are used in place.  Larger
+ * products pack op(B) in BLOCK_DEPTH x BLOCK_COLS panels and op(A) in
+ * BLOCK_ROWS x BLOCK_DEPTH panels, and form C in TILE_ROWS x TILE_COLS tiles
+ * whose sums stay in registers across the panel depth.
+ *
+ * @param transposeA Flag to use the transpose of A
+ * @param transposeB Flag to use the transpose of B
+ * @param m          Rows of op(A) and C
+ * @param n          Columns of op(B) and C
+ * @param k          Columns of op(A) and rows of op(B)
+ * @param alpha      Scale applied to the product
+ * @param a          The left operand
+ * @param b          The right operand
+ * @param beta       Scale applied to the input C
+ * @param c          The result
+ */
+//------------------------------------------------------------------------------
+void GmatMatrixUtil::Multiply(bool transposeA, bool transposeB, Integer m,
+      Integer n, Integer k, Real alpha, const Real *a, const Real *b,
+      Real beta, Real *c)
+{
+   if ((m <= 0) || (n <= 0))
+      return;
+
+   #ifdef GMAT_USE_BLAS
+      if ((k > 0) && ((Real)m * (Real)n * (Real)k >= BLAS_MIN_WORK))
+      {
+         // Row-major C = op(A) op(B) is column-major C^T = op(B)^T op(A)^T
+         char ta = (transposeA ? 'T' : 'N');
+         char tb = (transposeB ? 'T' : 'N');
+         int rows = n, cols = m, depth = k;
+         int lda = (transposeA ? m : k);
+         int ldb = (transposeB ? k : n);
+         int ldc = n;
+         dgemm_(&tb, &ta, &rows, &cols, &depth, &alpha, b, &ldb, a, &lda,
+               &beta, c, &ldc);
+         return;
+      }
+   #endif
+
+   Integer size = m * n;
+   if (beta == 0.0)
+      std::fill(c, c + size, 0.0);
+   else if (beta != 1.0)
+      for (Integer i = 0; i < size; ++i)
+         c[i] *= beta;
+
+   if ((k <= 0) || (alpha == 0.0))
+      return;
+
+   if (n * k <= SMALL_SIZE)
+   {
+      if (transposeB)
+      {
+         for (Integer i = 0; i < m; ++i)
+         {
+            for (Integer j = 0; j < n; ++j)
+            {
+               const Real *bj = b + j * k;
+               Real sum = 0.0;
+               for (Integer p = 0; p < k; ++p)
+                  sum += OpA(a, transposeA, m, k, i, p) * bj[p];
+               c[i * n + j] += alpha * sum;
+            }
+         }
+      }
+      else
+      {
+         for (Integer i = 0; i < m; ++i)
+         {
+            Real *ci = c + i * n;
+            for (Integer p = 0; p < k; ++p)
+            {
+               Real aip = alpha * OpA(a, transposeA, m, k, i, p);
+               const Real *bp = b + p * n;
+               for (Integer j = 0; j < n; ++j)
+                  ci[j] += aip * bp[j];
+            }
+         }
+      }
+      return;
+   }
+
+   // Panels are padded with zeros to whole tiles
+   Integer widthB = std::min(n, BLOCK_COLS);
+   widthB = (widthB + TILE_COLS - 1) / TILE_COLS * TILE_COLS;
+   Integer depth = std::min(k, BLOCK_DEPTH);
+   std::vector<Real> panelB(depth * widthB);
+   std::vector<Real> panelA(depth * (BLOCK_ROWS + TILE_ROWS));
+
+   for (Integer jc = 0; jc < n; jc += BLOCK_COLS)
+   {
+      Integer nc = std::min(BLOCK_COLS, n - jc);
+      for (Integer pc = 0; pc < k; pc += BLOCK_DEPTH)
+      {
+         Integer kc = std::min(BLOCK_DEPTH, k - pc);
+
+         // Pack op(B)(pc:pc+kc, jc:jc+nc) in slivers TILE_COLS wide
+         for (Integer jr = 0; jr < nc; jr += TILE_COLS)
+         {
+            Real *bp = &panelB[jr * kc];
+            Integer cols = std::min(TILE_COLS, nc - jr);
+            for (Integer p = 0; p < kc; ++p)
+            {
+               for (Integer j = 0; j < cols; ++j)
+                  bp[p * TILE_COLS + j] = (transposeB ?
+                        b[(jc + jr + j) * k + pc + p] :
+                        b[(pc + p) * n + jc + jr + j]);
+               for (Integer j = cols; j < TILE_COLS; ++j)
+                  bp[p * TILE_COLS + j] = 0.0;
+            }
+         }
+
+         for (Integer ic = 0; ic < m; ic += BLOCK_ROWS)
+         {
+            Integer mc = std::min(BLOCK_ROWS, m - ic);
+
+            // Pack alpha op(A)(ic:ic+mc, pc:pc+kc) in slivers TILE_ROWS high
+            for (Integer ir = 0; ir < mc; ir += TILE_ROWS)
+            {
+               Real *ap = &panelA[ir * kc];
+               Integer rows = std::min(TILE_ROWS, mc - ir);
+               for (Integer p = 0; p < kc; ++p)
+               {
+                  for (Integer r = 0; r < rows; ++r)
+                     ap[p * TILE_ROWS + r] = alpha *
+                           OpA(a, transposeA, m, k, ic + ir + r, pc + p);
+                  for (Integer r = rows; r < TILE_ROWS; ++r)
+                     ap[p * TILE_ROWS + r] = 0.0;
+               }
+            }
+
+            for (Integer jr = 0; jr < nc; jr += TILE_COLS)
+               for (Integer ir = 0; ir < mc; ir += TILE_ROWS)
+                  MultiplyTile(kc, &panelA[ir * kc], &panelB[jr * kc],
+                        c + (ic + ir) * n + jc + jr, n,
+                        std::min(TILE_ROWS, mc - ir),
+                        std::min(TILE_COLS, nc - jr));
+         }
+      }
+   }
+}
+
+
+//------------------------------------------------------------------------------
+// bool IsBlasAvailable()
+//------------------------------------------------------------------------------
+/**
+ * Checks if this build routes large products to BLAS.
+ *
+ * @return true for builds with GMAT_USE_BLAS
+ */
+//------------------------------------------------------------------------------
+bool GmatMatrixUtil::IsBlasAvailable()
+{
+   #ifdef GMAT_USE_BLAS
+      return true;
+   #else
+      return false;
+   #endif
+}
+
+
+//------------------------------------------------------------------------------
+// bool UseLapack(Integer n)
+//------------------------------------------------------------------------------
+/**
+ * Checks if an n x n factorization should go to LAPACK.
+ *
+ * @param n The matrix dimension
+ *
+ * @return true if LAPACK is available and n is at least LAPACK_MIN_SIZE
+ */
+//------------------------------------------------------------------------------
+bool GmatMatrixUtil::UseLapack(Integer n)
+{
+   #ifdef GMAT_USE_BLAS
+      return (n >= LAPACK_MIN_SIZE);
+   #else
+      return false;
+   #endif
+}
+
+
+//------------------------------------------------------------------------------
+// Integer CholeskyFactor(Real *a, Integer n)
+//------------------------------------------------------------------------------
+/**
+ * Factors a symmetric positive definite matrix as A = R^T R.
+ *
+ * @param a The row-major matrix; only its upper triangle is read.  On return
+ *          it holds R, with zeros below the diagonal.
+ * @param n The matrix dimension
+ *
+ * @return 0 on success, the order of a leading minor that is not positive
+ *         definite otherwise, in which case a is not changed
+ */
+//------------------------------------------------------------------------------
+Integer GmatMatrixUtil::CholeskyFactor(Real *a, Integer n)
+{
+   #ifdef GMAT_USE_BLAS
+      char uplo = 'L';
+      int dim = n, info = 0;
+      std::vector<Real> work(a, a + n * n);
+      dpotrf_(&uplo, &dim, &work[0], &dim, &info);
+      if (info == 0)
+      {
+         for (Integer i = 1; i < n; ++i)
+            for (Integer j = 0; j < i; ++j)
+               work[i * n + j] = 0.0;
+         memcpy(a, &work[0], n * n * sizeof(Real));
+      }
+      return info;
+   #else
+      NoLapack("CholeskyFactor");
+      return -1;
+   #endif
+}
+
+
+//------------------------------------------------------------------------------
+// Integer CholeskyInvert(Real *a, Integer n)
+//------------------------------------------------------------------------------
+/**
+ * Inverts a symmetric positive definite matrix in place.
+ *
+ * @param a The row-major matrix; only its upper triangle is read.  On return
+ *          it holds the full inverse.
+ * @param n The matrix dimension
+ *
+ * @return 0 on success, the order of a leading minor that is not positive
+ *         definite otherwise, in which case a is not changed
+ */
+//------------------------------------------------------------------------------
+Integer GmatMatrixUtil::CholeskyInvert(Real *a, Integer n)
+{
+   #ifdef GMAT_USE_BLAS
+      char uplo = 'L';
+      int dim = n, info = 0;
+      std::vector<Real> work(a, a + n * n);
+      dpotrf_(&uplo, &dim, &work[0], &dim, &info);
+      if (info == 0)
+         dpotri_(&uplo, &dim, &work[0], &dim, &info);
+      if (info == 0)
+      {
+         for (Integer i = 1; i < n; ++i)
+            for (Integer j = 0; j < i; ++j)
+               work[i * n + j] = work[j * n + i];
+         memcpy(a, &work[0], n * n * sizeof(Real));
+      }
+      return info;
+   #else
+      NoLapack("CholeskyInvert");
+      return -1;
+   #endif
+}
+
+
+//------------------------------------------------------------------------------
+// Integer PackedCholeskyInvert(Real *packed, Integer n)
+//------------------------------------------------------------------------------
+/**
+ * Inverts a symmetric positive definite matrix packed in upper triangular
+ * form, row by row, as CholeskyFactorization::Invert(Real*, Integer) uses.
+ *
+ * That layout is the column-major packed lower triangle, so LAPACK works on
+ * the array directly.
+ *
+ * @param packed The packed matrix, replaced by its packed inverse
+ * @param n      The matrix dimension
+ *
+ * @return 0 on success, nonzero if the matrix is not positive definite, in
+ *         which case the array is not changed
+ */
+//------------------------------------------------------------------------------
+Integer GmatMatrixUtil::PackedCholeskyInvert(Real *packed, Integer n)
+{
+   #ifdef GMAT_USE_BLAS
+      char uplo = 'L';
+      int dim = n, info = 0;
+      Integer size = n * (n + 1) / 2;
+      std::vector<Real> work(packed, packed + size);
+      dpptrf_(&uplo, &dim, &work[0], &info);
+      if (info == 0)
+         dpptri_(&uplo, &dim, &work[0], &info);
+      if (info == 0)
+         memcpy(packed, &work[0], size * sizeof(Real));
+      return info;
+   #else
+      NoLapack("PackedCholeskyInvert");
+      return -1;
+   #endif
+}
+
+
+//------------------------------------------------------------------------------
+// Integer LUInvert(Real *a, Integer n)
+//------------------------------------------------------------------------------
+/**
+ * Inverts a general square matrix in place using LU factorization with
+ * partial pivoting.
+ *
+ * @param a The row-major matrix, replaced by its inverse
+ * @param n The matrix dimension
+ *
+ * @return 0 on success, nonzero if the matrix is singular, in which case a
+ *         is not changed
+ */
+//------------------------------------------------------------------------------
+Integer GmatMatrixUtil::LUInvert(Real *a, Integer n)
+{
+   #ifdef GMAT_USE_BLAS
+      int dim = n, info = 0, lwork = -1;
+      std::vector<Real> lu(a, a + n * n);
+      std::vector<int> pivots(n);
+      dgetrf_(&dim, &dim, &lu[0], &dim, &pivots[0], &info);
+      if (info != 0)
+         return info;
+
+      Real size = 0.0;
+      dgetri_(&dim, &lu[0], &dim, &pivots[0], &size, &lwork, &info);
+      lwork = std::max((int)size, dim);
+      std::vector<Real> work(lwork);
+      dgetri_(&dim, &lu[0], &dim, &pivots[0], &work[0], &lwork, &info);
+      if (info == 0)
+         memcpy(a, &lu[0], n * n * sizeof(Real));
+      return info;
+   #else
+      NoLapack("LUInvert");
+      return -1;
+   #endif
+}
+
+
+//------------------------------------------------------------------------------
+// Integer LUSolve(const Real *a, Integer n, Real *b)
+//------------------------------------------------------------------------------
+/**
+ * Solves the square system A x = b using LU factorization with partial
+ * pivoting.
+ *
+ * @param a The row-major matrix, which is not changed
+ * @param n The matrix dimension
+ * @param b The right hand side, replaced by the solution
+ *
+ * @return 0 on success, nonzero if the matrix is singular
+ */
+//------------------------------------------------------------------------------
+Integer GmatMatrixUtil::LUSolve(const Real *a, Integer n, Real *b)
+{
+   #ifdef GMAT_USE_BLAS
+      // The column-major view of A is A^T, so solve with its transpose
+      char trans = 'T';
+      int dim = n, one = 1, info = 0;
+      std::vector<Real> lu(a, a + n * n);
+      std::vector<int> pivots(n);
+      dgetrf_(&dim, &dim, &lu[0], &dim, &pivots[0], &info);
+      if (info == 0)
+         dgetrs_(&trans, &dim, &one, &lu[0], &dim, &pivots[0], b, &dim, &info);
+      return info;
+   #else
+      NoLapack("LUSolve");
+      return -1;
+   #endif
+}
+
+
+//------------------------------------------------------------------------------
+// Integer QRInvert(Real *a, Integer n)
+//------------------------------------------------------------------------------
+/**
+ * Inverts a general square matrix in place as inv(R) Q^T from a Householder
+ * QR factorization.
+ *
+ * @param a The row-major matrix, replaced by its inverse
+ * @param n The matrix dimension
+ *
+ * @return 0 on success, nonzero if the matrix is singular, in which case a
+ *         is not changed
+ */
+//------------------------------------------------------------------------------
+Integer GmatMatrixUtil::QRInvert(Real *a, Integer n)
+{
+   #ifdef GMAT_USE_BLAS
+      int dim = n, info = 0, lwork = -1;
+      std::vector<Real> qr(a, a + n * n);
+      std::vector<Real> tau(n);
+      Real size = 0.0;
+      dgeqrf_(&dim, &dim, &qr[0], &dim, &tau[0], &size, &lwork, &info);
+      lwork = std::max((int)size, dim);
+      std::vector<Real> work(lwork);
+      dgeqrf_(&dim, &dim, &qr[0], &dim, &tau[0], &work[0], &lwork, &info);
+      if (info != 0)
+         return info;
+
+      // Keep R, then expand the reflectors into Q
+      std::vector<Real> r(n * n, 0.0);
+      for (Integer j = 0; j < n; ++j)
+         for (Integer i = 0; i <= j; ++i)
+            r[i + j * n] = qr[i + j * n];
+
+      lwork = -1;
+      dorgqr_(&dim, &dim, &dim, &qr[0], &dim, &tau[0], &size, &lwork, &info);
+      lwork = std::max((int)size, dim);
+      work.resize(lwork);
+      dorgqr_(&dim, &dim, &dim, &qr[0], &dim, &tau[0], &work[0], &lwork,
+            &info);
+      if (info != 0)
+         return info;
+
+      // Solve R X = Q^T, all column-major
+      std::vector<Real> x(n * n);
+      for (Integer j = 0; j < n; ++j)
+         for (Integer i = 0; i < n; ++i)
+            x[i + j * n] = qr[j + i * n];
+
+      char uplo = 'U', trans = 'N', diag = 'N';
+      dtrtrs_(&uplo, &trans, &diag, &dim, &dim, &r[0], &dim, &x[0], &dim,
+            &info);
+      if (info == 0)
+         memcpy(a, &x[0], n * n * sizeof(Real));
+      return info;
+   #else
+      NoLapack("QRInvert");
+      return -1;
+   #endif
+}
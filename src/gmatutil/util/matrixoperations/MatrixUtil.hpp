@@ -0,0 +1,68 @@
+//$Id$
+//------------------------------------------------------------------------------
+//                                 MatrixUtil
+//------------------------------------------------------------------------------
+// GMAT: General Mission Analysis Tool
+//
+// Copyright (c) 2002 - 2020 United States Government as represented by the
+// Administrator of the National Aeronautics and Space Administration.
+// All Other Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// You may not use this file except in compliance with the License.
+// You may obtain a copy of the License at:
+// http://www.apache.org/licenses/LICENSE-2.0.
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied.   See the License for the specific language
+// governing permissions and limitations under the License.
+//
+// Author: GMAT Development Team
+// Created: 2026/10/17
+//
+/**
+ * Dense matrix kernels on row-major arrays.
+ *
+ * Multiply() is the product kernel behind Rmatrix::operator*() and the
+ * transpose products.  It works on cache sized blocks of the operands so the
+ * inner loop runs over contiguous rows, which compilers vectorize.  Each
+ * element of a product is summed in the same order as the textbook triple
+ * loop.
+ *
+ * When GMAT is built with GMAT_USE_BLAS, products of at least
+ * BLAS_MIN_WORK multiply-adds go to the system BLAS, and the factorization
+ * classes hand matrices of dimension LAPACK_MIN_SIZE or more to the LAPACK
+ * routines declared here.  Those routines throw a UtilityException in builds
+ * without LAPACK; UseLapack() tells callers whether to use them.
+ */
+//------------------------------------------------------------------------------
+#ifndef MatrixUtil_hpp
+#define MatrixUtil_hpp
+
+#include "utildefs.hpp"
+
+namespace GmatMatrixUtil
+{
+   /// Smallest product, in multiply-adds, sent to BLAS
+   const Real    BLAS_MIN_WORK   = 32768.0;
+   /// Smallest matrix dimension factored by LAPACK
+   const Integer LAPACK_MIN_SIZE = 32;
+
+   void    GMATUTIL_API Multiply(bool transposeA, bool transposeB, Integer m,
+                                 Integer n, Integer k, Real alpha,
+                                 const Real *a, const Real *b, Real beta,
+                                 Real *c);
+
+   bool    GMATUTIL_API IsBlasAvailable();
+   bool    GMATUTIL_API UseLapack(Integer n);
+
+   Integer GMATUTIL_API CholeskyFactor(Real *a, Integer n);
+   Integer GMATUTIL_API CholeskyInvert(Real *a, Integer n);
+   Integer GMATUTIL_API PackedCholeskyInvert(Real *packed, Integer n);
+   Integer GMATUTIL_API LUInvert(Real *a, Integer n);
+   Integer GMATUTIL_API LUSolve(const Real *a, Integer n, Real *b);
+   Integer GMATUTIL_API QRInvert(Real *a, Integer n);
+}
+
+#endif // MatrixUtil_hpp
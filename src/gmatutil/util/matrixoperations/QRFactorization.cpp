@@ -31,6 +31,7 @@
 #include "QRFactorization.hpp"
 #include "UtilityException.hpp"
 #include "LUFactorization.hpp"
+#include "MatrixUtil.hpp"
 #include <iostream>
 
 //------------------------------------------------------------------------------
@@ -718,6 +719,18 @@ void QRFactorization::Invert(Rmatrix &inputMatrix)
       throw UtilityException(errMessage);
    }
 
+   if (GmatMatrixUtil::UseLapack(inputMatrix.GetNumRows()))
+   {
+      if (GmatMatrixUtil::QRInvert((Real*)inputMatrix.GetDataVector(),
+            inputMatrix.GetNumRows()) != 0)
+      {
+         std::string errMessage =
+            "The matrix is singular, inverse cannot be computed.\n";
+         throw UtilityException(errMessage);
+      }
+      return;
+   }
+
    determinant = Determinant(inputMatrix);
 
    if (determinant == 0)
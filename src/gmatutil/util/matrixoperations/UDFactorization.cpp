@@ -0,0 +1,385 @@
+//$Id$
+//------------------------------------------------------------------------------
+//                               UDFactorization
+//------------------------------------------------------------------------------
+// GMAT: General Mission Analysis Tool
+//
+// Copyright (c) 2002 - 2020 United States Government as represented by the
+// Administrator of the National Aeronautics and Space Administration.
+// All Other Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// You may not use this file except in compliance with the License.
+// You may obtain a copy of the License at:
+// http://www.apache.org/licenses/LICENSE-2.0.
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied.   See the License for the specific language
+// governing permissions and limitations under the License.
+//
+// Author: GMAT Development Team
+// Created: 2026/10/17
+//
+/**
+ * Implements UDFactorization class.
+ *
+ * The algorithms follow G. J. Bierman, "Factorization Methods for Discrete
+ * Sequential Estimation", Academic Press, 1977.
+ */
+//------------------------------------------------------------------------------
+
+#include "UDFactorization.hpp"
+#include "UtilityException.hpp"
+
+//------------------------------------------------------------------------------
+// UDFactorization()
+//------------------------------------------------------------------------------
+/**
+ * Constructor
+ */
+//------------------------------------------------------------------------------
+UDFactorization::UDFactorization()
+{
+}
+
+//------------------------------------------------------------------------------
+// UDFactorization(const UDFactorization &udfactorization)
+//------------------------------------------------------------------------------
+/**
+ * Copy constructor
+ */
+//------------------------------------------------------------------------------
+UDFactorization::UDFactorization(const UDFactorization &udfactorization) :
+   MatrixFactorization(udfactorization)
+{
+}
+
+//------------------------------------------------------------------------------
+// ~UDFactorization()
+//------------------------------------------------------------------------------
+/**
+ * Destructor
+ */
+//------------------------------------------------------------------------------
+UDFactorization::~UDFactorization()
+{
+}
+
+//------------------------------------------------------------------------------
+// UDFactorization& operator=(const UDFactorization &udfactorization)
+//------------------------------------------------------------------------------
+/**
+ * Assignment operator
+ */
+//------------------------------------------------------------------------------
+UDFactorization& UDFactorization::operator=(
+      const UDFactorization &udfactorization)
+{
+   if (this != &udfactorization)
+   {
+      //Call base class method
+      MatrixFactorization::operator=(udfactorization);
+   }
+
+   return *this;
+}
+
+//------------------------------------------------------------------------------
+// void Factor(const Rmatrix &inputMatrix, Rmatrix &U, Rmatrix &D)
+//------------------------------------------------------------------------------
+/**
+ * Factors a symmetric matrix into P = U D U^T
+ *
+ * Positive semidefinite matrices are accepted; a zero pivot leaves a zero
+ * diagonal element in D and a zero column above the diagonal of U.
+ *
+ * @param inputMatrix The symmetric matrix to be factored
+ * @param U The unit upper triangular factor
+ * @param D The diagonal factor, as a diagonal matrix
+ */
+//------------------------------------------------------------------------------
+void UDFactorization::Factor(const Rmatrix &inputMatrix, Rmatrix &U,
+                             Rmatrix &D)
+{
+   Integer n = inputMatrix.GetNumRows();
+
+   if (n != inputMatrix.GetNumColumns())
+   {
+      std::string errMessage =
+         "Matrix must be square for U-D decomposition.";
+      throw UtilityException(errMessage);
+   }
+
+   RealArray p(n * n), u(n * n), d(n);
+   for (Integer i = 0; i < n; ++i)
+      for (Integer j = 0; j < n; ++j)
+         p[i * n + j] = inputMatrix(i, j);
+   Factor(p.data(), n, u.data(), d.data());
+
+   U.SetSize(n, n);
+   D.SetSize(n, n);
+   for (Integer i = 0; i < n; ++i)
+   {
+      for (Integer j = 0; j < n; ++j)
+      {
+         U(i, j) = u[i * n + j];
+         D(i, j) = 0.0;
+      }
+      D(i, i) = d[i];
+   }
+}
+
+//------------------------------------------------------------------------------
+// void Invert(Rmatrix &inputMatrix)
+//------------------------------------------------------------------------------
+/**
+ * Inverts a symmetric, positive definite matrix in place using its U-D
+ * factors, P^-1 = U^-T D^-1 U^-1
+ *
+ * @param inputMatrix The matrix to be inverted
+ */
+//------------------------------------------------------------------------------
+void UDFactorization::Invert(Rmatrix &inputMatrix)
+{
+   Integer n = inputMatrix.GetNumRows();
+
+   if (n != inputMatrix.GetNumColumns())
+   {
+      std::string errMessage =
+         "Matrix must be square for U-D decomposition.";
+      throw UtilityException(errMessage);
+   }
+
+   RealArray u(n * n), d(n), v(n * n);
+   for (Integer i = 0; i < n; ++i)
+      for (Integer j = 0; j < n; ++j)
+         v[i * n + j] = inputMatrix(i, j);
+   if (!Factor(v.data(), n, u.data(), d.data()))
+   {
+      std::string errMessage =
+         "Matrix is not positive definite; it cannot be inverted using the "
+         "U-D decomposition.";
+      throw UtilityException(errMessage);
+   }
+
+   // V = U^-1, also unit upper triangular
+   for (Integer i = 0; i < n * n; ++i)
+      v[i] = 0.0;
+   for (Integer j = 0; j < n; ++j)
+   {
+      v[j * n + j] = 1.0;
+      for (Integer i = j - 1; i >= 0; --i)
+      {
+         Real sum = 0.0;
+         for (Integer k = i + 1; k <= j; ++k)
+            sum += u[i * n + k] * v[k * n + j];
+         v[i * n + j] = -sum;
+      }
+   }
+
+   for (Integer i = 0; i < n; ++i)
+   {
+      for (Integer j = i; j < n; ++j)
+      {
+         Real sum = 0.0;
+         for (Integer k = 0; k <= i; ++k)
+            sum += v[k * n + i] * v[k * n + j] / d[k];
+         inputMatrix(i, j) = sum;
+         inputMatrix(j, i) = sum;
+      }
+   }
+}
+
+//------------------------------------------------------------------------------
+// bool Factor(const Real *p, Integer n, Real *u, Real *d)
+//------------------------------------------------------------------------------
+/**
+ * Factors a symmetric n x n matrix into P = U D U^T
+ *
+ * Only the upper triangle of p is read.  Pivots that are not positive are set
+ * to zero, along with the corresponding column of U above the diagonal.
+ *
+ * @param p The row-major matrix to be factored
+ * @param n The dimension of the matrix
+ * @param u The n x n row-major unit upper triangular factor
+ * @param d The n diagonal elements of D
+ *
+ * @return true if all pivots were positive, false otherwise
+ */
+//------------------------------------------------------------------------------
+bool UDFactorization::Factor(const Real *p, Integer n, Real *u, Real *d)
+{
+   bool positiveDefinite = true;
+
+   for (Integer i = 0; i < n; ++i)
+      for (Integer j = 0; j < n; ++j)
+         u[i * n + j] = (j < i ? 0.0 : p[i * n + j]);
+
+   for (Integer j = n - 1; j >= 0; --j)
+   {
+      Real alpha = 0.0;
+      d[j] = u[j * n + j];
+      if (d[j] > 0.0)
+         alpha = 1.0 / d[j];
+      else
+      {
+         positiveDefinite = false;
+         d[j] = 0.0;
+      }
+      u[j * n + j] = 1.0;
+
+      for (Integer k = 0; k < j; ++k)
+      {
+         Real beta = u[k * n + j];
+         u[k * n + j] = alpha * beta;
+         for (Integer i = 0; i <= k; ++i)
+            u[i * n + k] -= beta * u[i * n + j];
+      }
+   }
+
+   return positiveDefinite;
+}
+
+//------------------------------------------------------------------------------
+// void Compose(const Real *u, const Real *d, Integer n, Real *p)
+//------------------------------------------------------------------------------
+/**
+ * Builds P = U D U^T from its factors
+ *
+ * @param u The n x n row-major unit upper triangular factor
+ * @param d The n diagonal elements of D
+ * @param n The dimension of the matrix
+ * @param p The n x n row-major symmetric result
+ */
+//------------------------------------------------------------------------------
+void UDFactorization::Compose(const Real *u, const Real *d, Integer n, Real *p)
+{
+   for (Integer i = 0; i < n; ++i)
+   {
+      const Real *ui = u + i * n;
+      for (Integer j = i; j < n; ++j)
+      {
+         const Real *uj = u + j * n;
+         Real sum = ui[j] * d[j];
+         for (Integer k = j + 1; k < n; ++k)
+            sum += ui[k] * d[k] * uj[k];
+         p[i * n + j] = sum;
+         p[j * n + i] = sum;
+      }
+   }
+}
+
+//------------------------------------------------------------------------------
+// Real MeasurementUpdate(Real *u, Real *d, Integer n, const Real *h, Real r,
+//                        Real *gain, Real *work)
+//------------------------------------------------------------------------------
+/**
+ * Bierman's measurement update of the U-D factors for one scalar measurement
+ *
+ * On return u and d hold the factors of P - K h P, where K = P h^T / alpha and
+ * alpha = h P h^T + r.
+ *
+ * @param u    The n x n row-major unit upper triangular factor, updated
+ * @param d    The n diagonal elements of D, updated
+ * @param n    The dimension of the state
+ * @param h    The n partials of the measurement with respect to the state
+ * @param r    The measurement noise variance
+ * @param gain Receives the n elements of the Kalman gain K
+ * @param work Work space of n Reals
+ *
+ * @return The innovation variance alpha
+ */
+//------------------------------------------------------------------------------
+Real UDFactorization::MeasurementUpdate(Real *u, Real *d, Integer n,
+                                        const Real *h, Real r, Real *gain,
+                                        Real *work)
+{
+   // f = U^T h
+   Real *f = work;
+   for (Integer j = 0; j < n; ++j)
+   {
+      Real sum = h[j];
+      for (Integer i = 0; i < j; ++i)
+         sum += u[i * n + j] * h[i];
+      f[j] = sum;
+   }
+
+   // The unnormalized gain is accumulated in gain
+   Real alpha = r;
+   for (Integer j = 0; j < n; ++j)
+   {
+      Real v = d[j] * f[j];
+      Real alphaPrev = alpha;
+      alpha += v * f[j];
+      Real lambda = -f[j] / alphaPrev;
+      d[j] *= alphaPrev / alpha;
+
+      for (Integer i = 0; i < j; ++i)
+      {
+         Real uij = u[i * n + j];
+         u[i * n + j] = uij + gain[i] * lambda;
+         gain[i] += uij * v;
+      }
+      gain[j] = v;
+   }
+
+   for (Integer j = 0; j < n; ++j)
+      gain[j] /= alpha;
+
+   return alpha;
+}
+
+//------------------------------------------------------------------------------
+// void TimeUpdate(Real *w, const Real *dw, Integer n, Integer cols, Real *u,
+//                 Real *d, Real *work)
+//------------------------------------------------------------------------------
+/**
+ * Thornton's modified weighted Gram-Schmidt time update
+ *
+ * Finds the U-D factors of W diag(dw) W^T.  For the filter time update
+ * W = [Phi U_k | G U_q] and dw = [D_k, D_q].
+ *
+ * @param w    The n x cols row-major matrix W; overwritten
+ * @param dw   The cols weights
+ * @param n    The number of rows of W
+ * @param cols The number of columns of W
+ * @param u    Receives the n x n row-major unit upper triangular factor
+ * @param d    Receives the n diagonal elements of D
+ * @param work Work space of cols Reals
+ */
+//------------------------------------------------------------------------------
+void UDFactorization::TimeUpdate(Real *w, const Real *dw, Integer n,
+                                 Integer cols, Real *u, Real *d, Real *work)
+{
+   for (Integer j = n - 1; j >= 0; --j)
+   {
+      Real *wj = w + j * cols;
+      Real dj = 0.0;
+      for (Integer k = 0; k < cols; ++k)
+      {
+         work[k] = wj[k] * dw[k];
+         dj += work[k] * wj[k];
+      }
+      d[j] = dj;
+
+      u[j * n + j] = 1.0;
+      for (Integer i = j + 1; i < n; ++i)
+         u[i * n + j] = 0.0;
+
+      for (Integer i = 0; i < j; ++i)
+      {
+         Real *wi = w + i * cols;
+         Real uij = 0.0;
+         if (dj > 0.0)
+         {
+            for (Integer k = 0; k < cols; ++k)
+               uij += wi[k] * work[k];
+            uij /= dj;
+            for (Integer k = 0; k < cols; ++k)
+               wi[k] -= uij * wj[k];
+         }
+         u[i * n + j] = uij;
+      }
+   }
+}
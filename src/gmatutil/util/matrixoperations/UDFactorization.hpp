@@ -0,0 +1,65 @@
+//$Id$
+//------------------------------------------------------------------------------
+//                               UDFactorization
+//------------------------------------------------------------------------------
+// GMAT: General Mission Analysis Tool
+//
+// Copyright (c) 2002 - 2020 United States Government as represented by the
+// Administrator of the National Aeronautics and Space Administration.
+// All Other Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// You may not use this file except in compliance with the License.
+// You may obtain a copy of the License at:
+// http://www.apache.org/licenses/LICENSE-2.0.
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied.   See the License for the specific language
+// governing permissions and limitations under the License.
+//
+// Author: GMAT Development Team
+// Created: 2026/10/17
+//
+/**
+ * Declares UDFactorization class.
+ */
+//------------------------------------------------------------------------------
+
+#ifndef UDFactorization_hpp
+#define UDFactorization_hpp
+
+#include "utildefs.hpp"
+#include "MatrixFactorization.hpp"
+
+/**
+ * U-D factorization of symmetric, positive semidefinite matrices,
+ * P = U D U^T, with U unit upper triangular and D diagonal.
+ *
+ * Besides the MatrixFactorization interface, the class provides the kernels
+ * of a U-D covariance filter: Bierman's sequential scalar measurement update
+ * and Thornton's modified weighted Gram-Schmidt time update.  The kernels work
+ * in place on row-major arrays supplied by the caller and do not allocate
+ * memory.
+ */
+class GMATUTIL_API UDFactorization : public MatrixFactorization
+{
+public:
+   UDFactorization();
+   UDFactorization(const UDFactorization &udfactorization);
+   ~UDFactorization();
+   UDFactorization& operator=(const UDFactorization &udfactorization);
+
+   virtual void Factor(const Rmatrix &inputMatrix, Rmatrix &U, Rmatrix &D);
+   virtual void Invert(Rmatrix &inputMatrix);
+
+   // Allocation free kernels; matrices are n x n row-major arrays
+   static bool Factor(const Real *p, Integer n, Real *u, Real *d);
+   static void Compose(const Real *u, const Real *d, Integer n, Real *p);
+   static Real MeasurementUpdate(Real *u, Real *d, Integer n, const Real *h,
+                                 Real r, Real *gain, Real *work);
+   static void TimeUpdate(Real *w, const Real *dw, Integer n, Integer cols,
+                          Real *u, Real *d, Real *work);
+};
+
+#endif
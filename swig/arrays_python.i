@@ -1,39 +1,233 @@
 // Custom implementation of arrays_java.i for Python lists
+//
+// Arrays passed to GMAT can be lists, other sequences of numbers, or objects
+// that support the Python buffer protocol.  Writable, C contiguous buffers of
+// the matching type (e.g. float64 NumPy arrays for double[]) are handed to
+// GMAT in place, without a copy, so changes made by GMAT are seen by the
+// caller.  Anything else is copied into a temporary array that is freed after
+// the call.
+
+%{
+#include <cstring>
+
+/* Checks a buffer format against the native type codes of an array type */
+static int SWIG_PyBufferFormatIs(const char *format, const char *codes,
+                                 Py_ssize_t itemsize, Py_ssize_t ctypesize) {
+  const int one = 1;
+  const char nativeOrder = (*(const char *)&one == 1) ? '<' : '>';
+
+  if (!format || itemsize != ctypesize)
+    return 0;
+  if (*format == '@' || *format == '=' || *format == nativeOrder)
+    ++format;
+  else if (*format == '<' || *format == '>' || *format == '!')
+    return 0;
+  return (format[0] != '\0' && format[1] == '\0' &&
+          strchr(codes, format[0]) != NULL);
+}
+
+
+/*
+ * gmatpy.RealBuffer: a buffer protocol view of Real data held by GMAT, or of
+ * Real data allocated for the buffer.  NumPy can use it without a copy, e.g.
+ * numpy.asarray(buffer).  A view keeps the Python object that owns the memory
+ * alive, but does not follow it if the memory is reallocated (for instance
+ * when an Rvector is resized), so views should be short lived.
+ */
+typedef struct {
+  PyObject_HEAD
+  PyObject   *owner;          /* Object that owns the data, or NULL */
+  double     *data;
+  int        ownsData;        /* data was allocated for this buffer */
+  int        ndim;            /* 1 or 2 */
+  Py_ssize_t shape[2];
+  Py_ssize_t strides[2];
+} SWIG_PyRealBufferObject;
+
+static void SWIG_PyRealBuffer_dealloc(PyObject *obj) {
+  SWIG_PyRealBufferObject *self = (SWIG_PyRealBufferObject *)obj;
+  Py_XDECREF(self->owner);
+  if (self->ownsData)
+    delete[] self->data;
+  Py_TYPE(obj)->tp_free(obj);
+}
+
+static int SWIG_PyRealBuffer_getbuffer(PyObject *obj, Py_buffer *view,
+                                       int flags) {
+  static double empty = 0.0;
+  SWIG_PyRealBufferObject *self = (SWIG_PyRealBufferObject *)obj;
+  Py_ssize_t count = self->shape[0] * (self->ndim == 2 ? self->shape[1] : 1);
+
+  /* The data are row major, so a matrix is only Fortran contiguous when it
+     is a single row or column */
+  if ((flags & PyBUF_F_CONTIGUOUS) == PyBUF_F_CONTIGUOUS && self->ndim == 2 &&
+      self->shape[0] > 1 && self->shape[1] > 1) {
+    PyErr_SetString(PyExc_BufferError, "GMAT matrices are row major");
+    view->obj = NULL;
+    return -1;
+  }
+
+  view->obj = obj;
+  Py_INCREF(obj);
+  view->buf = (self->data ? self->data : &empty);
+  view->len = count * (Py_ssize_t)sizeof(double);
+  view->readonly = 0;
+  view->itemsize = sizeof(double);
+  view->format = ((flags & PyBUF_FORMAT) ? (char *)"d" : NULL);
+  view->ndim = self->ndim;
+  view->shape = ((flags & PyBUF_ND) == PyBUF_ND ? self->shape : NULL);
+  view->strides = ((flags & PyBUF_STRIDES) == PyBUF_STRIDES ?
+                   self->strides : NULL);
+  view->suboffsets = NULL;
+  view->internal = NULL;
+  return 0;
+}
+
+static PyTypeObject *SWIG_PyRealBuffer_Type(void) {
+  static PyBufferProcs bufferProcs = { SWIG_PyRealBuffer_getbuffer, NULL };
+  static PyTypeObject bufferType = { PyVarObject_HEAD_INIT(NULL, 0) };
+  static int ready = 0;
+
+  if (!ready) {
+    bufferType.tp_name = "gmatpy.RealBuffer";
+    bufferType.tp_basicsize = sizeof(SWIG_PyRealBufferObject);
+    bufferType.tp_dealloc = SWIG_PyRealBuffer_dealloc;
+    bufferType.tp_as_buffer = &bufferProcs;
+    bufferType.tp_flags = Py_TPFLAGS_DEFAULT;
+    bufferType.tp_doc = "Buffer protocol view of GMAT Real data";
+    if (PyType_Ready(&bufferType) < 0)
+      return NULL;
+    ready = 1;
+  }
+  return &bufferType;
+}
+
+/*
+ * Builds a RealBuffer.  With an owner, the buffer is a view of data, which
+ * belongs to the owner; without one, rows x cols zeroed Reals are allocated
+ * and data is ignored.  A 1 dimensional buffer has rows elements.
+ */
+static PyObject *SWIG_PyRealBuffer_New(PyObject *owner, double *data,
+                                       int ndim, Py_ssize_t rows,
+                                       Py_ssize_t cols) {
+  PyTypeObject *type = SWIG_PyRealBuffer_Type();
+  SWIG_PyRealBufferObject *self;
+  Py_ssize_t count;
+
+  if (!type)
+    return NULL;
+  if (ndim == 1)
+    cols = 1;
+  if ((ndim != 1 && ndim != 2) || rows < 0 || cols < 0) {
+    PyErr_SetString(PyExc_ValueError, "invalid buffer dimensions");
+    return NULL;
+  }
+  count = rows * cols;
+
+  self = (SWIG_PyRealBufferObject *)type->tp_alloc(type, 0);
+  if (!self)
+    return NULL;
+
+  if (owner) {
+    Py_INCREF(owner);
+    self->owner = owner;
+    self->data = data;
+    self->ownsData = 0;
+  }
+  else {
+    self->owner = NULL;
+    self->data = new double[count > 0 ? count : 1];
+    self->ownsData = 1;
+    memset(self->data, 0, (count > 0 ? count : 1) * sizeof(double));
+  }
+
+  self->ndim = ndim;
+  self->shape[0] = rows;
+  self->shape[1] = cols;
+  if (ndim == 2) {
+    self->strides[0] = cols * (Py_ssize_t)sizeof(double);
+    self->strides[1] = sizeof(double);
+  }
+  else {
+    self->strides[0] = sizeof(double);
+    self->strides[1] = 0;
+  }
+  return (PyObject *)self;
+}
+%}
+
 
 // Array support functions declarations macro
 %define PYTHON_ARRAYS_DECL(CTYPE, PYCTYPE, PYTYPE, PYFUNCNAME)
 %{
-static int SWIG_PyArrayIn##PYFUNCNAME (CTYPE **carr, PyObject *input);
+static int SWIG_PyArrayIn##PYFUNCNAME (CTYPE **carr, PyObject *input, Py_buffer *view, int *borrowed, Py_ssize_t *size);
 static void SWIG_PyArrayArgout##PYFUNCNAME (CTYPE *carr, PyObject *input);
 static PyObject* SWIG_PyArrayOut##PYFUNCNAME (CTYPE *result, int sz);
 %}
 %enddef
 
-// Array support functions macro
-%define PYTHON_ARRAYS_IMPL(CTYPE, PYCTYPE, PYTYPE, PYFUNCNAME)
+// Array support functions macro; FORMATCODES are the buffer format codes
+// that match CTYPE when the item sizes agree
+%define PYTHON_ARRAYS_IMPL(CTYPE, PYCTYPE, PYTYPE, PYFUNCNAME, FORMATCODES)
 %{
 /* CTYPE[] support */
-static int SWIG_PyArrayIn##PYFUNCNAME (CTYPE **carr, PyObject *input) {
-  int i;
-  int sz;
+static int SWIG_PyArrayIn##PYFUNCNAME (CTYPE **carr, PyObject *input, Py_buffer *view, int *borrowed, Py_ssize_t *size) {
+  Py_ssize_t i;
+  Py_ssize_t sz;
+  PyObject *seq;
+  *borrowed = 0;
   if (!input) {
     PyErr_SetString(PyExc_ValueError, "null array");
     return 0;
   }
-  sz = PyList_Size(input);
-  *carr = new CTYPE[sz];
+
+  /* Contiguous, writable buffers of the matching type are used in place */
+  if (PyObject_CheckBuffer(input)) {
+    if (PyObject_GetBuffer(input, view, PyBUF_C_CONTIGUOUS | PyBUF_FORMAT | PyBUF_WRITABLE) == 0) {
+      if (SWIG_PyBufferFormatIs(view->format, FORMATCODES, view->itemsize, sizeof(CTYPE))) {
+        *carr = (CTYPE *)view->buf;
+        *size = view->len / view->itemsize;
+        *borrowed = 1;
+        return 1;
+      }
+      PyBuffer_Release(view);
+    }
+    else
+      PyErr_Clear();
+  }
+
+  /* Anything else is copied */
+  seq = PySequence_Fast(input, "expected a list, a sequence of numbers or a contiguous array");
+  if (!seq)
+    return 0;
+  sz = PySequence_Fast_GET_SIZE(seq);
+  *carr = new CTYPE[sz > 0 ? sz : 1];
   if (!*carr) {
+    Py_DECREF(seq);
     PyErr_SetString(PyExc_MemoryError, "array memory allocation failed");
     return 0;
   }
-  for (i=0; i<sz; i++)
-    (*carr)[i] = Py##PYTYPE##_As##PYCTYPE##(PyList_GetItem(input, i));
+  for (i=0; i<sz; i++) {
+    (*carr)[i] = (CTYPE)Py##PYTYPE##_As##PYCTYPE##(PySequence_Fast_GET_ITEM(seq, i));
+    if (PyErr_Occurred()) {
+      delete[] *carr;
+      *carr = NULL;
+      Py_DECREF(seq);
+      return 0;
+    }
+  }
+  Py_DECREF(seq);
+  *size = sz;
   return 1;
 }
 
 static void SWIG_PyArrayArgout##PYFUNCNAME (CTYPE *carr, PyObject *input) {
-  int i;
-  int sz = PyList_Size(input);
+  Py_ssize_t i;
+  Py_ssize_t sz;
+  /* Other sequences cannot be updated; buffers were updated in place */
+  if (!PyList_Check(input))
+    return;
+  sz = PyList_Size(input);
   for (i=0; i<sz; i++)
     PyList_SetItem(input, i, Py##PYTYPE##_From##PYCTYPE##(carr[i]));
 }
@@ -54,26 +248,29 @@ static PyObject* SWIG_PyArrayOut##PYFUNCNAME (CTYPE *result, int sz) {
 PYTHON_ARRAYS_DECL(int, Long, Long, Int)                 /* int[] */
 PYTHON_ARRAYS_DECL(double, Double, Float, Double)     /* double[] */
 
-PYTHON_ARRAYS_IMPL(int, Long, Long, Int)                 /* int[] */
-PYTHON_ARRAYS_IMPL(double, Double, Float, Double)     /* double[] */
+PYTHON_ARRAYS_IMPL(int, Long, Long, Int, "il")           /* int[] */
+PYTHON_ARRAYS_IMPL(double, Double, Float, Double, "d") /* double[] */
 
 
 // Arrays of primitive types use the following macro. The array typemaps use support functions.
+// Borrowed buffers are released, and copies deleted, by the freearg typemap.
 %define PYTHON_ARRAYS_TYPEMAPS(CTYPE, PYCTYPE, PYTYPE, PYFUNCNAME)
 
-%typemap(in) CTYPE[]
-%{  if (!SWIG_PyArrayIn##PYFUNCNAME((CTYPE **)&$1, $input)) return NULL; %}
-%typemap(in) CTYPE[ANY]
-%{  if ($input && PyList_Size($input) != $1_size) {
+%typemap(in) CTYPE[] (Py_buffer view, int borrowed = 0, Py_ssize_t size = 0)
+%{  if (!SWIG_PyArrayIn##PYFUNCNAME((CTYPE **)&$1, $input, &view, &borrowed, &size)) SWIG_fail; %}
+%typemap(in) CTYPE[ANY] (Py_buffer view, int borrowed = 0, Py_ssize_t size = 0)
+%{  if (!SWIG_PyArrayIn##PYFUNCNAME((CTYPE **)&$1, $input, &view, &borrowed, &size)) SWIG_fail;
+  if (size != $1_size) {
     PyErr_SetString(PyExc_IndexError, "incorrect array size");
-    return NULL;
-  }
-  if (!SWIG_PyArrayIn##PYFUNCNAME((CTYPE **)&$1, $input)) return NULL; %}
-%typemap(argout) CTYPE[ANY], CTYPE[] 
-%{ SWIG_PyArrayArgout##PYFUNCNAME((CTYPE *)$1, $input); %}
+    SWIG_fail;
+  } %}
+%typemap(argout) CTYPE[ANY], CTYPE[]
+%{ if (!borrowed$argnum) SWIG_PyArrayArgout##PYFUNCNAME((CTYPE *)$1, $input); %}
+%typemap(freearg) CTYPE[ANY], CTYPE[]
+%{ if (borrowed$argnum) PyBuffer_Release(&view$argnum); else delete[] (CTYPE *)$1; %}
 %typemap(out) CTYPE[ANY]
 %{$result = SWIG_PyArrayOut##PYFUNCNAME((CTYPE *)$1, $1_dim0); %}
-%typemap(out) CTYPE[] 
+%typemap(out) CTYPE[]
 %{$result = SWIG_PyArrayOut##PYFUNCNAME((CTYPE *)$1, FillMeInAsSizeCannotBeDeterminedAutomatically); %}
 %enddef
 
@@ -82,7 +279,8 @@ PYTHON_ARRAYS_TYPEMAPS(int, Long, Long, Int)                 /* int[ANY] */
 PYTHON_ARRAYS_TYPEMAPS(double, Double, Float, Double)     /* double[ANY] */
 
 
-// Add typechecks for checking that the inputs are valid lists containing the coorrect types
+// Add typechecks for checking that the inputs are valid lists containing the
+// correct types, or objects supporting the buffer protocol
 %typecheck(SWIG_TYPECHECK_INT32_ARRAY) int*, int[] {
   $1 = PyList_Check($input) ? 1 : 0;
 
@@ -92,6 +290,8 @@ PYTHON_ARRAYS_TYPEMAPS(double, Double, Float, Double)     /* double[ANY] */
         $1 = PyLong_Check(PyList_GetItem($input, ii)) ? $1 : 0;
      }
   }
+  else
+     $1 = PyObject_CheckBuffer($input) ? 1 : 0;
 }
 
 %typecheck(SWIG_TYPECHECK_DOUBLE_ARRAY) double*, double[] {
@@ -103,4 +303,6 @@ PYTHON_ARRAYS_TYPEMAPS(double, Double, Float, Double)     /* double[ANY] */
         $1 = PyFloat_Check(PyList_GetItem($input, ii)) ? $1 : 0;
      }
   }
+  else
+     $1 = PyObject_CheckBuffer($input) ? 1 : 0;
 }
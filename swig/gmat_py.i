@@ -262,6 +262,91 @@ def __getitem__(self, index):
 
 %include "gmat.swg"
 
+// Zero-copy access to GMAT arrays through the buffer protocol.  The views are
+// gmatpy.RealBuffer objects (see arrays_python.i); NumPy uses them without a
+// copy, e.g. numpy.asarray(vec.View()).  A view is only valid until the array
+// is resized or, for a propagator, reinitialized.
+%inline %{
+PyObject *RealView(PyObject *owner) {
+  static swig_type_info *arrayType = SWIG_TypeQuery("ArrayTemplate< Real > *");
+  static swig_type_info *tableType = SWIG_TypeQuery("TableTemplate< Real > *");
+  static swig_type_info *stateType = SWIG_TypeQuery("GmatState *");
+  static swig_type_info *propType = SWIG_TypeQuery("Propagator *");
+  void *ptr = 0;
+
+  if (arrayType && SWIG_IsOK(SWIG_ConvertPtr(owner, &ptr, arrayType, 0))) {
+    ArrayTemplate<Real> *arr = (ArrayTemplate<Real> *)ptr;
+    return SWIG_PyRealBuffer_New(owner, const_cast<Real *>(arr->GetDataVector()),
+                                 1, (arr->IsSized() ? arr->GetSize() : 0), 1);
+  }
+  if (tableType && SWIG_IsOK(SWIG_ConvertPtr(owner, &ptr, tableType, 0))) {
+    TableTemplate<Real> *table = (TableTemplate<Real> *)ptr;
+    return SWIG_PyRealBuffer_New(owner, const_cast<Real *>(table->GetDataVector()),
+                                 2, table->GetNumRows(), table->GetNumColumns());
+  }
+  if (stateType && SWIG_IsOK(SWIG_ConvertPtr(owner, &ptr, stateType, 0))) {
+    GmatState *state = (GmatState *)ptr;
+    return SWIG_PyRealBuffer_New(owner, state->GetState(), 1, state->GetSize(), 1);
+  }
+  if (propType && SWIG_IsOK(SWIG_ConvertPtr(owner, &ptr, propType, 0))) {
+    Propagator *prop = (Propagator *)ptr;
+    return SWIG_PyRealBuffer_New(owner, prop->GetState(), 1,
+                                 (prop->GetState() ? prop->GetDimension() : 0), 1);
+  }
+
+  PyErr_SetString(PyExc_TypeError, "RealView needs an Rvector, Rmatrix, "
+                  "GmatState or Propagator");
+  return NULL;
+}
+
+PyObject *NewRealBuffer(Integer rows, Integer cols) {
+  return SWIG_PyRealBuffer_New(NULL, NULL, 2, rows, cols);
+}
+%}
+
+%define PYTHON_REALVIEW(ClassName)
+%extend ClassName {
+%pythoncode %{
+    def View(self):
+        """Returns a RealBuffer sharing this object's data, without a copy"""
+        return _gmat_py.RealView(self)
+
+    def __array__(self, dtype=None, copy=None):
+        import numpy
+        if copy:
+            return numpy.array(self.View(), dtype=dtype)
+        return numpy.asarray(self.View(), dtype=dtype)
+%}
+}
+%enddef
+
+PYTHON_REALVIEW(ArrayTemplate<Real>)
+PYTHON_REALVIEW(TableTemplate<Real>)
+PYTHON_REALVIEW(GmatState)
+
+%extend Propagator {
+%pythoncode %{
+    def GetStateView(self):
+        """Returns a RealBuffer sharing the propagation state, without a copy"""
+        return _gmat_py.RealView(self)
+
+    def PropagateHistory(self, count, dt):
+        """Propagates count intervals of dt seconds.
+
+        Returns a count x (GetDimension() + 1) array whose rows hold the
+        propagator time and the state after each interval; a NumPy array when
+        NumPy is installed, otherwise a RealBuffer."""
+        columns = self.GetDimension() + 1
+        history = _gmat_py.NewRealBuffer(count, columns)
+        self.PropagateSteps(count, dt, history, count * columns)
+        try:
+            import numpy
+        except ImportError:
+            return history
+        return numpy.asarray(history)
+%}
+}
+
 %pythoncode %{
    def Help(foritem = ""):
       helpstr = _gmat_py.HelpSystem_Instance().Help(foritem);